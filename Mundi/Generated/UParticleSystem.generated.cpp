@@ -37,6 +37,7 @@ BEGIN_PROPERTIES(UParticleSystem)
     MARK_AS_COMPONENT("파티클 시스템", "파티클 데이터 저장의 중추입니다.")
     ADD_PROPERTY_ARRAY(TArray<UParticleEmitter*>, EPropertyType::ObjectPtr, Emitters, "Array", true)
     ADD_PROPERTY(float, Duration, "Basic", true)
+    ADD_PROPERTY(int32, RandomSeed, "Random", true)
     ADD_PROPERTY(EParticleLODMethod, LODMethod, "LOD", true)
     ADD_PROPERTY(float, LODDistanceCheckTime, "LOD", true)
 END_PROPERTIES()
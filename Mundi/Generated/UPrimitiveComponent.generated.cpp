@@ -37,6 +37,7 @@ BEGIN_PROPERTIES(UPrimitiveComponent)
     MARK_AS_COMPONENT("프리미티브 컴포넌트", "렌더링 가능한 기본 컴포넌트입니다")
     ADD_PROPERTY(bool, bGenerateOverlapEvents, "Shape", true)
     ADD_PROPERTY(bool, bBlockComponent, "Shape", true)
+    ADD_PROPERTY(ECollisionChannel, CollisionChannel, "Shape", true)
 END_PROPERTIES()
 
 // ===== Lua Binding =====
@@ -21,17 +21,19 @@ cbuffer LightBuffer : register(b8)
     uint SpotLightCount;
 };
 
-// --- 타일 기반 라이트 컬링 리소스 ---
-// t2: 타일별 라이트 인덱스 Structured Buffer
-// 구조:  [TileIndex * MaxLightsPerTile] = LightCount
-//        [TileIndex * MaxLightsPerTile + 1 ~ ...] = LightIndices (상위 16비트: 타입, 하위 16비트: 인덱스)
+// --- 클러스터 기반 라이트 컬링 리소스 ---
+// t2: 클러스터별 라이트 인덱스 Structured Buffer (ClusteredLightCuller.h와 일치)
+// 구조:  [ClusterIndex * 2] = 라이트 목록 시작 오프셋, [ClusterIndex * 2 + 1] = LightCount
+//        [ClusterCount * 2 + TileIndex] = 타일의 슬라이스 중 최대 LightCount (디버그 히트맵용)
+//        [시작 오프셋 ~ ...] = LightIndices (상위 16비트: 타입, 하위 16비트: 인덱스)
+// ClusterIndex = (Slice * TileCountY + TileY) * TileCountX + TileX
 StructuredBuffer<uint> g_TileLightIndices : register(t2);
 
 // PointLight, SpotLight Structured Buffer
 StructuredBuffer<FPointLightInfo> g_PointLightList : register(t3);
 StructuredBuffer<FSpotLightInfo> g_SpotLightList : register(t4);
 
-// b11: 타일 컬링 설정 상수 버퍼
+// b11: 타일/클러스터 컬링 설정 상수 버퍼
 cbuffer TileCullingBuffer : register(b11)
 {
     uint TileSize;          // 타일 크기 (픽셀, 기본 16)
@@ -40,7 +42,12 @@ cbuffer TileCullingBuffer : register(b11)
     uint bUseTileCulling;   // 타일 컬링 활성화 여부 (0=비활성화, 1=활성화)
     uint ViewportStartX;    // 뷰포트 시작 X 좌표
     uint ViewportStartY;    // 뷰포트 시작 Y 좌표
-    uint2 Padding;          // 16바이트 정렬을 위한 패딩
+    uint ClusterSliceCount; // 깊이 슬라이스 개수
+    uint ClusterPadding0;
+    float ClusterDepthScale; // Slice = floor(log2(ViewDepth) * Scale + Bias)
+    float ClusterDepthBias;
+    float2 ClusterPadding1;
+    float4 ViewDepthPlane;  // 뷰 공간 깊이 = dot(WorldPos, xyz) + w
 };
 
 TextureCubeArray g_PointShadowMapArray : register(t10);
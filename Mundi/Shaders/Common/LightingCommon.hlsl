@@ -55,12 +55,23 @@ uint CalculateTileIndex(float4 screenPos, float viewportStartX, float viewportSt
     return tileY * TileCountX + tileX;
 }
 
-// 타일별 라이트 인덱스 데이터의 시작 오프셋 계산
-uint GetTileDataOffset(uint tileIndex)
+// 클러스터 인덱스 계산 (픽셀의 타일 + 월드 위치의 뷰 깊이로 구한 지수 슬라이스)
+uint CalculateClusterIndex(float4 screenPos, float3 worldPos)
 {
-    // MaxLightsPerTile = 256 (TileLightCuller.h와 일치)
-    const uint MaxLightsPerTile = 256;
-    return tileIndex * MaxLightsPerTile;
+    uint tileIndex = CalculateTileIndex(screenPos, ViewportStartX, ViewportStartY);
+
+    float viewDepth = max(dot(worldPos, ViewDepthPlane.xyz) + ViewDepthPlane.w, 1e-4f);
+    int slice = int(floor(log2(viewDepth) * ClusterDepthScale + ClusterDepthBias));
+    uint clampedSlice = uint(clamp(slice, 0, int(ClusterSliceCount) - 1));
+
+    return clampedSlice * TileCountX * TileCountY + tileIndex;
+}
+
+// 클러스터의 라이트 목록 범위 (x = g_TileLightIndices 내 시작 오프셋, y = 라이트 개수)
+uint2 GetClusterLightRange(float4 screenPos, float3 worldPos)
+{
+    uint clusterIndex = CalculateClusterIndex(screenPos, worldPos);
+    return uint2(g_TileLightIndices[clusterIndex * 2], g_TileLightIndices[clusterIndex * 2 + 1]);
 }
 
 //================================================================================================
@@ -853,16 +864,14 @@ float3 CalculateAllLights(
         ShadowMap2D, ShadowSampler
     );
 
-    // Point + Spot with 타일 컬링
+    // Point + Spot with 클러스터 컬링
     if (bUseTileCulling)
     {
-        uint tileIndex = CalculateTileIndex(screenPos, ViewportStartX, ViewportStartY);
-        uint tileDataOffset = GetTileDataOffset(tileIndex);
-        uint lightCount = g_TileLightIndices[tileDataOffset];
+        uint2 lightRange = GetClusterLightRange(screenPos, worldPos);
 
-        for (uint i = 0; i < lightCount; i++)
+        for (uint i = 0; i < lightRange.y; i++)
         {
-            uint packedIndex = g_TileLightIndices[tileDataOffset + 1 + i];
+            uint packedIndex = g_TileLightIndices[lightRange.x + i];
             uint lightType = (packedIndex >> 16) & 0xFFFF;
             uint lightIdx = packedIndex & 0xFFFF;
 
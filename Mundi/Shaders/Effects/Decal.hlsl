@@ -1,6 +1,6 @@
 //================================================================================================
 // Filename:      Decal.hlsl
-// Description:   Decal projection shader with lighting support
+// Description:   Tiled (screen-space binned) decal projection shader with lighting support
 //                Supports GOURAUD, LAMBERT, PHONG lighting models
 //================================================================================================
 
@@ -13,10 +13,14 @@
 // - (매크로 없음 = Unlit)
 
 // --- 공통 조명 시스템 include ---
+// TileCullingBuffer(b11)의 타일 그리드를 데칼 타일 목록에도 그대로 사용
 #include "../Common/LightStructures.hlsl"
 #include "../Common/LightingBuffers.hlsl"
 #include "../Common/LightingCommon.hlsl"
 
+// FTileDecalCuller::MaxDecalTextures와 일치
+#define MAX_DECAL_TEXTURES 8
+
 // --- Decal 전용 상수 버퍼 ---
 cbuffer ModelBuffer : register(b0)
 {
@@ -41,12 +45,28 @@ cbuffer PSScrollCB : register(b5)
 
 cbuffer DecalBuffer : register(b6)
 {
-    row_major float4x4 DecalMatrix;
-    float DecalOpacity;
+    uint DecalCount;
+    uint MaxDecalsPerTile;
+    float2 _pad_decalcb;
 }
 
+// --- 데칼 목록 ---
+struct FDecalInfo
+{
+    row_major float4x4 DecalMatrix;   // 월드 -> 데칼 투영 공간
+    float Opacity;
+    uint TextureSlot;                 // g_DecalTextures 인덱스
+    float2 Padding;
+};
+
+// t12: 타일별 데칼 인덱스
+// 구조:  [TileIndex * MaxDecalsPerTile] = DecalCount
+//        [TileIndex * MaxDecalsPerTile + 1 ~ ...] = 데칼 인덱스 (그리는 순서)
+StructuredBuffer<uint> g_TileDecalIndices : register(t12);
+StructuredBuffer<FDecalInfo> g_DecalList : register(t13);
+
 // --- 텍스처 리소스 ---
-Texture2D g_DecalTexColor : register(t0);
+Texture2D g_DecalTextures[MAX_DECAL_TEXTURES] : register(t14);
 TextureCubeArray g_ShadowAtlasCube : register(t8);
 Texture2D g_ShadowAtlas2D : register(t9);
 Texture2D<float2> g_VSMShadowAtlas : register(t10);
@@ -69,10 +89,9 @@ struct VS_INPUT
 struct PS_INPUT
 {
     float4 position : SV_POSITION;
-    float4 decalPos : POSITION0;    // Decal projection 좌표
+    float3 worldPos : POSITION1;    // 데칼 투영 + 조명 계산용
 
 #if defined(LIGHTING_MODEL_GOURAUD) || defined(LIGHTING_MODEL_LAMBERT) || defined(LIGHTING_MODEL_PHONG)
-    float3 worldPos : POSITION1;    // 조명 계산용
     float3 normal : NORMAL0;        // 조명 계산용
 
     #ifdef LIGHTING_MODEL_GOURAUD
@@ -91,8 +110,7 @@ PS_INPUT mainVS(VS_INPUT input)
     // World position
     float4 worldPos = mul(float4(input.position, 1.0f), WorldMatrix);
     float4 viewPos = mul(worldPos, ViewMatrix);
-    // Decal projection
-    output.decalPos = mul(worldPos, DecalMatrix);
+    output.worldPos = worldPos.xyz;
 
     // Screen position
     float4x4 VP = mul(ViewMatrix, ProjectionMatrix);
@@ -100,13 +118,12 @@ PS_INPUT mainVS(VS_INPUT input)
 
 #if defined(LIGHTING_MODEL_GOURAUD) || defined(LIGHTING_MODEL_LAMBERT) || defined(LIGHTING_MODEL_PHONG)
     // 조명 계산을 위한 데이터
-    output.worldPos = worldPos.xyz;
     output.normal = normalize(mul(input.normal, (float3x3) WorldInverseTranspose));
 
     #ifdef LIGHTING_MODEL_GOURAUD
         // Gouraud: Vertex shader에서 조명 계산
         // Note: 여기서는 texture를 샘플링할 수 없으므로 white를 base color로 사용
-        // Pixel shader에서 texture를 곱함
+        // Pixel shader에서 합성된 데칼 색을 곱함
         float4 baseColor = float4(1, 1, 1, 1);
         float3 viewDir = normalize(CameraPosition - output.worldPos);
         float specPower = 32.0f;
@@ -134,6 +151,36 @@ PS_INPUT mainVS(VS_INPUT input)
     return output;
 }
 
+//================================================================================================
+// 데칼 텍스처 샘플링
+//================================================================================================
+// SM5.0은 텍스처 배열을 동적 인덱스로 접근할 수 없으므로 슬롯마다 분기
+// 루프 안에서는 암시적 미분을 쓸 수 없어 SampleGrad 사용
+float4 SampleDecalTexture(uint slot, float2 uv, float2 uvDdx, float2 uvDdy)
+{
+    [forcecase]
+    switch (slot)
+    {
+    case 0: return g_DecalTextures[0].SampleGrad(g_Sample, uv, uvDdx, uvDdy);
+    case 1: return g_DecalTextures[1].SampleGrad(g_Sample, uv, uvDdx, uvDdy);
+    case 2: return g_DecalTextures[2].SampleGrad(g_Sample, uv, uvDdx, uvDdy);
+    case 3: return g_DecalTextures[3].SampleGrad(g_Sample, uv, uvDdx, uvDdy);
+    case 4: return g_DecalTextures[4].SampleGrad(g_Sample, uv, uvDdx, uvDdy);
+    case 5: return g_DecalTextures[5].SampleGrad(g_Sample, uv, uvDdx, uvDdy);
+    case 6: return g_DecalTextures[6].SampleGrad(g_Sample, uv, uvDdx, uvDdy);
+    default: return g_DecalTextures[7].SampleGrad(g_Sample, uv, uvDdx, uvDdy);
+    }
+}
+
+// 데칼 투영 공간 NDC -> 텍스처 UV
+// decal의 forward가 +x임 -> x방향 projection, yz가 텍스처 평면
+float2 DecalNDCToUV(float3 ndc)
+{
+    float2 uv = (ndc.yz + 1.0f) / 2.0f;
+    uv.y = 1.0f - uv.y;
+    return uv;
+}
+
 //================================================================================================
 // 픽셀 셰이더
 //================================================================================================
@@ -141,37 +188,72 @@ float4 mainPS(PS_INPUT input) : SV_TARGET
 {
     // 부동 소수점 오차 무시를 위해 Epsilon 사용
     static const float Epsilon = 1e-6f; // 0.000001f
-    
-    // 1. Decal projection 범위 체크
-    float3 ndc = input.decalPos.xyz / input.decalPos.w;
-
-    // decal의 forward가 +x임 -> x방향 projection
-    if (ndc.x < 0.0f - Epsilon || 1.0f + Epsilon < ndc.x ||
-        ndc.y < -1.0f - Epsilon || 1.0f + Epsilon < ndc.y ||
-        ndc.z < -1.0f - Epsilon || 1.0f + Epsilon < ndc.z)
+
+    // 데칼별 UV 미분은 월드 좌표 미분을 각 데칼 행렬로 변환해서 구함
+    float3 worldPosDdx = ddx(input.worldPos);
+    float3 worldPosDdy = ddy(input.worldPos);
+
+    // 1. 이 픽셀이 속한 타일의 데칼 목록
+    uint tileIndex = CalculateTileIndex(input.position, ViewportStartX, ViewportStartY);
+    uint tileOffset = tileIndex * MaxDecalsPerTile;
+    uint tileDecalCount = min(g_TileDecalIndices[tileOffset], MaxDecalsPerTile - 1);
+
+    // 2. 목록 순서대로 "over" 합성 (데칼마다 따로 블렌딩하던 기존 결과와 같음)
+    float3 accumColor = float3(0, 0, 0);   // 알파 곱이 적용된 색
+    float accumAlpha = 0.0f;
+
+    [loop]
+    for (uint i = 0; i < tileDecalCount; ++i)
     {
-        discard;
+        FDecalInfo decal = g_DecalList[g_TileDecalIndices[tileOffset + 1 + i]];
+
+        // Decal projection 범위 체크
+        float4 decalPos = mul(float4(input.worldPos, 1.0f), decal.DecalMatrix);
+        float3 ndc = decalPos.xyz / decalPos.w;
+        if (ndc.x < 0.0f - Epsilon || 1.0f + Epsilon < ndc.x ||
+            ndc.y < -1.0f - Epsilon || 1.0f + Epsilon < ndc.y ||
+            ndc.z < -1.0f - Epsilon || 1.0f + Epsilon < ndc.z)
+        {
+            continue;
+        }
+
+        // 원근 데칼도 지원하도록 투영 나눗셈까지 미분: d(p/w) = (dp - (p/w) * dw) / w
+        float4 decalPosDdx = mul(float4(worldPosDdx, 0.0f), decal.DecalMatrix);
+        float4 decalPosDdy = mul(float4(worldPosDdy, 0.0f), decal.DecalMatrix);
+        float3 ndcDdx = (decalPosDdx.xyz - ndc * decalPosDdx.w) / decalPos.w;
+        float3 ndcDdy = (decalPosDdy.xyz - ndc * decalPosDdy.w) / decalPos.w;
+
+        float2 uv = DecalNDCToUV(ndc) + UVScrollSpeed * UVScrollTime;
+        float2 uvDdx = float2(ndcDdx.y, -ndcDdx.z) * 0.5f;
+        float2 uvDdy = float2(ndcDdy.y, -ndcDdy.z) * 0.5f;
+
+        float4 decalTexture = SampleDecalTexture(decal.TextureSlot, uv, uvDdx, uvDdy);
+        float alpha = decalTexture.a * decal.Opacity;
+
+        accumColor = accumColor * (1.0f - alpha) + decalTexture.rgb * alpha;
+        accumAlpha = accumAlpha * (1.0f - alpha) + alpha;
     }
 
-    // 2. UV 계산 및 텍스처 샘플링
-    float2 uv = (ndc.yz + 1.0f) / 2.0f;
-    uv.y = 1.0f - uv.y;
-    uv += UVScrollSpeed * UVScrollTime;
+    if (accumAlpha <= Epsilon)
+    {
+        discard;
+    }
 
-    float4 decalTexture = g_DecalTexColor.Sample(g_Sample, uv);
+    // 블렌드 스테이트(SrcAlpha, InvSrcAlpha)에 맞게 알파 곱을 되돌림
+    float3 decalColor = accumColor / accumAlpha;
 
-    // 3. 조명 계산 (매크로에 따라)
+    // 3. 조명 계산 (매크로에 따라), 합성된 색에 대해 픽셀당 한 번만 수행
 #ifdef LIGHTING_MODEL_GOURAUD
     // Gouraud: VS에서 계산한 조명 결과 사용
     float4 finalColor = input.litColor;
-    finalColor.rgb *= decalTexture.rgb;  // Texture modulation
-    finalColor.a = decalTexture.a * DecalOpacity;
+    finalColor.rgb *= decalColor;  // Texture modulation
+    finalColor.a = accumAlpha;
     return finalColor;
 
 #elif defined(LIGHTING_MODEL_LAMBERT) || defined(LIGHTING_MODEL_PHONG)
     // Lambert/Phong: PS에서 조명 계산
     float3 normal = normalize(input.normal);
-    float4 baseColor = decalTexture;
+    float4 baseColor = float4(decalColor, 1.0f);
     float specPower = 32.0f;
     float4 viewPos = mul(float4(input.worldPos, 1.0f), ViewMatrix);
 
@@ -197,13 +279,11 @@ float4 mainPS(PS_INPUT input) : SV_TARGET
         g_VSMShadowCube
     );
 
-    float4 finalColor = float4(litColor, decalTexture.a * DecalOpacity);
+    float4 finalColor = float4(litColor, accumAlpha);
     return finalColor;
 
 #else
-    // No lighting model - 기존 방식 (단순 텍스처)
-    float4 finalColor = decalTexture;
-    finalColor.a *= DecalOpacity;
-    return finalColor;
+    // No lighting model - 합성된 데칼 텍스처 그대로
+    return float4(decalColor, accumAlpha);
 #endif
 }
@@ -90,6 +90,13 @@ struct FParticleInstanceData
 };
 
 StructuredBuffer<FParticleInstanceData> g_ParticleInstances : register(t12);
+
+// b9: 공유 인스턴스 버퍼에서 이번 드로우가 사용하는 구간의 시작 위치 - FParticleInstanceBufferType과 일치
+cbuffer ParticleInstanceBuffer : register(b9)
+{
+    uint FirstInstance;
+    uint3 ParticleInstancePadding;
+};
 #endif
 
 // --- Material.SpecularColor 지원 매크로 ---
@@ -213,7 +220,7 @@ PS_INPUT mainVS(VS_INPUT Input, uint InstanceID : SV_InstanceID)
     // ========================================================================
     // 파티클 스프라이트 처리 (GPU 인스턴싱)
     // ========================================================================
-    FParticleInstanceData particle = g_ParticleInstances[InstanceID];
+    FParticleInstanceData particle = g_ParticleInstances[FirstInstance + InstanceID];
 
     // 로컬 위치에 파티클 크기 적용 및 회전
     float3 scaledPos = Input.Position * float3(particle.Size.x, particle.Size.y, 1.0f);
@@ -251,7 +258,7 @@ PS_INPUT mainVS(VS_INPUT Input, uint InstanceID : SV_InstanceID)
     // ========================================================================
     // 파티클 메시 처리 (GPU 인스턴싱)
     // ========================================================================
-    FParticleInstanceData particle = g_ParticleInstances[InstanceID];
+    FParticleInstanceData particle = g_ParticleInstances[FirstInstance + InstanceID];
 
     // 로컬 스케일 및 회전 적용
     float3 scaledPos = Input.Position * float3(particle.Size.x, particle.Size.y, particle.Size.x);
@@ -564,21 +571,17 @@ PS_OUTPUT mainPS(PS_INPUT Input)
     // Directional light (diffuse만)
     litColor += CalculateDirectionalLight(DirectionalLight, Input.WorldPos, ViewPos.xyz, normal, float3(0, 0, 0), baseColor, false, 0.0f, g_ShadowAtlas2D, g_ShadowSample);
 
-    // 타일 기반 라이트 컬링 적용 (활성화된 경우)
+    // 클러스터 기반 라이트 컬링 적용 (활성화된 경우)
     if (bUseTileCulling)
     {
-        // 현재 픽셀이 속한 타일 계산
-        uint tileIndex = CalculateTileIndex(Input.Position, ViewportStartX, ViewportStartY);
-        uint tileDataOffset = GetTileDataOffset(tileIndex);
+        // 현재 픽셀이 속한 클러스터(타일 + 깊이 슬라이스)의 라이트 목록 범위
+        uint2 lightRange = GetClusterLightRange(Input.Position, Input.WorldPos);
 
-        // 타일에 영향을 주는 라이트 개수
-        uint lightCount = g_TileLightIndices[tileDataOffset];
-
-        // 타일 내 라이트만 순회
+        // 클러스터 내 라이트만 순회
         [loop]
-        for (uint i = 0; i < lightCount; i++)
+        for (uint i = 0; i < lightRange.y; i++)
         {
-            uint packedIndex = g_TileLightIndices[tileDataOffset + 1 + i];
+            uint packedIndex = g_TileLightIndices[lightRange.x + i];
             uint lightType = (packedIndex >> 16) & 0xFFFF;  // 상위 16비트: 타입
             uint lightIdx = packedIndex & 0xFFFF;           // 하위 16비트: 인덱스
 
@@ -685,21 +688,17 @@ PS_OUTPUT mainPS(PS_INPUT Input)
     
     litColor += DirectionalLightColor;
 
-    // 타일 기반 라이트 컬링 적용 (활성화된 경우)
+    // 클러스터 기반 라이트 컬링 적용 (활성화된 경우)
     if (bUseTileCulling)
     {
-        // 현재 픽셀이 속한 타일 계산
-        uint tileIndex = CalculateTileIndex(Input.Position, ViewportStartX, ViewportStartY);
-        uint tileDataOffset = GetTileDataOffset(tileIndex);
-
-        // 타일에 영향을 주는 라이트 개수
-        uint lightCount = g_TileLightIndices[tileDataOffset];
+        // 현재 픽셀이 속한 클러스터(타일 + 깊이 슬라이스)의 라이트 목록 범위
+        uint2 lightRange = GetClusterLightRange(Input.Position, Input.WorldPos);
 
-        // 타일 내 라이트만 순회
+        // 클러스터 내 라이트만 순회
         [loop]
-        for (uint i = 0; i < lightCount; i++)
+        for (uint i = 0; i < lightRange.y; i++)
         {
-            uint packedIndex = g_TileLightIndices[tileDataOffset + 1 + i];
+            uint packedIndex = g_TileLightIndices[lightRange.x + i];
             uint lightType = (packedIndex >> 16) & 0xFFFF;  // 상위 16비트: 타입
             uint lightIdx = packedIndex & 0xFFFF;           // 하위 16비트: 인덱스
 
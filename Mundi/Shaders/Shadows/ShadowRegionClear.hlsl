@@ -0,0 +1,30 @@
+// 섀도우 아틀라스의 일부 영역만 클리어하는 셰이더
+// ClearDepthStencilView는 부분 클리어가 불가능하므로, 뷰포트를 해당 영역으로 맞춘 뒤
+// 깊이 1.0의 사각형을 AlwaysWrite 깊이 상태로 그려 덮어쓴다.
+// C++ 코드에서 DeviceContext->Draw(6, 0); 으로 호출해야 합니다.
+
+struct VS_OUTPUT
+{
+    float4 Position : SV_POSITION;
+};
+
+VS_OUTPUT mainVS(uint VertexID : SV_VertexID)
+{
+    VS_OUTPUT Out;
+
+    const float2 Positions[6] =
+    {
+        float2(-1, 1), float2(1, 1), float2(-1, -1), // 첫 번째 삼각형
+        float2(-1, -1), float2(1, 1), float2(1, -1) // 두 번째 삼각형
+    };
+
+    // z = w = 1 → 깊이 1.0 (가장 먼 값)
+    Out.Position = float4(Positions[VertexID], 1.0f, 1.0f);
+    return Out;
+}
+
+// VSM 모멘트 클리어 값 (ClearRenderTargetView의 {1, 1, 0, 0}과 동일)
+float2 mainPS(VS_OUTPUT Input) : SV_TARGET
+{
+    return float2(1.0f, 1.0f);
+}
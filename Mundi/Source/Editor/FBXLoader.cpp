@@ -1317,6 +1317,19 @@ FSkeletalMeshData* UFbxLoader::ExtractMeshFromScene(FbxScene* InScene, TMap<FbxN
 
 FSkeletalMeshData* UFbxLoader::TryLoadMeshFromCache(const FString& FbxPath)
 {
+	TArray<FMaterialInfo> CachedMaterialInfos;
+	FSkeletalMeshData* MeshData = ReadMeshCache(FbxPath, CachedMaterialInfos);
+	if (MeshData)
+	{
+		RegisterCachedMaterials(CachedMaterialInfos);
+	}
+	return MeshData;
+}
+
+FSkeletalMeshData* UFbxLoader::ReadMeshCache(const FString& FbxPath, TArray<FMaterialInfo>& OutMaterialInfos)
+{
+	OutMaterialInfos.clear();
+
 #ifdef USE_OBJ_CACHE
 	FString NormalizedPath = NormalizePath(FbxPath);
 	FString CachePathStr = ConvertDataPathToResourcePath(NormalizedPath);
@@ -1381,13 +1394,7 @@ FSkeletalMeshData* UFbxLoader::TryLoadMeshFromCache(const FString& FbxPath)
 				}
 				FMaterialInfo MaterialInfo{};
 				Serialization::ReadAsset<FMaterialInfo>(MatReader, &MaterialInfo);
-
-				UMaterial* NewMaterial = NewObject<UMaterial>();
-				UMaterial* Default = UResourceManager::GetInstance().GetDefaultMaterial();
-				NewMaterial->SetMaterialInfo(MaterialInfo);
-				NewMaterial->SetShader(Default->GetShader());
-				NewMaterial->SetShaderMacros(Default->GetShaderMacros());
-				UResourceManager::GetInstance().Add<UMaterial>(MaterialInfo.MaterialName, NewMaterial);
+				OutMaterialInfos.Add(MaterialInfo);
 			}
 
 			MeshData->CacheFilePath = BinPathFileName;
@@ -1397,6 +1404,7 @@ FSkeletalMeshData* UFbxLoader::TryLoadMeshFromCache(const FString& FbxPath)
 		}
 		catch (const std::exception& e)
 		{
+			OutMaterialInfos.clear();
 			UE_LOG("Error loading FBX from cache: %s. Cache might be corrupt or incompatible.", e.what());
 			UE_LOG("Deleting corrupt cache and forcing regeneration for '%s'.", NormalizedPath.c_str());
 			std::filesystem::remove(BinPathFileName);
@@ -1407,6 +1415,19 @@ FSkeletalMeshData* UFbxLoader::TryLoadMeshFromCache(const FString& FbxPath)
 	return nullptr;
 }
 
+void UFbxLoader::RegisterCachedMaterials(const TArray<FMaterialInfo>& InMaterialInfos)
+{
+	for (const FMaterialInfo& MaterialInfo : InMaterialInfos)
+	{
+		UMaterial* NewMaterial = NewObject<UMaterial>();
+		UMaterial* Default = UResourceManager::GetInstance().GetDefaultMaterial();
+		NewMaterial->SetMaterialInfo(MaterialInfo);
+		NewMaterial->SetShader(Default->GetShader());
+		NewMaterial->SetShaderMacros(Default->GetShaderMacros());
+		UResourceManager::GetInstance().Add<UMaterial>(MaterialInfo.MaterialName, NewMaterial);
+	}
+}
+
 void UFbxLoader::SaveMeshToCache(FSkeletalMeshData* MeshData, const FString& FbxPath)
 {
 #ifdef USE_OBJ_CACHE
@@ -29,7 +29,14 @@ public:
 	FFbxAssetData* LoadFbxAssets(const FString& FilePath);
 
 	// FSkeletalMeshData를 FStaticMesh로 변환 (스켈레톤 정보 제거)
-	FStaticMesh* ConvertSkeletalToStaticMesh(const FSkeletalMeshData* SkeletalData);
+	static FStaticMesh* ConvertSkeletalToStaticMesh(const FSkeletalMeshData* SkeletalData);
+
+	// .uskel 캐시만 읽는다. 파일 입출력만 하므로 워커 스레드에서 호출 가능 (캐시가 없거나 오래되면 nullptr)
+	// 머티리얼은 UObject를 만들지 않고 OutMaterialInfos로 돌려준다
+	static FSkeletalMeshData* ReadMeshCache(const FString& FbxPath, TArray<FMaterialInfo>& OutMaterialInfos);
+
+	// ReadMeshCache가 읽은 머티리얼을 UMaterial로 만들어 리소스 매니저에 등록 (게임 스레드)
+	static void RegisterCachedMaterials(const TArray<FMaterialInfo>& InMaterialInfos);
 
 protected:
 	~UFbxLoader() override;
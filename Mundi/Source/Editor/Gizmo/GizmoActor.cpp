@@ -475,7 +475,7 @@ void AGizmoActor::ProcessGizmoDragging(ACameraActor* Camera, FViewport* Viewport
 					// 고유한 이름 생성
 					FString ActorTypeName = SelectedActor->GetClass()->Name;
 					FString UniqueName = World->GenerateUniqueActorName(ActorTypeName);
-					DuplicatedActor->ObjectName = FName(UniqueName);
+					DuplicatedActor->SetName(FName(UniqueName));
 
 					// World에 등록
 					World->AddActorToLevel(DuplicatedActor);
@@ -1,6 +1,7 @@
 ﻿#include "pch.h"
 #include "ObjManager.h"
 #include "PathUtils.h"
+#include "ObjParser.h"
 
 #include "ObjectIterator.h"
 #include "StaticMesh.h"
@@ -13,6 +14,7 @@
 namespace fs = std::filesystem;
 
 TMap<FString, FStaticMesh*> FObjManager::ObjStaticMeshMap;
+std::mutex FObjManager::ObjStaticMeshMutex;
 
 // 파일 유틸 함수
 namespace
@@ -460,6 +462,7 @@ void FObjManager::Preload()
 
 void FObjManager::Clear()
 {
+	std::lock_guard<std::mutex> Lock(ObjStaticMeshMutex);
 	for (auto& Pair : ObjStaticMeshMap)
 	{
 		delete Pair.second;
@@ -475,9 +478,12 @@ FStaticMesh* FObjManager::LoadObjStaticMeshAsset(const FString& PathFileName)
 	FString PathWithoutExt = RemoveExtension(NormalizedPathStr);
 
 	// 1. 메모리 캐시 확인 (확장자 제거한 키로 검색)
-	if (FStaticMesh** It = ObjStaticMeshMap.Find(PathWithoutExt))
 	{
-		return *It;
+		std::lock_guard<std::mutex> Lock(ObjStaticMeshMutex);
+		if (FStaticMesh** It = ObjStaticMeshMap.Find(PathWithoutExt))
+		{
+			return *It;
+		}
 	}
 
 	// 2. 확장자 확인 (.obj 또는 .umesh 허용)
@@ -509,6 +515,13 @@ FStaticMesh* FObjManager::LoadObjStaticMeshAsset(const FString& PathFileName)
 	}
 
 	// 5. 메모리 캐시에 등록 후 반환 (확장자 제거한 키로 저장)
+	//    읽는 동안 다른 스레드가 같은 메시를 먼저 등록했다면 그쪽을 사용
+	std::lock_guard<std::mutex> Lock(ObjStaticMeshMutex);
+	if (FStaticMesh** It = ObjStaticMeshMap.Find(PathWithoutExt))
+	{
+		delete NewMesh;
+		return *It;
+	}
 	ObjStaticMeshMap.Add(PathWithoutExt, NewMesh);
 	return NewMesh;
 }
@@ -524,6 +537,7 @@ void FObjManager::RegisterStaticMeshAsset(const FString& PathFileName, FStaticMe
 	FString PathWithoutExt = RemoveExtension(NormalizedPathStr);
 
 	// 이미 등록된 경우 기존 것을 삭제하고 새로 등록 (확장자 제거한 키로 확인)
+	std::lock_guard<std::mutex> Lock(ObjStaticMeshMutex);
 	if (FStaticMesh** Existing = ObjStaticMeshMap.Find(PathWithoutExt))
 	{
 		delete *Existing;
@@ -658,162 +672,24 @@ UStaticMesh* FObjManager::LoadObjStaticMesh(const FString& PathFileName)
 // obj File to FObjInfo, FMaterialParameters
 bool FObjImporter::LoadObjModel(const FString& InFileName, FObjInfo* const OutObjInfo, TArray<FMaterialInfo>& OutMaterialInfos, bool bIsRightHanded)
 {
-	uint32 subsetCount = 0;
-	FString MtlFileName;
-
-	bool bHasTexcoord = false;
-	bool bHasNormal = false;
-	FString MaterialNameTemp;
-
-	FString Face;
-	uint32 VIndex = 0;
-	uint32 MeshTriangles = 0;
-
 	size_t pos = InFileName.find_last_of("/\\");
 	FString objDir = (pos == FString::npos) ? "" : InFileName.substr(0, pos + 1);
 
 	// [안정성] .obj 파일이 존재하지 않으면 로드 실패를 반환합니다.
 	// 이는 필수 데이터이므로 더 이상 진행할 수 없습니다.
-	// 한글 경로 지원: UTF-8 → UTF-16 변환 후 파일 열기
-	FWideString WPath = UTF8ToWide(InFileName);
-	std::ifstream FileIn(WPath);
-	if (!FileIn)
+	// 지오메트리(v/vt/vn/f/usemtl/mtllib)는 FObjParser가 파일 전체를 한 번에 읽어 파싱 (큰 파일은 청크 병렬)
+	FString MtlLib;
+	if (!FObjParser::ParseFile(InFileName, bIsRightHanded, *OutObjInfo, MtlLib))
 	{
 		UE_LOG("Error: The file '%s' does not exist!", InFileName.c_str());
 		return false;
 	}
 
-	OutObjInfo->ObjFileName = FString(InFileName.begin(), InFileName.end());
-
-	FString line;
-	while (std::getline(FileIn, line))
-	{
-		if (line.empty()) continue;
-
-		line.erase(0, line.find_first_not_of(" \t\n\r"));
-
-		if (line[0] == '#')
-			continue;
-
-		if (line.rfind("v ", 0) == 0) // 정점 좌표 (v x y z)
-		{
-			std::stringstream wss(line.substr(2));
-			float vx, vy, vz;
-			wss >> vx >> vy >> vz;
-			if (bIsRightHanded)
-			{
-				OutObjInfo->Positions.push_back(FVector(vx, -vy, vz));
-			}
-			else
-			{
-				OutObjInfo->Positions.push_back(FVector(vx, vy, vz));
-			}
-		}
-		else if (line.rfind("vt ", 0) == 0) // 텍스처 좌표 (vt u v)
-		{
-			std::stringstream wss(line.substr(3));
-			float u, v;
-			wss >> u >> v;
-			// obj의 vt는 좌하단이 (0,0) -> DirectX UV는 좌상단이 (0,0) (상하 반전으로 컨버팅)
-			v = 1.0f - v;
-			OutObjInfo->TexCoords.push_back(FVector2D(u, v));
-			bHasTexcoord = true;
-		}
-		else if (line.rfind("vn ", 0) == 0) // 법선 (vn x y z)
-		{
-			std::stringstream wss(line.substr(3));
-			float nx, ny, nz;
-			wss >> nx >> ny >> nz;
-			if (bIsRightHanded)
-			{
-				OutObjInfo->Normals.push_back(FVector(nx, -ny, nz));
-			}
-			else
-			{
-				OutObjInfo->Normals.push_back(FVector(nx, ny, nz));
-			}
-			bHasNormal = true;
-		}
-		else if (line.rfind("g ", 0) == 0) // 그룹 (g groupName)
-		{
-			// 현재 'usemtl'을 기준으로 그룹을 나누므로 'g' 태그는 무시합니다.
-		}
-		else if (line.rfind("f ", 0) == 0) // 면 (f v1/vt1/vn1 v2/vt2/vn2 ...)
-		{
-			Face = line.substr(2);
-			if (Face.length() <= 0)
-			{
-				continue;
-			}
-
-			// Parse face line and trim at '#' or newline
-			std::stringstream wss(Face);
-			FString VertexDef;
-
-			TArray<FFaceVertex> LineFaceVertices;
-			while (wss >> VertexDef)
-			{
-				// '#'을 만나면 주석 처리 (이후 데이터 무시)
-				if (VertexDef[0] == '#')
-				{
-					break;
-				}
-
-				FFaceVertex FaceVertex = ParseVertexDef(VertexDef);
-				LineFaceVertices.push_back(FaceVertex);
-			}
-
-			// 4각형 이상의 폴리곤도 처리하기 위해서 for문으로 처리
-			for (uint32 i = 1; i < LineFaceVertices.size() - 1; ++i)
-			{
-				if (bIsRightHanded)
-				{
-					OutObjInfo->PositionIndices.push_back(LineFaceVertices[0].PositionIndex);
-					OutObjInfo->TexCoordIndices.push_back(LineFaceVertices[0].TexCoordIndex);
-					OutObjInfo->NormalIndices.push_back(LineFaceVertices[0].NormalIndex);
-
-					OutObjInfo->PositionIndices.push_back(LineFaceVertices[i + 1].PositionIndex);
-					OutObjInfo->TexCoordIndices.push_back(LineFaceVertices[i + 1].TexCoordIndex);
-					OutObjInfo->NormalIndices.push_back(LineFaceVertices[i + 1].NormalIndex);
-
-					OutObjInfo->PositionIndices.push_back(LineFaceVertices[i].PositionIndex);
-					OutObjInfo->TexCoordIndices.push_back(LineFaceVertices[i].TexCoordIndex);
-					OutObjInfo->NormalIndices.push_back(LineFaceVertices[i].NormalIndex);
-				}
-				else
-				{
-					OutObjInfo->PositionIndices.push_back(LineFaceVertices[0].PositionIndex);
-					OutObjInfo->TexCoordIndices.push_back(LineFaceVertices[0].TexCoordIndex);
-					OutObjInfo->NormalIndices.push_back(LineFaceVertices[0].NormalIndex);
-
-					OutObjInfo->PositionIndices.push_back(LineFaceVertices[i].PositionIndex);
-					OutObjInfo->TexCoordIndices.push_back(LineFaceVertices[i].TexCoordIndex);
-					OutObjInfo->NormalIndices.push_back(LineFaceVertices[i].NormalIndex);
-
-					OutObjInfo->PositionIndices.push_back(LineFaceVertices[i + 1].PositionIndex);
-					OutObjInfo->TexCoordIndices.push_back(LineFaceVertices[i + 1].TexCoordIndex);
-					OutObjInfo->NormalIndices.push_back(LineFaceVertices[i + 1].NormalIndex);
-				}
-				VIndex += 3;
-				++MeshTriangles;
-			}
-		}
-		else if (line.rfind("mtllib ", 0) == 0)
-		{
-			MtlFileName = objDir + line.substr(7);
-		}
-		else if (line.rfind("usemtl ", 0) == 0)
-		{
-			MaterialNameTemp = line.substr(7);
-			OutObjInfo->MaterialNames.push_back(MaterialNameTemp);
-			OutObjInfo->GroupIndexStartArray.push_back(VIndex);
-			subsetCount++;
-		}
-		else
-		{
-			UE_LOG("While parsing the filename %s, the following unknown symbol was encountered: \'%s\'", InFileName.c_str(), line.c_str());
-		}
-	}
+	FString MtlFileName = MtlLib.empty() ? FString() : objDir + MtlLib;
+	const bool bHasTexcoord = !OutObjInfo->TexCoords.empty();
+	const bool bHasNormal = !OutObjInfo->Normals.empty();
+	const uint32 VIndex = static_cast<uint32>(OutObjInfo->PositionIndices.size());
+	uint32 subsetCount = static_cast<uint32>(OutObjInfo->MaterialNames.size());
 
 	if (subsetCount == 0)
 	{
@@ -837,8 +713,6 @@ bool FObjImporter::LoadObjModel(const FString& InFileName, FObjInfo* const OutOb
 		OutObjInfo->TexCoords.push_back(FVector2D(0.0f, 0.0f));
 	}
 
-	FileIn.close();
-
 	// Material 파싱 시작
 	UE_LOG("[ObjImporter::LoadObjModel] MTL file path: %s", MtlFileName.c_str());
 
@@ -851,7 +725,7 @@ bool FObjImporter::LoadObjModel(const FString& InFileName, FObjInfo* const OutOb
 
 	// 한글 경로 지원: UTF-8 → UTF-16 변환 후 파일 열기
 	FWideString WMtlPath = UTF8ToWide(MtlFileName);
-	FileIn.open(WMtlPath);
+	std::ifstream FileIn(WMtlPath);
 
 	// .mtl 파일이 존재하지 않더라도 로딩을 중단하지 않습니다.
 	// 경고를 로깅하고, 머티리얼이 없는 모델로 처리를 계속합니다.
@@ -869,6 +743,7 @@ bool FObjImporter::LoadObjModel(const FString& InFileName, FObjInfo* const OutOb
 	TArray<FString> TempOptions;
 	FString TempTexturePath;
 
+	FString line;
 	while (std::getline(FileIn, line))
 	{
 		if (line.empty()) continue;
@@ -1004,15 +879,35 @@ void FObjImporter::ConvertToStaticMesh(const FObjInfo& InObjInfo, const TArray<F
 		BiTangentForVertex[Index + 2] += BiTangent;
 	}
 
-	std::unordered_map<VertexKey, uint32, VertexKeyHash> VertexMap;
+	// 정점 중복 제거: 개방 주소법 해시 테이블 (선형 탐사, 2의 거듭제곱 용량, 적재율 50% 이하)
+	// TableValues가 UINT32_MAX인 슬롯은 비어 있음 (std::unordered_map과 달리 노드 할당 없음)
+	uint32 TableCapacity = 16;
+	while (TableCapacity < NumDuplicatedVertex * 2)
+	{
+		TableCapacity <<= 1;
+	}
+	const uint32 TableMask = TableCapacity - 1;
+	TArray<VertexKey> TableKeys;
+	TArray<uint32> TableValues;
+	TableKeys.SetNum(static_cast<int32>(TableCapacity));
+	TableValues.SetNum(static_cast<int32>(TableCapacity), UINT32_MAX);
+
+	OutStaticMesh->Indices.reserve(OutStaticMesh->Indices.size() + NumDuplicatedVertex);
+	const VertexKeyHash Hasher;
 
 	for (uint32 CurIndex = 0; CurIndex < NumDuplicatedVertex; ++CurIndex)
 	{
 		VertexKey Key{ InObjInfo.PositionIndices[CurIndex], InObjInfo.TexCoordIndices[CurIndex], InObjInfo.NormalIndices[CurIndex] };
-		auto It = VertexMap.find(Key);
-		if (It != VertexMap.end())
+
+		uint32 Slot = static_cast<uint32>(Hasher(Key)) & TableMask;
+		while (TableValues[Slot] != UINT32_MAX && !(TableKeys[Slot] == Key))
+		{
+			Slot = (Slot + 1) & TableMask;
+		}
+
+		if (TableValues[Slot] != UINT32_MAX)
 		{
-			OutStaticMesh->Indices.push_back(It->second);
+			OutStaticMesh->Indices.push_back(TableValues[Slot]);
 		}
 		else
 		{
@@ -1035,7 +930,8 @@ void FObjImporter::ConvertToStaticMesh(const FObjInfo& InObjInfo, const TArray<F
 			OutStaticMesh->Vertices.push_back(NormalVertex);
 			uint32 NewIndex = static_cast<uint32>(OutStaticMesh->Vertices.size() - 1);
 			OutStaticMesh->Indices.push_back(NewIndex);
-			VertexMap[Key] = NewIndex;
+			TableKeys[Slot] = Key;
+			TableValues[Slot] = NewIndex;
 		}
 	}
 
@@ -1072,17 +968,3 @@ void FObjImporter::ConvertToStaticMesh(const FObjInfo& InObjInfo, const TArray<F
 		// else: InitialMaterialName은 비어있게 됨 (정상)
 	}
 }
-
-FObjImporter::FFaceVertex FObjImporter::ParseVertexDef(const FString& InVertexDef)
-{
-	FFaceVertex Result{ 0, 0, 0 };
-	std::stringstream ss(InVertexDef);
-	FString part;
-	uint32 temp_val;
-
-	if (std::getline(ss, part, '/')) { if (!part.empty()) { std::stringstream conv(part); if (conv >> temp_val) Result.PositionIndex = temp_val - 1; } }
-	if (std::getline(ss, part, '/')) { if (!part.empty()) { std::stringstream conv(part); if (conv >> temp_val) Result.TexCoordIndex = temp_val - 1; } }
-	if (std::getline(ss, part, '/')) { if (!part.empty()) { std::stringstream conv(part); if (conv >> temp_val) Result.NormalIndex = temp_val - 1; } }
-
-	return Result;
-}
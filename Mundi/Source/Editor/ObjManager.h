@@ -5,6 +5,7 @@
 #include <sstream>
 #include <algorithm>
 #include <unordered_map>
+#include <mutex>
 
 #include "UEContainer.h"
 #include "Vector.h"
@@ -40,19 +41,21 @@ public:
 		bool operator==(const VertexKey& Other) const { return PosIndex == Other.PosIndex && TexIndex == Other.TexIndex && NormalIndex == Other.NormalIndex; }
 	};
 
+	// 세 인덱스를 곱셈 혼합 (XOR/시프트만 쓰면 인접 인덱스끼리 충돌이 잦음)
 	struct VertexKeyHash
 	{
-		size_t operator()(const VertexKey& Key) const { return std::hash<uint32>()(Key.PosIndex) ^ (std::hash<uint32>()(Key.TexIndex) << 1) ^ (std::hash<uint32>()(Key.NormalIndex) << 2); }
+		size_t operator()(const VertexKey& Key) const
+		{
+			uint64 Hash = Key.PosIndex * 0x9E3779B97F4A7C15ull;
+			Hash = (Hash ^ (Hash >> 29) ^ Key.TexIndex) * 0xBF58476D1CE4E5B9ull;
+			Hash = (Hash ^ (Hash >> 32) ^ Key.NormalIndex) * 0x94D049BB133111EBull;
+			return static_cast<size_t>(Hash ^ (Hash >> 31));
+		}
 	};
 
 	static bool LoadObjModel(const FString& InFileName, FObjInfo* const OutObjInfo, TArray<FMaterialInfo>& OutMaterialInfos, bool bIsRightHanded = true);
 
 	static void ConvertToStaticMesh(const FObjInfo& InObjInfo, const TArray<FMaterialInfo>& InMaterialInfos, FStaticMesh* const OutStaticMesh);
-
-private:
-	struct FFaceVertex { uint32 PositionIndex, TexCoordIndex, NormalIndex; };
-
-	static FFaceVertex ParseVertexDef(const FString& InVertexDef);
 };
 
 class UStaticMesh;
@@ -61,6 +64,8 @@ class FObjManager
 {
 private:
 	static TMap<FString, FStaticMesh*> ObjStaticMeshMap;
+	// 비동기 로드 워커가 LoadObjStaticMeshAsset을 호출하므로 캐시 맵 접근을 보호 (파일 읽기는 락 밖에서)
+	static std::mutex ObjStaticMeshMutex;
 
 	// .obj 파일을 파싱해서 .umesh/.umat 캐시 파일로 Cook (저장만, 성공 시 true 반환)
 	static bool CookObjToCache(const FString& ObjPath);
@@ -72,7 +77,7 @@ private:
 public:
 	static void Preload();
 	static void Clear();
-	static FStaticMesh* LoadObjStaticMeshAsset(const FString& PathFileName);
+	static FStaticMesh* LoadObjStaticMeshAsset(const FString& PathFileName);	// 워커 스레드에서 호출 가능
 	static UStaticMesh* LoadObjStaticMesh(const FString& PathFileName);
 
 	// FBX 등 외부에서 생성된 FStaticMesh를 캐시에 등록
@@ -0,0 +1,391 @@
+﻿#include "pch.h"
+#include "ObjParser.h"
+#include "ObjManager.h"
+#include "PathUtils.h"
+#include <charconv>
+#include <future>
+#include <string_view>
+#include <thread>
+
+namespace
+{
+	// 청크 하나의 파싱 결과 (인덱스는 파일 전체 기준, 상대 인덱스만 청크 기준)
+	struct FObjChunk
+	{
+		TArray<FVector> Positions;
+		TArray<FVector2D> TexCoords;
+		TArray<FVector> Normals;
+
+		TArray<uint32> PositionIndices;
+		TArray<uint32> TexCoordIndices;
+		TArray<uint32> NormalIndices;
+
+		// 음수(상대) 인덱스가 들어 있는 슬롯. 값은 이 청크의 정점 수 기준이라 병합 시 앞 청크의 정점 수를 더함
+		TArray<uint32> RelativePositionSlots;
+		TArray<uint32> RelativeTexCoordSlots;
+		TArray<uint32> RelativeNormalSlots;
+
+		TArray<FString> MaterialNames;
+		TArray<uint32> MaterialIndexStarts;		// usemtl 시점의 청크 내 인덱스 수
+
+		FString MtlLib;
+		bool bHasMtlLib = false;
+
+		TMap<FString, uint32> UnknownSymbols;	// 처리하지 않은 키워드 -> 줄 수
+	};
+
+	// 면 정점 하나 (v/vt/vn)
+	struct FFaceVertex
+	{
+		uint32 Index[3] = { 0, 0, 0 };
+		bool bRelative[3] = { false, false, false };
+	};
+
+	inline bool IsBlank(char C)
+	{
+		return C == ' ' || C == '\t';
+	}
+
+	inline const char* SkipBlanks(const char* Cur, const char* End)
+	{
+		while (Cur < End && IsBlank(*Cur))
+		{
+			++Cur;
+		}
+		return Cur;
+	}
+
+	// 공백을 건너뛰고 float 하나 변환 (실패하면 0, stringstream >> float와 같은 결과)
+	const char* ParseFloat(const char* Cur, const char* End, float& OutValue)
+	{
+		Cur = SkipBlanks(Cur, End);
+		if (Cur < End && *Cur == '+')
+		{
+			++Cur;
+		}
+
+		OutValue = 0.0f;
+		const std::from_chars_result Result = std::from_chars(Cur, End, OutValue);
+		if (Result.ec != std::errc())
+		{
+			OutValue = 0.0f;
+			return Cur;
+		}
+		return Result.ptr;
+	}
+
+	// 면 인덱스 성분 하나. 1-based 절대 인덱스는 0-based로, 음수는 청크 기준 상대 인덱스로
+	// (0은 기존 파서처럼 0 - 1 = UINT32_MAX)
+	void ParseFaceIndex(const char* Begin, const char* End, uint32 LocalCount, uint32& OutIndex, bool& bOutRelative)
+	{
+		int64 Raw = 0;
+		if (Begin < End && *Begin == '+')
+		{
+			++Begin;
+		}
+		if (Begin == End || std::from_chars(Begin, End, Raw).ec != std::errc())
+		{
+			return;
+		}
+
+		if (Raw < 0)
+		{
+			OutIndex = static_cast<uint32>(static_cast<int64>(LocalCount) + Raw);
+			bOutRelative = true;
+		}
+		else
+		{
+			OutIndex = static_cast<uint32>(Raw - 1);
+		}
+	}
+
+	// "v", "v/vt", "v//vn", "v/vt/vn"
+	FFaceVertex ParseFaceVertex(const char* Begin, const char* End, const FObjChunk& Chunk)
+	{
+		const uint32 LocalCounts[3] = {
+			static_cast<uint32>(Chunk.Positions.Num()),
+			static_cast<uint32>(Chunk.TexCoords.Num()),
+			static_cast<uint32>(Chunk.Normals.Num())
+		};
+
+		FFaceVertex Vertex;
+		const char* Cur = Begin;
+		for (int32 Component = 0; Component < 3 && Cur <= End; ++Component)
+		{
+			const char* Slash = std::find(Cur, End, '/');
+			ParseFaceIndex(Cur, Slash, LocalCounts[Component], Vertex.Index[Component], Vertex.bRelative[Component]);
+			if (Slash == End)
+			{
+				break;
+			}
+			Cur = Slash + 1;
+		}
+		return Vertex;
+	}
+
+	void AddFaceVertex(FObjChunk& Chunk, const FFaceVertex& Vertex)
+	{
+		if (Vertex.bRelative[0]) Chunk.RelativePositionSlots.Add(static_cast<uint32>(Chunk.PositionIndices.Num()));
+		if (Vertex.bRelative[1]) Chunk.RelativeTexCoordSlots.Add(static_cast<uint32>(Chunk.TexCoordIndices.Num()));
+		if (Vertex.bRelative[2]) Chunk.RelativeNormalSlots.Add(static_cast<uint32>(Chunk.NormalIndices.Num()));
+
+		Chunk.PositionIndices.Add(Vertex.Index[0]);
+		Chunk.TexCoordIndices.Add(Vertex.Index[1]);
+		Chunk.NormalIndices.Add(Vertex.Index[2]);
+	}
+
+	void ParseFace(const char* Cur, const char* End, bool bIsRightHanded, FObjChunk& Chunk, TArray<FFaceVertex>& FaceVertices)
+	{
+		FaceVertices.clear();
+		while (true)
+		{
+			Cur = SkipBlanks(Cur, End);
+			// '#'을 만나면 주석 처리 (이후 데이터 무시)
+			if (Cur == End || *Cur == '#')
+			{
+				break;
+			}
+
+			const char* TokenEnd = Cur;
+			while (TokenEnd < End && !IsBlank(*TokenEnd))
+			{
+				++TokenEnd;
+			}
+			FaceVertices.Add(ParseFaceVertex(Cur, TokenEnd, Chunk));
+			Cur = TokenEnd;
+		}
+
+		// 팬 분할 (오른손 좌표계면 감김 순서 반전)
+		for (int32 i = 1; i + 1 < FaceVertices.Num(); ++i)
+		{
+			AddFaceVertex(Chunk, FaceVertices[0]);
+			AddFaceVertex(Chunk, FaceVertices[bIsRightHanded ? i + 1 : i]);
+			AddFaceVertex(Chunk, FaceVertices[bIsRightHanded ? i : i + 1]);
+		}
+	}
+
+	void ParseLine(const char* Cur, const char* LineEnd, bool bIsRightHanded, FObjChunk& Chunk, TArray<FFaceVertex>& FaceVertices)
+	{
+		// 앞쪽 공백과 줄 끝 \r 제거 (CRLF 파일)
+		while (Cur < LineEnd && (IsBlank(*Cur) || *Cur == '\r'))
+		{
+			++Cur;
+		}
+		if (LineEnd > Cur && LineEnd[-1] == '\r')
+		{
+			--LineEnd;
+		}
+		if (Cur == LineEnd || *Cur == '#')
+		{
+			return;
+		}
+
+		const char* KeywordEnd = Cur;
+		while (KeywordEnd < LineEnd && !IsBlank(*KeywordEnd))
+		{
+			++KeywordEnd;
+		}
+		const std::string_view Keyword(Cur, KeywordEnd - Cur);
+
+		// 키워드 뒤 구분자가 없으면 ("v"만 있는 줄 등) 알 수 없는 줄로 처리
+		if (KeywordEnd == LineEnd)
+		{
+			++Chunk.UnknownSymbols[FString(Keyword)];
+			return;
+		}
+		const char* Rest = KeywordEnd + 1;
+
+		if (Keyword == "v") // 정점 좌표 (v x y z)
+		{
+			float X, Y, Z;
+			Rest = ParseFloat(Rest, LineEnd, X);
+			Rest = ParseFloat(Rest, LineEnd, Y);
+			ParseFloat(Rest, LineEnd, Z);
+			Chunk.Positions.Add(FVector(X, bIsRightHanded ? -Y : Y, Z));
+		}
+		else if (Keyword == "vt") // 텍스처 좌표 (vt u v)
+		{
+			float U, V;
+			Rest = ParseFloat(Rest, LineEnd, U);
+			ParseFloat(Rest, LineEnd, V);
+			// obj의 vt는 좌하단이 (0,0) -> DirectX UV는 좌상단이 (0,0) (상하 반전으로 컨버팅)
+			Chunk.TexCoords.Add(FVector2D(U, 1.0f - V));
+		}
+		else if (Keyword == "vn") // 법선 (vn x y z)
+		{
+			float X, Y, Z;
+			Rest = ParseFloat(Rest, LineEnd, X);
+			Rest = ParseFloat(Rest, LineEnd, Y);
+			ParseFloat(Rest, LineEnd, Z);
+			Chunk.Normals.Add(FVector(X, bIsRightHanded ? -Y : Y, Z));
+		}
+		else if (Keyword == "f") // 면 (f v1/vt1/vn1 v2/vt2/vn2 ...)
+		{
+			ParseFace(Rest, LineEnd, bIsRightHanded, Chunk, FaceVertices);
+		}
+		else if (Keyword == "g")
+		{
+			// 현재 'usemtl'을 기준으로 그룹을 나누므로 'g' 태그는 무시합니다.
+		}
+		else if (Keyword == "usemtl")
+		{
+			Chunk.MaterialNames.Add(FString(Rest, LineEnd));
+			Chunk.MaterialIndexStarts.Add(static_cast<uint32>(Chunk.PositionIndices.Num()));
+		}
+		else if (Keyword == "mtllib")
+		{
+			Chunk.MtlLib.assign(Rest, LineEnd);
+			Chunk.bHasMtlLib = true;
+		}
+		else
+		{
+			++Chunk.UnknownSymbols[FString(Keyword)];
+		}
+	}
+
+	void ParseChunk(const char* Begin, const char* End, bool bIsRightHanded, FObjChunk& OutChunk)
+	{
+		TArray<FFaceVertex> FaceVertices;
+		const char* Cur = Begin;
+		while (Cur < End)
+		{
+			const char* LineEnd = static_cast<const char*>(memchr(Cur, '\n', End - Cur));
+			if (!LineEnd)
+			{
+				LineEnd = End;
+			}
+			ParseLine(Cur, LineEnd, bIsRightHanded, OutChunk, FaceVertices);
+			Cur = (LineEnd < End) ? LineEnd + 1 : End;
+		}
+	}
+
+	void AppendIndices(TArray<uint32>& OutIndices, const TArray<uint32>& InIndices, const TArray<uint32>& RelativeSlots, uint32 ElementBase)
+	{
+		const int32 Offset = OutIndices.Num();
+		OutIndices.Append(InIndices);
+		for (uint32 Slot : RelativeSlots)
+		{
+			OutIndices[Offset + Slot] += ElementBase;
+		}
+	}
+}
+
+namespace FObjParser
+{
+	bool ParseFile(const FString& InFileName, bool bIsRightHanded, FObjInfo& OutObjInfo, FString& OutMtlLib)
+	{
+		// 한글 경로 지원: UTF-8 → UTF-16 변환 후 파일 열기
+		std::ifstream File(UTF8ToWide(InFileName), std::ios::binary | std::ios::ate);
+		if (!File)
+		{
+			return false;
+		}
+
+		// 파일 전체를 한 번에 읽음 (줄 단위 getline 대신)
+		const std::streamsize FileSize = File.tellg();
+		File.seekg(0, std::ios::beg);
+
+		TArray<char> Buffer;
+		Buffer.SetNum(static_cast<int32>(FileSize));
+		if (FileSize > 0 && !File.read(Buffer.GetData(), FileSize))
+		{
+			return false;
+		}
+
+		OutObjInfo.ObjFileName = InFileName;
+		ParseBuffer(Buffer.GetData(), Buffer.size(), bIsRightHanded, OutObjInfo, OutMtlLib);
+		return true;
+	}
+
+	void ParseBuffer(const char* InData, size_t InSize, bool bIsRightHanded, FObjInfo& OutObjInfo, FString& OutMtlLib, size_t InNumChunks)
+	{
+		const char* End = InData + InSize;
+
+		// 줄 경계에서 청크 분할 (작은 파일은 한 청크)
+		size_t NumChunks = std::max<size_t>(InNumChunks, 1);
+		if (InNumChunks == 0 && InSize >= ParallelThresholdBytes)
+		{
+			const size_t NumThreads = std::max<size_t>(1, std::thread::hardware_concurrency());
+			NumChunks = std::clamp<size_t>(InSize / (ParallelThresholdBytes / 4), 1, NumThreads);
+		}
+
+		TArray<const char*> Bounds;
+		Bounds.Add(InData);
+		for (size_t i = 1; i < NumChunks; ++i)
+		{
+			const char* Split = std::max(InData + InSize * i / NumChunks, Bounds.Last());
+			const char* NewLine = static_cast<const char*>(memchr(Split, '\n', End - Split));
+			Bounds.Add(NewLine ? NewLine + 1 : End);
+		}
+		Bounds.Add(End);
+
+		TArray<FObjChunk> Chunks;
+		Chunks.SetNum(static_cast<int32>(NumChunks));
+
+		// 첫 청크는 호출 스레드에서, 나머지는 별도 스레드에서 파싱
+		TArray<std::future<void>> Tasks;
+		for (size_t i = 1; i < NumChunks; ++i)
+		{
+			Tasks.push_back(std::async(std::launch::async, ParseChunk, Bounds[i], Bounds[i + 1], bIsRightHanded, std::ref(Chunks[i])));
+		}
+		ParseChunk(Bounds[0], Bounds[1], bIsRightHanded, Chunks[0]);
+		for (std::future<void>& Task : Tasks)
+		{
+			Task.wait();
+		}
+
+		// 파일 순서대로 병합
+		size_t TotalPositions = 0, TotalTexCoords = 0, TotalNormals = 0, TotalIndices = 0;
+		for (const FObjChunk& Chunk : Chunks)
+		{
+			TotalPositions += Chunk.Positions.size();
+			TotalTexCoords += Chunk.TexCoords.size();
+			TotalNormals += Chunk.Normals.size();
+			TotalIndices += Chunk.PositionIndices.size();
+		}
+		OutObjInfo.Positions.Reserve(OutObjInfo.Positions.Num() + TotalPositions);
+		OutObjInfo.TexCoords.Reserve(OutObjInfo.TexCoords.Num() + TotalTexCoords);
+		OutObjInfo.Normals.Reserve(OutObjInfo.Normals.Num() + TotalNormals);
+		OutObjInfo.PositionIndices.Reserve(OutObjInfo.PositionIndices.Num() + TotalIndices);
+		OutObjInfo.TexCoordIndices.Reserve(OutObjInfo.TexCoordIndices.Num() + TotalIndices);
+		OutObjInfo.NormalIndices.Reserve(OutObjInfo.NormalIndices.Num() + TotalIndices);
+
+		OutMtlLib.clear();
+		TMap<FString, uint32> UnknownSymbols;
+		for (const FObjChunk& Chunk : Chunks)
+		{
+			const uint32 IndexBase = static_cast<uint32>(OutObjInfo.PositionIndices.Num());
+
+			AppendIndices(OutObjInfo.PositionIndices, Chunk.PositionIndices, Chunk.RelativePositionSlots, static_cast<uint32>(OutObjInfo.Positions.Num()));
+			AppendIndices(OutObjInfo.TexCoordIndices, Chunk.TexCoordIndices, Chunk.RelativeTexCoordSlots, static_cast<uint32>(OutObjInfo.TexCoords.Num()));
+			AppendIndices(OutObjInfo.NormalIndices, Chunk.NormalIndices, Chunk.RelativeNormalSlots, static_cast<uint32>(OutObjInfo.Normals.Num()));
+
+			OutObjInfo.Positions.Append(Chunk.Positions);
+			OutObjInfo.TexCoords.Append(Chunk.TexCoords);
+			OutObjInfo.Normals.Append(Chunk.Normals);
+
+			for (int32 i = 0; i < Chunk.MaterialNames.Num(); ++i)
+			{
+				OutObjInfo.MaterialNames.Add(Chunk.MaterialNames[i]);
+				OutObjInfo.GroupIndexStartArray.Add(IndexBase + Chunk.MaterialIndexStarts[i]);
+			}
+
+			// mtllib이 여러 번 나오면 마지막 값 사용
+			if (Chunk.bHasMtlLib)
+			{
+				OutMtlLib = Chunk.MtlLib;
+			}
+
+			for (const auto& Pair : Chunk.UnknownSymbols)
+			{
+				UnknownSymbols[Pair.first] += Pair.second;
+			}
+		}
+
+		// 알 수 없는 키워드는 줄마다가 아니라 키워드마다 한 번씩 기록
+		for (const auto& Pair : UnknownSymbols)
+		{
+			UE_LOG("While parsing the filename %s, the following unknown symbol was encountered %u times: \'%s\'", OutObjInfo.ObjFileName.c_str(), Pair.second, Pair.first.c_str());
+		}
+	}
+}
@@ -0,0 +1,28 @@
+﻿#pragma once
+#include "UEContainer.h"
+
+struct FObjInfo;
+
+/**
+ * .obj 지오메트리 파서 (v / vt / vn / f / usemtl / mtllib)
+ *
+ * 파일 전체를 한 번에 읽은 뒤 버퍼 위에서 바로 토큰을 나누고, 숫자는 from_chars로 변환합니다.
+ * (줄마다 문자열을 만들고 stringstream으로 파싱하던 방식 대비 할당이 거의 없음)
+ *
+ * 큰 파일은 줄 경계에서 청크로 나눠 병렬로 파싱하고 파일 순서대로 이어 붙입니다.
+ * 면 인덱스는 1-based 절대 인덱스를 0-based로 바꾸고, 음수(상대) 인덱스는 병합 시 앞 청크의 정점 수를 더해 해석합니다.
+ * 결과는 기존 줄 단위 파서와 같은 FObjInfo를 만듭니다 (삼각형 분할 순서, usemtl 그룹 시작 인덱스 포함).
+ */
+namespace FObjParser
+{
+	// 이 크기 이상이면 청크로 나눠 병렬 파싱
+	constexpr size_t ParallelThresholdBytes = 4 * 1024 * 1024;
+
+	// 파일을 읽어 ParseBuffer 호출 (파일이 없으면 false)
+	bool ParseFile(const FString& InFileName, bool bIsRightHanded, FObjInfo& OutObjInfo, FString& OutMtlLib);
+
+	// Positions/TexCoords/Normals, 인덱스, MaterialNames/GroupIndexStartArray(usemtl)를 채움
+	// OutMtlLib: 마지막 mtllib 값 (obj 파일 기준 상대 경로, 없으면 빈 문자열)
+	// InNumChunks: 0이면 파일 크기와 코어 수로 결정. 작은 파일에서도 청크 병합 경로를 검증할 때 지정
+	void ParseBuffer(const char* InData, size_t InSize, bool bIsRightHanded, FObjInfo& OutObjInfo, FString& OutMtlLib, size_t InNumChunks = 0);
+}
@@ -0,0 +1,267 @@
+﻿#include "pch.h"
+#include "ObjParserTests.h"
+#include "ObjParser.h"
+#include "ObjManager.h"
+#include "PathUtils.h"
+#include "TestContext.h"
+#include <filesystem>
+#include <sstream>
+
+namespace
+{
+	// 청크 병합 경로를 강제로 검증할 때의 청크 수
+	constexpr size_t ForcedChunkCount = 7;
+
+	// -------------------------------------------------------------------------
+	// 기존 FObjImporter::LoadObjModel의 지오메트리 파싱 (골든 비교 기준)
+	// 파일 대신 메모리 버퍼를 읽고, 텍스트 모드 ifstream처럼 줄 끝 '\r'을 제거한다.
+	// 그룹 후처리(빈 그룹 제거, 기본 법선/UV 추가)는 두 파서가 공유하므로 제외한다.
+	// -------------------------------------------------------------------------
+	struct FLegacyFaceVertex
+	{
+		uint32 PositionIndex = 0;
+		uint32 TexCoordIndex = 0;
+		uint32 NormalIndex = 0;
+	};
+
+	FLegacyFaceVertex LegacyParseVertexDef(const FString& InVertexDef)
+	{
+		FLegacyFaceVertex Result;
+		std::stringstream ss(InVertexDef);
+		FString Part;
+		uint32 Value;
+
+		uint32* Targets[3] = { &Result.PositionIndex, &Result.TexCoordIndex, &Result.NormalIndex };
+		for (uint32* Target : Targets)
+		{
+			if (!std::getline(ss, Part, '/'))
+			{
+				break;
+			}
+			if (!Part.empty())
+			{
+				std::stringstream Conv(Part);
+				if (Conv >> Value)
+				{
+					*Target = Value - 1;
+				}
+			}
+		}
+		return Result;
+	}
+
+	void LegacyParseObj(const FString& InText, bool bIsRightHanded, FObjInfo& OutObjInfo, FString& OutMtlLib)
+	{
+		uint32 VIndex = 0;
+		std::istringstream FileIn(InText);
+		FString Line;
+		while (std::getline(FileIn, Line))
+		{
+			if (!Line.empty() && Line.back() == '\r')
+			{
+				Line.pop_back();
+			}
+			if (Line.empty()) continue;
+
+			Line.erase(0, Line.find_first_not_of(" \t\n\r"));
+			if (Line.empty() || Line[0] == '#')
+				continue;
+
+			if (Line.rfind("v ", 0) == 0)
+			{
+				std::stringstream wss(Line.substr(2));
+				float vx, vy, vz;
+				wss >> vx >> vy >> vz;
+				OutObjInfo.Positions.push_back(bIsRightHanded ? FVector(vx, -vy, vz) : FVector(vx, vy, vz));
+			}
+			else if (Line.rfind("vt ", 0) == 0)
+			{
+				std::stringstream wss(Line.substr(3));
+				float u, v;
+				wss >> u >> v;
+				OutObjInfo.TexCoords.push_back(FVector2D(u, 1.0f - v));
+			}
+			else if (Line.rfind("vn ", 0) == 0)
+			{
+				std::stringstream wss(Line.substr(3));
+				float nx, ny, nz;
+				wss >> nx >> ny >> nz;
+				OutObjInfo.Normals.push_back(bIsRightHanded ? FVector(nx, -ny, nz) : FVector(nx, ny, nz));
+			}
+			else if (Line.rfind("f ", 0) == 0)
+			{
+				std::stringstream wss(Line.substr(2));
+				FString VertexDef;
+				TArray<FLegacyFaceVertex> FaceVertices;
+				while (wss >> VertexDef)
+				{
+					if (VertexDef[0] == '#')
+					{
+						break;
+					}
+					FaceVertices.push_back(LegacyParseVertexDef(VertexDef));
+				}
+
+				for (uint32 i = 1; i + 1 < FaceVertices.size(); ++i)
+				{
+					const uint32 Order[3] = { 0, bIsRightHanded ? i + 1 : i, bIsRightHanded ? i : i + 1 };
+					for (uint32 Corner : Order)
+					{
+						OutObjInfo.PositionIndices.push_back(FaceVertices[Corner].PositionIndex);
+						OutObjInfo.TexCoordIndices.push_back(FaceVertices[Corner].TexCoordIndex);
+						OutObjInfo.NormalIndices.push_back(FaceVertices[Corner].NormalIndex);
+					}
+					VIndex += 3;
+				}
+			}
+			else if (Line.rfind("mtllib ", 0) == 0)
+			{
+				OutMtlLib = Line.substr(7);
+			}
+			else if (Line.rfind("usemtl ", 0) == 0)
+			{
+				OutObjInfo.MaterialNames.push_back(Line.substr(7));
+				OutObjInfo.GroupIndexStartArray.push_back(VIndex);
+			}
+		}
+	}
+
+	// -------------------------------------------------------------------------
+	// 비교
+	// -------------------------------------------------------------------------
+	template<typename T>
+	bool BitwiseEqual(const TArray<T>& A, const TArray<T>& B)
+	{
+		return A.Num() == B.Num() && (A.Num() == 0 || memcmp(A.GetData(), B.GetData(), sizeof(T) * A.Num()) == 0);
+	}
+
+	// 다른 필드 이름 (모두 같으면 nullptr)
+	const char* FindMismatch(const FObjInfo& A, const FString& MtlA, const FObjInfo& B, const FString& MtlB)
+	{
+		if (!BitwiseEqual(A.Positions, B.Positions)) return "Positions";
+		if (!BitwiseEqual(A.TexCoords, B.TexCoords)) return "TexCoords";
+		if (!BitwiseEqual(A.Normals, B.Normals)) return "Normals";
+		if (!BitwiseEqual(A.PositionIndices, B.PositionIndices)) return "PositionIndices";
+		if (!BitwiseEqual(A.TexCoordIndices, B.TexCoordIndices)) return "TexCoordIndices";
+		if (!BitwiseEqual(A.NormalIndices, B.NormalIndices)) return "NormalIndices";
+		if (A.MaterialNames != B.MaterialNames) return "MaterialNames";
+		if (!BitwiseEqual(A.GroupIndexStartArray, B.GroupIndexStartArray)) return "GroupIndexStartArray";
+		if (MtlA != MtlB) return "MtlLib";
+		return nullptr;
+	}
+
+	bool ReadText(const std::filesystem::path& InPath, FString& OutText)
+	{
+		std::ifstream File(InPath, std::ios::binary);
+		if (!File)
+		{
+			return false;
+		}
+		std::ostringstream Stream;
+		Stream << File.rdbuf();
+		OutText = Stream.str();
+		return true;
+	}
+
+	void TestDataFilesMatchLegacy(FTestContext& Context)
+	{
+		namespace fs = std::filesystem;
+
+		int32 FileCount = 0;
+		std::error_code Error;
+		for (const auto& Entry : fs::recursive_directory_iterator(UTF8ToWide(GDataDir), Error))
+		{
+			if (!Entry.is_regular_file())
+			{
+				continue;
+			}
+			FString Extension = WideToUTF8(Entry.path().extension().wstring());
+			std::transform(Extension.begin(), Extension.end(), Extension.begin(), ::tolower);
+			if (Extension != ".obj")
+			{
+				continue;
+			}
+
+			const FString FileName = WideToUTF8(Entry.path().wstring());
+			FString Text;
+			if (!Context.Check(ReadText(Entry.path(), Text), "%s: failed to read", FileName.c_str()))
+			{
+				continue;
+			}
+			++FileCount;
+
+			for (const bool bIsRightHanded : { false, true })
+			{
+				FObjInfo Legacy, Streamed, Chunked;
+				FString LegacyMtl, StreamedMtl, ChunkedMtl;
+				LegacyParseObj(Text, bIsRightHanded, Legacy, LegacyMtl);
+				FObjParser::ParseBuffer(Text.data(), Text.size(), bIsRightHanded, Streamed, StreamedMtl);
+				FObjParser::ParseBuffer(Text.data(), Text.size(), bIsRightHanded, Chunked, ChunkedMtl, ForcedChunkCount);
+
+				const char* Mismatch = FindMismatch(Legacy, LegacyMtl, Streamed, StreamedMtl);
+				Context.Check(!Mismatch, "%s (%s-handed): %s differs from legacy parser", FileName.c_str(), bIsRightHanded ? "right" : "left", Mismatch);
+
+				Mismatch = FindMismatch(Streamed, StreamedMtl, Chunked, ChunkedMtl);
+				Context.Check(!Mismatch, "%s (%s-handed): %s differs when split into %zu chunks", FileName.c_str(), bIsRightHanded ? "right" : "left", Mismatch, ForcedChunkCount);
+			}
+		}
+
+		Context.Check(FileCount > 0, "no .obj files found under %s", GDataDir.c_str());
+	}
+
+	void TestRelativeIndicesAcrossChunks(FTestContext& Context)
+	{
+		// 음수 인덱스는 그 줄까지 읽은 정점 수 기준. 청크를 나눠도 앞 청크 정점 수를 더해 같은 값이 나와야 한다
+		const FString Text =
+			"mtllib first.mtl\n"
+			"v 0 0 0\nv 1 0 0\nv 1 1 0\nv 0 1 0\n"
+			"vt 0 0\nvt 1 0\nvt 1 1\n"
+			"vn 0 0 1\n"
+			"usemtl A\n"
+			"f -4/-3/-1 -3/-2/-1 -2/-1/-1\r\n"
+			"# comment line\n"
+			"v 2 0 0\nv 2 1 0\n"
+			"usemtl B\n"
+			"f 2 -2 -1 3 # trailing comment\n"
+			"mtllib second.mtl\n";
+
+		const uint32 ExpectedPositions[] = { 0, 1, 2, 1, 4, 5, 1, 5, 2 };
+		const uint32 ExpectedTexCoords[] = { 0, 1, 2 };
+
+		for (size_t NumChunks = 1; NumChunks <= 12; ++NumChunks)
+		{
+			FObjInfo Info;
+			FString MtlLib;
+			FObjParser::ParseBuffer(Text.data(), Text.size(), false, Info, MtlLib, NumChunks);
+
+			bool bPositionsMatch = Info.PositionIndices.Num() == 9;
+			for (int32 i = 0; bPositionsMatch && i < 9; ++i)
+			{
+				bPositionsMatch = Info.PositionIndices[i] == ExpectedPositions[i];
+			}
+			bool bTexCoordsMatch = Info.TexCoordIndices.Num() == 9;
+			for (int32 i = 0; bTexCoordsMatch && i < 3; ++i)
+			{
+				bTexCoordsMatch = Info.TexCoordIndices[i] == ExpectedTexCoords[i] && Info.NormalIndices[i] == 0;
+			}
+
+			Context.Check(bPositionsMatch, "%zu chunks: relative position indices resolved incorrectly", NumChunks);
+			Context.Check(bTexCoordsMatch, "%zu chunks: relative texcoord/normal indices resolved incorrectly", NumChunks);
+			Context.Check(Info.Positions.Num() == 6 && Info.TexCoords.Num() == 3 && Info.Normals.Num() == 1,
+				"%zu chunks: element counts %d/%d/%d", NumChunks, Info.Positions.Num(), Info.TexCoords.Num(), Info.Normals.Num());
+			Context.Check(Info.MaterialNames.Num() == 2 && Info.GroupIndexStartArray.Num() == 2 &&
+				Info.GroupIndexStartArray[0] == 0 && Info.GroupIndexStartArray[1] == 3,
+				"%zu chunks: usemtl group starts differ", NumChunks);
+			Context.Check(MtlLib == "second.mtl", "%zu chunks: mtllib '%s', expected the last one", NumChunks, MtlLib.c_str());
+		}
+	}
+}
+
+namespace FObjParserTests
+{
+	void Run(FTestContext& Context)
+	{
+		TestDataFilesMatchLegacy(Context);
+		TestRelativeIndicesAcrossChunks(Context);
+	}
+}
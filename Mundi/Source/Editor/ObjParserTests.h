@@ -0,0 +1,12 @@
+﻿#pragma once
+
+struct FTestContext;
+
+// 콘솔 명령 "TEST OBJ"에서 사용
+namespace FObjParserTests
+{
+	// Data 폴더의 모든 .obj를 기존 줄 단위 파서(stringstream, 이 파일에 기준 구현으로 보관)와
+	// FObjParser로 각각 파싱해 정점/인덱스/머티리얼 그룹이 비트 단위로 같은지 확인합니다 (좌/우손 좌표계 모두).
+	// 작은 파일도 청크를 강제로 나눠 병렬 병합 경로와 음수(상대) 인덱스 해석을 함께 검증합니다.
+	void Run(FTestContext& Context);
+}
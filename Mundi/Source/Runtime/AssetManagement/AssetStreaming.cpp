@@ -0,0 +1,754 @@
+﻿#include "pch.h"
+#include "AssetStreaming.h"
+#include "ResourceManager.h"
+#include "ObjManager.h"
+#include "FbxLoader.h"
+#include "PlatformTime.h"
+#include "Profiler.h"
+#include <fstream>
+
+namespace
+{
+	// 워커 수 상한 (틱 병렬화, 씬 쿼리 작업과 코어를 나눠 쓴다)
+	constexpr int32 MaxWorkerCount = 4;
+
+	struct FAssetLoadListener
+	{
+		uint32 ListenerId = 0;
+		FOnAssetLoaded OnLoaded;
+		bool bReleased = false;		// Release됨: 취소/실패해도 최종 상태를 남기지 않음
+	};
+
+	FString GetLowerExtension(const FString& InPath)
+	{
+		const size_t SlashPos = InPath.find_last_of('/');
+		const size_t DotPos = InPath.find_last_of('.');
+		if (DotPos == FString::npos || (SlashPos != FString::npos && DotPos < SlashPos))
+		{
+			return FString();
+		}
+
+		FString Extension = InPath.substr(DotPos);
+		std::transform(Extension.begin(), Extension.end(), Extension.begin(),
+			[](unsigned char c) { return static_cast<char>(std::tolower(c)); });
+		return Extension;
+	}
+
+	bool ReadFileToArray(const FString& InPath, TArray<uint8>& OutData)
+	{
+		std::ifstream File(UTF8ToWide(InPath), std::ios::binary | std::ios::ate);
+		if (!File.is_open())
+		{
+			return false;
+		}
+
+		const std::streamoff Size = File.tellg();
+		if (Size <= 0)
+		{
+			return false;
+		}
+
+		OutData.SetNum(static_cast<int32>(Size));
+		File.seekg(0, std::ios::beg);
+		return static_cast<bool>(File.read(reinterpret_cast<char*>(OutData.GetData()), Size));
+	}
+}
+
+struct FAssetLoadRequest
+{
+	uint64 RequestId = 0;
+	EResourceType Type = EResourceType::None;
+	FString NormalizedPath;
+	FString Key;
+	bool bSRGB = true;
+	EAssetLoadPriority Priority = EAssetLoadPriority::Normal;
+	uint64 Sequence = 0;
+	EAssetLoadState State = EAssetLoadState::Pending;
+	bool bCanceled = false;			// 모든 핸들이 취소됨 (워커가 읽는 중이었으면 끝난 뒤 버림)
+	FAssetSyncLoadFunc SyncLoad = nullptr;
+	bool bCustom = false;			// RequestCustom: 리소스 맵 대신 CustomStages로 처리
+	FAssetCustomStages CustomStages;
+	TArray<FAssetLoadListener> Listeners;
+
+	// --- 워커 단계 결과 (State가 ReadyToFinalize가 된 뒤에만 게임 스레드가 읽음) ---
+	bool bNeedsSyncLoad = false;				// 워커 단계가 없거나 캐시가 없어 동기 로드가 필요
+	FStaticMesh* StaticMeshAsset = nullptr;		// .umesh는 FObjManager 캐시 소유, .fbx는 이 요청 소유 (마무리에서 등록)
+	bool bOwnsStaticMeshAsset = false;
+	FSkeletalMeshData* SkeletalMeshData = nullptr;	// 마무리에서 USkeletalMesh로 소유권 이전
+	TArray<FMaterialInfo> MaterialInfos;		// .uskel 캐시의 머티리얼 (UMaterial 생성은 게임 스레드)
+	FString LoadPath;							// 텍스처: 실제로 읽은 파일 (DDS 캐시 경로일 수 있음)
+	FString CacheFilePath;
+	TArray<uint8> FileData;
+	bool bCustomLoaded = false;					// CustomStages.LoadOnWorker 결과
+	double WorkerMs = 0.0;
+};
+
+FAssetStreamingManager::FAssetStreamingManager()
+{
+	RequestsByKey.SetNum(static_cast<int32>(EResourceType::End));
+}
+
+FAssetStreamingManager::~FAssetStreamingManager()
+{
+	Shutdown();
+}
+
+FAssetLoadHandle FAssetStreamingManager::Request(EResourceType InType, const FString& InNormalizedPath, const FString& InKey, bool bInSRGB,
+	EAssetLoadPriority InPriority, FAssetSyncLoadFunc InSyncLoad, FOnAssetLoaded&& InOnLoaded)
+{
+	return AddRequest(InType, InNormalizedPath, InKey, bInSRGB, InPriority, InSyncLoad, nullptr, std::move(InOnLoaded));
+}
+
+FAssetLoadHandle FAssetStreamingManager::RequestCustom(const FString& InKey, const FAssetCustomStages& InStages,
+	EAssetLoadPriority InPriority, FOnAssetLoaded&& InOnLoaded)
+{
+	// 엔진 리소스 요청은 None 타입을 쓰지 않으므로 None 키 맵을 사용자 지정 요청의 중복 제거에 쓴다
+	return AddRequest(EResourceType::None, InKey, InKey, true, InPriority, nullptr, &InStages, std::move(InOnLoaded));
+}
+
+FAssetLoadHandle FAssetStreamingManager::AddRequest(EResourceType InType, const FString& InNormalizedPath, const FString& InKey, bool bInSRGB,
+	EAssetLoadPriority InPriority, FAssetSyncLoadFunc InSyncLoad, const FAssetCustomStages* InCustomStages, FOnAssetLoaded&& InOnLoaded)
+{
+	std::lock_guard<std::mutex> Lock(Mutex);
+	if (Workers.empty())
+	{
+		StartWorkers();
+	}
+
+	++Stats.NumRequested;
+
+	FAssetLoadRequest* Request = nullptr;
+	TMap<FString, FAssetLoadRequest*>& KeyMap = RequestsByKey[static_cast<int32>(InType)];
+	if (FAssetLoadRequest** Found = KeyMap.Find(InKey))
+	{
+		// 진행 중인 요청에 합류 (취소된 채 읽는 중이던 요청도 되살린다)
+		Request = *Found;
+		Request->bCanceled = false;
+		if (InPriority > Request->Priority)
+		{
+			Request->Priority = InPriority;
+		}
+		++Stats.NumDeduplicated;
+	}
+	else
+	{
+		Request = new FAssetLoadRequest();
+		Request->RequestId = NextRequestId++;
+		Request->Type = InType;
+		Request->NormalizedPath = InNormalizedPath;
+		Request->Key = InKey;
+		Request->bSRGB = bInSRGB;
+		Request->Priority = InPriority;
+		Request->Sequence = NextSequence++;
+		Request->SyncLoad = InSyncLoad;
+		if (InCustomStages)
+		{
+			Request->bCustom = true;
+			Request->CustomStages = *InCustomStages;
+		}
+
+		Requests.Add(Request->RequestId, Request);
+		KeyMap.Add(InKey, Request);
+		PendingQueue.Add(Request);
+		NumInFlight.fetch_add(1, std::memory_order_release);
+		WorkCondition.notify_one();
+	}
+
+	FAssetLoadHandle Handle;
+	Handle.RequestId = Request->RequestId;
+	Handle.ListenerId = NextListenerId++;
+	Request->Listeners.Add({ Handle.ListenerId, std::move(InOnLoaded) });
+	return Handle;
+}
+
+EAssetLoadState FAssetStreamingManager::Cancel(const FAssetLoadHandle& Handle)
+{
+	FAssetLoadRequest* ToDelete = nullptr;
+	{
+		std::lock_guard<std::mutex> Lock(Mutex);
+		FAssetLoadRequest* Request = FindRequest(Handle.RequestId);
+		if (!Request)
+		{
+			// 이미 끝난 요청: 취소할 것이 없으므로 끝난 상태를 그대로 알려준다
+			return GetFinishedState(Handle.ListenerId);
+		}
+
+		bool bRemoved = false;
+		bool bReleased = false;
+		for (int32 Index = 0; Index < Request->Listeners.Num(); ++Index)
+		{
+			if (Request->Listeners[Index].ListenerId == Handle.ListenerId)
+			{
+				bReleased = Request->Listeners[Index].bReleased;
+				Request->Listeners.RemoveAt(Index);
+				bRemoved = true;
+				break;
+			}
+		}
+		if (!bRemoved)
+		{
+			// 이미 취소한 핸들
+			return EAssetLoadState::Canceled;
+		}
+
+		if (!bReleased)
+		{
+			FinishedListenerStates[Handle.ListenerId] = EAssetLoadState::Canceled;
+		}
+		if (!Request->Listeners.empty())
+		{
+			return EAssetLoadState::Canceled;
+		}
+
+		Request->bCanceled = true;
+		if (Request->State == EAssetLoadState::Pending)
+		{
+			PendingQueue.Remove(Request);
+			ToDelete = Request;
+		}
+		else if (Request->State == EAssetLoadState::ReadyToFinalize)
+		{
+			ReadyQueue.Remove(Request);
+			ToDelete = Request;
+		}
+		// Loading이면 워커가 끝낸 뒤 ProcessCompleted에서 버린다
+
+		if (ToDelete)
+		{
+			RemoveRequest(ToDelete);
+			++Stats.NumCanceled;
+		}
+	}
+
+	if (ToDelete)
+	{
+		DiscardPayload(*ToDelete);
+		delete ToDelete;
+	}
+	return EAssetLoadState::Canceled;
+}
+
+EAssetLoadState FAssetStreamingManager::GetState(const FAssetLoadHandle& Handle) const
+{
+	std::lock_guard<std::mutex> Lock(Mutex);
+	const FAssetLoadRequest* Request = FindRequest(Handle.RequestId);
+	if (!Request)
+	{
+		return GetFinishedState(Handle.ListenerId);
+	}
+
+	// 합쳐진 요청에서 이 핸들만 취소되었을 수 있음 (다시 요청되어 되살아난 요청 포함)
+	if (const EAssetLoadState* Finished = FinishedListenerStates.Find(Handle.ListenerId))
+	{
+		return *Finished;
+	}
+	if (Request->bCanceled)
+	{
+		return EAssetLoadState::Canceled;
+	}
+	return Request->State;
+}
+
+void FAssetStreamingManager::Release(const FAssetLoadHandle& Handle)
+{
+	std::lock_guard<std::mutex> Lock(Mutex);
+	FinishedListenerStates.Remove(Handle.ListenerId);
+	if (FAssetLoadRequest* Request = FindRequest(Handle.RequestId))
+	{
+		for (FAssetLoadListener& Listener : Request->Listeners)
+		{
+			if (Listener.ListenerId == Handle.ListenerId)
+			{
+				Listener.bReleased = true;
+				break;
+			}
+		}
+	}
+}
+
+void FAssetStreamingManager::Wait(const FAssetLoadHandle& Handle)
+{
+	FAssetLoadRequest* Request = nullptr;
+	const uint64 StartCycles = FPlatformTime::Cycles64();
+	{
+		std::unique_lock<std::mutex> Lock(Mutex);
+		Request = FindRequest(Handle.RequestId);
+		if (!Request)
+		{
+			return;
+		}
+
+		if (Request->State == EAssetLoadState::Pending)
+		{
+			// 워커를 기다리지 않고 이 스레드에서 바로 읽는다
+			PendingQueue.Remove(Request);
+			Request->State = EAssetLoadState::Loading;
+			++NumLoading;
+			Lock.unlock();
+
+			ExecuteLoad(*Request);
+
+			Lock.lock();
+			--NumLoading;
+			Request->State = EAssetLoadState::ReadyToFinalize;
+		}
+		else
+		{
+			ReadyCondition.wait(Lock, [Request]() { return Request->State == EAssetLoadState::ReadyToFinalize; });
+			ReadyQueue.Remove(Request);
+		}
+
+		Stats.TotalWaitMs += FPlatformTime::ToMilliseconds(FPlatformTime::Cycles64() - StartCycles);
+	}
+
+	FinalizeRequest(Request);
+}
+
+bool FAssetStreamingManager::WaitForKey(EResourceType InType, const FString& InKey)
+{
+	FAssetLoadHandle Handle;
+	{
+		std::lock_guard<std::mutex> Lock(Mutex);
+		FAssetLoadRequest** Found = RequestsByKey[static_cast<int32>(InType)].Find(InKey);
+		if (!Found)
+		{
+			return false;
+		}
+		Handle.RequestId = (*Found)->RequestId;
+	}
+
+	Wait(Handle);
+	return true;
+}
+
+void FAssetStreamingManager::ProcessCompleted(double BudgetMs)
+{
+	if (!HasInFlightRequests())
+	{
+		return;
+	}
+
+	PROFILE_SCOPE("AssetStreaming::Finalize");
+	const uint64 StartCycles = FPlatformTime::Cycles64();
+	for (;;)
+	{
+		FAssetLoadRequest* Request = nullptr;
+		{
+			std::lock_guard<std::mutex> Lock(Mutex);
+			Request = PopHighestPriority(ReadyQueue);
+		}
+		if (!Request)
+		{
+			break;
+		}
+
+		FinalizeRequest(Request);
+
+		if (FPlatformTime::ToMilliseconds(FPlatformTime::Cycles64() - StartCycles) >= BudgetMs)
+		{
+			break;
+		}
+	}
+}
+
+void FAssetStreamingManager::Flush()
+{
+	for (;;)
+	{
+		TArray<uint64> RequestIds;
+		{
+			std::lock_guard<std::mutex> Lock(Mutex);
+			for (const auto& Pair : Requests)
+			{
+				RequestIds.Add(Pair.first);
+			}
+		}
+		if (RequestIds.empty())
+		{
+			return;
+		}
+
+		// 마무리 중 콜백이 새 요청을 만들 수 있으므로 빌 때까지 반복
+		for (uint64 RequestId : RequestIds)
+		{
+			FAssetLoadHandle Handle;
+			Handle.RequestId = RequestId;
+			Wait(Handle);
+		}
+	}
+}
+
+void FAssetStreamingManager::Shutdown()
+{
+	{
+		std::lock_guard<std::mutex> Lock(Mutex);
+		bStopRequested = true;
+	}
+	WorkCondition.notify_all();
+
+	// 워커는 읽던 요청을 끝낸 뒤 종료한다
+	for (std::thread& Worker : Workers)
+	{
+		if (Worker.joinable())
+		{
+			Worker.join();
+		}
+	}
+	Workers.Empty();
+
+	std::lock_guard<std::mutex> Lock(Mutex);
+	for (auto& Pair : Requests)
+	{
+		for (const FAssetLoadListener& Listener : Pair.second->Listeners)
+		{
+			if (!Listener.bReleased)
+			{
+				FinishedListenerStates[Listener.ListenerId] = EAssetLoadState::Canceled;
+			}
+		}
+		DiscardPayload(*Pair.second);
+		delete Pair.second;
+	}
+	Requests.Empty();
+	for (TMap<FString, FAssetLoadRequest*>& KeyMap : RequestsByKey)
+	{
+		KeyMap.Empty();
+	}
+	PendingQueue.Empty();
+	ReadyQueue.Empty();
+	NumInFlight.store(0, std::memory_order_release);
+	bStopRequested = false;
+}
+
+FAssetStreamingStats FAssetStreamingManager::GetStats() const
+{
+	std::lock_guard<std::mutex> Lock(Mutex);
+	FAssetStreamingStats Result = Stats;
+	Result.NumPending = static_cast<uint32>(PendingQueue.Num());
+	Result.NumLoading = NumLoading;
+	Result.NumReadyToFinalize = static_cast<uint32>(ReadyQueue.Num());
+	return Result;
+}
+
+void FAssetStreamingManager::StartWorkers()
+{
+	const int32 HardwareThreads = static_cast<int32>(std::max(1u, std::thread::hardware_concurrency()));
+	const int32 WorkerCount = std::clamp(HardwareThreads / 2, 1, MaxWorkerCount);
+	for (int32 WorkerIndex = 0; WorkerIndex < WorkerCount; ++WorkerIndex)
+	{
+		Workers.emplace_back(&FAssetStreamingManager::WorkerMain, this, WorkerIndex);
+	}
+}
+
+void FAssetStreamingManager::WorkerMain(int32 WorkerIndex)
+{
+	char ThreadName[32];
+	snprintf(ThreadName, sizeof(ThreadName), "AssetStreaming %d", WorkerIndex);
+	FProfiler::SetThreadName(ThreadName);
+
+	// DDS 변환(DirectXTex)과 WIC 디코딩이 COM을 사용
+	const HRESULT ComResult = CoInitializeEx(nullptr, COINIT_MULTITHREADED);
+
+	std::unique_lock<std::mutex> Lock(Mutex);
+	for (;;)
+	{
+		WorkCondition.wait(Lock, [this]() { return bStopRequested || !PendingQueue.empty(); });
+		if (bStopRequested)
+		{
+			break;
+		}
+
+		FAssetLoadRequest* Request = PopHighestPriority(PendingQueue);
+		Request->State = EAssetLoadState::Loading;
+		++NumLoading;
+		Lock.unlock();
+
+		const uint64 StartCycles = FPlatformTime::Cycles64();
+		{
+			PROFILE_SCOPE("AssetStreaming::Load");
+			ExecuteLoad(*Request);
+		}
+		Request->WorkerMs = FPlatformTime::ToMilliseconds(FPlatformTime::Cycles64() - StartCycles);
+
+		Lock.lock();
+		--NumLoading;
+		Request->State = EAssetLoadState::ReadyToFinalize;
+		ReadyQueue.Add(Request);
+		Stats.TotalWorkerMs += Request->WorkerMs;
+		ReadyCondition.notify_all();
+	}
+	Lock.unlock();
+
+	if (SUCCEEDED(ComResult))
+	{
+		CoUninitialize();
+	}
+}
+
+FAssetLoadRequest* FAssetStreamingManager::PopHighestPriority(TArray<FAssetLoadRequest*>& Queue)
+{
+	if (Queue.empty())
+	{
+		return nullptr;
+	}
+
+	// 대기열은 수백 건 수준이고 우선순위 상향/취소가 잦으므로 힙 대신 선형 탐색
+	int32 BestIndex = 0;
+	for (int32 Index = 1; Index < Queue.Num(); ++Index)
+	{
+		const FAssetLoadRequest* Candidate = Queue[Index];
+		const FAssetLoadRequest* Best = Queue[BestIndex];
+		if (Candidate->Priority > Best->Priority ||
+			(Candidate->Priority == Best->Priority && Candidate->Sequence < Best->Sequence))
+		{
+			BestIndex = Index;
+		}
+	}
+
+	FAssetLoadRequest* Request = Queue[BestIndex];
+	Queue.RemoveAtSwap(BestIndex);
+	return Request;
+}
+
+void FAssetStreamingManager::ExecuteLoad(FAssetLoadRequest& Request)
+{
+	if (Request.bCustom)
+	{
+		Request.bCustomLoaded = !Request.CustomStages.LoadOnWorker || Request.CustomStages.LoadOnWorker(Request.NormalizedPath);
+		return;
+	}
+
+	switch (Request.Type)
+	{
+	case EResourceType::Texture:
+	{
+		Request.LoadPath = UTexture::ResolveLoadPath(Request.NormalizedPath, Request.bSRGB, Request.CacheFilePath);
+		if (!ReadFileToArray(Request.LoadPath, Request.FileData))
+		{
+			Request.FileData.Empty();
+		}
+		break;
+	}
+	case EResourceType::StaticMesh:
+	{
+		if (GetLowerExtension(Request.NormalizedPath) == ".fbx")
+		{
+			// .uskel 캐시가 없으면 FBX SDK 임포트가 필요하므로 게임 스레드 동기 로드로 넘긴다
+			FSkeletalMeshData* SkeletalData = UFbxLoader::ReadMeshCache(Request.NormalizedPath, Request.MaterialInfos);
+			if (!SkeletalData || SkeletalData->Vertices.empty() || SkeletalData->Indices.empty())
+			{
+				delete SkeletalData;
+				Request.MaterialInfos.Empty();
+				Request.bNeedsSyncLoad = true;
+				break;
+			}
+
+			Request.StaticMeshAsset = UFbxLoader::ConvertSkeletalToStaticMesh(SkeletalData);
+			Request.StaticMeshAsset->PathFileName = Request.NormalizedPath;
+			Request.bOwnsStaticMeshAsset = true;
+			delete SkeletalData;
+		}
+		else
+		{
+			Request.StaticMeshAsset = FObjManager::LoadObjStaticMeshAsset(Request.NormalizedPath);
+		}
+		break;
+	}
+	case EResourceType::SkeletalMesh:
+	{
+		Request.SkeletalMeshData = UFbxLoader::ReadMeshCache(Request.NormalizedPath, Request.MaterialInfos);
+		Request.bNeedsSyncLoad = (Request.SkeletalMeshData == nullptr);
+		break;
+	}
+	default:
+		// 셰이더(디바이스 컴파일), 머티리얼, 사운드 등은 워커 단계가 없다
+		Request.bNeedsSyncLoad = true;
+		break;
+	}
+}
+
+void FAssetStreamingManager::FinalizeRequest(FAssetLoadRequest* Request)
+{
+	// 동기 로드 폴백이 같은 키로 WaitForKey를 호출하지 않도록 먼저 진행 중 목록에서 뺀다
+	{
+		std::lock_guard<std::mutex> Lock(Mutex);
+		RemoveRequest(Request);
+		if (Request->bCanceled)
+		{
+			++Stats.NumCanceled;
+		}
+	}
+
+	if (Request->bCanceled)
+	{
+		DiscardPayload(*Request);
+		delete Request;
+		return;
+	}
+
+	const uint64 StartCycles = FPlatformTime::Cycles64();
+	bool bSyncFallback = false;
+	UResourceBase* Result = nullptr;
+	if (Request->bCustom)
+	{
+		Result = (Request->bCustomLoaded && Request->CustomStages.Finalize) ? Request->CustomStages.Finalize(Request->NormalizedPath) : nullptr;
+	}
+	else
+	{
+		Result = CreateResource(*Request, bSyncFallback);
+	}
+	const bool bFailed = (Result == nullptr);
+
+	{
+		std::lock_guard<std::mutex> Lock(Mutex);
+		if (bFailed)
+		{
+			++Stats.NumFailed;
+			for (const FAssetLoadListener& Listener : Request->Listeners)
+			{
+				if (!Listener.bReleased)
+				{
+					FinishedListenerStates[Listener.ListenerId] = EAssetLoadState::Failed;
+				}
+			}
+		}
+		else
+		{
+			++Stats.NumCompleted;
+		}
+		Stats.NumSyncFallbacks += bSyncFallback ? 1 : 0;
+		Stats.TotalFinalizeMs += FPlatformTime::ToMilliseconds(FPlatformTime::Cycles64() - StartCycles);
+	}
+
+	// 콜백은 락 밖에서 (콜백 안에서 새 요청/취소 가능)
+	for (FAssetLoadListener& Listener : Request->Listeners)
+	{
+		Listener.OnLoaded.ExecuteIfBound(Result);
+	}
+	delete Request;
+}
+
+UResourceBase* FAssetStreamingManager::CreateResource(FAssetLoadRequest& Request, bool& bOutSyncFallback)
+{
+	UResourceManager& ResourceManager = UResourceManager::GetInstance();
+	TMap<FString, UResourceBase*>& ResourceMap = ResourceManager.Resources[static_cast<int32>(Request.Type)];
+	ID3D11Device* Device = ResourceManager.GetDevice();
+
+	UResourceBase* Result = nullptr;
+	if (UResourceBase** Existing = ResourceMap.Find(Request.Key))
+	{
+		// 요청 이후 다른 경로(Add, ForceLoad)로 이미 등록됨
+		Result = *Existing;
+		DiscardPayload(Request);
+	}
+	else if (Request.bNeedsSyncLoad)
+	{
+		Result = Request.SyncLoad ? Request.SyncLoad(Request.NormalizedPath) : nullptr;
+		bOutSyncFallback = true;
+	}
+	else
+	{
+		switch (Request.Type)
+		{
+		case EResourceType::Texture:
+		{
+			UTexture* Texture = NewObject<UTexture>();
+			Texture->LoadFromMemory(Request.LoadPath, Request.FileData, Device, Request.bSRGB);
+			if (!Request.CacheFilePath.empty())
+			{
+				Texture->SetCacheFilePath(Request.CacheFilePath);
+			}
+			Request.FileData.Empty();
+
+			// 파일을 못 읽었거나 디코딩 실패 (LoadFromMemory가 로그를 남김)
+			if (!Texture->GetShaderResourceView())
+			{
+				ObjectFactory::DeleteObject(Texture);
+				break;
+			}
+			Result = Texture;
+			break;
+		}
+		case EResourceType::StaticMesh:
+		{
+			if (!Request.StaticMeshAsset)
+			{
+				break;
+			}
+
+			UStaticMesh* StaticMesh = NewObject<UStaticMesh>();
+			if (Request.bOwnsStaticMeshAsset)
+			{
+				// 동기 경로(UStaticMesh::Load)와 같은 순서로 머티리얼과 FObjManager 캐시에 등록
+				UFbxLoader::RegisterCachedMaterials(Request.MaterialInfos);
+				FObjManager::RegisterStaticMeshAsset(Request.NormalizedPath, Request.StaticMeshAsset);
+				Request.bOwnsStaticMeshAsset = false;
+			}
+			StaticMesh->InitializeFromAsset(Request.StaticMeshAsset, Device);
+			Request.StaticMeshAsset = nullptr;
+			Result = StaticMesh;
+			break;
+		}
+		case EResourceType::SkeletalMesh:
+		{
+			UFbxLoader::RegisterCachedMaterials(Request.MaterialInfos);
+			USkeletalMesh* SkeletalMesh = NewObject<USkeletalMesh>();
+			SkeletalMesh->InitFromData(Request.SkeletalMeshData, Device);
+			Request.SkeletalMeshData = nullptr;
+			Result = SkeletalMesh;
+			break;
+		}
+		default:
+			break;
+		}
+
+		if (Result)
+		{
+			Result->SetFilePath(Request.NormalizedPath);
+			ResourceMap[Request.Key] = Result;
+		}
+	}
+
+	return Result;
+}
+
+void FAssetStreamingManager::DiscardPayload(FAssetLoadRequest& Request)
+{
+	delete Request.SkeletalMeshData;
+	Request.SkeletalMeshData = nullptr;
+	if (Request.bOwnsStaticMeshAsset)
+	{
+		delete Request.StaticMeshAsset;
+		Request.bOwnsStaticMeshAsset = false;
+	}
+	Request.StaticMeshAsset = nullptr;
+	Request.MaterialInfos.Empty();
+	Request.FileData.Empty();
+}
+
+FAssetLoadRequest* FAssetStreamingManager::FindRequest(uint64 RequestId) const
+{
+	if (FAssetLoadRequest* const* Found = Requests.Find(RequestId))
+	{
+		return *Found;
+	}
+	return nullptr;
+}
+
+EAssetLoadState FAssetStreamingManager::GetFinishedState(uint32 ListenerId) const
+{
+	if (const EAssetLoadState* Finished = FinishedListenerStates.Find(ListenerId))
+	{
+		return *Finished;
+	}
+	return EAssetLoadState::Completed;
+}
+
+void FAssetStreamingManager::RemoveRequest(FAssetLoadRequest* Request)
+{
+	if (Requests.Remove(Request->RequestId))
+	{
+		RequestsByKey[static_cast<int32>(Request->Type)].Remove(Request->Key);
+		NumInFlight.fetch_sub(1, std::memory_order_release);
+	}
+}
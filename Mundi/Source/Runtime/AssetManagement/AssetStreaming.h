@@ -0,0 +1,193 @@
+﻿#pragma once
+#include <atomic>
+#include <condition_variable>
+#include <mutex>
+#include <thread>
+#include "UEContainer.h"
+#include "Delegates.h"
+#include "Enums.h"
+
+class UResourceBase;
+struct FAssetLoadRequest;
+
+// -----------------------------------------------------------------------------
+// 비동기 에셋 스트리밍
+//  - 파일 읽기와 파싱(.umesh/.obj 캐시, .uskel FBX 캐시, DDS 변환/파일 읽기)은 워커 스레드에서 수행한다.
+//  - UObject 생성, GPU 리소스 생성, 리소스 맵 등록(마무리 단계)만 게임 스레드에서 프레임 예산 안에서 처리한다.
+//  - 같은 타입/경로 요청은 하나로 합쳐지고, 더 높은 우선순위로 다시 요청하면 대기 중인 요청의 우선순위가 올라간다.
+//  - 핸들마다 취소할 수 있으며, 요청한 핸들이 모두 취소되면 읽은 데이터는 버린다.
+//  - 워커 단계가 없는 타입(셰이더, 머티리얼, 사운드 등)과 FBX 재임포트가 필요한 메시는
+//    마무리 단계에서 기존 동기 로드를 호출한다 (중복 제거, 우선순위, 프레임 예산은 동일하게 적용).
+// UResourceManager::LoadAsync를 통해 사용하며, 요청/취소/대기/마무리는 게임 스레드에서만 호출한다.
+// -----------------------------------------------------------------------------
+
+enum class EAssetLoadPriority : uint8
+{
+	Low,
+	Normal,
+	High,		// 레벨 로드 프리페치처럼 곧 동기 로드가 뒤따르는 요청
+};
+
+enum class EAssetLoadState : uint8
+{
+	Pending,			// 워커 대기열
+	Loading,			// 워커에서 읽는 중
+	ReadyToFinalize,	// 게임 스레드 마무리 대기
+	Completed,			// 리소스 맵에 등록됨 (요청이 끝난 뒤에도 핸들은 이 상태)
+	Canceled,			// 이 핸들이 취소됨 (다른 핸들이 남아 요청이 계속 진행되어도 이 상태)
+	Failed,				// 파일을 읽지 못했거나 리소스를 만들지 못함 (리소스 맵에 등록하지 않음)
+};
+
+// 완료 콜백. 실패하면 nullptr (취소된 핸들의 콜백은 호출되지 않음)
+using FOnAssetLoaded = TInlineDelegate<UResourceBase*>;
+
+// 요청 핸들. 요청이 끝나 정리된 뒤에도 값으로 들고 있어도 안전하다.
+struct FAssetLoadHandle
+{
+	uint64 RequestId = 0;	// 0이면 요청이 만들어지지 않음 (이미 로드되어 콜백을 바로 호출한 경우 포함)
+	uint32 ListenerId = 0;
+
+	bool IsValid() const { return RequestId != 0; }
+};
+
+// 워커 단계가 없는 요청을 마무리 단계에서 처리할 동기 로드 (UResourceManager::Load<T>)
+using FAssetSyncLoadFunc = UResourceBase* (*)(const FString& InFilePath);
+
+/**
+ * 엔진 리소스 타입 대신 호출자가 두 단계를 직접 지정하는 요청 (RequestCustom).
+ * 리소스 맵과 디바이스를 쓰지 않으므로 헤드리스 검사에서 워커 단계를 멈춰 두고
+ * 읽는 중인 요청의 중복 제거/취소/대기를 확인할 때 사용한다.
+ */
+struct FAssetCustomStages
+{
+	// 워커 스레드에서 호출 (Wait가 대기열에서 가져가면 그 스레드). false면 실패
+	bool (*LoadOnWorker)(const FString& InPath) = nullptr;
+	// 게임 스레드 마무리에서 호출. nullptr이면 실패
+	UResourceBase* (*Finalize)(const FString& InPath) = nullptr;
+};
+
+struct FAssetStreamingStats
+{
+	uint32 NumPending = 0;
+	uint32 NumLoading = 0;
+	uint32 NumReadyToFinalize = 0;
+	uint64 NumRequested = 0;		// LoadAsync 호출 수 (이미 로드된 리소스 제외)
+	uint64 NumDeduplicated = 0;		// 진행 중인 요청에 합쳐진 호출 수
+	uint64 NumCompleted = 0;
+	uint64 NumCanceled = 0;
+	uint64 NumFailed = 0;
+	uint64 NumSyncFallbacks = 0;	// 워커 단계 없이 마무리에서 동기 로드한 요청 수
+	double TotalWorkerMs = 0.0;
+	double TotalFinalizeMs = 0.0;
+	double TotalWaitMs = 0.0;		// 동기 로드가 진행 중인 요청을 기다린 시간 (게임 스레드)
+};
+
+class FAssetStreamingManager
+{
+public:
+	FAssetStreamingManager();
+	~FAssetStreamingManager();
+
+	FAssetStreamingManager(const FAssetStreamingManager&) = delete;
+	FAssetStreamingManager& operator=(const FAssetStreamingManager&) = delete;
+
+	/**
+	 * 요청 추가. 같은 타입/키의 요청이 진행 중이면 리스너만 추가한다.
+	 * @param InKey          리소스 맵 키 (UResourceManager::MakeResourceKey)
+	 * @param InSyncLoad     워커 단계가 없을 때 마무리에서 호출할 동기 로드
+	 */
+	FAssetLoadHandle Request(EResourceType InType, const FString& InNormalizedPath, const FString& InKey, bool bInSRGB,
+		EAssetLoadPriority InPriority, FAssetSyncLoadFunc InSyncLoad, FOnAssetLoaded&& InOnLoaded);
+
+	// 단계를 직접 지정한 요청. 같은 키의 다른 RequestCustom 요청과만 합쳐진다 (InKey는 경로로도 전달)
+	FAssetLoadHandle RequestCustom(const FString& InKey, const FAssetCustomStages& InStages,
+		EAssetLoadPriority InPriority, FOnAssetLoaded&& InOnLoaded);
+
+	/**
+	 * 핸들 하나의 관심을 거둔다. 남은 핸들이 없으면 요청 자체를 취소
+	 * @return 핸들의 최종 상태 (이미 끝난 핸들이면 Completed/Failed, 아니면 Canceled)
+	 */
+	EAssetLoadState Cancel(const FAssetLoadHandle& Handle);
+
+	EAssetLoadState GetState(const FAssetLoadHandle& Handle) const;
+
+	// 핸들의 상태를 더 조회하지 않을 때 호출. 남겨 둔 취소/실패 기록을 지운다
+	// (진행 중이면 요청과 콜백은 그대로 진행되고, 이후 GetState는 끝난 핸들을 Completed로 답함)
+	void Release(const FAssetLoadHandle& Handle);
+
+	// 요청이 끝날 때까지 게임 스레드에서 대기하고 마무리까지 수행 (대기열에 있으면 바로 이 스레드에서 읽는다)
+	void Wait(const FAssetLoadHandle& Handle);
+
+	// 같은 타입/키로 진행 중인 요청이 있으면 끝까지 처리하고 true (동기 Load가 중복으로 읽지 않게 할 때 사용)
+	bool WaitForKey(EResourceType InType, const FString& InKey);
+
+	// 진행 중인 요청이 하나라도 있는지 (동기 Load의 빠른 판단용, 락 없음)
+	bool HasInFlightRequests() const { return NumInFlight.load(std::memory_order_acquire) > 0; }
+
+	/**
+	 * 워커가 끝낸 요청을 우선순위 순으로 마무리한다. 매 프레임 게임 스레드에서 호출
+	 * 최소 한 건은 처리하고, 이후에는 BudgetMs를 넘기면 다음 프레임으로 미룬다.
+	 */
+	void ProcessCompleted(double BudgetMs);
+
+	// 모든 요청을 끝까지 처리 (레벨 전환, 종료 직전)
+	void Flush();
+
+	// 워커 종료. 대기 중인 요청은 취소되고 읽은 데이터는 버린다.
+	void Shutdown();
+
+	FAssetStreamingStats GetStats() const;
+
+private:
+	FAssetLoadHandle AddRequest(EResourceType InType, const FString& InNormalizedPath, const FString& InKey, bool bInSRGB,
+		EAssetLoadPriority InPriority, FAssetSyncLoadFunc InSyncLoad, const FAssetCustomStages* InCustomStages, FOnAssetLoaded&& InOnLoaded);
+
+	void StartWorkers();
+	void WorkerMain(int32 WorkerIndex);
+
+	// 대기열에서 우선순위가 가장 높은 요청을 꺼낸다 (Mutex 보유 상태에서 호출)
+	FAssetLoadRequest* PopHighestPriority(TArray<FAssetLoadRequest*>& Queue);
+
+	// 워커 단계: 파일 읽기와 파싱
+	void ExecuteLoad(FAssetLoadRequest& Request);
+
+	// 게임 스레드 단계: UObject/GPU 리소스 생성, 리소스 맵 등록, 콜백 호출 후 요청 삭제
+	void FinalizeRequest(FAssetLoadRequest* Request);
+
+	// 마무리 단계의 리소스 생성과 등록 (워커 결과 또는 동기 로드). 실패하면 nullptr
+	static UResourceBase* CreateResource(FAssetLoadRequest& Request, bool& bOutSyncFallback);
+
+	// 워커 단계 결과를 버린다 (취소, 종료)
+	static void DiscardPayload(FAssetLoadRequest& Request);
+
+	FAssetLoadRequest* FindRequest(uint64 RequestId) const;
+	void RemoveRequest(FAssetLoadRequest* Request);
+
+	// 요청이 정리된 핸들의 상태 (Mutex 보유 상태에서 호출)
+	EAssetLoadState GetFinishedState(uint32 ListenerId) const;
+
+private:
+	mutable std::mutex Mutex;
+	std::condition_variable WorkCondition;		// 워커 깨우기
+	std::condition_variable ReadyCondition;		// Wait 중인 게임 스레드 깨우기
+
+	TArray<std::thread> Workers;
+	bool bStopRequested = false;
+
+	TMap<uint64, FAssetLoadRequest*> Requests;			// 진행 중인 모든 요청
+	TArray<TMap<FString, FAssetLoadRequest*>> RequestsByKey;	// 리소스 타입별 키 -> 요청 (중복 제거)
+	TArray<FAssetLoadRequest*> PendingQueue;
+	TArray<FAssetLoadRequest*> ReadyQueue;
+	uint32 NumLoading = 0;
+
+	// 취소되었거나 실패한 핸들 (요청이 정리된 뒤 GetState가 Completed로 답하지 않도록).
+	// 성공한 핸들은 기록하지 않으므로 여기 없는 끝난 핸들은 Completed. Release한 핸들은 기록하지 않는다
+	TMap<uint32, EAssetLoadState> FinishedListenerStates;
+
+	uint64 NextRequestId = 1;
+	uint32 NextListenerId = 1;
+	uint64 NextSequence = 0;
+	std::atomic<int32> NumInFlight{ 0 };
+
+	FAssetStreamingStats Stats;
+};
@@ -0,0 +1,532 @@
+﻿#include "pch.h"
+#include "AssetStreamingTests.h"
+#include "AssetStreaming.h"
+#include "ResourceBase.h"
+#include "TestContext.h"
+#include <chrono>
+#include <condition_variable>
+#include <mutex>
+#include <thread>
+
+namespace
+{
+	// 엔진 리소스 키와 겹치지 않는 경로
+	//  - "Missing"이 들어가면 워커 단계가 실패
+	//  - "Blocking"이 들어가면 워커 단계가 래치가 열릴 때까지 멈춤 (읽는 중인 요청을 만들 때 사용)
+	constexpr const char* TestPathPrefix = "__AssetStreamingTest/";
+
+	// 워커 단계 기록 (워커 스레드에서 쓰므로 락 보호)
+	std::mutex LoadMutex;
+	std::condition_variable LatchCondition;
+	bool bLatchOpen = true;
+	int32 NumBlocked = 0;
+	TMap<FString, int32> WorkerLoadCounts;
+	TMap<FString, std::thread::id> WorkerLoadThreads;
+
+	// 마무리 기록 (게임 스레드에서만 호출되므로 락 없음)
+	TMap<FString, int32> FinalizeCounts;
+	TArray<UResourceBase*> CreatedResources;
+
+	bool TestLoadOnWorker(const FString& InPath)
+	{
+		std::unique_lock<std::mutex> Lock(LoadMutex);
+		++WorkerLoadCounts[InPath];
+		WorkerLoadThreads[InPath] = std::this_thread::get_id();
+		if (InPath.find("Blocking") != FString::npos)
+		{
+			++NumBlocked;
+			LatchCondition.notify_all();
+			LatchCondition.wait(Lock, []() { return bLatchOpen; });
+			--NumBlocked;
+		}
+		return InPath.find("Missing") == FString::npos;
+	}
+
+	UResourceBase* TestFinalize(const FString& InPath)
+	{
+		++FinalizeCounts[InPath];
+		UResourceBase* Resource = NewObject<UResourceBase>();
+		Resource->SetFilePath(InPath);
+		CreatedResources.Add(Resource);
+		return Resource;
+	}
+
+	const FAssetCustomStages TestStages = { &TestLoadOnWorker, &TestFinalize };
+
+	void CloseLatch()
+	{
+		std::lock_guard<std::mutex> Lock(LoadMutex);
+		bLatchOpen = false;
+	}
+
+	void OpenLatch()
+	{
+		{
+			std::lock_guard<std::mutex> Lock(LoadMutex);
+			bLatchOpen = true;
+		}
+		LatchCondition.notify_all();
+	}
+
+	// 워커 Count개가 래치에서 멈출 때까지 대기. 시간 초과면 래치를 열고 false
+	bool WaitForBlockedLoads(int32 Count)
+	{
+		std::unique_lock<std::mutex> Lock(LoadMutex);
+		if (LatchCondition.wait_for(Lock, std::chrono::seconds(5), [Count]() { return NumBlocked >= Count; }))
+		{
+			return true;
+		}
+		bLatchOpen = true;
+		LatchCondition.notify_all();
+		return false;
+	}
+
+	// 게임 스레드가 Wait 안에서 막혀 있는 동안 래치를 열어 줄 스레드
+	std::thread OpenLatchLater()
+	{
+		return std::thread([]()
+		{
+			std::this_thread::sleep_for(std::chrono::milliseconds(20));
+			OpenLatch();
+		});
+	}
+
+	int32 GetWorkerLoadCount(const FString& InPath)
+	{
+		std::lock_guard<std::mutex> Lock(LoadMutex);
+		const int32* Count = WorkerLoadCounts.Find(InPath);
+		return Count ? *Count : 0;
+	}
+
+	bool LoadedOnThread(const FString& InPath, std::thread::id ThreadId)
+	{
+		std::lock_guard<std::mutex> Lock(LoadMutex);
+		const std::thread::id* Found = WorkerLoadThreads.Find(InPath);
+		return Found && *Found == ThreadId;
+	}
+
+	int32 GetFinalizeCount(const FString& InPath)
+	{
+		const int32* Count = FinalizeCounts.Find(InPath);
+		return Count ? *Count : 0;
+	}
+
+	void ResetTestResources()
+	{
+		for (UResourceBase* Resource : CreatedResources)
+		{
+			ObjectFactory::DeleteObject(Resource);
+		}
+		CreatedResources.Empty();
+		FinalizeCounts.Empty();
+
+		std::lock_guard<std::mutex> Lock(LoadMutex);
+		WorkerLoadCounts.Empty();
+		WorkerLoadThreads.Empty();
+		bLatchOpen = true;
+	}
+
+	// 핸들 하나의 콜백 기록. 콜백이 포인터를 잡으므로 요청 전에 배열 크기를 정해 둔다
+	struct FLoadRecord
+	{
+		FString Path;
+		FAssetLoadHandle Handle;
+		int32 CallCount = 0;
+		UResourceBase* Result = nullptr;
+		bool bCanceled = false;
+	};
+
+	FString MakeTestPath(const char* Name)
+	{
+		return FString(TestPathPrefix) + Name;
+	}
+
+	void RequestRecord(FAssetStreamingManager& Streaming, FLoadRecord& Record, const FString& InPath,
+		EAssetLoadPriority InPriority = EAssetLoadPriority::Normal)
+	{
+		Record.Path = InPath;
+		FLoadRecord* RecordPtr = &Record;
+		Record.Handle = Streaming.RequestCustom(InPath, TestStages, InPriority,
+			[RecordPtr](UResourceBase* Resource)
+			{
+				++RecordPtr->CallCount;
+				RecordPtr->Result = Resource;
+			});
+	}
+
+	const char* ToString(EAssetLoadState State)
+	{
+		switch (State)
+		{
+		case EAssetLoadState::Pending:			return "Pending";
+		case EAssetLoadState::Loading:			return "Loading";
+		case EAssetLoadState::ReadyToFinalize:	return "ReadyToFinalize";
+		case EAssetLoadState::Completed:		return "Completed";
+		case EAssetLoadState::Canceled:			return "Canceled";
+		case EAssetLoadState::Failed:			return "Failed";
+		}
+		return "?";
+	}
+
+	bool IsInFlight(EAssetLoadState State)
+	{
+		return State == EAssetLoadState::Pending || State == EAssetLoadState::Loading || State == EAssetLoadState::ReadyToFinalize;
+	}
+
+	void TestSameAssetDedupe(FTestContext& Context)
+	{
+		FAssetStreamingManager Streaming;
+		const FString Path = MakeTestPath("Shared");
+
+		TArray<FLoadRecord> Records;
+		Records.SetNum(3);
+		RequestRecord(Streaming, Records[0], Path, EAssetLoadPriority::Low);
+		RequestRecord(Streaming, Records[1], Path, EAssetLoadPriority::Normal);
+		RequestRecord(Streaming, Records[2], Path, EAssetLoadPriority::High);
+
+		TEST_CHECK(Context, Records[0].Handle.IsValid());
+		TEST_CHECK(Context, Records[0].Handle.RequestId == Records[1].Handle.RequestId && Records[1].Handle.RequestId == Records[2].Handle.RequestId);
+		TEST_CHECK(Context, Records[0].Handle.ListenerId != Records[1].Handle.ListenerId && Records[1].Handle.ListenerId != Records[2].Handle.ListenerId);
+
+		Streaming.Flush();
+
+		const FAssetStreamingStats Stats = Streaming.GetStats();
+		Context.Check(Stats.NumRequested == 3 && Stats.NumDeduplicated == 2 && Stats.NumCompleted == 1,
+			"dedupe: %llu requested / %llu deduplicated / %llu completed, expected 3 / 2 / 1",
+			Stats.NumRequested, Stats.NumDeduplicated, Stats.NumCompleted);
+		Context.Check(GetWorkerLoadCount(Path) == 1 && GetFinalizeCount(Path) == 1, "dedupe: read %d / finalized %d times, expected once",
+			GetWorkerLoadCount(Path), GetFinalizeCount(Path));
+
+		for (const FLoadRecord& Record : Records)
+		{
+			Context.Check(Record.CallCount == 1 && Record.Result && Record.Result == Records[0].Result,
+				"dedupe: listener %u called %d times with %p (first listener got %p)",
+				Record.Handle.ListenerId, Record.CallCount, Record.Result, Records[0].Result);
+			const EAssetLoadState State = Streaming.GetState(Record.Handle);
+			Context.Check(State == EAssetLoadState::Completed, "dedupe: listener %u is %s, expected Completed", Record.Handle.ListenerId, ToString(State));
+		}
+		ResetTestResources();
+	}
+
+	void TestCancelOneMergedHandle(FTestContext& Context)
+	{
+		FAssetStreamingManager Streaming;
+		const FString Path = MakeTestPath("CancelOne");
+
+		TArray<FLoadRecord> Records;
+		Records.SetNum(2);
+		RequestRecord(Streaming, Records[0], Path);
+		RequestRecord(Streaming, Records[1], Path);
+
+		TEST_CHECK(Context, Streaming.Cancel(Records[0].Handle) == EAssetLoadState::Canceled);
+		TEST_CHECK(Context, Streaming.Cancel(Records[0].Handle) == EAssetLoadState::Canceled);
+		const EAssetLoadState KeptState = Streaming.GetState(Records[1].Handle);
+		Context.Check(Streaming.GetState(Records[0].Handle) == EAssetLoadState::Canceled, "cancel one: canceled handle is %s", ToString(Streaming.GetState(Records[0].Handle)));
+		Context.Check(IsInFlight(KeptState), "cancel one: remaining handle is %s, expected in flight", ToString(KeptState));
+
+		Streaming.Flush();
+
+		Context.Check(Records[0].CallCount == 0, "cancel one: canceled handle's callback ran %d times", Records[0].CallCount);
+		Context.Check(Records[1].CallCount == 1 && Records[1].Result, "cancel one: remaining handle called %d times with %p", Records[1].CallCount, Records[1].Result);
+		Context.Check(Streaming.GetState(Records[0].Handle) == EAssetLoadState::Canceled,
+			"cancel one: canceled handle reports %s after the request finished", ToString(Streaming.GetState(Records[0].Handle)));
+		TEST_CHECK(Context, Streaming.GetState(Records[1].Handle) == EAssetLoadState::Completed);
+
+		// 끝난 핸들을 취소하면 최종 상태를 그대로 돌려준다
+		TEST_CHECK(Context, Streaming.Cancel(Records[1].Handle) == EAssetLoadState::Completed);
+		TEST_CHECK(Context, Streaming.GetStats().NumCanceled == 0);
+
+		// Release하면 취소 기록이 지워진다
+		Streaming.Release(Records[0].Handle);
+		TEST_CHECK(Context, Streaming.GetState(Records[0].Handle) == EAssetLoadState::Completed);
+		ResetTestResources();
+	}
+
+	void TestCancelAllHandles(FTestContext& Context)
+	{
+		FAssetStreamingManager Streaming;
+		const FString Path = MakeTestPath("CancelAll");
+
+		TArray<FLoadRecord> Records;
+		Records.SetNum(3);
+		RequestRecord(Streaming, Records[0], Path);
+		RequestRecord(Streaming, Records[1], Path);
+		Streaming.Cancel(Records[0].Handle);
+		Streaming.Cancel(Records[1].Handle);
+
+		TEST_CHECK(Context, Streaming.GetState(Records[0].Handle) == EAssetLoadState::Canceled);
+		TEST_CHECK(Context, Streaming.GetState(Records[1].Handle) == EAssetLoadState::Canceled);
+
+		Streaming.Flush();
+
+		Context.Check(Records[0].CallCount == 0 && Records[1].CallCount == 0, "cancel all: callbacks ran %d / %d times", Records[0].CallCount, Records[1].CallCount);
+		Context.Check(GetFinalizeCount(Path) == 0, "cancel all: canceled request was finalized %d times", GetFinalizeCount(Path));
+		Context.Check(Streaming.GetStats().NumCanceled == 1, "cancel all: %llu canceled requests, expected 1", Streaming.GetStats().NumCanceled);
+		TEST_CHECK(Context, Streaming.GetState(Records[0].Handle) == EAssetLoadState::Canceled);
+		TEST_CHECK(Context, Streaming.Cancel(Records[1].Handle) == EAssetLoadState::Canceled);
+
+		// 모두 취소한 뒤 다시 요청하면 새 핸들만 콜백을 받는다
+		RequestRecord(Streaming, Records[2], Path);
+		Streaming.Flush();
+		Context.Check(Records[2].CallCount == 1 && Records[2].Result, "cancel all: new request after cancel called %d times with %p", Records[2].CallCount, Records[2].Result);
+		TEST_CHECK(Context, Records[0].CallCount == 0 && Records[1].CallCount == 0);
+		TEST_CHECK(Context, Streaming.GetState(Records[2].Handle) == EAssetLoadState::Completed);
+		TEST_CHECK(Context, Streaming.GetState(Records[0].Handle) == EAssetLoadState::Canceled);
+		ResetTestResources();
+	}
+
+	void TestFailedLoad(FTestContext& Context)
+	{
+		FAssetStreamingManager Streaming;
+		const FString Path = MakeTestPath("Missing");
+
+		TArray<FLoadRecord> Records;
+		Records.SetNum(2);
+		RequestRecord(Streaming, Records[0], Path);
+		RequestRecord(Streaming, Records[1], Path);
+		Streaming.Flush();
+
+		for (const FLoadRecord& Record : Records)
+		{
+			Context.Check(Record.CallCount == 1 && Record.Result == nullptr, "failed load: listener %u called %d times with %p, expected once with nullptr",
+				Record.Handle.ListenerId, Record.CallCount, Record.Result);
+			const EAssetLoadState State = Streaming.GetState(Record.Handle);
+			Context.Check(State == EAssetLoadState::Failed, "failed load: listener %u is %s, expected Failed", Record.Handle.ListenerId, ToString(State));
+		}
+		TEST_CHECK(Context, Streaming.Cancel(Records[0].Handle) == EAssetLoadState::Failed);
+		TEST_CHECK(Context, GetFinalizeCount(Path) == 0);
+
+		const FAssetStreamingStats Stats = Streaming.GetStats();
+		Context.Check(Stats.NumFailed == 1 && Stats.NumCompleted == 0, "failed load: %llu failed / %llu completed, expected 1 / 0", Stats.NumFailed, Stats.NumCompleted);
+
+		// 요청 중에 Release한 핸들은 실패해도 기록이 남지 않는다
+		FLoadRecord Released;
+		RequestRecord(Streaming, Released, MakeTestPath("ReleasedMissing"));
+		Streaming.Release(Released.Handle);
+		Streaming.Flush();
+		TEST_CHECK(Context, Released.CallCount == 1 && Released.Result == nullptr);
+		TEST_CHECK(Context, Streaming.GetState(Released.Handle) == EAssetLoadState::Completed);
+		ResetTestResources();
+	}
+
+	void TestRequestsWhileLoading(FTestContext& Context)
+	{
+		// 워커 단계를 래치로 멈춰 두고, 읽는 중(Loading)인 요청에 합류/취소/대기한다
+		FAssetStreamingManager Streaming;
+		const std::thread::id GameThreadId = std::this_thread::get_id();
+		TArray<FLoadRecord> Records;
+		Records.SetNum(8);
+
+		// 1) 읽는 중에 합류하고 한 핸들을 취소한 뒤, 게임 스레드가 Wait로 워커를 기다려 마무리
+		{
+			const FString Path = MakeTestPath("Blocking_Merge");
+			CloseLatch();
+			RequestRecord(Streaming, Records[0], Path);
+			if (!Context.Check(WaitForBlockedLoads(1), "while loading: worker never started %s", Path.c_str()))
+			{
+				Streaming.Flush();
+				ResetTestResources();
+				return;
+			}
+			TEST_CHECK(Context, Streaming.GetState(Records[0].Handle) == EAssetLoadState::Loading);
+
+			RequestRecord(Streaming, Records[1], Path);
+			TEST_CHECK(Context, Records[1].Handle.RequestId == Records[0].Handle.RequestId);
+			TEST_CHECK(Context, Streaming.GetState(Records[1].Handle) == EAssetLoadState::Loading);
+			TEST_CHECK(Context, Streaming.Cancel(Records[0].Handle) == EAssetLoadState::Canceled);
+			TEST_CHECK(Context, Streaming.GetState(Records[1].Handle) == EAssetLoadState::Loading);
+
+			std::thread Opener = OpenLatchLater();
+			Streaming.Wait(Records[1].Handle);
+			Opener.join();
+
+			Context.Check(Records[1].CallCount == 1 && Records[1].Result, "while loading: waited handle called %d times with %p", Records[1].CallCount, Records[1].Result);
+			Context.Check(Records[0].CallCount == 0, "while loading: canceled handle called %d times", Records[0].CallCount);
+			Context.Check(GetWorkerLoadCount(Path) == 1, "while loading: Wait read the file again (%d reads)", GetWorkerLoadCount(Path));
+			Context.Check(!LoadedOnThread(Path, GameThreadId), "while loading: worker stage ran on the game thread");
+			TEST_CHECK(Context, Streaming.GetState(Records[0].Handle) == EAssetLoadState::Canceled);
+			TEST_CHECK(Context, Streaming.GetState(Records[1].Handle) == EAssetLoadState::Completed);
+		}
+
+		// 2) 읽는 중에 모든 핸들을 취소한 뒤 다시 요청하면 같은 요청이 되살아난다
+		{
+			const FString Path = MakeTestPath("Blocking_Revive");
+			CloseLatch();
+			RequestRecord(Streaming, Records[2], Path);
+			Context.Check(WaitForBlockedLoads(1), "revive: worker never started %s", Path.c_str());
+			TEST_CHECK(Context, Streaming.Cancel(Records[2].Handle) == EAssetLoadState::Canceled);
+			RequestRecord(Streaming, Records[3], Path);
+			TEST_CHECK(Context, Records[3].Handle.RequestId == Records[2].Handle.RequestId);
+			TEST_CHECK(Context, Streaming.GetState(Records[3].Handle) == EAssetLoadState::Loading);
+			OpenLatch();
+			Streaming.Flush();
+
+			Context.Check(Records[2].CallCount == 0 && Records[3].CallCount == 1, "revive: callbacks ran %d / %d times, expected 0 / 1", Records[2].CallCount, Records[3].CallCount);
+			TEST_CHECK(Context, GetWorkerLoadCount(Path) == 1);
+			TEST_CHECK(Context, Streaming.GetState(Records[2].Handle) == EAssetLoadState::Canceled);
+			TEST_CHECK(Context, Streaming.GetState(Records[3].Handle) == EAssetLoadState::Completed);
+			TEST_CHECK(Context, Streaming.GetStats().NumCanceled == 0);
+		}
+
+		// 3) 읽는 중에 모두 취소하면 워커가 끝낸 결과를 버린다
+		{
+			const FString Path = MakeTestPath("Blocking_Discard");
+			CloseLatch();
+			RequestRecord(Streaming, Records[4], Path);
+			Context.Check(WaitForBlockedLoads(1), "discard: worker never started %s", Path.c_str());
+			TEST_CHECK(Context, Streaming.Cancel(Records[4].Handle) == EAssetLoadState::Canceled);
+			TEST_CHECK(Context, Streaming.HasInFlightRequests());
+			OpenLatch();
+			Streaming.Flush();
+
+			Context.Check(Records[4].CallCount == 0 && GetFinalizeCount(Path) == 0, "discard: callback ran %d times, finalized %d times",
+				Records[4].CallCount, GetFinalizeCount(Path));
+			TEST_CHECK(Context, Streaming.GetStats().NumCanceled == 1);
+			TEST_CHECK(Context, Streaming.GetState(Records[4].Handle) == EAssetLoadState::Canceled);
+		}
+
+		// 4) 동기 로드처럼 키로 기다리면 읽는 중인 요청을 끝까지 처리한다
+		{
+			const FString Path = MakeTestPath("Blocking_Key");
+			CloseLatch();
+			RequestRecord(Streaming, Records[5], Path);
+			Context.Check(WaitForBlockedLoads(1), "wait for key: worker never started %s", Path.c_str());
+
+			std::thread Opener = OpenLatchLater();
+			const bool bWaited = Streaming.WaitForKey(EResourceType::None, Path);
+			Opener.join();
+
+			TEST_CHECK(Context, bWaited);
+			Context.Check(Records[5].CallCount == 1 && Records[5].Result, "wait for key: callback ran %d times with %p", Records[5].CallCount, Records[5].Result);
+			TEST_CHECK(Context, !Streaming.WaitForKey(EResourceType::None, Path));
+		}
+
+		// 5) 워커가 모두 막혀 있으면 Wait는 대기열의 요청을 게임 스레드에서 직접 읽는다
+		//    (워커는 최대 4개이고, 낮은 우선순위 요청은 막힌 요청들보다 늦게 꺼내지므로 대기열에 남는다)
+		{
+			constexpr int32 NumBlockingLoads = 8;
+			TArray<FLoadRecord> Blocking;
+			Blocking.SetNum(NumBlockingLoads);
+			CloseLatch();
+			for (int32 Index = 0; Index < NumBlockingLoads; ++Index)
+			{
+				char Name[64];
+				snprintf(Name, sizeof(Name), "Blocking_Fill%d", Index);
+				RequestRecord(Streaming, Blocking[Index], MakeTestPath(Name));
+			}
+			Context.Check(WaitForBlockedLoads(1), "pending wait: no worker started");
+
+			const FString Path = MakeTestPath("QueuedBehindBlocked");
+			RequestRecord(Streaming, Records[6], Path, EAssetLoadPriority::Low);
+			const EAssetLoadState QueuedState = Streaming.GetState(Records[6].Handle);
+			Context.Check(QueuedState == EAssetLoadState::Pending, "pending wait: queued request is %s, expected Pending", ToString(QueuedState));
+
+			Streaming.Wait(Records[6].Handle);
+			Context.Check(Records[6].CallCount == 1 && Records[6].Result, "pending wait: callback ran %d times with %p", Records[6].CallCount, Records[6].Result);
+			Context.Check(LoadedOnThread(Path, GameThreadId), "pending wait: queued request was not read on the waiting thread");
+
+			OpenLatch();
+			Streaming.Flush();
+			int32 BadBlocking = 0;
+			for (const FLoadRecord& Record : Blocking)
+			{
+				BadBlocking += (Record.CallCount == 1 && Record.Result) ? 0 : 1;
+			}
+			Context.Check(BadBlocking == 0, "pending wait: %d blocked requests did not finish", BadBlocking);
+		}
+
+		ResetTestResources();
+	}
+
+	void TestConcurrentLoads(FTestContext& Context)
+	{
+		// 서로 다른 에셋을 워커 여러 개가 동시에 처리하는 동안 같은 에셋을 겹쳐 요청하고 일부를 취소한다.
+		// 에셋 i: 핸들 3개, i % 4 == 0이면 모두 취소, i % 4 == 1이면 첫 핸들만 취소, i % 8 == 2이면 로드 실패
+		constexpr int32 NumAssets = 64;
+		constexpr int32 HandlesPerAsset = 3;
+
+		FAssetStreamingManager Streaming;
+		TArray<FLoadRecord> Records;
+		Records.SetNum(NumAssets * HandlesPerAsset);
+
+		for (int32 AssetIndex = 0; AssetIndex < NumAssets; ++AssetIndex)
+		{
+			char Name[64];
+			snprintf(Name, sizeof(Name), AssetIndex % 8 == 2 ? "Concurrent%d_Missing" : "Concurrent%d", AssetIndex);
+			const FString Path = MakeTestPath(Name);
+
+			FLoadRecord* AssetRecords = &Records[AssetIndex * HandlesPerAsset];
+			for (int32 HandleIndex = 0; HandleIndex < HandlesPerAsset; ++HandleIndex)
+			{
+				RequestRecord(Streaming, AssetRecords[HandleIndex], Path, static_cast<EAssetLoadPriority>(HandleIndex));
+			}
+
+			const int32 NumToCancel = AssetIndex % 4 == 0 ? HandlesPerAsset : (AssetIndex % 4 == 1 ? 1 : 0);
+			for (int32 HandleIndex = 0; HandleIndex < NumToCancel; ++HandleIndex)
+			{
+				Streaming.Cancel(AssetRecords[HandleIndex].Handle);
+				AssetRecords[HandleIndex].bCanceled = true;
+			}
+
+			// 워커가 끝낸 요청 일부를 요청 도중에 마무리 (에셋 단위로 끊어서 같은 에셋이 두 번 로드되지 않게)
+			Streaming.ProcessCompleted(0.0);
+		}
+		Streaming.Flush();
+
+		int32 BadCallbacks = 0;
+		int32 BadStates = 0;
+		int32 BadDedupe = 0;
+		for (int32 AssetIndex = 0; AssetIndex < NumAssets; ++AssetIndex)
+		{
+			const FLoadRecord* AssetRecords = &Records[AssetIndex * HandlesPerAsset];
+			const bool bAllCanceled = AssetIndex % 4 == 0;
+			const bool bMissing = AssetIndex % 8 == 2;
+
+			// 모두 취소된 요청은 워커가 이미 읽었을 수 있지만 마무리되지는 않음
+			if (GetWorkerLoadCount(AssetRecords[0].Path) > 1 || GetFinalizeCount(AssetRecords[0].Path) != (bAllCanceled || bMissing ? 0 : 1))
+			{
+				++BadDedupe;
+			}
+
+			for (int32 HandleIndex = 0; HandleIndex < HandlesPerAsset; ++HandleIndex)
+			{
+				const FLoadRecord& Record = AssetRecords[HandleIndex];
+				const FLoadRecord& Last = AssetRecords[HandlesPerAsset - 1];
+				if (Record.Handle.RequestId != AssetRecords[0].Handle.RequestId)
+				{
+					++BadDedupe;
+				}
+
+				const bool bCallbackOk = Record.bCanceled
+					? Record.CallCount == 0
+					: (Record.CallCount == 1 && (bMissing ? Record.Result == nullptr : Record.Result != nullptr) && Record.Result == Last.Result);
+				BadCallbacks += bCallbackOk ? 0 : 1;
+
+				const EAssetLoadState Expected = Record.bCanceled ? EAssetLoadState::Canceled : (bMissing ? EAssetLoadState::Failed : EAssetLoadState::Completed);
+				BadStates += Streaming.GetState(Record.Handle) == Expected ? 0 : 1;
+			}
+		}
+		Context.Check(BadDedupe == 0, "concurrent: %d assets were loaded more than once or split across requests", BadDedupe);
+		Context.Check(BadCallbacks == 0, "concurrent: %d handles got the wrong callbacks", BadCallbacks);
+		Context.Check(BadStates == 0, "concurrent: %d handles report the wrong final state", BadStates);
+
+		const FAssetStreamingStats Stats = Streaming.GetStats();
+		Context.Check(Stats.NumDeduplicated == NumAssets * (HandlesPerAsset - 1), "concurrent: %llu deduplicated, expected %d",
+			Stats.NumDeduplicated, NumAssets * (HandlesPerAsset - 1));
+		Context.Check(Stats.NumCanceled == NumAssets / 4 && Stats.NumFailed == NumAssets / 8 && Stats.NumCompleted == NumAssets - NumAssets / 4 - NumAssets / 8,
+			"concurrent: %llu canceled / %llu failed / %llu completed", Stats.NumCanceled, Stats.NumFailed, Stats.NumCompleted);
+		Context.Check(Stats.NumPending == 0 && Stats.NumLoading == 0 && Stats.NumReadyToFinalize == 0 && !Streaming.HasInFlightRequests(),
+			"concurrent: requests left in flight after Flush");
+		ResetTestResources();
+	}
+}
+
+void FAssetStreamingTests::Run(FTestContext& Context)
+{
+	TestSameAssetDedupe(Context);
+	TestCancelOneMergedHandle(Context);
+	TestCancelAllHandles(Context);
+	TestFailedLoad(Context);
+	TestRequestsWhileLoading(Context);
+	TestConcurrentLoads(Context);
+}
@@ -0,0 +1,13 @@
+﻿#pragma once
+
+struct FTestContext;
+
+// 콘솔 명령 "TEST STREAMING"에서 사용
+namespace FAssetStreamingTests
+{
+	// 별도의 FAssetStreamingManager로 같은 에셋/다른 에셋을 동시에 요청해 중복 제거, 핸들별 취소,
+	// 실패한 로드와 GetState/Cancel이 돌려주는 최종 상태를 확인하고, 워커 단계를 래치로 멈춰 두고
+	// 읽는 중인 요청에 합류/취소/Wait/WaitForKey 하는 경로를 확인합니다.
+	// 테스트용 단계(RequestCustom)를 사용하므로 파일과 GPU 디바이스가 필요 없습니다.
+	void Run(FTestContext& Context);
+}
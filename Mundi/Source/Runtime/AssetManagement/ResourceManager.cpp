@@ -54,12 +54,15 @@ void UResourceManager::Initialize(ID3D11Device* InDevice, ID3D11DeviceContext* I
     UParticleAsset::LoadAllDatas();
 
     // 파티클 인스턴스 버퍼 초기화
-    FParticleInstanceBufferManager::Get().Initialize(10000);
+    FParticleInstanceBufferManager::Get().Initialize();
 }
 
 // 전체 해제
 void UResourceManager::Clear()
 {
+    // 워커가 리소스 맵/캐시를 건드리지 않도록 비동기 로드부터 정리
+    AssetStreaming.Shutdown();
+
     // 파티클 인스턴스 버퍼 해제
     FParticleInstanceBufferManager::Get().Release();
 
@@ -134,6 +137,7 @@ void UResourceManager::Clear()
 
 FMeshBVH* UResourceManager::GetMeshBVH(const FString& ObjPath)
 {
+    std::lock_guard<std::mutex> Lock(MeshBVHCacheMutex);
     if (auto* Found = MeshBVHCache.Find(ObjPath))
         return *Found;
     return nullptr;
@@ -141,6 +145,7 @@ FMeshBVH* UResourceManager::GetMeshBVH(const FString& ObjPath)
 
 FMeshBVH* UResourceManager::GetOrBuildMeshBVH(const FString& ObjPath, const FStaticMesh* StaticMeshAsset)
 {
+    std::lock_guard<std::mutex> Lock(MeshBVHCacheMutex);
     if (auto* Found = MeshBVHCache.Find(ObjPath))
         return *Found;
 
@@ -535,6 +540,7 @@ void UResourceManager::InitShaderILMap()
     layout.clear();
     
     ShaderToInputLayoutMap["Shaders/Utility/FullScreenTriangle_VS.hlsl"] = {};  // FullScreenTriangle 는 InputLayout을 사용하지 않는다
+    ShaderToInputLayoutMap["Shaders/Shadows/ShadowRegionClear.hlsl"] = {};     // SV_VertexID 로 사각형을 만드므로 InputLayout 불필요
 }
 
 TArray<D3D11_INPUT_ELEMENT_DESC>& UResourceManager::GetProperInputLayout(const FString& InShaderName)
@@ -10,6 +10,8 @@
 #include "../Engine/Audio/Sound.h"
 #include "Quad.h"
 #include "LineDynamicMesh.h"
+#include "AssetStreaming.h"
+#include <mutex>
 
 #pragma once
 #include "ObjectFactory.h"
@@ -69,6 +71,25 @@ public:
 	template<typename T>
 	EResourceType GetResourceType();
 
+	// 리소스 맵 키 (정규화 경로에서 확장자를 뗀 문자열)
+	static FString MakeResourceKey(const FString& InFilePath);
+
+	// --- 비동기 로드 (게임 스레드에서만 호출) ---
+	// 파일 읽기/파싱은 워커에서, 생성과 등록은 ProcessAsyncLoads에서 수행한다. 이미 로드되어 있으면 콜백을 바로 호출한다.
+	template<typename T>
+	FAssetLoadHandle LoadAsync(const FString& InFilePath, EAssetLoadPriority InPriority = EAssetLoadPriority::Normal, TInlineDelegate<T*> InOnLoaded = nullptr);
+	FAssetLoadHandle LoadTextureAsync(const FString& InFilePath, bool bSRGB, EAssetLoadPriority InPriority = EAssetLoadPriority::Normal, TInlineDelegate<UTexture*> InOnLoaded = nullptr);
+
+	EAssetLoadState CancelAsyncLoad(const FAssetLoadHandle& Handle) { return AssetStreaming.Cancel(Handle); }
+	EAssetLoadState GetAsyncLoadState(const FAssetLoadHandle& Handle) const { return AssetStreaming.GetState(Handle); }
+	void ReleaseAsyncLoad(const FAssetLoadHandle& Handle) { AssetStreaming.Release(Handle); }
+	void WaitForAsyncLoad(const FAssetLoadHandle& Handle) { AssetStreaming.Wait(Handle); }
+	FAssetStreamingStats GetAsyncLoadStats() const { return AssetStreaming.GetStats(); }
+
+	// 워커가 끝낸 요청의 마무리 (엔진 Tick에서 매 프레임 호출)
+	void ProcessAsyncLoads(double BudgetMs = AsyncLoadFinalizeBudgetMs) { AssetStreaming.ProcessCompleted(BudgetMs); }
+	void FlushAsyncLoads() { AssetStreaming.Flush(); }
+
 	// --- 헬퍼 및 유틸리티 ---
 	ID3D11Device* GetDevice() { return Device; }
 	ID3D11DeviceContext* GetDeviceContext() { return Context; }
@@ -114,6 +135,16 @@ protected:
 	UResourceManager(const UResourceManager&) = delete;
 	UResourceManager& operator=(const UResourceManager&) = delete;
 
+	// 마무리 단계에서 Resources에 직접 등록
+	friend class FAssetStreamingManager;
+
+	template<typename T>
+	FAssetLoadHandle RequestAsyncLoad(const FString& InFilePath, bool bSRGB, EAssetLoadPriority InPriority, TInlineDelegate<T*>&& InOnLoaded);
+
+	// 워커 단계가 없는 요청의 마무리용 동기 로드
+	template<typename T>
+	static UResourceBase* LoadForStreaming(const FString& InFilePath);
+
 	// --- 보호된 멤버 변수 ---
 	ID3D11Device* Device = nullptr;
 	ID3D11DeviceContext* Context = nullptr;
@@ -139,44 +170,56 @@ private:
 
 	// Cache for per-mesh BVHs to avoid rebuilding for identical OBJ assets
 	TMap<FString, FMeshBVH*> MeshBVHCache;
+	// 씬 쿼리 일괄 처리가 여러 스레드에서 GetOrBuildMeshBVH를 호출하므로 캐시 접근을 보호
+	std::mutex MeshBVHCacheMutex;
 
 	UMaterial* DefaultMaterialInstance;
 
+	// 비동기 로드 요청 (Clear에서 워커를 먼저 멈춘다)
+	FAssetStreamingManager AssetStreaming;
+	// 한 프레임에 마무리 단계에 쓰는 시간 (최소 한 건은 처리)
+	static constexpr double AsyncLoadFinalizeBudgetMs = 2.0;
+
 	// Shader Hot Reload
 	float ShaderCheckTimer = 0.0f;
 	const float ShaderCheckInterval = 0.5f; // Check every 0.5 seconds
 };
 
 //-----definition
+// 리소스 맵 키: 백슬래시를 슬래시로 바꾼 경로에서 마지막 확장자만 뗀 문자열
+// (RemoveExtension은 UTF-16/std::filesystem 왕복이 있어 매 Load 호출마다 쓰기엔 무겁다)
+inline FString UResourceManager::MakeResourceKey(const FString& InFilePath)
+{
+	const size_t SeparatorPos = InFilePath.find_last_of("/\\");
+	const size_t NameStart = (SeparatorPos == FString::npos) ? 0 : SeparatorPos + 1;
+	const size_t DotPos = InFilePath.find_last_of('.');
+
+	// ".hidden"처럼 점으로 시작하는 파일 이름은 확장자가 없는 것으로 본다
+	const size_t KeyLength = (DotPos != FString::npos && DotPos > NameStart) ? DotPos : InFilePath.size();
+	FString Key = InFilePath.substr(0, KeyLength);
+	std::replace(Key.begin(), Key.end(), '\\', '/');
+	return Key;
+}
+
 // 리소스 매니저에 새로운 리소스 등록하는 함수이다.
 template<typename T>
 bool UResourceManager::Add(const FString& InFilePath, UObject* InObject)
 {
-	// 경로 정규화: 모든 백슬래시를 슬래시로 변환하여 일관성 유지
-	FString NormalizedPath = NormalizePath(InFilePath);
-	FString PathWithoutExt = RemoveExtension(NormalizedPath);
-
 	uint8 typeIndex = static_cast<uint8>(GetResourceType<T>());
-	auto iter = Resources[typeIndex].find(PathWithoutExt);
-	if (iter == Resources[typeIndex].end())
+	auto [iter, bInserted] = Resources[typeIndex].try_emplace(MakeResourceKey(InFilePath), static_cast<T*>(InObject));
+	if (bInserted)
 	{
-		Resources[typeIndex][PathWithoutExt] = static_cast<T*>(InObject);
-		// 원본 경로 저장 (확장자 포함)
-		Resources[typeIndex][PathWithoutExt]->SetFilePath(NormalizedPath);
-		return true;
+		// 원본 경로 저장 (확장자 포함, 경로 정규화: 모든 백슬래시를 슬래시로 변환하여 일관성 유지)
+		iter->second->SetFilePath(NormalizePath(InFilePath));
 	}
-	return false;
+	return bInserted;
 }
 
 template<typename T>
 T* UResourceManager::Get(const FString& InFilePath)
 {
-	// 경로 정규화: 모든 백슬래시를 슬래시로 변환하여 일관성 유지
-	FString NormalizedPath = NormalizePath(InFilePath);
-	FString PathWithoutExt = RemoveExtension(NormalizedPath);
-
 	uint8 typeIndex = static_cast<uint8>(GetResourceType<T>());
-	auto iter = Resources[typeIndex].find(PathWithoutExt);
+	auto iter = Resources[typeIndex].find(MakeResourceKey(InFilePath));
 	if (iter != Resources[typeIndex].end())
 	{
 		return static_cast<T*>(iter->second);
@@ -193,12 +236,17 @@ inline T* UResourceManager::Load(const FString& InFilePath, Args && ...InArgs)
 		return nullptr;
 	}
 
-	// 경로 정규화: 모든 백슬래시를 슬래시로 변환하여 일관성 유지
-	FString NormalizedPath = NormalizePath(InFilePath);
-	FString PathWithoutExt = RemoveExtension(NormalizedPath);
+	FString PathWithoutExt = MakeResourceKey(InFilePath);
 
 	uint8 typeIndex = static_cast<uint8>(GetResourceType<T>());
 	auto iter = Resources[typeIndex].find(PathWithoutExt);
+	if (iter == Resources[typeIndex].end() && AssetStreaming.HasInFlightRequests() &&
+		AssetStreaming.WaitForKey(GetResourceType<T>(), PathWithoutExt))
+	{
+		// 같은 에셋의 비동기 요청이 진행 중이면 중복으로 읽지 않고 그 요청을 끝까지 처리해 결과를 사용
+		iter = Resources[typeIndex].find(PathWithoutExt);
+	}
+
 	if (iter != Resources[typeIndex].end())
 	{
 		if constexpr (std::is_same_v<T, UShader>)
@@ -212,6 +260,9 @@ inline T* UResourceManager::Load(const FString& InFilePath, Args && ...InArgs)
 	}
 	else//없으면 해당 리소스의 Load실행
 	{
+		// 경로 정규화: 모든 백슬래시를 슬래시로 변환하여 일관성 유지
+		FString NormalizedPath = NormalizePath(InFilePath);
+
 		T* Resource = NewObject<T>();
 		Resource->Load(NormalizedPath, Device, std::forward<Args>(InArgs)...);
 		Resource->SetFilePath(NormalizedPath);
@@ -229,7 +280,7 @@ inline T* UResourceManager::ForceLoad(const FString& InFilePath, Args && ...InAr
 
 	// 경로 정규화: 모든 백슬래시를 슬래시로 변환하여 일관성 유지
 	FString NormalizedPath = NormalizePath(InFilePath);
-	FString PathWithoutExt = RemoveExtension(NormalizedPath);
+	FString PathWithoutExt = MakeResourceKey(NormalizedPath);
 
 	uint8 typeIndex = static_cast<uint8>(GetResourceType<T>());
 	T* Resource = nullptr;
@@ -251,9 +302,7 @@ inline T* UResourceManager::ForceLoad(const FString& InFilePath, Args && ...InAr
 template<>
 inline UShader* UResourceManager::Load(const FString& InFilePath, TArray<FShaderMacro>& InMacros)
 {
-	// 경로 정규화: 모든 백슬래시를 슬래시로 변환하여 일관성 유지
-	FString NormalizedPath = NormalizePath(InFilePath);
-	FString PathWithoutExt = RemoveExtension(NormalizedPath);
+	FString PathWithoutExt = MakeResourceKey(InFilePath);
 
 	// 2. 경로 리소스 맵 검색
 	uint8 typeIndex = static_cast<uint8>(EResourceType::Shader);
@@ -268,6 +317,9 @@ inline UShader* UResourceManager::Load(const FString& InFilePath, TArray<FShader
 	}
 	else
 	{
+		// 경로 정규화: 모든 백슬래시를 슬래시로 변환하여 일관성 유지
+		FString NormalizedPath = NormalizePath(InFilePath);
+
 		// 3. 캐시에 없으면 새로 생성하여 로드
 		UShader* Resource = NewObject<UShader>();
 		// UShader::Load는 이제 매크로 인자를 받도록 수정되어야 함
@@ -279,6 +331,56 @@ inline UShader* UResourceManager::Load(const FString& InFilePath, TArray<FShader
 	}
 }
 
+template<typename T>
+FAssetLoadHandle UResourceManager::LoadAsync(const FString& InFilePath, EAssetLoadPriority InPriority, TInlineDelegate<T*> InOnLoaded)
+{
+	return RequestAsyncLoad<T>(InFilePath, true, InPriority, std::move(InOnLoaded));
+}
+
+inline FAssetLoadHandle UResourceManager::LoadTextureAsync(const FString& InFilePath, bool bSRGB, EAssetLoadPriority InPriority, TInlineDelegate<UTexture*> InOnLoaded)
+{
+	return RequestAsyncLoad<UTexture>(InFilePath, bSRGB, InPriority, std::move(InOnLoaded));
+}
+
+template<typename T>
+FAssetLoadHandle UResourceManager::RequestAsyncLoad(const FString& InFilePath, bool bSRGB, EAssetLoadPriority InPriority, TInlineDelegate<T*>&& InOnLoaded)
+{
+	if (InFilePath.empty())
+	{
+		InOnLoaded.ExecuteIfBound(nullptr);
+		return FAssetLoadHandle();
+	}
+
+	FString PathWithoutExt = MakeResourceKey(InFilePath);
+
+	// 이미 로드된 리소스는 요청을 만들지 않고 바로 완료
+	const EResourceType Type = GetResourceType<T>();
+	auto iter = Resources[static_cast<uint8>(Type)].find(PathWithoutExt);
+	if (iter != Resources[static_cast<uint8>(Type)].end())
+	{
+		InOnLoaded.ExecuteIfBound(static_cast<T*>(iter->second));
+		return FAssetLoadHandle();
+	}
+
+	FOnAssetLoaded OnLoaded;
+	if (InOnLoaded.IsBound())
+	{
+		OnLoaded = [Callback = std::move(InOnLoaded)](UResourceBase* Resource)
+		{
+			Callback.ExecuteIfBound(static_cast<T*>(Resource));
+		};
+	}
+
+	return AssetStreaming.Request(Type, NormalizePath(InFilePath), PathWithoutExt, bSRGB, InPriority,
+		&UResourceManager::LoadForStreaming<T>, std::move(OnLoaded));
+}
+
+template<typename T>
+UResourceBase* UResourceManager::LoadForStreaming(const FString& InFilePath)
+{
+	return GetInstance().Load<T>(InFilePath);
+}
+
 template<typename T>
 EResourceType UResourceManager::GetResourceType()
 {
@@ -25,65 +25,13 @@ void UTexture::Load(const FString& InFilePath, ID3D11Device* InDevice, bool bSRG
 	assert(InDevice);
 
 	// 실제로 로드할 파일 경로 결정
-	FString ActualLoadPath = InFilePath;
-
-#ifdef USE_DDS_CACHE
-	// DDS 캐싱 활성화 시: DDS 변환 및 캐시 사용
-	{
-		// 확장자 판별 (wstring으로 변환하여 한글 경로 지원)
-		std::filesystem::path SourcePath(UTF8ToWide(InFilePath));
-		std::wstring Extension = SourcePath.extension().wstring();
-		std::transform(Extension.begin(), Extension.end(), Extension.begin(), ::towlower);
-
-		// DDS 또는 UTXT가 아닌 경우 → Content 캐시 확인 및 생성
-		if (Extension != L".dds" && Extension != L".utxt")
-		{
-			FString DDSCachePath = FTextureConverter::GetDDSCachePath(InFilePath);
-
-			// 캐시 유효성 검사
-			if (FTextureConverter::ShouldRegenerateDDS(InFilePath, DDSCachePath))
-			{
-				UE_LOG("[UTexture] Converting texture to DDS: %s", InFilePath.c_str());
-
-					// DDS 변환 시도 (bSRGB 파라미터 전달)
-				DXGI_FORMAT TargetFormat = FTextureConverter::GetRecommendedFormat(true, bSRGB); // 알파는 일단 true로 가정
-				if (FTextureConverter::ConvertToDDS(InFilePath, DDSCachePath, TargetFormat))
-				{
-					ActualLoadPath = DDSCachePath; // DDS 캐시 사용
-				}
-				else
-				{
-					UE_LOG("[UTexture] DDS conversion failed, loading original format: %s", InFilePath.c_str());
-					// 변환 실패 시 원본 포맷으로 로드 (fallback)
-				}
-			}
-			else
-			{
-				// 기존 DDS 캐시 사용
-				ActualLoadPath = DDSCachePath;
-				UE_LOG("[UTexture] Using cached DDS: %s", DDSCachePath.c_str());
-			}
-
-			// 경로 정규화: 모든 백슬래시를 슬래시로 변환하여 일관성 유지
-			FString NormalizedCachePath = NormalizePath(DDSCachePath);
-			CacheFilePath = NormalizedCachePath;   // 실제 로드된 경로 저장 (DDS 캐시 사용 시 DDS 경로, 정규화됨)
-		}
-	}
-#else
-	// DDS 캐싱 비활성화 시: 원본 파일만 로드
-	UE_LOG("[UTexture] Loading original texture (DDS cache disabled): %s", InFilePath.c_str());
-#endif
+	const FString ActualLoadPath = ResolveLoadPath(InFilePath, bSRGB, CacheFilePath);
 
 	// UTF-8 -> UTF-16 (Windows) 안전 변환: 한글/비ASCII 경로 대응
 	std::wstring WFilePath = UTF8ToWide(ActualLoadPath);
 
-	// 최종 로드할 파일의 확장자 재확인 (wstring으로 변환하여 한글 경로 지원)
-	std::filesystem::path LoadPath(WFilePath);
-	std::wstring ext = LoadPath.has_extension() ? LoadPath.extension().wstring() : L"";
-	for (auto& ch : ext) ch = static_cast<wchar_t>(::towlower(ch));
-
 	HRESULT hr = E_FAIL;
-	if (ext == L".dds" || ext == L".utxt")
+	if (IsDDSFile(ActualLoadPath))
 	{
 		// DDS 로딩: Ex 버전 사용하여 sRGB 지정 (.utxt는 DDS 포맷)
 		hr = DirectX::CreateDDSTextureFromFileEx(
@@ -116,6 +64,55 @@ void UTexture::Load(const FString& InFilePath, ID3D11Device* InDevice, bool bSRG
 		);
 	}
 
+	OnTextureCreated(hr, ActualLoadPath);
+}
+
+void UTexture::LoadFromMemory(const FString& InLoadPath, const TArray<uint8>& InFileData, ID3D11Device* InDevice, bool bSRGB)
+{
+	assert(InDevice);
+
+	HRESULT hr = E_FAIL;
+	if (!InFileData.empty())
+	{
+		if (IsDDSFile(InLoadPath))
+		{
+			hr = DirectX::CreateDDSTextureFromMemoryEx(
+				InDevice,
+				InFileData.data(),
+				InFileData.size(),
+				0, // maxsize (0 = no limit)
+				D3D11_USAGE_DEFAULT,
+				D3D11_BIND_SHADER_RESOURCE,
+				0, // cpuAccessFlags
+				0, // miscFlags
+				bSRGB ? DirectX::DDS_LOADER_FORCE_SRGB : DirectX::DDS_LOADER_DEFAULT,
+				reinterpret_cast<ID3D11Resource**>(&Texture2D),
+				&ShaderResourceView
+			);
+		}
+		else
+		{
+			hr = DirectX::CreateWICTextureFromMemoryEx(
+				InDevice,
+				InFileData.data(),
+				InFileData.size(),
+				0, // maxsize (0 = no limit)
+				D3D11_USAGE_DEFAULT,
+				D3D11_BIND_SHADER_RESOURCE,
+				0, // cpuAccessFlags
+				0, // miscFlags
+				bSRGB ? DirectX::WIC_LOADER_FORCE_SRGB : DirectX::WIC_LOADER_DEFAULT,
+				reinterpret_cast<ID3D11Resource**>(&Texture2D),
+				&ShaderResourceView
+			);
+		}
+	}
+
+	OnTextureCreated(hr, InLoadPath);
+}
+
+void UTexture::OnTextureCreated(HRESULT hr, const FString& InLoadPath)
+{
 	if (SUCCEEDED(hr))
 	{
 		if (Texture2D)
@@ -129,8 +126,71 @@ void UTexture::Load(const FString& InFilePath, ID3D11Device* InDevice, bool bSRG
 	}
 	else
 	{
-		UE_LOG("[UTexture] Failed to load texture: %s (HRESULT: 0x%08X)", ActualLoadPath.c_str(), hr);
+		UE_LOG("[UTexture] Failed to load texture: %s (HRESULT: 0x%08X)", InLoadPath.c_str(), hr);
+	}
+}
+
+bool UTexture::IsDDSFile(const FString& InLoadPath)
+{
+	// 최종 로드할 파일의 확장자 재확인 (wstring으로 변환하여 한글 경로 지원)
+	std::filesystem::path LoadPath(UTF8ToWide(InLoadPath));
+	std::wstring ext = LoadPath.has_extension() ? LoadPath.extension().wstring() : L"";
+	for (auto& ch : ext) ch = static_cast<wchar_t>(::towlower(ch));
+	return ext == L".dds" || ext == L".utxt";
+}
+
+FString UTexture::ResolveLoadPath(const FString& InFilePath, bool bSRGB, FString& OutCacheFilePath)
+{
+	FString ActualLoadPath = InFilePath;
+
+#ifdef USE_DDS_CACHE
+	// DDS 캐싱 활성화 시: DDS 변환 및 캐시 사용
+	{
+		// 확장자 판별 (wstring으로 변환하여 한글 경로 지원)
+		std::filesystem::path SourcePath(UTF8ToWide(InFilePath));
+		std::wstring Extension = SourcePath.extension().wstring();
+		std::transform(Extension.begin(), Extension.end(), Extension.begin(), ::towlower);
+
+		// DDS 또는 UTXT가 아닌 경우 → Content 캐시 확인 및 생성
+		if (Extension != L".dds" && Extension != L".utxt")
+		{
+			FString DDSCachePath = FTextureConverter::GetDDSCachePath(InFilePath);
+
+			// 캐시 유효성 검사
+			if (FTextureConverter::ShouldRegenerateDDS(InFilePath, DDSCachePath))
+			{
+				UE_LOG("[UTexture] Converting texture to DDS: %s", InFilePath.c_str());
+
+					// DDS 변환 시도 (bSRGB 파라미터 전달)
+				DXGI_FORMAT TargetFormat = FTextureConverter::GetRecommendedFormat(true, bSRGB); // 알파는 일단 true로 가정
+				if (FTextureConverter::ConvertToDDS(InFilePath, DDSCachePath, TargetFormat))
+				{
+					ActualLoadPath = DDSCachePath; // DDS 캐시 사용
+				}
+				else
+				{
+					UE_LOG("[UTexture] DDS conversion failed, loading original format: %s", InFilePath.c_str());
+					// 변환 실패 시 원본 포맷으로 로드 (fallback)
+				}
+			}
+			else
+			{
+				// 기존 DDS 캐시 사용
+				ActualLoadPath = DDSCachePath;
+				UE_LOG("[UTexture] Using cached DDS: %s", DDSCachePath.c_str());
+			}
+
+			// 경로 정규화: 모든 백슬래시를 슬래시로 변환하여 일관성 유지
+			FString NormalizedCachePath = NormalizePath(DDSCachePath);
+			OutCacheFilePath = NormalizedCachePath;   // 실제 로드된 경로 저장 (DDS 캐시 사용 시 DDS 경로, 정규화됨)
+		}
 	}
+#else
+	// DDS 캐싱 비활성화 시: 원본 파일만 로드
+	UE_LOG("[UTexture] Loading original texture (DDS cache disabled): %s", InFilePath.c_str());
+#endif
+
+	return ActualLoadPath;
 }
 
 void UTexture::ReleaseResources()
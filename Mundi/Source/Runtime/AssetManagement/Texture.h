@@ -14,6 +14,14 @@ public:
 	// bSRGB: true = sRGB 포맷 사용 (Diffuse/Albedo 텍스처), false = Linear 포맷 (Normal/Data 텍스처)
 	void Load(const FString& InFilePath, ID3D11Device* InDevice, bool bSRGB = true);
 
+	// 비동기 로드의 게임 스레드 단계: 워커가 읽어 둔 파일 내용으로 GPU 텍스처만 생성
+	// InLoadPath는 ResolveLoadPath의 결과 (포맷 판별과 로그에 사용)
+	void LoadFromMemory(const FString& InLoadPath, const TArray<uint8>& InFileData, ID3D11Device* InDevice, bool bSRGB = true);
+
+	// 원본 경로 -> 실제로 읽을 경로 (DDS 캐시가 켜져 있으면 필요 시 변환까지 수행). 디바이스를 쓰지 않으므로 워커 스레드에서 호출 가능
+	static FString ResolveLoadPath(const FString& InFilePath, bool bSRGB, FString& OutCacheFilePath);
+	static bool IsDDSFile(const FString& InLoadPath);
+
 	ID3D11ShaderResourceView* GetShaderResourceView() const { return ShaderResourceView; }
 	ID3D11Texture2D* GetTexture2D() const { return Texture2D; }
 
@@ -23,14 +31,17 @@ public:
 
 	// DDS 캐시 파일 경로
 	const FString& GetCacheFilePath() const { return CacheFilePath; }
+	void SetCacheFilePath(const FString& InCacheFilePath) { CacheFilePath = InCacheFilePath; }
 
 	void ReleaseResources();
 
 private:
+	void OnTextureCreated(HRESULT hr, const FString& InLoadPath);
+
 	FString CacheFilePath;  // 캐시된 소스 경로 (예: DerivedDataCache/cube_texture.png.dds)
 
-	ID3D11Texture2D* Texture2D;
-	ID3D11ShaderResourceView* ShaderResourceView;
+	ID3D11Texture2D* Texture2D = nullptr;
+	ID3D11ShaderResourceView* ShaderResourceView = nullptr;
 
 	uint32 Width = 0;
 	uint32 Height = 0;
@@ -0,0 +1,268 @@
+﻿#include "pch.h"
+#include "ContainerBenchmark.h"
+#include "PlatformTime.h"
+#include "Hash.h"
+
+namespace
+{
+    // 측정 루프가 최적화로 사라지지 않도록 결과를 모음
+    volatile uint64 GBenchmarkSink = 0;
+
+    struct FOperationTimes
+    {
+        double Insert = 0.0;
+        double FindHit = 0.0;
+        double FindMiss = 0.0;
+        double Iterate = 0.0;
+        double Erase = 0.0;
+    };
+
+    double ElapsedMs(uint64 StartCycles)
+    {
+        return FPlatformTime::ToMilliseconds(FPlatformTime::Cycles64() - StartCycles);
+    }
+
+    // 맵: Keys를 넣고, 모두 찾고, 없는 키를 찾고, 순회하고, 모두 지움
+    template<typename MapType, typename KeyType, typename LookupType>
+    FOperationTimes MeasureMap(const TArray<KeyType>& Keys, const TArray<LookupType>& HitLookups, const TArray<KeyType>& MissKeys, int32 Iterations)
+    {
+        FOperationTimes Times;
+        uint64 Sum = 0;
+        for (int32 Iteration = 0; Iteration < Iterations; ++Iteration)
+        {
+            MapType Map;
+
+            uint64 Start = FPlatformTime::Cycles64();
+            for (int32 i = 0; i < Keys.Num(); ++i)
+            {
+                Map.emplace(Keys[i], i);
+            }
+            Times.Insert += ElapsedMs(Start);
+
+            Start = FPlatformTime::Cycles64();
+            for (const LookupType& Key : HitLookups)
+            {
+                Sum += Map.find(Key)->second;
+            }
+            Times.FindHit += ElapsedMs(Start);
+
+            Start = FPlatformTime::Cycles64();
+            for (const KeyType& Key : MissKeys)
+            {
+                Sum += Map.count(Key);
+            }
+            Times.FindMiss += ElapsedMs(Start);
+
+            Start = FPlatformTime::Cycles64();
+            for (const auto& Pair : Map)
+            {
+                Sum += Pair.second;
+            }
+            Times.Iterate += ElapsedMs(Start);
+
+            Start = FPlatformTime::Cycles64();
+            for (const KeyType& Key : Keys)
+            {
+                Sum += Map.erase(Key);
+            }
+            Times.Erase += ElapsedMs(Start);
+        }
+        GBenchmarkSink = GBenchmarkSink + Sum;
+        return Times;
+    }
+
+    // 집합: 같은 순서, 찾기는 find != end
+    template<typename SetType>
+    FOperationTimes MeasureSet(const TArray<uint64>& Keys, const TArray<uint64>& MissKeys, int32 Iterations)
+    {
+        FOperationTimes Times;
+        uint64 Sum = 0;
+        for (int32 Iteration = 0; Iteration < Iterations; ++Iteration)
+        {
+            SetType Set;
+
+            uint64 Start = FPlatformTime::Cycles64();
+            for (uint64 Key : Keys)
+            {
+                Sum += Set.insert(Key).second;
+            }
+            Times.Insert += ElapsedMs(Start);
+
+            Start = FPlatformTime::Cycles64();
+            for (uint64 Key : Keys)
+            {
+                Sum += Set.find(Key) != Set.end();
+            }
+            Times.FindHit += ElapsedMs(Start);
+
+            Start = FPlatformTime::Cycles64();
+            for (uint64 Key : MissKeys)
+            {
+                Sum += Set.find(Key) != Set.end();
+            }
+            Times.FindMiss += ElapsedMs(Start);
+
+            Start = FPlatformTime::Cycles64();
+            for (uint64 Key : Set)
+            {
+                Sum += Key;
+            }
+            Times.Iterate += ElapsedMs(Start);
+
+            Start = FPlatformTime::Cycles64();
+            for (uint64 Key : Keys)
+            {
+                Sum += Set.erase(Key);
+            }
+            Times.Erase += ElapsedMs(Start);
+        }
+        GBenchmarkSink = GBenchmarkSink + Sum;
+        return Times;
+    }
+
+    void AddResults(TArray<FContainerBenchmarkResult>& OutResults, const char* Name, int32 ElementCount, int32 Iterations,
+        const FOperationTimes& HashTable, const FOperationTimes& Std)
+    {
+        const double OpCount = static_cast<double>(ElementCount) * Iterations;
+        const auto Add = [&](const char* Operation, double HashTableMs, double StdMs)
+        {
+            FContainerBenchmarkResult Result;
+            Result.Name = Name;
+            Result.Operation = Operation;
+            Result.ElementCount = ElementCount;
+            Result.HashTableNsPerOp = HashTableMs * 1e6 / OpCount;
+            Result.StdNsPerOp = StdMs * 1e6 / OpCount;
+            OutResults.Add(Result);
+        };
+
+        Add("insert", HashTable.Insert, Std.Insert);
+        Add("find hit", HashTable.FindHit, Std.FindHit);
+        Add("find miss", HashTable.FindMiss, Std.FindMiss);
+        Add("iterate", HashTable.Iterate, Std.Iterate);
+        Add("erase", HashTable.Erase, Std.Erase);
+    }
+
+    // 키 순서를 섞어 조회가 삽입 순서를 따라가지 않도록 함
+    template<typename T>
+    void Shuffle(TArray<T>& Items, uint64 Seed)
+    {
+        for (int32 i = Items.Num() - 1; i > 0; --i)
+        {
+            Seed = Seed * 6364136223846793005ull + 1442695040888963407ull;
+            std::swap(Items[i], Items[static_cast<int32>((Seed >> 33) % static_cast<uint64>(i + 1))]);
+        }
+    }
+}
+
+namespace FContainerBenchmark
+{
+    TArray<FContainerBenchmarkResult> Run(int32 ElementCount, int32 Iterations)
+    {
+        TArray<FContainerBenchmarkResult> Results;
+        if (ElementCount <= 0 || Iterations <= 0)
+        {
+            return Results;
+        }
+
+        // FName: 액터/컴포넌트 이름 모양 (이름 풀에는 한 번만 등록되고 이후 실행에서 재사용)
+        {
+            TArray<FName> Keys;
+            TArray<FName> MissKeys;
+            Keys.Reserve(ElementCount);
+            MissKeys.Reserve(ElementCount);
+            char Buffer[64];
+            for (int32 i = 0; i < ElementCount; ++i)
+            {
+                snprintf(Buffer, sizeof(Buffer), "BenchActor_%d", i);
+                Keys.Add(FName(Buffer));
+                snprintf(Buffer, sizeof(Buffer), "BenchComponent_%d", i);
+                MissKeys.Add(FName(Buffer));
+            }
+            TArray<FName> HitLookups = Keys;
+            Shuffle(HitLookups, 1);
+
+            const FOperationTimes HashTable = MeasureMap<TMap<FName, int32>>(Keys, HitLookups, MissKeys, Iterations);
+            const FOperationTimes Std = MeasureMap<std::unordered_map<FName, int32>>(Keys, HitLookups, MissKeys, Iterations);
+            AddResults(Results, "FName -> int32", ElementCount, Iterations, HashTable, Std);
+        }
+
+        // 오버랩 쌍: 오브젝트 크기 간격으로 놓인 주소 두 개를 HashCombine (UWorld::TryMarkOverlapPair와 같은 키)
+        {
+            const uint64 ObjectStride = 512;
+            const uint64 BaseAddress = 0x000001F000000000ull;
+            const int32 ObjectCount = std::max(2, static_cast<int32>(std::sqrt(static_cast<double>(ElementCount) * 2.0)) + 1);
+
+            TArray<uint64> Keys;
+            TArray<uint64> MissKeys;
+            Keys.Reserve(ElementCount);
+            MissKeys.Reserve(ElementCount);
+            for (int32 A = 0; A < ObjectCount && Keys.Num() < ElementCount; ++A)
+            {
+                for (int32 B = A + 1; B < ObjectCount && Keys.Num() < ElementCount; ++B)
+                {
+                    Keys.Add(HashCombine(BaseAddress + A * ObjectStride, BaseAddress + B * ObjectStride));
+                    MissKeys.Add(HashCombine(BaseAddress + (ObjectCount + A) * ObjectStride, BaseAddress + (ObjectCount + B) * ObjectStride));
+                }
+            }
+            Shuffle(Keys, 2);
+
+            const FOperationTimes HashTable = MeasureSet<TSet<uint64>>(Keys, MissKeys, Iterations);
+            const FOperationTimes Std = MeasureSet<std::unordered_set<uint64>>(Keys, MissKeys, Iterations);
+            AddResults(Results, "overlap pair set", Keys.Num(), Iterations, HashTable, Std);
+        }
+
+        // FString 경로: 리소스 맵 모양 키, 조회는 FString과 const char* 두 가지
+        {
+            TArray<FString> Keys;
+            TArray<FString> MissKeys;
+            Keys.Reserve(ElementCount);
+            MissKeys.Reserve(ElementCount);
+            char Buffer[128];
+            for (int32 i = 0; i < ElementCount; ++i)
+            {
+                snprintf(Buffer, sizeof(Buffer), "Data/Model/Props/Bench_%06d", i);
+                Keys.Add(Buffer);
+                snprintf(Buffer, sizeof(Buffer), "Data/Textures/Props/Bench_%06d", i);
+                MissKeys.Add(Buffer);
+            }
+            TArray<FString> HitLookups = Keys;
+            Shuffle(HitLookups, 3);
+
+            const FOperationTimes HashTable = MeasureMap<TMap<FString, int32>>(Keys, HitLookups, MissKeys, Iterations);
+            const FOperationTimes Std = MeasureMap<std::unordered_map<FString, int32>>(Keys, HitLookups, MissKeys, Iterations);
+            AddResults(Results, "FString path -> int32", ElementCount, Iterations, HashTable, Std);
+
+            // const char* 조회: std::unordered_map은 매번 임시 FString을 만들고, TMap은 string_view로 바로 해시
+            TArray<const char*> CStringLookups;
+            CStringLookups.Reserve(ElementCount);
+            for (const FString& Key : HitLookups)
+            {
+                CStringLookups.Add(Key.c_str());
+            }
+            const FOperationTimes HashTableCString = MeasureMap<TMap<FString, int32>>(Keys, CStringLookups, MissKeys, Iterations);
+            const FOperationTimes StdCString = MeasureMap<std::unordered_map<FString, int32>>(Keys, CStringLookups, MissKeys, Iterations);
+
+            FContainerBenchmarkResult Result;
+            Result.Name = "FString path -> int32";
+            Result.Operation = "find char*";
+            Result.ElementCount = ElementCount;
+            const double OpCount = static_cast<double>(ElementCount) * Iterations;
+            Result.HashTableNsPerOp = HashTableCString.FindHit * 1e6 / OpCount;
+            Result.StdNsPerOp = StdCString.FindHit * 1e6 / OpCount;
+            Results.Add(Result);
+        }
+
+        return Results;
+    }
+
+    FString FormatResult(const FContainerBenchmarkResult& Result)
+    {
+        char Buffer[256];
+        snprintf(Buffer, sizeof(Buffer),
+            "%-22s %-10s | TMap %7.1f | std %7.1f ns/op | %.2fx",
+            Result.Name.c_str(), Result.Operation.c_str(),
+            Result.HashTableNsPerOp, Result.StdNsPerOp,
+            Result.StdNsPerOp / std::max(Result.HashTableNsPerOp, 1e-9));
+        return FString(Buffer);
+    }
+}
@@ -0,0 +1,24 @@
+﻿#pragma once
+
+// 해시 컨테이너 연산 하나의 비교 결과 (키 종류 x 연산마다 한 줄)
+struct FContainerBenchmarkResult
+{
+    FString Name;                   // 키 종류 (예: "FName -> int32")
+    FString Operation;              // insert / find hit / find miss / iterate / erase
+    int32 ElementCount = 0;
+    double HashTableNsPerOp = 0.0;  // TMap / TSet (개방 주소법)
+    double StdNsPerOp = 0.0;        // std::unordered_map / set (기존 구현)
+};
+
+// 콘솔 명령 "BENCH HASH"에서 사용
+namespace FContainerBenchmark
+{
+    // 엔진에서 자주 쓰는 키 모양으로 TMap/TSet과 std 컨테이너를 같은 순서로 측정합니다.
+    // - FName -> int32 (이름 조회)
+    // - 오버랩 쌍 키 TSet<uint64> (UWorld::TryMarkOverlapPair처럼 두 포인터를 HashCombine)
+    // - FString 경로 -> 포인터 (리소스 맵, const char* 조회는 TMap만 임시 문자열 없이 처리)
+    TArray<FContainerBenchmarkResult> Run(int32 ElementCount = 50000, int32 Iterations = 5);
+
+    // 결과 한 줄 포맷: "FName -> int32        find hit   | TMap   12.3 | std   34.5 ns/op | 2.80x"
+    FString FormatResult(const FContainerBenchmarkResult& Result);
+}
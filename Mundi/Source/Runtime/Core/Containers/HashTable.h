@@ -0,0 +1,657 @@
+﻿#pragma once
+#include <algorithm>
+#include <bit>
+#include <initializer_list>
+#include <iterator>
+#include <new>
+#include <stdexcept>
+#include <string_view>
+#include <tuple>
+#include <type_traits>
+#include <utility>
+#include <vector>
+
+/**
+ * TMap / TSet이 쓰는 개방 주소법 해시 테이블 (UEContainer.h에서 포함)
+ *
+ * - 버킷: 8바이트 {탐사 거리 + 지문, 원소 인덱스}의 연속 배열, Robin Hood 선형 탐사 (적재율 80% 이하)
+ *   탐사 중에는 버킷만 읽고, 지문(해시 하위 8비트)과 거리가 같을 때만 원소 키를 비교합니다.
+ * - 원소: 크기가 두 배씩 커지는 청크에 인덱스 순으로 저장하고, 청크는 옮기지 않습니다.
+ *   std::unordered_map처럼 삽입/재해시 뒤에도 원소의 참조와 포인터가 유지되고, 제거는 그 원소만 무효화합니다.
+ *   제거된 칸은 다음 삽입에 재사용하고, 순회는 살아 있는 칸 비트마스크를 따라갑니다.
+ * - 해시: std::hash 결과를 한 번 더 섞어 씁니다 (정수/포인터 키의 항등 해시도 상위 비트로 고르게 분산).
+ * - Hasher와 KeyEqual이 모두 is_transparent면 키 타입으로 바꾸지 않고 찾습니다 (FString/FWideString 키 기본 지원).
+ */
+
+/** 기본 해시: std::hash, 문자열은 string_view로 투명 해시 */
+template<typename KeyType>
+struct TDefaultHash : std::hash<KeyType>
+{
+};
+
+template<>
+struct TDefaultHash<std::string>
+{
+    using is_transparent = void;
+    size_t operator()(std::string_view Key) const noexcept { return std::hash<std::string_view>()(Key); }
+};
+
+template<>
+struct TDefaultHash<std::wstring>
+{
+    using is_transparent = void;
+    size_t operator()(std::wstring_view Key) const noexcept { return std::hash<std::wstring_view>()(Key); }
+};
+
+/** 기본 키 비교: operator==, 문자열은 std::equal_to<>로 투명 비교 */
+template<typename KeyType>
+struct TDefaultKeyEqual : std::equal_to<KeyType>
+{
+};
+
+template<>
+struct TDefaultKeyEqual<std::string> : std::equal_to<>
+{
+};
+
+template<>
+struct TDefaultKeyEqual<std::wstring> : std::equal_to<>
+{
+};
+
+/**
+ * MappedType이 void면 집합(원소 = 키), 아니면 맵(원소 = std::pair<const KeyType, MappedType>)
+ * 함수 이름은 std::unordered_map/set과 같아서 기존 호출부가 그대로 동작합니다.
+ */
+template<typename KeyType, typename MappedType, typename Hasher = TDefaultHash<KeyType>, typename KeyEqual = TDefaultKeyEqual<KeyType>>
+class THashTable
+{
+public:
+    static constexpr bool bIsSet = std::is_void_v<MappedType>;
+    static constexpr bool bIsTransparent = requires { typename Hasher::is_transparent; typename KeyEqual::is_transparent; };
+
+    using key_type = KeyType;
+    using value_type = std::conditional_t<bIsSet, KeyType, std::pair<const KeyType, MappedType>>;
+    using size_type = size_t;
+    using difference_type = std::ptrdiff_t;
+    using hasher = Hasher;
+    using key_equal = KeyEqual;
+    using reference = value_type&;
+    using const_reference = const value_type&;
+
+private:
+    using ElementType = value_type;
+
+    struct FBucket
+    {
+        uint32 DistAndFingerprint;  // 0이면 빈 버킷, 상위 24비트: 이상 위치부터의 거리 + 1, 하위 8비트: 지문
+        uint32 ElementIndex;
+    };
+
+    static constexpr uint32 DistIncrement = 1u << 8;
+    static constexpr uint32 FingerprintMask = DistIncrement - 1;
+    static constexpr uint32 MinBucketCount = 8;
+
+    // 청크 0과 1은 4칸, 이후 청크 c는 2^(c + 1)칸 (인덱스 [2^(c + 1), 2^(c + 2)))
+    static constexpr uint32 FirstChunkShift = 2;
+    static constexpr uint32 FirstChunkSize = 1u << FirstChunkShift;
+
+    template<bool bConst>
+    class TIterator
+    {
+    public:
+        using iterator_category = std::forward_iterator_tag;
+        using value_type = ElementType;
+        using difference_type = std::ptrdiff_t;
+        using pointer = std::conditional_t<bConst, const ElementType*, ElementType*>;
+        using reference = std::conditional_t<bConst, const ElementType&, ElementType&>;
+        using TablePointer = std::conditional_t<bConst, const THashTable*, THashTable*>;
+
+        TIterator() = default;
+        TIterator(TablePointer InTable, uint32 InIndex) : Table(InTable), Index(InIndex) {}
+
+        // iterator -> const_iterator 변환
+        template<bool bOtherConst> requires (bConst && !bOtherConst)
+        TIterator(const TIterator<bOtherConst>& Other) : Table(Other.Table), Index(Other.Index) {}
+
+        reference operator*() const { return *Table->GetElement(Index); }
+        pointer operator->() const { return Table->GetElement(Index); }
+
+        TIterator& operator++()
+        {
+            // 빈 칸이 없는 구간은 비트 하나만 확인하고 넘어감
+            ++Index;
+            if (Index >= Table->ElementEnd || !Table->IsAlive(Index))
+            {
+                Index = Table->FindNextAliveIndex(Index);
+            }
+            return *this;
+        }
+
+        TIterator operator++(int)
+        {
+            TIterator Previous = *this;
+            ++(*this);
+            return Previous;
+        }
+
+        friend bool operator==(const TIterator& A, const TIterator& B) { return A.Index == B.Index; }
+
+    private:
+        friend class THashTable;
+        template<bool> friend class TIterator;
+
+        TablePointer Table = nullptr;
+        uint32 Index = 0;
+    };
+
+public:
+    using const_iterator = TIterator<true>;
+    // 집합의 원소는 키이므로 std::unordered_set처럼 iterator도 const
+    using iterator = std::conditional_t<bIsSet, TIterator<true>, TIterator<false>>;
+
+    THashTable() = default;
+
+    THashTable(std::initializer_list<ElementType> InitList)
+    {
+        insert(InitList.begin(), InitList.end());
+    }
+
+    template<typename InputIterator>
+    THashTable(InputIterator First, InputIterator Last)
+    {
+        insert(First, Last);
+    }
+
+    THashTable(const THashTable& Other)
+    {
+        CopyFrom(Other);
+    }
+
+    THashTable(THashTable&& Other) noexcept
+    {
+        swap(Other);
+    }
+
+    ~THashTable()
+    {
+        DestroyAll();
+        ReleaseChunks();
+    }
+
+    THashTable& operator=(const THashTable& Other)
+    {
+        if (this != &Other)
+        {
+            clear();
+            CopyFrom(Other);
+        }
+        return *this;
+    }
+
+    THashTable& operator=(THashTable&& Other) noexcept
+    {
+        if (this != &Other)
+        {
+            THashTable Moved(std::move(Other));
+            swap(Moved);
+        }
+        return *this;
+    }
+
+    THashTable& operator=(std::initializer_list<ElementType> InitList)
+    {
+        clear();
+        insert(InitList.begin(), InitList.end());
+        return *this;
+    }
+
+    /** 순회 */
+    iterator begin() { return iterator(this, FindNextAliveIndex(0)); }
+    const_iterator begin() const { return const_iterator(this, FindNextAliveIndex(0)); }
+    const_iterator cbegin() const { return begin(); }
+    iterator end() { return iterator(this, ElementEnd); }
+    const_iterator end() const { return const_iterator(this, ElementEnd); }
+    const_iterator cend() const { return end(); }
+
+    /** 크기 */
+    size_t size() const { return NumElements; }
+    bool empty() const { return NumElements == 0; }
+    size_t bucket_count() const { return Buckets.size(); }
+
+    // 원소는 모두 파괴하지만 청크와 버킷 메모리는 유지 (다시 채울 때 재할당 없음)
+    void clear()
+    {
+        DestroyAll();
+        std::fill(Buckets.begin(), Buckets.end(), FBucket{ 0, 0 });
+        std::fill(AliveBits.begin(), AliveBits.end(), 0ull);
+        FreeIndices.clear();
+        NumElements = 0;
+        ElementEnd = 0;
+    }
+
+    // Count개를 넣어도 재해시가 일어나지 않도록 버킷 확보
+    void reserve(size_t Count)
+    {
+        const uint32 Required = GetBucketCountFor(Count);
+        if (Required > Buckets.size())
+        {
+            Rehash(Required);
+        }
+    }
+
+    void swap(THashTable& Other) noexcept
+    {
+        Buckets.swap(Other.Buckets);
+        Chunks.swap(Other.Chunks);
+        AliveBits.swap(Other.AliveBits);
+        FreeIndices.swap(Other.FreeIndices);
+        std::swap(BucketShift, Other.BucketShift);
+        std::swap(NumElements, Other.NumElements);
+        std::swap(ElementEnd, Other.ElementEnd);
+    }
+
+    /** 검색 */
+    iterator find(const KeyType& Key) { return iterator(this, FindElementIndex(Key)); }
+    const_iterator find(const KeyType& Key) const { return const_iterator(this, FindElementIndex(Key)); }
+    size_t count(const KeyType& Key) const { return FindElementIndex(Key) != ElementEnd ? 1 : 0; }
+    bool contains(const KeyType& Key) const { return FindElementIndex(Key) != ElementEnd; }
+
+    template<typename LookupType> requires bIsTransparent
+    iterator find(const LookupType& Key) { return iterator(this, FindElementIndex(Key)); }
+
+    template<typename LookupType> requires bIsTransparent
+    const_iterator find(const LookupType& Key) const { return const_iterator(this, FindElementIndex(Key)); }
+
+    template<typename LookupType> requires bIsTransparent
+    size_t count(const LookupType& Key) const { return FindElementIndex(Key) != ElementEnd ? 1 : 0; }
+
+    template<typename LookupType> requires bIsTransparent
+    bool contains(const LookupType& Key) const { return FindElementIndex(Key) != ElementEnd; }
+
+    /** 삽입 (이미 있으면 기존 원소와 false) */
+    std::pair<iterator, bool> insert(const ElementType& Value) { return emplace(Value); }
+    std::pair<iterator, bool> insert(ElementType&& Value) { return emplace(std::move(Value)); }
+
+    template<typename PairType> requires (!bIsSet && std::is_constructible_v<ElementType, PairType&&>)
+    std::pair<iterator, bool> insert(PairType&& Value) { return emplace(std::forward<PairType>(Value)); }
+
+    template<typename InputIterator>
+    void insert(InputIterator First, InputIterator Last)
+    {
+        for (; First != Last; ++First)
+        {
+            emplace(*First);
+        }
+    }
+
+    void insert(std::initializer_list<ElementType> InitList) { insert(InitList.begin(), InitList.end()); }
+
+    // 키를 알아야 하므로 원소를 먼저 빈 칸에 만들고, 같은 키가 있으면 되돌림
+    template<typename... ArgTypes>
+    std::pair<iterator, bool> emplace(ArgTypes&&... Args)
+    {
+        const uint32 NewIndex = ConstructElement(std::forward<ArgTypes>(Args)...);
+        const KeyType& NewKey = GetKey(*GetElement(NewIndex));
+        const uint32 ExistingIndex = FindElementIndex(NewKey);
+        if (ExistingIndex != ElementEnd)
+        {
+            DestroyElement(NewIndex);
+            return { iterator(this, ExistingIndex), false };
+        }
+
+        InsertBucket(NewIndex);
+        return { iterator(this, NewIndex), true };
+    }
+
+    /** 맵 전용: 키가 없을 때만 값을 만듦 (operator[]도 이 경로) */
+    template<typename... ArgTypes> requires (!bIsSet)
+    std::pair<iterator, bool> try_emplace(const KeyType& Key, ArgTypes&&... Args)
+    {
+        const uint32 ExistingIndex = FindElementIndex(Key);
+        if (ExistingIndex != ElementEnd)
+        {
+            return { iterator(this, ExistingIndex), false };
+        }
+
+        const uint32 NewIndex = ConstructElement(std::piecewise_construct, std::forward_as_tuple(Key), std::forward_as_tuple(std::forward<ArgTypes>(Args)...));
+        InsertBucket(NewIndex);
+        return { iterator(this, NewIndex), true };
+    }
+
+    template<typename... ArgTypes> requires (!bIsSet)
+    std::pair<iterator, bool> try_emplace(KeyType&& Key, ArgTypes&&... Args)
+    {
+        const uint32 ExistingIndex = FindElementIndex(Key);
+        if (ExistingIndex != ElementEnd)
+        {
+            return { iterator(this, ExistingIndex), false };
+        }
+
+        const uint32 NewIndex = ConstructElement(std::piecewise_construct, std::forward_as_tuple(std::move(Key)), std::forward_as_tuple(std::forward<ArgTypes>(Args)...));
+        InsertBucket(NewIndex);
+        return { iterator(this, NewIndex), true };
+    }
+
+    template<typename ValueArgType> requires (!bIsSet)
+    std::pair<iterator, bool> insert_or_assign(const KeyType& Key, ValueArgType&& Value)
+    {
+        auto Result = try_emplace(Key, std::forward<ValueArgType>(Value));
+        if (!Result.second)
+        {
+            Result.first->second = std::forward<ValueArgType>(Value);
+        }
+        return Result;
+    }
+
+    auto& operator[](const KeyType& Key) requires (!bIsSet) { return try_emplace(Key).first->second; }
+    auto& operator[](KeyType&& Key) requires (!bIsSet) { return try_emplace(std::move(Key)).first->second; }
+
+    auto& at(const KeyType& Key) requires (!bIsSet)
+    {
+        const uint32 Index = FindElementIndex(Key);
+        if (Index == ElementEnd)
+        {
+            throw std::out_of_range("THashTable::at: key not found");
+        }
+        return GetElement(Index)->second;
+    }
+
+    const auto& at(const KeyType& Key) const requires (!bIsSet)
+    {
+        const uint32 Index = FindElementIndex(Key);
+        if (Index == ElementEnd)
+        {
+            throw std::out_of_range("THashTable::at: key not found");
+        }
+        return GetElement(Index)->second;
+    }
+
+    /** 제거 (다른 원소는 움직이지 않음) */
+    iterator erase(const_iterator Position)
+    {
+        const uint32 Index = Position.Index;
+        EraseBucket(FindBucketOfElement(Index));
+        DestroyElement(Index);
+        return iterator(this, FindNextAliveIndex(Index + 1));
+    }
+
+    iterator erase(const_iterator First, const_iterator Last)
+    {
+        while (First != Last)
+        {
+            First = erase(First);
+        }
+        return iterator(this, Last.Index);
+    }
+
+    size_t erase(const KeyType& Key) { return EraseKey(Key); }
+
+    template<typename LookupType> requires (bIsTransparent && !std::is_convertible_v<const LookupType&, const_iterator>)
+    size_t erase(const LookupType& Key) { return EraseKey(Key); }
+
+private:
+    static const KeyType& GetKey(const ElementType& Element)
+    {
+        if constexpr (bIsSet)
+        {
+            return Element;
+        }
+        else
+        {
+            return Element.first;
+        }
+    }
+
+    // 피보나치 해싱: 곱한 결과의 상위 비트로 버킷을, 그 바로 아래 8비트로 지문을 고름
+    template<typename LookupType>
+    static uint64 HashKey(const LookupType& Key)
+    {
+        return static_cast<uint64>(Hasher()(Key)) * 0x9E3779B97F4A7C15ull;
+    }
+
+    uint32 GetBucketIndex(uint64 Hash) const { return static_cast<uint32>(Hash >> BucketShift); }
+    uint32 GetNextBucket(uint32 BucketIndex) const { return (BucketIndex + 1) & static_cast<uint32>(Buckets.size() - 1); }
+
+    static uint32 GetBucketCountFor(size_t Count)
+    {
+        // 적재율 80% 이하
+        uint32 BucketCount = MinBucketCount;
+        while (static_cast<size_t>(BucketCount) * 4 / 5 < Count)
+        {
+            BucketCount <<= 1;
+        }
+        return BucketCount;
+    }
+
+    /** 원소 저장소 */
+    static uint32 GetChunkCapacity(uint32 Chunk)
+    {
+        return Chunk == 0 ? FirstChunkSize : (1u << (Chunk + FirstChunkShift - 1));
+    }
+
+    static void LocateElement(uint32 Index, uint32& OutChunk, uint32& OutSlot)
+    {
+        if (Index < FirstChunkSize)
+        {
+            OutChunk = 0;
+            OutSlot = Index;
+            return;
+        }
+        OutChunk = static_cast<uint32>(std::bit_width(Index)) - FirstChunkShift;
+        OutSlot = Index - (1u << (OutChunk + FirstChunkShift - 1));
+    }
+
+    ElementType* GetElement(uint32 Index) const
+    {
+        uint32 Chunk, Slot;
+        LocateElement(Index, Chunk, Slot);
+        return Chunks[Chunk] + Slot;
+    }
+
+    bool IsAlive(uint32 Index) const { return (AliveBits[Index >> 6] >> (Index & 63)) & 1; }
+
+    uint32 FindNextAliveIndex(uint32 Index) const
+    {
+        if (Index >= ElementEnd)
+        {
+            return ElementEnd;
+        }
+
+        uint32 Word = Index >> 6;
+        uint64 Bits = AliveBits[Word] & (~0ull << (Index & 63));
+        const uint32 WordCount = (ElementEnd + 63) >> 6;
+        while (Bits == 0)
+        {
+            if (++Word >= WordCount)
+            {
+                return ElementEnd;
+            }
+            Bits = AliveBits[Word];
+        }
+        const uint32 Found = (Word << 6) + static_cast<uint32>(std::countr_zero(Bits));
+        return Found < ElementEnd ? Found : ElementEnd;
+    }
+
+    template<typename... ArgTypes>
+    uint32 ConstructElement(ArgTypes&&... Args)
+    {
+        uint32 Index;
+        if (!FreeIndices.empty())
+        {
+            Index = FreeIndices.back();
+            FreeIndices.pop_back();
+        }
+        else
+        {
+            Index = ElementEnd++;
+            uint32 Chunk, Slot;
+            LocateElement(Index, Chunk, Slot);
+            if (Chunk >= Chunks.size())
+            {
+                Chunks.push_back(static_cast<ElementType*>(::operator new(sizeof(ElementType) * GetChunkCapacity(Chunk), std::align_val_t(alignof(ElementType)))));
+            }
+            if ((Index >> 6) >= AliveBits.size())
+            {
+                AliveBits.push_back(0);
+            }
+        }
+
+        // 생존 비트는 버킷에 들어갈 때 켬 (그 전에 재해시가 일어나도 두 번 배치되지 않도록)
+        ::new (static_cast<void*>(GetElement(Index))) ElementType(std::forward<ArgTypes>(Args)...);
+        return Index;
+    }
+
+    // 버킷에서 이미 뺐거나 아직 넣지 않은 원소를 파괴하고 칸을 반납
+    void DestroyElement(uint32 Index)
+    {
+        GetElement(Index)->~ElementType();
+        AliveBits[Index >> 6] &= ~(1ull << (Index & 63));
+        FreeIndices.push_back(Index);
+    }
+
+    void DestroyAll()
+    {
+        if constexpr (!std::is_trivially_destructible_v<ElementType>)
+        {
+            for (uint32 Index = FindNextAliveIndex(0); Index != ElementEnd; Index = FindNextAliveIndex(Index + 1))
+            {
+                GetElement(Index)->~ElementType();
+            }
+        }
+    }
+
+    void ReleaseChunks()
+    {
+        for (ElementType* Chunk : Chunks)
+        {
+            ::operator delete(static_cast<void*>(Chunk), std::align_val_t(alignof(ElementType)));
+        }
+        Chunks.clear();
+    }
+
+    void CopyFrom(const THashTable& Other)
+    {
+        reserve(Other.NumElements);
+        for (const ElementType& Element : Other)
+        {
+            InsertBucket(ConstructElement(Element));
+        }
+    }
+
+    /** 버킷 */
+    template<typename LookupType>
+    uint32 FindElementIndex(const LookupType& Key) const
+    {
+        if (NumElements == 0)
+        {
+            return ElementEnd;
+        }
+
+        const uint64 Hash = HashKey(Key);
+        uint32 DistAndFingerprint = DistIncrement | (static_cast<uint32>(Hash >> (BucketShift - 8)) & FingerprintMask);
+        uint32 BucketIndex = GetBucketIndex(Hash);
+        const KeyEqual Equal;
+        for (;;)
+        {
+            const FBucket& Bucket = Buckets[BucketIndex];
+            if (Bucket.DistAndFingerprint == DistAndFingerprint && Equal(GetKey(*GetElement(Bucket.ElementIndex)), Key))
+            {
+                return Bucket.ElementIndex;
+            }
+            // Robin Hood 불변식: 찾는 키라면 이미 지나쳤어야 함
+            if (Bucket.DistAndFingerprint < DistAndFingerprint)
+            {
+                return ElementEnd;
+            }
+            DistAndFingerprint += DistIncrement;
+            BucketIndex = GetNextBucket(BucketIndex);
+        }
+    }
+
+    uint32 FindBucketOfElement(uint32 ElementIndex) const
+    {
+        uint32 BucketIndex = GetBucketIndex(HashKey(GetKey(*GetElement(ElementIndex))));
+        while (Buckets[BucketIndex].ElementIndex != ElementIndex || Buckets[BucketIndex].DistAndFingerprint == 0)
+        {
+            BucketIndex = GetNextBucket(BucketIndex);
+        }
+        return BucketIndex;
+    }
+
+    // 키가 없는 것이 확인된 원소를 버킷에 추가 (필요하면 먼저 키움)
+    void InsertBucket(uint32 ElementIndex)
+    {
+        if (static_cast<size_t>(Buckets.size()) * 4 / 5 < NumElements + 1)
+        {
+            Rehash(GetBucketCountFor(NumElements + 1));
+        }
+        PlaceBucket(HashKey(GetKey(*GetElement(ElementIndex))), ElementIndex);
+        AliveBits[ElementIndex >> 6] |= 1ull << (ElementIndex & 63);
+        ++NumElements;
+    }
+
+    // 더 가까이 있는 버킷을 밀어내며 자리 찾기 (Robin Hood)
+    void PlaceBucket(uint64 Hash, uint32 ElementIndex)
+    {
+        FBucket Bucket{ DistIncrement | (static_cast<uint32>(Hash >> (BucketShift - 8)) & FingerprintMask), ElementIndex };
+        uint32 BucketIndex = GetBucketIndex(Hash);
+        while (Buckets[BucketIndex].DistAndFingerprint != 0)
+        {
+            if (Buckets[BucketIndex].DistAndFingerprint < Bucket.DistAndFingerprint)
+            {
+                std::swap(Buckets[BucketIndex], Bucket);
+            }
+            Bucket.DistAndFingerprint += DistIncrement;
+            BucketIndex = GetNextBucket(BucketIndex);
+        }
+        Buckets[BucketIndex] = Bucket;
+    }
+
+    // 뒤쪽 버킷을 한 칸씩 당겨 빈 칸을 메움 (묘비 없음)
+    void EraseBucket(uint32 BucketIndex)
+    {
+        uint32 NextIndex = GetNextBucket(BucketIndex);
+        while (Buckets[NextIndex].DistAndFingerprint >= DistIncrement * 2)
+        {
+            Buckets[BucketIndex] = { Buckets[NextIndex].DistAndFingerprint - DistIncrement, Buckets[NextIndex].ElementIndex };
+            BucketIndex = NextIndex;
+            NextIndex = GetNextBucket(NextIndex);
+        }
+        Buckets[BucketIndex] = { 0, 0 };
+        --NumElements;
+    }
+
+    template<typename LookupType>
+    size_t EraseKey(const LookupType& Key)
+    {
+        const uint32 Index = FindElementIndex(Key);
+        if (Index == ElementEnd)
+        {
+            return 0;
+        }
+        EraseBucket(FindBucketOfElement(Index));
+        DestroyElement(Index);
+        return 1;
+    }
+
+    // 원소는 그대로 두고 버킷만 다시 배치
+    void Rehash(uint32 NewBucketCount)
+    {
+        Buckets.assign(NewBucketCount, FBucket{ 0, 0 });
+        BucketShift = 64 - static_cast<uint32>(std::countr_zero(NewBucketCount));
+        for (uint32 Index = FindNextAliveIndex(0); Index != ElementEnd; Index = FindNextAliveIndex(Index + 1))
+        {
+            PlaceBucket(HashKey(GetKey(*GetElement(Index))), Index);
+        }
+    }
+
+private:
+    std::vector<FBucket> Buckets;
+    std::vector<ElementType*> Chunks;
+    std::vector<uint64> AliveBits;      // 원소 인덱스별 생존 비트
+    std::vector<uint32> FreeIndices;    // 제거되어 재사용할 원소 인덱스
+    uint32 BucketShift = 64;            // 버킷 인덱스 = 해시 >> BucketShift
+    uint32 NumElements = 0;
+    uint32 ElementEnd = 0;              // 한 번이라도 쓰인 원소 인덱스의 끝 (end() 위치)
+};
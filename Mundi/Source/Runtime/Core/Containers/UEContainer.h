@@ -19,31 +19,53 @@ typedef wchar_t WIDECHAR;
 typedef std::string FString;
 typedef std::wstring FWideString;
 
+class UObject;
+
+namespace ObjectFactory
+{
+    // 오브젝트의 GUObjectArray 슬롯 인덱스와 현재 세대 (팩토리에 등록되지 않은 오브젝트면 false)
+    bool GetObjectHandle(const UObject* Object, uint32& OutIndex, uint32& OutGeneration);
+
+    // 슬롯 인덱스 + 세대가 가리키는 살아 있는 오브젝트 (삭제되었거나 슬롯이 재사용되었으면 nullptr)
+    UObject* ResolveObjectHandle(uint32 Index, uint32 Generation);
+}
+
 // Lightweight weak object pointer compatible with engine UObject lifetime
-// - Stores a raw pointer (non-owning)
-// - Provides IsValid(), Get(), operators for containers
-// - Hash specialization provided below for unordered_map/set
+// - Stores a GUObjectArray slot index + generation (non-owning)
+// - Resolves to nullptr once the object is deleted, even if the slot is reused by a new object
+// - Equality/hash use the handle, so stale keys stay stable inside unordered_map/set
 template<typename T>
 class TWeakObjectPtr
 {
 public:
     using ElementType = T;
 
-    TWeakObjectPtr() : Ptr(nullptr) {}
-    TWeakObjectPtr(std::nullptr_t) : Ptr(nullptr) {}
-    explicit TWeakObjectPtr(T* InPtr) : Ptr(InPtr) {}
+    TWeakObjectPtr() : ObjectIndex(UINT32_MAX), ObjectGeneration(0) {}
+    TWeakObjectPtr(std::nullptr_t) : ObjectIndex(UINT32_MAX), ObjectGeneration(0) {}
+    explicit TWeakObjectPtr(const T* InPtr) : ObjectIndex(UINT32_MAX), ObjectGeneration(0)
+    {
+        if (InPtr && !ObjectFactory::GetObjectHandle(InPtr, ObjectIndex, ObjectGeneration))
+        {
+            ObjectIndex = UINT32_MAX;
+            ObjectGeneration = 0;
+        }
+    }
+
+    bool IsValid() const { return Get() != nullptr; }
+    T* Get() const { return static_cast<T*>(ObjectFactory::ResolveObjectHandle(ObjectIndex, ObjectGeneration)); }
 
-    bool IsValid() const { return Ptr != nullptr; }
-    T* Get() const { return Ptr; }
+    T& operator*() const { return *Get(); }
+    T* operator->() const { return Get(); }
 
-    T& operator*() const { return *Ptr; }
-    T* operator->() const { return Ptr; }
+    bool operator==(const TWeakObjectPtr& Other) const { return ObjectIndex == Other.ObjectIndex && ObjectGeneration == Other.ObjectGeneration; }
+    bool operator!=(const TWeakObjectPtr& Other) const { return !(*this == Other); }
 
-    bool operator==(const TWeakObjectPtr& Other) const { return Ptr == Other.Ptr; }
-    bool operator!=(const TWeakObjectPtr& Other) const { return Ptr != Other.Ptr; }
+    uint32 GetObjectIndex() const { return ObjectIndex; }
+    uint32 GetObjectGeneration() const { return ObjectGeneration; }
 
 private:
-    T* Ptr;
+    uint32 ObjectIndex;
+    uint32 ObjectGeneration;
 };
 
 namespace std {
@@ -52,7 +74,7 @@ namespace std {
     {
         size_t operator()(const TWeakObjectPtr<T>& Key) const noexcept
         {
-            return hash<const void*>()(static_cast<const void*>(Key.Get()));
+            return hash<uint64>()((static_cast<uint64>(Key.GetObjectGeneration()) << 32) | Key.GetObjectIndex());
         }
     };
 }
@@ -264,12 +286,14 @@ public:
     }
 };
 
-/** TSet - 해시 기반 집합 */
+#include "HashTable.h"
+
+/** TSet - 해시 기반 집합 (개방 주소법, HashTable.h) */
 template<typename T>
-class TSet : public std::unordered_set<T>
+class TSet : public THashTable<T, void>
 {
 public:
-    using std::unordered_set<T>::unordered_set;
+    using THashTable<T, void>::THashTable;
 
     /** 요소 추가 */
     void Add(const T& Item)
@@ -278,7 +302,8 @@ public:
     }
 
     /** 제거 */
-    bool Remove(const T& Item)
+    template<typename LookupType = T>
+    bool Remove(const LookupType& Item)
     {
         return this->erase(Item) > 0;
     }
@@ -299,10 +324,16 @@ public:
         this->clear();
     }
 
-    /** 검색 */
-    bool Contains(const T& Item) const
+    void Reserve(int64 Count)
     {
-        return this->find(Item) != this->end();
+        this->reserve(static_cast<SIZE_T>(Count));
+    }
+
+    /** 검색 (문자열 집합은 const char* / string_view로 바로 검색) */
+    template<typename LookupType = T>
+    bool Contains(const LookupType& Item) const
+    {
+        return this->contains(Item);
     }
 
     /** 집합 연산 */
@@ -355,12 +386,12 @@ public:
     }
 };
 
-/** TMap - 해시 기반 연관 컨테이너 */
+/** TMap - 해시 기반 연관 컨테이너 (개방 주소법, HashTable.h) */
 template<typename KeyType, typename ValueType>
-class TMap : public std::unordered_map<KeyType, ValueType>
+class TMap : public THashTable<KeyType, ValueType>
 {
 public:
-    using std::unordered_map<KeyType, ValueType>::unordered_map;
+    using THashTable<KeyType, ValueType>::THashTable;
 
     /** 요소 추가/수정 */
     void Add(const KeyType& Key, const ValueType& Value)
@@ -371,11 +402,12 @@ public:
     template<typename... Args>
     void Emplace(const KeyType& Key, Args&&... args)
     {
-        this->emplace(Key, ValueType(std::forward<Args>(args)...));
+        this->try_emplace(Key, std::forward<Args>(args)...);
     }
 
     /** 제거 */
-    bool Remove(const KeyType& Key)
+    template<typename LookupType = KeyType>
+    bool Remove(const LookupType& Key)
     {
         return this->erase(Key) > 0;
     }
@@ -396,26 +428,35 @@ public:
         this->clear();
     }
 
-    /** 검색 */
-    bool Contains(const KeyType& Key) const
+    void Reserve(int64 Count)
     {
-        return this->find(Key) != this->end();
+        this->reserve(static_cast<SIZE_T>(Count));
     }
 
-    ValueType* Find(const KeyType& Key)
+    /** 검색 (FString 키는 const char* / string_view로 임시 문자열 없이 검색) */
+    template<typename LookupType = KeyType>
+    bool Contains(const LookupType& Key) const
+    {
+        return this->contains(Key);
+    }
+
+    template<typename LookupType = KeyType>
+    ValueType* Find(const LookupType& Key)
     {
         auto it = this->find(Key);
         return (it != this->end()) ? &it->second : nullptr;
     }
 
-    const ValueType* Find(const KeyType& Key) const
+    template<typename LookupType = KeyType>
+    const ValueType* Find(const LookupType& Key) const
     {
         auto it = this->find(Key);
         return (it != this->end()) ? &it->second : nullptr;
     }
 
     /** 찾거나 기본값 반환 */
-    ValueType FindRef(const KeyType& Key) const
+    template<typename LookupType = KeyType>
+    ValueType FindRef(const LookupType& Key) const
     {
         auto it = this->find(Key);
         return (it != this->end()) ? it->second : ValueType{};
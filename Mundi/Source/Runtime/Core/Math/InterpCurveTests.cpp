@@ -0,0 +1,150 @@
+﻿#include "pch.h"
+#include "InterpCurveTests.h"
+#include "Statistics.h"
+#include "TestContext.h"
+
+namespace
+{
+    constexpr float Pi = 3.14159265358979f;
+    constexpr int32 SampleCount = 10000;
+
+    // 해석적 곡선 (0~1 구간 한 주기)
+    float AnalyticCurve(float Time)
+    {
+        return 0.5f + 0.5f * std::sin(2.0f * Pi * Time);
+    }
+
+    // 해석적 곡선을 KeyCount개 키로 샘플링
+    FInterpCurve<float> MakeSampledCurve(int32 KeyCount)
+    {
+        FInterpCurve<float> Curve;
+        for (int32 i = 0; i < KeyCount; ++i)
+        {
+            const float Time = static_cast<float>(i) / static_cast<float>(KeyCount - 1);
+            Curve.Points.Add(FInterpCurvePoint<float>(Time, AnalyticCurve(Time)));
+        }
+        Curve.Bake();
+        return Curve;
+    }
+
+    void TestLinearCurveIsExact(FTestContext& Context)
+    {
+        // 키 두 개짜리 직선은 테이블 보간도 해석적 값과 같아야 한다
+        FInterpCurve<float> Curve;
+        Curve.AddPoint(2.0f, 10.0f);
+        Curve.AddPoint(-1.0f, 4.0f);
+        TEST_CHECK(Context, Curve.IsBaked());
+
+        float MaxError = 0.0f;
+        for (int32 i = 0; i <= SampleCount; ++i)
+        {
+            const float Time = -1.0f + 3.0f * static_cast<float>(i) / SampleCount;
+            MaxError = std::max(MaxError, std::abs(Curve.Eval(Time) - (6.0f + 2.0f * Time)));
+        }
+        Context.Check(MaxError < 1e-4f, "linear curve: max error %g vs analytic", MaxError);
+    }
+
+    void TestSmoothCurveAccuracy(FTestContext& Context)
+    {
+        // 32키 사인 곡선: 키 보간 오차 h^2/8 * max|f''| ~= 2.6e-3
+        const FInterpCurve<float> Curve = MakeSampledCurve(32);
+        TEST_CHECK(Context, Curve.IsBaked());
+
+        float MaxTableError = 0.0f;
+        float MaxAnalyticError = 0.0f;
+        for (int32 i = 0; i <= SampleCount; ++i)
+        {
+            const float Time = static_cast<float>(i) / SampleCount;
+            const float Baked = Curve.Eval(Time);
+            MaxTableError = std::max(MaxTableError, std::abs(Baked - Curve.EvalKeys(Time)));
+            MaxAnalyticError = std::max(MaxAnalyticError, std::abs(Baked - AnalyticCurve(Time)));
+        }
+        Context.Check(MaxTableError < 5e-3f, "sine curve: baked vs keys max error %g", MaxTableError);
+        Context.Check(MaxAnalyticError < 5e-3f, "sine curve: baked vs analytic max error %g", MaxAnalyticError);
+
+        // 일괄 평가는 단일 평가와 같은 값을 낸다
+        TArray<float> Times;
+        TArray<float> Values;
+        Times.SetNum(257);
+        Values.SetNum(257);
+        for (int32 i = 0; i < Times.Num(); ++i)
+        {
+            Times[i] = -0.5f + 2.0f * static_cast<float>(i) / (Times.Num() - 1);
+        }
+        Curve.EvalMany(Times.GetData(), Values.GetData(), Times.Num());
+        int32 Mismatches = 0;
+        for (int32 i = 0; i < Times.Num(); ++i)
+        {
+            Mismatches += (Values[i] != Curve.Eval(Times[i])) ? 1 : 0;
+        }
+        Context.Check(Mismatches == 0, "EvalMany differs from Eval at %d samples", Mismatches);
+    }
+
+    void TestClampAndFallback(FTestContext& Context)
+    {
+        FInterpCurve<float> Curve = MakeSampledCurve(8);
+
+        // 범위 밖은 양 끝 키 값으로 정확히 클램프
+        TEST_CHECK(Context, Curve.Eval(-5.0f) == Curve.Points[0].OutVal);
+        TEST_CHECK(Context, Curve.Eval(5.0f) == Curve.Points[Curve.Num() - 1].OutVal);
+
+        // Points를 직접 수정하고 Bake하지 않으면 키 평가로 돌아간다
+        Curve.Points.Add(FInterpCurvePoint<float>(2.0f, 3.0f));
+        TEST_CHECK(Context, !Curve.IsBaked());
+        TEST_CHECK(Context, Curve.Eval(1.5f) == Curve.EvalKeys(1.5f));
+        TEST_CHECK(Context, std::abs(Curve.Eval(1.5f) - (0.5f * (Curve.Points[7].OutVal + 3.0f))) < 1e-5f);
+
+        Curve.Bake();
+        TEST_CHECK(Context, Curve.IsBaked());
+        TEST_CHECK(Context, std::abs(Curve.Eval(2.0f) - 3.0f) < 1e-5f);
+
+        // 키가 하나 이하이면 테이블 없이 키 값(또는 기본값)을 돌려준다
+        FInterpCurve<float> Single;
+        TEST_CHECK(Context, Single.Eval(0.3f) == 0.0f);
+        Single.AddPoint(0.5f, 7.0f);
+        TEST_CHECK(Context, !Single.IsBaked());
+        TEST_CHECK(Context, Single.Eval(0.0f) == 7.0f && Single.Eval(1.0f) == 7.0f);
+
+        Single.Reset();
+        TEST_CHECK(Context, !Single.HasKeys());
+    }
+
+    void TestVectorCurveAndDistribution(FTestContext& Context)
+    {
+        FRawDistribution<FVector> Distribution;
+        Distribution.Mode = EDistributionMode::Curve;
+        for (int32 i = 0; i < 16; ++i)
+        {
+            const float Time = static_cast<float>(i) / 15.0f;
+            Distribution.Curve.Points.Add(FInterpCurvePoint<FVector>(Time, FVector(AnalyticCurve(Time), Time * Time, 1.0f - Time)));
+        }
+        Distribution.Bake();
+
+        float MaxError = 0.0f;
+        for (int32 i = 0; i <= 1000; ++i)
+        {
+            const float Time = static_cast<float>(i) / 1000.0f;
+            const FVector Baked = Distribution.Curve.Eval(Time);
+            const FVector Keys = Distribution.Curve.EvalKeys(Time);
+            MaxError = std::max({ MaxError, std::abs(Baked.X - Keys.X), std::abs(Baked.Y - Keys.Y), std::abs(Baked.Z - Keys.Z) });
+        }
+        Context.Check(MaxError < 5e-3f, "vector curve: baked vs keys max error %g", MaxError);
+
+        // [MinTime, MaxTime]를 넘는 시간은 순환한다
+        const FVector Wrapped = Distribution.GetValue(1.25f);
+        const FVector Direct = Distribution.GetValue(0.25f);
+        TEST_CHECK(Context, std::abs(Wrapped.X - Direct.X) < 1e-5f && std::abs(Wrapped.Y - Direct.Y) < 1e-5f);
+        TEST_CHECK(Context, Distribution.GetValue(-1.0f).Z == Distribution.Curve.Points[0].OutVal.Z);
+    }
+}
+
+namespace FInterpCurveTests
+{
+    void Run(FTestContext& Context)
+    {
+        TestLinearCurveIsExact(Context);
+        TestSmoothCurveAccuracy(Context);
+        TestClampAndFallback(Context);
+        TestVectorCurveAndDistribution(Context);
+    }
+}
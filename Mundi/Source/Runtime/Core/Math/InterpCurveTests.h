@@ -0,0 +1,11 @@
+﻿#pragma once
+
+struct FTestContext;
+
+// 콘솔 명령 "TEST CURVE"에서 사용
+namespace FInterpCurveTests
+{
+    // Bake한 룩업 테이블 평가(Eval/EvalMany)를 키 직접 평가(EvalKeys) 및 해석적 함수와 비교합니다.
+    // 범위 밖 클램프, 키 수정 후 Bake 전 안전장치, FRawDistribution 시간 순환도 함께 확인합니다.
+    void Run(FTestContext& Context);
+}
@@ -0,0 +1,817 @@
+﻿#include "pch.h"
+#include "MathBatch.h"
+#include "AABB.h"
+
+#include <atomic>
+
+#if MATH_BATCH_SIMD
+#include <immintrin.h>
+#if defined(_MSC_VER)
+#include <intrin.h>
+#endif
+#endif
+
+static_assert(sizeof(FVector) == sizeof(float) * 3, "FVector must be 3 packed floats");
+static_assert(sizeof(FQuat) == sizeof(float) * 4, "FQuat must be 4 packed floats");
+static_assert(sizeof(FTransform) == sizeof(float) * 10, "FTransform must be Translation, Rotation, Scale3D packed");
+static_assert(sizeof(FAABB) == sizeof(float) * 6, "FAABB must be Min, Max packed");
+
+// ============================================================================
+// 스칼라 구현 (기준 구현이자 SIMD 경로의 나머지 원소 처리용)
+// ============================================================================
+
+namespace
+{
+    void TransformPositionsScalar(const FTransform& Transform, const FVector* In, FVector* Out, int32 Begin, int32 End)
+    {
+        for (int32 i = Begin; i < End; ++i)
+        {
+            Out[i] = Transform.TransformPosition(In[i]);
+        }
+    }
+
+    void TransformVectorsScalar(const FTransform& Transform, const FVector* In, FVector* Out, int32 Begin, int32 End)
+    {
+        for (int32 i = Begin; i < End; ++i)
+        {
+            Out[i] = Transform.TransformVector(In[i]);
+        }
+    }
+
+    void TransformPositionsScalar(const FMatrix& Matrix, const FVector* In, FVector* Out, int32 Begin, int32 End)
+    {
+        for (int32 i = Begin; i < End; ++i)
+        {
+            Out[i] = Matrix.TransformPosition(In[i]);
+        }
+    }
+
+    // ParentStride가 0이면 모든 자식이 같은 부모를 사용
+    void ComposeTransformsScalar(const FTransform* Parents, int32 ParentStride, const FTransform* Children, FTransform* Out, int32 Begin, int32 End)
+    {
+        for (int32 i = Begin; i < End; ++i)
+        {
+            Out[i] = Parents[i * ParentStride].GetWorldTransform(Children[i]);
+        }
+    }
+
+    void NlerpQuatsScalar(const FQuat* A, const FQuat* B, float Alpha, FQuat* Out, int32 Begin, int32 End)
+    {
+        for (int32 i = Begin; i < End; ++i)
+        {
+            Out[i] = FQuat::Nlerp(A[i], B[i], Alpha);
+        }
+    }
+
+    void SlerpQuatsScalar(const FQuat* A, const FQuat* B, float Alpha, FQuat* Out, int32 Begin, int32 End)
+    {
+        for (int32 i = Begin; i < End; ++i)
+        {
+            Out[i] = FQuat::Slerp(A[i], B[i], Alpha);
+        }
+    }
+
+    int32 TestAABBsAgainstPlanesScalar(const FVector4* Planes, int32 PlaneCount, const FAABB* Bounds, uint8* OutVisible, int32 Begin, int32 End)
+    {
+        int32 VisibleCount = 0;
+        for (int32 i = Begin; i < End; ++i)
+        {
+            const FVector Center = (Bounds[i].Min + Bounds[i].Max) * 0.5f;
+            const FVector Extents = (Bounds[i].Max - Bounds[i].Min) * 0.5f;
+
+            bool bVisible = true;
+            for (int32 p = 0; p < PlaneCount && bVisible; ++p)
+            {
+                const FVector4& Plane = Planes[p];
+                const float Distance = Plane.X * Center.X + Plane.Y * Center.Y + Plane.Z * Center.Z - Plane.W;
+                const float Radius = std::abs(Plane.X) * Extents.X + std::abs(Plane.Y) * Extents.Y + std::abs(Plane.Z) * Extents.Z;
+                bVisible = Distance + Radius >= 0.0f;
+            }
+
+            OutVisible[i] = bVisible ? 1 : 0;
+            VisibleCount += bVisible ? 1 : 0;
+        }
+        return VisibleCount;
+    }
+}
+
+#if MATH_BATCH_SIMD
+
+// ============================================================================
+// SIMD 레지스터 래퍼
+// 커널 본문은 한 번만 작성하고 FSimd4(SSE4, 4-wide)와 FSimd8(AVX2, 8-wide)로 인스턴스화합니다.
+// ============================================================================
+
+namespace
+{
+    // ---- SSE AoS <-> SoA 전치 헬퍼 (4개 단위) ----
+
+    // FVector 4개 (float 12개) -> X/Y/Z 레지스터
+    inline void LoadVector3x4(const FVector* P, __m128& OutX, __m128& OutY, __m128& OutZ)
+    {
+        const float* F = &P->X;
+        const __m128 A = _mm_loadu_ps(F + 0);   // x0 y0 z0 x1
+        const __m128 B = _mm_loadu_ps(F + 4);   // y1 z1 x2 y2
+        const __m128 C = _mm_loadu_ps(F + 8);   // z2 x3 y3 z3
+
+        OutX = _mm_shuffle_ps(A, _mm_shuffle_ps(B, C, _MM_SHUFFLE(1, 1, 2, 2)), _MM_SHUFFLE(2, 0, 3, 0));
+        OutY = _mm_shuffle_ps(_mm_shuffle_ps(A, B, _MM_SHUFFLE(0, 0, 1, 1)), _mm_shuffle_ps(B, C, _MM_SHUFFLE(2, 2, 3, 3)), _MM_SHUFFLE(2, 0, 2, 0));
+        OutZ = _mm_shuffle_ps(_mm_shuffle_ps(A, B, _MM_SHUFFLE(1, 1, 2, 2)), C, _MM_SHUFFLE(3, 0, 2, 0));
+    }
+
+    inline void StoreVector3x4(FVector* P, __m128 X, __m128 Y, __m128 Z)
+    {
+        float* F = &P->X;
+        const __m128 A = _mm_shuffle_ps(_mm_shuffle_ps(X, Y, _MM_SHUFFLE(0, 0, 0, 0)), _mm_shuffle_ps(Z, X, _MM_SHUFFLE(1, 1, 0, 0)), _MM_SHUFFLE(2, 0, 2, 0));
+        const __m128 B = _mm_shuffle_ps(_mm_shuffle_ps(Y, Z, _MM_SHUFFLE(1, 1, 1, 1)), _mm_shuffle_ps(X, Y, _MM_SHUFFLE(2, 2, 2, 2)), _MM_SHUFFLE(2, 0, 2, 0));
+        const __m128 C = _mm_shuffle_ps(_mm_shuffle_ps(Z, X, _MM_SHUFFLE(3, 3, 2, 2)), _mm_shuffle_ps(Y, Z, _MM_SHUFFLE(3, 3, 3, 3)), _MM_SHUFFLE(2, 0, 2, 0));
+        _mm_storeu_ps(F + 0, A);
+        _mm_storeu_ps(F + 4, B);
+        _mm_storeu_ps(F + 8, C);
+    }
+
+    // FQuat 4개 -> X/Y/Z/W 레지스터
+    inline void LoadQuatx4(const FQuat* P, __m128& OutX, __m128& OutY, __m128& OutZ, __m128& OutW)
+    {
+        OutX = _mm_loadu_ps(&P[0].X);
+        OutY = _mm_loadu_ps(&P[1].X);
+        OutZ = _mm_loadu_ps(&P[2].X);
+        OutW = _mm_loadu_ps(&P[3].X);
+        _MM_TRANSPOSE4_PS(OutX, OutY, OutZ, OutW);
+    }
+
+    inline void StoreQuatx4(FQuat* P, __m128 X, __m128 Y, __m128 Z, __m128 W)
+    {
+        _MM_TRANSPOSE4_PS(X, Y, Z, W);
+        _mm_storeu_ps(&P[0].X, X);
+        _mm_storeu_ps(&P[1].X, Y);
+        _mm_storeu_ps(&P[2].X, Z);
+        _mm_storeu_ps(&P[3].X, W);
+    }
+
+    // FTransform 4개 -> 성분 10개
+    // FTransform 하나는 float 10개(T.xyz, R.xyzw, S.xyz)이므로 [0..3], [4..7], [6..9] 세 번 읽어
+    // 구조체 범위를 벗어나지 않고 모든 성분을 얻습니다.
+    inline void LoadTransformx4(const FTransform* P, __m128 Out[10])
+    {
+        __m128 R0[4], R1[4], R2[4];
+        for (int32 i = 0; i < 4; ++i)
+        {
+            const float* F = &P[i].Translation.X;
+            R0[i] = _mm_loadu_ps(F + 0);   // Tx Ty Tz Rx
+            R1[i] = _mm_loadu_ps(F + 4);   // Ry Rz Rw Sx
+            R2[i] = _mm_loadu_ps(F + 6);   // Rw Sx Sy Sz
+        }
+        _MM_TRANSPOSE4_PS(R0[0], R0[1], R0[2], R0[3]);
+        _MM_TRANSPOSE4_PS(R1[0], R1[1], R1[2], R1[3]);
+        _MM_TRANSPOSE4_PS(R2[0], R2[1], R2[2], R2[3]);
+
+        Out[0] = R0[0]; Out[1] = R0[1]; Out[2] = R0[2];     // Translation
+        Out[3] = R0[3]; Out[4] = R1[0]; Out[5] = R1[1]; Out[6] = R1[2];   // Rotation
+        Out[7] = R1[3]; Out[8] = R2[2]; Out[9] = R2[3];     // Scale3D
+    }
+
+    inline void StoreTransformx4(FTransform* P, const __m128 In[10])
+    {
+        __m128 R0[4] = { In[0], In[1], In[2], In[3] };
+        __m128 R1[4] = { In[4], In[5], In[6], In[7] };
+        __m128 R2[4] = { In[6], In[7], In[8], In[9] };
+        _MM_TRANSPOSE4_PS(R0[0], R0[1], R0[2], R0[3]);
+        _MM_TRANSPOSE4_PS(R1[0], R1[1], R1[2], R1[3]);
+        _MM_TRANSPOSE4_PS(R2[0], R2[1], R2[2], R2[3]);
+
+        for (int32 i = 0; i < 4; ++i)
+        {
+            float* F = &P[i].Translation.X;
+            _mm_storeu_ps(F + 0, R0[i]);
+            _mm_storeu_ps(F + 4, R1[i]);
+            _mm_storeu_ps(F + 6, R2[i]);    // Rw, Sx는 같은 값으로 겹쳐 씀
+        }
+    }
+
+    // FAABB 4개 -> Min/Max X/Y/Z 레지스터 (Frustum.cpp의 AreAABBsVisible_8_AVX와 같은 방식)
+    inline void LoadAABBx4(const FAABB* P, __m128 OutMin[3], __m128 OutMax[3])
+    {
+        __m128 R0 = _mm_loadu_ps(&P[0].Min.X);     // mx my mz Mx
+        __m128 R1 = _mm_loadu_ps(&P[1].Min.X);
+        __m128 R2 = _mm_loadu_ps(&P[2].Min.X);
+        __m128 R3 = _mm_loadu_ps(&P[3].Min.X);
+        _MM_TRANSPOSE4_PS(R0, R1, R2, R3);
+        OutMin[0] = R0;
+        OutMin[1] = R1;
+        OutMin[2] = R2;
+        OutMax[0] = R3;
+
+        const __m128 MaxYZ01 = _mm_castpd_ps(_mm_unpacklo_pd(_mm_load_sd(reinterpret_cast<const double*>(&P[0].Max.Y)), _mm_load_sd(reinterpret_cast<const double*>(&P[1].Max.Y))));
+        const __m128 MaxYZ23 = _mm_castpd_ps(_mm_unpacklo_pd(_mm_load_sd(reinterpret_cast<const double*>(&P[2].Max.Y)), _mm_load_sd(reinterpret_cast<const double*>(&P[3].Max.Y))));
+        OutMax[1] = _mm_shuffle_ps(MaxYZ01, MaxYZ23, _MM_SHUFFLE(2, 0, 2, 0));
+        OutMax[2] = _mm_shuffle_ps(MaxYZ01, MaxYZ23, _MM_SHUFFLE(3, 1, 3, 1));
+    }
+
+    // ---- 4-wide (SSE4) ----
+    struct FSimd4
+    {
+        using FReg = __m128;
+        static constexpr int32 Width = 4;
+
+        static FReg Set1(float V) { return _mm_set1_ps(V); }
+        static FReg Add(FReg A, FReg B) { return _mm_add_ps(A, B); }
+        static FReg Sub(FReg A, FReg B) { return _mm_sub_ps(A, B); }
+        static FReg Mul(FReg A, FReg B) { return _mm_mul_ps(A, B); }
+        static FReg Div(FReg A, FReg B) { return _mm_div_ps(A, B); }
+        static FReg MulAdd(FReg A, FReg B, FReg C) { return _mm_add_ps(_mm_mul_ps(A, B), C); }     // A * B + C
+        static FReg NegMulAdd(FReg A, FReg B, FReg C) { return _mm_sub_ps(C, _mm_mul_ps(A, B)); }  // C - A * B
+        static FReg Sqrt(FReg A) { return _mm_sqrt_ps(A); }
+        static FReg Min(FReg A, FReg B) { return _mm_min_ps(A, B); }
+        static FReg Abs(FReg A) { return _mm_andnot_ps(_mm_set1_ps(-0.0f), A); }
+        static FReg NegativeSign(FReg A) { return _mm_and_ps(_mm_cmplt_ps(A, _mm_setzero_ps()), _mm_set1_ps(-0.0f)); }   // A < 0 이면 부호 비트
+        static FReg Xor(FReg A, FReg B) { return _mm_xor_ps(A, B); }
+        static FReg And(FReg A, FReg B) { return _mm_and_ps(A, B); }
+        static FReg CmpGt(FReg A, FReg B) { return _mm_cmpgt_ps(A, B); }
+        static FReg CmpGe(FReg A, FReg B) { return _mm_cmpge_ps(A, B); }
+        static FReg Select(FReg Mask, FReg IfTrue, FReg IfFalse) { return _mm_blendv_ps(IfFalse, IfTrue, Mask); }
+        static int32 MoveMask(FReg Mask) { return _mm_movemask_ps(Mask); }
+
+        static void LoadVector3(const FVector* P, FReg& X, FReg& Y, FReg& Z) { LoadVector3x4(P, X, Y, Z); }
+        static void StoreVector3(FVector* P, FReg X, FReg Y, FReg Z) { StoreVector3x4(P, X, Y, Z); }
+        static void LoadQuat(const FQuat* P, FReg& X, FReg& Y, FReg& Z, FReg& W) { LoadQuatx4(P, X, Y, Z, W); }
+        static void StoreQuat(FQuat* P, FReg X, FReg Y, FReg Z, FReg W) { StoreQuatx4(P, X, Y, Z, W); }
+        static void LoadTransform(const FTransform* P, FReg Out[10]) { LoadTransformx4(P, Out); }
+        static void StoreTransform(FTransform* P, const FReg In[10]) { StoreTransformx4(P, In); }
+        static void LoadAABB(const FAABB* P, FReg OutMin[3], FReg OutMax[3]) { LoadAABBx4(P, OutMin, OutMax); }
+    };
+
+#if MATH_BATCH_AVX2
+    // ---- 8-wide (AVX2 + FMA) ----
+    // 전치는 SSE로 4개씩 두 번 수행하고 256비트 레지스터로 합칩니다.
+    struct FSimd8
+    {
+        using FReg = __m256;
+        static constexpr int32 Width = 8;
+
+        static FReg Set1(float V) { return _mm256_set1_ps(V); }
+        static FReg Add(FReg A, FReg B) { return _mm256_add_ps(A, B); }
+        static FReg Sub(FReg A, FReg B) { return _mm256_sub_ps(A, B); }
+        static FReg Mul(FReg A, FReg B) { return _mm256_mul_ps(A, B); }
+        static FReg Div(FReg A, FReg B) { return _mm256_div_ps(A, B); }
+        static FReg MulAdd(FReg A, FReg B, FReg C) { return _mm256_fmadd_ps(A, B, C); }
+        static FReg NegMulAdd(FReg A, FReg B, FReg C) { return _mm256_fnmadd_ps(A, B, C); }
+        static FReg Sqrt(FReg A) { return _mm256_sqrt_ps(A); }
+        static FReg Min(FReg A, FReg B) { return _mm256_min_ps(A, B); }
+        static FReg Abs(FReg A) { return _mm256_andnot_ps(_mm256_set1_ps(-0.0f), A); }
+        static FReg NegativeSign(FReg A) { return _mm256_and_ps(_mm256_cmp_ps(A, _mm256_setzero_ps(), _CMP_LT_OQ), _mm256_set1_ps(-0.0f)); }
+        static FReg Xor(FReg A, FReg B) { return _mm256_xor_ps(A, B); }
+        static FReg And(FReg A, FReg B) { return _mm256_and_ps(A, B); }
+        static FReg CmpGt(FReg A, FReg B) { return _mm256_cmp_ps(A, B, _CMP_GT_OQ); }
+        static FReg CmpGe(FReg A, FReg B) { return _mm256_cmp_ps(A, B, _CMP_GE_OQ); }
+        static FReg Select(FReg Mask, FReg IfTrue, FReg IfFalse) { return _mm256_blendv_ps(IfFalse, IfTrue, Mask); }
+        static int32 MoveMask(FReg Mask) { return _mm256_movemask_ps(Mask); }
+
+        static FReg Combine(__m128 Lo, __m128 Hi) { return _mm256_set_m128(Hi, Lo); }
+        static __m128 Lo(FReg V) { return _mm256_castps256_ps128(V); }
+        static __m128 Hi(FReg V) { return _mm256_extractf128_ps(V, 1); }
+
+        static void LoadVector3(const FVector* P, FReg& X, FReg& Y, FReg& Z)
+        {
+            __m128 X0, Y0, Z0, X1, Y1, Z1;
+            LoadVector3x4(P, X0, Y0, Z0);
+            LoadVector3x4(P + 4, X1, Y1, Z1);
+            X = Combine(X0, X1); Y = Combine(Y0, Y1); Z = Combine(Z0, Z1);
+        }
+        static void StoreVector3(FVector* P, FReg X, FReg Y, FReg Z)
+        {
+            StoreVector3x4(P, Lo(X), Lo(Y), Lo(Z));
+            StoreVector3x4(P + 4, Hi(X), Hi(Y), Hi(Z));
+        }
+        static void LoadQuat(const FQuat* P, FReg& X, FReg& Y, FReg& Z, FReg& W)
+        {
+            __m128 X0, Y0, Z0, W0, X1, Y1, Z1, W1;
+            LoadQuatx4(P, X0, Y0, Z0, W0);
+            LoadQuatx4(P + 4, X1, Y1, Z1, W1);
+            X = Combine(X0, X1); Y = Combine(Y0, Y1); Z = Combine(Z0, Z1); W = Combine(W0, W1);
+        }
+        static void StoreQuat(FQuat* P, FReg X, FReg Y, FReg Z, FReg W)
+        {
+            StoreQuatx4(P, Lo(X), Lo(Y), Lo(Z), Lo(W));
+            StoreQuatx4(P + 4, Hi(X), Hi(Y), Hi(Z), Hi(W));
+        }
+        static void LoadTransform(const FTransform* P, FReg Out[10])
+        {
+            __m128 A[10], B[10];
+            LoadTransformx4(P, A);
+            LoadTransformx4(P + 4, B);
+            for (int32 i = 0; i < 10; ++i)
+            {
+                Out[i] = Combine(A[i], B[i]);
+            }
+        }
+        static void StoreTransform(FTransform* P, const FReg In[10])
+        {
+            __m128 A[10], B[10];
+            for (int32 i = 0; i < 10; ++i)
+            {
+                A[i] = Lo(In[i]);
+                B[i] = Hi(In[i]);
+            }
+            StoreTransformx4(P, A);
+            StoreTransformx4(P + 4, B);
+        }
+        static void LoadAABB(const FAABB* P, FReg OutMin[3], FReg OutMax[3])
+        {
+            __m128 MinA[3], MaxA[3], MinB[3], MaxB[3];
+            LoadAABBx4(P, MinA, MaxA);
+            LoadAABBx4(P + 4, MinB, MaxB);
+            for (int32 i = 0; i < 3; ++i)
+            {
+                OutMin[i] = Combine(MinA[i], MinB[i]);
+                OutMax[i] = Combine(MaxA[i], MaxB[i]);
+            }
+        }
+    };
+#endif // MATH_BATCH_AVX2
+
+    // ============================================================================
+    // SoA 커널 (Ops = FSimd4 / FSimd8)
+    // ============================================================================
+
+    // FQuat::RotateVector와 같은 식: T = 2 * (U x V), V' = V + W * T + U x T
+    template<typename Ops, typename FReg = typename Ops::FReg>
+    inline void RotateSoA(FReg QX, FReg QY, FReg QZ, FReg QW, FReg& VX, FReg& VY, FReg& VZ)
+    {
+        const FReg Two = Ops::Set1(2.0f);
+        const FReg TX = Ops::Mul(Two, Ops::NegMulAdd(QZ, VY, Ops::Mul(QY, VZ)));
+        const FReg TY = Ops::Mul(Two, Ops::NegMulAdd(QX, VZ, Ops::Mul(QZ, VX)));
+        const FReg TZ = Ops::Mul(Two, Ops::NegMulAdd(QY, VX, Ops::Mul(QX, VY)));
+
+        VX = Ops::Add(Ops::MulAdd(QW, TX, VX), Ops::NegMulAdd(QZ, TY, Ops::Mul(QY, TZ)));
+        VY = Ops::Add(Ops::MulAdd(QW, TY, VY), Ops::NegMulAdd(QX, TZ, Ops::Mul(QZ, TX)));
+        VZ = Ops::Add(Ops::MulAdd(QW, TZ, VZ), Ops::NegMulAdd(QY, TX, Ops::Mul(QX, TY)));
+    }
+
+    // FQuat::Normalize와 같은 규칙: 길이가 KINDA_SMALL_NUMBER 이하이면 단위 쿼터니언
+    template<typename Ops, typename FReg = typename Ops::FReg>
+    inline void NormalizeQuatSoA(FReg& X, FReg& Y, FReg& Z, FReg& W)
+    {
+        const FReg SizeSquared = Ops::MulAdd(X, X, Ops::MulAdd(Y, Y, Ops::MulAdd(Z, Z, Ops::Mul(W, W))));
+        const FReg Size = Ops::Sqrt(SizeSquared);
+        const FReg Valid = Ops::CmpGt(Size, Ops::Set1(KINDA_SMALL_NUMBER));
+        const FReg InvSize = Ops::Div(Ops::Set1(1.0f), Size);
+        const FReg Zero = Ops::Set1(0.0f);
+
+        X = Ops::Select(Valid, Ops::Mul(X, InvSize), Zero);
+        Y = Ops::Select(Valid, Ops::Mul(Y, InvSize), Zero);
+        Z = Ops::Select(Valid, Ops::Mul(Z, InvSize), Zero);
+        W = Ops::Select(Valid, Ops::Mul(W, InvSize), Ops::Set1(1.0f));
+    }
+
+    template<typename Ops, bool bTranslate>
+    int32 TransformByTransformSIMD(const FTransform& Transform, const FVector* In, FVector* Out, int32 Count)
+    {
+        using FReg = typename Ops::FReg;
+        const FReg QX = Ops::Set1(Transform.Rotation.X), QY = Ops::Set1(Transform.Rotation.Y);
+        const FReg QZ = Ops::Set1(Transform.Rotation.Z), QW = Ops::Set1(Transform.Rotation.W);
+        const FReg SX = Ops::Set1(Transform.Scale3D.X), SY = Ops::Set1(Transform.Scale3D.Y), SZ = Ops::Set1(Transform.Scale3D.Z);
+        const FReg TX = Ops::Set1(Transform.Translation.X), TY = Ops::Set1(Transform.Translation.Y), TZ = Ops::Set1(Transform.Translation.Z);
+
+        const int32 SimdCount = Count - Count % Ops::Width;
+        for (int32 i = 0; i < SimdCount; i += Ops::Width)
+        {
+            FReg X, Y, Z;
+            Ops::LoadVector3(In + i, X, Y, Z);
+            X = Ops::Mul(X, SX);
+            Y = Ops::Mul(Y, SY);
+            Z = Ops::Mul(Z, SZ);
+            RotateSoA<Ops>(QX, QY, QZ, QW, X, Y, Z);
+            if (bTranslate)
+            {
+                X = Ops::Add(X, TX);
+                Y = Ops::Add(Y, TY);
+                Z = Ops::Add(Z, TZ);
+            }
+            Ops::StoreVector3(Out + i, X, Y, Z);
+        }
+        return SimdCount;
+    }
+
+    template<typename Ops>
+    int32 TransformPositionsSIMD(const FTransform& Transform, const FVector* In, FVector* Out, int32 Count)
+    {
+        return TransformByTransformSIMD<Ops, true>(Transform, In, Out, Count);
+    }
+
+    template<typename Ops>
+    int32 TransformVectorsSIMD(const FTransform& Transform, const FVector* In, FVector* Out, int32 Count)
+    {
+        return TransformByTransformSIMD<Ops, false>(Transform, In, Out, Count);
+    }
+
+    template<typename Ops>
+    int32 TransformByMatrixSIMD(const FMatrix& Matrix, const FVector* In, FVector* Out, int32 Count)
+    {
+        using FReg = typename Ops::FReg;
+        FReg M[4][3];
+        for (int32 Row = 0; Row < 4; ++Row)
+        {
+            for (int32 Col = 0; Col < 3; ++Col)
+            {
+                M[Row][Col] = Ops::Set1(Matrix.M[Row][Col]);
+            }
+        }
+
+        const int32 SimdCount = Count - Count % Ops::Width;
+        for (int32 i = 0; i < SimdCount; i += Ops::Width)
+        {
+            FReg X, Y, Z;
+            Ops::LoadVector3(In + i, X, Y, Z);
+
+            // row-vector 규약: P' = P * M
+            FReg R[3];
+            for (int32 Col = 0; Col < 3; ++Col)
+            {
+                R[Col] = Ops::MulAdd(X, M[0][Col], Ops::MulAdd(Y, M[1][Col], Ops::MulAdd(Z, M[2][Col], M[3][Col])));
+            }
+            Ops::StoreVector3(Out + i, R[0], R[1], R[2]);
+        }
+        return SimdCount;
+    }
+
+    // FTransform::GetWorldTransform와 같은 식
+    // ParentStride가 0이면 Parents[0]을 모든 원소에 사용
+    template<typename Ops>
+    int32 ComposeTransformsSIMD(const FTransform* Parents, int32 ParentStride, const FTransform* Children, FTransform* Out, int32 Count)
+    {
+        using FReg = typename Ops::FReg;
+
+        FReg Parent[10];
+        if (ParentStride == 0)
+        {
+            const float* F = &Parents[0].Translation.X;
+            for (int32 c = 0; c < 10; ++c)
+            {
+                Parent[c] = Ops::Set1(F[c]);
+            }
+        }
+
+        const int32 SimdCount = Count - Count % Ops::Width;
+        for (int32 i = 0; i < SimdCount; i += Ops::Width)
+        {
+            if (ParentStride != 0)
+            {
+                Ops::LoadTransform(Parents + i, Parent);
+            }
+
+            FReg Child[10];
+            Ops::LoadTransform(Children + i, Child);
+
+            const FReg PX = Parent[3], PY = Parent[4], PZ = Parent[5], PW = Parent[6];
+            const FReg CX = Child[3], CY = Child[4], CZ = Child[5], CW = Child[6];
+
+            FReg Result[10];
+
+            // 회전: Parent * Child 후 정규화
+            FReg RX = Ops::MulAdd(PW, CX, Ops::NegMulAdd(PZ, CY, Ops::MulAdd(PX, CW, Ops::Mul(PY, CZ))));
+            FReg RY = Ops::NegMulAdd(PX, CZ, Ops::MulAdd(PW, CY, Ops::MulAdd(PY, CW, Ops::Mul(PZ, CX))));
+            FReg RZ = Ops::MulAdd(PW, CZ, Ops::NegMulAdd(PY, CX, Ops::MulAdd(PX, CY, Ops::Mul(PZ, CW))));
+            FReg RW = Ops::NegMulAdd(PX, CX, Ops::NegMulAdd(PY, CY, Ops::NegMulAdd(PZ, CZ, Ops::Mul(PW, CW))));
+            NormalizeQuatSoA<Ops>(RX, RY, RZ, RW);
+            Result[3] = RX; Result[4] = RY; Result[5] = RZ; Result[6] = RW;
+
+            // 스케일: 성분별 곱
+            Result[7] = Ops::Mul(Parent[7], Child[7]);
+            Result[8] = Ops::Mul(Parent[8], Child[8]);
+            Result[9] = Ops::Mul(Parent[9], Child[9]);
+
+            // 위치: Parent.T + Parent.R * (Parent.S * Child.T)
+            FReg VX = Ops::Mul(Child[0], Parent[7]);
+            FReg VY = Ops::Mul(Child[1], Parent[8]);
+            FReg VZ = Ops::Mul(Child[2], Parent[9]);
+            RotateSoA<Ops>(PX, PY, PZ, PW, VX, VY, VZ);
+            Result[0] = Ops::Add(Parent[0], VX);
+            Result[1] = Ops::Add(Parent[1], VY);
+            Result[2] = Ops::Add(Parent[2], VZ);
+
+            Ops::StoreTransform(Out + i, Result);
+        }
+        return SimdCount;
+    }
+
+    template<typename Ops>
+    int32 NlerpQuatsSIMD(const FQuat* A, const FQuat* B, float Alpha, FQuat* Out, int32 Count)
+    {
+        using FReg = typename Ops::FReg;
+        const FReg T = Ops::Set1(Alpha);
+
+        const int32 SimdCount = Count - Count % Ops::Width;
+        for (int32 i = 0; i < SimdCount; i += Ops::Width)
+        {
+            FReg AX, AY, AZ, AW, BX, BY, BZ, BW;
+            Ops::LoadQuat(A + i, AX, AY, AZ, AW);
+            Ops::LoadQuat(B + i, BX, BY, BZ, BW);
+
+            // 가장 짧은 호: 내적이 음수면 B의 부호를 뒤집음
+            const FReg Dot = Ops::MulAdd(AX, BX, Ops::MulAdd(AY, BY, Ops::MulAdd(AZ, BZ, Ops::Mul(AW, BW))));
+            const FReg Sign = Ops::NegativeSign(Dot);
+            BX = Ops::Xor(BX, Sign); BY = Ops::Xor(BY, Sign); BZ = Ops::Xor(BZ, Sign); BW = Ops::Xor(BW, Sign);
+
+            FReg X = Ops::MulAdd(Ops::Sub(BX, AX), T, AX);
+            FReg Y = Ops::MulAdd(Ops::Sub(BY, AY), T, AY);
+            FReg Z = Ops::MulAdd(Ops::Sub(BZ, AZ), T, AZ);
+            FReg W = Ops::MulAdd(Ops::Sub(BW, AW), T, AW);
+            NormalizeQuatSoA<Ops>(X, Y, Z, W);
+            Ops::StoreQuat(Out + i, X, Y, Z, W);
+        }
+        return SimdCount;
+    }
+
+    // sin(X), X in [0, PI/2] - 11차 테일러 다항식 (최대 오차 약 6e-8)
+    template<typename Ops, typename FReg = typename Ops::FReg>
+    inline FReg SinHalfPiSoA(FReg X)
+    {
+        const FReg X2 = Ops::Mul(X, X);
+        FReg P = Ops::Set1(-1.0f / 39916800.0f);
+        P = Ops::MulAdd(P, X2, Ops::Set1(1.0f / 362880.0f));
+        P = Ops::MulAdd(P, X2, Ops::Set1(-1.0f / 5040.0f));
+        P = Ops::MulAdd(P, X2, Ops::Set1(1.0f / 120.0f));
+        P = Ops::MulAdd(P, X2, Ops::Set1(-1.0f / 6.0f));
+        P = Ops::MulAdd(P, X2, Ops::Set1(1.0f));
+        return Ops::Mul(P, X);
+    }
+
+    // acos(X), X in [0, 1] - Abramowitz & Stegun 4.4.46 (최대 오차 약 2e-8)
+    template<typename Ops, typename FReg = typename Ops::FReg>
+    inline FReg AcosUnitSoA(FReg X)
+    {
+        FReg P = Ops::Set1(-0.0012624911f);
+        P = Ops::MulAdd(P, X, Ops::Set1(0.0066700901f));
+        P = Ops::MulAdd(P, X, Ops::Set1(-0.0170881256f));
+        P = Ops::MulAdd(P, X, Ops::Set1(0.0308918810f));
+        P = Ops::MulAdd(P, X, Ops::Set1(-0.0501743046f));
+        P = Ops::MulAdd(P, X, Ops::Set1(0.0889789874f));
+        P = Ops::MulAdd(P, X, Ops::Set1(-0.2145988016f));
+        P = Ops::MulAdd(P, X, Ops::Set1(1.5707963050f));
+        return Ops::Mul(P, Ops::Sqrt(Ops::Sub(Ops::Set1(1.0f), X)));
+    }
+
+    // FQuat::Slerp와 같은 규칙 (가장 짧은 호, 각이 작으면 Nlerp 가중치)
+    // 가장 짧은 호로 뒤집은 뒤의 각은 [0, PI/2]이므로 sin/acos 다항식의 정의역 안에 있습니다.
+    template<typename Ops>
+    int32 SlerpQuatsSIMD(const FQuat* A, const FQuat* B, float Alpha, FQuat* Out, int32 Count)
+    {
+        using FReg = typename Ops::FReg;
+        const FReg T = Ops::Set1(Alpha);
+        const FReg OneMinusT = Ops::Set1(1.0f - Alpha);
+        const FReg One = Ops::Set1(1.0f);
+        const FReg NlerpThreshold = Ops::Set1(1.0f - 1e-3f);
+
+        const int32 SimdCount = Count - Count % Ops::Width;
+        for (int32 i = 0; i < SimdCount; i += Ops::Width)
+        {
+            FReg AX, AY, AZ, AW, BX, BY, BZ, BW;
+            Ops::LoadQuat(A + i, AX, AY, AZ, AW);
+            Ops::LoadQuat(B + i, BX, BY, BZ, BW);
+
+            FReg CosTheta = Ops::MulAdd(AX, BX, Ops::MulAdd(AY, BY, Ops::MulAdd(AZ, BZ, Ops::Mul(AW, BW))));
+            const FReg Sign = Ops::NegativeSign(CosTheta);
+            BX = Ops::Xor(BX, Sign); BY = Ops::Xor(BY, Sign); BZ = Ops::Xor(BZ, Sign); BW = Ops::Xor(BW, Sign);
+            CosTheta = Ops::Min(Ops::Abs(CosTheta), One);
+
+            const FReg Theta = AcosUnitSoA<Ops>(CosTheta);
+            const FReg SinTheta = SinHalfPiSoA<Ops>(Theta);
+            FReg W1 = Ops::Div(SinHalfPiSoA<Ops>(Ops::Mul(OneMinusT, Theta)), SinTheta);
+            FReg W2 = Ops::Div(SinHalfPiSoA<Ops>(Ops::Mul(T, Theta)), SinTheta);
+
+            // 근접하면 Nlerp (SinTheta가 0에 가까운 레인의 inf/NaN도 여기서 버려짐)
+            const FReg bNear = Ops::CmpGt(CosTheta, NlerpThreshold);
+            W1 = Ops::Select(bNear, OneMinusT, W1);
+            W2 = Ops::Select(bNear, T, W2);
+
+            FReg X = Ops::MulAdd(AX, W1, Ops::Mul(BX, W2));
+            FReg Y = Ops::MulAdd(AY, W1, Ops::Mul(BY, W2));
+            FReg Z = Ops::MulAdd(AZ, W1, Ops::Mul(BZ, W2));
+            FReg W = Ops::MulAdd(AW, W1, Ops::Mul(BW, W2));
+            NormalizeQuatSoA<Ops>(X, Y, Z, W);
+            Ops::StoreQuat(Out + i, X, Y, Z, W);
+        }
+        return SimdCount;
+    }
+
+    template<typename Ops>
+    int32 TestAABBsAgainstPlanesSIMD(const FVector4* Planes, int32 PlaneCount, const FAABB* Bounds, int32 Count, uint8* OutVisible, int32& OutVisibleCount)
+    {
+        using FReg = typename Ops::FReg;
+        const FReg Half = Ops::Set1(0.5f);
+
+        OutVisibleCount = 0;
+        const int32 SimdCount = Count - Count % Ops::Width;
+        for (int32 i = 0; i < SimdCount; i += Ops::Width)
+        {
+            FReg Min[3], Max[3];
+            Ops::LoadAABB(Bounds + i, Min, Max);
+
+            FReg Center[3], Extents[3];
+            for (int32 Axis = 0; Axis < 3; ++Axis)
+            {
+                Center[Axis] = Ops::Mul(Ops::Add(Max[Axis], Min[Axis]), Half);
+                Extents[Axis] = Ops::Mul(Ops::Sub(Max[Axis], Min[Axis]), Half);
+            }
+
+            // 모든 평면에 대해 Distance + Radius >= 0 인 레인만 남김
+            int32 VisibleMask = (1 << Ops::Width) - 1;
+            for (int32 p = 0; p < PlaneCount && VisibleMask != 0; ++p)
+            {
+                const FVector4& Plane = Planes[p];
+                const FReg NX = Ops::Set1(Plane.X), NY = Ops::Set1(Plane.Y), NZ = Ops::Set1(Plane.Z);
+                const FReg AbsNX = Ops::Set1(std::abs(Plane.X)), AbsNY = Ops::Set1(std::abs(Plane.Y)), AbsNZ = Ops::Set1(std::abs(Plane.Z));
+
+                const FReg Distance = Ops::MulAdd(NX, Center[0], Ops::MulAdd(NY, Center[1], Ops::Sub(Ops::Mul(NZ, Center[2]), Ops::Set1(Plane.W))));
+                const FReg Radius = Ops::MulAdd(AbsNX, Extents[0], Ops::MulAdd(AbsNY, Extents[1], Ops::Mul(AbsNZ, Extents[2])));
+                VisibleMask &= Ops::MoveMask(Ops::CmpGe(Ops::Add(Distance, Radius), Ops::Set1(0.0f)));
+            }
+
+            for (int32 Lane = 0; Lane < Ops::Width; ++Lane)
+            {
+                const uint8 bVisible = static_cast<uint8>((VisibleMask >> Lane) & 1);
+                OutVisible[i + Lane] = bVisible;
+                OutVisibleCount += bVisible;
+            }
+        }
+        return SimdCount;
+    }
+}
+
+#endif // MATH_BATCH_SIMD
+
+// ============================================================================
+// CPU 기능 검사 / 디스패치
+// ============================================================================
+
+namespace
+{
+    ESimdLevel DetectSimdLevel()
+    {
+#if MATH_BATCH_SIMD
+    #if defined(_MSC_VER)
+        int32 CpuInfo[4] = {};
+        __cpuid(CpuInfo, 0);
+        const int32 MaxLeaf = CpuInfo[0];
+
+        __cpuid(CpuInfo, 1);
+        const bool bSSE41 = (CpuInfo[2] & (1 << 19)) != 0;
+        const bool bFMA = (CpuInfo[2] & (1 << 12)) != 0;
+        const bool bOSXSave = (CpuInfo[2] & (1 << 27)) != 0;
+        const bool bAVX = (CpuInfo[2] & (1 << 28)) != 0;
+
+        bool bAVX2 = false;
+        if (MaxLeaf >= 7)
+        {
+            __cpuidex(CpuInfo, 7, 0);
+            bAVX2 = (CpuInfo[1] & (1 << 5)) != 0;
+        }
+
+        // OS가 YMM 레지스터 상태를 저장해 주는지 확인
+        const bool bOSSupportsYMM = bOSXSave && bAVX && (_xgetbv(0) & 0x6) == 0x6;
+    #else
+        const bool bSSE41 = __builtin_cpu_supports("sse4.1");
+        const bool bFMA = __builtin_cpu_supports("fma");
+        const bool bAVX2 = __builtin_cpu_supports("avx2");
+        const bool bOSSupportsYMM = __builtin_cpu_supports("avx");
+    #endif
+
+    #if MATH_BATCH_AVX2
+        if (bAVX2 && bFMA && bOSSupportsYMM)
+        {
+            return ESimdLevel::AVX2;
+        }
+    #endif
+        if (bSSE41)
+        {
+            return ESimdLevel::SSE4;
+        }
+#endif // MATH_BATCH_SIMD
+        return ESimdLevel::Scalar;
+    }
+
+    std::atomic<ESimdLevel>& ActiveSimdLevel()
+    {
+        static std::atomic<ESimdLevel> Level{ FMathBatch::GetSupportedSimdLevel() };
+        return Level;
+    }
+}
+
+// 현재 수준에 맞는 SIMD 커널을 호출하고, SIMD로 처리한 원소 수를 Processed에 저장
+#if MATH_BATCH_SIMD && MATH_BATCH_AVX2
+    #define MATH_BATCH_DISPATCH(Processed, Kernel, ...) \
+        switch (GetSimdLevel()) \
+        { \
+        case ESimdLevel::AVX2: Processed = Kernel<FSimd8>(__VA_ARGS__); break; \
+        case ESimdLevel::SSE4: Processed = Kernel<FSimd4>(__VA_ARGS__); break; \
+        default: Processed = 0; break; \
+        }
+#elif MATH_BATCH_SIMD
+    #define MATH_BATCH_DISPATCH(Processed, Kernel, ...) \
+        Processed = (GetSimdLevel() == ESimdLevel::SSE4) ? Kernel<FSimd4>(__VA_ARGS__) : 0;
+#else
+    #define MATH_BATCH_DISPATCH(Processed, Kernel, ...) \
+        Processed = 0;
+#endif
+
+// 4-wide 커널만 사용 (AVX2 수준에서도 SSE 커널로 처리)
+#if MATH_BATCH_SIMD
+    #define MATH_BATCH_DISPATCH_SSE4(Processed, Kernel, ...) \
+        Processed = (GetSimdLevel() != ESimdLevel::Scalar) ? Kernel<FSimd4>(__VA_ARGS__) : 0;
+#else
+    #define MATH_BATCH_DISPATCH_SSE4(Processed, Kernel, ...) \
+        Processed = 0;
+#endif
+
+namespace FMathBatch
+{
+    ESimdLevel GetSupportedSimdLevel()
+    {
+        static const ESimdLevel Supported = DetectSimdLevel();
+        return Supported;
+    }
+
+    ESimdLevel GetSimdLevel()
+    {
+        return ActiveSimdLevel().load(std::memory_order_relaxed);
+    }
+
+    void SetSimdLevel(ESimdLevel Level)
+    {
+        const ESimdLevel Supported = GetSupportedSimdLevel();
+        ActiveSimdLevel().store(static_cast<uint8>(Level) > static_cast<uint8>(Supported) ? Supported : Level, std::memory_order_relaxed);
+    }
+
+    const char* GetSimdLevelName(ESimdLevel Level)
+    {
+        switch (Level)
+        {
+        case ESimdLevel::Scalar: return "Scalar";
+        case ESimdLevel::SSE4:   return "SSE4";
+        case ESimdLevel::AVX2:   return "AVX2";
+        }
+        return "Unknown";
+    }
+
+    void TransformPositions(const FTransform& Transform, const FVector* In, FVector* Out, int32 Count)
+    {
+        int32 Processed = 0;
+        MATH_BATCH_DISPATCH(Processed, TransformPositionsSIMD, Transform, In, Out, Count);
+        TransformPositionsScalar(Transform, In, Out, Processed, Count);
+    }
+
+    void TransformVectors(const FTransform& Transform, const FVector* In, FVector* Out, int32 Count)
+    {
+        int32 Processed = 0;
+        MATH_BATCH_DISPATCH(Processed, TransformVectorsSIMD, Transform, In, Out, Count);
+        TransformVectorsScalar(Transform, In, Out, Processed, Count);
+    }
+
+    void TransformPositions(const FMatrix& Matrix, const FVector* In, FVector* Out, int32 Count)
+    {
+        int32 Processed = 0;
+        MATH_BATCH_DISPATCH(Processed, TransformByMatrixSIMD, Matrix, In, Out, Count);
+        TransformPositionsScalar(Matrix, In, Out, Processed, Count);
+    }
+
+    void ComposeTransforms(const FTransform* Parents, const FTransform* Children, FTransform* Out, int32 Count)
+    {
+        // FTransform은 성분이 10개라 8-wide로 처리하면 입력/출력 레지스터가 모자라 스필이 생기고
+        // 전치 비용이 커져 오히려 느려지므로 AVX2 수준에서도 4-wide 커널을 사용합니다.
+        int32 Processed = 0;
+        MATH_BATCH_DISPATCH_SSE4(Processed, ComposeTransformsSIMD, Parents, 1, Children, Out, Count);
+        ComposeTransformsScalar(Parents, 1, Children, Out, Processed, Count);
+    }
+
+    void ComposeTransforms(const FTransform& Parent, const FTransform* Children, FTransform* Out, int32 Count)
+    {
+        // Out이 Parent를 가리키는 배열이어도 안전하도록 복사해 둠
+        const FTransform ParentCopy = Parent;
+        int32 Processed = 0;
+        MATH_BATCH_DISPATCH_SSE4(Processed, ComposeTransformsSIMD, &ParentCopy, 0, Children, Out, Count);
+        ComposeTransformsScalar(&ParentCopy, 0, Children, Out, Processed, Count);
+    }
+
+    void NlerpQuats(const FQuat* A, const FQuat* B, float Alpha, FQuat* Out, int32 Count)
+    {
+        int32 Processed = 0;
+        MATH_BATCH_DISPATCH(Processed, NlerpQuatsSIMD, A, B, Alpha, Out, Count);
+        NlerpQuatsScalar(A, B, Alpha, Out, Processed, Count);
+    }
+
+    void SlerpQuats(const FQuat* A, const FQuat* B, float Alpha, FQuat* Out, int32 Count)
+    {
+        int32 Processed = 0;
+        MATH_BATCH_DISPATCH(Processed, SlerpQuatsSIMD, A, B, Alpha, Out, Count);
+        SlerpQuatsScalar(A, B, Alpha, Out, Processed, Count);
+    }
+
+    int32 TestAABBsAgainstPlanes(const FVector4* Planes, int32 PlaneCount, const FAABB* Bounds, int32 Count, uint8* OutVisible)
+    {
+        int32 VisibleCount = 0;
+        int32 Processed = 0;
+        MATH_BATCH_DISPATCH(Processed, TestAABBsAgainstPlanesSIMD, Planes, PlaneCount, Bounds, Count, OutVisible, VisibleCount);
+        return VisibleCount + TestAABBsAgainstPlanesScalar(Planes, PlaneCount, Bounds, OutVisible, Processed, Count);
+    }
+}
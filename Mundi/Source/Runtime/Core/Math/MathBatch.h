@@ -0,0 +1,81 @@
+﻿#pragma once
+
+#include "Vector.h"
+
+struct FAABB;
+
+// SIMD 배치 커널 빌드 여부 (x64가 아니면 스칼라 구현만 컴파일)
+#if !defined(MATH_BATCH_SIMD)
+    #if defined(_M_X64) || defined(__x86_64__)
+        #define MATH_BATCH_SIMD 1
+    #else
+        #define MATH_BATCH_SIMD 0
+    #endif
+#endif
+
+// AVX2 경로 빌드 여부
+// MSVC는 /arch 옵션 없이도 AVX2 인트린식을 허용하므로 항상 빌드하고 런타임에 CPU를 검사해 선택합니다.
+#if !defined(MATH_BATCH_AVX2)
+    #if MATH_BATCH_SIMD && (defined(_MSC_VER) || (defined(__AVX2__) && defined(__FMA__)))
+        #define MATH_BATCH_AVX2 1
+    #else
+        #define MATH_BATCH_AVX2 0
+    #endif
+#endif
+
+enum class ESimdLevel : uint8
+{
+    Scalar,     // 기존 FVector/FQuat/FTransform 멤버 함수를 원소마다 호출
+    SSE4,       // 4개씩 SoA로 처리
+    AVX2,       // 8개씩 SoA로 처리 (FMA 사용)
+};
+
+// -------------------------------------------
+// FMathBatch - 배열 단위 수학 커널
+// -------------------------------------------
+// 본, 파티클, 컬링처럼 같은 연산을 많은 원소에 반복하는 루프용입니다.
+// 입력을 4개(SSE4) 또는 8개(AVX2)씩 AoS -> SoA로 전치해서 계산하고,
+// 남은 원소와 SIMD를 지원하지 않는 CPU는 기존 스칼라 구현으로 처리합니다.
+// 결과는 스칼라 구현과 부동소수점 오차 범위 내에서 같습니다 (FMA/다항식 근사 차이).
+// 모든 함수는 Out이 입력 배열과 같은 배열이어도 안전합니다 (제자리 변환 가능).
+// -------------------------------------------
+namespace FMathBatch
+{
+    // CPU가 지원하는 최고 수준
+    ESimdLevel GetSupportedSimdLevel();
+
+    // 현재 사용 중인 수준 (기본값 = 지원하는 최고 수준)
+    ESimdLevel GetSimdLevel();
+
+    // 사용할 수준을 강제로 지정 (벤치마크/디버깅용). 지원하지 않는 수준은 지원 범위로 낮춰집니다.
+    void SetSimdLevel(ESimdLevel Level);
+
+    const char* GetSimdLevelName(ESimdLevel Level);
+
+    // Out[i] = Transform.TransformPosition(In[i])
+    void TransformPositions(const FTransform& Transform, const FVector* In, FVector* Out, int32 Count);
+
+    // Out[i] = Transform.TransformVector(In[i])
+    void TransformVectors(const FTransform& Transform, const FVector* In, FVector* Out, int32 Count);
+
+    // Out[i] = Matrix.TransformPosition(In[i])
+    void TransformPositions(const FMatrix& Matrix, const FVector* In, FVector* Out, int32 Count);
+
+    // Out[i] = Parents[i].GetWorldTransform(Children[i])
+    void ComposeTransforms(const FTransform* Parents, const FTransform* Children, FTransform* Out, int32 Count);
+
+    // Out[i] = Parent.GetWorldTransform(Children[i])
+    void ComposeTransforms(const FTransform& Parent, const FTransform* Children, FTransform* Out, int32 Count);
+
+    // Out[i] = FQuat::Nlerp(A[i], B[i], Alpha)
+    void NlerpQuats(const FQuat* A, const FQuat* B, float Alpha, FQuat* Out, int32 Count);
+
+    // Out[i] = FQuat::Slerp(A[i], B[i], Alpha)
+    void SlerpQuats(const FQuat* A, const FQuat* B, float Alpha, FQuat* Out, int32 Count);
+
+    // 평면 집합에 대한 AABB 가시성 검사
+    // Planes[p]는 (Normal.X, Normal.Y, Normal.Z, Distance)이고, dot(N, X) - D >= 0 이 안쪽입니다.
+    // 모든 평면의 안쪽(또는 걸침)이면 OutVisible[i] = 1, 하나라도 완전히 바깥이면 0.
+    // 보이는 박스 개수를 반환합니다.
+    int32 TestAABBsAgainstPlanes(const FVector4* Planes, int32 PlaneCount, const FAABB* Bounds, int32 Count, uint8* OutVisible);
+}
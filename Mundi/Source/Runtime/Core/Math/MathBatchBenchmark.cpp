@@ -0,0 +1,251 @@
+﻿#include "pch.h"
+#include "MathBatchBenchmark.h"
+#include "AABB.h"
+#include "PlatformTime.h"
+
+namespace
+{
+    struct FBenchmarkData
+    {
+        TArray<FVector> Points;
+        TArray<FVector> OutPoints;
+        TArray<FTransform> Parents;
+        TArray<FTransform> Children;
+        TArray<FTransform> OutTransforms;
+        TArray<FQuat> QuatsA;
+        TArray<FQuat> QuatsB;
+        TArray<FQuat> OutQuats;
+        TArray<FAABB> Bounds;
+        TArray<uint8> OutVisible;
+        FTransform Transform;
+        FMatrix Matrix;
+        FVector4 Planes[6];
+    };
+
+    FQuat MakeRandomQuat(FRandomStream& Stream)
+    {
+        FQuat Quat(Stream.FRandRange(-1.0f, 1.0f), Stream.FRandRange(-1.0f, 1.0f), Stream.FRandRange(-1.0f, 1.0f), Stream.FRandRange(-1.0f, 1.0f));
+        Quat.Normalize();
+        return Quat;
+    }
+
+    FVector MakeRandomVector(FRandomStream& Stream, float Min, float Max)
+    {
+        const float X = Stream.FRandRange(Min, Max);
+        const float Y = Stream.FRandRange(Min, Max);
+        const float Z = Stream.FRandRange(Min, Max);
+        return FVector(X, Y, Z);
+    }
+
+    FTransform MakeRandomTransform(FRandomStream& Stream)
+    {
+        const FVector Translation = MakeRandomVector(Stream, -100.0f, 100.0f);
+        const FQuat Rotation = MakeRandomQuat(Stream);
+        const FVector Scale = MakeRandomVector(Stream, 0.5f, 2.0f);
+        return FTransform(Translation, Rotation, Scale);
+    }
+
+    // 매 실행 같은 데이터로 비교하도록 고정 시드 사용
+    void BuildBenchmarkData(FBenchmarkData& Data, int32 Count)
+    {
+        FRandomStream Stream(0x4D617468ull);
+
+        Data.Points.SetNum(Count);
+        Data.OutPoints.SetNum(Count);
+        Data.Parents.SetNum(Count);
+        Data.Children.SetNum(Count);
+        Data.OutTransforms.SetNum(Count);
+        Data.QuatsA.SetNum(Count);
+        Data.QuatsB.SetNum(Count);
+        Data.OutQuats.SetNum(Count);
+        Data.Bounds.SetNum(Count);
+        Data.OutVisible.SetNum(Count);
+
+        for (int32 i = 0; i < Count; ++i)
+        {
+            Data.Points[i] = MakeRandomVector(Stream, -100.0f, 100.0f);
+            Data.Parents[i] = MakeRandomTransform(Stream);
+            Data.Children[i] = MakeRandomTransform(Stream);
+            Data.QuatsA[i] = MakeRandomQuat(Stream);
+            Data.QuatsB[i] = MakeRandomQuat(Stream);
+
+            const FVector Center = MakeRandomVector(Stream, -200.0f, 200.0f);
+            const FVector HalfExtent = MakeRandomVector(Stream, 1.0f, 20.0f);
+            Data.Bounds[i] = FAABB(Center - HalfExtent, Center + HalfExtent);
+        }
+
+        Data.Transform = MakeRandomTransform(Stream);
+        Data.Matrix = Data.Transform.ToMatrix();
+
+        // 원점 근처를 감싸는 절두체 비슷한 평면 6개 (일부 박스만 통과)
+        for (int32 p = 0; p < 6; ++p)
+        {
+            const FVector Normal = MakeRandomVector(Stream, -1.0f, 1.0f).GetNormalized();
+            Data.Planes[p] = FVector4(Normal.X, Normal.Y, Normal.Z, Stream.FRandRange(-150.0f, 0.0f));
+        }
+    }
+
+    // Iterations번 실행한 1회 평균 시간 (us)
+    template<typename FunctionType>
+    double MeasureMicroseconds(int32 Iterations, FunctionType&& Function)
+    {
+        // 캐시 워밍업
+        Function();
+
+        const uint64 StartCycles = FPlatformTime::Cycles64();
+        for (int32 Iteration = 0; Iteration < Iterations; ++Iteration)
+        {
+            Function();
+        }
+        const uint64 EndCycles = FPlatformTime::Cycles64();
+        return FPlatformTime::ToMilliseconds(EndCycles - StartCycles) * 1000.0 / Iterations;
+    }
+
+    float MaxDifference(const FVector& A, const FVector& B)
+    {
+        return std::max({ std::abs(A.X - B.X), std::abs(A.Y - B.Y), std::abs(A.Z - B.Z) });
+    }
+
+    float MaxDifference(const FQuat& A, const FQuat& B)
+    {
+        return std::max({ std::abs(A.X - B.X), std::abs(A.Y - B.Y), std::abs(A.Z - B.Z), std::abs(A.W - B.W) });
+    }
+
+    float MaxDifference(const FTransform& A, const FTransform& B)
+    {
+        return std::max({ MaxDifference(A.Translation, B.Translation), MaxDifference(A.Rotation, B.Rotation), MaxDifference(A.Scale3D, B.Scale3D) });
+    }
+
+    // 스칼라 루프 결과를 기준으로 각 SIMD 수준의 배치 커널을 측정하고 오차를 기록
+    // ScalarLoop: 기존 코드 방식으로 Output을 채움
+    // BatchKernel: FMathBatch 커널로 Output을 채움
+    template<typename ElementType, typename ScalarLoopType, typename BatchKernelType, typename CompareType>
+    FMathBatchBenchmarkResult RunCase(const char* Name, int32 Iterations, TArray<ElementType>& Output,
+        ScalarLoopType&& ScalarLoop, BatchKernelType&& BatchKernel, CompareType&& Compare)
+    {
+        FMathBatchBenchmarkResult Result;
+        Result.Name = Name;
+
+        Result.ScalarMicroseconds = MeasureMicroseconds(Iterations, ScalarLoop);
+        const TArray<ElementType> Expected = Output;
+
+        const ESimdLevel Supported = FMathBatch::GetSupportedSimdLevel();
+        for (ESimdLevel Level : { ESimdLevel::SSE4, ESimdLevel::AVX2 })
+        {
+            if (static_cast<uint8>(Level) > static_cast<uint8>(Supported))
+            {
+                continue;
+            }
+
+            FMathBatch::SetSimdLevel(Level);
+            const double Microseconds = MeasureMicroseconds(Iterations, BatchKernel);
+            (Level == ESimdLevel::SSE4 ? Result.SSE4Microseconds : Result.AVX2Microseconds) = Microseconds;
+
+            for (int32 i = 0; i < Output.Num(); ++i)
+            {
+                Compare(Expected[i], Output[i], Result);
+            }
+        }
+        return Result;
+    }
+}
+
+namespace FMathBatchBenchmark
+{
+    TArray<FMathBatchBenchmarkResult> Run(int32 Count, int32 Iterations)
+    {
+        TArray<FMathBatchBenchmarkResult> Results;
+        if (Count <= 0 || Iterations <= 0)
+        {
+            return Results;
+        }
+
+        FBenchmarkData Data;
+        BuildBenchmarkData(Data, Count);
+
+        const ESimdLevel PreviousLevel = FMathBatch::GetSimdLevel();
+        const float Alpha = 0.37f;
+
+        auto CompareFloat = [](const auto& Expected, const auto& Actual, FMathBatchBenchmarkResult& Result)
+        {
+            Result.MaxError = std::max(Result.MaxError, MaxDifference(Expected, Actual));
+        };
+
+        Results.Add(RunCase("TransformPosition (FTransform)", Iterations, Data.OutPoints,
+            [&]() { for (int32 i = 0; i < Count; ++i) { Data.OutPoints[i] = Data.Transform.TransformPosition(Data.Points[i]); } },
+            [&]() { FMathBatch::TransformPositions(Data.Transform, Data.Points.data(), Data.OutPoints.data(), Count); },
+            CompareFloat));
+
+        Results.Add(RunCase("TransformPosition (FMatrix)", Iterations, Data.OutPoints,
+            [&]() { for (int32 i = 0; i < Count; ++i) { Data.OutPoints[i] = Data.Matrix.TransformPosition(Data.Points[i]); } },
+            [&]() { FMathBatch::TransformPositions(Data.Matrix, Data.Points.data(), Data.OutPoints.data(), Count); },
+            CompareFloat));
+
+        Results.Add(RunCase("ComposeTransforms", Iterations, Data.OutTransforms,
+            [&]() { for (int32 i = 0; i < Count; ++i) { Data.OutTransforms[i] = Data.Parents[i].GetWorldTransform(Data.Children[i]); } },
+            [&]() { FMathBatch::ComposeTransforms(Data.Parents.data(), Data.Children.data(), Data.OutTransforms.data(), Count); },
+            CompareFloat));
+
+        Results.Add(RunCase("NlerpQuats", Iterations, Data.OutQuats,
+            [&]() { for (int32 i = 0; i < Count; ++i) { Data.OutQuats[i] = FQuat::Nlerp(Data.QuatsA[i], Data.QuatsB[i], Alpha); } },
+            [&]() { FMathBatch::NlerpQuats(Data.QuatsA.data(), Data.QuatsB.data(), Alpha, Data.OutQuats.data(), Count); },
+            CompareFloat));
+
+        Results.Add(RunCase("SlerpQuats", Iterations, Data.OutQuats,
+            [&]() { for (int32 i = 0; i < Count; ++i) { Data.OutQuats[i] = FQuat::Slerp(Data.QuatsA[i], Data.QuatsB[i], Alpha); } },
+            [&]() { FMathBatch::SlerpQuats(Data.QuatsA.data(), Data.QuatsB.data(), Alpha, Data.OutQuats.data(), Count); },
+            CompareFloat));
+
+        // 기존 스칼라 절두체 검사(IsAABBVisible)와 같은 식을 원소마다 수행
+        Results.Add(RunCase("AABB vs 6 Planes", Iterations, Data.OutVisible,
+            [&]()
+            {
+                for (int32 i = 0; i < Count; ++i)
+                {
+                    const FVector Center = Data.Bounds[i].GetCenter();
+                    const FVector Extents = Data.Bounds[i].GetHalfExtent();
+                    bool bVisible = true;
+                    for (int32 p = 0; p < 6 && bVisible; ++p)
+                    {
+                        const FVector4& Plane = Data.Planes[p];
+                        const float Distance = Plane.X * Center.X + Plane.Y * Center.Y + Plane.Z * Center.Z - Plane.W;
+                        const float Radius = std::abs(Plane.X) * Extents.X + std::abs(Plane.Y) * Extents.Y + std::abs(Plane.Z) * Extents.Z;
+                        bVisible = Distance + Radius >= 0.0f;
+                    }
+                    Data.OutVisible[i] = bVisible ? 1 : 0;
+                }
+            },
+            [&]() { FMathBatch::TestAABBsAgainstPlanes(Data.Planes, 6, Data.Bounds.data(), Count, Data.OutVisible.data()); },
+            [](uint8 Expected, uint8 Actual, FMathBatchBenchmarkResult& Result)
+            {
+                Result.Mismatches += (Expected != Actual) ? 1 : 0;
+            }));
+
+        FMathBatch::SetSimdLevel(PreviousLevel);
+        return Results;
+    }
+
+    FString FormatResult(const FMathBatchBenchmarkResult& Result)
+    {
+        char Buffer[256];
+        int32 Length = snprintf(Buffer, sizeof(Buffer), "%-30s Scalar %8.2fus", Result.Name.c_str(), Result.ScalarMicroseconds);
+
+        const auto AppendLevel = [&](const char* LevelName, double Microseconds)
+        {
+            if (Microseconds < 0.0 || Length >= static_cast<int32>(sizeof(Buffer)))
+            {
+                return;
+            }
+            const double Speedup = Microseconds > 0.0 ? Result.ScalarMicroseconds / Microseconds : 0.0;
+            Length += snprintf(Buffer + Length, sizeof(Buffer) - Length, " | %s %8.2fus (%.1fx)", LevelName, Microseconds, Speedup);
+        };
+        AppendLevel("SSE4", Result.SSE4Microseconds);
+        AppendLevel("AVX2", Result.AVX2Microseconds);
+
+        if (Length < static_cast<int32>(sizeof(Buffer)))
+        {
+            snprintf(Buffer + Length, sizeof(Buffer) - Length, " | err %.1e, mismatch %d", Result.MaxError, Result.Mismatches);
+        }
+        return FString(Buffer);
+    }
+}
@@ -0,0 +1,25 @@
+﻿#pragma once
+
+#include "MathBatch.h"
+
+// FMathBatch 커널과 기존 스칼라 코드(원소마다 멤버 함수 호출)의 속도 비교 결과
+struct FMathBatchBenchmarkResult
+{
+    FString Name;
+    double ScalarMicroseconds = 0.0;    // 기존 스칼라 루프, 1회 평균
+    double SSE4Microseconds = -1.0;     // 지원하지 않으면 음수
+    double AVX2Microseconds = -1.0;
+    float MaxError = 0.0f;              // 스칼라 결과 대비 최대 절대 오차 (SIMD 경로 전체)
+    int32 Mismatches = 0;               // AABB 검사처럼 결과가 불리언인 경우 불일치 개수
+};
+
+// 콘솔 명령 "BENCH MATH"에서 사용
+namespace FMathBatchBenchmark
+{
+    // Count개 원소 배열로 각 커널을 Iterations번 실행해 측정합니다.
+    // 측정 동안 SIMD 수준을 바꾸고, 끝나면 원래 수준으로 되돌립니다.
+    TArray<FMathBatchBenchmarkResult> Run(int32 Count = 4096, int32 Iterations = 200);
+
+    // 결과 한 줄 포맷: "Name  Scalar 12.3us | SSE4 4.5us (2.7x) | AVX2 2.1us (5.9x) | err 1.2e-06"
+    FString FormatResult(const FMathBatchBenchmarkResult& Result);
+}
@@ -0,0 +1,126 @@
+﻿#pragma once
+
+#include <chrono>
+#include <atomic>
+#include <thread>
+
+#include "UEContainer.h"
+
+// -------------------------------------------
+// FRandomStream - 시드 가능한 PCG32 난수 스트림
+// -------------------------------------------
+// rand()와 달리 상태를 객체가 소유하므로 스트림끼리 독립적이고 스레드 안전합니다.
+// 같은 (Seed, StreamId)는 어떤 스레드에서 실행되든 항상 같은 수열을 만듭니다.
+// StreamId가 다르면 시드가 같아도 서로 겹치지 않는 수열이 생성됩니다
+// (예: 파티클 시스템 시드 + 에미터 인덱스).
+// -------------------------------------------
+struct FRandomStream
+{
+    FRandomStream() { Initialize(0x853C49E6748FEA9Bull, 0); }
+    FRandomStream(uint64 InSeed, uint64 InStreamId = 0) { Initialize(InSeed, InStreamId); }
+
+    void Initialize(uint64 InSeed, uint64 InStreamId = 0)
+    {
+        Seed = InSeed;
+        StreamId = InStreamId;
+
+        State = 0;
+        Increment = (InStreamId << 1u) | 1u;
+        GetUnsignedInt();
+        State += InSeed;
+        GetUnsignedInt();
+    }
+
+    // 처음 시드 상태로 되돌림 (같은 수열을 다시 재생)
+    void Reset() { Initialize(Seed, StreamId); }
+
+    uint64 GetSeed() const { return Seed; }
+    uint64 GetStreamId() const { return StreamId; }
+
+    // [0, 2^32) 균등 분포 정수
+    uint32 GetUnsignedInt()
+    {
+        const uint64 OldState = State;
+        State = OldState * 6364136223846793005ull + Increment;
+        const uint32 XorShifted = static_cast<uint32>(((OldState >> 18u) ^ OldState) >> 27u);
+        const uint32 Rot = static_cast<uint32>(OldState >> 59u);
+        return (XorShifted >> Rot) | (XorShifted << ((0u - Rot) & 31u));
+    }
+
+    // [0, 1) 균등 분포 실수 (상위 24비트 사용 - float 가수부 정밀도와 동일)
+    float GetFraction()
+    {
+        return static_cast<float>(GetUnsignedInt() >> 8) * (1.0f / 16777216.0f);
+    }
+
+    // [Min, Max) 실수
+    float FRandRange(float Min, float Max)
+    {
+        return Min + (Max - Min) * GetFraction();
+    }
+
+    // [Min, Max] 정수 (양 끝 포함)
+    int32 RandRange(int32 Min, int32 Max)
+    {
+        if (Max <= Min)
+            return Min;
+
+        const uint32 Range = static_cast<uint32>(Max - Min) + 1u;
+        return Min + static_cast<int32>((static_cast<uint64>(GetUnsignedInt()) * Range) >> 32);
+    }
+
+    // [0, 1) 실수 Count개를 한 번에 생성
+    // 정수 생성과 실수 변환을 분리해 변환 루프가 SIMD로 벡터화되도록 합니다.
+    void FillFractions(float* OutValues, int32 Count)
+    {
+        constexpr int32 BatchSize = 64;
+        uint32 Bits[BatchSize];
+
+        for (int32 Start = 0; Start < Count; Start += BatchSize)
+        {
+            const int32 Num = (Count - Start < BatchSize) ? Count - Start : BatchSize;
+            for (int32 i = 0; i < Num; ++i)
+            {
+                Bits[i] = GetUnsignedInt();
+            }
+            for (int32 i = 0; i < Num; ++i)
+            {
+                OutValues[Start + i] = static_cast<float>(Bits[i] >> 8) * (1.0f / 16777216.0f);
+            }
+        }
+    }
+
+    // [Min, Max) 실수 Count개를 한 번에 생성
+    void FillRange(float* OutValues, int32 Count, float Min, float Max)
+    {
+        FillFractions(OutValues, Count);
+
+        const float Range = Max - Min;
+        for (int32 i = 0; i < Count; ++i)
+        {
+            OutValues[i] = Min + Range * OutValues[i];
+        }
+    }
+
+    // 스레드마다 독립적인 기본 스트림 (명시적인 스트림이 없는 호출용, 재현성 없음)
+    static FRandomStream& GetThreadStream()
+    {
+        thread_local FRandomStream ThreadStream(GenerateSeed(),
+            static_cast<uint64>(std::hash<std::thread::id>()(std::this_thread::get_id())));
+        return ThreadStream;
+    }
+
+    // 재현이 필요 없을 때 쓰는 새 시드 (시간 + 호출 카운터)
+    static uint64 GenerateSeed()
+    {
+        static std::atomic<uint64> Counter{ 0 };
+        const uint64 Time = static_cast<uint64>(std::chrono::high_resolution_clock::now().time_since_epoch().count());
+        return Time ^ (Counter.fetch_add(1, std::memory_order_relaxed) * 0x9E3779B97F4A7C15ull);
+    }
+
+private:
+    uint64 State = 0;
+    uint64 Increment = 1;
+    uint64 Seed = 0;
+    uint64 StreamId = 0;
+};
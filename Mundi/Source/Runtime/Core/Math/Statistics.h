@@ -1,6 +1,7 @@
 ﻿#pragma once
 
 #include "Vector.h"
+#include "RandomStream.h"
 
 // -------------------------------------------
 // EDistributionMode - 분포 모드
@@ -32,9 +33,17 @@ struct FInterpCurvePoint
 // -------------------------------------------
 // FInterpCurve - 키프레임 기반 보간 커브
 // -------------------------------------------
+// 키를 추가/로드/편집한 뒤 Bake()를 호출하면 [첫 키, 마지막 키] 구간을
+// 고정 해상도로 샘플링한 룩업 테이블을 만들고, 이후 Eval은 테이블 두 칸 사이의
+// 선형 보간만 수행합니다 (키 개수와 무관한 상수 시간).
+// Points를 직접 수정한 경우 반드시 Bake()를 다시 호출해야 합니다.
+// -------------------------------------------
 template <typename T>
 struct FInterpCurve
 {
+    // 룩업 테이블 샘플 개수
+    static constexpr int32 LookupTableSize = 256;
+
     TArray<FInterpCurvePoint<T>> Points;
 
     // 키프레임 추가
@@ -47,10 +56,66 @@ struct FInterpCurve
             {
                 return A.InVal < B.InVal;
             });
+        Bake();
+    }
+
+    // 현재 키로 룩업 테이블 생성 (키가 2개 미만이거나 시간 범위가 0이면 테이블 없음)
+    void Bake()
+    {
+        LookupTable.Empty();
+        BakedKeyCount = Points.Num();
+
+        if (Points.Num() < 2)
+            return;
+
+        const float StartTime = Points[0].InVal;
+        const float EndTime = Points[Points.Num() - 1].InVal;
+        if (!(EndTime > StartTime))
+            return;
+
+        const float Step = (EndTime - StartTime) / static_cast<float>(LookupTableSize - 1);
+        LookupTable.SetNum(LookupTableSize);
+        for (int32 i = 0; i < LookupTableSize; ++i)
+        {
+            LookupTable[i] = EvalKeys(StartTime + Step * static_cast<float>(i));
+        }
+
+        LookupStartTime = StartTime;
+        LookupTimeScale = 1.0f / Step;
     }
 
+    bool IsBaked() const { return !LookupTable.IsEmpty() && BakedKeyCount == Points.Num(); }
+
     // 시간에 따른 보간 값 반환
     T Eval(float InTime) const
+    {
+        // 키 개수가 바뀌었는데 Bake되지 않았다면 키를 직접 평가 (안전장치)
+        if (IsBaked())
+            return EvalTable(InTime);
+
+        return EvalKeys(InTime);
+    }
+
+    // 여러 시간을 한 번에 평가 (모듈의 일괄 처리용)
+    void EvalMany(const float* InTimes, T* OutValues, int32 Count) const
+    {
+        if (IsBaked())
+        {
+            for (int32 i = 0; i < Count; ++i)
+            {
+                OutValues[i] = EvalTable(InTimes[i]);
+            }
+            return;
+        }
+
+        for (int32 i = 0; i < Count; ++i)
+        {
+            OutValues[i] = EvalKeys(InTimes[i]);
+        }
+    }
+
+    // 키를 직접 선형 탐색하여 평가 (Bake 및 검증용)
+    T EvalKeys(float InTime) const
     {
         if (Points.Num() == 0)
             return T{};
@@ -85,7 +150,27 @@ struct FInterpCurve
     int32 Num() const { return Points.Num(); }
 
     // 모든 키프레임 제거
-    void Reset() { Points.Empty(); }
+    void Reset()
+    {
+        Points.Empty();
+        Bake();
+    }
+
+private:
+    // 테이블 두 칸 사이 보간 (범위 밖은 양 끝 값으로 클램프 - 키 평가와 동일)
+    T EvalTable(float InTime) const
+    {
+        const float MaxIndex = static_cast<float>(LookupTableSize - 1);
+        const float X = std::min(std::max((InTime - LookupStartTime) * LookupTimeScale, 0.0f), MaxIndex);
+        const int32 Index = std::min(static_cast<int32>(X), LookupTableSize - 2);
+        const float Alpha = X - static_cast<float>(Index);
+        return FMath::Lerp(LookupTable[Index], LookupTable[Index + 1], Alpha);
+    }
+
+    TArray<T> LookupTable;
+    float LookupStartTime = 0.0f;
+    float LookupTimeScale = 0.0f;
+    int32 BakedKeyCount = 0;
 };
 
 // -------------------------------------------
@@ -103,8 +188,8 @@ struct FRawDistribution
     float MinTime = 0.0f;
     float MaxTime = 1.0f;
 
-    // 모드에 따른 값 반환
-    T GetValue(float Time) const
+    // 모드에 따른 값 반환 (Uniform 모드는 Stream에서 난수를 뽑음)
+    T GetValue(float Time, FRandomStream& Stream) const
     {
         if (Mode == EDistributionMode::Curve && Curve.HasKeys())
         {
@@ -112,9 +197,38 @@ struct FRawDistribution
             return Curve.Eval(NormalizedTime);
         }
         // 기본: Uniform 모드 (랜덤)
-        return GetRandomValue();
+        return GetRandomValue(Stream);
+    }
+
+    // 스레드 기본 스트림 사용 (재현 불필요한 호출용)
+    T GetValue(float Time) const
+    {
+        return GetValue(Time, FRandomStream::GetThreadStream());
+    }
+
+    // 여러 시간에 대한 GetValue를 한 번에 계산
+    void EvalMany(const float* InTimes, T* OutValues, int32 Count, FRandomStream& Stream) const
+    {
+        if (Mode == EDistributionMode::Curve && Curve.HasKeys())
+        {
+            for (int32 i = 0; i < Count; ++i)
+            {
+                OutValues[i] = Curve.Eval(NormalizeTime(InTimes[i]));
+            }
+            return;
+        }
+
+        GetRandomValues(OutValues, Count, Stream);
     }
 
+    void EvalMany(const float* InTimes, T* OutValues, int32 Count) const
+    {
+        EvalMany(InTimes, OutValues, Count, FRandomStream::GetThreadStream());
+    }
+
+    // 커브 룩업 테이블 재생성 (키를 로드/편집한 뒤 호출)
+    void Bake() { Curve.Bake(); }
+
     // 단일 T 값으로 보간 (Uniform 모드용)
     T GetLerpValue(float T) const
     {
@@ -122,9 +236,31 @@ struct FRawDistribution
     }
 
     // 랜덤 값 반환 (기본 구현: 단일 랜덤 T 사용)
+    T GetRandomValue(FRandomStream& Stream) const
+    {
+        return FMath::Lerp(Min, Max, Stream.GetFraction());
+    }
+
     T GetRandomValue() const
     {
-        return FMath::Lerp(Min, Max, FMath::GetRandZeroOneRange());
+        return GetRandomValue(FRandomStream::GetThreadStream());
+    }
+
+    // 랜덤 값 Count개를 한 번에 생성 (난수를 일괄 생성한 뒤 보간)
+    void GetRandomValues(T* OutValues, int32 Count, FRandomStream& Stream) const
+    {
+        constexpr int32 BatchSize = 64;
+        float Alphas[BatchSize];
+
+        for (int32 Start = 0; Start < Count; Start += BatchSize)
+        {
+            const int32 Num = (Count - Start < BatchSize) ? Count - Start : BatchSize;
+            Stream.FillFractions(Alphas, Num);
+            for (int32 i = 0; i < Num; ++i)
+            {
+                OutValues[Start + i] = FMath::Lerp(Min, Max, Alphas[i]);
+            }
+        }
     }
 
 private:
@@ -140,6 +276,10 @@ private:
         if (Offset < 0.0f)
             return MinTime;
 
+        // 대부분의 호출(수명 비율 등)은 이미 범위 안이므로 fmodf 생략
+        if (Offset < Range)
+            return Time;
+
         // MinTime~MaxTime 범위 내에서 시간을 순환
         return MinTime + fmodf(Offset, Range);
     }
@@ -158,8 +298,8 @@ struct FRawDistribution<FVector>
     float MinTime = 0.0f;
     float MaxTime = 1.0f;
 
-    // 모드에 따른 값 반환
-    FVector GetValue(float Time) const
+    // 모드에 따른 값 반환 (Uniform 모드는 Stream에서 난수를 뽑음)
+    FVector GetValue(float Time, FRandomStream& Stream) const
     {
         if (Mode == EDistributionMode::Curve && Curve.HasKeys())
         {
@@ -167,9 +307,38 @@ struct FRawDistribution<FVector>
             return Curve.Eval(NormalizedTime);
         }
         // 기본: Uniform 모드 (랜덤)
-        return GetRandomValue();
+        return GetRandomValue(Stream);
+    }
+
+    // 스레드 기본 스트림 사용 (재현 불필요한 호출용)
+    FVector GetValue(float Time) const
+    {
+        return GetValue(Time, FRandomStream::GetThreadStream());
     }
 
+    // 여러 시간에 대한 GetValue를 한 번에 계산
+    void EvalMany(const float* InTimes, FVector* OutValues, int32 Count, FRandomStream& Stream) const
+    {
+        if (Mode == EDistributionMode::Curve && Curve.HasKeys())
+        {
+            for (int32 i = 0; i < Count; ++i)
+            {
+                OutValues[i] = Curve.Eval(NormalizeTime(InTimes[i]));
+            }
+            return;
+        }
+
+        GetRandomValues(OutValues, Count, Stream);
+    }
+
+    void EvalMany(const float* InTimes, FVector* OutValues, int32 Count) const
+    {
+        EvalMany(InTimes, OutValues, Count, FRandomStream::GetThreadStream());
+    }
+
+    // 커브 룩업 테이블 재생성 (키를 로드/편집한 뒤 호출)
+    void Bake() { Curve.Bake(); }
+
     // 단일 T 값으로 보간 (Uniform 모드용)
     FVector GetLerpValue(float T) const
     {
@@ -177,15 +346,45 @@ struct FRawDistribution<FVector>
     }
 
     // 각 축에 독립적인 랜덤 값 사용
-    FVector GetRandomValue() const
+    // (생성자 인자 평가 순서는 컴파일러마다 다르므로 X, Y, Z 순서로 명시적으로 뽑음)
+    FVector GetRandomValue(FRandomStream& Stream) const
     {
+        const float AlphaX = Stream.GetFraction();
+        const float AlphaY = Stream.GetFraction();
+        const float AlphaZ = Stream.GetFraction();
         return FVector(
-            FMath::Lerp(Min.X, Max.X, FMath::GetRandZeroOneRange()),
-            FMath::Lerp(Min.Y, Max.Y, FMath::GetRandZeroOneRange()),
-            FMath::Lerp(Min.Z, Max.Z, FMath::GetRandZeroOneRange())
+            FMath::Lerp(Min.X, Max.X, AlphaX),
+            FMath::Lerp(Min.Y, Max.Y, AlphaY),
+            FMath::Lerp(Min.Z, Max.Z, AlphaZ)
         );
     }
 
+    FVector GetRandomValue() const
+    {
+        return GetRandomValue(FRandomStream::GetThreadStream());
+    }
+
+    // 랜덤 벡터 Count개를 한 번에 생성 (축당 난수 3개를 일괄 생성)
+    void GetRandomValues(FVector* OutValues, int32 Count, FRandomStream& Stream) const
+    {
+        constexpr int32 BatchSize = 32;
+        float Alphas[BatchSize * 3];
+
+        for (int32 Start = 0; Start < Count; Start += BatchSize)
+        {
+            const int32 Num = (Count - Start < BatchSize) ? Count - Start : BatchSize;
+            Stream.FillFractions(Alphas, Num * 3);
+            for (int32 i = 0; i < Num; ++i)
+            {
+                OutValues[Start + i] = FVector(
+                    FMath::Lerp(Min.X, Max.X, Alphas[i * 3 + 0]),
+                    FMath::Lerp(Min.Y, Max.Y, Alphas[i * 3 + 1]),
+                    FMath::Lerp(Min.Z, Max.Z, Alphas[i * 3 + 2])
+                );
+            }
+        }
+    }
+
 private:
     // 시간을 [MinTime, MaxTime] 범위로 정규화 (순환)
     float NormalizeTime(float Time) const
@@ -199,6 +398,10 @@ private:
         if (Offset < 0.0f)
             return MinTime;
 
+        // 대부분의 호출(수명 비율 등)은 이미 범위 안이므로 fmodf 생략
+        if (Offset < Range)
+            return Time;
+
         // MinTime~MaxTime 범위 내에서 시간을 순환
         return MinTime + fmodf(Offset, Range);
     }
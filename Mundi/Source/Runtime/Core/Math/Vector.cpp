@@ -5,7 +5,7 @@ void FVector::Log()
 {
 	char buf[160];
 	sprintf_s(buf, "Vector(%f, %f, %f)", X, Y, Z);
-	UE_LOG(buf);
+	UE_LOG("%s", buf);
 }
 
 FQuat::FQuat(const FMatrix& M)
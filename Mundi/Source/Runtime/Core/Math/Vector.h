@@ -6,6 +6,7 @@
 
 #include "UEContainer.h"
 #include "Archive.h"
+#include "RandomStream.h"
 
 // 혹시 다른 헤더에서 새어 들어온 매크로 방지
 #ifdef min
@@ -84,9 +85,10 @@ namespace FMath
 		return F - floorf(F);
 	}
 
+	// 스레드별 기본 스트림 사용 (재현이 필요하면 FRandomStream을 직접 전달할 것)
 	static float GetRandZeroOneRange()
 	{
-		return rand() / (float)RAND_MAX;
+		return FRandomStream::GetThreadStream().GetFraction();
 	}
 }
 // 각도를 -180 ~ 180 범위로 정규화 (모듈러 연산)
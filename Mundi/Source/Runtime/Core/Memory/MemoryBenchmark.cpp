@@ -0,0 +1,139 @@
+﻿#include "pch.h"
+#include "MemoryBenchmark.h"
+#include "MemoryManager.h"
+#include "PlatformTime.h"
+#include "SceneComponent.h"
+#include "StaticMeshComponent.h"
+#include <thread>
+
+namespace
+{
+    double ToSeconds(uint64 Cycles)
+    {
+        return FPlatformTime::ToMilliseconds(Cycles) / 1000.0;
+    }
+
+    // 실제 오브젝트 크기 분포 (씬 컴포넌트, 스태틱 메시 컴포넌트, 액터)
+    const SIZE_T ObjectSizes[] = { sizeof(USceneComponent), sizeof(UStaticMeshComponent), sizeof(AActor) };
+
+    // ObjectCount개를 할당하고 할당 순서와 다른 순서로 해제 (스폰/디스폰이 섞이는 상황)
+    void RunAllocFreeLoop(int32 ObjectCount, int32 Iterations)
+    {
+        TArray<void*> Blocks;
+        Blocks.SetNum(ObjectCount);
+        for (int32 Iteration = 0; Iteration < Iterations; ++Iteration)
+        {
+            for (int32 i = 0; i < ObjectCount; ++i)
+            {
+                Blocks[i] = FMemoryManager::Allocate(ObjectSizes[i % std::size(ObjectSizes)], alignof(std::max_align_t));
+            }
+            // 7919는 소수라 ObjectCount가 그 배수가 아니면 모든 블록을 한 번씩 방문
+            for (int32 i = 0; i < ObjectCount; ++i)
+            {
+                FMemoryManager::Deallocate(Blocks[(static_cast<int64>(i) * 7919) % ObjectCount]);
+            }
+        }
+    }
+
+    double MeasureAllocFree(int32 ThreadCount, int32 ObjectCount, int32 Iterations)
+    {
+        const uint64 Start = FPlatformTime::Cycles64();
+        if (ThreadCount <= 1)
+        {
+            RunAllocFreeLoop(ObjectCount, Iterations);
+        }
+        else
+        {
+            TArray<std::thread> Threads;
+            for (int32 i = 0; i < ThreadCount; ++i)
+            {
+                Threads.emplace_back(RunAllocFreeLoop, ObjectCount, Iterations);
+            }
+            for (std::thread& Thread : Threads)
+            {
+                Thread.join();
+            }
+        }
+        return ToSeconds(FPlatformTime::Cycles64() - Start);
+    }
+
+    // GUObjectArray는 메인 스레드 전용이므로 한 스레드에서만 측정
+    // (생성자에서 리소스를 건드리지 않는 USceneComponent로 할당/등록/삭제 비용만 측정)
+    double MeasureSpawnDestroy(int32 ObjectCount, int32 Iterations)
+    {
+        TArray<UObject*> Objects;
+        Objects.SetNum(ObjectCount);
+        const uint64 Start = FPlatformTime::Cycles64();
+        for (int32 Iteration = 0; Iteration < Iterations; ++Iteration)
+        {
+            for (int32 i = 0; i < ObjectCount; ++i)
+            {
+                Objects[i] = NewObject<USceneComponent>();
+            }
+            for (int32 i = ObjectCount - 1; i >= 0; --i)
+            {
+                ObjectFactory::DeleteObject(Objects[i]);
+            }
+        }
+        return ToSeconds(FPlatformTime::Cycles64() - Start);
+    }
+
+    template<typename TMeasure>
+    FMemoryBenchmarkResult RunCase(const char* Name, int32 ThreadCount, int64 OperationCount, TMeasure Measure)
+    {
+        FMemoryBenchmarkResult Result;
+        Result.Name = Name;
+        Result.ThreadCount = ThreadCount;
+        Result.OperationCount = OperationCount;
+
+        // 한 번씩 돌려 슬랩/캐시를 채운 뒤 측정 (풀 쪽이 첫 슬랩 확보 비용을 측정에 포함하지 않도록)
+        FMemoryManager::SetPoolingEnabled(true);
+        Measure();
+        Result.PooledOpsPerSecond = OperationCount / std::max(Measure(), 1e-9);
+
+        FMemoryManager::SetPoolingEnabled(false);
+        Measure();
+        Result.UnpooledOpsPerSecond = OperationCount / std::max(Measure(), 1e-9);
+        return Result;
+    }
+}
+
+namespace FMemoryBenchmark
+{
+    TArray<FMemoryBenchmarkResult> Run(int32 ObjectCount, int32 Iterations)
+    {
+        TArray<FMemoryBenchmarkResult> Results;
+        if (ObjectCount <= 0 || Iterations <= 0)
+        {
+            return Results;
+        }
+
+        const bool bWasPoolingEnabled = FMemoryManager::IsPoolingEnabled();
+        const int32 ThreadCount = std::max(2, static_cast<int32>(std::thread::hardware_concurrency()));
+        const int64 PairsPerThread = static_cast<int64>(ObjectCount) * Iterations;
+
+        Results.Add(RunCase("alloc/free (component sizes)", 1, PairsPerThread,
+            [=]() { return MeasureAllocFree(1, ObjectCount, Iterations); }));
+        Results.Add(RunCase("alloc/free (component sizes)", ThreadCount, PairsPerThread * ThreadCount,
+            [=]() { return MeasureAllocFree(ThreadCount, ObjectCount, Iterations); }));
+
+        // NewObject는 이름/UUID 발급 등 할당 외 비용이 커서 반복 수를 줄임
+        const int32 SpawnIterations = std::max(1, Iterations / 4);
+        Results.Add(RunCase("NewObject/DeleteObject", 1, static_cast<int64>(ObjectCount) * SpawnIterations,
+            [=]() { return MeasureSpawnDestroy(ObjectCount, SpawnIterations); }));
+
+        FMemoryManager::SetPoolingEnabled(bWasPoolingEnabled);
+        return Results;
+    }
+
+    FString FormatResult(const FMemoryBenchmarkResult& Result)
+    {
+        char Buffer[256];
+        snprintf(Buffer, sizeof(Buffer),
+            "%-30s x%-2d threads | pooled %8.2f | unpooled %8.2f Mops/s | %.2fx",
+            Result.Name.c_str(), Result.ThreadCount,
+            Result.PooledOpsPerSecond / 1e6, Result.UnpooledOpsPerSecond / 1e6,
+            Result.PooledOpsPerSecond / std::max(Result.UnpooledOpsPerSecond, 1e-9));
+        return FString(Buffer);
+    }
+}
@@ -0,0 +1,23 @@
+﻿#pragma once
+
+// 할당 경로 하나의 처리량 비교 결과 (케이스 하나당 한 줄)
+struct FMemoryBenchmarkResult
+{
+    FString Name;
+    int32 ThreadCount = 1;
+    int64 OperationCount = 0;               // 할당+해제 쌍 수 (스레드 합계)
+    double PooledOpsPerSecond = 0.0;        // 슬랩 풀 (현재 기본 경로)
+    double UnpooledOpsPerSecond = 0.0;      // _aligned_malloc 직접 호출 (기존 경로)
+};
+
+// 콘솔 명령 "BENCH MEMORY"에서 사용
+namespace FMemoryBenchmark
+{
+    // 컴포넌트/액터 크기를 섞은 할당-해제 반복 (1 스레드, 전체 스레드)과
+    // NewObject/DeleteObject 스폰-디스폰을 풀 on/off로 각각 측정합니다.
+    // 측정이 끝나면 풀 설정은 원래대로 되돌립니다.
+    TArray<FMemoryBenchmarkResult> Run(int32 ObjectCount = 16384, int32 Iterations = 10);
+
+    // 결과 한 줄 포맷: "Name  x8 threads | pooled 12.34 | unpooled 5.67 Mops/s | 2.18x"
+    FString FormatResult(const FMemoryBenchmarkResult& Result);
+}
@@ -1,30 +1,306 @@
 ﻿#include "pch.h"
 #include "MemoryManager.h"
+#include "Profiler.h"
 #include <cstddef>
 #include <malloc.h>
 #include <algorithm>
+#include <array>
+#include <atomic>
+#include <mutex>
 
-uint32 FMemoryManager::TotalAllocationBytes = 0;
-uint32 FMemoryManager::TotalAllocationCount = 0;
-
-void* FMemoryManager::Allocate(SIZE_T Size, SIZE_T Alignment)
+namespace
 {
-	SIZE_T TotalSize = Size + sizeof(SIZE_T);
-	SIZE_T FinalAlignment = std::max(Alignment, alignof(SIZE_T));
+	// 모든 블록 바로 앞에 붙는 헤더 (16바이트라 사용자 포인터 정렬을 유지)
+	struct FAllocationHeader
+	{
+		uint64 Size;		// 요청 크기 (통계용)
+		uint32 Offset;		// 큰 할당: 사용자 포인터 - _aligned_malloc 포인터
+		uint32 SizeClass;	// 풀 인덱스, LargeSizeClass면 _aligned_malloc
+	};
+	static_assert(sizeof(FAllocationHeader) == FMemoryManager::PoolAlignment, "Header must keep pooled blocks 16-byte aligned");
+
+	// 요청 크기 상한 (모두 16의 배수)
+	constexpr uint32 SizeClassSizes[] = { 16, 32, 48, 64, 96, 128, 192, 256, 384, 512, 768, 1024, 1536, 2048, 3072, 4096 };
+	constexpr uint32 NumSizeClasses = static_cast<uint32>(std::size(SizeClassSizes));
+	constexpr uint32 LargeSizeClass = UINT32_MAX;
+	static_assert(SizeClassSizes[NumSizeClasses - 1] == FMemoryManager::MaxPooledSize);
+
+	constexpr SIZE_T SlabSize = 64 * 1024;
+	constexpr uint32 CacheBatchCount = 32;			// 스레드 캐시 <-> 전역 풀 이동 단위
+	constexpr uint32 MaxCachedBlocks = CacheBatchCount * 2;
+	constexpr uint32 StatsFlushInterval = 256;		// 스레드 통계를 전역에 반영하는 주기 (할당/해제 횟수)
+
+	// 16바이트 단위 크기 -> 크기 클래스 (컴파일 타임 테이블)
+	constexpr auto SizeClassLookup = []()
+	{
+		std::array<uint8, FMemoryManager::MaxPooledSize / 16 + 1> Table{};
+		uint32 Class = 0;
+		for (uint32 Slot = 0; Slot < Table.size(); ++Slot)
+		{
+			while (SizeClassSizes[Class] < Slot * 16)
+			{
+				++Class;
+			}
+			Table[Slot] = static_cast<uint8>(Class);
+		}
+		return Table;
+	}();
+
+	inline uint32 GetSizeClass(SIZE_T Size)
+	{
+		return Size <= FMemoryManager::MaxPooledSize ? SizeClassLookup[(Size + 15) / 16] : LargeSizeClass;
+	}
+
+	struct FFreeBlock
+	{
+		FFreeBlock* Next;
+	};
+
+	// 전역 풀 (크기 클래스 하나). 스레드 캐시가 묶음 단위로 가져가고 돌려줌
+	struct FSizeClassPool
+	{
+		std::mutex Mutex;
+		FFreeBlock* FreeList = nullptr;
+		uint8* SlabCursor = nullptr;
+		uint8* SlabEnd = nullptr;
+		uint32 SlabCount = 0;
+		std::atomic<int64> LiveBlocks{ 0 };
+	};
+
+	// 종료 시 스레드 캐시/정적 소멸자에서 해제가 들어와도 안전하도록 풀은 해제하지 않음
+	FSizeClassPool* GetPools()
+	{
+		static FSizeClassPool* Pools = new FSizeClassPool[NumSizeClasses];
+		return Pools;
+	}
+
+	std::atomic<bool> bPoolingEnabled{ true };
+	std::atomic<uint64> TotalAllocationBytes{ 0 };
+	std::atomic<uint64> TotalAllocationCount{ 0 };
+
+	// 스레드별 캐시와 아직 반영하지 않은 통계 (소멸자가 없는 POD라 스레드 종료 직전까지 접근 가능)
+	struct FThreadCache
+	{
+		FFreeBlock* Heads[NumSizeClasses];
+		uint32 Counts[NumSizeClasses];
+		int64 PendingLiveBlocks[NumSizeClasses];
+		int64 PendingBytes;
+		int64 PendingCount;
+		uint32 OpsSinceFlush;
+		bool bDisabled;		// 스레드 종료 중: 캐시 없이 전역 풀 직접 사용
+	};
+	thread_local FThreadCache GThreadCache{};
+
+	void FlushStats(FThreadCache& Cache)
+	{
+		FSizeClassPool* Pools = GetPools();
+		for (uint32 Class = 0; Class < NumSizeClasses; ++Class)
+		{
+			if (Cache.PendingLiveBlocks[Class] != 0)
+			{
+				Pools[Class].LiveBlocks.fetch_add(Cache.PendingLiveBlocks[Class], std::memory_order_relaxed);
+				Cache.PendingLiveBlocks[Class] = 0;
+			}
+		}
+		TotalAllocationBytes.fetch_add(static_cast<uint64>(Cache.PendingBytes), std::memory_order_relaxed);
+		TotalAllocationCount.fetch_add(static_cast<uint64>(Cache.PendingCount), std::memory_order_relaxed);
+		Cache.PendingBytes = 0;
+		Cache.PendingCount = 0;
+		Cache.OpsSinceFlush = 0;
+	}
+
+	void* AllocateRaw(SIZE_T Size, SIZE_T Alignment)
+	{
+#if defined(_MSC_VER) && defined(_DEBUG)
+		return _aligned_malloc_dbg(Size, Alignment, nullptr, 0);
+#else
+		return _aligned_malloc(Size, Alignment);
+#endif
+	}
 
+	void FreeRaw(void* Raw)
+	{
 #if defined(_MSC_VER) && defined(_DEBUG)
-	void* Raw = _aligned_malloc_dbg(TotalSize, FinalAlignment, nullptr, 0);
+		_aligned_free_dbg(Raw);
 #else
-	void* Raw = _aligned_malloc(TotalSize, FinalAlignment);
+		_aligned_free(Raw);
 #endif
-	if (!Raw)
+	}
+
+	// 전역 풀에서 최대 Count개를 꺼내 연결 리스트로 반환 (락 보유 상태에서 호출)
+	FFreeBlock* PopBlocksLocked(uint32 SizeClass, uint32 Count, uint32& OutPopped)
+	{
+		FSizeClassPool& Pool = GetPools()[SizeClass];
+		const SIZE_T Stride = sizeof(FAllocationHeader) + SizeClassSizes[SizeClass];
+
+		FFreeBlock* Head = nullptr;
+		OutPopped = 0;
+		while (OutPopped < Count)
+		{
+			FFreeBlock* Block = Pool.FreeList;
+			if (Block)
+			{
+				Pool.FreeList = Block->Next;
+			}
+			else
+			{
+				// free list가 비면 현재 슬랩에서 잘라내고, 슬랩도 다 쓰면 새로 확보
+				if (Pool.SlabCursor + Stride > Pool.SlabEnd)
+				{
+					uint8* Slab = static_cast<uint8*>(AllocateRaw(SlabSize, 64));
+					if (!Slab)
+					{
+						break;
+					}
+					Pool.SlabCursor = Slab;
+					Pool.SlabEnd = Slab + SlabSize;
+					++Pool.SlabCount;
+				}
+				Block = reinterpret_cast<FFreeBlock*>(Pool.SlabCursor);
+				Pool.SlabCursor += Stride;
+			}
+			Block->Next = Head;
+			Head = Block;
+			++OutPopped;
+		}
+		return Head;
+	}
+
+	void PushBlocksLocked(uint32 SizeClass, FFreeBlock* Head, FFreeBlock* Tail)
+	{
+		FSizeClassPool& Pool = GetPools()[SizeClass];
+		Tail->Next = Pool.FreeList;
+		Pool.FreeList = Head;
+	}
+
+	void RefillThreadCache(FThreadCache& Cache, uint32 SizeClass)
+	{
+		FSizeClassPool& Pool = GetPools()[SizeClass];
+		uint32 Popped = 0;
+		{
+			std::lock_guard<std::mutex> Lock(Pool.Mutex);
+			Cache.Heads[SizeClass] = PopBlocksLocked(SizeClass, CacheBatchCount, Popped);
+		}
+		Cache.Counts[SizeClass] = Popped;
+	}
+
+	// 캐시에서 CacheBatchCount개를 떼어 전역 풀로 반환
+	void DrainThreadCache(FThreadCache& Cache, uint32 SizeClass, uint32 Count)
+	{
+		FFreeBlock* Head = Cache.Heads[SizeClass];
+		if (!Head || Count == 0)
+		{
+			return;
+		}
+
+		FFreeBlock* Tail = Head;
+		uint32 Taken = 1;
+		while (Taken < Count && Tail->Next)
+		{
+			Tail = Tail->Next;
+			++Taken;
+		}
+		Cache.Heads[SizeClass] = Tail->Next;
+		Cache.Counts[SizeClass] -= Taken;
+
+		FSizeClassPool& Pool = GetPools()[SizeClass];
+		std::lock_guard<std::mutex> Lock(Pool.Mutex);
+		PushBlocksLocked(SizeClass, Head, Tail);
+	}
+
+	// 스레드 종료 시 캐시에 남은 블록을 전역 풀로 돌려주고 이후 해제는 전역 풀로 직접 보냄
+	struct FThreadCacheFlusher
+	{
+		~FThreadCacheFlusher()
+		{
+			FThreadCache& Cache = GThreadCache;
+			for (uint32 Class = 0; Class < NumSizeClasses; ++Class)
+			{
+				DrainThreadCache(Cache, Class, Cache.Counts[Class]);
+			}
+			FlushStats(Cache);
+			Cache.bDisabled = true;
+		}
+	};
+	thread_local FThreadCacheFlusher GThreadCacheFlusher;
+
+	FThreadCache& GetThreadCache()
+	{
+		// 플러셔를 odr-use해서 이 스레드에 소멸자가 등록되도록 함
+		(void)&GThreadCacheFlusher;
+		return GThreadCache;
+	}
+
+	void* AllocateLarge(SIZE_T Size, SIZE_T Alignment)
+	{
+		const SIZE_T FinalAlignment = std::max<SIZE_T>(Alignment, FMemoryManager::PoolAlignment);
+		const SIZE_T Offset = FinalAlignment;	// 헤더 자리를 두면서 사용자 포인터 정렬 유지
+		uint8* Raw = static_cast<uint8*>(AllocateRaw(Size + Offset, FinalAlignment));
+		if (!Raw)
+			return nullptr;
+
+		uint8* UserPtr = Raw + Offset;
+		FAllocationHeader* Header = reinterpret_cast<FAllocationHeader*>(UserPtr) - 1;
+		Header->Size = Size;
+		Header->Offset = static_cast<uint32>(Offset);
+		Header->SizeClass = LargeSizeClass;
+
+		TotalAllocationBytes.fetch_add(Size, std::memory_order_relaxed);
+		TotalAllocationCount.fetch_add(1, std::memory_order_relaxed);
+		FProfiler::TrackAllocation(Size);
+		return UserPtr;
+	}
+}
+
+void* FMemoryManager::Allocate(SIZE_T Size, SIZE_T Alignment)
+{
+	const uint32 SizeClass = (Alignment <= PoolAlignment && bPoolingEnabled.load(std::memory_order_relaxed))
+		? GetSizeClass(Size) : LargeSizeClass;
+	if (SizeClass == LargeSizeClass)
+	{
+		return AllocateLarge(Size, Alignment);
+	}
+
+	FThreadCache& Cache = GetThreadCache();
+	FFreeBlock* Block = nullptr;
+	if (Cache.bDisabled)
+	{
+		FSizeClassPool& Pool = GetPools()[SizeClass];
+		uint32 Popped = 0;
+		std::lock_guard<std::mutex> Lock(Pool.Mutex);
+		Block = PopBlocksLocked(SizeClass, 1, Popped);
+	}
+	else
+	{
+		if (!Cache.Heads[SizeClass])
+		{
+			RefillThreadCache(Cache, SizeClass);
+		}
+		Block = Cache.Heads[SizeClass];
+		if (Block)
+		{
+			Cache.Heads[SizeClass] = Block->Next;
+			--Cache.Counts[SizeClass];
+		}
+	}
+	if (!Block)
 		return nullptr;
 
-	*reinterpret_cast<SIZE_T*>(Raw) = Size;
-	TotalAllocationBytes += static_cast<uint32>(Size);
-	TotalAllocationCount++;
+	FAllocationHeader* Header = reinterpret_cast<FAllocationHeader*>(Block);
+	Header->Size = Size;
+	Header->Offset = 0;
+	Header->SizeClass = SizeClass;
+
+	++Cache.PendingLiveBlocks[SizeClass];
+	Cache.PendingBytes += static_cast<int64>(Size);
+	++Cache.PendingCount;
+	if (++Cache.OpsSinceFlush >= StatsFlushInterval || Cache.bDisabled)
+	{
+		FlushStats(Cache);
+	}
+	FProfiler::TrackAllocation(Size);
 
-	return static_cast<void*>(static_cast<unsigned char*>(Raw) + sizeof(SIZE_T));
+	return Header + 1;
 }
 
 void FMemoryManager::Deallocate(void* Ptr)
@@ -32,16 +308,80 @@ void FMemoryManager::Deallocate(void* Ptr)
 	if (!Ptr)
 		return;
 
-	unsigned char* UserPtr = static_cast<unsigned char*>(Ptr);
-	unsigned char* Raw = UserPtr - sizeof(SIZE_T);
-	SIZE_T Size = *reinterpret_cast<SIZE_T*>(Raw);
+	FAllocationHeader* Header = static_cast<FAllocationHeader*>(Ptr) - 1;
+	const SIZE_T Size = static_cast<SIZE_T>(Header->Size);
+	const uint32 SizeClass = Header->SizeClass;
+
+	if (SizeClass == LargeSizeClass)
+	{
+		TotalAllocationBytes.fetch_sub(Size, std::memory_order_relaxed);
+		TotalAllocationCount.fetch_sub(1, std::memory_order_relaxed);
+		FreeRaw(reinterpret_cast<uint8*>(Ptr) - Header->Offset);
+		return;
+	}
+
+	FThreadCache& Cache = GetThreadCache();
+	FFreeBlock* Block = reinterpret_cast<FFreeBlock*>(Header);
+	if (Cache.bDisabled)
+	{
+		FSizeClassPool& Pool = GetPools()[SizeClass];
+		std::lock_guard<std::mutex> Lock(Pool.Mutex);
+		PushBlocksLocked(SizeClass, Block, Block);
+	}
+	else
+	{
+		Block->Next = Cache.Heads[SizeClass];
+		Cache.Heads[SizeClass] = Block;
+		if (++Cache.Counts[SizeClass] > MaxCachedBlocks)
+		{
+			DrainThreadCache(Cache, SizeClass, CacheBatchCount);
+		}
+	}
 
-	TotalAllocationBytes -= static_cast<uint32>(Size);
-	TotalAllocationCount--;
+	--Cache.PendingLiveBlocks[SizeClass];
+	Cache.PendingBytes -= static_cast<int64>(Size);
+	--Cache.PendingCount;
+	if (++Cache.OpsSinceFlush >= StatsFlushInterval || Cache.bDisabled)
+	{
+		FlushStats(Cache);
+	}
+}
 
-#if defined(_MSC_VER) && defined(_DEBUG)
-	_aligned_free_dbg(Raw);
-#else
-	_aligned_free(Raw);
-#endif
-}
\ No newline at end of file
+void FMemoryManager::SetPoolingEnabled(bool bEnable)
+{
+	bPoolingEnabled.store(bEnable, std::memory_order_relaxed);
+}
+
+bool FMemoryManager::IsPoolingEnabled()
+{
+	return bPoolingEnabled.load(std::memory_order_relaxed);
+}
+
+uint64 FMemoryManager::GetTotalAllocationBytes()
+{
+	return TotalAllocationBytes.load(std::memory_order_relaxed);
+}
+
+uint64 FMemoryManager::GetTotalAllocationCount()
+{
+	return TotalAllocationCount.load(std::memory_order_relaxed);
+}
+
+void FMemoryManager::GetPoolStats(TArray<FMemoryPoolStats>& OutStats)
+{
+	// 호출 스레드의 미반영 통계는 바로 반영
+	FlushStats(GetThreadCache());
+
+	FSizeClassPool* Pools = GetPools();
+	OutStats.SetNum(static_cast<int32>(NumSizeClasses));
+	for (uint32 Class = 0; Class < NumSizeClasses; ++Class)
+	{
+		FMemoryPoolStats& Stats = OutStats[Class];
+		Stats.BlockSize = SizeClassSizes[Class];
+		{
+			std::lock_guard<std::mutex> Lock(Pools[Class].Mutex);
+			Stats.SlabCount = Pools[Class].SlabCount;
+		}
+		Stats.LiveBlocks = Pools[Class].LiveBlocks.load(std::memory_order_relaxed);
+	}
+}
@@ -2,14 +2,45 @@
 #include <cstddef>
 #include "UEContainer.h"
 
+// 크기 클래스 풀 하나의 상태 (STAT/벤치마크 출력용)
+struct FMemoryPoolStats
+{
+	uint32 BlockSize = 0;		// 이 클래스가 받는 최대 요청 크기
+	uint32 SlabCount = 0;		// 확보한 슬랩 수 (슬랩은 반환하지 않고 재사용)
+	int64 LiveBlocks = 0;		// 사용 중인 블록 수
+};
+
+/**
+ * UObject 등 엔진 할당 진입점
+ *
+ * - 작은 할당(<= MaxPooledSize, 정렬 <= PoolAlignment): 크기 클래스별 슬랩 풀
+ *   64KB 슬랩을 같은 크기 블록으로 잘라 쓰고, 해제된 블록은 free list로 재사용합니다.
+ *   같은 UClass의 오브젝트는 항상 같은 크기 클래스에 들어가므로 클래스별로 모여서 배치됩니다.
+ * - 스레드마다 클래스별 캐시를 두고, 캐시가 비거나 넘칠 때만 전역 풀(뮤텍스)과 묶음 단위로 주고받습니다.
+ *   (다른 스레드에서 해제해도 안전, 워커 스레드 할당 가능)
+ * - 큰 할당과 정렬이 큰 할당은 기존처럼 _aligned_malloc
+ *
+ * 통계는 스레드별로 모았다가 일정 횟수마다 전역 원자 카운터에 반영하므로 약간 늦게 보일 수 있습니다.
+ * 할당마다 FProfiler 스레드 카운터도 갱신해, 캡처 중인 프로파일 스코프가 자기 할당량을 기록합니다.
+ */
 class FMemoryManager
 {
 public:
+	static constexpr SIZE_T MaxPooledSize = 4096;
+	static constexpr SIZE_T PoolAlignment = 16;
+
 	// 인자 변수를 PascalCase로 변경
 	static void* Allocate(SIZE_T Size, SIZE_T Alignment);
 	static void  Deallocate(void* Ptr);
 
-public:
-	static uint32 TotalAllocationBytes;
-	static uint32 TotalAllocationCount;
-};
\ No newline at end of file
+	// false면 새 할당은 모두 _aligned_malloc 경로 (기존 방식, 벤치마크 비교용)
+	// 이미 풀에서 받은 블록도 헤더로 구분하므로 언제 바꿔도 안전하게 해제됨
+	static void SetPoolingEnabled(bool bEnable);
+	static bool IsPoolingEnabled();
+
+	static uint64 GetTotalAllocationBytes();
+	static uint64 GetTotalAllocationCount();
+
+	// 크기 클래스별 상태
+	static void GetPoolStats(TArray<FMemoryPoolStats>& OutStats);
+};
@@ -1,6 +1,7 @@
 ﻿
 #include "pch.h"
 #include "PlatformTime.h"
+#include "Profiler.h"
 
 TMap<FString, FTimeProfile> TimeProfileMap;
 //Map에 이미 있으면 시간, 콜스택 추가
@@ -42,5 +43,24 @@ const FTimeProfile& FScopeCycleCounter::GetTimeProfile(const FString& Key)
 {
 	return TimeProfileMap[Key];
 }
+void FScopeCycleCounter::BeginProfileScope(const char* Name)
+{
+	if (FProfiler::IsCapturing())
+	{
+		FProfilerThreadCounters& Counters = GProfilerThreadCounters;
+		ProfileName = Name;
+		ProfileDepth = Counters.ScopeDepth++;
+		ProfileAllocatedBytes = Counters.AllocatedBytes;
+		ProfileAllocationCount = Counters.AllocationCount;
+	}
+}
+void FScopeCycleCounter::EndProfileScope(uint64 EndCycles)
+{
+	FProfilerThreadCounters& Counters = GProfilerThreadCounters;
+	--Counters.ScopeDepth;
+	FProfiler::RecordScope(ProfileName, StartCycles, EndCycles, ProfileDepth,
+		Counters.AllocatedBytes - ProfileAllocatedBytes,
+		static_cast<uint32>(Counters.AllocationCount - ProfileAllocationCount));
+}
 double FWindowsPlatformTime::GSecondsPerCycle = 0.0;
 bool FWindowsPlatformTime::bInitialized = false;
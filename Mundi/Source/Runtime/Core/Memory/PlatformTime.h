@@ -1,8 +1,9 @@
 ﻿#pragma once
 
 
+// 현재 스코프 단위로 측정 (FProfiler 캡처 중이면 계층형 트레이스에도 스코프로 기록)
 #define TIME_PROFILE(Key)\
-FScopeCycleCounter Key##Counter(#Key); //현재 스코프 단위로 측정
+FScopeCycleCounter Key##Counter(#Key);
 
 
 #define TIME_PROFILE_END(Key)\
@@ -122,6 +123,13 @@ public:
 	{
 	}
 
+	// 문자열 리터럴 키 (TIME_PROFILE): 정적 수명이 보장되므로 FProfiler 스코프 이름으로도 사용
+	FScopeCycleCounter(const char* Key) : UsedStatId(TStatId(Key))
+	{
+		BeginProfileScope(Key);
+		StartCycles = FPlatformTime::Cycles64();
+	}
+
 	~FScopeCycleCounter()
 	{
 		Finish(); //소멸 시 현재 사이클 구해서 현재 - 생성 사이클로 시간 측정
@@ -136,6 +144,10 @@ public:
 		bIsFinish = true;
 		const uint64 EndCycles = FPlatformTime::Cycles64();
 		const uint64 CycleDiff = EndCycles - StartCycles;
+		if (ProfileName)
+		{
+			EndProfileScope(EndCycles);
+		}
 
 		double Milliseconds = FWindowsPlatformTime::ToMilliseconds(CycleDiff);
 		if (UsedStatId.Key.empty() == false)
@@ -155,9 +167,18 @@ public:
 	static const TArray<FTimeProfile> GetTimeProfileValues();
 	static const FTimeProfile& GetTimeProfile(const FString& Key);
 private:
+	// FProfiler 연동 (PlatformTime.cpp). 캡처 중이 아니면 ProfileName은 nullptr로 남음
+	void BeginProfileScope(const char* Name);
+	void EndProfileScope(uint64 EndCycles);
+
 	bool bIsFinish = false;
 	uint64 StartCycles;
 	TStatId UsedStatId;
 
+	const char* ProfileName = nullptr;
+	uint32 ProfileDepth = 0;
+	uint64 ProfileAllocatedBytes = 0;
+	uint64 ProfileAllocationCount = 0;
+
 };
 
@@ -0,0 +1,816 @@
+﻿#include "pch.h"
+#include "AsyncLog.h"
+#include <chrono>
+#include <cstdio>
+
+namespace
+{
+	// 링 버퍼에 기록되는 로그 한 건의 헤더. 뒤에 8바이트 단위로 패킹된 인자가 이어진다.
+	struct FLogRecordHeader
+	{
+		uint32 Size;			// 헤더 포함 전체 크기 (8의 배수)
+		uint32 Suppressed;		// 이 로그 직전에 생략된 같은 호출 지점의 로그 수
+		uint64 Sequence;		// 스레드 간 순서 복원용
+		const char* Format;		// nullptr이면 페이로드가 완성된 문자열 하나
+		const char* Category;
+		ELogVerbosity Verbosity;
+	};
+
+	// 링 끝에 남은 공간을 건너뛰라는 표시
+	constexpr uint32 WrapMarker = 0xFFFFFFFFu;
+	constexpr uint32 NullStringLength = 0xFFFFFFFFu;
+	constexpr uint32 MaxRecordSize = 16 * 1024;
+
+	uint32 AlignTo8(uint32 Value) { return (Value + 7u) & ~7u; }
+
+	// 반복 로그 판별용 내용 해시 (FNV-1a, 포맷 포인터 + 패킹된 인자 바이트)
+	uint64 HashMessage(const char* Format, const uint8* Payload, uint32 PayloadSize)
+	{
+		uint64 Hash = 14695981039346656037ull;
+		const uint64 FormatAddress = reinterpret_cast<uint64>(Format);
+		for (uint32 Index = 0; Index < sizeof(FormatAddress); ++Index)
+		{
+			Hash = (Hash ^ ((FormatAddress >> (Index * 8)) & 0xFF)) * 1099511628211ull;
+		}
+		for (uint32 Index = 0; Index < PayloadSize; ++Index)
+		{
+			Hash = (Hash ^ Payload[Index]) * 1099511628211ull;
+		}
+		return Hash;
+	}
+
+	// -------------------------------------------------------------------------
+	// printf 포맷 지정자 파싱 (기록 스레드와 로그 스레드가 같은 규칙으로 인자를 읽는다)
+	// -------------------------------------------------------------------------
+	enum class ELengthModifier : uint8
+	{
+		None, Char, Short, Long, LongLong, Size, LongDouble, Int32
+	};
+
+	struct FFormatSpec
+	{
+		const char* Begin = nullptr;	// '%' 위치
+		const char* End = nullptr;		// 변환 문자 다음 위치
+		char Conversion = 0;
+		ELengthModifier Length = ELengthModifier::None;
+		bool bStarWidth = false;
+		bool bStarPrecision = false;
+	};
+
+	// Cursor는 '%'를 가리켜야 한다.
+	FFormatSpec ParseFormatSpec(const char* Cursor)
+	{
+		FFormatSpec Spec;
+		Spec.Begin = Cursor++;
+
+		while (*Cursor && strchr("-+ #0", *Cursor)) { ++Cursor; }
+
+		if (*Cursor == '*') { Spec.bStarWidth = true; ++Cursor; }
+		else { while (*Cursor >= '0' && *Cursor <= '9') { ++Cursor; } }
+
+		if (*Cursor == '.')
+		{
+			++Cursor;
+			if (*Cursor == '*') { Spec.bStarPrecision = true; ++Cursor; }
+			else { while (*Cursor >= '0' && *Cursor <= '9') { ++Cursor; } }
+		}
+
+		if (Cursor[0] == 'h' && Cursor[1] == 'h') { Spec.Length = ELengthModifier::Char; Cursor += 2; }
+		else if (Cursor[0] == 'l' && Cursor[1] == 'l') { Spec.Length = ELengthModifier::LongLong; Cursor += 2; }
+		else if (Cursor[0] == 'I' && Cursor[1] == '6' && Cursor[2] == '4') { Spec.Length = ELengthModifier::LongLong; Cursor += 3; }
+		else if (Cursor[0] == 'I' && Cursor[1] == '3' && Cursor[2] == '2') { Spec.Length = ELengthModifier::Int32; Cursor += 3; }
+		else if (*Cursor == 'h') { Spec.Length = ELengthModifier::Short; ++Cursor; }
+		else if (*Cursor == 'l') { Spec.Length = ELengthModifier::Long; ++Cursor; }
+		else if (*Cursor == 'j') { Spec.Length = ELengthModifier::LongLong; ++Cursor; }
+		else if (*Cursor == 'z' || *Cursor == 't' || *Cursor == 'I') { Spec.Length = ELengthModifier::Size; ++Cursor; }
+		else if (*Cursor == 'L') { Spec.Length = ELengthModifier::LongDouble; ++Cursor; }
+
+		Spec.Conversion = *Cursor;
+		Spec.End = *Cursor ? Cursor + 1 : Cursor;
+		return Spec;
+	}
+
+	bool IsWideString(const FFormatSpec& Spec)
+	{
+		return Spec.Conversion == 'S' || (Spec.Conversion == 's' && Spec.Length == ELengthModifier::Long);
+	}
+
+	// -------------------------------------------------------------------------
+	// 기록: va_list의 인자를 포맷에 맞춰 값으로 복사
+	// -------------------------------------------------------------------------
+	void WriteSlot(TArray<uint8>& Out, const void* Data, uint32 Size)
+	{
+		const uint32 Offset = static_cast<uint32>(Out.Num());
+		Out.SetNum(Offset + AlignTo8(Size), 0);
+		memcpy(Out.GetData() + Offset, Data, Size);
+	}
+
+	void WriteInt(TArray<uint8>& Out, int64 Value) { WriteSlot(Out, &Value, sizeof(Value)); }
+	void WriteUInt(TArray<uint8>& Out, uint64 Value) { WriteSlot(Out, &Value, sizeof(Value)); }
+	void WriteDouble(TArray<uint8>& Out, double Value) { WriteSlot(Out, &Value, sizeof(Value)); }
+
+	void WriteBytes(TArray<uint8>& Out, const void* Data, uint32 ByteCount)
+	{
+		uint64 Length = Data ? ByteCount : NullStringLength;
+		WriteSlot(Out, &Length, sizeof(Length));
+		if (Data)
+		{
+			WriteSlot(Out, Data, ByteCount);
+		}
+	}
+
+	// 문자열은 널 종료까지 복사. 너무 긴 문자열은 MaxRecordSize에서 잘라낸다.
+	template<typename TChar>
+	void WriteString(TArray<uint8>& Out, const TChar* Str)
+	{
+		if (!Str)
+		{
+			WriteBytes(Out, nullptr, 0);
+			return;
+		}
+
+		constexpr uint32 MaxChars = MaxRecordSize / sizeof(TChar);
+		uint32 Length = 0;
+		while (Length < MaxChars && Str[Length]) { ++Length; }
+
+		const uint32 ByteCount = (Length + 1) * sizeof(TChar);
+		uint64 SlotLength = ByteCount;
+		WriteSlot(Out, &SlotLength, sizeof(SlotLength));
+
+		const uint32 Offset = static_cast<uint32>(Out.Num());
+		Out.SetNum(Offset + AlignTo8(ByteCount), 0);	// 0으로 채워지므로 잘린 경우에도 널 종료됨
+		memcpy(Out.GetData() + Offset, Str, Length * sizeof(TChar));
+	}
+
+	int64 ReadSignedArg(const FFormatSpec& Spec, va_list& Args)
+	{
+		switch (Spec.Length)
+		{
+		case ELengthModifier::Long:		return va_arg(Args, long);
+		case ELengthModifier::LongLong:	return va_arg(Args, long long);
+		case ELengthModifier::Size:		return static_cast<int64>(va_arg(Args, intptr_t));
+		default:						return va_arg(Args, int);
+		}
+	}
+
+	uint64 ReadUnsignedArg(const FFormatSpec& Spec, va_list& Args)
+	{
+		switch (Spec.Length)
+		{
+		case ELengthModifier::Long:		return va_arg(Args, unsigned long);
+		case ELengthModifier::LongLong:	return va_arg(Args, unsigned long long);
+		case ELengthModifier::Size:		return static_cast<uint64>(va_arg(Args, size_t));
+		default:						return va_arg(Args, unsigned int);
+		}
+	}
+
+	void PackArguments(const char* Format, va_list InArgs, TArray<uint8>& Out)
+	{
+		// 참조로 넘길 수 있도록 로컬 복사본 사용 (va_list가 배열 타입인 플랫폼 대응)
+		va_list Args;
+		va_copy(Args, InArgs);
+
+		for (const char* Cursor = Format; *Cursor; )
+		{
+			if (*Cursor != '%') { ++Cursor; continue; }
+			if (Cursor[1] == '%') { Cursor += 2; continue; }
+
+			const FFormatSpec Spec = ParseFormatSpec(Cursor);
+			Cursor = Spec.End;
+
+			if (Spec.bStarWidth) { WriteInt(Out, va_arg(Args, int)); }
+			if (Spec.bStarPrecision) { WriteInt(Out, va_arg(Args, int)); }
+
+			switch (Spec.Conversion)
+			{
+			case 'd': case 'i': case 'c': case 'C':
+				WriteInt(Out, ReadSignedArg(Spec, Args));
+				break;
+			case 'u': case 'o': case 'x': case 'X':
+				WriteUInt(Out, ReadUnsignedArg(Spec, Args));
+				break;
+			case 'f': case 'F': case 'e': case 'E': case 'g': case 'G': case 'a': case 'A':
+				WriteDouble(Out, Spec.Length == ELengthModifier::LongDouble ? static_cast<double>(va_arg(Args, long double)) : va_arg(Args, double));
+				break;
+			case 's': case 'S':
+				if (IsWideString(Spec))
+				{
+					WriteString(Out, va_arg(Args, const wchar_t*));
+				}
+				else
+				{
+					WriteString(Out, va_arg(Args, const char*));
+				}
+				break;
+			case 'p':
+				WriteUInt(Out, reinterpret_cast<uint64>(va_arg(Args, void*)));
+				break;
+			case 'n':
+				(void)va_arg(Args, void*); // 지원하지 않음 (인자만 소비)
+				break;
+			default:
+				break; // 알 수 없는 지정자는 문자 그대로 출력
+			}
+
+			if (Out.Num() > static_cast<int32>(MaxRecordSize))
+			{
+				break; // 너무 긴 인자는 잘라냄 (포맷 시 남은 인자는 빈 값으로 처리)
+			}
+		}
+
+		va_end(Args);
+	}
+
+	// -------------------------------------------------------------------------
+	// 포맷: 로그 스레드에서 패킹된 인자를 다시 읽어 지정자 단위로 출력
+	// -------------------------------------------------------------------------
+	struct FArgReader
+	{
+		const uint8* Cursor;
+		const uint8* End;
+
+		template<typename T>
+		T Read()
+		{
+			T Value{};
+			if (Cursor + sizeof(uint64) <= End)
+			{
+				memcpy(&Value, Cursor, sizeof(T));
+				Cursor += sizeof(uint64);
+			}
+			return Value;
+		}
+
+		const void* ReadBytes()
+		{
+			if (Cursor + sizeof(uint64) > End)
+			{
+				return nullptr;
+			}
+			const uint64 Length = Read<uint64>();
+			if (Length == NullStringLength || Cursor + Length > End)
+			{
+				return nullptr;
+			}
+			const void* Data = Cursor;
+			Cursor += AlignTo8(static_cast<uint32>(Length));
+			return Data;
+		}
+	};
+
+	template<typename... TArgs>
+	void AppendFormatted(FString& Out, const char* Spec, TArgs... Args)
+	{
+		char Buffer[512];
+		const int Written = snprintf(Buffer, sizeof(Buffer), Spec, Args...);
+		if (Written < 0)
+		{
+			return;
+		}
+		if (Written < static_cast<int>(sizeof(Buffer)))
+		{
+			Out.append(Buffer, Written);
+			return;
+		}
+
+		const size_t Offset = Out.size();
+		Out.resize(Offset + Written + 1);
+		snprintf(&Out[Offset], Written + 1, Spec, Args...);
+		Out.resize(Offset + Written);
+	}
+
+	FString FormatRecord(const char* Format, const uint8* Payload, const uint8* PayloadEnd)
+	{
+		FString Result;
+		FArgReader Reader{ Payload, PayloadEnd };
+
+		char SpecBuffer[64];
+		for (const char* Cursor = Format; *Cursor; )
+		{
+			if (*Cursor != '%')
+			{
+				const char* Next = strchr(Cursor, '%');
+				const size_t Count = Next ? static_cast<size_t>(Next - Cursor) : strlen(Cursor);
+				Result.append(Cursor, Count);
+				Cursor += Count;
+				continue;
+			}
+			if (Cursor[1] == '%')
+			{
+				Result.push_back('%');
+				Cursor += 2;
+				continue;
+			}
+
+			const FFormatSpec Spec = ParseFormatSpec(Cursor);
+			Cursor = Spec.End;
+
+			// '*' 폭/정밀도를 기록된 값으로 치환한 단일 지정자 문자열 생성
+			const int32 StarWidth = Spec.bStarWidth ? static_cast<int32>(Reader.Read<int64>()) : 0;
+			const int32 StarPrecision = Spec.bStarPrecision ? static_cast<int32>(Reader.Read<int64>()) : 0;
+			FString SpecString;
+			for (const char* C = Spec.Begin; C < Spec.End; ++C)
+			{
+				if (*C == '*')
+				{
+					const bool bIsPrecision = (C > Spec.Begin && C[-1] == '.');
+					SpecString += std::to_string(bIsPrecision ? StarPrecision : StarWidth);
+				}
+				else
+				{
+					SpecString.push_back(*C);
+				}
+			}
+			strncpy_s(SpecBuffer, SpecString.c_str(), _TRUNCATE);
+
+			switch (Spec.Conversion)
+			{
+			case 'd': case 'i': case 'c': case 'C':
+			{
+				const int64 Value = Reader.Read<int64>();
+				if (Spec.Length == ELengthModifier::LongLong) { AppendFormatted(Result, SpecBuffer, static_cast<long long>(Value)); }
+				else if (Spec.Length == ELengthModifier::Long) { AppendFormatted(Result, SpecBuffer, static_cast<long>(Value)); }
+				else if (Spec.Length == ELengthModifier::Size) { AppendFormatted(Result, SpecBuffer, static_cast<intptr_t>(Value)); }
+				else { AppendFormatted(Result, SpecBuffer, static_cast<int>(Value)); }
+				break;
+			}
+			case 'u': case 'o': case 'x': case 'X':
+			{
+				const uint64 Value = Reader.Read<uint64>();
+				if (Spec.Length == ELengthModifier::LongLong) { AppendFormatted(Result, SpecBuffer, static_cast<unsigned long long>(Value)); }
+				else if (Spec.Length == ELengthModifier::Long) { AppendFormatted(Result, SpecBuffer, static_cast<unsigned long>(Value)); }
+				else if (Spec.Length == ELengthModifier::Size) { AppendFormatted(Result, SpecBuffer, static_cast<size_t>(Value)); }
+				else { AppendFormatted(Result, SpecBuffer, static_cast<unsigned int>(Value)); }
+				break;
+			}
+			case 'f': case 'F': case 'e': case 'E': case 'g': case 'G': case 'a': case 'A':
+			{
+				const double Value = Reader.Read<double>();
+				if (Spec.Length == ELengthModifier::LongDouble) { AppendFormatted(Result, SpecBuffer, static_cast<long double>(Value)); }
+				else { AppendFormatted(Result, SpecBuffer, Value); }
+				break;
+			}
+			case 's': case 'S':
+			{
+				const void* Data = Reader.ReadBytes();
+				if (!Data) { Result += "(null)"; }
+				else if (IsWideString(Spec)) { AppendFormatted(Result, SpecBuffer, static_cast<const wchar_t*>(Data)); }
+				else { AppendFormatted(Result, SpecBuffer, static_cast<const char*>(Data)); }
+				break;
+			}
+			case 'p':
+				AppendFormatted(Result, SpecBuffer, reinterpret_cast<void*>(Reader.Read<uint64>()));
+				break;
+			case 'n':
+				break;
+			default:
+				Result.append(Spec.Begin, Spec.End);
+				break;
+			}
+		}
+		return Result;
+	}
+
+	// 링에 기록된 레코드 하나를 포맷팅된 한 줄로 변환
+	FLogLine DecodeRecord(const uint8* Record)
+	{
+		FLogRecordHeader Header;
+		memcpy(&Header, Record, sizeof(Header));
+		const uint8* Payload = Record + sizeof(FLogRecordHeader);
+		const uint8* PayloadEnd = Record + Header.Size;
+
+		FLogLine Line;
+		Line.Sequence = Header.Sequence;
+		Line.Verbosity = Header.Verbosity;
+		Line.Category = Header.Category;
+		if (Header.Format)
+		{
+			Line.Text = FormatRecord(Header.Format, Payload, PayloadEnd);
+		}
+		else
+		{
+			FArgReader Reader{ Payload, PayloadEnd };
+			const char* Text = static_cast<const char*>(Reader.ReadBytes());
+			Line.Text = Text ? Text : "";
+		}
+		if (Header.Suppressed > 0)
+		{
+			Line.Text += " (" + std::to_string(Header.Suppressed) + " similar messages suppressed)";
+		}
+		return Line;
+	}
+
+	double GetLogTimeSeconds()
+	{
+		using namespace std::chrono;
+		static const steady_clock::time_point StartTime = steady_clock::now();
+		return duration<double>(steady_clock::now() - StartTime).count();
+	}
+
+	// -------------------------------------------------------------------------
+	// 기본 싱크
+	// -------------------------------------------------------------------------
+	class FDebugOutputLogSink : public ILogSink
+	{
+	public:
+		void Write(const FLogLine& Line) override
+		{
+			OutputDebugStringA(Line.Text.c_str());
+			OutputDebugStringA("\n");
+			fputs(Line.Text.c_str(), stdout);
+			fputc('\n', stdout);
+		}
+
+		void Flush() override { fflush(stdout); }
+	};
+
+	class FFileLogSink : public ILogSink
+	{
+	public:
+		explicit FFileLogSink(const char* InPath) { fopen_s(&File, InPath, "w"); }
+		~FFileLogSink() override { if (File) { fclose(File); } }
+
+		void Write(const FLogLine& Line) override
+		{
+			if (!File) return;
+			fprintf(File, "[%s][%s] %s\n", Line.Category ? Line.Category : "Log", LexToString(Line.Verbosity), Line.Text.c_str());
+		}
+
+		void Flush() override { if (File) { fflush(File); } }
+
+	private:
+		FILE* File = nullptr;
+	};
+}
+
+const char* LexToString(ELogVerbosity Verbosity)
+{
+	switch (Verbosity)
+	{
+	case ELogVerbosity::Fatal:			return "Fatal";
+	case ELogVerbosity::Error:			return "Error";
+	case ELogVerbosity::Warning:		return "Warning";
+	case ELogVerbosity::Display:		return "Display";
+	case ELogVerbosity::Log:			return "Log";
+	case ELogVerbosity::Verbose:		return "Verbose";
+	case ELogVerbosity::VeryVerbose:	return "VeryVerbose";
+	default:							return "NoLogging";
+	}
+}
+
+//====================================================================================
+// FLogCallSite
+//====================================================================================
+
+bool FLogCallSite::ShouldLog(uint64 MessageHash, uint32& OutSuppressed)
+{
+	const uint32 NowMs = static_cast<uint32>(GetLogTimeSeconds() * 1000.0);
+
+	// 직전과 다른 내용이면 반복이 아니므로 항상 기록하고 구간을 새로 시작
+	if (LastMessageHash.exchange(MessageHash, std::memory_order_relaxed) != MessageHash)
+	{
+		WindowStartMs.store(NowMs, std::memory_order_relaxed);
+		CountInWindow.store(1, std::memory_order_relaxed);
+		OutSuppressed = SuppressedCount.exchange(0, std::memory_order_relaxed);
+		return true;
+	}
+
+	uint32 WindowStart = WindowStartMs.load(std::memory_order_relaxed);
+
+	// 1초가 지나면 새 구간 시작 (경쟁 시 한 스레드만 리셋)
+	if (NowMs - WindowStart >= 1000 &&
+		WindowStartMs.compare_exchange_strong(WindowStart, NowMs, std::memory_order_relaxed))
+	{
+		CountInWindow.store(0, std::memory_order_relaxed);
+	}
+
+	if (CountInWindow.fetch_add(1, std::memory_order_relaxed) >= LOG_RATE_LIMIT_PER_SECOND)
+	{
+		SuppressedCount.fetch_add(1, std::memory_order_relaxed);
+		return false;
+	}
+
+	OutSuppressed = SuppressedCount.exchange(0, std::memory_order_relaxed);
+	return true;
+}
+
+//====================================================================================
+// FAsyncLog::FRing
+//====================================================================================
+
+bool FAsyncLog::FRing::Push(const uint8* Data, uint32 Size)
+{
+	const uint64 Head = WritePos.load(std::memory_order_relaxed);
+	const uint64 Tail = ReadPos.load(std::memory_order_acquire);
+
+	const uint32 Offset = static_cast<uint32>(Head & Mask);
+	const uint32 Contiguous = Capacity - Offset;
+	const uint32 Skip = (Size > Contiguous) ? Contiguous : 0;
+
+	if (Head + Skip + Size - Tail > Capacity)
+	{
+		return false; // 가득 참
+	}
+
+	if (Skip > 0)
+	{
+		memcpy(Buffer + Offset, &WrapMarker, sizeof(WrapMarker));
+	}
+	memcpy(Buffer + ((Head + Skip) & Mask), Data, Size);
+	WritePos.store(Head + Skip + Size, std::memory_order_release);
+	return true;
+}
+
+//====================================================================================
+// FAsyncLog
+//====================================================================================
+
+std::atomic<bool> FAsyncLog::bInstanceCreated{ false };
+
+FAsyncLog& FAsyncLog::Get()
+{
+	static FAsyncLog Instance;
+	return Instance;
+}
+
+FAsyncLog::FAsyncLog()
+{
+	Sinks.Add(new FDebugOutputLogSink());
+	Sinks.Add(new FFileLogSink("Mundi.log"));
+
+	bRunning.store(true, std::memory_order_release);
+	WorkerThread = std::thread([this]() { ThreadMain(); });
+	bInstanceCreated.store(true, std::memory_order_release);
+}
+
+FAsyncLog::~FAsyncLog()
+{
+	Shutdown();
+
+	for (ILogSink* Sink : Sinks)
+	{
+		delete Sink;
+	}
+	Sinks.Empty();
+
+	for (FRing* Ring : Rings)
+	{
+		delete Ring;
+	}
+	Rings.Empty();
+}
+
+void FAsyncLog::AddSink(ILogSink* Sink)
+{
+	if (!Sink) return;
+	std::lock_guard<std::mutex> Lock(SinksMutex);
+	Sinks.Add(Sink);
+}
+
+FAsyncLog::FRing* FAsyncLog::GetThreadRing()
+{
+	// 스레드당 한 번만 락을 잡고 등록, 이후 기록은 락 없이 진행
+	thread_local FRing* ThreadRing = nullptr;
+	if (!ThreadRing)
+	{
+		ThreadRing = new FRing();
+		std::lock_guard<std::mutex> Lock(RingsMutex);
+		Rings.Add(ThreadRing);
+	}
+	return ThreadRing;
+}
+
+void FAsyncLog::Log(FLogCallSite* CallSite, const char* Category, ELogVerbosity Verbosity, const char* Format, ...)
+{
+	va_list Args;
+	va_start(Args, Format);
+	LogV(CallSite, Category, Verbosity, Format, Args);
+	va_end(Args);
+}
+
+void FAsyncLog::LogV(FLogCallSite* CallSite, const char* Category, ELogVerbosity Verbosity, const char* Format, va_list Args)
+{
+	thread_local TArray<uint8> Scratch;
+	Scratch.SetNum(sizeof(FLogRecordHeader));
+
+	PackArguments(Format, Args, Scratch);
+
+	// 반복 판별은 인자 값까지 포함한 내용 기준 (포맷팅 없이 패킹된 바이트로 해시)
+	uint32 Suppressed = 0;
+	if (CallSite)
+	{
+		const uint64 MessageHash = HashMessage(Format, Scratch.GetData() + sizeof(FLogRecordHeader),
+			static_cast<uint32>(Scratch.Num()) - static_cast<uint32>(sizeof(FLogRecordHeader)));
+		if (!CallSite->ShouldLog(MessageHash, Suppressed))
+		{
+			return;
+		}
+	}
+
+	FLogRecordHeader Header{};
+	Header.Size = AlignTo8(static_cast<uint32>(Scratch.Num()));
+	Header.Suppressed = Suppressed;
+	Header.Format = Format;
+	Header.Category = Category;
+	Header.Verbosity = Verbosity;
+	Scratch.SetNum(Header.Size, 0);
+	memcpy(Scratch.GetData(), &Header, sizeof(Header));
+
+	Enqueue(Scratch);
+
+	// 치명적인 로그는 프로세스가 죽기 전에 출력되도록 즉시 비움
+	if (Verbosity == ELogVerbosity::Fatal)
+	{
+		Flush();
+	}
+}
+
+void FAsyncLog::LogText(const char* Category, ELogVerbosity Verbosity, const char* Text)
+{
+	thread_local TArray<uint8> Scratch;
+	Scratch.SetNum(sizeof(FLogRecordHeader));
+
+	WriteString(Scratch, Text ? Text : "");
+
+	FLogRecordHeader Header{};
+	Header.Size = AlignTo8(static_cast<uint32>(Scratch.Num()));
+	Header.Format = nullptr;
+	Header.Category = Category;
+	Header.Verbosity = Verbosity;
+	Scratch.SetNum(Header.Size, 0);
+	memcpy(Scratch.GetData(), &Header, sizeof(Header));
+
+	Enqueue(Scratch);
+}
+
+void FAsyncLog::Enqueue(const TArray<uint8>& Record)
+{
+	FLogRecordHeader* Header = reinterpret_cast<FLogRecordHeader*>(const_cast<uint8*>(Record.GetData()));
+	Header->Sequence = NextSequence.fetch_add(1, std::memory_order_relaxed);
+
+	// 로그 스레드가 없으면(종료 이후) 호출 스레드에서 바로 처리
+	if (!bRunning.load(std::memory_order_acquire))
+	{
+		TArray<FLogLine> Lines;
+		Lines.Add(DecodeRecord(Record.GetData()));
+		DispatchLines(Lines);
+		return;
+	}
+
+	if (Header->Size > FRing::Capacity / 2 || !GetThreadRing()->Push(Record.GetData(), Header->Size))
+	{
+		DroppedCount.fetch_add(1, std::memory_order_relaxed);
+		return;
+	}
+
+	// 위에서 bRunning을 본 뒤 Shutdown이 마지막으로 링을 비웠다면 이 기록을 읽을 스레드가 없다.
+	// 펜스로 Push와 재확인의 순서를 고정하고 (Shutdown 쪽 펜스와 짝), 종료되었으면 직접 비운다.
+	std::atomic_thread_fence(std::memory_order_seq_cst);
+	if (!bRunning.load(std::memory_order_relaxed))
+	{
+		TArray<FLogLine> Lines;
+		DrainAndDispatch(Lines);
+	}
+}
+
+bool FAsyncLog::DrainRings(TArray<FLogLine>& OutLines)
+{
+	TArray<FRing*> RingSnapshot;
+	{
+		std::lock_guard<std::mutex> Lock(RingsMutex);
+		RingSnapshot = Rings;
+	}
+
+	bool bAnyRecord = false;
+	for (FRing* Ring : RingSnapshot)
+	{
+		uint64 Tail = Ring->ReadPos.load(std::memory_order_relaxed);
+		const uint64 Head = Ring->WritePos.load(std::memory_order_acquire);
+
+		while (Tail < Head)
+		{
+			const uint32 Offset = static_cast<uint32>(Tail & FRing::Mask);
+
+			uint32 Size = 0;
+			memcpy(&Size, Ring->Buffer + Offset, sizeof(Size));
+			if (Size == WrapMarker)
+			{
+				Tail += FRing::Capacity - Offset;
+				continue;
+			}
+
+			OutLines.Add(DecodeRecord(Ring->Buffer + Offset));
+			Tail += Size;
+			bAnyRecord = true;
+		}
+
+		Ring->ReadPos.store(Tail, std::memory_order_release);
+	}
+
+	const uint64 Dropped = DroppedCount.exchange(0, std::memory_order_relaxed);
+	if (Dropped > 0)
+	{
+		FLogLine Line;
+		Line.Sequence = NextSequence.load(std::memory_order_relaxed);
+		Line.Verbosity = ELogVerbosity::Warning;
+		Line.Category = "LogTemp";
+		Line.Text = "[warning] AsyncLog: " + std::to_string(Dropped) + " messages dropped (ring buffer full)";
+		OutLines.Add(Line);
+		bAnyRecord = true;
+	}
+
+	return bAnyRecord;
+}
+
+void FAsyncLog::DispatchLines(TArray<FLogLine>& Lines)
+{
+	// 여러 스레드의 링에서 모은 로그를 기록 순서대로 정렬
+	Lines.Sort([](const FLogLine& A, const FLogLine& B) { return A.Sequence < B.Sequence; });
+
+	std::lock_guard<std::mutex> Lock(SinksMutex);
+	for (const FLogLine& Line : Lines)
+	{
+		for (ILogSink* Sink : Sinks)
+		{
+			Sink->Write(Line);
+		}
+	}
+	for (ILogSink* Sink : Sinks)
+	{
+		Sink->Flush();
+	}
+}
+
+bool FAsyncLog::DrainAndDispatch(TArray<FLogLine>& Lines)
+{
+	std::lock_guard<std::mutex> Lock(DrainMutex);
+	Lines.Empty();
+	const bool bAnyRecord = DrainRings(Lines);
+	if (bAnyRecord)
+	{
+		DispatchLines(Lines);
+	}
+	return bAnyRecord;
+}
+
+void FAsyncLog::ThreadMain()
+{
+	TArray<FLogLine> Lines;
+	while (true)
+	{
+		const bool bStopping = bStopRequested.load(std::memory_order_acquire);
+
+		const bool bAnyRecord = DrainAndDispatch(Lines);
+		DispatchGeneration.fetch_add(1, std::memory_order_release);
+
+		if (bStopping && !bAnyRecord)
+		{
+			break;
+		}
+
+		if (!bAnyRecord)
+		{
+			std::unique_lock<std::mutex> Lock(WakeMutex);
+			WakeCondition.wait_for(Lock, std::chrono::milliseconds(5));
+		}
+	}
+}
+
+void FAsyncLog::Flush()
+{
+	if (!bRunning.load(std::memory_order_acquire) || std::this_thread::get_id() == WorkerThread.get_id())
+	{
+		return;
+	}
+
+	// 진행 중인 패스가 이번 기록 이전에 링을 읽었을 수 있으므로, 새 패스가 한 번 온전히 끝날 때까지 대기
+	const uint64 StartGeneration = DispatchGeneration.load(std::memory_order_acquire);
+	WakeCondition.notify_one();
+	while (DispatchGeneration.load(std::memory_order_acquire) < StartGeneration + 2)
+	{
+		WakeCondition.notify_one();
+		std::this_thread::yield();
+	}
+}
+
+void FAsyncLog::Shutdown()
+{
+	if (!bRunning.load(std::memory_order_acquire))
+	{
+		return;
+	}
+
+	// 이후 기록은 호출 스레드에서 바로 처리하고, 링에 남은 로그는 로그 스레드가 마지막으로 비운다.
+	bRunning.store(false, std::memory_order_release);
+	std::atomic_thread_fence(std::memory_order_seq_cst);
+	bStopRequested.store(true, std::memory_order_release);
+	WakeCondition.notify_one();
+	if (WorkerThread.joinable())
+	{
+		WorkerThread.join();
+	}
+
+	// 종료 직전에 bRunning을 보고 링에 넣은 기록이 로그 스레드의 마지막 패스보다 늦었을 수 있음
+	TArray<FLogLine> Lines;
+	DrainAndDispatch(Lines);
+}
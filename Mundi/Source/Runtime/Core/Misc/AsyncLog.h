@@ -0,0 +1,185 @@
+﻿#pragma once
+#include <atomic>
+#include <condition_variable>
+#include <cstdarg>
+#include <mutex>
+#include <thread>
+#include "UEContainer.h"
+
+// -----------------------------------------------------------------------------
+// 비동기 로깅
+//  - 호출 스레드는 포맷 문자열 포인터와 인자만 스레드별 락프리 링 버퍼에 기록하고 바로 반환한다.
+//  - 실제 포맷팅과 싱크(콘솔 위젯, 파일, 디버그 출력) 처리는 백그라운드 스레드에서 수행한다.
+//  - 같은 호출 지점에서 같은 내용(포맷 + 인자 값)이 반복되면 초당 개수를 제한하고, 생략된 개수를 다음 로그에 덧붙인다.
+//    내용이 다른 로그(루프에서 항목마다 남기는 로그 등)는 제한하지 않는다.
+//  - 카테고리/상세도는 컴파일 타임에 걸러지므로 꺼진 로그는 인자 평가 비용도 없다.
+// -----------------------------------------------------------------------------
+
+enum class ELogVerbosity : uint8
+{
+	NoLogging = 0,
+	Fatal,
+	Error,
+	Warning,
+	Display,
+	Log,
+	Verbose,
+	VeryVerbose,
+};
+
+const char* LexToString(ELogVerbosity Verbosity);
+
+// 빌드 전체에서 컴파일되는 최대 상세도. 이보다 상세한 로그는 코드에서 제거된다.
+#ifndef LOG_COMPILED_MAX_VERBOSITY
+	#ifdef _EDITOR
+		#define LOG_COMPILED_MAX_VERBOSITY ELogVerbosity::Log
+	#else
+		#define LOG_COMPILED_MAX_VERBOSITY ELogVerbosity::NoLogging
+	#endif
+#endif
+
+// 같은 호출 지점에서 같은 내용의 로그를 1초에 허용하는 개수
+#ifndef LOG_RATE_LIMIT_PER_SECOND
+	#define LOG_RATE_LIMIT_PER_SECOND 10
+#endif
+
+/**
+ * @brief 로그 카테고리 선언. 카테고리별 컴파일 타임 상세도를 가진다.
+ * 사용 예) DECLARE_LOG_CATEGORY(LogParticle, Warning)
+ */
+#define DECLARE_LOG_CATEGORY(CategoryName, CompileTimeVerbosity) \
+	struct FLogCategory##CategoryName \
+	{ \
+		static constexpr const char* Name = #CategoryName; \
+		static constexpr ELogVerbosity CompiledVerbosity = ELogVerbosity::CompileTimeVerbosity; \
+	};
+
+DECLARE_LOG_CATEGORY(LogTemp, VeryVerbose)
+
+/**
+ * @brief 로그 호출 지점별 상태 (반복 로그 제한용). 매크로 안에서 static으로 하나씩 생성된다.
+ */
+struct FLogCallSite
+{
+	std::atomic<uint32> WindowStartMs{ 0 };
+	std::atomic<uint32> CountInWindow{ 0 };
+	std::atomic<uint32> SuppressedCount{ 0 };
+	std::atomic<uint64> LastMessageHash{ 0 };
+
+	// 이번 로그를 기록해야 하면 true. MessageHash는 포맷과 인자 값으로 계산한 내용 해시이며,
+	// 직전 로그와 내용이 다르면 제한 구간을 새로 시작한다. OutSuppressed에는 직전까지 생략된 개수가 담긴다.
+	bool ShouldLog(uint64 MessageHash, uint32& OutSuppressed);
+};
+
+// 백그라운드 스레드에서 포맷팅이 끝난 한 줄
+struct FLogLine
+{
+	uint64 Sequence = 0;
+	ELogVerbosity Verbosity = ELogVerbosity::Log;
+	const char* Category = nullptr;
+	FString Text;
+};
+
+/**
+ * @brief 로그 출력 대상. Write는 로그 스레드에서 호출된다.
+ */
+class ILogSink
+{
+public:
+	virtual ~ILogSink() = default;
+	virtual void Write(const FLogLine& Line) = 0;
+	virtual void Flush() {}
+};
+
+/**
+ * @class FAsyncLog
+ * @brief 스레드별 SPSC 링 버퍼 + 백그라운드 포맷팅 스레드로 구성된 로거.
+ */
+class FAsyncLog
+{
+public:
+	static FAsyncLog& Get();
+
+	// 로거가 한 번이라도 생성되었는지 (종료 경로에서 쓰지 않은 로거를 새로 만들지 않기 위함)
+	static bool IsInitialized() { return bInstanceCreated.load(std::memory_order_acquire); }
+
+	// 포맷 문자열은 반드시 정적 수명(문자열 리터럴)이어야 한다. 인자는 기록 시점에 값으로 복사된다.
+	// CallSite가 있으면 같은 내용이 반복될 때 호출 지점별 개수 제한을 적용한다.
+	void Log(FLogCallSite* CallSite, const char* Category, ELogVerbosity Verbosity, const char* Format, ...);
+	void LogV(FLogCallSite* CallSite, const char* Category, ELogVerbosity Verbosity, const char* Format, va_list Args);
+
+	// 이미 완성된 문자열을 기록 (포맷 문자열의 수명을 보장할 수 없는 경로용)
+	void LogText(const char* Category, ELogVerbosity Verbosity, const char* Text);
+
+	// 싱크는 FAsyncLog가 소유한다.
+	void AddSink(ILogSink* Sink);
+
+	// 현재까지 기록된 로그가 모두 싱크로 전달될 때까지 대기
+	void Flush();
+
+	// 로그 스레드 종료. 남은 로그를 모두 처리한 뒤 반환한다.
+	void Shutdown();
+
+	uint64 GetDroppedCount() const { return DroppedCount.load(std::memory_order_relaxed); }
+
+private:
+	FAsyncLog();
+	~FAsyncLog();
+	FAsyncLog(const FAsyncLog&) = delete;
+	FAsyncLog& operator=(const FAsyncLog&) = delete;
+
+	// 스레드 하나가 쓰고 로그 스레드 하나가 읽는 바이트 링 버퍼
+	struct FRing
+	{
+		static constexpr uint32 Capacity = 256 * 1024; // 2의 거듭제곱
+		static constexpr uint32 Mask = Capacity - 1;
+
+		alignas(64) std::atomic<uint64> WritePos{ 0 };
+		alignas(64) std::atomic<uint64> ReadPos{ 0 };
+		alignas(8) uint8 Buffer[Capacity];
+
+		bool Push(const uint8* Data, uint32 Size);
+	};
+
+	FRing* GetThreadRing();
+	void Enqueue(const TArray<uint8>& Record);
+	void ThreadMain();
+	bool DrainRings(TArray<FLogLine>& OutLines);
+	void DispatchLines(TArray<FLogLine>& Lines);
+
+	// 링을 비우고 싱크로 전달 (로그 스레드, 그리고 종료 이후 호출 스레드에서 사용)
+	bool DrainAndDispatch(TArray<FLogLine>& Lines);
+
+private:
+	static std::atomic<bool> bInstanceCreated;
+
+	std::mutex RingsMutex;			// 링 등록 시에만 사용 (기록 경로는 락 없음)
+	TArray<FRing*> Rings;
+
+	// 링을 읽는 쪽은 하나여야 하므로, 종료 전후로 로그 스레드와 호출 스레드가 겹쳐 비우지 않게 막는다
+	std::mutex DrainMutex;
+
+	std::mutex SinksMutex;
+	TArray<ILogSink*> Sinks;
+
+	std::thread WorkerThread;
+	std::mutex WakeMutex;
+	std::condition_variable WakeCondition;
+	std::atomic<bool> bStopRequested{ false };
+	std::atomic<bool> bRunning{ false };
+	std::atomic<uint64> NextSequence{ 0 };
+	std::atomic<uint64> DroppedCount{ 0 };
+	std::atomic<uint64> DispatchGeneration{ 0 };
+};
+
+// 카테고리/상세도 지정 로그. 포맷 문자열은 리터럴만 허용된다.
+#define UE_LOG_CATEGORY(CategoryName, Verbosity, Format, ...) \
+	do \
+	{ \
+		if constexpr (ELogVerbosity::Verbosity <= LOG_COMPILED_MAX_VERBOSITY && \
+			ELogVerbosity::Verbosity <= FLogCategory##CategoryName::CompiledVerbosity) \
+		{ \
+			static FLogCallSite LogCallSite_; \
+			FAsyncLog::Get().Log(&LogCallSite_, FLogCategory##CategoryName::Name, ELogVerbosity::Verbosity, "" Format, ##__VA_ARGS__); \
+		} \
+	} while (0)
@@ -71,21 +71,19 @@ FLinearColor FLinearColor::Lerp(const FLinearColor& C1, const FLinearColor& C2,
 
 FLinearColor FLinearColor::MakeRandomColor()
 {
-    return FLinearColor(
-        static_cast<float>(rand()) / RAND_MAX,
-        static_cast<float>(rand()) / RAND_MAX,
-        static_cast<float>(rand()) / RAND_MAX,
-        1.0f  // Alpha는 1.0으로 고정
-    );
+    FRandomStream& Stream = FRandomStream::GetThreadStream();
+    const float R = Stream.GetFraction();
+    const float G = Stream.GetFraction();
+    const float B = Stream.GetFraction();
+    return FLinearColor(R, G, B, 1.0f);  // Alpha는 1.0으로 고정
 }
 
 FLinearColor FLinearColor::MakeRandomSeededColor(int32 Seed)
 {
-    srand(static_cast<unsigned int>(Seed));
-    return FLinearColor(
-        static_cast<float>(rand()) / RAND_MAX,
-        static_cast<float>(rand()) / RAND_MAX,
-        static_cast<float>(rand()) / RAND_MAX,
-        1.0f  // Alpha는 1.0으로 고정
-    );
+    // 전역 rand() 상태를 건드리지 않도록 지역 스트림 사용
+    FRandomStream Stream(static_cast<uint32>(Seed));
+    const float R = Stream.GetFraction();
+    const float G = Stream.GetFraction();
+    const float B = Stream.GetFraction();
+    return FLinearColor(R, G, B, 1.0f);  // Alpha는 1.0으로 고정
 }
@@ -3,72 +3,514 @@
 #include <vector>
 #include <functional>
 #include <algorithm>
+#include <concepts>
+#include <cstddef>
 #include <memory>
+#include <new>
+#include <type_traits>
+#include <utility>
+#include "UEContainer.h"
 
 using FDelegateHandle = size_t;
 
+/**
+ * 단일 델리게이트 (std::function 대체)
+ *
+ * 바인딩 대상을 객체 안의 고정 크기 버퍼에 바로 저장하고, 넘치는 경우에만 힙에 할당합니다.
+ * 호출은 바인딩 타입별로 만들어진 함수 테이블을 한 번 거치는 간접 호출입니다.
+ *
+ * 바인딩 종류
+ * - 람다/함수 객체/함수 포인터: CreateLambda 또는 대입
+ * - 멤버 함수 (원시 포인터): CreateRaw, 객체 수명은 호출자가 보장
+ * - 멤버 함수 (UObject 약한 참조): CreateUObject, 객체가 삭제되면 호출하지 않음
+ * - 람다 + UObject 소유자: CreateWeakLambda, 소유자가 삭제되면 호출하지 않음
+ */
+template<typename... Args>
+class TInlineDelegate
+{
+public:
+	// 포인터 4개 크기: 캡처 몇 개짜리 람다와 멤버 함수 포인터 + 객체 (MSVC 다중/가상 상속 포함)가 들어감
+	static constexpr size_t InlineSize = 4 * sizeof(void*);
+
+	TInlineDelegate() = default;
+	TInlineDelegate(std::nullptr_t) {}
+
+	template<typename FunctorType>
+		requires (!std::is_same_v<std::decay_t<FunctorType>, TInlineDelegate> && std::is_invocable_v<std::decay_t<FunctorType>&, Args...>)
+	TInlineDelegate(FunctorType&& Functor)
+	{
+		BindFunctor(std::forward<FunctorType>(Functor));
+	}
+
+	TInlineDelegate(const TInlineDelegate& Other)
+	{
+		if (Other.Ops)
+		{
+			Other.Ops->Copy(Storage, Other.Storage);
+			Ops = Other.Ops;
+		}
+	}
+
+	TInlineDelegate(TInlineDelegate&& Other) noexcept
+	{
+		if (Other.Ops)
+		{
+			Other.Ops->Move(Storage, Other.Storage);
+			Ops = Other.Ops;
+			Other.Ops = nullptr;
+		}
+	}
+
+	~TInlineDelegate()
+	{
+		Unbind();
+	}
+
+	TInlineDelegate& operator=(const TInlineDelegate& Other)
+	{
+		if (this != &Other)
+		{
+			TInlineDelegate Copy(Other);
+			*this = std::move(Copy);
+		}
+		return *this;
+	}
+
+	TInlineDelegate& operator=(TInlineDelegate&& Other) noexcept
+	{
+		if (this != &Other)
+		{
+			Unbind();
+			if (Other.Ops)
+			{
+				Other.Ops->Move(Storage, Other.Storage);
+				Ops = Other.Ops;
+				Other.Ops = nullptr;
+			}
+		}
+		return *this;
+	}
+
+	TInlineDelegate& operator=(std::nullptr_t)
+	{
+		Unbind();
+		return *this;
+	}
+
+	template<typename FunctorType>
+	static TInlineDelegate CreateLambda(FunctorType&& Functor)
+	{
+		return TInlineDelegate(std::forward<FunctorType>(Functor));
+	}
+
+	template<typename ObjectType, typename MethodType>
+	static TInlineDelegate CreateRaw(ObjectType* Object, MethodType Method)
+	{
+		TInlineDelegate Delegate;
+		Delegate.BindFunctor(TRawMethodBinding<ObjectType, MethodType>{ Object, Method });
+		return Delegate;
+	}
+
+	template<typename ObjectType, typename MethodType>
+	static TInlineDelegate CreateUObject(ObjectType* Object, MethodType Method)
+	{
+		TInlineDelegate Delegate;
+		Delegate.BindFunctor(TWeakMethodBinding<ObjectType, MethodType>{ TWeakObjectPtr<ObjectType>(Object), Method });
+		return Delegate;
+	}
+
+	template<typename FunctorType>
+	static TInlineDelegate CreateWeakLambda(const UObject* Owner, FunctorType&& Functor)
+	{
+		TInlineDelegate Delegate;
+		Delegate.BindFunctor(TWeakLambdaBinding<std::decay_t<FunctorType>>{ TWeakObjectPtr<UObject>(Owner), std::forward<FunctorType>(Functor) });
+		return Delegate;
+	}
+
+	// 바인딩되어 있고, 약한 바인딩이면 소유자가 아직 살아 있음
+	bool IsBound() const { return Ops && Ops->IsAlive(Storage); }
+	explicit operator bool() const { return IsBound(); }
+
+	// 호출했으면 true (바인딩이 없거나 약한 바인딩의 소유자가 삭제되었으면 false)
+	bool ExecuteIfBound(Args... InArgs) const
+	{
+		return Ops && Ops->Invoke(Storage, std::forward<Args>(InArgs)...);
+	}
+
+	void operator()(Args... InArgs) const
+	{
+		ExecuteIfBound(std::forward<Args>(InArgs)...);
+	}
+
+	void Unbind()
+	{
+		if (Ops)
+		{
+			Ops->Destroy(Storage);
+			Ops = nullptr;
+		}
+	}
+
+private:
+	struct FOps
+	{
+		bool (*Invoke)(void* Storage, Args&&... InArgs);
+		void (*Copy)(void* Dest, const void* Source);
+		void (*Move)(void* Dest, void* Source);		// Dest에 이동 생성하고 Source는 파괴
+		void (*Destroy)(void* Storage);
+		bool (*IsAlive)(const void* Storage);
+	};
+
+	template<typename ObjectType, typename MethodType>
+	struct TRawMethodBinding
+	{
+		ObjectType* Object;
+		MethodType Method;
+
+		void operator()(Args... InArgs) const { (Object->*Method)(std::forward<Args>(InArgs)...); }
+	};
+
+	// 약한 바인딩: 호출 시 핸들을 한 번 풀어 소유자가 살아 있을 때만 호출
+	template<typename ObjectType, typename MethodType>
+	struct TWeakMethodBinding
+	{
+		TWeakObjectPtr<ObjectType> Object;
+		MethodType Method;
+
+		bool IsOwnerAlive() const { return Object.IsValid(); }
+		bool TryInvoke(Args... InArgs) const
+		{
+			ObjectType* Resolved = Object.Get();
+			if (!Resolved)
+			{
+				return false;
+			}
+			(Resolved->*Method)(std::forward<Args>(InArgs)...);
+			return true;
+		}
+		void operator()(Args... InArgs) const { TryInvoke(std::forward<Args>(InArgs)...); }
+	};
+
+	template<typename FunctorType>
+	struct TWeakLambdaBinding
+	{
+		TWeakObjectPtr<UObject> Owner;
+		FunctorType Functor;
+
+		bool IsOwnerAlive() const { return Owner.IsValid(); }
+		bool TryInvoke(Args... InArgs)
+		{
+			if (!Owner.IsValid())
+			{
+				return false;
+			}
+			Functor(std::forward<Args>(InArgs)...);
+			return true;
+		}
+		void operator()(Args... InArgs) { TryInvoke(std::forward<Args>(InArgs)...); }
+	};
+
+	template<typename FunctorType>
+	struct TOps
+	{
+		// 이동 중 예외가 나면 안 되므로 nothrow 이동 가능한 타입만 버퍼에 넣음
+		static constexpr bool bInline = sizeof(FunctorType) <= InlineSize
+			&& alignof(FunctorType) <= alignof(std::max_align_t)
+			&& std::is_nothrow_move_constructible_v<FunctorType>;
+
+		static FunctorType& Get(void* InStorage)
+		{
+			if constexpr (bInline)
+			{
+				return *std::launder(reinterpret_cast<FunctorType*>(InStorage));
+			}
+			else
+			{
+				return **reinterpret_cast<FunctorType**>(InStorage);
+			}
+		}
+
+		static const FunctorType& Get(const void* InStorage)
+		{
+			return Get(const_cast<void*>(InStorage));
+		}
+
+		template<typename SourceType>
+		static void Construct(void* InStorage, SourceType&& Source)
+		{
+			if constexpr (bInline)
+			{
+				::new (InStorage) FunctorType(std::forward<SourceType>(Source));
+			}
+			else
+			{
+				*reinterpret_cast<FunctorType**>(InStorage) = new FunctorType(std::forward<SourceType>(Source));
+			}
+		}
+
+		static bool Invoke(void* InStorage, Args&&... InArgs)
+		{
+			FunctorType& Functor = Get(InStorage);
+			if constexpr (requires { { Functor.TryInvoke(std::forward<Args>(InArgs)...) } -> std::same_as<bool>; })
+			{
+				return Functor.TryInvoke(std::forward<Args>(InArgs)...);
+			}
+			else
+			{
+				std::invoke(Functor, std::forward<Args>(InArgs)...);
+				return true;
+			}
+		}
+
+		static void Copy(void* Dest, const void* Source)
+		{
+			Construct(Dest, Get(Source));
+		}
+
+		static void Move(void* Dest, void* Source)
+		{
+			if constexpr (bInline)
+			{
+				FunctorType& SourceFunctor = Get(Source);
+				::new (Dest) FunctorType(std::move(SourceFunctor));
+				SourceFunctor.~FunctorType();
+			}
+			else
+			{
+				*reinterpret_cast<FunctorType**>(Dest) = *reinterpret_cast<FunctorType**>(Source);
+			}
+		}
+
+		static void Destroy(void* InStorage)
+		{
+			if constexpr (bInline)
+			{
+				Get(InStorage).~FunctorType();
+			}
+			else
+			{
+				delete *reinterpret_cast<FunctorType**>(InStorage);
+			}
+		}
+
+		static bool IsAlive(const void* InStorage)
+		{
+			if constexpr (requires(const FunctorType& Functor) { Functor.IsOwnerAlive(); })
+			{
+				return Get(InStorage).IsOwnerAlive();
+			}
+			else
+			{
+				return true;
+			}
+		}
+
+		static constexpr FOps Table{ &Invoke, &Copy, &Move, &Destroy, &IsAlive };
+	};
+
+	template<typename FunctorType>
+	void BindFunctor(FunctorType&& Functor)
+	{
+		using DecayedType = std::decay_t<FunctorType>;
+		static_assert(std::is_copy_constructible_v<DecayedType>, "델리게이트에 바인딩하는 대상은 복사 가능해야 합니다");
+
+		Unbind();
+		if constexpr (std::is_pointer_v<DecayedType> || std::is_member_pointer_v<DecayedType>)
+		{
+			// 널 함수 포인터는 바인딩하지 않음 (std::function과 동일)
+			if (!Functor)
+			{
+				return;
+			}
+		}
+		TOps<DecayedType>::Construct(Storage, std::forward<FunctorType>(Functor));
+		Ops = &TOps<DecayedType>::Table;
+	}
+
+private:
+	alignas(std::max_align_t) mutable unsigned char Storage[InlineSize];
+	const FOps* Ops = nullptr;
+};
+
+/**
+ * 멀티캐스트 델리게이트
+ *
+ * 바인딩은 TInlineDelegate로 저장하므로 캡처 람다/멤버 함수 등록이 힙 할당 없이 끝납니다.
+ * UObject에 AddDynamic/AddUObject로 등록한 핸들러는 약한 바인딩이라, 객체가 삭제되면 호출하지 않고
+ * 해당 항목을 호출 목록에서 제거합니다.
+ *
+ * Broadcast 도중의 Add는 대기 목록에 모았다가 끝난 뒤 붙이고 (이번 Broadcast에서는 호출 안 됨),
+ * Remove와 죽은 약한 바인딩은 표시만 해 두었다가 Broadcast가 끝날 때 한 번에 압축합니다.
+ * 따라서 호출 목록에는 항상 살아 있는 항목만 남고, Broadcast는 빈 항목을 건너뛰며 훑지 않습니다.
+ */
 template<typename... Args>
 class TDelegate
 {
 public:
-	using HandlerType = std::function<void(Args...)>;
+	using HandlerType = TInlineDelegate<Args...>;
 
 	TDelegate() : NextHandle(1) {}
 
-	FDelegateHandle Add(const HandlerType& Handler)
+	TDelegate(const TDelegate& Other)
+		: Handlers(Other.Handlers), PendingHandlers(Other.PendingHandlers), NextHandle(Other.NextHandle), bNeedsCompact(Other.bNeedsCompact)
+	{
+	}
+
+	TDelegate& operator=(const TDelegate& Other)
 	{
+		if (this != &Other)
+		{
+			Handlers = Other.Handlers;
+			PendingHandlers = Other.PendingHandlers;
+			NextHandle = Other.NextHandle;
+			bNeedsCompact = Other.bNeedsCompact;
+		}
+		return *this;
+	}
+
+	FDelegateHandle Add(HandlerType Handler)
+	{
+		if (!Handler)
+		{
+			return 0;
+		}
 		FDelegateHandle Handle = NextHandle++;
-		Handlers.push_back({ Handle, Handler });
+		(BroadcastDepth > 0 ? PendingHandlers : Handlers).push_back({ Handle, std::move(Handler) });
 		return Handle;
 	}
 
+	template<typename FunctorType>
+	FDelegateHandle AddLambda(FunctorType&& Functor)
+	{
+		return Add(HandlerType::CreateLambda(std::forward<FunctorType>(Functor)));
+	}
+
+	template<typename FunctorType>
+	FDelegateHandle AddWeakLambda(const UObject* Owner, FunctorType&& Functor)
+	{
+		return Add(HandlerType::CreateWeakLambda(Owner, std::forward<FunctorType>(Functor)));
+	}
+
+	template<typename ObjectType, typename MethodType>
+	FDelegateHandle AddRaw(ObjectType* Instance, MethodType Func)
+	{
+		return Add(HandlerType::CreateRaw(Instance, Func));
+	}
+
+	template<typename ObjectType, typename MethodType>
+	FDelegateHandle AddUObject(ObjectType* Instance, MethodType Func)
+	{
+		return Add(HandlerType::CreateUObject(Instance, Func));
+	}
+
 	// original: template<typename T>
+	// UObject(팩토리에 등록된 객체)면 약한 바인딩, 아니면 원시 포인터 바인딩
 	template<typename TObj, typename TClass>
 	FDelegateHandle AddDynamic(TObj* Instance, void(TClass::* Func)(Args...))
 	{
-		FDelegateHandle Handle = NextHandle++;
-		Handlers.push_back({
-			Handle,
-			[=](Args... args) {
-			(Instance->*Func)(args...); }
-		});
-		return Handle;
+		if constexpr (std::is_base_of_v<UObject, TObj>)
+		{
+			if (TWeakObjectPtr<TObj>(Instance).IsValid())
+			{
+				return AddUObject(Instance, Func);
+			}
+		}
+		return AddRaw(Instance, Func);
 	}
 
-	void Broadcast(Args... args) 
+	void Broadcast(Args... args)
 	{
-		for (auto& Entry : Handlers) {
-			if (Entry.Handler)
+		++BroadcastDepth;
+		for (Entry& Item : Handlers)
+		{
+			if (Item.Handle != 0 && !Item.Handler.ExecuteIfBound(args...))
 			{
-				Entry.Handler(args...);
+				// 약한 바인딩의 소유자가 삭제됨
+				Item.Handle = 0;
+				bNeedsCompact = true;
 			}
 		}
+		--BroadcastDepth;
+
+		if (BroadcastDepth == 0)
+		{
+			FlushPending();
+		}
 	}
 
 	void Remove(FDelegateHandle Handle)
 	{
-		auto it = std::remove_if(Handlers.begin(), Handlers.end(),
-		[&](const Entry& e)
+		if (Handle == 0)
 		{
-			return e.Handle == Handle;
-		});
-		Handlers.erase(it, Handlers.end());
+			return;
+		}
+
+		// Broadcast 중에는 실행 중인 핸들러를 파괴하지 않도록 표시만 해 둠
+		for (Entry& Item : Handlers)
+		{
+			if (Item.Handle == Handle)
+			{
+				Item.Handle = 0;
+				bNeedsCompact = true;
+				break;
+			}
+		}
+		std::erase_if(PendingHandlers, [Handle](const Entry& Item) { return Item.Handle == Handle; });
+
+		if (BroadcastDepth == 0)
+		{
+			FlushPending();
+		}
 	}
 
 	void Clear()
 	{
+		if (BroadcastDepth > 0)
+		{
+			for (Entry& Item : Handlers)
+			{
+				Item.Handle = 0;
+			}
+			bNeedsCompact = true;
+			PendingHandlers.clear();
+			return;
+		}
 		Handlers.clear();
+		PendingHandlers.clear();
+		bNeedsCompact = false;
 	}
 
+	bool IsBound() const { return !Handlers.empty() || !PendingHandlers.empty(); }
+
 private:
 	struct Entry
 	{
-		FDelegateHandle Handle;
+		FDelegateHandle Handle;		// 0이면 제거 대기 중
 		HandlerType Handler;
 	};
 
+	void FlushPending()
+	{
+		if (bNeedsCompact)
+		{
+			std::erase_if(Handlers, [](const Entry& Item) { return Item.Handle == 0; });
+			bNeedsCompact = false;
+		}
+		if (!PendingHandlers.empty())
+		{
+			for (Entry& Item : PendingHandlers)
+			{
+				Handlers.push_back(std::move(Item));
+			}
+			PendingHandlers.clear();
+		}
+	}
+
 	std::vector<Entry> Handlers;
+	std::vector<Entry> PendingHandlers;		// Broadcast 도중 추가된 핸들러
 	FDelegateHandle NextHandle;
+	int32 BroadcastDepth = 0;
+	bool bNeedsCompact = false;
 };
 
 // 델리게이트 인스턴스 생성용 매크로 (실제 멤버 변수 선언)
@@ -81,4 +523,4 @@ private:
 #define DECLARE_DELEGATE_TYPE(Name, ...)          using Name = TDelegate<__VA_ARGS__>;
 #define DECLARE_DELEGATE_TYPE_OneParam(Name, T1)  using Name = TDelegate<T1>;
 #define DECLARE_DELEGATE_TYPE_TwoParam(Name, T1, T2) using Name = TDelegate<T1, T2>;
-#define DECLARE_DYNAMIC_DELEGATE_TYPE(Name, ...)  using Name = std::shared_ptr<TDelegate<__VA_ARGS__>>;
\ No newline at end of file
+#define DECLARE_DYNAMIC_DELEGATE_TYPE(Name, ...)  using Name = std::shared_ptr<TDelegate<__VA_ARGS__>>;
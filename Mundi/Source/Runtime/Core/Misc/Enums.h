@@ -252,4 +252,13 @@ enum class EWorldType : uint8
 
     End,
     PreviewMinimal, 
-};
\ No newline at end of file
+};
+
+// 프리미티브가 속한 충돌 채널 (씬 쿼리에서 채널 마스크로 필터링)
+enum class ECollisionChannel : uint8
+{
+    WorldStatic,    // 움직이지 않는 레벨 지오메트리
+    WorldDynamic,   // 움직이는 오브젝트, 트리거
+    Pawn,           // 캐릭터
+    PhysicsBody,    // 물리 시뮬레이션 대상
+};
@@ -37,13 +37,13 @@ uint32 FNamePool::Add(const FString& InStr)
     TMap<FString, uint32>& NameMap = GetNameMap();
     TArray<FNameEntry>& Entries = GetEntries();
 
-    auto it = NameMap.find(Lower);
-    if (it != NameMap.end())
+    // 한 번의 탐사로 찾거나 추가
+    uint32 NewIndex = (uint32)Entries.size();
+    auto [it, bInserted] = NameMap.try_emplace(Lower, NewIndex);
+    if (!bInserted)
         return it->second;
 
-    uint32 NewIndex = (uint32)Entries.size();
-    Entries.push_back({ InStr, Lower });
-    NameMap[Lower] = NewIndex;
+    Entries.push_back({ InStr, std::move(Lower) });
     return NewIndex;
 }
 
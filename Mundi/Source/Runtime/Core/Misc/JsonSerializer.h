@@ -393,6 +393,9 @@ public:
 				}
 			}
 
+			// 로드한 키로 커브 룩업 테이블 생성
+			OutValue.Bake();
+
 			return true;
 		}
 		return false;
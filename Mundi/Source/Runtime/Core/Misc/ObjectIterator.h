@@ -1,20 +1,35 @@
 ﻿#pragma once
 
-#include "ObjectFactory.h"
+#include "Object.h"
 
+// TObject와 그 자식 클래스의 살아 있는 인스턴스를 순회
+// 전체 GUObjectArray 대신 클래스 트리의 연속 구간(자신 + 자식 클래스)의 인스턴스 목록만 돌기 때문에
+// 비용은 전체 오브젝트 수가 아니라 일치하는 오브젝트 수에 비례함
+// 각 목록은 뒤에서부터 순회하므로 순회 중 현재 오브젝트를 삭제해도 (swap-remove) 다음 오브젝트를 건너뛰지 않음
 template<typename TObject>
 class TObjectIterator
 {
 public:
 	TObjectIterator()
 	{
-		++(*this); // 첫 번째 유효 객체로 이동
+		UClass::EnsureClassTree();
+
+		const UClass* Class = TObject::StaticClass();
+		if (Class->ClassTreeIndex == 0)
+		{
+			// 트리에 번호가 없는 클래스 (부모가 등록되지 않음): 순회할 구간 없음
+			return;
+		}
+
+		ClassCursor = static_cast<int32>(Class->ClassTreeIndex) - 1;
+		ClassEnd = static_cast<int32>(Class->ClassTreeLastDescendant);
+		AdvanceToNextValidObject(); // 첫 번째 유효 객체로 이동
 	}
 
 	// 다음 객체로 이동
 	TObjectIterator& operator++()
 	{
-		++CurrentIndex;
+		--InstanceCursor;
 		AdvanceToNextValidObject();
 		return *this;
 	}
@@ -22,8 +37,8 @@ public:
 	// 현재 객체에 접근
 	TObject* operator*() const
 	{
-		// 이 시점의 CurrentIndex는 유효한 TObject를 가리키고 있어야 함
-		return static_cast<TObject*>(GUObjectArray[CurrentIndex]);
+		// 이 시점의 커서는 유효한 TObject를 가리키고 있어야 함
+		return static_cast<TObject*>(UClass::GetClassTree()[ClassCursor]->Instances[InstanceCursor]);
 	}
 
 	// 현재 객체에 접근 (포인터 연산자)
@@ -35,34 +50,41 @@ public:
 	// 비교 연산자
 	bool operator!=(const TObjectIterator& Other) const
 	{
-		return CurrentIndex != Other.CurrentIndex;
+		return ClassCursor != Other.ClassCursor || InstanceCursor != Other.InstanceCursor;
 	}
 
 	// bool 변환 연산자
 	explicit operator bool() const
 	{
-		// CurrentIndex가 배열 범위 내에 있는지 확인
-		return CurrentIndex < GUObjectArray.Num();
+		// 아직 순회할 클래스가 남아 있는지 확인
+		return ClassCursor < ClassEnd;
 	}
 
 private:
-	// 현재 인덱스부터 시작하여 다음 유효 객체를 찾는 헬퍼 함수
+	// 현재 클래스 목록에 남은 인스턴스가 없으면 다음 자식 클래스로 이동
 	void AdvanceToNextValidObject()
 	{
-		while (CurrentIndex < GUObjectArray.Num())
+		while (ClassCursor < ClassEnd)
 		{
-			UObject* Object = GUObjectArray[CurrentIndex];
-			// 현재 객체가 유효하고, TObject 타입이면 검색 종료
-			if (Object && Object->IsA<TObject>())
+			const TArray<UObject*>& Instances = UClass::GetClassTree()[ClassCursor]->Instances;
+			// 순회 중 여러 개가 삭제돼 목록이 줄었으면 끝으로 당김
+			if (InstanceCursor >= Instances.Num())
+			{
+				InstanceCursor = Instances.Num() - 1;
+			}
+			if (InstanceCursor >= 0)
 			{
 				break;
 			}
 
-			// 다음 인덱스로 이동
-			++CurrentIndex;
+			// 다음 클래스는 마지막 인스턴스부터
+			++ClassCursor;
+			InstanceCursor = INT32_MAX;
 		}
 	}
 
 private:
-	int32 CurrentIndex = -1;
+	int32 ClassCursor = 0;		// UClass::GetClassTree() 인덱스
+	int32 ClassEnd = 0;			// 자식 클래스 구간의 끝 (미포함)
+	int32 InstanceCursor = INT32_MAX;
 };
@@ -0,0 +1,457 @@
+﻿#include "pch.h"
+#include "Profiler.h"
+#include "MemoryManager.h"
+#include <cstdarg>
+#include <cstdio>
+#include <mutex>
+
+std::atomic<bool> FProfiler::bCapturing{ false };
+
+namespace
+{
+	// 스레드 하나가 쓰고 내보내기 시에만 다른 스레드가 읽는 이벤트 버퍼
+	// 청크는 한 번 할당하면 옮기지 않으므로, 읽는 쪽은 NumEvents(acquire)까지 락 없이 읽을 수 있다.
+	// NumEvents/DroppedEvents는 소유 스레드만 쓴다. 새 캡처가 시작되면(GCaptureEpoch 증가)
+	// 소유 스레드가 다음 기록 때 Epoch를 보고 스스로 비우며, 읽는 쪽은 Epoch가 다른 버퍼를 빈 버퍼로 본다.
+	struct FThreadEventBuffer
+	{
+		static constexpr uint32 ChunkShift = 14;
+		static constexpr uint32 ChunkSize = 1u << ChunkShift;	// 이벤트 16384개 (약 640KB)
+		static constexpr uint32 ChunkMask = ChunkSize - 1;
+		static constexpr uint32 MaxChunks = 256;				// 스레드당 최대 약 420만 건, 넘치면 버림
+
+		uint32 ThreadIndex = 0;
+		char ThreadName[64] = {};
+		FProfileEvent* Chunks[MaxChunks] = {};
+		std::atomic<uint32> NumEvents{ 0 };
+		std::atomic<uint64> DroppedEvents{ 0 };
+		std::atomic<uint32> Epoch{ 0 };		// 이 버퍼의 이벤트가 속한 캡처
+	};
+
+	// 스레드가 끝나도 버퍼는 남겨 둔다 (캡처 중 종료한 워커의 이벤트도 내보내기 위해)
+	std::mutex& GetRegistryMutex()
+	{
+		static std::mutex Mutex;
+		return Mutex;
+	}
+
+	TArray<FThreadEventBuffer*>& GetRegisteredBuffers()
+	{
+		static TArray<FThreadEventBuffer*> Buffers;
+		return Buffers;
+	}
+
+	thread_local FThreadEventBuffer* GThreadEventBuffer = nullptr;
+
+	uint64 GCaptureStartCycles = 0;
+	std::atomic<uint32> GCaptureEpoch{ 0 };	// StartCapture마다 증가
+	std::atomic<uint32> GCapturedFrameCount{ 0 };
+
+	// CaptureFrames 상태 (게임 스레드 전용)
+	int32 GFramesToCapture = 0;
+	FString GPendingOutputPath;
+
+	FThreadEventBuffer* GetThreadEventBuffer()
+	{
+		if (!GThreadEventBuffer)
+		{
+			FThreadEventBuffer* Buffer = new FThreadEventBuffer();
+			std::lock_guard<std::mutex> Lock(GetRegistryMutex());
+			TArray<FThreadEventBuffer*>& Buffers = GetRegisteredBuffers();
+			Buffer->ThreadIndex = static_cast<uint32>(Buffers.Num()) + 1;
+			snprintf(Buffer->ThreadName, sizeof(Buffer->ThreadName), "Worker %u", Buffer->ThreadIndex);
+			Buffers.Add(Buffer);
+			GThreadEventBuffer = Buffer;
+		}
+		return GThreadEventBuffer;
+	}
+
+	void PushEvent(const FProfileEvent& Event)
+	{
+		FThreadEventBuffer* Buffer = GetThreadEventBuffer();
+
+		// 이전 캡처의 이벤트는 소유 스레드가 여기서 버림 (다른 스레드는 이 버퍼의 카운터를 쓰지 않음)
+		// 카운터를 먼저 비운 뒤 Epoch를 올리므로, 새 Epoch를 본 읽는 쪽은 이전 캡처의 개수를 보지 않는다.
+		const uint32 CaptureEpoch = GCaptureEpoch.load(std::memory_order_acquire);
+		if (Buffer->Epoch.load(std::memory_order_relaxed) != CaptureEpoch)
+		{
+			Buffer->NumEvents.store(0, std::memory_order_relaxed);
+			Buffer->DroppedEvents.store(0, std::memory_order_relaxed);
+			Buffer->Epoch.store(CaptureEpoch, std::memory_order_release);
+		}
+
+		const uint32 Index = Buffer->NumEvents.load(std::memory_order_relaxed);
+		const uint32 Chunk = Index >> FThreadEventBuffer::ChunkShift;
+		if (Chunk >= FThreadEventBuffer::MaxChunks)
+		{
+			Buffer->DroppedEvents.fetch_add(1, std::memory_order_relaxed);
+			return;
+		}
+		if (!Buffer->Chunks[Chunk])
+		{
+			Buffer->Chunks[Chunk] = new FProfileEvent[FThreadEventBuffer::ChunkSize];
+		}
+		Buffer->Chunks[Chunk][Index & FThreadEventBuffer::ChunkMask] = Event;
+		Buffer->NumEvents.store(Index + 1, std::memory_order_release);
+	}
+
+	const FProfileEvent& GetEvent(const FThreadEventBuffer& Buffer, uint32 Index)
+	{
+		return Buffer.Chunks[Index >> FThreadEventBuffer::ChunkShift][Index & FThreadEventBuffer::ChunkMask];
+	}
+
+	// 버퍼가 마지막(현재) 캡처의 이벤트를 담고 있는지. 아직 비우지 않은 이전 캡처 버퍼는 빈 것으로 취급
+	bool IsCurrentEpoch(const FThreadEventBuffer& Buffer)
+	{
+		return Buffer.Epoch.load(std::memory_order_acquire) == GCaptureEpoch.load(std::memory_order_relaxed);
+	}
+
+	// 내보내기/집계용 스냅샷: 등록된 버퍼와 각 버퍼에서 지금까지 완성된 이벤트 수
+	struct FBufferSnapshot
+	{
+		const FThreadEventBuffer* Buffer;
+		uint32 NumEvents;
+	};
+
+	TArray<FBufferSnapshot> SnapshotBuffers()
+	{
+		TArray<FBufferSnapshot> Snapshots;
+		std::lock_guard<std::mutex> Lock(GetRegistryMutex());
+		for (const FThreadEventBuffer* Buffer : GetRegisteredBuffers())
+		{
+			// Epoch(acquire)를 먼저 읽어야 같은 캡처의 NumEvents를 본다
+			const uint32 NumEvents = IsCurrentEpoch(*Buffer) ? Buffer->NumEvents.load(std::memory_order_acquire) : 0;
+			Snapshots.Add({ Buffer, NumEvents });
+		}
+		return Snapshots;
+	}
+
+	void AppendFormat(FString& Out, const char* Format, ...)
+	{
+		char Text[256];
+		va_list Args;
+		va_start(Args, Format);
+		const int Written = vsnprintf(Text, sizeof(Text), Format, Args);
+		va_end(Args);
+		if (Written > 0)
+		{
+			Out.append(Text, static_cast<size_t>(std::min<int>(Written, sizeof(Text) - 1)));
+		}
+	}
+
+	void AppendJsonString(FString& Out, const char* Text)
+	{
+		Out += '"';
+		for (const char* Cursor = Text ? Text : ""; *Cursor; ++Cursor)
+		{
+			const unsigned char Char = static_cast<unsigned char>(*Cursor);
+			if (Char == '"' || Char == '\\')
+			{
+				Out += '\\';
+				Out += static_cast<char>(Char);
+			}
+			else if (Char < 0x20)
+			{
+				AppendFormat(Out, "\\u%04x", Char);
+			}
+			else
+			{
+				Out += static_cast<char>(Char);
+			}
+		}
+		Out += '"';
+	}
+}
+
+void FProfiler::StartCapture()
+{
+	bCapturing.store(false, std::memory_order_relaxed);
+	// 다른 스레드의 버퍼는 건드리지 않고 캡처 번호만 올림 (각 스레드가 다음 기록 때 스스로 비움)
+	GCaptureEpoch.fetch_add(1, std::memory_order_release);
+	GCapturedFrameCount.store(0, std::memory_order_relaxed);
+	GFramesToCapture = 0;
+	GCaptureStartCycles = FPlatformTime::Cycles64();
+	bCapturing.store(true, std::memory_order_release);
+}
+
+void FProfiler::StopCapture()
+{
+	bCapturing.store(false, std::memory_order_release);
+	GFramesToCapture = 0;
+}
+
+void FProfiler::CaptureFrames(int32 FrameCount, const FString& OutputPath)
+{
+	StartCapture();
+	GFramesToCapture = std::max(FrameCount, 1);
+	GPendingOutputPath = OutputPath;
+}
+
+void FProfiler::MarkFrame()
+{
+	if (!IsCapturing())
+	{
+		return;
+	}
+
+	// 요청한 프레임 수를 다 채웠으면 다음 프레임 경계에서 멈추고 내보냄
+	const uint32 CapturedFrames = GCapturedFrameCount.load(std::memory_order_relaxed);
+	if (GFramesToCapture > 0 && CapturedFrames >= static_cast<uint32>(GFramesToCapture))
+	{
+		StopCapture();
+		ExportChromeTrace(GPendingOutputPath);
+		return;
+	}
+
+	FProfileEvent Event{};
+	Event.Name = "Frame";
+	Event.StartCycles = FPlatformTime::Cycles64();
+	Event.FrameNumber = CapturedFrames + 1;
+	Event.Type = EProfileEventType::Frame;
+	PushEvent(Event);
+	GCapturedFrameCount.store(CapturedFrames + 1, std::memory_order_relaxed);
+
+	SetCounter("UObject Memory (KB)", static_cast<double>(FMemoryManager::GetTotalAllocationBytes()) / 1024.0);
+	SetCounter("UObject Allocations", static_cast<double>(FMemoryManager::GetTotalAllocationCount()));
+}
+
+void FProfiler::SetCounter(const char* Name, double Value)
+{
+	if (!IsCapturing())
+	{
+		return;
+	}
+
+	FProfileEvent Event{};
+	Event.Name = Name;
+	Event.StartCycles = FPlatformTime::Cycles64();
+	Event.Value = Value;
+	Event.Type = EProfileEventType::Counter;
+	PushEvent(Event);
+}
+
+void FProfiler::SetThreadName(const char* Name)
+{
+	FThreadEventBuffer* Buffer = GetThreadEventBuffer();
+	snprintf(Buffer->ThreadName, sizeof(Buffer->ThreadName), "%s", Name ? Name : "");
+}
+
+void FProfiler::RecordScope(const char* Name, uint64 StartCycles, uint64 EndCycles, uint32 Depth, uint64 AllocatedBytes, uint32 AllocationCount)
+{
+	// 스코프 도중 캡처가 멈췄으면 버림
+	if (!IsCapturing())
+	{
+		return;
+	}
+
+	FProfileEvent Event{};
+	Event.Name = Name;
+	Event.StartCycles = StartCycles;
+	Event.EndCycles = EndCycles;
+	Event.AllocatedBytes = AllocatedBytes;
+	Event.AllocationCount = AllocationCount;
+	Event.Depth = static_cast<uint16>(std::min<uint32>(Depth, UINT16_MAX));
+	Event.Type = EProfileEventType::Scope;
+	PushEvent(Event);
+}
+
+double FProfiler::CyclesToMicroseconds(uint64 Cycles)
+{
+	const double Delta = static_cast<double>(static_cast<int64>(Cycles - GCaptureStartCycles));
+	return Delta * FPlatformTime::GetSecondsPerCycle() * 1000000.0;
+}
+
+void FProfiler::WriteChromeTrace(FString& OutJson)
+{
+	const TArray<FBufferSnapshot> Snapshots = SnapshotBuffers();
+	const double MicrosecondsPerCycle = FPlatformTime::GetSecondsPerCycle() * 1000000.0;
+
+	OutJson.clear();
+	OutJson += "{\"displayTimeUnit\":\"ms\",\"traceEvents\":[\n";
+	bool bFirst = true;
+	auto BeginEvent = [&OutJson, &bFirst]()
+	{
+		if (!bFirst)
+		{
+			OutJson += ",\n";
+		}
+		bFirst = false;
+	};
+
+	BeginEvent();
+	OutJson += "{\"ph\":\"M\",\"pid\":1,\"tid\":0,\"name\":\"process_name\",\"args\":{\"name\":\"Mundi\"}}";
+
+	TArray<uint32> Order;
+	for (const FBufferSnapshot& Snapshot : Snapshots)
+	{
+		const FThreadEventBuffer& Buffer = *Snapshot.Buffer;
+		if (Snapshot.NumEvents == 0)
+		{
+			continue;
+		}
+
+		BeginEvent();
+		AppendFormat(OutJson, "{\"ph\":\"M\",\"pid\":1,\"tid\":%u,\"name\":\"thread_name\",\"args\":{\"name\":", Buffer.ThreadIndex);
+		AppendJsonString(OutJson, Buffer.ThreadName);
+		OutJson += "}}";
+		BeginEvent();
+		AppendFormat(OutJson, "{\"ph\":\"M\",\"pid\":1,\"tid\":%u,\"name\":\"thread_sort_index\",\"args\":{\"sort_index\":%u}}", Buffer.ThreadIndex, Buffer.ThreadIndex);
+
+		// 스코프는 끝난 순서로 기록되므로 시작 시각(같으면 바깥 스코프 먼저) 순으로 정렬해 내보냄
+		Order.resize(Snapshot.NumEvents);
+		for (uint32 Index = 0; Index < Snapshot.NumEvents; ++Index)
+		{
+			Order[Index] = Index;
+		}
+		std::stable_sort(Order.begin(), Order.end(), [&Buffer](uint32 A, uint32 B)
+		{
+			const FProfileEvent& EventA = GetEvent(Buffer, A);
+			const FProfileEvent& EventB = GetEvent(Buffer, B);
+			if (EventA.StartCycles != EventB.StartCycles)
+			{
+				return EventA.StartCycles < EventB.StartCycles;
+			}
+			return EventA.Depth < EventB.Depth;
+		});
+
+		for (uint32 Index : Order)
+		{
+			const FProfileEvent& Event = GetEvent(Buffer, Index);
+			const double Timestamp = CyclesToMicroseconds(Event.StartCycles);
+			BeginEvent();
+			switch (Event.Type)
+			{
+			case EProfileEventType::Scope:
+				OutJson += "{\"ph\":\"X\",\"name\":";
+				AppendJsonString(OutJson, Event.Name);
+				AppendFormat(OutJson, ",\"pid\":1,\"tid\":%u,\"ts\":%.3f,\"dur\":%.3f,\"args\":{\"alloc_bytes\":%llu,\"alloc_count\":%u}}",
+					Buffer.ThreadIndex, Timestamp, static_cast<double>(Event.EndCycles - Event.StartCycles) * MicrosecondsPerCycle,
+					static_cast<unsigned long long>(Event.AllocatedBytes), Event.AllocationCount);
+				break;
+			case EProfileEventType::Counter:
+				OutJson += "{\"ph\":\"C\",\"name\":";
+				AppendJsonString(OutJson, Event.Name);
+				AppendFormat(OutJson, ",\"pid\":1,\"tid\":%u,\"ts\":%.3f,\"args\":{\"value\":%.17g}}", Buffer.ThreadIndex, Timestamp, Event.Value);
+				break;
+			case EProfileEventType::Frame:
+				AppendFormat(OutJson, "{\"ph\":\"i\",\"s\":\"g\",\"name\":\"Frame %llu\",\"pid\":1,\"tid\":%u,\"ts\":%.3f}",
+					static_cast<unsigned long long>(Event.FrameNumber), Buffer.ThreadIndex, Timestamp);
+				break;
+			}
+		}
+	}
+
+	OutJson += "\n]}\n";
+}
+
+bool FProfiler::ExportChromeTrace(const FString& OutputPath)
+{
+	FString Json;
+	WriteChromeTrace(Json);
+
+	std::error_code ErrorCode;
+	const std::filesystem::path Path(UTF8ToWide(OutputPath));
+	if (Path.has_parent_path())
+	{
+		std::filesystem::create_directories(Path.parent_path(), ErrorCode);
+	}
+
+	std::ofstream File(Path, std::ios::binary | std::ios::trunc);
+	if (!File.is_open())
+	{
+		return false;
+	}
+	File.write(Json.data(), static_cast<std::streamsize>(Json.size()));
+	return File.good();
+}
+
+void FProfiler::GetScopeStats(TArray<FProfileScopeStats>& OutStats)
+{
+	OutStats.clear();
+	const TArray<FBufferSnapshot> Snapshots = SnapshotBuffers();
+	const double MillisecondsPerCycle = FPlatformTime::GetSecondsPerCycle() * 1000.0;
+
+	TMap<FString, int32> StatIndices;
+
+	// 깊이별로 아직 부모에 넘기지 않은 자식 스코프의 시간/할당 합
+	// 스코프는 끝난 순서(자식 -> 부모)로 기록되므로 부모를 만났을 때 깊이 + 1 칸이 곧 직계 자식 합이다.
+	TArray<uint64> ChildCycles;
+	TArray<uint64> ChildBytes;
+	TArray<uint64> ChildCounts;
+
+	for (const FBufferSnapshot& Snapshot : Snapshots)
+	{
+		const FThreadEventBuffer& Buffer = *Snapshot.Buffer;
+		ChildCycles.assign(UINT16_MAX + 2, 0);
+		ChildBytes.assign(UINT16_MAX + 2, 0);
+		ChildCounts.assign(UINT16_MAX + 2, 0);
+
+		for (uint32 Index = 0; Index < Snapshot.NumEvents; ++Index)
+		{
+			const FProfileEvent& Event = GetEvent(Buffer, Index);
+			if (Event.Type != EProfileEventType::Scope)
+			{
+				continue;
+			}
+
+			const uint32 Depth = Event.Depth;
+			const uint64 Cycles = Event.EndCycles - Event.StartCycles;
+			const uint64 ExclusiveCycles = Cycles - std::min(Cycles, ChildCycles[Depth + 1]);
+			const uint64 ExclusiveBytes = Event.AllocatedBytes - std::min(Event.AllocatedBytes, ChildBytes[Depth + 1]);
+			const uint64 ExclusiveCount = Event.AllocationCount - std::min<uint64>(Event.AllocationCount, ChildCounts[Depth + 1]);
+			ChildCycles[Depth + 1] = 0;
+			ChildBytes[Depth + 1] = 0;
+			ChildCounts[Depth + 1] = 0;
+			ChildCycles[Depth] += Cycles;
+			ChildBytes[Depth] += Event.AllocatedBytes;
+			ChildCounts[Depth] += Event.AllocationCount;
+
+			auto [Iter, bInserted] = StatIndices.try_emplace(FString(Event.Name), OutStats.Num());
+			if (bInserted)
+			{
+				FProfileScopeStats& NewStats = OutStats.emplace_back();
+				NewStats.Name = Event.Name;
+			}
+			FProfileScopeStats& Stats = OutStats[Iter->second];
+			++Stats.CallCount;
+			Stats.InclusiveMs += static_cast<double>(Cycles) * MillisecondsPerCycle;
+			Stats.ExclusiveMs += static_cast<double>(ExclusiveCycles) * MillisecondsPerCycle;
+			Stats.AllocatedBytes += ExclusiveBytes;
+			Stats.AllocationCount += ExclusiveCount;
+		}
+	}
+
+	std::sort(OutStats.begin(), OutStats.end(), [](const FProfileScopeStats& A, const FProfileScopeStats& B)
+	{
+		return A.ExclusiveMs > B.ExclusiveMs;
+	});
+}
+
+uint32 FProfiler::GetCapturedFrameCount()
+{
+	return GCapturedFrameCount.load(std::memory_order_relaxed);
+}
+
+uint64 FProfiler::GetCapturedEventCount()
+{
+	uint64 Count = 0;
+	for (const FBufferSnapshot& Snapshot : SnapshotBuffers())
+	{
+		Count += Snapshot.NumEvents;
+	}
+	return Count;
+}
+
+uint64 FProfiler::GetDroppedEventCount()
+{
+	uint64 Count = 0;
+	std::lock_guard<std::mutex> Lock(GetRegistryMutex());
+	for (const FThreadEventBuffer* Buffer : GetRegisteredBuffers())
+	{
+		if (IsCurrentEpoch(*Buffer))
+		{
+			Count += Buffer->DroppedEvents.load(std::memory_order_relaxed);
+		}
+	}
+	return Count;
+}
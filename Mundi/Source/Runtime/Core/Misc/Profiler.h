@@ -0,0 +1,174 @@
+﻿#pragma once
+#include <atomic>
+#include "UEContainer.h"
+#include "PlatformTime.h"
+
+// -----------------------------------------------------------------------------
+// 계층형 프레임 프로파일러
+//  - 캡처 중에만 기록한다. 꺼져 있을 때 스코프 비용은 원자 변수 읽기 한 번이다.
+//  - 스레드마다 이벤트 버퍼를 두고 소유 스레드만 쓰므로 기록 경로에 락이 없다.
+//  - 스코프는 끝날 때 시작/끝 사이클과 깊이를 한 건으로 기록한다 (중첩은 시간 구간으로 복원).
+//  - FMemoryManager 할당은 스레드별 누적 카운터에 더해지고, 스코프는 시작/끝 차이를 자기 할당량으로 남긴다.
+//  - Chrome/Perfetto 트레이스 JSON으로 내보낸다 (chrome://tracing, ui.perfetto.dev).
+//  - UI에 의존하지 않으므로 에디터 없이도 캡처/내보내기/요약을 사용할 수 있다.
+// -----------------------------------------------------------------------------
+
+// 0이면 스코프/카운터 매크로와 할당 추적이 코드에서 제거된다.
+#ifndef PROFILER_ENABLED
+	#define PROFILER_ENABLED 1
+#endif
+
+enum class EProfileEventType : uint8
+{
+	Scope,
+	Counter,
+	Frame,
+};
+
+// 버퍼에 기록되는 이벤트 한 건
+struct FProfileEvent
+{
+	const char* Name;			// 정적 수명 문자열 (문자열 리터럴, UClass 이름 등)
+	uint64 StartCycles;
+	union
+	{
+		uint64 EndCycles;		// Scope
+		double Value;			// Counter
+		uint64 FrameNumber;		// Frame
+	};
+	uint64 AllocatedBytes;		// Scope: 스코프 안(자식 포함)에서 FMemoryManager로 할당한 바이트
+	uint32 AllocationCount;
+	uint16 Depth;				// Scope: 같은 스레드의 캡처 중 스코프 중첩 깊이 (0 = 최상위)
+	EProfileEventType Type;
+};
+
+// 스코프 이름별 집계 (PROFILE STOP 출력, 헤드리스 검증용)
+struct FProfileScopeStats
+{
+	FString Name;
+	uint32 CallCount = 0;
+	double InclusiveMs = 0.0;
+	double ExclusiveMs = 0.0;		// 자식 스코프 시간을 뺀 값
+	uint64 AllocatedBytes = 0;		// 자식 스코프 할당 제외
+	uint64 AllocationCount = 0;
+};
+
+// 스레드별 누적 카운터. FMemoryManager가 매 할당마다 갱신하므로 헤더에 두고 인라인으로 접근한다.
+struct FProfilerThreadCounters
+{
+	uint64 AllocatedBytes;
+	uint64 AllocationCount;
+	uint32 ScopeDepth;
+};
+inline thread_local FProfilerThreadCounters GProfilerThreadCounters{};
+
+class FProfiler
+{
+public:
+	static bool IsCapturing() { return bCapturing.load(std::memory_order_relaxed); }
+
+	// 새 캡처 시작 (게임 스레드에서 프레임 사이에 호출). 이전 캡처 이벤트는 각 스레드가 다음 기록 때 버림
+	static void StartCapture();
+	static void StopCapture();
+
+	// 다음 FrameCount 프레임을 캡처한 뒤 자동으로 멈추고 OutputPath로 내보낸다.
+	static void CaptureFrames(int32 FrameCount, const FString& OutputPath);
+
+	// 프레임 경계. 메인 루프 맨 앞에서 호출하며, 프레임 번호와 메모리 카운터를 함께 기록한다.
+	static void MarkFrame();
+
+	// 이름 붙은 카운터 값 (트레이스에서 그래프로 표시)
+	static void SetCounter(const char* Name, double Value);
+
+	// 현재 스레드의 트레이스 표시 이름 (지정하지 않으면 "Worker N")
+	static void SetThreadName(const char* Name);
+
+	// 스코프 한 건 기록 (FProfileScope가 호출)
+	static void RecordScope(const char* Name, uint64 StartCycles, uint64 EndCycles, uint32 Depth, uint64 AllocatedBytes, uint32 AllocationCount);
+
+	// 마지막 캡처를 Chrome 트레이스 JSON으로 저장 (캡처 중이면 지금까지 기록된 이벤트)
+	static bool ExportChromeTrace(const FString& OutputPath);
+	static void WriteChromeTrace(FString& OutJson);
+
+	// 캡처 시작 시각 기준 마이크로초 (트레이스 타임스탬프)
+	static double CyclesToMicroseconds(uint64 Cycles);
+
+	// 스코프 이름별 집계, 자기 시간(ExclusiveMs) 내림차순
+	static void GetScopeStats(TArray<FProfileScopeStats>& OutStats);
+
+	static uint32 GetCapturedFrameCount();
+	static uint64 GetCapturedEventCount();
+	static uint64 GetDroppedEventCount();
+
+	// FMemoryManager 할당 훅 (캡처 여부와 관계없이 스레드 카운터만 갱신)
+	static void TrackAllocation(SIZE_T Size)
+	{
+#if PROFILER_ENABLED
+		FProfilerThreadCounters& Counters = GProfilerThreadCounters;
+		Counters.AllocatedBytes += Size;
+		++Counters.AllocationCount;
+#endif
+	}
+
+private:
+	static std::atomic<bool> bCapturing;
+};
+
+/**
+ * 스코프 타이머. 생성 시점에 캡처 중이었던 스코프만 기록한다.
+ * 이름은 정적 수명이어야 한다 (버퍼에는 포인터만 저장).
+ */
+class FProfileScope
+{
+public:
+	explicit FProfileScope(const char* InName)
+	{
+		if (FProfiler::IsCapturing())
+		{
+			FProfilerThreadCounters& Counters = GProfilerThreadCounters;
+			Name = InName;
+			Depth = Counters.ScopeDepth++;
+			StartAllocatedBytes = Counters.AllocatedBytes;
+			StartAllocationCount = Counters.AllocationCount;
+			StartCycles = FPlatformTime::Cycles64();
+		}
+	}
+
+	~FProfileScope()
+	{
+		if (Name)
+		{
+			const uint64 EndCycles = FPlatformTime::Cycles64();
+			FProfilerThreadCounters& Counters = GProfilerThreadCounters;
+			--Counters.ScopeDepth;
+			FProfiler::RecordScope(Name, StartCycles, EndCycles, Depth,
+				Counters.AllocatedBytes - StartAllocatedBytes,
+				static_cast<uint32>(Counters.AllocationCount - StartAllocationCount));
+		}
+	}
+
+	FProfileScope(const FProfileScope&) = delete;
+	FProfileScope& operator=(const FProfileScope&) = delete;
+
+private:
+	const char* Name = nullptr;		// nullptr이면 기록하지 않음
+	uint64 StartCycles = 0;
+	uint64 StartAllocatedBytes = 0;
+	uint64 StartAllocationCount = 0;
+	uint32 Depth = 0;
+};
+
+#define PROFILE_JOIN_INNER(A, B) A##B
+#define PROFILE_JOIN(A, B) PROFILE_JOIN_INNER(A, B)
+
+#if PROFILER_ENABLED
+	#define PROFILE_SCOPE(Name)				FProfileScope PROFILE_JOIN(ProfileScope_, __LINE__)(Name)
+	#define PROFILE_FUNCTION()				PROFILE_SCOPE(__FUNCTION__)
+	#define PROFILE_COUNTER(Name, Value)	FProfiler::SetCounter(Name, static_cast<double>(Value))
+	#define PROFILE_FRAME()					FProfiler::MarkFrame()
+#else
+	#define PROFILE_SCOPE(Name)
+	#define PROFILE_FUNCTION()
+	#define PROFILE_COUNTER(Name, Value)
+	#define PROFILE_FRAME()
+#endif
@@ -0,0 +1,230 @@
+﻿#include "pch.h"
+#include "ProfilerTests.h"
+#include "Profiler.h"
+#include "MemoryManager.h"
+#include "TestContext.h"
+#include <atomic>
+#include <thread>
+
+namespace
+{
+	// 이름은 버퍼에 포인터로만 남으므로 문자열 리터럴 사용 (다른 엔진 스코프와 겹치지 않는 이름)
+	constexpr const char* OuterName = "ProfilerTest Outer";
+	constexpr const char* InnerName = "ProfilerTest Inner";
+	constexpr const char* RecursiveName = "ProfilerTest Recursive";
+	constexpr const char* WorkerName = "ProfilerTest Worker";
+	constexpr const char* StressName = "ProfilerTest Stress";
+
+	// 사이클 카운터 기준으로 바쁘게 대기 (Sleep은 스케줄러 해상도 때문에 길이가 들쭉날쭉함)
+	void SpinFor(double Milliseconds)
+	{
+		const uint64 StartCycles = FPlatformTime::Cycles64();
+		while (FPlatformTime::ToMilliseconds(FPlatformTime::Cycles64() - StartCycles) < Milliseconds)
+		{
+		}
+	}
+
+	const FProfileScopeStats* FindStats(const TArray<FProfileScopeStats>& Stats, const char* Name)
+	{
+		for (const FProfileScopeStats& Entry : Stats)
+		{
+			if (Entry.Name == Name)
+			{
+				return &Entry;
+			}
+		}
+		return nullptr;
+	}
+
+	void AllocateAndFree(SIZE_T Size)
+	{
+		void* Ptr = FMemoryManager::Allocate(Size, alignof(std::max_align_t));
+		FMemoryManager::Deallocate(Ptr);
+	}
+
+	void RecurseScopes(int32 Remaining)
+	{
+		FProfileScope Scope(RecursiveName);
+		SpinFor(1.0);
+		if (Remaining > 1)
+		{
+			RecurseScopes(Remaining - 1);
+		}
+	}
+
+	void TestNestedScopeStats(FTestContext& Context)
+	{
+		FProfiler::StartCapture();
+		{
+			FProfileScope Outer(OuterName);
+			SpinFor(2.0);
+			AllocateAndFree(128);
+			for (int32 i = 0; i < 2; ++i)
+			{
+				FProfileScope Inner(InnerName);
+				SpinFor(3.0);
+				AllocateAndFree(64);
+				AllocateAndFree(64);
+			}
+		}
+		RecurseScopes(3);
+		FProfiler::StopCapture();
+
+		TArray<FProfileScopeStats> Stats;
+		FProfiler::GetScopeStats(Stats);
+		const FProfileScopeStats* Outer = FindStats(Stats, OuterName);
+		const FProfileScopeStats* Inner = FindStats(Stats, InnerName);
+		const FProfileScopeStats* Recursive = FindStats(Stats, RecursiveName);
+		if (!Context.Check(Outer && Inner && Recursive, "nested scopes: missing stats (outer %p, inner %p, recursive %p)", Outer, Inner, Recursive))
+		{
+			return;
+		}
+
+		Context.Check(Outer->CallCount == 1, "outer scope: %u calls, expected 1", Outer->CallCount);
+		Context.Check(Inner->CallCount == 2, "inner scope: %u calls, expected 2", Inner->CallCount);
+		Context.Check(Recursive->CallCount == 3, "recursive scope: %u calls, expected 3", Recursive->CallCount);
+
+		// 자식이 없는 스코프는 자기 시간 = 포함 시간, 부모의 자기 시간 = 포함 시간 - 직계 자식 포함 시간
+		Context.Check(std::abs(Inner->ExclusiveMs - Inner->InclusiveMs) < 1e-6,
+			"inner scope: exclusive %.4f ms != inclusive %.4f ms", Inner->ExclusiveMs, Inner->InclusiveMs);
+		Context.Check(std::abs(Outer->ExclusiveMs - (Outer->InclusiveMs - Inner->InclusiveMs)) < 1e-6,
+			"outer scope: exclusive %.4f ms != inclusive %.4f - children %.4f ms", Outer->ExclusiveMs, Outer->InclusiveMs, Inner->InclusiveMs);
+		Context.Check(Inner->InclusiveMs >= 6.0, "inner scope: %.4f ms inclusive, spun 2 x 3 ms", Inner->InclusiveMs);
+		Context.Check(Outer->ExclusiveMs >= 2.0 && Outer->ExclusiveMs < Outer->InclusiveMs,
+			"outer scope: exclusive %.4f ms, expected >= 2 ms and below inclusive %.4f ms", Outer->ExclusiveMs, Outer->InclusiveMs);
+
+		// 같은 이름 재귀: 자기 시간의 합은 가장 바깥 호출의 포함 시간 (1 + 2 + 3ms 포함, 각 1ms 자기 시간)
+		Context.Check(Recursive->ExclusiveMs >= 3.0 && Recursive->ExclusiveMs < Recursive->InclusiveMs,
+			"recursive scope: exclusive %.4f ms, inclusive %.4f ms", Recursive->ExclusiveMs, Recursive->InclusiveMs);
+		Context.Check(Recursive->InclusiveMs >= 6.0, "recursive scope: %.4f ms inclusive, expected >= 6 ms", Recursive->InclusiveMs);
+
+		// 자기 시간 내림차순 정렬
+		bool bSorted = true;
+		for (int32 i = 1; i < Stats.Num(); ++i)
+		{
+			bSorted &= Stats[i - 1].ExclusiveMs >= Stats[i].ExclusiveMs;
+		}
+		Context.Check(bSorted, "GetScopeStats: not sorted by exclusive time");
+
+#if PROFILER_ENABLED
+		// 할당은 가장 안쪽 스코프에 한 번만 들어감
+		Context.Check(Inner->AllocationCount == 4 && Inner->AllocatedBytes == 256,
+			"inner scope: %llu allocations / %llu bytes, expected 4 / 256",
+			static_cast<unsigned long long>(Inner->AllocationCount), static_cast<unsigned long long>(Inner->AllocatedBytes));
+		Context.Check(Outer->AllocationCount == 1 && Outer->AllocatedBytes == 128,
+			"outer scope: %llu allocations / %llu bytes, expected 1 / 128",
+			static_cast<unsigned long long>(Outer->AllocationCount), static_cast<unsigned long long>(Outer->AllocatedBytes));
+#endif
+	}
+
+	void TestRestartWhileOtherThreadRecords(FTestContext& Context)
+	{
+		// 워커가 캡처 1에서 기록 -> 게임 스레드가 캡처 2 시작 -> 워커가 다시 기록
+		// 캡처 2에는 워커의 두 번째 기록만 있어야 함
+		std::atomic<int32> Phase{ 0 };
+		std::atomic<int32> Finished{ 0 };
+		std::thread Worker([&Phase, &Finished]()
+		{
+			for (int32 Step = 1; Step <= 2; ++Step)
+			{
+				while (Phase.load() < Step)
+				{
+					std::this_thread::yield();
+				}
+				{
+					FProfileScope Scope(WorkerName);
+					SpinFor(0.1);
+				}
+				Finished.store(Step);
+			}
+		});
+
+		TArray<FProfileScopeStats> Stats;
+		FProfiler::StartCapture();
+		Phase.store(1);
+		while (Finished.load() < 1)
+		{
+			std::this_thread::yield();
+		}
+		FProfiler::GetScopeStats(Stats);
+		const FProfileScopeStats* First = FindStats(Stats, WorkerName);
+		Context.Check(First && First->CallCount == 1, "worker scope in first capture: %u calls, expected 1", First ? First->CallCount : 0u);
+
+		FProfiler::StartCapture();
+		FProfiler::GetScopeStats(Stats);
+		Context.Check(FindStats(Stats, WorkerName) == nullptr, "restarted capture still reports the worker's previous events");
+
+		Phase.store(2);
+		Worker.join();
+		FProfiler::StopCapture();
+		FProfiler::GetScopeStats(Stats);
+		const FProfileScopeStats* Second = FindStats(Stats, WorkerName);
+		Context.Check(Second && Second->CallCount == 1, "worker scope in second capture: %u calls, expected 1", Second ? Second->CallCount : 0u);
+	}
+
+	void TestRestartStress(FTestContext& Context)
+	{
+		// 워커가 쉬지 않고 기록하는 동안 캡처를 반복해서 다시 시작
+		// 매 캡처에 보이는 워커 스코프 수는 그 캡처 동안 워커가 끝낸 스코프 수(+진행 중 1건)를 넘으면 안 됨
+		std::atomic<bool> bStop{ false };
+		std::atomic<uint64> Recorded{ 0 };
+		std::thread Worker([&bStop, &Recorded]()
+		{
+			while (!bStop.load())
+			{
+				{
+					FProfileScope Scope(StressName);
+				}
+				Recorded.fetch_add(1);
+			}
+		});
+
+		auto WaitForRecords = [&Recorded](uint64 Count)
+		{
+			const uint64 Target = Recorded.load() + Count;
+			while (Recorded.load() < Target)
+			{
+				std::this_thread::yield();
+			}
+		};
+		WaitForRecords(1);
+
+		int32 Violations = 0;
+		TArray<FProfileScopeStats> Stats;
+		for (int32 Iteration = 0; Iteration < 200; ++Iteration)
+		{
+			// 캡처 시작 전에 읽어야 새 캡처에 들어간 스코프가 모두 Before 이후로 셈해짐
+			const uint64 Before = Recorded.load();
+			FProfiler::StartCapture();
+			SpinFor(0.05);
+			FProfiler::GetScopeStats(Stats);
+			const uint64 After = Recorded.load();
+
+			const FProfileScopeStats* Entry = FindStats(Stats, StressName);
+			const uint64 Seen = Entry ? Entry->CallCount : 0;
+			if (Seen > After - Before + 1)
+			{
+				++Violations;
+			}
+		}
+		Context.Check(Violations == 0, "restart stress: %d of 200 captures contained events from an earlier capture", Violations);
+
+		// 마지막 캡처: 시작 뒤에 워커가 끝낸 스코프는 반드시 보여야 함
+		FProfiler::StartCapture();
+		WaitForRecords(2);
+		FProfiler::GetScopeStats(Stats);
+		const FProfileScopeStats* Entry = FindStats(Stats, StressName);
+		Context.Check(Entry && Entry->CallCount >= 1, "restart stress: scopes finished after the last restart were not captured");
+
+		bStop.store(true);
+		Worker.join();
+		FProfiler::StopCapture();
+	}
+}
+
+void FProfilerTests::Run(FTestContext& Context)
+{
+	TestNestedScopeStats(Context);
+	TestRestartWhileOtherThreadRecords(Context);
+	TestRestartStress(Context);
+}
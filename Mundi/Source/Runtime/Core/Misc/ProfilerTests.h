@@ -0,0 +1,12 @@
+﻿#pragma once
+
+struct FTestContext;
+
+// 콘솔 명령 "TEST PROFILER"에서 사용
+namespace FProfilerTests
+{
+	// 중첩 스코프의 호출 수/포함·자기 시간/할당 집계(GetScopeStats)와
+	// 다른 스레드가 기록 중일 때 캡처를 다시 시작해도 이전 캡처 이벤트가 섞이지 않는지 확인합니다.
+	// 진행 중이던 캡처는 끊기고, 끝나면 캡처가 꺼진 상태로 남습니다.
+	void Run(FTestContext& Context);
+}
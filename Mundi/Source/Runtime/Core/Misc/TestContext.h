@@ -0,0 +1,42 @@
+﻿#pragma once
+#include <cstdarg>
+#include <cstdio>
+#include "UEContainer.h"
+
+// -----------------------------------------------------------------------------
+// 헤드리스 검사 결과 (FTestRunner에 등록되어 콘솔 명령 "TEST ..."와 명령줄 "-test=<이름|ALL>"에서 사용)
+//  - 각 기능 옆의 XxxTests.cpp가 Run(FTestContext&)로 검사를 수행하고, 실패한 조건만 메시지로 남긴다.
+//  - -test=는 에디터와 D3D 디바이스를 만들기 전에 실행되어 결과를 표준 출력에 쓰고, 실패하면 종료 코드 1을 돌려준다.
+//  - GPU, 에디터 UI 없이 실행되며, 임시 오브젝트는 각 검사가 스스로 정리한다.
+// -----------------------------------------------------------------------------
+struct FTestContext
+{
+	FString Name;
+	int32 CheckCount = 0;
+	TArray<FString> Failures;
+
+	explicit FTestContext(const char* InName) : Name(InName) {}
+
+	// 조건이 거짓이면 printf 형식 메시지를 실패로 기록하고 false를 반환
+	bool Check(bool bCondition, const char* Format, ...)
+	{
+		++CheckCount;
+		if (bCondition)
+		{
+			return true;
+		}
+
+		char Buffer[512];
+		va_list Args;
+		va_start(Args, Format);
+		vsnprintf(Buffer, sizeof(Buffer), Format, Args);
+		va_end(Args);
+		Failures.Add(Buffer);
+		return false;
+	}
+
+	bool Passed() const { return Failures.IsEmpty(); }
+};
+
+// 조건식 자체를 실패 메시지로 남기는 단축 매크로
+#define TEST_CHECK(Context, Condition) (Context).Check((Condition), "%s (%s:%d)", #Condition, __FILE__, __LINE__)
@@ -0,0 +1,62 @@
+﻿#include "pch.h"
+#include "TestRunner.h"
+#include "TestContext.h"
+#include "ParticleInstanceAllocatorTests.h"
+#include "InterpCurveTests.h"
+#include "ObjParserTests.h"
+#include "ProfilerTests.h"
+#include "AssetStreamingTests.h"
+
+const TArray<FTestSuite>& FTestRunner::GetSuites()
+{
+	static const TArray<FTestSuite> Suites =
+	{
+		{ "PARTICLE", &FParticleInstanceAllocatorTests::Run },
+		{ "CURVE", &FInterpCurveTests::Run },
+		{ "OBJ", &FObjParserTests::Run },
+		{ "PROFILER", &FProfilerTests::Run },
+		{ "STREAMING", &FAssetStreamingTests::Run },
+	};
+	return Suites;
+}
+
+FTestRunSummary FTestRunner::Run(const char* InName, const std::function<void(bool bError, const char* Line)>& OutputLine)
+{
+	const bool bRunAll = _stricmp(InName, "ALL") == 0;
+	FTestRunSummary Summary;
+	char Line[640];
+	for (const FTestSuite& Suite : GetSuites())
+	{
+		if (!bRunAll && _stricmp(InName, Suite.Name) != 0)
+		{
+			continue;
+		}
+
+		FTestContext Context(Suite.Name);
+		Suite.Run(Context);
+		++Summary.RunCount;
+
+		if (Context.Passed())
+		{
+			snprintf(Line, sizeof(Line), "TEST %s: passed (%d checks)", Suite.Name, Context.CheckCount);
+			OutputLine(false, Line);
+			continue;
+		}
+
+		++Summary.FailedCount;
+		snprintf(Line, sizeof(Line), "TEST %s: %d of %d checks failed", Suite.Name, Context.Failures.Num(), Context.CheckCount);
+		OutputLine(true, Line);
+		for (const FString& Failure : Context.Failures)
+		{
+			snprintf(Line, sizeof(Line), "  %s", Failure.c_str());
+			OutputLine(true, Line);
+		}
+	}
+
+	if (bRunAll && Summary.RunCount > 0)
+	{
+		snprintf(Line, sizeof(Line), "TEST ALL: %d passed, %d failed", Summary.RunCount - Summary.FailedCount, Summary.FailedCount);
+		OutputLine(Summary.FailedCount > 0, Line);
+	}
+	return Summary;
+}
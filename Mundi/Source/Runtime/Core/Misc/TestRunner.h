@@ -0,0 +1,30 @@
+﻿#pragma once
+#include <functional>
+#include "UEContainer.h"
+
+struct FTestContext;
+
+// 등록된 헤드리스 검사 하나 (이름은 대문자, 대소문자 무시로 찾는다)
+struct FTestSuite
+{
+	const char* Name;
+	void (*Run)(FTestContext& Context);
+};
+
+struct FTestRunSummary
+{
+	int32 RunCount = 0;		// 0이면 이름에 맞는 검사가 없음
+	int32 FailedCount = 0;
+};
+
+// 콘솔 명령 "TEST <이름|ALL>"과 명령줄 "-test=<이름|ALL>"이 같이 쓰는 검사 목록과 실행기
+namespace FTestRunner
+{
+	const TArray<FTestSuite>& GetSuites();
+
+	/**
+	 * InName(또는 "ALL")에 맞는 검사를 실행하고 결과를 한 줄씩 OutputLine으로 넘긴다.
+	 * 실패 줄은 bError가 true. 이름에 맞는 검사가 없으면 아무것도 출력하지 않는다 (RunCount == 0)
+	 */
+	FTestRunSummary Run(const char* InName, const std::function<void(bool bError, const char* Line)>& OutputLine);
+}
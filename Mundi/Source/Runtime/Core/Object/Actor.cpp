@@ -63,9 +63,22 @@ void AActor::Tick(float DeltaSeconds)
 		return;
 	}
 
-	// 에디터 모드인지 체크 (World에서 이미 Actor의 bTickInEditor 체크 후 호출됨)
+	// 컴포넌트 틱은 월드의 FTickTaskManager가 틱 그룹 순서에 맞춰 실행 (이 액터의 Tick 뒤)
+}
+
+void AActor::TickOwnedComponents(float DeltaSeconds)
+{
+	if (!World)
+	{
+		return;
+	}
+
+	// 에디터 모드인지 체크
 	const bool bIsEditorMode = !World->bPie;
 
+	// OwnedComponents는 해시 순서이므로 UUID(생성) 순으로 정렬해 매 프레임 같은 순서로 틱
+	TArray<UActorComponent*> Components;
+	Components.reserve(OwnedComponents.size());
 	for (UActorComponent* Comp : OwnedComponents)
 	{
 		if (Comp && Comp->IsComponentTickEnabled())
@@ -74,10 +87,46 @@ void AActor::Tick(float DeltaSeconds)
 			// 에디터 모드: 컴포넌트의 bTickInEditor가 true인 것만 틱
 			if (!bIsEditorMode || Comp->CanTickInEditor())
 			{
-				Comp->TickComponent(DeltaSeconds /*, … 필요 인자*/);
+				Components.Add(Comp);
 			}
 		}
 	}
+	Components.Sort([](const UActorComponent* A, const UActorComponent* B) { return A->UUID < B->UUID; });
+
+	for (UActorComponent* Comp : Components)
+	{
+		Comp->TickComponent(DeltaSeconds);
+	}
+}
+
+void AActor::SetTickGroup(ETickingGroup InTickGroup)
+{
+	if (PrimaryActorTick.TickGroup != InTickGroup)
+	{
+		PrimaryActorTick.TickGroup = InTickGroup;
+		if (World)
+		{
+			World->GetTickManager().MarkDirty();
+		}
+	}
+}
+
+void AActor::AddTickPrerequisite(UObject* Prerequisite)
+{
+	PrimaryActorTick.AddPrerequisite(Prerequisite);
+	if (World)
+	{
+		World->GetTickManager().MarkDirty();
+	}
+}
+
+void AActor::RemoveTickPrerequisite(UObject* Prerequisite)
+{
+	PrimaryActorTick.RemovePrerequisite(Prerequisite);
+	if (World)
+	{
+		World->GetTickManager().MarkDirty();
+	}
 }
 
 void AActor::EndPlay()
@@ -540,6 +589,16 @@ void AActor::PostDuplicate()
 
 }
 
+void AActor::PostRename()
+{
+	Super::PostRename();
+
+	if (UWorld* OwningWorld = GetWorld())
+	{
+		OwningWorld->NotifyObjectRenamed(this);
+	}
+}
+
 bool AActor::IsOverlappingActor(const AActor* Other) const
 {
     if (!Other)
@@ -587,6 +646,10 @@ void AActor::DuplicateSubObjects()
 	bIsCulled = false;
 	World = nullptr; // PIE World는 복제 프로세스의 상위 레벨에서 설정해 주어야 합니다.
 
+	// 선행 틱은 원본 월드의 오브젝트를 가리키므로 복제본에는 넘기지 않음
+	PrimaryActorTick.Prerequisites.clear();
+	PrimaryActorTick.AccumulatedTime = 0.0f;
+
 	if (OwnedComponents.IsEmpty())
 	{
 		return; // 복제할 컴포넌트가 없으면 종료
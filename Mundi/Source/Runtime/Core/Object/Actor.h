@@ -33,7 +33,7 @@ protected:
 public:
     // 수명
     virtual void BeginPlay();   // Override 시 Super::BeginPlay() 권장
-    virtual void Tick(float DeltaSeconds);   // Override 시 Super::Tick() 권장
+    virtual void Tick(float DeltaSeconds);   // Override 시 Super::Tick() 권장 (컴포넌트 틱은 월드의 FTickTaskManager가 따로 실행)
     virtual void EndPlay();   // Override 시 Super::EndPlay() 권장
     virtual void Destroy();
 
@@ -122,6 +122,23 @@ public:
     // 틱 플래그
     void SetTickInEditor(bool b) { bTickInEditor = b; }
     bool GetTickInEditor() const { return bTickInEditor; }
+
+    // 틱 그룹/간격/선행 관계 (생성자에서는 PrimaryActorTick을 직접 설정해도 됨)
+    void SetTickGroup(ETickingGroup InTickGroup);
+    ETickingGroup GetTickGroup() const { return PrimaryActorTick.TickGroup; }
+    void SetActorTickInterval(float InSeconds) { PrimaryActorTick.TickInterval = InSeconds; }
+    float GetActorTickInterval() const { return PrimaryActorTick.TickInterval; }
+    // Prerequisite(액터 또는 컴포넌트)의 틱이 끝난 뒤에 이 액터를 틱
+    void AddTickPrerequisite(UObject* Prerequisite);
+    void RemoveTickPrerequisite(UObject* Prerequisite);
+
+    // 이번 프레임 워커 스레드에서 Tick을 호출해도 되는지
+    virtual bool CanTickOnAnyThread() const { return PrimaryActorTick.bRunOnAnyThread; }
+    // 워커 스레드 Tick이 끝난 뒤 같은 단계 안에서 게임 스레드로 호출 (워커에서 미뤄 둔 공유 상태 변경을 처리)
+    virtual void OnParallelTickFinished() {}
+
+    // 틱 매니저를 거치지 않는 액터(에디터 기즈모/그리드 등)의 컴포넌트 틱 (UUID 순)
+    void TickOwnedComponents(float DeltaSeconds);
     
     float GetCustomTimeDillation();
     void  SetCustomTimeDillation(float Duration, float Dillation);
@@ -161,7 +178,11 @@ public:
     // ───── 복사 관련 ────────────────────────────
     void DuplicateSubObjects() override;
     void PostDuplicate() override;
-    
+
+protected:
+    void PostRename() override;	// 월드 이름 색인 갱신
+
+public:
 
     // Serialize
     void Serialize(const bool bInIsLoading, JSON& InOutHandle) override;
@@ -176,6 +197,7 @@ public:
 public:
     UWorld* World = nullptr;
     USceneComponent* RootComponent = nullptr;
+    FTickFunction PrimaryActorTick;
     UTextRenderComponent* TextComp = nullptr;
 
     UPROPERTY(EditAnywhere, Category="[액터]", Tooltip="액터의 태그를 지정합니다.")
@@ -33,6 +33,12 @@ void UActorComponent::DestroyComponent()
     }
     bPendingDestroy = true;
 
+    // 이름/UUID 색인에서 제거 (등록 전에 파괴되는 경우도 있으므로 등록 해제와 별개로 처리)
+    if (UWorld* World = GetWorld())
+    {
+        World->GetObjectIndex().RemoveComponent(this);
+    }
+
     // 스스로 등록 해제
     UnregisterComponent();
 
@@ -52,6 +58,12 @@ void UActorComponent::RegisterComponent(UWorld* InWorld)
 
     bRegistered = true;
     OnRegister(InWorld);
+
+    if (InWorld)
+    {
+        InWorld->GetTickManager().MarkDirty();
+        InWorld->GetObjectIndex().AddComponent(this);
+    }
 }
 
 // DestroyComponent에서 스스로 호출됨 (내부에서도 처리 가능하기 때문에)
@@ -64,6 +76,39 @@ void UActorComponent::UnregisterComponent()
 
     OnUnregister();
     bRegistered = false;
+
+    MarkTickListsDirty();
+}
+
+// ─────────────── Tick
+
+void UActorComponent::SetTickGroup(ETickingGroup InTickGroup)
+{
+    if (PrimaryComponentTick.TickGroup != InTickGroup)
+    {
+        PrimaryComponentTick.TickGroup = InTickGroup;
+        MarkTickListsDirty();
+    }
+}
+
+void UActorComponent::AddTickPrerequisite(UObject* Prerequisite)
+{
+    PrimaryComponentTick.AddPrerequisite(Prerequisite);
+    MarkTickListsDirty();
+}
+
+void UActorComponent::RemoveTickPrerequisite(UObject* Prerequisite)
+{
+    PrimaryComponentTick.RemovePrerequisite(Prerequisite);
+    MarkTickListsDirty();
+}
+
+void UActorComponent::MarkTickListsDirty()
+{
+    if (UWorld* World = GetWorld())
+    {
+        World->GetTickManager().MarkDirty();
+    }
 }
 
 // Override시 Super::OnRegister() 권장
@@ -113,6 +158,10 @@ void UActorComponent::DuplicateSubObjects()
     Super::DuplicateSubObjects();
 
     Owner = nullptr; // Actor에서 이거 설정해 줌
+
+    // 선행 틱은 원본 월드의 오브젝트를 가리키므로 복제본에는 넘기지 않음
+    PrimaryComponentTick.Prerequisites.clear();
+    PrimaryComponentTick.AccumulatedTime = 0.0f;
 }
 
 void UActorComponent::PostDuplicate()
@@ -122,6 +171,16 @@ void UActorComponent::PostDuplicate()
     bRegistered = false;
 }
 
+void UActorComponent::PostRename()
+{
+    Super::PostRename();
+
+    if (UWorld* World = GetWorld())
+    {
+        World->NotifyObjectRenamed(this);
+    }
+}
+
 void UActorComponent::Serialize(const bool bInIsLoading, JSON& InOutHandle)
 {
     Super::Serialize(bInIsLoading, InOutHandle);
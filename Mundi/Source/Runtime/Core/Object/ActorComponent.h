@@ -1,5 +1,6 @@
 ﻿#pragma once
 #include "Object.h"
+#include "TickTaskManager.h"
 #include "UActorComponent.generated.h"
 
 class AActor;
@@ -49,10 +50,26 @@ public:
 
     bool IsComponentTickEnabled() const
     {
-        // 틱을 진짜 돌릴지 최종 판단(액터 Tick에서 이걸로 거른다)
+        // 틱을 진짜 돌릴지 최종 판단(FTickTaskManager에서 이걸로 거른다)
         return bIsActive && bCanEverTick && bTickEnabled && bRegistered;
     }
 
+    // 틱 그룹/간격/선행 관계 (생성자에서는 PrimaryComponentTick을 직접 설정해도 됨)
+    void SetTickGroup(ETickingGroup InTickGroup);
+    ETickingGroup GetTickGroup() const { return PrimaryComponentTick.TickGroup; }
+    void SetComponentTickInterval(float InSeconds) { PrimaryComponentTick.TickInterval = InSeconds; }
+    float GetComponentTickInterval() const { return PrimaryComponentTick.TickInterval; }
+    // Prerequisite(액터 또는 컴포넌트)의 틱이 끝난 뒤에 이 컴포넌트를 틱
+    void AddTickPrerequisite(UObject* Prerequisite);
+    void RemoveTickPrerequisite(UObject* Prerequisite);
+
+    // 이번 프레임 워커 스레드에서 틱해도 되는지 (자기 상태만 바꾸는 경우만 true, 매 프레임 게임 스레드에서 확인)
+    virtual bool CanTickOnAnyThread() const { return PrimaryComponentTick.bRunOnAnyThread; }
+    // 워커 스레드 틱이 끝난 뒤 같은 단계 안에서 게임 스레드로 호출 (워커에서 미뤄 둔 공유 상태 변경을 처리)
+    virtual void OnParallelTickFinished() {}
+
+    FTickFunction PrimaryComponentTick;
+
     // ─────────────── Owner/World
     void   SetOwner(AActor* InOwner) { Owner = InOwner; }
     AActor* GetOwner() const { return Owner; }
@@ -70,11 +87,20 @@ public:
     // ───── 복사 관련 ────────────────────────────
     void DuplicateSubObjects() override;
     void PostDuplicate() override;
+
+protected:
+    void PostRename() override; // 월드 이름 색인 갱신
+
+public:
     
 
     // ───── 직렬화 ────────────────────────────
     void Serialize(const bool bInIsLoading, JSON& InOutHandle) override;
 
+protected:
+    // 월드 틱 목록 재구성 요청 (등록/해제, 틱 설정 변경 시)
+    void MarkTickListsDirty();
+
 protected:
     AActor* Owner = nullptr;     // 소유 액터
 
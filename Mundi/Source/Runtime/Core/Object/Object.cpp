@@ -1,5 +1,55 @@
 ﻿#include "pch.h"
+#include "CookedLevel.h"
 
+namespace
+{
+    // 전위 순회로 Class와 그 자식들에게 연속 번호를 매김
+    void NumberClassSubtree(UClass* Class, const TMap<const UClass*, TArray<UClass*>>& Children, TArray<UClass*>& OutTree)
+    {
+        OutTree.Add(Class);
+        Class->ClassTreeIndex = static_cast<uint32>(OutTree.Num());
+
+        if (const TArray<UClass*>* ChildClasses = Children.Find(Class))
+        {
+            for (UClass* Child : *ChildClasses)
+            {
+                NumberClassSubtree(Child, Children, OutTree);
+            }
+        }
+
+        Class->ClassTreeLastDescendant = static_cast<uint32>(OutTree.Num());
+    }
+}
+
+void UClass::RebuildClassTree()
+{
+    TArray<UClass*>& ClassTree = GetClassTree();
+    ClassTree.clear();
+    bClassTreeDirty = false;
+
+    TMap<const UClass*, TArray<UClass*>> Children;
+    TArray<UClass*> Roots;
+    for (UClass* Class : GetAllClasses())
+    {
+        Class->ClassTreeIndex = 0;
+        Class->ClassTreeLastDescendant = 0;
+        if (Class->Super)
+        {
+            Children[Class->Super].Add(Class);
+        }
+        else
+        {
+            Roots.Add(Class);
+        }
+    }
+
+    // 부모가 등록되지 않은 클래스는 번호 없이 남음 (IsChildOf가 Super 체인으로 처리)
+    ClassTree.Reserve(GetAllClasses().Num());
+    for (UClass* Root : Roots)
+    {
+        NumberClassSubtree(Root, Children, ClassTree);
+    }
+}
 
 FString UObject::GetName()
 {
@@ -11,13 +61,44 @@ FString UObject::GetComparisonName()
     return FString();
 }
 
+void UObject::SetName(const FName& InName)
+{
+    if (ObjectName == InName)
+    {
+        return;
+    }
+    ObjectName = InName;
+    PostRename();
+}
+
+void UObject::SetNamePropertyValue(const FProperty& Prop, const FName& InValue)
+{
+    FName* Value = Prop.GetValuePtr<FName>(this);
+    if (Value == &ObjectName)
+    {
+        SetName(InValue);
+    }
+    else
+    {
+        *Value = InValue;
+    }
+}
+
 // 리플렉션 기반 자동 직렬화 (현재 클래스의 프로퍼티만 처리)
 void UObject::Serialize(const bool bInIsLoading, JSON& InOutHandle)
 {
 	const TArray<FProperty>& Properties = this->GetClass()->GetAllProperties();
 
+	// 쿡 레벨 저장/로드 중이면 단순 프로퍼티는 바이너리 레코드로 처리하고 나머지만 JSON으로 처리
+	const bool bRecordSerialized = FCookedLevel::SerializeObjectRecord(this, bInIsLoading, InOutHandle);
+
 	for (const FProperty& Prop : Properties)
 	{
+		if (bRecordSerialized && FCookedLevel::IsRecordProperty(Prop.Type))
+		{
+			continue;
+		}
+
 		switch (Prop.Type)
 		{
 		case EPropertyType::Bool:
@@ -149,7 +230,7 @@ void UObject::Serialize(const bool bInIsLoading, JSON& InOutHandle)
 				FString ReadValue;
 				if (FJsonSerializer::ReadString(InOutHandle, Prop.Name, ReadValue))
 				{
-					*Value = FName(ReadValue);
+					SetNamePropertyValue(Prop, FName(ReadValue));
 				}
 			}
 			else
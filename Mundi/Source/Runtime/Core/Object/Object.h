@@ -29,6 +29,18 @@ struct UClass
     mutable TArray<FProperty> CachedAllProperties;  // GetAllProperties() 캐시 (성능 최적화)
     mutable bool bAllPropertiesCached = false;      // 캐시 유효성 플래그
 
+    // 클래스 트리 전위 순회 번호 (1부터, 0 = 아직 트리에 없음)
+    // 자식 클래스는 모두 [ClassTreeIndex, ClassTreeLastDescendant] 범위에 들어가므로 IsChildOf가 정수 비교 두 번으로 끝남
+    uint32 ClassTreeIndex = 0;
+    uint32 ClassTreeLastDescendant = 0;
+
+    // 트리 번호를 매긴 뒤 새 클래스가 등록됨 (기존 번호끼리는 여전히 일관되므로 IsChildOf는 그대로 사용 가능)
+    static inline bool bClassTreeDirty = false;
+
+    // 이 클래스(정확히 이 타입)의 살아 있는 인스턴스 목록
+    // GUObjectArray 등록/삭제 시 ObjectFactory가 갱신 (삭제는 UObject::ClassInstanceIndex로 O(1) swap-remove)
+    TArray<UObject*> Instances;
+
     constexpr UClass() = default;
     constexpr UClass(const char* n, const UClass* s, SIZE_T z)
         :Name(n), Super(s), Size(z)
@@ -37,6 +49,11 @@ struct UClass
     bool IsChildOf(const UClass* Base) const noexcept
     {
         if (!Base) return false;
+        if (ClassTreeIndex != 0 && Base->ClassTreeIndex != 0)
+        {
+            return Base->ClassTreeIndex <= ClassTreeIndex && ClassTreeIndex <= Base->ClassTreeLastDescendant;
+        }
+        // 트리 번호가 아직 없는 클래스 (static 초기화 도중): Super 체인을 따라감
         for (auto c = this; c; c = c->Super)
             if (c == Base) return true;
         return false;
@@ -53,6 +70,29 @@ struct UClass
         if (InClass)
         {
             GetAllClasses().emplace_back(InClass);
+            // 번호는 등록이 끝난 뒤 한 번에 매김 (등록마다 다시 매기면 시작 시 클래스 수의 제곱)
+            bClassTreeDirty = true;
+        }
+    }
+
+    // 전위 순회 순서의 클래스 목록 (GetClassTree()[ClassTreeIndex - 1] == 클래스)
+    // 한 클래스와 모든 자식 클래스는 이 배열에서 연속 구간을 차지함 (TObjectIterator가 사용)
+    static TArray<UClass*>& GetClassTree()
+    {
+        static TArray<UClass*> ClassTree;
+        return ClassTree;
+    }
+
+    // 등록된 모든 클래스의 트리 번호를 다시 매김 (클래스 수에 비례)
+    static void RebuildClassTree();
+
+    // 마지막 번호 매김 이후 등록된 클래스가 있으면 트리를 다시 만듦
+    // static 초기화가 끝난 뒤(WinMain 시작) 한 번 호출되고, 그 뒤에 등록된 클래스는 TObjectIterator가 처리
+    static void EnsureClassTree()
+    {
+        if (bClassTreeDirty)
+        {
+            RebuildClassTree();
         }
     }
     static UClass* FindClass(const FName& InClassName)
@@ -158,7 +198,7 @@ public:
     using ThisClass_t = UObject;
 
 public:
-    UObject() : UUID(GenerateUUID()), InternalIndex(UINT32_MAX), ObjectName("UObject") {}
+    UObject() : UUID(GenerateUUID()), InternalIndex(UINT32_MAX), ClassInstanceIndex(UINT32_MAX), ObjectName("UObject") {}
     UObject(const UObject&) = default;
 
 protected:
@@ -197,6 +237,11 @@ public:
     FString GetName();    // 원문
     FString GetComparisonName(); // lower-case
 
+    // ObjectName은 이 함수로 바꿈 (월드에 들어간 액터/컴포넌트면 이름 색인까지 갱신)
+    void SetName(const FName& InName);
+    // 리플렉션/Lua에서 FName 프로퍼티를 쓸 때 사용 (ObjectName이면 SetName을 거침)
+    void SetNamePropertyValue(const FProperty& Prop, const FName& InValue);
+
     // 리플렉션 기반 자동 직렬화 (현재 클래스의 프로퍼티만 처리)
     virtual void Serialize(const bool bInIsLoading, JSON& InOutHandle);
 public:
@@ -206,12 +251,19 @@ public:
     // 팩토리 함수에 의해 자동 발급
     uint32_t InternalIndex;
 
+    // GetClass()->Instances 안에서의 위치 (팩토리가 관리)
+    uint32_t ClassInstanceIndex;
+
     FName    ObjectName;   // 이 프로젝트에서는 고유하지 않는 라벨로 사용
 
     // 정적: 타입 메타 반환 (이름을 StaticClass로!)
     static UClass* StaticClass()
     {
         static UClass Cls{ "UObject", nullptr, sizeof(UObject) };
+        static bool bRegistered = []() {
+            UClass::SignUpClass(&Cls);   // 클래스 트리의 루트
+            return true;
+        }();
         return &Cls;
     }
 
@@ -236,6 +288,12 @@ public:
     virtual UObject* Duplicate() const; // 자기 자신 깊은 복사(+모든 멤버들 얕은 복사) -> DuplicateSubObjects 호출
     virtual void PostDuplicate() {};
 
+protected:
+    // SetName으로 ObjectName이 바뀐 뒤 호출
+    virtual void PostRename() {}
+
+public:
+
 private:
     // 전역 UUID 카운터(초기값 1)
     inline static uint32 GUUIDCounter = 1;
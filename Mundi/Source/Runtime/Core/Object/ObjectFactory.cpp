@@ -4,6 +4,71 @@
 TArray<UObject*> GUObjectArray;
 float bCrash = false;
 
+namespace
+{
+    // 슬롯별 세대. 슬롯의 오브젝트가 삭제될 때마다 증가해 이전 TWeakObjectPtr를 무효화
+    // (DeleteAll 후에도 유지해서 재사용된 슬롯이 예전 핸들과 겹치지 않게 함)
+    TArray<uint32> GUObjectGenerations;
+
+    // 비어 있는 슬롯 (DeleteObject에서 반환, NewObject에서 재사용)
+    // 슬롯 0은 피킹 ID 0(없음)과 겹치므로 재사용하지 않음
+    TArray<uint32> GUObjectFreeSlots;
+
+    // 살아 있는 오브젝트 주소 -> 슬롯
+    // 이미 삭제된(해제된) 포인터가 들어와도 필드를 읽지 않고 관리 여부를 판단하기 위함
+    TMap<const UObject*, uint32> GUObjectSlotByPointer;
+
+    // 관리 중인 오브젝트면 슬롯 인덱스, 아니면 UINT32_MAX (Obj를 역참조하지 않음)
+    uint32 FindObjectSlot(const UObject* Obj)
+    {
+        const uint32* Slot = GUObjectSlotByPointer.Find(Obj);
+        return Slot ? *Slot : UINT32_MAX;
+    }
+
+    uint32 AllocateObjectSlot(UObject* Obj)
+    {
+        uint32 Index;
+        if (!GUObjectFreeSlots.IsEmpty())
+        {
+            Index = GUObjectFreeSlots.Pop();
+            GUObjectArray[Index] = Obj;
+        }
+        else
+        {
+            Index = static_cast<uint32>(GUObjectArray.Add(Obj));
+            if (Index >= static_cast<uint32>(GUObjectGenerations.Num()))
+            {
+                GUObjectGenerations.Add(1);
+            }
+        }
+        Obj->InternalIndex = Index;
+        GUObjectSlotByPointer.Add(Obj, Index);
+
+        // 클래스별 인스턴스 목록에도 추가 (TObjectIterator가 전체 배열 대신 이 목록을 순회)
+        TArray<UObject*>& Instances = Obj->GetClass()->Instances;
+        Obj->ClassInstanceIndex = static_cast<uint32>(Instances.Num());
+        Instances.Add(Obj);
+        return Index;
+    }
+
+    // 마지막 인스턴스를 빈 자리로 옮겨 O(1) 제거
+    void RemoveClassInstance(UObject* Obj)
+    {
+        TArray<UObject*>& Instances = Obj->GetClass()->Instances;
+        const uint32 Position = Obj->ClassInstanceIndex;
+        if (Position >= static_cast<uint32>(Instances.Num()) || Instances[Position] != Obj)
+        {
+            return;
+        }
+
+        UObject* LastInstance = Instances.Last();
+        Instances[Position] = LastInstance;
+        LastInstance->ClassInstanceIndex = Position;
+        Instances.Pop();
+        Obj->ClassInstanceIndex = UINT32_MAX;
+    }
+}
+
 namespace ObjectFactory
 {
     void CauseCrash()
@@ -16,13 +81,15 @@ namespace ObjectFactory
     {
         if (!bCrash) return;
 
+        if (GUObjectArray.IsEmpty()) return;
+
         int32 DeAllocNum = rand() % GUObjectArray.Num();
 
         for (int32 i = 0; i < DeAllocNum; i++)
         {
+            // 삭제된 슬롯은 nullptr로 남으므로 배열에서 빼지 않음 (인덱스 = 핸들)
             int32 DeAllocIndex = rand() % GUObjectArray.Num();
             DeleteObject(GUObjectArray[DeAllocIndex]);
-            GUObjectArray.RemoveAt(DeAllocIndex);
         }
     }
     
@@ -50,11 +117,7 @@ namespace ObjectFactory
         UObject* Obj = ConstructObject(Class);
         if (!Obj) return nullptr;
 
-        int32 idx = -1;
-
-        idx = GUObjectArray.Add(Obj);
-
-        Obj->InternalIndex = static_cast<uint32>(idx);
+        AllocateObjectSlot(Obj);
 
         static TMap<UClass*, int> NameCounters;
         int Count = ++NameCounters[Class];
@@ -66,7 +129,7 @@ namespace ObjectFactory
         unique.push_back('_');
         unique.append(std::to_string(Count));
 
-        Obj->ObjectName = FName(unique);
+        Obj->SetName(FName(unique));
 
         return Obj;
     }
@@ -76,11 +139,7 @@ namespace ObjectFactory
         if (!Obj) return nullptr;
 
         // 배열에 등록: 빈 슬롯 재사용
-        int32 idx = -1;
-
-        idx = GUObjectArray.Add(Obj);
-        //}
-        Obj->InternalIndex = static_cast<uint32>(idx);
+        AllocateObjectSlot(Obj);
 
         static TMap<UClass*, int> NameCounters;
         int Count = ++NameCounters[Class];
@@ -103,23 +162,25 @@ namespace ObjectFactory
         if (!Obj) return;
 
         // Important: DO NOT dereference Obj fields before verifying it is still in GUObjectArray.
-        int32 foundIndex = -1;
-        for (int32 i = 0; i < GUObjectArray.Num(); ++i)
-        {
-            if (GUObjectArray[i] == Obj)
-            {
-                foundIndex = i;
-                break;
-            }
-        }
-        if (foundIndex < 0)
+        // 주소 -> 슬롯 테이블로 O(1) 확인하므로, 이미 삭제된 포인터를 다시 넘겨도 해제된 메모리를 읽지 않음
+        // (단, 해제된 주소를 새 오브젝트가 재사용했다면 그 포인터는 새 오브젝트를 가리킨다.
+        //  수명을 알 수 없는 포인터는 TWeakObjectPtr로 들고 있다가 Get()으로 확인한 뒤 삭제해야 함)
+        const uint32 Index = FindObjectSlot(Obj);
+        if (Index == UINT32_MAX)
         {
             // Not managed or already deleted.
             return;
         }
 
-        GUObjectArray[foundIndex] = nullptr;
-        // Safe to delete now; Obj still valid since we found it in GUObjectArray
+        GUObjectSlotByPointer.Remove(Obj);
+        GUObjectArray[Index] = nullptr;
+        ++GUObjectGenerations[Index];
+        RemoveClassInstance(Obj);
+        if (Index != 0)
+        {
+            GUObjectFreeSlots.Add(Index);
+        }
+
         Obj->DestroyInternal();
     }
 
@@ -135,26 +196,61 @@ namespace ObjectFactory
         }
         GUObjectArray.Empty();
         GUObjectArray.Shrink();
+        GUObjectFreeSlots.Empty();
+        GUObjectSlotByPointer.Empty();
     }
 
-    // (선택) null 슬롯 압축
+    void ReserveObjects(int32 AdditionalCount)
+    {
+        if (AdditionalCount > GUObjectFreeSlots.Num())
+        {
+            GUObjectArray.Reserve(GUObjectArray.Num() + AdditionalCount - GUObjectFreeSlots.Num());
+            GUObjectGenerations.Reserve(GUObjectArray.capacity());
+        }
+        GUObjectSlotByPointer.Reserve(GUObjectSlotByPointer.Num() + AdditionalCount);
+    }
+
+    bool GetObjectHandle(const UObject* Object, uint32& OutIndex, uint32& OutGeneration)
+    {
+        // 삭제된 포인터로 약한 참조를 만들 수 있으므로 DeleteObject와 같이 역참조 없이 확인
+        const uint32 Index = FindObjectSlot(Object);
+        if (Index == UINT32_MAX)
+        {
+            return false;
+        }
+        OutIndex = Index;
+        OutGeneration = GUObjectGenerations[Index];
+        return true;
+    }
+
+    UObject* ResolveObjectHandle(uint32 Index, uint32 Generation)
+    {
+        if (Index >= static_cast<uint32>(GUObjectArray.Num()) || GUObjectGenerations[Index] != Generation)
+        {
+            return nullptr;
+        }
+        return GUObjectArray[Index];
+    }
+
+    // 끝쪽 빈 슬롯만 잘라냄
+    // 살아 있는 오브젝트는 옮기지 않음 (인덱스가 TWeakObjectPtr 핸들과 피킹 ID로 쓰이므로)
     void CompactNullSlots()
     {
-        int32 write = 0;
-        for (int32 read = 0; read < GUObjectArray.Num(); ++read)
+        int32 NewNum = GUObjectArray.Num();
+        while (NewNum > 0 && GUObjectArray[NewNum - 1] == nullptr)
         {
-            if (UObject* Obj = GUObjectArray[read])
-            {
-                if (write != read)
-                {
-                    GUObjectArray[write] = Obj;
-                    Obj->InternalIndex = static_cast<uint32>(write);
-                    GUObjectArray[read] = nullptr;
-                }
-                ++write;
-            }
+            --NewNum;
         }
-        // 크기(Num) 축소 + 불필요한 capacity도 반환
-        GUObjectArray.SetNum(write);
+        if (NewNum == GUObjectArray.Num())
+        {
+            return;
+        }
+
+        GUObjectArray.SetNum(NewNum);
+        GUObjectFreeSlots.erase(
+            std::remove_if(GUObjectFreeSlots.begin(), GUObjectFreeSlots.end(),
+                [NewNum](uint32 Slot) { return Slot >= static_cast<uint32>(NewNum); }),
+            GUObjectFreeSlots.end());
+        GUObjectArray.Shrink();
     }
 }
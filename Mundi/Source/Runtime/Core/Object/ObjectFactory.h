@@ -5,6 +5,7 @@
 // ── 외부 심볼 ─────────────────────────────────────────────
 class UObject;
 struct UClass;
+// 슬롯 배열: 인덱스 = UObject::InternalIndex, 삭제된 슬롯은 nullptr (다음 생성 시 재사용)
 extern TArray<UObject*> GUObjectArray;
 extern float bCrash;
 
@@ -47,11 +48,16 @@ namespace ObjectFactory
         return static_cast<T*>(AddToGUObjectArray(T::StaticClass(), Dest));
     }
 
+    // 곧 생성할 오브젝트 수만큼 GUObjectArray 용량을 미리 확보 (PIE 월드 생성 등 대량 생성 전)
+    void ReserveObjects(int32 AdditionalCount);
+
     // 개별 삭제(단일 소유자: Factory)
+    // 주소 -> 슬롯 테이블로 O(1)로 찾아 삭제하고 (Obj는 관리 중임을 확인한 뒤에만 역참조),
+    // 슬롯은 세대를 올린 뒤 다음 생성에 재사용
     void DeleteObject(UObject* Obj);
     // 종료시 일괄 정리
     void DeleteAll(bool bCallBeginDestroy = true);
-    // Null 슬롯 압축하여 배열 크기 축소
+    // 배열 끝의 빈 슬롯을 잘라 크기 축소 (살아 있는 오브젝트의 인덱스는 바뀌지 않음)
     void CompactNullSlots();
 }
 
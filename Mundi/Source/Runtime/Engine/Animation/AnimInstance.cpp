@@ -5,6 +5,7 @@
 #include "AnimNode.h"
 #include "AnimNotify/AnimNotify.h"
 #include "AnimNotify/AnimNotifyState.h"
+#include "TickTaskManager.h"
 
 IMPLEMENT_CLASS(UAnimInstance)
 UAnimInstance::~UAnimInstance()
@@ -132,7 +133,62 @@ void UAnimInstance::ClearPreviousAnimNotifyState()
         FAnimNode_Sequence* AnimNode_Sequence = dynamic_cast<FAnimNode_Sequence*>(AnimNode);
         if (!AnimNode_Sequence) continue;
 
-        AnimNode_Sequence->EndPlay();
+        // FAnimNode_Sequence::EndPlay와 같지만 NotifyEnd는 병렬 틱이면 큐를 거침
+        AnimNode_Sequence->CurrentTime = 0.f;
+        AnimNode_Sequence->LastTime = 0.f;
+        if (!AnimNode_Sequence->Sequence) continue;
+
+        for (UAnimNotifyState* AnimNotifyState : AnimNode_Sequence->Sequence->GetAnimNotifyStates())
+        {
+            if (AnimNotifyState && !AnimNotifyState->GetEndAlreadyCalled())
+                TriggerNotifyState(AnimNotifyState, ENotifyEvent::StateEnd);
+        }
+    }
+}
+
+void UAnimInstance::TriggerNotify(UAnimNotify* Notify)
+{
+    FQueuedNotify Queued;
+    Queued.Notify = Notify;
+    Queued.Event = ENotifyEvent::Notify;
+
+    if (FTickTaskManager::IsInParallelTick())
+        QueuedNotifies.Add(Queued);
+    else
+        ExecuteNotify(Queued);
+}
+
+void UAnimInstance::TriggerNotifyState(UAnimNotifyState* NotifyState, ENotifyEvent Event)
+{
+    FQueuedNotify Queued;
+    Queued.NotifyState = NotifyState;
+    Queued.Event = Event;
+
+    if (FTickTaskManager::IsInParallelTick())
+        QueuedNotifies.Add(Queued);
+    else
+        ExecuteNotify(Queued);
+}
+
+void UAnimInstance::ExecuteNotify(const FQueuedNotify& Queued)
+{
+    switch (Queued.Event)
+    {
+    case ENotifyEvent::Notify:     Queued.Notify->Notify(); break;
+    case ENotifyEvent::StateBegin: Queued.NotifyState->NotifyBegin(); break;
+    case ENotifyEvent::StateTick:  Queued.NotifyState->NotifyTick(); break;
+    case ENotifyEvent::StateEnd:   Queued.NotifyState->NotifyEnd(); break;
+    }
+}
+
+void UAnimInstance::FlushQueuedNotifies()
+{
+    // 노티파이가 다시 애니메이션을 건드려도 안전하도록 꺼낸 뒤 실행
+    TArray<FQueuedNotify> Pending = std::move(QueuedNotifies);
+    QueuedNotifies.clear();
+    for (const FQueuedNotify& Queued : Pending)
+    {
+        ExecuteNotify(Queued);
     }
 }
 
@@ -209,7 +265,7 @@ void UAnimInstance::PostUpdateAnimation()
             // Notify 실행 (조건이 맞으면 실행)
             if (bShouldTrigger)
             {
-                 Notify->Notify();
+                 TriggerNotify(Notify);
             }
         }
 
@@ -314,30 +370,30 @@ void UAnimInstance::PostUpdateAnimation()
             {
                 if (bEndTrigger)
                 {
-                    NotifyState->NotifyEnd();
+                    TriggerNotifyState(NotifyState, ENotifyEvent::StateEnd);
                 }
                 if (bTickTrigger)
                 {
-                    NotifyState->NotifyTick();
+                    TriggerNotifyState(NotifyState, ENotifyEvent::StateTick);
                 }
                 if (bBeginTrigger)
                 {
-                    NotifyState->NotifyBegin();
+                    TriggerNotifyState(NotifyState, ENotifyEvent::StateBegin);
                 }
             }
             else
             {
                 if (bBeginTrigger)
                 {
-                    NotifyState->NotifyBegin();
+                    TriggerNotifyState(NotifyState, ENotifyEvent::StateBegin);
                 }
                 if (bTickTrigger)
                 {
-                    NotifyState->NotifyTick();
+                    TriggerNotifyState(NotifyState, ENotifyEvent::StateTick);
                 }
                 if (bEndTrigger)
                 {
-                    NotifyState->NotifyEnd();
+                    TriggerNotifyState(NotifyState, ENotifyEvent::StateEnd);
                 }
             }
         }
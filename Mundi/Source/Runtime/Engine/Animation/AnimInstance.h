@@ -3,6 +3,7 @@
 class USkeletalMeshComponent;
 class UAnimationSequence;
 class UAnimNotify;
+class UAnimNotifyState;
 struct FAnimState;
 
 class UAnimInstance : public UObject
@@ -35,6 +36,12 @@ public:
      */
     void UpdateAnimation(float DeltaTime);
 
+    /**
+     * @brief 워커 스레드 틱에서 미뤄 둔 AnimNotify/AnimNotifyState 호출을 순서대로 실행합니다
+     * 노티파이는 카메라/사운드/액터 트랜스폼 등 공유 상태를 바꾸므로 게임 스레드에서만 호출해야 합니다
+     */
+    void FlushQueuedNotifies();
+
 protected:
     /* Unreal Style */
 
@@ -84,8 +91,29 @@ protected:
     // 현재 포즈를 저장할 변수
     // FPoseContext CurrentPose;
 private:
+    enum class ENotifyEvent : uint8
+    {
+        Notify,
+        StateBegin,
+        StateTick,
+        StateEnd
+    };
+
+    // 워커 스레드 틱 중 발생한 노티파이 (FlushQueuedNotifies에서 게임 스레드로 재생)
+    struct FQueuedNotify
+    {
+        UAnimNotify* Notify = nullptr;
+        UAnimNotifyState* NotifyState = nullptr;
+        ENotifyEvent Event = ENotifyEvent::Notify;
+    };
+
     void ClearPreviousAnimNotifyState();
+    // 병렬 틱 중이면 큐에 쌓고, 게임 스레드면 바로 실행
+    void TriggerNotify(UAnimNotify* Notify);
+    void TriggerNotifyState(UAnimNotifyState* NotifyState, ENotifyEvent Event);
+    static void ExecuteNotify(const FQueuedNotify& Queued);
 private:
+    TArray<FQueuedNotify> QueuedNotifies;
     bool bIsInitialized = false;
     FAnimState* CurrentAnimState{};
     FAnimState* PreviousAnimState{};
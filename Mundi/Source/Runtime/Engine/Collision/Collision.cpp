@@ -214,6 +214,40 @@ namespace Collision
         Out.HalfExtent[2] = HalfHeightWorld;
     }
      
+    FAABB ComputeShapeAABB(const FShape& Shape, const FTransform& Transform)
+    {
+        const FVector Center = Transform.Translation;
+        const FVector S = AbsVec(Transform.Scale3D);
+        FVector HalfExtent = FVector::Zero();
+
+        if (Shape.Kind == EShapeKind::Sphere)
+        {
+            const float WorldRadius = Shape.Sphere.SphereRadius * UniformScaleMax(S);
+            HalfExtent = FVector(WorldRadius, WorldRadius, WorldRadius);
+        }
+        else if (Shape.Kind == EShapeKind::Box)
+        {
+            // 회전된 박스의 세 축을 월드 축에 투영한 길이의 합
+            const FVector Local(Shape.Box.BoxExtent.X * S.X, Shape.Box.BoxExtent.Y * S.Y, Shape.Box.BoxExtent.Z * S.Z);
+            const FMatrix R = Transform.Rotation.ToMatrix();
+            HalfExtent = FVector(
+                std::fabs(R.M[0][0]) * Local.X + std::fabs(R.M[1][0]) * Local.Y + std::fabs(R.M[2][0]) * Local.Z,
+                std::fabs(R.M[0][1]) * Local.X + std::fabs(R.M[1][1]) * Local.Y + std::fabs(R.M[2][1]) * Local.Z,
+                std::fabs(R.M[0][2]) * Local.X + std::fabs(R.M[1][2]) * Local.Y + std::fabs(R.M[2][2]) * Local.Z);
+        }
+        else if (Shape.Kind == EShapeKind::Capsule)
+        {
+            const float WorldRadius = Shape.Capsule.CapsuleRadius * FMath::Max(S.X, S.Y);
+            const float WorldHalfHeight = Shape.Capsule.CapsuleHalfHeight * S.Z;
+
+            // 캡슐 축 방향으로 HalfHeight, 나머지는 반지름만큼
+            const FVector Up = AbsVec(Transform.Rotation.RotateVector(FVector(0, 0, 1)));
+            HalfExtent = Up * WorldHalfHeight + FVector(WorldRadius, WorldRadius, WorldRadius);
+        }
+
+        return FAABB(Center - HalfExtent, Center + HalfExtent);
+    }
+
     // 캡슐 VS Sphere
     bool OverlapCapsuleAndSphere(const FShape& Capsule, const FTransform& TransformCapsule,
         const FShape& Sphere, const FTransform& TransformSphere)
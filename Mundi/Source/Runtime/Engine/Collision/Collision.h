@@ -27,6 +27,9 @@ namespace Collision
     void BuildCapsule(const FShape& CapsuleShape, const FTransform& Xform, FVector& OutP0, FVector& OutP1, float& OutRadius);
     void BuildCapsuleCoreOBB(const FShape& CapsuleShape, const FTransform& Transform, FOBB& Out);
 
+    // 셰이프의 월드 AABB (회전/스케일 반영, 브로드 페이즈용)
+    FAABB ComputeShapeAABB(const FShape& Shape, const FTransform& Transform);
+
     bool OverlapCapsuleAndSphere(const FShape& Capsule, const FTransform& TransformCapsule, const FShape& Sphere, const FTransform& TransformSphere);
 
     bool OverlapCapsuleAndBox(const FShape& Capsule, const FTransform& TransformCapsule, const FShape& Box, const FTransform& TransformBox);
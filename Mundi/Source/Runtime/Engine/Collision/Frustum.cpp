@@ -3,6 +3,7 @@
 #include "Vector.h"
 #include "Frustum.h"
 #include "CameraComponent.h"
+#include "MathBatch.h"
 #include <immintrin.h> // For SSE, AVX, FMA instructions
 
 
@@ -221,6 +222,52 @@ bool IsAABBIntersects(const FFrustum& F, const FAABB& B)
 }
 
 
+// ------------------------------------------------------------
+// VP(=View*Proj) 행렬에서 절두체 추출
+//  - row-vector 규약(p' = p * M)이므로 클립 좌표의 각 성분은 VP의 "열"과의 내적이다.
+//    C_j = (M[0][j], M[1][j], M[2][j], M[3][j])
+//  - D3D 클립 공간(0 <= z <= w) 기준
+//    Left: C3 + C0, Right: C3 - C0, Bottom: C3 + C1, Top: C3 - C1, Near: C2, Far: C3 - C2
+//  - 결합 결과 (a,b,c,d)는 a*x + b*y + c*z + d >= 0 이 내부이므로 N=(a,b,c)/len, D=-d/len
+//  - 섀도우 뷰처럼 카메라 컴포넌트가 없는 뷰의 컬링에 사용
+// ------------------------------------------------------------
+namespace
+{
+    FPlane MakePlaneFromClipCoefficients(float A, float B, float C, float D)
+    {
+        const FVector4 N(A, B, C, 0.0f);
+        const float Len = Length3(N);
+
+        FPlane Out;
+        if (Len > 0.0f)
+        {
+            Out.Normal = FVector4(A / Len, B / Len, C / Len, 0.0f);
+            Out.Distance = -D / Len;
+        }
+        return Out;
+    }
+}
+
+FFrustum CreateFrustumFromViewProjection(const FMatrix& ViewProj)
+{
+    const FMatrix& M = ViewProj;
+
+    FFrustum Result;
+    Result.LeftFace = MakePlaneFromClipCoefficients(
+        M.M[0][3] + M.M[0][0], M.M[1][3] + M.M[1][0], M.M[2][3] + M.M[2][0], M.M[3][3] + M.M[3][0]);
+    Result.RightFace = MakePlaneFromClipCoefficients(
+        M.M[0][3] - M.M[0][0], M.M[1][3] - M.M[1][0], M.M[2][3] - M.M[2][0], M.M[3][3] - M.M[3][0]);
+    Result.BottomFace = MakePlaneFromClipCoefficients(
+        M.M[0][3] + M.M[0][1], M.M[1][3] + M.M[1][1], M.M[2][3] + M.M[2][1], M.M[3][3] + M.M[3][1]);
+    Result.TopFace = MakePlaneFromClipCoefficients(
+        M.M[0][3] - M.M[0][1], M.M[1][3] - M.M[1][1], M.M[2][3] - M.M[2][1], M.M[3][3] - M.M[3][1]);
+    Result.NearFace = MakePlaneFromClipCoefficients(
+        M.M[0][2], M.M[1][2], M.M[2][2], M.M[3][2]);
+    Result.FarFace = MakePlaneFromClipCoefficients(
+        M.M[0][3] - M.M[0][2], M.M[1][3] - M.M[1][2], M.M[2][3] - M.M[2][2], M.M[3][3] - M.M[3][2]);
+    return Result;
+}
+
 // 추후에 절두체를 VP 행렬에서 바로 추출하는 방법도 필요하다면 아래를 참고.
 // ---------- VP(=View*Proj)에서 평면 추출 ----------
 // row-vector 규약(p' = p * M)에서 클립 경계는
@@ -324,6 +371,18 @@ bool IsAABBVisible(const Frustum& F, const FBound& B)
 
 */
 
+int32 AreAABBsVisible(const FFrustum& Frustum, const FAABB* Bounds, int32 Count, uint8* OutVisible)
+{
+    // IsAABBVisible과 같은 순서로 평면을 (Normal, Distance) 형태로 묶음
+    const FPlane* Faces[6] = { &Frustum.LeftFace, &Frustum.RightFace, &Frustum.TopFace, &Frustum.BottomFace, &Frustum.NearFace, &Frustum.FarFace };
+    FVector4 Planes[6];
+    for (int32 i = 0; i < 6; ++i)
+    {
+        Planes[i] = FVector4(Faces[i]->Normal.X, Faces[i]->Normal.Y, Faces[i]->Normal.Z, Faces[i]->Distance);
+    }
+    return FMathBatch::TestAABBsAgainstPlanes(Planes, 6, Bounds, Count, OutVisible);
+}
+
 // AVX-optimized culling for 8 AABBs
 uint8_t AreAABBsVisible_8_AVX(const FFrustum& Frustum, const FAABB Bounds[8])
 {
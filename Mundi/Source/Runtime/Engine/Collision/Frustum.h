@@ -26,6 +26,8 @@ struct FFrustum
 };
 
 FFrustum CreateFrustumFromCamera(const UCameraComponent& Camera, float OverrideAspect = -1.0f);
+// row-vector 규약의 View*Proj 행렬에서 절두체 추출 (D3D 클립 공간)
+FFrustum CreateFrustumFromViewProjection(const FMatrix& ViewProj);
 bool IsAABBVisible(const FFrustum& Frustum, const FAABB& Bound);
 bool IsAABBIntersects(const FFrustum& Frustum, const FAABB& Bound);
 
@@ -34,4 +36,8 @@ bool IsAABBIntersects(const FFrustum& Frustum, const FAABB& Bound);
 // Returns an 8-bit mask: bit i is set if box i is visible.
 uint8_t AreAABBsVisible_8_AVX(const FFrustum& Frustum, const FAABB Bounds[8]);
 
+// Count개의 AABB를 한 번에 검사 (FMathBatch::TestAABBsAgainstPlanes, CPU에 맞는 SIMD 경로 선택)
+// OutVisible[i] = 1이면 IsAABBVisible과 같은 기준으로 보임. 보이는 박스 개수를 반환.
+int32 AreAABBsVisible(const FFrustum& Frustum, const FAABB* Bounds, int32 Count, uint8* OutVisible);
+
 bool Intersects(const FPlane& P, const FVector4& Center, const FVector4& Extents);
\ No newline at end of file
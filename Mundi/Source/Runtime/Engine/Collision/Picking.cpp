@@ -225,6 +225,36 @@ bool IntersectRayTriangleMT(const FRay& InRay, const FVector& InA, const FVector
 	return false;
 }
 
+namespace
+{
+	// 카메라가 속한 월드의 파티션(BVH 씬 쿼리)으로 가장 가까운 액터를 찾습니다.
+	// 파티션이 없는 월드(프리뷰 등)에서는 넘겨받은 액터 목록을 직접 검사합니다.
+	AActor* PickClosestActor(const TArray<AActor*>& Actors, ACameraActor* Camera, const FRay& Ray, float& InOutT)
+	{
+		UWorld* World = Camera->GetWorld();
+		if (UWorldPartitionManager* Partition = World ? World->GetPartitionManager() : nullptr)
+		{
+			AActor* PickedActor = nullptr;
+			Partition->RayQueryClosest(Ray, PickedActor, InOutT);
+			return PickedActor;
+		}
+
+		AActor* PickedActor = nullptr;
+		for (AActor* Actor : Actors)
+		{
+			if (!Actor || Actor->GetActorHiddenInEditor()) continue;
+
+			float HitDistance;
+			if (CPickingSystem::CheckActorPicking(Actor, Ray, HitDistance) && HitDistance < InOutT)
+			{
+				InOutT = HitDistance;
+				PickedActor = Actor;
+			}
+		}
+		return PickedActor;
+	}
+}
+
 // PickingSystem 구현
 AActor* CPickingSystem::PerformPicking(const TArray<AActor*>& Actors, ACameraActor* Camera)
 {
@@ -239,35 +269,15 @@ AActor* CPickingSystem::PerformPicking(const TArray<AActor*>& Actors, ACameraAct
 	const FVector CameraForward = Camera->GetForward();
 	FRay ray = MakeRayFromMouseWithCamera(View, Proj, CameraWorldPos, CameraRight, CameraUp, CameraForward);
 
-	int pickedIndex = -1;
 	float pickedT = 1e9f;
+	AActor* PickedActor = PickClosestActor(Actors, Camera, ray, pickedT);
 
-	// 모든 액터에 대해 피킹 테스트
-	for (int i = 0; i < Actors.Num(); ++i)
-	{
-		AActor* Actor = Actors[i];
-		if (!Actor) continue;
-
-		// Skip hidden actors for picking
-		if (Actor->GetActorHiddenInEditor()) continue;
-
-		float hitDistance;
-		if (CheckActorPicking(Actor, ray, hitDistance))
-		{
-			if (hitDistance < pickedT)
-			{
-				pickedT = hitDistance;
-				pickedIndex = i;
-			}
-		}
-	}
-
-	if (pickedIndex >= 0)
+	if (PickedActor)
 	{
 		char buf[160];
-		sprintf_s(buf, "[Pick] Hit primitive %d at t=%.3f (Speed=NORMAL)\n", pickedIndex, pickedT);
-		UE_LOG(buf);
-		return Actors[pickedIndex];
+		sprintf_s(buf, "[Pick] Hit primitive %s at t=%.3f (Speed=NORMAL)\n", PickedActor->GetName().c_str(), pickedT);
+		UE_LOG("%s", buf);
+		return PickedActor;
 	}
 	else
 	{
@@ -296,35 +306,15 @@ AActor* CPickingSystem::PerformViewportPicking(const TArray<AActor*>& Actors,
 	FRay ray = MakeRayFromViewport(View, Proj, CameraWorldPos, CameraRight, CameraUp, CameraForward,
 		ViewportMousePos, ViewportSize, ViewportOffset);
 
-	int pickedIndex = -1;
 	float pickedT = 1e9f;
+	AActor* PickedActor = PickClosestActor(Actors, Camera, ray, pickedT);
 
-	// 모든 액터에 대해 피킹 테스트
-	for (int i = 0; i < Actors.Num(); ++i)
-	{
-		AActor* Actor = Actors[i];
-		if (!Actor) continue;
-
-		// Skip hidden actors for picking
-		if (Actor->GetActorHiddenInEditor()) continue;
-
-		float hitDistance;
-		if (CheckActorPicking(Actor, ray, hitDistance))
-		{
-			if (hitDistance < pickedT)
-			{
-				pickedT = hitDistance;
-				pickedIndex = i;
-			}
-		}
-	}
-
-	if (pickedIndex >= 0)
+	if (PickedActor)
 	{
 		char buf[160];
-		sprintf_s(buf, "[Viewport Pick] Hit primitive %d at t=%.3f\n", pickedIndex, pickedT);
-		UE_LOG(buf);
-		return Actors[pickedIndex];
+		sprintf_s(buf, "[Viewport Pick] Hit primitive %s at t=%.3f\n", PickedActor->GetName().c_str(), pickedT);
+		UE_LOG("%s", buf);
+		return PickedActor;
 	}
 	else
 	{
@@ -383,14 +373,14 @@ AActor* CPickingSystem::PerformViewportPicking(const TArray<AActor*>& Actors,
 		char buf[160];
 		sprintf_s(buf, "[Pick] Hit primitive %d at t=%.3f | time=%.6lf ms\n",
 			PickedIndex, PickedT, Milliseconds);
-		UE_LOG(buf);
+		UE_LOG("%s", buf);
 		return PickedActor;
 	}
 	else
 	{
 		char buf[160];
 		sprintf_s(buf, "[Pick] No hit | time=%.6f ms\n", Milliseconds);
-		UE_LOG(buf);
+		UE_LOG("%s", buf);
 		return nullptr;
 	}
 }
@@ -677,7 +667,7 @@ bool CPickingSystem::CheckActorPicking(const AActor* Actor, const FRay& Ray, flo
 			if (BVH)
 			{
 				float THitLocal;
-				if (BVH->IntersectRay(LocalRay, StaticMesh->Vertices, StaticMesh->Indices, THitLocal))
+				if (BVH->IntersectRay(LocalRay, THitLocal))
 				{
 					const FVector HitLocal = FVector(
 						LocalOrigin4.X + LocalDir4.X * THitLocal,
@@ -0,0 +1,566 @@
+﻿#include "pch.h"
+#include "SceneQuery.h"
+#include "Actor.h"
+#include "Collision.h"
+#include "OBB.h"
+#include "MeshBVH.h"
+#include "StaticMesh.h"
+#include "StaticMeshComponent.h"
+#include "ResourceManager.h"
+
+namespace
+{
+    // GetShape를 구현하지 않은 기본 UShapeComponent는 크기 0인 구로 취급
+    FShape GetComponentShape(const UShapeComponent* ShapeComponent)
+    {
+        FShape Shape;
+        Shape.Kind = EShapeKind::Sphere;
+        Shape.Sphere.SphereRadius = 0.0f;
+        ShapeComponent->GetShape(Shape);
+        return Shape;
+    }
+
+    // 스윕/오버랩용 충돌 형상
+    // 스태틱 메시는 BVH에 캐시된 월드 AABB를 박스로 사용 (삼각형 단위 스윕은 지원하지 않음)
+    bool GetCollisionShape(const UPrimitiveComponent* Component, const FAABB& Bounds, FShape& OutShape, FTransform& OutTransform)
+    {
+        if (const UShapeComponent* ShapeComponent = Cast<UShapeComponent>(Component))
+        {
+            OutShape = GetComponentShape(ShapeComponent);
+            OutTransform = ShapeComponent->GetWorldTransform();
+            return true;
+        }
+
+        if (Cast<UStaticMeshComponent>(Component))
+        {
+            OutShape.Kind = EShapeKind::Box;
+            OutShape.Box.BoxExtent = Bounds.GetHalfExtent();
+            OutTransform = FTransform(Bounds.GetCenter(), FQuat::Identity(), FVector::One());
+            return true;
+        }
+
+        return false;
+    }
+
+    // ───── 레이 vs 기본 도형 ─────────────────────
+    // 모두 Direction이 정규화되어 있다고 가정하고, 시작점이 도형 안쪽이면 T = 0, 법선 = -Direction
+
+    bool RaySphere(const FVector& Origin, const FVector& Direction, const FVector& Center, float Radius,
+        float& OutT, FVector& OutNormal)
+    {
+        const FVector M = Origin - Center;
+        const float C = M.SizeSquared() - Radius * Radius;
+        if (C <= 0.0f)
+        {
+            OutT = 0.0f;
+            OutNormal = -Direction;
+            return true;
+        }
+
+        const float B = FVector::Dot(M, Direction);
+        if (B > 0.0f)
+        {
+            return false;   // 바깥에서 멀어지는 방향
+        }
+
+        const float Discriminant = B * B - C;
+        if (Discriminant < 0.0f)
+        {
+            return false;
+        }
+
+        OutT = -B - std::sqrt(Discriminant);
+        OutNormal = (Origin + Direction * OutT - Center).GetSafeNormal();
+        return true;
+    }
+
+    // OBB 로컬 축 기준 슬랩 검사
+    bool RayOBB(const FVector& Origin, const FVector& Direction, const FOBB& Box, float& OutT, FVector& OutNormal)
+    {
+        const FVector ToOrigin = Origin - Box.Center;
+        float TMin = 0.0f;
+        float TMax = FLT_MAX;
+        int32 HitAxis = -1;
+        float HitSign = 0.0f;
+
+        for (int32 Axis = 0; Axis < 3; ++Axis)
+        {
+            const float LocalOrigin = FVector::Dot(ToOrigin, Box.Axes[Axis]);
+            const float LocalDirection = FVector::Dot(Direction, Box.Axes[Axis]);
+            const float HalfExtent = Box.HalfExtent[Axis];
+
+            if (std::abs(LocalDirection) < 1e-6f)
+            {
+                if (LocalOrigin < -HalfExtent || LocalOrigin > HalfExtent)
+                {
+                    return false;
+                }
+                continue;
+            }
+
+            // 양의 방향으로 진행하면 -HalfExtent 면으로 들어감
+            float TNear = (-HalfExtent - LocalOrigin) / LocalDirection;
+            float TFar = (HalfExtent - LocalOrigin) / LocalDirection;
+            float Sign = -1.0f;
+            if (TNear > TFar)
+            {
+                std::swap(TNear, TFar);
+                Sign = 1.0f;
+            }
+
+            if (TNear > TMin)
+            {
+                TMin = TNear;
+                HitAxis = Axis;
+                HitSign = Sign;
+            }
+            TMax = FMath::Min(TMax, TFar);
+            if (TMin > TMax)
+            {
+                return false;
+            }
+        }
+
+        OutT = TMin;
+        OutNormal = (HitAxis >= 0) ? Box.Axes[HitAxis] * HitSign : -Direction;
+        return true;
+    }
+
+    float DistanceSquaredToSegment(const FVector& Point, const FVector& P0, const FVector& P1)
+    {
+        const FVector Segment = P1 - P0;
+        const float Length2 = Segment.SizeSquared();
+        const float S = (Length2 > 1e-8f) ? FMath::Clamp(FVector::Dot(Point - P0, Segment) / Length2, 0.0f, 1.0f) : 0.0f;
+        return (Point - (P0 + Segment * S)).SizeSquared();
+    }
+
+    // 캡슐 = 선분 P0-P1 주위 반지름 Radius (옆면 원통 + 양 끝 반구)
+    // Real-Time Collision Detection 5.3.7 (Intersecting segment against cylinder)
+    bool RayCapsule(const FVector& Origin, const FVector& Direction, const FVector& P0, const FVector& P1, float Radius,
+        float& OutT, FVector& OutNormal)
+    {
+        if (DistanceSquaredToSegment(Origin, P0, P1) <= Radius * Radius)
+        {
+            OutT = 0.0f;
+            OutNormal = -Direction;
+            return true;
+        }
+
+        float BestT = FLT_MAX;
+        const FVector Axis = P1 - P0;
+        const float AxisLength2 = Axis.SizeSquared();
+
+        if (AxisLength2 > 1e-8f)
+        {
+            const FVector M = Origin - P0;
+            const float MdA = FVector::Dot(M, Axis);
+            const float DdA = FVector::Dot(Direction, Axis);
+            const float A = AxisLength2 - DdA * DdA;
+            const float B = AxisLength2 * FVector::Dot(M, Direction) - MdA * DdA;
+            const float C = AxisLength2 * (M.SizeSquared() - Radius * Radius) - MdA * MdA;
+
+            // A가 0이면 레이가 축과 평행 -> 반구 검사로 처리
+            if (A > 1e-8f)
+            {
+                const float Discriminant = B * B - A * C;
+                if (Discriminant >= 0.0f)
+                {
+                    const float T = (-B - std::sqrt(Discriminant)) / A;
+                    const float S = MdA + T * DdA;
+                    if (T >= 0.0f && S >= 0.0f && S <= AxisLength2)
+                    {
+                        BestT = T;
+                        const FVector OnAxis = P0 + Axis * (S / AxisLength2);
+                        OutNormal = (Origin + Direction * T - OnAxis).GetSafeNormal();
+                    }
+                }
+            }
+        }
+
+        for (const FVector& Cap : { P0, P1 })
+        {
+            float T;
+            FVector Normal;
+            if (RaySphere(Origin, Direction, Cap, Radius, T, Normal) && T < BestT)
+            {
+                BestT = T;
+                OutNormal = Normal;
+            }
+        }
+
+        if (BestT == FLT_MAX)
+        {
+            return false;
+        }
+        OutT = BestT;
+        return true;
+    }
+
+    bool RaycastShape(const UShapeComponent* ShapeComponent, const FRay& Ray, float& OutT, FVector& OutNormal)
+    {
+        const FShape Shape = GetComponentShape(ShapeComponent);
+        const FTransform Transform = ShapeComponent->GetWorldTransform();
+
+        switch (Shape.Kind)
+        {
+        case EShapeKind::Sphere:
+        {
+            const float Radius = Shape.Sphere.SphereRadius * Collision::UniformScaleMax(Transform.Scale3D);
+            return RaySphere(Ray.Origin, Ray.Direction, Transform.Translation, Radius, OutT, OutNormal);
+        }
+        case EShapeKind::Box:
+        {
+            FOBB Box;
+            Collision::BuildOBB(Shape, Transform, Box);
+            return RayOBB(Ray.Origin, Ray.Direction, Box, OutT, OutNormal);
+        }
+        case EShapeKind::Capsule:
+        {
+            FVector P0, P1;
+            float Radius = 0.0f;
+            Collision::BuildCapsule(Shape, Transform, P0, P1, Radius);
+            return RayCapsule(Ray.Origin, Ray.Direction, P0, P1, Radius, OutT, OutNormal);
+        }
+        }
+        return false;
+    }
+
+    bool RaycastStaticMesh(const UStaticMeshComponent* StaticMeshComponent, const FRay& Ray, bool bCullBackFaces,
+        float& OutT, FVector& OutNormal)
+    {
+        UStaticMesh* MeshResource = StaticMeshComponent->GetStaticMesh();
+        if (!MeshResource)
+        {
+            return false;
+        }
+
+        FStaticMesh* StaticMesh = MeshResource->GetStaticMeshAsset();
+        if (!StaticMesh)
+        {
+            return false;
+        }
+
+        // 캐시된 BVH 사용 (동일 OBJ 경로는 동일 BVH 공유)
+        FMeshBVH* MeshBVH = UResourceManager::GetInstance().GetOrBuildMeshBVH(MeshResource->GetAssetPathFileName(), StaticMesh);
+        if (!MeshBVH)
+        {
+            return false;
+        }
+
+        // GetWorldMatrix()는 캐시(mutable)를 갱신하므로 병렬 쿼리에서도 안전하도록 트랜스폼에서 직접 계산
+        const FMatrix WorldMatrix = StaticMeshComponent->GetWorldTransform().ToMatrix();
+        const FMatrix InvWorld = WorldMatrix.InverseAffine();
+        const FVector4 LocalOrigin4 = FVector4(Ray.Origin.X, Ray.Origin.Y, Ray.Origin.Z, 1.0f) * InvWorld;
+        const FVector4 LocalDirection4 = FVector4(Ray.Direction.X, Ray.Direction.Y, Ray.Direction.Z, 0.0f) * InvWorld;
+        const FRay LocalRay{ FVector(LocalOrigin4.X, LocalOrigin4.Y, LocalOrigin4.Z), FVector(LocalDirection4.X, LocalDirection4.Y, LocalDirection4.Z) };
+
+        float LocalT = 0.0f;
+        FVector LocalNormal;
+        if (!MeshBVH->IntersectRayWithNormal(LocalRay, LocalT, LocalNormal, bCullBackFaces))
+        {
+            return false;
+        }
+
+        const FVector LocalHit = LocalRay.Origin + LocalRay.Direction * LocalT;
+        const FVector4 WorldHit4 = FVector4(LocalHit.X, LocalHit.Y, LocalHit.Z, 1.0f) * WorldMatrix;
+        OutT = (FVector(WorldHit4.X, WorldHit4.Y, WorldHit4.Z) - Ray.Origin).Size();
+
+        // 노멀은 역전치 행렬로 변환 (비균등 스케일 대응)
+        const FVector4 WorldNormal4 = FVector4(LocalNormal.X, LocalNormal.Y, LocalNormal.Z, 0.0f) * InvWorld.Transpose();
+        OutNormal = FVector(WorldNormal4.X, WorldNormal4.Y, WorldNormal4.Z).GetSafeNormal();
+        return true;
+    }
+
+    // 점 Point에서 가장 가까운 셰이프 표면 위치와 바깥 방향 법선
+    void ComputeContact(const FShape& Shape, const FTransform& Transform, const FVector& Point,
+        FVector& OutImpactPoint, FVector& OutImpactNormal)
+    {
+        if (Shape.Kind == EShapeKind::Sphere)
+        {
+            const FVector Center = Transform.Translation;
+            const float Radius = Shape.Sphere.SphereRadius * Collision::UniformScaleMax(Transform.Scale3D);
+            const FVector ToPoint = Point - Center;
+            const float Distance = ToPoint.Size();
+            OutImpactNormal = (Distance > 0.001f) ? ToPoint / Distance : FVector(0, 0, 1);
+            OutImpactPoint = Center + OutImpactNormal * Radius;
+        }
+        else if (Shape.Kind == EShapeKind::Box)
+        {
+            FOBB Box;
+            Collision::BuildOBB(Shape, Transform, Box);
+
+            const FVector ToPoint = Point - Box.Center;
+            FVector Local(
+                FVector::Dot(ToPoint, Box.Axes[0]),
+                FVector::Dot(ToPoint, Box.Axes[1]),
+                FVector::Dot(ToPoint, Box.Axes[2]));
+
+            // 침투 깊이가 가장 얕은 면을 접촉면으로 사용
+            float MinPenetration = FLT_MAX;
+            int32 BestAxis = 0;
+            float BestSign = 1.0f;
+            for (int32 Axis = 0; Axis < 3; ++Axis)
+            {
+                const float PenetrationPositive = Box.HalfExtent[Axis] - Local[Axis];
+                const float PenetrationNegative = Box.HalfExtent[Axis] + Local[Axis];
+                if (PenetrationPositive < MinPenetration) { MinPenetration = PenetrationPositive; BestAxis = Axis; BestSign = 1.0f; }
+                if (PenetrationNegative < MinPenetration) { MinPenetration = PenetrationNegative; BestAxis = Axis; BestSign = -1.0f; }
+            }
+
+            for (int32 Axis = 0; Axis < 3; ++Axis)
+            {
+                Local[Axis] = FMath::Clamp(Local[Axis], -Box.HalfExtent[Axis], Box.HalfExtent[Axis]);
+            }
+            Local[BestAxis] = Box.HalfExtent[BestAxis] * BestSign;
+
+            OutImpactNormal = Box.Axes[BestAxis] * BestSign;
+            OutImpactPoint = Box.Center + Box.Axes[0] * Local.X + Box.Axes[1] * Local.Y + Box.Axes[2] * Local.Z;
+        }
+        else if (Shape.Kind == EShapeKind::Capsule)
+        {
+            FVector P0, P1;
+            float Radius = 0.0f;
+            Collision::BuildCapsule(Shape, Transform, P0, P1, Radius);
+
+            const FVector Axis = P1 - P0;
+            const float AxisLength2 = Axis.SizeSquared();
+            const float S = (AxisLength2 > 1e-8f) ? FMath::Clamp(FVector::Dot(Point - P0, Axis) / AxisLength2, 0.0f, 1.0f) : 0.5f;
+            const FVector OnAxis = P0 + Axis * S;
+
+            const FVector FromAxis = Point - OnAxis;
+            const float Distance = FromAxis.Size();
+            if (Distance > 0.001f)
+            {
+                OutImpactNormal = FromAxis / Distance;
+            }
+            else
+            {
+                // 점이 캡슐 축 위에 있으면 가까운 끝(반구) 방향으로 밀어냄
+                const FVector Up = Transform.Rotation.RotateVector(FVector(0, 0, 1));
+                OutImpactNormal = (FVector::Dot(Point - Transform.Translation, Up) >= 0.0f) ? Up : -Up;
+            }
+            OutImpactPoint = OnAxis + OutImpactNormal * Radius;
+        }
+    }
+
+    // 스윕 도형의 가장 작은 반경 (샘플 간격 결정용)
+    float GetMinimumExtent(const FShape& Shape)
+    {
+        switch (Shape.Kind)
+        {
+        case EShapeKind::Sphere:  return Shape.Sphere.SphereRadius;
+        case EShapeKind::Box:     return FMath::Min(Shape.Box.BoxExtent.X, FMath::Min(Shape.Box.BoxExtent.Y, Shape.Box.BoxExtent.Z));
+        case EShapeKind::Capsule: return Shape.Capsule.CapsuleRadius;
+        }
+        return 0.0f;
+    }
+}
+
+FSweepRequest FSweepRequest::MakeSphere(const FVector& InStart, const FVector& InEnd, float Radius)
+{
+    FSweepRequest Request;
+    Request.Shape.Kind = EShapeKind::Sphere;
+    Request.Shape.Sphere.SphereRadius = Radius;
+    Request.Start = InStart;
+    Request.End = InEnd;
+    return Request;
+}
+
+FSweepRequest FSweepRequest::MakeBox(const FVector& InStart, const FVector& InEnd, const FVector& HalfExtent, const FQuat& InRotation)
+{
+    FSweepRequest Request;
+    Request.Shape.Kind = EShapeKind::Box;
+    Request.Shape.Box.BoxExtent = HalfExtent;
+    Request.Rotation = InRotation;
+    Request.Start = InStart;
+    Request.End = InEnd;
+    return Request;
+}
+
+FSweepRequest FSweepRequest::MakeCapsule(const FVector& InStart, const FVector& InEnd, float Radius, float HalfHeight, const FQuat& InRotation)
+{
+    FSweepRequest Request;
+    Request.Shape.Kind = EShapeKind::Capsule;
+    Request.Shape.Capsule.CapsuleRadius = Radius;
+    Request.Shape.Capsule.CapsuleHalfHeight = HalfHeight;
+    Request.Rotation = InRotation;
+    Request.Start = InStart;
+    Request.End = InEnd;
+    return Request;
+}
+
+namespace SceneQuery
+{
+    bool PassesFilter(const UPrimitiveComponent* Component, const FCollisionQueryParams& Params)
+    {
+        if (!Component)
+        {
+            return false;
+        }
+
+        const AActor* Owner = Component->GetOwner();
+        if (!Owner)
+        {
+            return false;
+        }
+
+        if ((Params.ChannelMask & ToCollisionChannelMask(Component->GetCollisionChannel())) == 0)
+        {
+            return false;
+        }
+        if (Params.ComponentClass && !Component->IsA(Params.ComponentClass))
+        {
+            return false;
+        }
+        if (Params.bRequireOverlapEvents && !Component->GetGenerateOverlapEvents())
+        {
+            return false;
+        }
+        if (Params.bIgnoreHiddenInEditor && Owner->GetActorHiddenInEditor())
+        {
+            return false;
+        }
+
+        for (const AActor* Ignored : Params.IgnoredActors)
+        {
+            if (Ignored == Owner)
+            {
+                return false;
+            }
+        }
+        return true;
+    }
+
+    bool RaycastComponent(UPrimitiveComponent* Component, const FRay& Ray, float MaxDistance,
+        const FCollisionQueryParams& Params, FHitResult& OutHit)
+    {
+        float T = 0.0f;
+        FVector Normal;
+
+        if (const UStaticMeshComponent* StaticMeshComponent = Cast<UStaticMeshComponent>(Component))
+        {
+            if (!RaycastStaticMesh(StaticMeshComponent, Ray, Params.bIgnoreBackFaces, T, Normal))
+            {
+                return false;
+            }
+        }
+        else if (const UShapeComponent* ShapeComponent = Cast<UShapeComponent>(Component))
+        {
+            if (!RaycastShape(ShapeComponent, Ray, T, Normal))
+            {
+                return false;
+            }
+        }
+        else
+        {
+            return false;
+        }
+
+        if (T > MaxDistance)
+        {
+            return false;
+        }
+
+        // 메시 BVH는 로컬 공간에서 뒷면을 거르므로, 음수 스케일(미러링)로 뒤집힌 경우를 월드에서 한 번 더 확인
+        if (FVector::Dot(Normal, Ray.Direction) > 0.0f)
+        {
+            if (Params.bIgnoreBackFaces)
+            {
+                return false;
+            }
+            Normal = -Normal;
+        }
+
+        OutHit.Actor = Component->GetOwner();
+        OutHit.Component = Component;
+        OutHit.Distance = T;
+        OutHit.Time = (MaxDistance > 0.0f && MaxDistance < FLT_MAX) ? T / MaxDistance : 0.0f;
+        OutHit.Location = Ray.Origin + Ray.Direction * T;
+        OutHit.ImpactPoint = OutHit.Location;
+        OutHit.ImpactNormal = Normal;
+        OutHit.bBlockingHit = true;
+        return true;
+    }
+
+    bool SweepComponent(UPrimitiveComponent* Component, const FAABB& Bounds, const FSweepRequest& Sweep, FHitResult& OutHit)
+    {
+        FShape OtherShape;
+        FTransform OtherTransform;
+        if (!GetCollisionShape(Component, Bounds, OtherShape, OtherTransform))
+        {
+            return false;
+        }
+
+        const FVector Delta = Sweep.End - Sweep.Start;
+        const auto OverlapsAt = [&](float Time)
+        {
+            const FTransform SweepTransform(Sweep.Start + Delta * Time, Sweep.Rotation, FVector::One());
+            return Collision::OverlapLUT[static_cast<int>(Sweep.Shape.Kind)][static_cast<int>(OtherShape.Kind)](
+                Sweep.Shape, SweepTransform, OtherShape, OtherTransform);
+        };
+
+        // 이동 거리에 따라 적응형으로 샘플링 (도형 크기보다 촘촘하게, 4~16개)
+        const float Length = Delta.Size();
+        int32 NumSamples = FMath::Max(4, static_cast<int32>(Length / FMath::Max(GetMinimumExtent(Sweep.Shape), 1.0f)) + 1);
+        NumSamples = FMath::Min(NumSamples, 16);
+
+        float HitTime = -1.0f;
+        for (int32 i = 0; i <= NumSamples; ++i)
+        {
+            const float Time = static_cast<float>(i) / static_cast<float>(NumSamples);
+            if (!OverlapsAt(Time))
+            {
+                continue;
+            }
+
+            HitTime = Time;
+            if (i > 0)
+            {
+                // 마지막으로 겹치지 않았던 샘플과의 사이를 이분 탐색해 접촉 시점을 좁힘
+                float Low = static_cast<float>(i - 1) / static_cast<float>(NumSamples);
+                float High = Time;
+                for (int32 Step = 0; Step < 6; ++Step)
+                {
+                    const float Mid = (Low + High) * 0.5f;
+                    (OverlapsAt(Mid) ? High : Low) = Mid;
+                }
+                HitTime = High;
+            }
+            break;
+        }
+
+        if (HitTime < 0.0f)
+        {
+            return false;
+        }
+
+        OutHit.Actor = Component->GetOwner();
+        OutHit.Component = Component;
+        OutHit.Time = HitTime;
+        OutHit.Distance = Length * HitTime;
+        OutHit.Location = Sweep.Start + Delta * HitTime;
+        ComputeContact(OtherShape, OtherTransform, OutHit.Location, OutHit.ImpactPoint, OutHit.ImpactNormal);
+        OutHit.bBlockingHit = true;
+        return true;
+    }
+
+    bool OverlapComponent(UPrimitiveComponent* Component, const FAABB& Bounds, const FShape& Shape, const FTransform& Transform)
+    {
+        FShape OtherShape;
+        FTransform OtherTransform;
+        if (!GetCollisionShape(Component, Bounds, OtherShape, OtherTransform))
+        {
+            return false;
+        }
+
+        return Collision::OverlapLUT[static_cast<int>(Shape.Kind)][static_cast<int>(OtherShape.Kind)](
+            Shape, Transform, OtherShape, OtherTransform);
+    }
+
+    FAABB ComputeSweepBounds(const FSweepRequest& Sweep)
+    {
+        const FAABB StartBounds = Collision::ComputeShapeAABB(Sweep.Shape, FTransform(Sweep.Start, Sweep.Rotation, FVector::One()));
+        const FAABB EndBounds = Collision::ComputeShapeAABB(Sweep.Shape, FTransform(Sweep.End, Sweep.Rotation, FVector::One()));
+        return FAABB::Union(StartBounds, EndBounds);
+    }
+}
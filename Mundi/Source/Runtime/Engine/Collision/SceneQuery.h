@@ -0,0 +1,119 @@
+﻿#pragma once
+
+#include "AABB.h"
+#include "ShapeComponent.h"
+
+class AActor;
+class UClass;
+class UPrimitiveComponent;
+
+// ECollisionChannel 하나에 해당하는 마스크 비트
+constexpr uint32 ToCollisionChannelMask(ECollisionChannel Channel)
+{
+    return 1u << static_cast<uint32>(Channel);
+}
+
+constexpr uint32 CollisionChannelMask_All = 0xFFFFFFFFu;
+
+// -------------------------------------------
+// 씬 쿼리 (레이캐스트 / 스윕 / 오버랩)
+// -------------------------------------------
+// UWorldPartitionManager의 BVH를 브로드 페이즈로 사용하고, 후보 컴포넌트를 종류별로 검사합니다.
+// - UStaticMeshComponent: 레이는 메시 BVH로 삼각형까지 검사, 스윕/오버랩은 월드 AABB 박스로 근사
+// - UShapeComponent: 박스/구/캡슐 형상으로 정확히 검사 (스윕은 샘플링 + 이분 탐색)
+// - 그 외 프리미티브(빌보드, 데칼 등)는 충돌 형상이 없으므로 무시
+// 쿼리 함수들은 월드를 수정하지 않으므로 여러 스레드에서 동시에 호출할 수 있습니다.
+// -------------------------------------------
+
+// 쿼리 대상 필터
+struct FCollisionQueryParams
+{
+    // 검사할 채널 (ToCollisionChannelMask 조합)
+    uint32 ChannelMask = CollisionChannelMask_All;
+
+    // 지정하면 이 클래스(또는 파생 클래스)의 컴포넌트만 검사
+    UClass* ComponentClass = nullptr;
+
+    // 무시할 액터 (보통 쿼리를 실행하는 자기 자신)
+    TArray<const AActor*> IgnoredActors;
+
+    // 에디터에서 숨긴 액터 무시 (피킹용)
+    bool bIgnoreHiddenInEditor = false;
+
+    // bGenerateOverlapEvents가 켜진 컴포넌트만 검사
+    bool bRequireOverlapEvents = false;
+
+    // 레이캐스트: 법선이 레이와 같은 방향인 면(뒷면) 히트 무시
+    bool bIgnoreBackFaces = false;
+
+    void AddIgnoredActor(const AActor* Actor)
+    {
+        if (Actor)
+        {
+            IgnoredActors.Add(Actor);
+        }
+    }
+};
+
+// 쿼리 결과
+struct FHitResult
+{
+    AActor* Actor = nullptr;
+    UPrimitiveComponent* Component = nullptr;
+
+    // 레이: 시작점에서 히트 지점까지 거리
+    // 스윕: 충돌 직전까지 도형 중심이 이동한 거리
+    float Distance = 0.0f;
+
+    // 스윕 진행 비율 [0, 1] (레이는 Distance / MaxDistance)
+    float Time = 1.0f;
+
+    // 레이: 히트 지점, 스윕: 충돌 시점의 도형 중심
+    FVector Location;
+
+    // 표면 접촉점과 법선 (월드)
+    FVector ImpactPoint;
+    FVector ImpactNormal;
+
+    bool bBlockingHit = false;
+};
+
+// 일괄 레이캐스트 입력 (Direction은 정규화된 방향)
+struct FRaycastRequest
+{
+    FVector Start;
+    FVector Direction;
+    float MaxDistance = FLT_MAX;
+};
+
+// 스윕 입력: Shape를 Rotation으로 회전시킨 채 Start -> End로 이동
+struct FSweepRequest
+{
+    FShape Shape;
+    FQuat Rotation = FQuat::Identity();
+    FVector Start;
+    FVector End;
+
+    static FSweepRequest MakeSphere(const FVector& InStart, const FVector& InEnd, float Radius);
+    static FSweepRequest MakeBox(const FVector& InStart, const FVector& InEnd, const FVector& HalfExtent, const FQuat& InRotation = FQuat::Identity());
+    static FSweepRequest MakeCapsule(const FVector& InStart, const FVector& InEnd, float Radius, float HalfHeight, const FQuat& InRotation = FQuat::Identity());
+};
+
+// 컴포넌트 단위 검사 (BVH 순회에서 후보마다 호출)
+namespace SceneQuery
+{
+    // 필터(채널, 클래스, 무시 액터 등) 통과 여부
+    bool PassesFilter(const UPrimitiveComponent* Component, const FCollisionQueryParams& Params);
+
+    // Ray.Direction은 정규화되어 있어야 합니다. MaxDistance 안쪽의 가장 가까운 히트를 반환합니다.
+    bool RaycastComponent(UPrimitiveComponent* Component, const FRay& Ray, float MaxDistance,
+        const FCollisionQueryParams& Params, FHitResult& OutHit);
+
+    // Bounds: BVH에 캐시된 컴포넌트 월드 AABB (스태틱 메시 근사에 사용)
+    bool SweepComponent(UPrimitiveComponent* Component, const FAABB& Bounds, const FSweepRequest& Sweep, FHitResult& OutHit);
+
+    bool OverlapComponent(UPrimitiveComponent* Component, const FAABB& Bounds, const FShape& Shape, const FTransform& Transform);
+
+    // 스윕 경로 전체를 감싸는 AABB
+    FAABB ComputeSweepBounds(const FSweepRequest& Sweep);
+}
@@ -119,7 +119,7 @@ void UBillboardComponent::CollectMeshBatches(TArray<FMeshBatchElement>& OutMeshB
 	// UQuad는 GroupInfo가 없는 단일 메시로 처리합니다.
 	FMeshBatchElement BatchElement;
 
-	FShaderVariant* ShaderVariant = ShaderToUse->GetOrCompileShaderVariant(MaterialToUse->GetShaderMacros());
+	FShaderVariant* ShaderVariant = ShaderToUse->GetOrCompileShaderVariant(MaterialToUse->GetShaderPermutationId());
 
 	// --- 정렬 키 ---
 	BatchElement.VertexShader = ShaderVariant->VertexShader;
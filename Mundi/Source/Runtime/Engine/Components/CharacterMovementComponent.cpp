@@ -2,6 +2,9 @@
 #include "CharacterMovementComponent.h"
 #include "Character.h"
 #include "SceneComponent.h"
+#include "World.h"
+#include "WorldPartitionManager.h"
+#include "Picking.h"
 
 IMPLEMENT_CLASS(UCharacterMovementComponent)
 
@@ -150,7 +153,16 @@ void UCharacterMovementComponent::MoveUpdatedComponent(const FVector& Delta, flo
 	FVector CurrentLocation = UpdatedComponent->GetWorldLocation();
 	FVector NewLocation = CurrentLocation + Delta;
 
-	// Simple ground clamping (temporary - should use proper collision)
+	// Stop on floor geometry crossed while moving down (avoids tunneling at high fall speed)
+	float FloorZ = 0.0f;
+	if (Delta.Z < 0.0f && FindFloor(CurrentLocation, -Delta.Z, FloorZ) && NewLocation.Z < FloorZ)
+	{
+		NewLocation.Z = FloorZ;
+		Velocity.Z = 0.0f;
+		bOnGround = true;
+	}
+
+	// Fallback ground plane at Z = 0
 	if (NewLocation.Z < 0.0f && Velocity.Z <= 0.0f)
 	{
 		NewLocation.Z = 0.0f;
@@ -171,9 +183,40 @@ void UCharacterMovementComponent::CheckForGround()
 
 	FVector CurrentLocation = UpdatedComponent->GetWorldLocation();
 
-	// Simple ground check (temporary - should use raycasting)
-	// Consider on ground if Z position is at or below ground level
-	bOnGround = (CurrentLocation.Z <= GroundCheckDistance);
+	// On ground if floor geometry is within GroundCheckDistance below the feet,
+	// or if at or below the fallback ground plane (Z = 0)
+	float FloorZ = 0.0f;
+	bOnGround = FindFloor(CurrentLocation, GroundCheckDistance, FloorZ)
+		|| (CurrentLocation.Z <= GroundCheckDistance);
+}
+
+bool UCharacterMovementComponent::FindFloor(const FVector& Location, float MaxDrop, float& OutFloorZ) const
+{
+	UWorld* World = GetWorld();
+	UWorldPartitionManager* Partition = World ? World->GetPartitionManager() : nullptr;
+	if (!Partition)
+	{
+		return false;
+	}
+
+	// Start slightly above the feet so a floor we are already standing on is still found
+	const float StartOffset = GroundCheckDistance;
+
+	FCollisionQueryParams Params;
+	// Only static geometry counts as floor (shape triggers default to WorldDynamic)
+	Params.ChannelMask = ToCollisionChannelMask(ECollisionChannel::WorldStatic);
+	Params.bIgnoreBackFaces = true;
+	Params.AddIgnoredActor(Owner);
+
+	FHitResult Hit;
+	const FRay Ray{ Location + FVector(0.0f, 0.0f, StartOffset), FVector(0.0f, 0.0f, -1.0f) };
+	if (!Partition->RaycastClosest(Ray, StartOffset + MaxDrop, Hit, Params))
+	{
+		return false;
+	}
+
+	OutFloorZ = Hit.ImpactPoint.Z;
+	return true;
 }
 
 bool UCharacterMovementComponent::IsOnGround() const
@@ -99,6 +99,9 @@ protected:
 	virtual void CheckForGround();
 	virtual bool IsOnGround() const;
 
+	// Location(발 위치) 바로 위에서 아래로 MaxDrop만큼 레이캐스트해 바닥 높이를 찾음
+	bool FindFloor(const FVector& Location, float MaxDrop, float& OutFloorZ) const;
+
 	// Helper functions
 	FVector GetInputVector() const;
 	float GetMaxSpeed() const;
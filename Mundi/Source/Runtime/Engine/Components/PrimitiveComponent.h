@@ -71,6 +71,10 @@ public:
     void SetGenerateOverlapEvents(bool bEnable) { bGenerateOverlapEvents = bEnable; }
     bool GetGenerateOverlapEvents() const { return bGenerateOverlapEvents; }
 
+    // 씬 쿼리 채널 필터링용 (FCollisionQueryParams::ChannelMask)
+    void SetCollisionChannel(ECollisionChannel InChannel) { CollisionChannel = InChannel; }
+    ECollisionChannel GetCollisionChannel() const { return CollisionChannel; }
+
     // ───── 직렬화 ────────────────────────────
     void Serialize(const bool bInIsLoading, JSON& InOutHandle) override;
 
@@ -83,4 +87,7 @@ protected:
 
     UPROPERTY(EditAnywhere, Category="Shape")
     bool bBlockComponent;
+
+    UPROPERTY(EditAnywhere, Category="Shape")
+    ECollisionChannel CollisionChannel = ECollisionChannel::WorldStatic;
 };
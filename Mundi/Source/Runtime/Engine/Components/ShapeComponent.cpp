@@ -9,6 +9,7 @@
 // IMPLEMENT_CLASS is now auto-generated in .generated.cpp
 UShapeComponent::UShapeComponent() : bShapeIsVisible(true), bShapeHiddenInGame(true)
 {
+    CollisionChannel = ECollisionChannel::WorldDynamic;
     ShapeColor = FVector4(0.2f, 0.8f, 1.0f, 1.0f); 
     bCanEverTick = true;
 }
@@ -171,12 +172,14 @@ void UShapeComponent::TickComponent(float DeltaSeconds)
 
 FAABB UShapeComponent::GetWorldAABB() const
 {
-    if (AActor* Owner = GetOwner())
-    {
-        FAABB OwnerBounds = Owner->GetBounds();
-        const FVector HalfExtent = OwnerBounds.GetHalfExtent();
-        WorldAABB = OwnerBounds;
-    }
+    // 셰이프 자체의 월드 바운드 (BVH 브로드 페이즈/씬 쿼리용)
+    // GetShape를 구현하지 않은 기본 클래스는 크기 0인 구로 취급
+    FShape Shape;
+    Shape.Kind = EShapeKind::Sphere;
+    Shape.Sphere.SphereRadius = 0.0f;
+    GetShape(Shape);
+
+    WorldAABB = Collision::ComputeShapeAABB(Shape, GetWorldTransform());
     return WorldAABB;
 }
   
@@ -2,9 +2,14 @@
 #include "SkeletalMeshComponent.h"
 #include "../Animation/AnimInstance.h"
 #include "../Animation/AnimSingleNodeInstance.h"
+#include "LuaScriptComponent.h"
 
 USkeletalMeshComponent::USkeletalMeshComponent()
 {
+    // 애니메이션은 이동 결과와 무관하므로 이동 그룹 뒤에 모아 병렬로 틱
+    PrimaryComponentTick.TickGroup = ETickingGroup::DuringPhysics;
+    PrimaryComponentTick.bRunOnAnyThread = true;
+
     // 테스트용 기본 메시 설정
     SetSkeletalMesh(GResourceDir + "/Test.fbx");
 }
@@ -63,6 +68,25 @@ void USkeletalMeshComponent::InitAnimInstance()
     }
 }
 
+bool USkeletalMeshComponent::CanTickOnAnyThread() const
+{
+    // 상태 머신/포즈 평가/노티파이(사운드)는 소유 액터의 Lua 스크립트로 구동되므로 Lua 스크립트가 있으면 게임 스레드에서 틱
+    return Super::CanTickOnAnyThread()
+        && (!Owner || !Owner->GetComponent(ULuaScriptComponent::StaticClass()));
+}
+
+void USkeletalMeshComponent::OnParallelTickFinished()
+{
+    Super::OnParallelTickFinished();
+
+    // 노티파이는 카메라 셰이크/사운드/액터 회전·스케일처럼 공유 상태를 바꾸므로
+    // 워커 틱(PostUpdateAnimation)에서는 큐에만 쌓고 여기서 게임 스레드로 실행
+    if (AnimInstance)
+    {
+        AnimInstance->FlushQueuedNotifies();
+    }
+}
+
 void USkeletalMeshComponent::TickComponent(float DeltaTime)
 {
     Super::TickComponent(DeltaTime);
@@ -27,6 +27,8 @@ public:
 
     void OnRegister(UWorld* InWorld) override; // AnimInstance 초기화
     void TickComponent(float DeltaTime) override;
+    bool CanTickOnAnyThread() const override;
+    void OnParallelTickFinished() override; // 워커 틱에서 미룬 AnimNotify 실행
     void SetSkeletalMesh(const FString& PathFileName) override;
 
 // ====================================
@@ -224,17 +224,16 @@ void USkinnedMeshComponent::CollectMeshBatches(TArray<FMeshBatchElement>& OutMes
        }
 
        FMeshBatchElement BatchElement;
-       TArray<FShaderMacro> ShaderMacros = View->ViewShaderMacros;
+       FShaderPermutationDomain& PermutationDomain = FShaderPermutationDomain::GetInstance();
+       FShaderPermutationId PermutationId = View->ViewPermutationId;
 
        if (IsGpuSkinning)
        {
-           ShaderMacros.Add({ "ENABLE_GPU_SKINNING", "1" });
+           static const FShaderPermutationId GpuSkinningPermutation = PermutationDomain.Encode("ENABLE_GPU_SKINNING", "1");
+           PermutationId = PermutationDomain.Combine(PermutationId, GpuSkinningPermutation);
        }
-       if (0 < MaterialToUse->GetShaderMacros().Num())
-       {
-          ShaderMacros.Append(MaterialToUse->GetShaderMacros());
-       }
-       FShaderVariant* ShaderVariant = ShaderToUse->GetOrCompileShaderVariant(ShaderMacros);
+       PermutationId = PermutationDomain.Combine(PermutationId, MaterialToUse->GetShaderPermutationId());
+       FShaderVariant* ShaderVariant = ShaderToUse->GetOrCompileShaderVariant(PermutationId);
 
        if (ShaderVariant)
        {
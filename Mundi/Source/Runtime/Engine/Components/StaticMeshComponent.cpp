@@ -96,13 +96,10 @@ void UStaticMeshComponent::CollectMeshBatches(TArray<FMeshBatchElement>& OutMesh
 		}
 
 		FMeshBatchElement BatchElement;
-		// View 모드 전용 매크로와 머티리얼 개인 매크로를 결합한다
-		TArray<FShaderMacro> ShaderMacros = View->ViewShaderMacros;
-		if (0 < MaterialToUse->GetShaderMacros().Num())
-		{
-			ShaderMacros.Append(MaterialToUse->GetShaderMacros());
-		}
-		FShaderVariant* ShaderVariant = ShaderToUse->GetOrCompileShaderVariant(ShaderMacros);
+		// View 모드 전용 매크로와 머티리얼 개인 매크로를 결합한다 (미리 계산된 Permutation ID끼리 결합)
+		const FShaderPermutationId PermutationId = FShaderPermutationDomain::GetInstance().Combine(
+			View->ViewPermutationId, MaterialToUse->GetShaderPermutationId());
+		FShaderVariant* ShaderVariant = ShaderToUse->GetOrCompileShaderVariant(PermutationId);
 
 		if (ShaderVariant)
 		{
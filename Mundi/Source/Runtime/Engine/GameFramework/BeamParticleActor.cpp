@@ -25,11 +25,11 @@ ABeamParticleActor::ABeamParticleActor()
 	{
 		// 1. ParticleSystem 템플릿 생성
 		UParticleSystem* BeamTemplate = NewObject<UParticleSystem>();
-		BeamTemplate->ObjectName = "BeamParticleSystem";
+		BeamTemplate->SetName("BeamParticleSystem");
 
 		// 2. Emitter 생성
 		UParticleEmitter* BeamEmitter = NewObject<UParticleEmitter>();
-		BeamEmitter->ObjectName = "BeamEmitter";
+		BeamEmitter->SetName("BeamEmitter");
 		BeamEmitter->SetMaxParticleCount(100);
 
 		// 3. LOD Level 0에 접근
@@ -11,6 +11,7 @@ ACharacter::ACharacter()
     // Create capsule component for collision
     CapsuleComponent = CreateDefaultSubobject<UCapsuleComponent>("CapsuleComponent");
     SetRootComponent(CapsuleComponent);
+    CapsuleComponent->SetCollisionChannel(ECollisionChannel::Pawn);
 
     // Create skeletal mesh component
     MeshComponent = CreateDefaultSubobject<USkeletalMeshComponent>("MeshComponent");
@@ -0,0 +1,1002 @@
+﻿#include "pch.h"
+#include "CookedLevel.h"
+#include "StaticMesh.h"
+#include "SkeletalMesh.h"
+#include "Texture.h"
+#include "Material.h"
+#include "Level.h"
+
+namespace
+{
+	// 파일 레이아웃 (모든 오프셋은 파일 시작 기준 바이트)
+	// [Header][StringTable][Schema][RecordTable][Records][ActorTable][JsonData]
+	struct FCookedLevelHeader
+	{
+		uint32 Magic;
+		uint32 Version;
+		uint32 FileSize;
+		uint32 StringCount;
+		uint32 StringTableOffset;	// uint32 StringOffsets[StringCount] + 널 종료 문자열들
+		uint32 ClassCount;
+		uint32 SchemaOffset;		// 클래스마다 FCookedClassEntry + FCookedFieldEntry[FieldCount]
+		uint32 RecordCount;
+		uint32 RecordTableOffset;	// uint32 RecordOffsets[RecordCount], 각 레코드는 uint32 ClassIndex + 값
+		uint32 ActorCount;
+		uint32 ActorTableOffset;	// FCookedActorEntry[ActorCount]
+		uint32 LevelDataOffset;		// 바이너리 JSON (없으면 UINT32_MAX)
+	};
+
+	struct FCookedClassEntry
+	{
+		uint32 NameIndex;
+		uint32 FieldCount;
+		uint32 RecordSize;
+	};
+
+	struct FCookedFieldEntry
+	{
+		uint32 NameIndex;
+		uint32 Type;
+		uint32 RecordOffset;
+	};
+
+	struct FCookedActorEntry
+	{
+		uint32 ClassIndex;
+		uint32 DataOffset;			// 바이너리 JSON
+	};
+
+	// 바이너리 JSON 태그 (JSON::Class 순서와 동일)
+	enum class ECookedJsonTag : uint8
+	{
+		Null,
+		Object,
+		Array,
+		String,
+		Floating,
+		Integral,
+		Boolean
+	};
+	static_assert(static_cast<uint8>(ECookedJsonTag::Boolean) == static_cast<uint8>(JSON::Class::Boolean), "ECookedJsonTag must mirror JSON::Class");
+
+	// 손상된 파일에서 무한 재귀를 막기 위한 최대 중첩 깊이
+	constexpr int32 MaxJsonDepth = 64;
+
+	static_assert(sizeof(FLinearColor) == sizeof(float) * 4, "FLinearColor layout changed");
+
+	// 레코드 안에서 한 값이 차지하는 크기 (4바이트 정렬, 문자열/리소스는 문자열 테이블 인덱스)
+	uint32 GetRecordFieldSize(EPropertyType Type)
+	{
+		switch (Type)
+		{
+		case EPropertyType::FVector:
+			return sizeof(FVector);
+		case EPropertyType::FLinearColor:
+		case EPropertyType::Curve:
+			return sizeof(float) * 4;
+		default:
+			return sizeof(uint32);
+		}
+	}
+
+	template<typename T>
+	void AppendValue(TArray<uint8>& Out, const T& Value)
+	{
+		const uint8* Bytes = reinterpret_cast<const uint8*>(&Value);
+		Out.insert(Out.end(), Bytes, Bytes + sizeof(T));
+	}
+
+	void AppendBytes(TArray<uint8>& Out, const TArray<uint8>& Bytes)
+	{
+		Out.insert(Out.end(), Bytes.begin(), Bytes.end());
+	}
+
+	// JSON::ToString()은 이스케이프된 문자열을 돌려주므로 원본으로 되돌림
+	FString UnescapeJsonString(const FString& Escaped)
+	{
+		FString Result;
+		Result.reserve(Escaped.size());
+		for (size_t i = 0; i < Escaped.size(); ++i)
+		{
+			if (Escaped[i] != '\\' || i + 1 == Escaped.size())
+			{
+				Result += Escaped[i];
+				continue;
+			}
+
+			switch (Escaped[++i])
+			{
+			case 'b': Result += '\b'; break;
+			case 'f': Result += '\f'; break;
+			case 'n': Result += '\n'; break;
+			case 'r': Result += '\r'; break;
+			case 't': Result += '\t'; break;
+			default: Result += Escaped[i]; break;
+			}
+		}
+		return Result;
+	}
+
+	// 리소스 프로퍼티가 JSON 직렬화와 같은 경로를 쓰도록 UObject::Serialize와 동일한 getter 사용
+	FString GetResourcePath(EPropertyType Type, const void* ValuePtr)
+	{
+		switch (Type)
+		{
+		case EPropertyType::Texture:
+		{
+			const UTexture* Texture = *static_cast<UTexture* const*>(ValuePtr);
+			return Texture ? Texture->GetFilePath() : FString();
+		}
+		case EPropertyType::StaticMesh:
+		{
+			const UStaticMesh* Mesh = *static_cast<UStaticMesh* const*>(ValuePtr);
+			return Mesh ? Mesh->GetAssetPathFileName() : FString();
+		}
+		case EPropertyType::SkeletalMesh:
+		{
+			const USkeletalMesh* Mesh = *static_cast<USkeletalMesh* const*>(ValuePtr);
+			return Mesh ? Mesh->GetPathFileName() : FString();
+		}
+		case EPropertyType::Material:
+		{
+			const UMaterial* Material = *static_cast<UMaterial* const*>(ValuePtr);
+			return Material ? Material->GetFilePath() : FString();
+		}
+		default:
+			return FString();
+		}
+	}
+}
+
+// ────────────────────────────────────────────────────────
+// FCookedLevel
+// ────────────────────────────────────────────────────────
+
+namespace FCookedLevel
+{
+	FWideString GetCookedPath(const FWideString& ScenePath)
+	{
+		std::filesystem::path CookedPath(ScenePath);
+		CookedPath.replace_extension(L".cscene");
+		return CookedPath.wstring();
+	}
+
+	bool IsCookedUpToDate(const FWideString& ScenePath, const FWideString& CookedPath)
+	{
+		std::error_code Error;
+		if (!std::filesystem::exists(CookedPath, Error))
+		{
+			return false;
+		}
+
+		// 원본이 없으면 쿡 파일만으로 로드 (배포 빌드)
+		if (!std::filesystem::exists(ScenePath, Error))
+		{
+			return true;
+		}
+
+		const auto SceneTime = std::filesystem::last_write_time(ScenePath, Error);
+		const auto CookedTime = std::filesystem::last_write_time(CookedPath, Error);
+		return !Error && CookedTime >= SceneTime;
+	}
+
+	bool IsRecordProperty(EPropertyType Type)
+	{
+		switch (Type)
+		{
+		case EPropertyType::Bool:
+		case EPropertyType::Int32:
+		case EPropertyType::Float:
+		case EPropertyType::Enum:
+		case EPropertyType::FVector:
+		case EPropertyType::FLinearColor:
+		case EPropertyType::Curve:
+		case EPropertyType::FString:
+		case EPropertyType::ScriptFile:
+		case EPropertyType::FName:
+		case EPropertyType::Texture:
+		case EPropertyType::StaticMesh:
+		case EPropertyType::SkeletalMesh:
+		case EPropertyType::Material:
+			return true;
+		default:
+			return false;
+		}
+	}
+
+	bool CookScene(const FWideString& ScenePath, int32* OutActorCount)
+	{
+		std::unique_ptr<ULevel> Level = ULevelService::CreateDefaultLevel();
+		JSON LevelJson;
+		if (!FJsonSerializer::LoadJsonFromFile(LevelJson, ScenePath))
+		{
+			return false;
+		}
+		Level->Serialize(true, LevelJson);
+
+		const bool bSaved = Level->SaveCooked(GetCookedPath(ScenePath));
+		if (OutActorCount)
+		{
+			*OutActorCount = Level->GetActors().Num();
+		}
+
+		// 월드에 등록하지 않은 임시 레벨이므로 액터를 직접 정리
+		for (AActor* Actor : Level->GetActors())
+		{
+			ObjectFactory::DeleteObject(Actor);
+		}
+		Level->Clear();
+		return bSaved;
+	}
+
+	bool SerializeObjectRecord(UObject* Object, bool bIsLoading, JSON& InOutHandle)
+	{
+		if (bIsLoading)
+		{
+			const FCookedLevelReader* Reader = FCookedLevelReader::GetActive();
+			if (!Reader || !InOutHandle.hasKey(RecordKey))
+			{
+				return false;
+			}
+
+			const long RecordIndex = InOutHandle.at(RecordKey).ToInt();
+			if (RecordIndex < 0 || !Reader->ApplyObjectRecord(Object, static_cast<uint32>(RecordIndex)))
+			{
+				UE_LOG("[CookedLevel] Record %ld does not match %s, using defaults", RecordIndex, Object->GetClass()->Name);
+			}
+			return true;
+		}
+
+		FCookedLevelWriter* Writer = FCookedLevelWriter::GetActive();
+		if (!Writer)
+		{
+			return false;
+		}
+
+		InOutHandle[RecordKey] = static_cast<int32>(Writer->WriteObjectRecord(Object));
+		return true;
+	}
+}
+
+// ────────────────────────────────────────────────────────
+// FCookedLevelWriter
+// ────────────────────────────────────────────────────────
+
+FCookedLevelWriter* FCookedLevelWriter::Active = nullptr;
+
+FCookedLevelWriter::FCookedLevelWriter()
+{
+	assert(Active == nullptr && "Only one cooked level writer can be active");
+	Active = this;
+}
+
+FCookedLevelWriter::~FCookedLevelWriter()
+{
+	if (Active == this)
+	{
+		Active = nullptr;
+	}
+}
+
+uint32 FCookedLevelWriter::AddString(const FString& String)
+{
+	if (const uint32* Found = StringToIndex.Find(String))
+	{
+		return *Found;
+	}
+
+	const uint32 Index = static_cast<uint32>(Strings.Add(String));
+	StringToIndex.Add(String, Index);
+	return Index;
+}
+
+uint32 FCookedLevelWriter::FindOrAddSchema(const UClass* Class)
+{
+	if (const uint32* Found = ClassToSchema.Find(Class))
+	{
+		return *Found;
+	}
+
+	FClassSchema Schema;
+	Schema.Class = Class;
+	for (const FProperty& Prop : Class->GetAllProperties())
+	{
+		if (!FCookedLevel::IsRecordProperty(Prop.Type))
+		{
+			continue;
+		}
+		Schema.Fields.Add(&Prop);
+		Schema.FieldOffsets.Add(Schema.RecordSize);
+		Schema.RecordSize += GetRecordFieldSize(Prop.Type);
+	}
+
+	const uint32 Index = static_cast<uint32>(Schemas.Add(Schema));
+	ClassToSchema.Add(Class, Index);
+	return Index;
+}
+
+uint32 FCookedLevelWriter::WriteObjectRecord(const UObject* Object)
+{
+	const uint32 ClassIndex = FindOrAddSchema(Object->GetClass());
+	const FClassSchema& Schema = Schemas[ClassIndex];
+
+	const uint32 RecordIndex = static_cast<uint32>(RecordOffsets.Add(static_cast<uint32>(RecordData.Num())));
+	AppendValue(RecordData, ClassIndex);
+
+	const size_t RecordStart = RecordData.Num();
+	RecordData.resize(RecordStart + Schema.RecordSize, 0);
+
+	for (int32 FieldIndex = 0; FieldIndex < Schema.Fields.Num(); ++FieldIndex)
+	{
+		const FProperty& Prop = *Schema.Fields[FieldIndex];
+		const void* Src = Prop.GetValuePtr<uint8>(Object);
+		uint8* Dst = RecordData.GetData() + RecordStart + Schema.FieldOffsets[FieldIndex];
+
+		switch (Prop.Type)
+		{
+		case EPropertyType::Bool:
+		case EPropertyType::Enum:
+			// JSON 경로와 마찬가지로 Enum은 uint8 기반으로 취급
+			*Dst = *static_cast<const uint8*>(Src);
+			break;
+		case EPropertyType::FString:
+		case EPropertyType::ScriptFile:
+		{
+			const uint32 StringIndex = AddString(*static_cast<const FString*>(Src));
+			memcpy(Dst, &StringIndex, sizeof(uint32));
+			break;
+		}
+		case EPropertyType::FName:
+		{
+			const uint32 StringIndex = AddString(static_cast<const FName*>(Src)->ToString());
+			memcpy(Dst, &StringIndex, sizeof(uint32));
+			break;
+		}
+		case EPropertyType::Texture:
+		case EPropertyType::StaticMesh:
+		case EPropertyType::SkeletalMesh:
+		case EPropertyType::Material:
+		{
+			const uint32 StringIndex = AddString(GetResourcePath(Prop.Type, Src));
+			memcpy(Dst, &StringIndex, sizeof(uint32));
+			break;
+		}
+		default:
+			memcpy(Dst, Src, GetRecordFieldSize(Prop.Type));
+			break;
+		}
+	}
+
+	return RecordIndex;
+}
+
+void FCookedLevelWriter::WriteJson(TArray<uint8>& Out, const JSON& Value)
+{
+	const JSON::Class Type = Value.JSONType();
+	Out.Add(static_cast<uint8>(Type));
+
+	switch (Type)
+	{
+	case JSON::Class::Object:
+	{
+		AppendValue(Out, static_cast<uint32>(Value.size()));
+		for (const auto& Pair : Value.ObjectRange())
+		{
+			AppendValue(Out, AddString(Pair.first));
+			WriteJson(Out, Pair.second);
+		}
+		break;
+	}
+	case JSON::Class::Array:
+	{
+		AppendValue(Out, static_cast<uint32>(Value.size()));
+		for (const JSON& Element : Value.ArrayRange())
+		{
+			WriteJson(Out, Element);
+		}
+		break;
+	}
+	case JSON::Class::String:
+		AppendValue(Out, AddString(UnescapeJsonString(Value.ToString())));
+		break;
+	case JSON::Class::Floating:
+		AppendValue(Out, Value.ToFloat());
+		break;
+	case JSON::Class::Integral:
+		AppendValue(Out, static_cast<int64>(Value.ToInt()));
+		break;
+	case JSON::Class::Boolean:
+		Out.Add(Value.ToBool() ? 1 : 0);
+		break;
+	default:
+		break;
+	}
+}
+
+void FCookedLevelWriter::AddActor(const UClass* ActorClass, const JSON& ActorData)
+{
+	ActorClasses.Add(FindOrAddSchema(ActorClass));
+	ActorDataOffsets.Add(static_cast<uint32>(JsonData.Num()));
+	WriteJson(JsonData, ActorData);
+}
+
+void FCookedLevelWriter::SetLevelData(const JSON& LevelData)
+{
+	LevelDataOffset = static_cast<uint32>(JsonData.Num());
+	WriteJson(JsonData, LevelData);
+}
+
+void FCookedLevelWriter::SaveToBuffer(TArray<uint8>& OutBuffer)
+{
+	// 스키마의 클래스/필드 이름도 문자열 테이블에 들어가므로 문자열 섹션보다 먼저 만든다
+	TArray<uint8> SchemaSection;
+	for (const FClassSchema& Schema : Schemas)
+	{
+		FCookedClassEntry ClassEntry = { AddString(Schema.Class->Name), static_cast<uint32>(Schema.Fields.Num()), Schema.RecordSize };
+		AppendValue(SchemaSection, ClassEntry);
+		for (int32 FieldIndex = 0; FieldIndex < Schema.Fields.Num(); ++FieldIndex)
+		{
+			const FProperty& Prop = *Schema.Fields[FieldIndex];
+			FCookedFieldEntry FieldEntry = { AddString(Prop.Name), static_cast<uint32>(Prop.Type), Schema.FieldOffsets[FieldIndex] };
+			AppendValue(SchemaSection, FieldEntry);
+		}
+	}
+
+	TArray<uint8> StringSection;
+	{
+		uint32 StringOffset = static_cast<uint32>(Strings.Num() * sizeof(uint32));
+		for (const FString& String : Strings)
+		{
+			AppendValue(StringSection, StringOffset);
+			StringOffset += static_cast<uint32>(String.size() + 1);
+		}
+		for (const FString& String : Strings)
+		{
+			StringSection.insert(StringSection.end(), String.begin(), String.end());
+			StringSection.Add(0);
+		}
+	}
+
+	FCookedLevelHeader Header = {};
+	Header.Magic = FCookedLevel::Magic;
+	Header.Version = FCookedLevel::Version;
+	Header.StringCount = static_cast<uint32>(Strings.Num());
+	Header.ClassCount = static_cast<uint32>(Schemas.Num());
+	Header.RecordCount = static_cast<uint32>(RecordOffsets.Num());
+	Header.ActorCount = static_cast<uint32>(ActorClasses.Num());
+
+	uint32 Offset = sizeof(FCookedLevelHeader);
+	Header.StringTableOffset = Offset;	Offset += static_cast<uint32>(StringSection.Num());
+	Header.SchemaOffset = Offset;		Offset += static_cast<uint32>(SchemaSection.Num());
+	Header.RecordTableOffset = Offset;	Offset += static_cast<uint32>(RecordOffsets.Num() * sizeof(uint32));
+	const uint32 RecordDataOffset = Offset;	Offset += static_cast<uint32>(RecordData.Num());
+	Header.ActorTableOffset = Offset;	Offset += static_cast<uint32>(ActorClasses.Num() * sizeof(FCookedActorEntry));
+	const uint32 JsonDataOffset = Offset;	Offset += static_cast<uint32>(JsonData.Num());
+	Header.LevelDataOffset = (LevelDataOffset == UINT32_MAX) ? UINT32_MAX : JsonDataOffset + LevelDataOffset;
+	Header.FileSize = Offset;
+
+	OutBuffer.clear();
+	OutBuffer.Reserve(Header.FileSize);
+	AppendValue(OutBuffer, Header);
+	AppendBytes(OutBuffer, StringSection);
+	AppendBytes(OutBuffer, SchemaSection);
+	for (uint32 RecordOffset : RecordOffsets)
+	{
+		AppendValue(OutBuffer, RecordDataOffset + RecordOffset);
+	}
+	AppendBytes(OutBuffer, RecordData);
+	for (int32 ActorIndex = 0; ActorIndex < ActorClasses.Num(); ++ActorIndex)
+	{
+		FCookedActorEntry Entry = { ActorClasses[ActorIndex], JsonDataOffset + ActorDataOffsets[ActorIndex] };
+		AppendValue(OutBuffer, Entry);
+	}
+	AppendBytes(OutBuffer, JsonData);
+}
+
+bool FCookedLevelWriter::SaveToFile(const FWideString& FilePath)
+{
+	TArray<uint8> File;
+	SaveToBuffer(File);
+
+	std::ofstream Stream(std::filesystem::path(FilePath), std::ios::binary | std::ios::trunc);
+	if (!Stream.is_open())
+	{
+		return false;
+	}
+	Stream.write(reinterpret_cast<const char*>(File.GetData()), File.Num());
+	return Stream.good();
+}
+
+// ────────────────────────────────────────────────────────
+// FCookedLevelReader
+// ────────────────────────────────────────────────────────
+
+FCookedLevelReader* FCookedLevelReader::Active = nullptr;
+
+FCookedLevelReader::FCookedLevelReader()
+{
+}
+
+FCookedLevelReader::~FCookedLevelReader()
+{
+	Close();
+}
+
+bool FCookedLevelReader::Open(const FWideString& FilePath)
+{
+	Close();
+
+	HANDLE File = CreateFileW(FilePath.c_str(), GENERIC_READ, FILE_SHARE_READ, nullptr, OPEN_EXISTING, FILE_FLAG_SEQUENTIAL_SCAN, nullptr);
+	if (File == INVALID_HANDLE_VALUE)
+	{
+		return false;
+	}
+	FileHandle = File;
+
+	LARGE_INTEGER Size = {};
+	if (!GetFileSizeEx(File, &Size) || Size.QuadPart < static_cast<LONGLONG>(sizeof(FCookedLevelHeader)) || Size.QuadPart > UINT32_MAX)
+	{
+		Close();
+		return false;
+	}
+	FileSize = static_cast<uint32>(Size.QuadPart);
+
+	MappingHandle = CreateFileMappingW(File, nullptr, PAGE_READONLY, 0, 0, nullptr);
+	if (!MappingHandle)
+	{
+		Close();
+		return false;
+	}
+
+	const uint8* View = static_cast<const uint8*>(MapViewOfFile(MappingHandle, FILE_MAP_READ, 0, 0, 0));
+	if (!View)
+	{
+		Close();
+		return false;
+	}
+	MappedView = View;
+
+	return Initialize(View, FileSize);
+}
+
+bool FCookedLevelReader::OpenMemory(const uint8* InData, uint32 InSize)
+{
+	Close();
+
+	if (!InData || InSize < sizeof(FCookedLevelHeader))
+	{
+		return false;
+	}
+	return Initialize(InData, InSize);
+}
+
+bool FCookedLevelReader::Initialize(const uint8* InData, uint32 InSize)
+{
+	Data = InData;
+	FileSize = InSize;
+
+	const FCookedLevelHeader* Header = reinterpret_cast<const FCookedLevelHeader*>(Data);
+	if (Header->Magic != FCookedLevel::Magic || Header->Version != FCookedLevel::Version || Header->FileSize != FileSize)
+	{
+		UE_LOG("[CookedLevel] Invalid or outdated cooked level file");
+		Close();
+		return false;
+	}
+
+	// 테이블 범위 검사 (이후 접근은 검사 없이 오프셋을 그대로 사용)
+	const uint64 StringTableEnd = static_cast<uint64>(Header->StringTableOffset) + static_cast<uint64>(Header->StringCount) * sizeof(uint32);
+	const uint64 RecordTableEnd = static_cast<uint64>(Header->RecordTableOffset) + static_cast<uint64>(Header->RecordCount) * sizeof(uint32);
+	const uint64 ActorTableEnd = static_cast<uint64>(Header->ActorTableOffset) + static_cast<uint64>(Header->ActorCount) * sizeof(FCookedActorEntry);
+	if (StringTableEnd > FileSize || RecordTableEnd > FileSize || ActorTableEnd > FileSize)
+	{
+		UE_LOG("[CookedLevel] Corrupt cooked level file");
+		Close();
+		return false;
+	}
+
+	// 문자열은 매핑 메모리에서 그대로 참조하므로, 모든 문자열이 문자열 테이블 안에서 널 종료되는지 확인
+	// (테이블은 스키마 바로 앞에서 끝나고 마지막 바이트가 마지막 문자열의 널 문자)
+	const uint32* StringOffsets = reinterpret_cast<const uint32*>(Data + Header->StringTableOffset);
+	const uint64 StringTableSize = static_cast<uint64>(Header->SchemaOffset) - Header->StringTableOffset;
+	bool bValidStrings = Header->SchemaOffset <= FileSize && Header->SchemaOffset >= StringTableEnd;
+	if (bValidStrings && Header->StringCount > 0)
+	{
+		bValidStrings = Data[Header->SchemaOffset - 1] == 0;
+	}
+	for (uint32 StringIndex = 0; bValidStrings && StringIndex < Header->StringCount; ++StringIndex)
+	{
+		bValidStrings = StringOffsets[StringIndex] < StringTableSize;
+	}
+	if (!bValidStrings)
+	{
+		UE_LOG("[CookedLevel] Corrupt cooked level string table");
+		Close();
+		return false;
+	}
+
+	if (!ResolveSchemas())
+	{
+		Close();
+		return false;
+	}
+
+	assert(Active == nullptr && "Only one cooked level reader can be active");
+	Active = this;
+	return true;
+}
+
+void FCookedLevelReader::Close()
+{
+	if (Active == this)
+	{
+		Active = nullptr;
+	}
+
+	if (MappedView)
+	{
+		UnmapViewOfFile(MappedView);
+		MappedView = nullptr;
+	}
+	Data = nullptr;
+	if (MappingHandle)
+	{
+		CloseHandle(MappingHandle);
+		MappingHandle = nullptr;
+	}
+	if (FileHandle)
+	{
+		CloseHandle(FileHandle);
+		FileHandle = nullptr;
+	}
+	FileSize = 0;
+	Classes.Empty();
+}
+
+const char* FCookedLevelReader::GetString(uint32 Index) const
+{
+	const FCookedLevelHeader* Header = reinterpret_cast<const FCookedLevelHeader*>(Data);
+	if (Index >= Header->StringCount)
+	{
+		return "";
+	}
+	const uint32* StringOffsets = reinterpret_cast<const uint32*>(Data + Header->StringTableOffset);
+	return reinterpret_cast<const char*>(Data + Header->StringTableOffset + StringOffsets[Index]);
+}
+
+bool FCookedLevelReader::ResolveSchemas()
+{
+	const FCookedLevelHeader* Header = reinterpret_cast<const FCookedLevelHeader*>(Data);
+
+	uint32 Offset = Header->SchemaOffset;
+	Classes.SetNum(Header->ClassCount);
+	for (uint32 ClassIndex = 0; ClassIndex < Header->ClassCount; ++ClassIndex)
+	{
+		FCookedClassEntry ClassEntry;
+		if (!ReadValue(Offset, ClassEntry))
+		{
+			return false;
+		}
+
+		FResolvedClass& Resolved = Classes[ClassIndex];
+		Resolved.Class = UClass::FindClass(GetString(ClassEntry.NameIndex));
+		Resolved.RecordSize = ClassEntry.RecordSize;
+		if (!Resolved.Class)
+		{
+			UE_LOG("[CookedLevel] Unknown class '%s', recook the level", GetString(ClassEntry.NameIndex));
+			return false;
+		}
+
+		// 쿡 이후 프로퍼티 순서/오프셋이 바뀌었을 수 있으므로 이름과 타입으로 다시 매칭
+		const TArray<FProperty>& Properties = Resolved.Class->GetAllProperties();
+		for (uint32 FieldIndex = 0; FieldIndex < ClassEntry.FieldCount; ++FieldIndex)
+		{
+			FCookedFieldEntry FieldEntry;
+			if (!ReadValue(Offset, FieldEntry))
+			{
+				return false;
+			}
+
+			const EPropertyType Type = static_cast<EPropertyType>(FieldEntry.Type);
+			if (FieldEntry.RecordOffset + GetRecordFieldSize(Type) > ClassEntry.RecordSize)
+			{
+				return false;
+			}
+
+			const char* FieldName = GetString(FieldEntry.NameIndex);
+			for (const FProperty& Prop : Properties)
+			{
+				if (Prop.Type == Type && std::strcmp(Prop.Name, FieldName) == 0)
+				{
+					Resolved.Fields.Add({ Type, FieldEntry.RecordOffset, Prop.Offset });
+					break;
+				}
+			}
+		}
+	}
+	return true;
+}
+
+uint32 FCookedLevelReader::GetActorCount() const
+{
+	return Data ? reinterpret_cast<const FCookedLevelHeader*>(Data)->ActorCount : 0;
+}
+
+uint32 FCookedLevelReader::GetRecordCount() const
+{
+	return Data ? reinterpret_cast<const FCookedLevelHeader*>(Data)->RecordCount : 0;
+}
+
+UClass* FCookedLevelReader::GetActorClass(uint32 ActorIndex) const
+{
+	const FCookedLevelHeader* Header = reinterpret_cast<const FCookedLevelHeader*>(Data);
+	const FCookedActorEntry* Entries = reinterpret_cast<const FCookedActorEntry*>(Data + Header->ActorTableOffset);
+	const uint32 ClassIndex = Entries[ActorIndex].ClassIndex;
+	return ClassIndex < static_cast<uint32>(Classes.Num()) ? Classes[ClassIndex].Class : nullptr;
+}
+
+bool FCookedLevelReader::ReadActorData(uint32 ActorIndex, JSON& OutData) const
+{
+	const FCookedLevelHeader* Header = reinterpret_cast<const FCookedLevelHeader*>(Data);
+	const FCookedActorEntry* Entries = reinterpret_cast<const FCookedActorEntry*>(Data + Header->ActorTableOffset);
+	uint32 Offset = Entries[ActorIndex].DataOffset;
+	return ReadJson(Offset, OutData, 0);
+}
+
+bool FCookedLevelReader::ReadLevelData(JSON& OutData) const
+{
+	const FCookedLevelHeader* Header = reinterpret_cast<const FCookedLevelHeader*>(Data);
+	if (Header->LevelDataOffset == UINT32_MAX)
+	{
+		return false;
+	}
+	uint32 Offset = Header->LevelDataOffset;
+	return ReadJson(Offset, OutData, 0);
+}
+
+bool FCookedLevelReader::ReadJson(uint32& InOutOffset, JSON& OutValue, int32 Depth) const
+{
+	uint8 Tag;
+	if (Depth > MaxJsonDepth || !ReadValue(InOutOffset, Tag))
+	{
+		return false;
+	}
+
+	switch (static_cast<ECookedJsonTag>(Tag))
+	{
+	case ECookedJsonTag::Null:
+		OutValue = JSON();
+		return true;
+	case ECookedJsonTag::Object:
+	{
+		uint32 Count;
+		if (!ReadValue(InOutOffset, Count))
+		{
+			return false;
+		}
+		OutValue = JSON::Make(JSON::Class::Object);
+		for (uint32 i = 0; i < Count; ++i)
+		{
+			uint32 KeyIndex;
+			if (!ReadValue(InOutOffset, KeyIndex) || !ReadJson(InOutOffset, OutValue[GetString(KeyIndex)], Depth + 1))
+			{
+				return false;
+			}
+		}
+		return true;
+	}
+	case ECookedJsonTag::Array:
+	{
+		uint32 Count;
+		if (!ReadValue(InOutOffset, Count))
+		{
+			return false;
+		}
+		OutValue = JSON::Make(JSON::Class::Array);
+		for (uint32 i = 0; i < Count; ++i)
+		{
+			if (!ReadJson(InOutOffset, OutValue[static_cast<unsigned>(i)], Depth + 1))
+			{
+				return false;
+			}
+		}
+		return true;
+	}
+	case ECookedJsonTag::String:
+	{
+		uint32 StringIndex;
+		if (!ReadValue(InOutOffset, StringIndex))
+		{
+			return false;
+		}
+		OutValue = GetString(StringIndex);
+		return true;
+	}
+	case ECookedJsonTag::Floating:
+	{
+		double Value;
+		if (!ReadValue(InOutOffset, Value))
+		{
+			return false;
+		}
+		OutValue = Value;
+		return true;
+	}
+	case ECookedJsonTag::Integral:
+	{
+		int64 Value;
+		if (!ReadValue(InOutOffset, Value))
+		{
+			return false;
+		}
+		OutValue = static_cast<long>(Value);
+		return true;
+	}
+	case ECookedJsonTag::Boolean:
+	{
+		uint8 Value;
+		if (!ReadValue(InOutOffset, Value))
+		{
+			return false;
+		}
+		OutValue = (Value != 0);
+		return true;
+	}
+	default:
+		return false;
+	}
+}
+
+bool FCookedLevelReader::ApplyObjectRecord(UObject* Object, uint32 RecordIndex) const
+{
+	const FCookedLevelHeader* Header = reinterpret_cast<const FCookedLevelHeader*>(Data);
+	if (!Data || RecordIndex >= Header->RecordCount)
+	{
+		return false;
+	}
+
+	const uint32* RecordOffsets = reinterpret_cast<const uint32*>(Data + Header->RecordTableOffset);
+	uint32 Offset = RecordOffsets[RecordIndex];
+	uint32 ClassIndex;
+	if (!ReadValue(Offset, ClassIndex) || ClassIndex >= static_cast<uint32>(Classes.Num()))
+	{
+		return false;
+	}
+
+	const FResolvedClass& Resolved = Classes[ClassIndex];
+	if (Resolved.Class != Object->GetClass() || static_cast<uint64>(Offset) + Resolved.RecordSize > FileSize)
+	{
+		return false;
+	}
+
+	const uint8* Record = Data + Offset;
+	uint8* ObjectBytes = reinterpret_cast<uint8*>(Object);
+
+	for (const FResolvedField& Field : Resolved.Fields)
+	{
+		const uint8* Src = Record + Field.RecordOffset;
+		void* Dst = ObjectBytes + Field.ObjectOffset;
+
+		switch (Field.Type)
+		{
+		case EPropertyType::Bool:
+			*static_cast<bool*>(Dst) = (*Src != 0);
+			break;
+		case EPropertyType::Enum:
+			*static_cast<uint8*>(Dst) = *Src;
+			break;
+		case EPropertyType::FString:
+		case EPropertyType::ScriptFile:
+		case EPropertyType::FName:
+		case EPropertyType::Texture:
+		case EPropertyType::StaticMesh:
+		case EPropertyType::SkeletalMesh:
+		case EPropertyType::Material:
+		{
+			uint32 StringIndex;
+			memcpy(&StringIndex, Src, sizeof(uint32));
+			const char* String = GetString(StringIndex);
+
+			switch (Field.Type)
+			{
+			case EPropertyType::FString:
+			case EPropertyType::ScriptFile:
+				*static_cast<FString*>(Dst) = String;
+				break;
+			case EPropertyType::FName:
+				if (Dst == &Object->ObjectName)
+				{
+					Object->SetName(FName(String));
+				}
+				else
+				{
+					*static_cast<FName*>(Dst) = FName(String);
+				}
+				break;
+			case EPropertyType::Texture:
+				*static_cast<UTexture**>(Dst) = String[0] ? UResourceManager::GetInstance().Load<UTexture>(String) : nullptr;
+				break;
+			case EPropertyType::StaticMesh:
+				*static_cast<UStaticMesh**>(Dst) = String[0] ? UResourceManager::GetInstance().Load<UStaticMesh>(String) : nullptr;
+				break;
+			case EPropertyType::SkeletalMesh:
+				*static_cast<USkeletalMesh**>(Dst) = String[0] ? UResourceManager::GetInstance().Load<USkeletalMesh>(String) : nullptr;
+				break;
+			case EPropertyType::Material:
+				*static_cast<UMaterial**>(Dst) = String[0] ? UResourceManager::GetInstance().Load<UMaterial>(String) : nullptr;
+				break;
+			default:
+				break;
+			}
+			break;
+		}
+		default:
+			memcpy(Dst, Src, GetRecordFieldSize(Field.Type));
+			break;
+		}
+	}
+	return true;
+}
+
+void FCookedLevelReader::PrefetchAssets() const
+{
+	if (!Data)
+	{
+		return;
+	}
+
+	const FCookedLevelHeader* Header = reinterpret_cast<const FCookedLevelHeader*>(Data);
+	const uint32* RecordOffsets = reinterpret_cast<const uint32*>(Data + Header->RecordTableOffset);
+	UResourceManager& ResourceManager = UResourceManager::GetInstance();
+
+	for (uint32 RecordIndex = 0; RecordIndex < Header->RecordCount; ++RecordIndex)
+	{
+		uint32 Offset = RecordOffsets[RecordIndex];
+		uint32 ClassIndex;
+		if (!ReadValue(Offset, ClassIndex) || ClassIndex >= static_cast<uint32>(Classes.Num()))
+		{
+			continue;
+		}
+
+		const FResolvedClass& Resolved = Classes[ClassIndex];
+		if (static_cast<uint64>(Offset) + Resolved.RecordSize > FileSize)
+		{
+			continue;
+		}
+
+		const uint8* Record = Data + Offset;
+		for (const FResolvedField& Field : Resolved.Fields)
+		{
+			if (Field.Type != EPropertyType::Texture && Field.Type != EPropertyType::StaticMesh && Field.Type != EPropertyType::SkeletalMesh)
+			{
+				continue;
+			}
+
+			uint32 StringIndex;
+			memcpy(&StringIndex, Record + Field.RecordOffset, sizeof(uint32));
+			const char* String = GetString(StringIndex);
+			if (!String[0])
+			{
+				continue;
+			}
+
+			// 이미 로드된 에셋과 같은 경로의 중복 참조는 LoadAsync 안에서 걸러진다
+			// 결과는 뒤따르는 동기 로드가 가져가므로 핸들은 바로 놓는다 (실패 기록이 남지 않게)
+			FAssetLoadHandle Handle;
+			switch (Field.Type)
+			{
+			case EPropertyType::Texture:
+				Handle = ResourceManager.LoadAsync<UTexture>(String, EAssetLoadPriority::High);
+				break;
+			case EPropertyType::StaticMesh:
+				Handle = ResourceManager.LoadAsync<UStaticMesh>(String, EAssetLoadPriority::High);
+				break;
+			case EPropertyType::SkeletalMesh:
+				Handle = ResourceManager.LoadAsync<USkeletalMesh>(String, EAssetLoadPriority::High);
+				break;
+			default:
+				break;
+			}
+			ResourceManager.ReleaseAsyncLoad(Handle);
+		}
+	}
+}
@@ -0,0 +1,184 @@
+﻿#pragma once
+#include "UEContainer.h"
+#include "Property.h"
+
+class UObject;
+struct UClass;
+namespace json { class JSON; }
+using JSON = json::JSON;
+
+/**
+ * 쿡 레벨 파일 (.cscene)
+ *
+ * JSON .scene은 에디터 원본으로 유지하고, 쿡 단계에서 아래 바이너리 포맷으로 변환합니다.
+ * - 문자열 테이블: 프로퍼티 이름, 리소스 경로, JSON 키를 한 번씩만 저장 (널 종료, 매핑된 메모리에서 그대로 참조)
+ * - 클래스 스키마: UClass마다 레코드로 저장하는 단순 프로퍼티 목록 (이름, 타입, 레코드 내 오프셋)
+ * - 오브젝트 레코드: 스키마 순서대로 값이 붙어 있는 고정 크기 블록, 파일 안에 연속 배치
+ * - 잔여 데이터: 레코드로 표현하지 않는 값(컴포넌트 목록, 배열, 서브 오브젝트, 클래스별 수동 직렬화 키)은
+ *   바이너리 JSON 트리로 저장해 기존 Serialize 경로로 적용
+ *
+ * 로드 시 파일을 메모리 매핑하고, 레코드 값을 현재 UClass의 프로퍼티 오프셋에 바로 복사합니다.
+ * 스키마는 이름/타입으로 현재 클래스와 다시 매칭하므로 프로퍼티 순서나 오프셋이 바뀌어도 읽을 수 있고,
+ * 사라진 프로퍼티는 건너뜁니다.
+ */
+namespace FCookedLevel
+{
+	constexpr uint32 Magic = 0x564C434D;	// "MCLV"
+	constexpr uint32 Version = 1;
+
+	// 잔여 JSON에서 오브젝트 레코드 인덱스를 가리키는 키 (프로퍼티 이름과 겹치지 않음)
+	constexpr const char* RecordKey = "@Record";
+
+	// .scene 경로 -> 같은 폴더의 .cscene 경로
+	FWideString GetCookedPath(const FWideString& ScenePath);
+
+	// 쿡 파일이 있고 원본 .scene보다 최신이면 true
+	bool IsCookedUpToDate(const FWideString& ScenePath, const FWideString& CookedPath);
+
+	// 레코드(고정 오프셋 값)로 저장하는 프로퍼티 타입인지
+	bool IsRecordProperty(EPropertyType Type);
+
+	/**
+	 * UObject::Serialize에서 호출
+	 * 쿡 저장/로드 중이면 이 오브젝트의 레코드 프로퍼티를 레코드로 쓰거나 적용하고 true를 반환합니다.
+	 * true면 호출자는 IsRecordProperty인 프로퍼티를 JSON으로 처리하지 않아야 합니다.
+	 */
+	bool SerializeObjectRecord(UObject* Object, bool bIsLoading, JSON& InOutHandle);
+
+	// 쿡 단계: .scene(JSON)을 임시 레벨로 읽어 같은 위치의 .cscene으로 저장 (콘솔 "COOK LEVEL")
+	bool CookScene(const FWideString& ScenePath, int32* OutActorCount = nullptr);
+}
+
+// 쿡 파일 작성기. 살아 있는 동안 UObject::Serialize(false)가 레코드를 이 작성기로 보냄
+class FCookedLevelWriter
+{
+public:
+	FCookedLevelWriter();
+	~FCookedLevelWriter();
+
+	FCookedLevelWriter(const FCookedLevelWriter&) = delete;
+	FCookedLevelWriter& operator=(const FCookedLevelWriter&) = delete;
+
+	static FCookedLevelWriter* GetActive() { return Active; }
+
+	// 오브젝트의 레코드 프로퍼티 값을 레코드로 추가하고 레코드 인덱스 반환
+	uint32 WriteObjectRecord(const UObject* Object);
+
+	// 액터 하나 추가 (ActorData는 Actor->Serialize(false, ...)의 결과)
+	void AddActor(const UClass* ActorClass, const JSON& ActorData);
+
+	// 레벨 자체 데이터 (에디터 카메라 등)
+	void SetLevelData(const JSON& LevelData);
+
+	// 파일 없이 메모리 스냅샷으로 쓸 때 (PIE 월드 복제)
+	void SaveToBuffer(TArray<uint8>& OutBuffer);
+	bool SaveToFile(const FWideString& FilePath);
+
+	uint32 GetRecordCount() const { return static_cast<uint32>(RecordOffsets.Num()); }
+
+private:
+	struct FClassSchema
+	{
+		const UClass* Class = nullptr;
+		TArray<const FProperty*> Fields;
+		TArray<uint32> FieldOffsets;
+		uint32 RecordSize = 0;
+	};
+
+	uint32 AddString(const FString& String);
+	uint32 FindOrAddSchema(const UClass* Class);
+	void WriteJson(TArray<uint8>& Out, const JSON& Value);
+
+private:
+	static FCookedLevelWriter* Active;
+
+	TArray<FString> Strings;
+	TMap<FString, uint32> StringToIndex;
+
+	TArray<FClassSchema> Schemas;
+	TMap<const UClass*, uint32> ClassToSchema;
+
+	TArray<uint8> RecordData;		// 레코드 블록 (연속)
+	TArray<uint32> RecordOffsets;	// 레코드 인덱스 -> RecordData 내 오프셋
+
+	TArray<uint8> JsonData;			// 액터/레벨 잔여 데이터 (바이너리 JSON)
+	TArray<uint32> ActorClasses;	// 액터 -> 스키마 인덱스
+	TArray<uint32> ActorDataOffsets;	// 액터 -> JsonData 내 오프셋
+	uint32 LevelDataOffset = UINT32_MAX;
+};
+
+// 쿡 파일 읽기. Open 후 살아 있는 동안 UObject::Serialize(true)가 레코드를 이 리더에서 적용
+class FCookedLevelReader
+{
+public:
+	FCookedLevelReader();
+	~FCookedLevelReader();
+
+	FCookedLevelReader(const FCookedLevelReader&) = delete;
+	FCookedLevelReader& operator=(const FCookedLevelReader&) = delete;
+
+	static FCookedLevelReader* GetActive() { return Active; }
+
+	// 파일을 매핑하고 헤더/스키마를 검증. 현재 빌드에 없는 클래스가 있으면 실패
+	bool Open(const FWideString& FilePath);
+
+	// SaveToBuffer로 만든 메모리 스냅샷을 연다 (버퍼는 Close 전까지 유지되어야 함)
+	bool OpenMemory(const uint8* InData, uint32 InSize);
+	void Close();
+
+	uint32 GetActorCount() const;
+	uint32 GetRecordCount() const;
+	UClass* GetActorClass(uint32 ActorIndex) const;
+	bool ReadActorData(uint32 ActorIndex, JSON& OutData) const;
+	bool ReadLevelData(JSON& OutData) const;
+
+	// 레코드 값을 오브젝트 프로퍼티에 적용 (레코드 클래스와 오브젝트 클래스가 다르면 false)
+	bool ApplyObjectRecord(UObject* Object, uint32 RecordIndex) const;
+
+	// 레코드가 참조하는 텍스처/메시를 비동기 로드로 미리 요청
+	// 액터 생성 중 동기 Load는 진행 중인 요청을 이어받으므로, 나머지 에셋은 그동안 워커에서 병렬로 읽힌다
+	void PrefetchAssets() const;
+
+private:
+	struct FResolvedField
+	{
+		EPropertyType Type;
+		uint32 RecordOffset;
+		size_t ObjectOffset;
+	};
+
+	struct FResolvedClass
+	{
+		UClass* Class = nullptr;
+		uint32 RecordSize = 0;
+		TArray<FResolvedField> Fields;
+	};
+
+	bool Initialize(const uint8* InData, uint32 InSize);
+	bool ResolveSchemas();
+	const char* GetString(uint32 Index) const;
+	bool ReadJson(uint32& InOutOffset, JSON& OutValue, int32 Depth) const;
+
+	template<typename T>
+	bool ReadValue(uint32& InOutOffset, T& OutValue) const
+	{
+		if (InOutOffset + sizeof(T) > FileSize)
+		{
+			return false;
+		}
+		memcpy(&OutValue, Data + InOutOffset, sizeof(T));
+		InOutOffset += sizeof(T);
+		return true;
+	}
+
+private:
+	static FCookedLevelReader* Active;
+
+	void* FileHandle = nullptr;
+	void* MappingHandle = nullptr;
+	const void* MappedView = nullptr;		// 파일 매핑일 때만 (메모리 스냅샷은 nullptr)
+	const uint8* Data = nullptr;
+	uint32 FileSize = 0;
+
+	TArray<FResolvedClass> Classes;
+};
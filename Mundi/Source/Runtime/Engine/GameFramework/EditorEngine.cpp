@@ -7,6 +7,8 @@
 #include <ObjManager.h>
 #include "GameModeBase.h"
 #include "Source/Runtime/Engine/Particle/ParticleSystemComponent.h"
+#include "PlatformTime.h"
+#include "Profiler.h"
 
 
 float UEditorEngine::ClientWidth = 1024.0f;
@@ -178,6 +180,9 @@ bool UEditorEngine::CreateMainWindow(HINSTANCE hInstance)
 
 bool UEditorEngine::Startup(HINSTANCE hInstance)
 {
+    // 콘솔 위젯 로그 싱크 등록 (위젯 생성 전 로그도 보관했다가 출력)
+    UGlobalConsole::Initialize();
+
     LoadIniFile();
 
     if (!CreateMainWindow(hInstance))
@@ -218,9 +223,13 @@ bool UEditorEngine::Startup(HINSTANCE hInstance)
 
 void UEditorEngine::Tick(float DeltaSeconds)
 {
+    PROFILE_SCOPE("EngineTick");
     //@TODO UV 스크롤 입력 처리 로직 이동
     HandleUVInput(DeltaSeconds);
 
+    // 워커가 읽어 둔 비동기 로드를 월드 틱 전에 마무리 (완료 콜백이 이번 프레임에 반영되도록)
+    RESOURCE.ProcessAsyncLoads();
+
     //@TODO: Delta Time 계산 + EditorActor Tick은 어떻게 할 것인가
     for (auto& WorldContext : WorldContexts)
     {
@@ -237,12 +246,16 @@ void UEditorEngine::Tick(float DeltaSeconds)
     }
 
     SLATE.Update(DeltaSeconds);
+
+    // 로그 스레드가 포맷팅한 로그를 콘솔 위젯으로 전달
+    UGlobalConsole::FlushPendingLogs();
     UI.Update(DeltaSeconds);
     INPUT.Update();
 }
 
 void UEditorEngine::Render()
 {
+    PROFILE_SCOPE("EngineRender");
     Renderer->BeginFrame();
 
     UI.Render();
@@ -283,8 +296,10 @@ void UEditorEngine::MainLoop()
 
     MSG msg;
 
+    FProfiler::SetThreadName("GameThread");
     while (bRunning)
     {
+        PROFILE_FRAME();
         TriggerRandomMemoryFaultWhenFlagIsOn();
         
         QueryPerformanceCounter(&CurrTime);
@@ -386,6 +401,9 @@ void UEditorEngine::Shutdown()
     RHIDevice.Release();
 
     SaveIniFile();
+
+    // 로그 스레드 종료 (남은 로그 출력)
+    UGlobalConsole::Shutdown();
 }
 
 
@@ -405,7 +423,11 @@ void UEditorEngine::StartPIE()
         }
     }
 
+    // time-to-PIE: 월드 복제부터 BeginPlay 완료까지
+    const uint64 StartCycles = FPlatformTime::Cycles64();
+
     UWorld* PIEWorld = UWorld::DuplicateWorldForPIE(EditorWorld);
+    const uint64 DuplicateEndCycles = FPlatformTime::Cycles64();
 
     GWorld = PIEWorld;
     SLATE.SetPIEWorld(GWorld);  // SLATE의 카메라를 가져와서 설정, TODO: 추후 월드의 카메라 컴포넌트를 가져와서 설정하도록 변경 필요
@@ -422,6 +444,14 @@ void UEditorEngine::StartPIE()
 
     // NOTE: BeginPlay 중에 삭제된 액터 삭제 후 Tick 시작
     GWorld->ProcessPendingKillActors();
+
+    const uint64 EndCycles = FPlatformTime::Cycles64();
+    UE_LOG("[info] PIE ready (%s): %.2f ms (duplicate %.2f ms, BeginPlay %.2f ms, %d actors)",
+        UWorld::IsPIESnapshotDuplication() ? "snapshot" : "duplicate",
+        FPlatformTime::ToMilliseconds(EndCycles - StartCycles),
+        FPlatformTime::ToMilliseconds(DuplicateEndCycles - StartCycles),
+        FPlatformTime::ToMilliseconds(EndCycles - DuplicateEndCycles),
+        static_cast<int32>(LevelActors.Num()));
 }
 
 void UEditorEngine::EndPIE()
@@ -8,6 +8,7 @@
 #include "FAudioDevice.h"
 #include <sol/sol.hpp>
 #include "GameModeBase.h"
+#include "Profiler.h"
 
 float UGameEngine::ClientWidth = 1024.0f;
 float UGameEngine::ClientHeight = 1024.0f;
@@ -227,9 +228,13 @@ bool UGameEngine::Startup(HINSTANCE hInstance)
 
 void UGameEngine::Tick(float DeltaSeconds)
 {
+    PROFILE_SCOPE("EngineTick");
     //@TODO UV 스크롤 입력 처리 로직 이동
     HandleUVInput(DeltaSeconds);
 
+    // 워커가 읽어 둔 비동기 로드를 월드 틱 전에 마무리 (완료 콜백이 이번 프레임에 반영되도록)
+    RESOURCE.ProcessAsyncLoads();
+
     for (auto& WorldContext : WorldContexts)
     {
         WorldContext.World->Tick(DeltaSeconds);
@@ -239,6 +244,7 @@ void UGameEngine::Tick(float DeltaSeconds)
 
 void UGameEngine::Render()
 {
+    PROFILE_SCOPE("EngineRender");
     Renderer->BeginFrame();
 
     if (GWorld)
@@ -292,8 +298,10 @@ void UGameEngine::MainLoop()
 
     MSG msg;
 
+    FProfiler::SetThreadName("GameThread");
     while (bRunning)
     {
+        PROFILE_FRAME();
         QueryPerformanceCounter(&CurrTime);
         float DeltaSeconds = static_cast<float>((CurrTime.QuadPart - PrevTime.QuadPart) / double(Frequency.QuadPart));
         PrevTime = CurrTime;
@@ -351,4 +359,10 @@ void UGameEngine::Shutdown()
     RHIDevice.Release();
 
     SaveIniFile();
+
+    // 로그 스레드 종료 (남은 로그 출력). 한 번도 로그를 남기지 않았으면 로거를 새로 만들지 않는다.
+    if (FAsyncLog::IsInitialized())
+    {
+        FAsyncLog::Get().Shutdown();
+    }
 }
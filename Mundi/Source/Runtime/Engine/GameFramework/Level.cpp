@@ -11,6 +11,7 @@
 #include "AmbientLightComponent.h"
 #include "World.h"
 #include "JsonSerializer.h"
+#include "CookedLevel.h"
 #include "Source/Runtime/Engine/Particle/ParticleSystemComponent.h"
 
 static inline FString RemoveObjExtension(const FString& FileName)
@@ -54,44 +55,10 @@ void ULevel::Serialize(const bool bInIsLoading, JSON& InOutHandle)
 {
     Super::Serialize(bInIsLoading, InOutHandle);
 
-    struct FPerspectiveCameraData
-    {
-        FVector Location;
-        FVector Rotation;
-        float FOV;
-        float NearClip;
-        float FarClip;
-    };
-
     if (bInIsLoading)
     {
         // 카메라 정보
-        JSON PerspectiveCameraData;
-        if (FJsonSerializer::ReadObject(InOutHandle, "PerspectiveCamera", PerspectiveCameraData))
-        {
-            // 카메라 정보
-            ACameraActor* CamActor = GWorld->GetEditorCameraActor();
-            FPerspectiveCameraData CamData;
-            if (CamActor)
-            {
-                // ReadObject 유틸리티 함수로 해당 뷰포트의 JSON 데이터를 안전하게 가져옴
-                // 유틸리티 함수를 사용하여 반복적인 검사 없이 간결하게 데이터 파싱
-                // 실패 시 각 함수 내부에서 로그를 남기고 기본값을 할당함
-                FJsonSerializer::ReadVector(PerspectiveCameraData, "Location", CamData.Location);
-                FJsonSerializer::ReadVector(PerspectiveCameraData, "Rotation", CamData.Rotation);
-                FJsonSerializer::ReadArrayFloat(PerspectiveCameraData, "FOV", CamData.FOV);
-                FJsonSerializer::ReadArrayFloat(PerspectiveCameraData, "NearClip", CamData.NearClip);
-                FJsonSerializer::ReadArrayFloat(PerspectiveCameraData, "FarClip", CamData.FarClip);
-
-                CamActor->SetActorLocation(CamData.Location);
-                CamActor->SetRotationFromEulerAngles(CamData.Rotation);
-                if (auto* CamComp = CamActor->GetCameraComponent())
-                {
-                    CamComp->SetFOV(CamData.FOV);
-                    CamComp->SetClipPlanes(CamData.NearClip, CamData.FarClip);
-                }
-            }
-        }
+        SerializePerspectiveCamera(bInIsLoading, InOutHandle);
 
         // Actors 정보
         JSON ActorListJson;
@@ -136,16 +103,7 @@ void ULevel::Serialize(const bool bInIsLoading, JSON& InOutHandle)
             }
 
             // 씬 로드 후 ParticleSystemComponent들 활성화
-            for (AActor* Actor : Actors)
-            {
-                if (UParticleSystemComponent* PSC = Cast<UParticleSystemComponent>(Actor->GetComponent(UParticleSystemComponent::StaticClass())))
-                {
-                    if (PSC->GetTemplate())
-                    {
-                        PSC->Activate(true);
-                    }
-                }
-            }
+            ActivateParticleSystems();
         }
     }
     else
@@ -155,6 +113,143 @@ void ULevel::Serialize(const bool bInIsLoading, JSON& InOutHandle)
         InOutHandle["NextUUID"] = UObject::PeekNextUUID();
 
         // 카메라 정보
+        SerializePerspectiveCamera(bInIsLoading, InOutHandle);
+
+        // Actors 정보
+        JSON ActorListJson = json::Object();
+        for (AActor* Actor : Actors)
+        {
+            JSON ActorJson = json::Object();
+            ActorJson["Type"] = Actor->GetClass()->Name;
+
+            Actor->Serialize(bInIsLoading, ActorJson);
+
+            ActorListJson[std::to_string(Actor->UUID)] = ActorJson;
+        }
+        InOutHandle["Actors"] = ActorListJson;
+    }
+}
+
+bool ULevel::SaveCooked(const FWideString& InFilePath)
+{
+    FCookedLevelWriter Writer;
+    WriteCookedActors(Writer);
+
+    JSON LevelJson = json::Object();
+    SerializePerspectiveCamera(false, LevelJson);
+    Writer.SetLevelData(LevelJson);
+
+    return Writer.SaveToFile(InFilePath);
+}
+
+bool ULevel::LoadCooked(const FWideString& InFilePath)
+{
+    FCookedLevelReader Reader;
+    if (!Reader.Open(InFilePath))
+    {
+        return false;
+    }
+
+    JSON LevelJson;
+    if (Reader.ReadLevelData(LevelJson))
+    {
+        SerializePerspectiveCamera(true, LevelJson);
+    }
+
+    Reader.PrefetchAssets();
+    ReadCookedActors(Reader);
+    return true;
+}
+
+void ULevel::WriteCookedActors(FCookedLevelWriter& Writer)
+{
+    // 액터/컴포넌트의 단순 프로퍼티는 UObject::Serialize가 Writer에 레코드로 기록하고,
+    // 나머지(컴포넌트 목록, 클래스별 수동 직렬화 키)만 JSON으로 남는다
+    for (AActor* Actor : Actors)
+    {
+        JSON ActorJson = json::Object();
+        Actor->Serialize(false, ActorJson);
+        Writer.AddActor(Actor->GetClass(), ActorJson);
+    }
+}
+
+void ULevel::ReadCookedActors(const FCookedLevelReader& Reader)
+{
+    const uint32 ActorCount = Reader.GetActorCount();
+    Actors.Reserve(Actors.Num() + ActorCount);
+    for (uint32 ActorIndex = 0; ActorIndex < ActorCount; ++ActorIndex)
+    {
+        UClass* ActorClass = Reader.GetActorClass(ActorIndex);
+        if (!ActorClass || !ActorClass->IsChildOf(AActor::StaticClass()))
+        {
+            UE_LOG("[CookedLevel] Invalid actor class at index %u", ActorIndex);
+            continue;
+        }
+
+        JSON ActorJson;
+        if (!Reader.ReadActorData(ActorIndex, ActorJson))
+        {
+            UE_LOG("[CookedLevel] Corrupt actor data at index %u", ActorIndex);
+            continue;
+        }
+
+        AActor* NewActor = Cast<AActor>(ObjectFactory::NewObject(ActorClass));
+        if (!NewActor)
+        {
+            continue;
+        }
+
+        AddActor(NewActor);
+
+        // 레코드 키가 있는 오브젝트는 UObject::Serialize에서 Reader의 레코드가 바로 적용됨
+        NewActor->Serialize(true, ActorJson);
+    }
+
+    ActivateParticleSystems();
+}
+
+void ULevel::SerializePerspectiveCamera(const bool bInIsLoading, JSON& InOutHandle)
+{
+    struct FPerspectiveCameraData
+    {
+        FVector Location;
+        FVector Rotation;
+        float FOV;
+        float NearClip;
+        float FarClip;
+    };
+
+    if (bInIsLoading)
+    {
+        JSON PerspectiveCameraData;
+        if (FJsonSerializer::ReadObject(InOutHandle, "PerspectiveCamera", PerspectiveCameraData))
+        {
+            // 카메라 정보
+            ACameraActor* CamActor = GWorld->GetEditorCameraActor();
+            FPerspectiveCameraData CamData;
+            if (CamActor)
+            {
+                // ReadObject 유틸리티 함수로 해당 뷰포트의 JSON 데이터를 안전하게 가져옴
+                // 유틸리티 함수를 사용하여 반복적인 검사 없이 간결하게 데이터 파싱
+                // 실패 시 각 함수 내부에서 로그를 남기고 기본값을 할당함
+                FJsonSerializer::ReadVector(PerspectiveCameraData, "Location", CamData.Location);
+                FJsonSerializer::ReadVector(PerspectiveCameraData, "Rotation", CamData.Rotation);
+                FJsonSerializer::ReadArrayFloat(PerspectiveCameraData, "FOV", CamData.FOV);
+                FJsonSerializer::ReadArrayFloat(PerspectiveCameraData, "NearClip", CamData.NearClip);
+                FJsonSerializer::ReadArrayFloat(PerspectiveCameraData, "FarClip", CamData.FarClip);
+
+                CamActor->SetActorLocation(CamData.Location);
+                CamActor->SetRotationFromEulerAngles(CamData.Rotation);
+                if (auto* CamComp = CamActor->GetCameraComponent())
+                {
+                    CamComp->SetFOV(CamData.FOV);
+                    CamComp->SetClipPlanes(CamData.NearClip, CamData.FarClip);
+                }
+            }
+        }
+    }
+    else
+    {
         const ACameraActor* Camera = GWorld->GetEditorCameraActor();
         FPerspectiveCameraData CamData;
         if (Camera && Camera->GetCameraComponent())
@@ -177,18 +272,19 @@ void ULevel::Serialize(const bool bInIsLoading, JSON& InOutHandle)
         CamreaJson["FOV"] = FJsonSerializer::FloatToArrayJson(CamData.FOV);
 
         InOutHandle["PerspectiveCamera"] = CamreaJson;
+    }
+}
 
-        // Actors 정보
-        JSON ActorListJson = json::Object();
-        for (AActor* Actor : Actors)
+void ULevel::ActivateParticleSystems()
+{
+    for (AActor* Actor : Actors)
+    {
+        if (UParticleSystemComponent* PSC = Cast<UParticleSystemComponent>(Actor->GetComponent(UParticleSystemComponent::StaticClass())))
         {
-            JSON ActorJson = json::Object();
-            ActorJson["Type"] = Actor->GetClass()->Name;
-
-            Actor->Serialize(bInIsLoading, ActorJson);
-
-            ActorListJson[std::to_string(Actor->UUID)] = ActorJson;
+            if (PSC->GetTemplate())
+            {
+                PSC->Activate(true);
+            }
         }
-        InOutHandle["Actors"] = ActorListJson;
     }
 }
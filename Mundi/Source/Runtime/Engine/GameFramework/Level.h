@@ -4,6 +4,9 @@
 #include "Actor.h"
 #include <algorithm>
 
+class FCookedLevelWriter;
+class FCookedLevelReader;
+
 class ULevel : public UObject
 {
 public:
@@ -23,7 +26,19 @@ public:
     void Clear() { Actors.Empty(); }
 
     void Serialize(const bool bInIsLoading, JSON& InOutHandle);
+
+    // 쿡 레벨(.cscene) 저장/로드 (포맷은 CookedLevel.h 참고)
+    bool SaveCooked(const FWideString& InFilePath);
+    bool LoadCooked(const FWideString& InFilePath);
+
+    // 액터만 쿡 포맷으로 쓰고 읽기 (에디터 카메라 제외, PIE 스냅샷에서도 사용)
+    void WriteCookedActors(FCookedLevelWriter& Writer);
+    void ReadCookedActors(const FCookedLevelReader& Reader);
+
 private:
+    void SerializePerspectiveCamera(const bool bInIsLoading, JSON& InOutHandle);
+    void ActivateParticleSystems();
+
     TArray<AActor*> Actors;
 };
 
@@ -0,0 +1,112 @@
+﻿#include "pch.h"
+#include "LevelLoadBenchmark.h"
+#include "CookedLevel.h"
+#include "Level.h"
+#include "PlatformTime.h"
+
+namespace
+{
+    // 월드에 등록하지 않은 임시 레벨 정리
+    void DestroyTransientLevel(ULevel* Level)
+    {
+        for (AActor* Actor : Level->GetActors())
+        {
+            ObjectFactory::DeleteObject(Actor);
+        }
+        Level->Clear();
+    }
+
+    uint64 GetFileBytes(const FWideString& Path)
+    {
+        std::error_code Error;
+        const uintmax_t Size = std::filesystem::file_size(Path, Error);
+        return Error ? 0 : static_cast<uint64>(Size);
+    }
+}
+
+namespace FLevelLoadBenchmark
+{
+    FLevelLoadBenchmarkResult Run(const FWideString& ScenePath, int32 Iterations)
+    {
+        FLevelLoadBenchmarkResult Result;
+        if (Iterations <= 0)
+        {
+            return Result;
+        }
+
+        const uint64 CookStart = FPlatformTime::Cycles64();
+        if (!FCookedLevel::CookScene(ScenePath, &Result.ActorCount))
+        {
+            return Result;
+        }
+        Result.CookMilliseconds = FPlatformTime::ToMilliseconds(FPlatformTime::Cycles64() - CookStart);
+
+        const FWideString CookedPath = FCookedLevel::GetCookedPath(ScenePath);
+        Result.JsonFileBytes = GetFileBytes(ScenePath);
+        Result.CookedFileBytes = GetFileBytes(CookedPath);
+        Result.Iterations = Iterations;
+
+        double TotalParse = 0.0;
+        double TotalJson = 0.0;
+        double TotalCooked = 0.0;
+
+        for (int32 Iteration = 0; Iteration < Iterations; ++Iteration)
+        {
+            {
+                std::unique_ptr<ULevel> Level = ULevelService::CreateDefaultLevel();
+                const uint64 Start = FPlatformTime::Cycles64();
+
+                JSON LevelJson;
+                FJsonSerializer::LoadJsonFromFile(LevelJson, ScenePath);
+                const uint64 Parsed = FPlatformTime::Cycles64();
+
+                Level->Serialize(true, LevelJson);
+                const uint64 End = FPlatformTime::Cycles64();
+
+                TotalParse += FPlatformTime::ToMilliseconds(Parsed - Start);
+                TotalJson += FPlatformTime::ToMilliseconds(End - Start);
+                DestroyTransientLevel(Level.get());
+            }
+            {
+                std::unique_ptr<ULevel> Level = ULevelService::CreateDefaultLevel();
+                const uint64 Start = FPlatformTime::Cycles64();
+
+                const bool bLoaded = Level->LoadCooked(CookedPath);
+                const uint64 End = FPlatformTime::Cycles64();
+
+                TotalCooked += FPlatformTime::ToMilliseconds(End - Start);
+                DestroyTransientLevel(Level.get());
+
+                if (!bLoaded)
+                {
+                    return Result;
+                }
+            }
+        }
+
+        Result.JsonParseMilliseconds = TotalParse / Iterations;
+        Result.JsonLoadMilliseconds = TotalJson / Iterations;
+        Result.CookedLoadMilliseconds = TotalCooked / Iterations;
+        Result.bValid = true;
+        return Result;
+    }
+
+    FString FormatResult(const FLevelLoadBenchmarkResult& Result)
+    {
+        if (!Result.bValid)
+        {
+            return "Level load benchmark failed (scene missing or cook failed)";
+        }
+
+        const double Speedup = Result.CookedLoadMilliseconds > 0.0 ? Result.JsonLoadMilliseconds / Result.CookedLoadMilliseconds : 0.0;
+
+        char Buffer[320];
+        snprintf(Buffer, sizeof(Buffer),
+            "%d actors | json %.2fMB parse %.2fms load %.2fms | cooked %.2fMB load %.2fms | x%.2f (cook %.2fms)",
+            Result.ActorCount,
+            Result.JsonFileBytes / (1024.0 * 1024.0), Result.JsonParseMilliseconds, Result.JsonLoadMilliseconds,
+            Result.CookedFileBytes / (1024.0 * 1024.0), Result.CookedLoadMilliseconds,
+            Speedup, Result.CookMilliseconds);
+        return FString(Buffer);
+    }
+}
@@ -0,0 +1,173 @@
+﻿#include "pch.h"
+#include "ObjectLookupBenchmark.h"
+#include "WorldObjectIndex.h"
+#include "SceneComponent.h"
+#include "PlatformTime.h"
+
+namespace
+{
+    // 선형 탐색 조회 수 (50000 액터 기준으로도 한 케이스가 1초 안에 끝나도록)
+    constexpr int32 ScanLookupCount = 200;
+
+    double ToNanoseconds(uint64 Cycles, int32 Count)
+    {
+        return FPlatformTime::ToMilliseconds(Cycles) * 1e6 / std::max(Count, 1);
+    }
+
+    // 기존 UWorld::FindActorByName과 같은 순회
+    AActor* ScanActorByName(const TArray<AActor*>& Actors, const FName& Name)
+    {
+        for (AActor* Actor : Actors)
+        {
+            if (Actor && !Actor->IsPendingDestroy() && Actor->ObjectName == Name)
+            {
+                return Actor;
+            }
+        }
+        return nullptr;
+    }
+
+    // 기존 UWorld::FindComponentByName과 같은 순회
+    UActorComponent* ScanComponentByName(const TArray<AActor*>& Actors, const FName& Name)
+    {
+        for (AActor* Actor : Actors)
+        {
+            if (Actor && !Actor->IsPendingDestroy())
+            {
+                for (UActorComponent* Component : Actor->GetOwnedComponents())
+                {
+                    if (Component && !Component->IsPendingDestroy() && Component->ObjectName == Name)
+                    {
+                        return Component;
+                    }
+                }
+            }
+        }
+        return nullptr;
+    }
+
+    FObjectLookupBenchmarkResult RunCase(int32 ActorCount, int32 LookupCount)
+    {
+        FObjectLookupBenchmarkResult Result;
+        Result.ActorCount = ActorCount;
+
+        TArray<AActor*> Actors;
+        TArray<FName> ActorNames;
+        TArray<FName> ComponentNames;
+        Actors.Reserve(ActorCount);
+        ActorNames.Reserve(ActorCount);
+        ComponentNames.Reserve(ActorCount);
+
+        FWorldObjectIndex Index;
+        for (int32 i = 0; i < ActorCount; ++i)
+        {
+            AActor* Actor = NewObject<AActor>();
+            USceneComponent* Component = NewObject<USceneComponent>();
+
+            // 이름 풀에 남는 문자열이 늘지 않도록 케이스끼리 같은 이름을 재사용
+            ActorNames.Add(FName("LookupBenchActor_" + std::to_string(i)));
+            ComponentNames.Add(FName("LookupBenchComponent_" + std::to_string(i)));
+            Actor->SetName(ActorNames[i]);
+            Component->SetName(ComponentNames[i]);
+            Actor->AddOwnedComponent(Component);
+
+            Actors.Add(Actor);
+            Index.AddActor(Actor);
+        }
+
+        // 조회 대상은 미리 정해 둠 (FName 생성 비용 제외). 선형 합동 생성기로 고르게 섞음
+        TArray<int32> Targets;
+        Targets.SetNum(LookupCount);
+        uint32 Seed = 12345u;
+        for (int32 i = 0; i < LookupCount; ++i)
+        {
+            Seed = Seed * 1664525u + 1013904223u;
+            Targets[i] = static_cast<int32>((Seed >> 8) % static_cast<uint32>(ActorCount));
+        }
+
+        int32 Misses = 0;
+        {
+            const uint64 Start = FPlatformTime::Cycles64();
+            for (int32 Target : Targets)
+            {
+                Misses += Index.FindActorByName(ActorNames[Target]) != Actors[Target];
+            }
+            Result.ActorByNameNs = ToNanoseconds(FPlatformTime::Cycles64() - Start, LookupCount);
+        }
+        {
+            const uint64 Start = FPlatformTime::Cycles64();
+            for (int32 Target : Targets)
+            {
+                Misses += Index.FindActorByUUID(Actors[Target]->UUID) != Actors[Target];
+            }
+            Result.ActorByUUIDNs = ToNanoseconds(FPlatformTime::Cycles64() - Start, LookupCount);
+        }
+        {
+            const uint64 Start = FPlatformTime::Cycles64();
+            for (int32 Target : Targets)
+            {
+                UActorComponent* Found = Index.FindComponentByName(ComponentNames[Target]);
+                Misses += !Found || Found->GetOwner() != Actors[Target];
+            }
+            Result.ComponentByNameNs = ToNanoseconds(FPlatformTime::Cycles64() - Start, LookupCount);
+        }
+
+        const int32 ScanCount = std::min(ScanLookupCount, LookupCount);
+        {
+            const uint64 Start = FPlatformTime::Cycles64();
+            for (int32 i = 0; i < ScanCount; ++i)
+            {
+                Misses += ScanActorByName(Actors, ActorNames[Targets[i]]) != Actors[Targets[i]];
+            }
+            Result.ActorScanNs = ToNanoseconds(FPlatformTime::Cycles64() - Start, ScanCount);
+        }
+        {
+            const uint64 Start = FPlatformTime::Cycles64();
+            for (int32 i = 0; i < ScanCount; ++i)
+            {
+                UActorComponent* Found = ScanComponentByName(Actors, ComponentNames[Targets[i]]);
+                Misses += !Found || Found->GetOwner() != Actors[Targets[i]];
+            }
+            Result.ComponentScanNs = ToNanoseconds(FPlatformTime::Cycles64() - Start, ScanCount);
+        }
+        Result.bAllFound = (Misses == 0);
+
+        // 월드 밖의 액터이므로 색인 갱신 없이 바로 정리 (컴포넌트는 액터 소멸자에서 정리)
+        for (AActor* Actor : Actors)
+        {
+            ObjectFactory::DeleteObject(Actor);
+        }
+        return Result;
+    }
+}
+
+namespace FObjectLookupBenchmark
+{
+    TArray<FObjectLookupBenchmarkResult> Run(const TArray<int32>& ActorCounts, int32 LookupCount)
+    {
+        TArray<FObjectLookupBenchmarkResult> Results;
+        if (LookupCount <= 0)
+        {
+            return Results;
+        }
+
+        for (int32 ActorCount : ActorCounts)
+        {
+            if (ActorCount > 0)
+            {
+                Results.Add(RunCase(ActorCount, LookupCount));
+            }
+        }
+        return Results;
+    }
+
+    FString FormatResult(const FObjectLookupBenchmarkResult& Result)
+    {
+        char Buffer[256];
+        snprintf(Buffer, sizeof(Buffer),
+            "%6d actors | actor name %6.1f ns uuid %6.1f ns | component name %6.1f ns | scan %10.1f / %10.1f ns%s",
+            Result.ActorCount, Result.ActorByNameNs, Result.ActorByUUIDNs, Result.ComponentByNameNs,
+            Result.ActorScanNs, Result.ComponentScanNs, Result.bAllFound ? "" : " [mismatch]");
+        return FString(Buffer);
+    }
+}
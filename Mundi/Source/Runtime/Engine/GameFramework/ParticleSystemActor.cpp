@@ -41,11 +41,11 @@ AParticleSystemActor::AParticleSystemActor()
 	{
 		// 1. ParticleSystem 템플릿 생성
 		UParticleSystem* TestTemplate = NewObject<UParticleSystem>();
-		TestTemplate->ObjectName = "TestMeshParticleSystem";
+		TestTemplate->SetName("TestMeshParticleSystem");
 
 		// 2. Emitter 생성
 		UParticleEmitter* TestEmitter = NewObject<UParticleEmitter>();
-		TestEmitter->ObjectName = "TestMeshEmitter";
+		TestEmitter->SetName("TestMeshEmitter");
 		TestEmitter->SetMaxParticleCount(30);
 
 		// 3. LOD Level 0에 접근 (생성자에서 이미 RequiredModule이 생성됨)
@@ -184,11 +184,11 @@ AParticleSystemActor::AParticleSystemActor()
 	{
 		// 1. ParticleSystem 템플릿 생성
 		UParticleSystem* TestTemplate = NewObject<UParticleSystem>();
-		TestTemplate->ObjectName = "TestParticleSystem";
+		TestTemplate->SetName("TestParticleSystem");
 
 		// 2. Emitter 생성 (생성자에서 자동으로 LODLevel 배열이 생성됨)
 		UParticleEmitter* TestEmitter = NewObject<UParticleEmitter>();
-		TestEmitter->ObjectName = "TestEmitter";
+		TestEmitter->SetName("TestEmitter");
 		TestEmitter->SetMaxParticleCount(100);
 
 		// 3. LOD Level 0에 접근 (이미 생성되어 있음)
@@ -17,7 +17,12 @@ class APlayerCameraManager : public AActor
 	GENERATED_REFLECTION_BODY()
 
 public:
-	APlayerCameraManager() { ObjectName = "Player Camera Manager";  };
+	APlayerCameraManager()
+	{
+		ObjectName = "Player Camera Manager";
+		// 이번 프레임의 이동/스프링암 결과를 보고 뷰를 만들도록 프레임 마지막 그룹에서 틱
+		PrimaryActorTick.TickGroup = ETickingGroup::PostUpdateWork;
+	};
 
 protected:
 	~APlayerCameraManager() override;
@@ -26,11 +26,11 @@ ARibbonParticleActor::ARibbonParticleActor()
 	{
 		// 1. ParticleSystem 템플릿 생성
 		UParticleSystem* RibbonTemplate = NewObject<UParticleSystem>();
-		RibbonTemplate->ObjectName = "RibbonParticleSystem";
+		RibbonTemplate->SetName("RibbonParticleSystem");
 
 		// 2. Emitter 생성
 		UParticleEmitter* RibbonEmitter = NewObject<UParticleEmitter>();
-		RibbonEmitter->ObjectName = "RibbonEmitter";
+		RibbonEmitter->SetName("RibbonEmitter");
 		RibbonEmitter->SetMaxParticleCount(700);  // 원본 설정
 
 		// 3. LOD Level 0에 접근
@@ -62,7 +62,7 @@ void ASkeletalMeshActor::EnsureViewerComponents()
         BoneLineComponent = NewObject<ULineComponent>();
         if (BoneLineComponent && RootComponent)
         {
-            BoneLineComponent->ObjectName = "BoneLines";
+            BoneLineComponent->SetName("BoneLines");
             BoneLineComponent->SetupAttachment(RootComponent, EAttachmentRule::KeepRelative);
             BoneLineComponent->SetAlwaysOnTop(true);
             AddOwnedComponent(BoneLineComponent);
@@ -76,7 +76,7 @@ void ASkeletalMeshActor::EnsureViewerComponents()
         BoneAnchor = NewObject<UBoneAnchorComponent>();
         if (BoneAnchor && RootComponent)
         {
-            BoneAnchor->ObjectName = "BoneAnchor";
+            BoneAnchor->SetName("BoneAnchor");
             BoneAnchor->SetupAttachment(RootComponent, EAttachmentRule::KeepRelative);
             BoneAnchor->SetVisibility(false);
             AddOwnedComponent(BoneAnchor);
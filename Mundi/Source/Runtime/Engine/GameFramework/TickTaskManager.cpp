@@ -0,0 +1,567 @@
+﻿#include "pch.h"
+#include "TickTaskManager.h"
+#include "World.h"
+#include "Level.h"
+#include "Actor.h"
+#include "ActorComponent.h"
+#include "PlatformTime.h"
+#include "Profiler.h"
+#include <atomic>
+#include <condition_variable>
+#include <functional>
+#include <mutex>
+#include <thread>
+
+bool FTickTaskManager::bParallelTickEnabled = false;
+
+namespace
+{
+	thread_local bool GIsInParallelTick = false;
+}
+
+bool FTickTaskManager::IsInParallelTick()
+{
+	return GIsInParallelTick;
+}
+
+const char* GetTickingGroupName(ETickingGroup Group)
+{
+	switch (Group)
+	{
+	case ETickingGroup::PrePhysics:		return "PrePhysics";
+	case ETickingGroup::DuringPhysics:	return "DuringPhysics";
+	case ETickingGroup::PostPhysics:	return "PostPhysics";
+	case ETickingGroup::PostUpdateWork:	return "PostUpdateWork";
+	default:							return "Unknown";
+	}
+}
+
+// ───────────────────────── FTickFunction ─────────────────────────
+
+void FTickFunction::AddPrerequisite(UObject* Object)
+{
+	if (!Object)
+	{
+		return;
+	}
+	TWeakObjectPtr<UObject> Handle(Object);
+	if (Handle.IsValid() && !Prerequisites.Contains(Handle))
+	{
+		Prerequisites.Add(Handle);
+	}
+}
+
+void FTickFunction::RemovePrerequisite(UObject* Object)
+{
+	Prerequisites.RemoveAll(TWeakObjectPtr<UObject>(Object));
+}
+
+bool FTickFunction::ConsumeDeltaTime(float DeltaSeconds, float& OutDeltaTime)
+{
+	if (TickInterval <= 0.0f)
+	{
+		OutDeltaTime = DeltaSeconds;
+		return true;
+	}
+
+	AccumulatedTime += DeltaSeconds;
+	if (AccumulatedTime < TickInterval)
+	{
+		return false;
+	}
+
+	// 건너뛴 프레임의 시간을 한 번에 넘김
+	OutDeltaTime = AccumulatedTime;
+	AccumulatedTime = 0.0f;
+	return true;
+}
+
+// ───────────────────────── FTickWorkerPool ─────────────────────────
+
+/**
+ * 병렬 틱 단계용 상주 워커
+ * 단계마다 스레드를 만들고 합치는 대신, 잠든 워커를 깨워 작업 인덱스를 나눠 가져가게 한다.
+ * 호출 스레드(게임 스레드)도 함께 작업하며, 참여한 워커가 모두 끝나야 ParallelFor가 반환된다.
+ */
+class FTickWorkerPool
+{
+public:
+	explicit FTickWorkerPool(int32 InWorkerCount)
+	{
+		for (int32 WorkerIndex = 0; WorkerIndex < InWorkerCount; ++WorkerIndex)
+		{
+			Workers.emplace_back(&FTickWorkerPool::WorkerMain, this, WorkerIndex);
+		}
+	}
+
+	~FTickWorkerPool()
+	{
+		{
+			std::lock_guard<std::mutex> Lock(Mutex);
+			bStopRequested = true;
+		}
+		WorkCondition.notify_all();
+		for (std::thread& Worker : Workers)
+		{
+			Worker.join();
+		}
+	}
+
+	FTickWorkerPool(const FTickWorkerPool&) = delete;
+	FTickWorkerPool& operator=(const FTickWorkerPool&) = delete;
+
+	int32 GetWorkerCount() const { return Workers.Num(); }
+
+	// [0, Count) 인덱스마다 Body를 한 번씩 실행하고 모두 끝날 때까지 기다린다
+	void ParallelFor(int32 Count, const std::function<void(int32)>& Body)
+	{
+		{
+			std::lock_guard<std::mutex> Lock(Mutex);
+			CurrentBody = &Body;
+			CurrentCount = Count;
+			NextIndex.store(0, std::memory_order_relaxed);
+			// 작업 수보다 많은 워커는 깨워도 할 일이 없으므로 참여시키지 않음 (호출 스레드 몫 1 제외)
+			NumParticipants = std::min(Workers.Num(), Count - 1);
+			NumBusy = NumParticipants;
+			++Generation;
+		}
+		WorkCondition.notify_all();
+
+		RunIndices(Body, Count);
+
+		std::unique_lock<std::mutex> Lock(Mutex);
+		DoneCondition.wait(Lock, [this]() { return NumBusy == 0; });
+		CurrentBody = nullptr;
+	}
+
+private:
+	void RunIndices(const std::function<void(int32)>& Body, int32 Count)
+	{
+		for (int32 Index = NextIndex.fetch_add(1); Index < Count; Index = NextIndex.fetch_add(1))
+		{
+			Body(Index);
+		}
+	}
+
+	void WorkerMain(int32 WorkerIndex)
+	{
+		char ThreadName[32];
+		snprintf(ThreadName, sizeof(ThreadName), "TickWorker %d", WorkerIndex);
+		FProfiler::SetThreadName(ThreadName);
+
+		uint64 SeenGeneration = 0;
+		std::unique_lock<std::mutex> Lock(Mutex);
+		for (;;)
+		{
+			WorkCondition.wait(Lock, [this, SeenGeneration]() { return bStopRequested || Generation != SeenGeneration; });
+			if (bStopRequested)
+			{
+				break;
+			}
+			SeenGeneration = Generation;
+			if (WorkerIndex >= NumParticipants)
+			{
+				continue;
+			}
+
+			// 참여한 워커가 끝나기 전에는 다음 단계가 시작되지 않으므로 Body/Count는 이 단계의 값
+			const std::function<void(int32)>* Body = CurrentBody;
+			const int32 Count = CurrentCount;
+			Lock.unlock();
+
+			GIsInParallelTick = true;
+			RunIndices(*Body, Count);
+			GIsInParallelTick = false;
+
+			Lock.lock();
+			if (--NumBusy == 0)
+			{
+				DoneCondition.notify_one();
+			}
+		}
+	}
+
+	TArray<std::thread> Workers;
+	std::mutex Mutex;
+	std::condition_variable WorkCondition;
+	std::condition_variable DoneCondition;
+	const std::function<void(int32)>* CurrentBody = nullptr;
+	int32 CurrentCount = 0;
+	int32 NumParticipants = 0;
+	int32 NumBusy = 0;
+	uint64 Generation = 0;
+	bool bStopRequested = false;
+	std::atomic<int32> NextIndex{ 0 };
+};
+
+// ───────────────────────── FTickTaskManager ─────────────────────────
+
+FTickTaskManager::FTickTaskManager() = default;
+FTickTaskManager::~FTickTaskManager() = default;
+
+namespace
+{
+	constexpr int32 TickGroupCount = static_cast<int32>(ETickingGroup::Max);
+
+	struct FTickCandidate
+	{
+		AActor* Actor = nullptr;
+		UActorComponent* Component = nullptr;
+		int32 Group = 0;
+		int32 Depth = 0;
+		int32 EdgeBegin = 0;	// Edges 안의 선행 틱 인덱스 범위
+		int32 EdgeEnd = 0;
+		uint8 VisitState = 0;	// 0: 미방문, 1: 방문 중, 2: 완료
+	};
+
+	// 같은 그룹 안의 선행 틱 체인 길이 (순환이면 해당 간선을 무시)
+	int32 ComputeTickDepth(TArray<FTickCandidate>& Candidates, const TArray<int32>& Edges, int32 Index, bool& bOutCycle)
+	{
+		FTickCandidate& Candidate = Candidates[Index];
+		if (Candidate.VisitState == 2)
+		{
+			return Candidate.Depth;
+		}
+		Candidate.VisitState = 1;
+
+		int32 Depth = 0;
+		for (int32 EdgeIndex = Candidate.EdgeBegin; EdgeIndex < Candidate.EdgeEnd; ++EdgeIndex)
+		{
+			const int32 Prerequisite = Edges[EdgeIndex];
+			if (Candidates[Prerequisite].Group != Candidate.Group)
+			{
+				continue;	// 앞 그룹에서 이미 끝남
+			}
+			if (Candidates[Prerequisite].VisitState == 1)
+			{
+				bOutCycle = true;
+				continue;
+			}
+			Depth = std::max(Depth, ComputeTickDepth(Candidates, Edges, Prerequisite, bOutCycle) + 1);
+		}
+
+		// 재귀 도중 배열이 바뀌지 않으므로 참조는 유효
+		Candidate.Depth = Depth;
+		Candidate.VisitState = 2;
+		return Depth;
+	}
+}
+
+void FTickTaskManager::Rebuild(UWorld* World)
+{
+	bDirty = false;
+	++Stats.Rebuilds;
+	for (TArray<FTickTask>& Group : TickGroups)
+	{
+		Group.clear();
+	}
+
+	ULevel* Level = World ? World->GetLevel() : nullptr;
+	if (!Level)
+	{
+		RegisteredTickCount = 0;
+		return;
+	}
+
+	// 1) 후보 수집: 레벨 액터 순서, 액터 안에서는 컴포넌트 UUID 순 (OwnedComponents는 해시 순서라 정렬)
+	TArray<FTickCandidate> Candidates;
+	TMap<const UObject*, int32> CandidateIndices;
+	TArray<UActorComponent*> Components;
+	for (AActor* Actor : Level->GetActors())
+	{
+		if (!Actor || !Actor->CanEverTick())
+		{
+			continue;
+		}
+
+		FTickCandidate ActorCandidate;
+		ActorCandidate.Actor = Actor;
+		ActorCandidate.Group = static_cast<int32>(Actor->PrimaryActorTick.TickGroup);
+		CandidateIndices[Actor] = Candidates.Num();
+		Candidates.Add(ActorCandidate);
+
+		Components.clear();
+		for (UActorComponent* Component : Actor->GetOwnedComponents())
+		{
+			if (Component && Component->CanEverTick())
+			{
+				Components.Add(Component);
+			}
+		}
+		Components.Sort([](const UActorComponent* A, const UActorComponent* B) { return A->UUID < B->UUID; });
+
+		for (UActorComponent* Component : Components)
+		{
+			FTickCandidate ComponentCandidate;
+			ComponentCandidate.Actor = Actor;
+			ComponentCandidate.Component = Component;
+			ComponentCandidate.Group = static_cast<int32>(Component->PrimaryComponentTick.TickGroup);
+			CandidateIndices[Component] = Candidates.Num();
+			Candidates.Add(ComponentCandidate);
+		}
+	}
+
+	// 2) 선행 틱 간선: 명시한 선행 틱 + 컴포넌트는 소유 액터 틱 뒤
+	TArray<int32> Edges;
+	for (FTickCandidate& Candidate : Candidates)
+	{
+		Candidate.EdgeBegin = Edges.Num();
+		if (Candidate.Component)
+		{
+			if (const int32* OwnerIndex = CandidateIndices.Find(Candidate.Actor))
+			{
+				Edges.Add(*OwnerIndex);
+			}
+		}
+
+		const FTickFunction& TickFunction = Candidate.Component ? Candidate.Component->PrimaryComponentTick : Candidate.Actor->PrimaryActorTick;
+		for (const TWeakObjectPtr<UObject>& Prerequisite : TickFunction.Prerequisites)
+		{
+			if (const int32* PrerequisiteIndex = CandidateIndices.Find(Prerequisite.Get()))
+			{
+				Edges.Add(*PrerequisiteIndex);
+			}
+		}
+		Candidate.EdgeEnd = Edges.Num();
+	}
+
+	// 3) 선행 틱이 뒤 그룹에 있으면 그 그룹으로 미룸 (그룹은 늘어나기만 하므로 반복하면 수렴)
+	for (bool bChanged = true; bChanged; )
+	{
+		bChanged = false;
+		for (FTickCandidate& Candidate : Candidates)
+		{
+			for (int32 EdgeIndex = Candidate.EdgeBegin; EdgeIndex < Candidate.EdgeEnd; ++EdgeIndex)
+			{
+				const int32 PrerequisiteGroup = Candidates[Edges[EdgeIndex]].Group;
+				if (PrerequisiteGroup > Candidate.Group)
+				{
+					Candidate.Group = PrerequisiteGroup;
+					bChanged = true;
+				}
+			}
+		}
+	}
+
+	// 4) 그룹 안 Depth 계산 후 (Depth, 수집 순서)로 정렬
+	bool bCycle = false;
+	for (int32 Index = 0; Index < Candidates.Num(); ++Index)
+	{
+		ComputeTickDepth(Candidates, Edges, Index, bCycle);
+	}
+	if (bCycle)
+	{
+		UE_LOG("[TickTaskManager][Warning] Tick prerequisite cycle detected; the cyclic edge is ignored.");
+	}
+
+	for (const FTickCandidate& Candidate : Candidates)
+	{
+		FTickTask Task;
+		Task.Actor = TWeakObjectPtr<AActor>(Candidate.Actor);
+		Task.Component = TWeakObjectPtr<UActorComponent>(Candidate.Component);
+		Task.bComponentTick = Candidate.Component != nullptr;
+		Task.Depth = Candidate.Depth;
+
+		// GUObjectArray에 없는 오브젝트는 핸들을 만들 수 없으므로 틱하지 않음
+		if (!Task.Actor.IsValid() || (Task.bComponentTick && !Task.Component.IsValid()))
+		{
+			continue;
+		}
+		TickGroups[Candidate.Group].Add(Task);
+	}
+	RegisteredTickCount = 0;
+	for (TArray<FTickTask>& Group : TickGroups)
+	{
+		std::stable_sort(Group.begin(), Group.end(),
+			[](const FTickTask& A, const FTickTask& B) { return A.Depth < B.Depth; });
+		RegisteredTickCount += static_cast<uint32>(Group.Num());
+	}
+}
+
+bool FTickTaskManager::PrepareTask(const FTickTask& Task, bool bPie, float DeltaSeconds, FReadyTask& OutTask, bool& bOutParallel)
+{
+	AActor* Actor = Task.Actor.Get();
+	if (!Actor || !Actor->GetWorld() || !Actor->IsActorActive())
+	{
+		return false;
+	}
+	// 에디터: 액터의 bTickInEditor가 true일 때만 틱 (PIE는 항상)
+	if (!bPie && !Actor->CanTickInEditor())
+	{
+		return false;
+	}
+
+	UActorComponent* Component = nullptr;
+	if (Task.bComponentTick)
+	{
+		Component = Task.Component.Get();
+		if (!Component || Component->GetOwner() != Actor || !Component->IsComponentTickEnabled())
+		{
+			return false;
+		}
+		if (!bPie && !Component->CanTickInEditor())
+		{
+			return false;
+		}
+	}
+
+	OutTask.Actor = Actor;
+	OutTask.Component = Component;
+	bOutParallel = Component ? Component->CanTickOnAnyThread() : Actor->CanTickOnAnyThread();
+	return true;
+}
+
+bool FTickTaskManager::ConsumeTaskDelta(FReadyTask& InOutTask, float DeltaSeconds)
+{
+	FTickFunction& TickFunction = InOutTask.Component ? InOutTask.Component->PrimaryComponentTick : InOutTask.Actor->PrimaryActorTick;
+	const float ActorDelta = DeltaSeconds * InOutTask.Actor->GetCustomTimeDillation();
+	if (!TickFunction.ConsumeDeltaTime(ActorDelta, InOutTask.DeltaTime))
+	{
+		++Stats.IntervalSkips;
+		return false;
+	}
+
+	if (InOutTask.Component)
+	{
+		++Stats.ComponentTicks;
+	}
+	else
+	{
+		++Stats.ActorTicks;
+	}
+	return true;
+}
+
+void FTickTaskManager::ExecuteTask(const FReadyTask& Task)
+{
+	// 트레이스에서 틱 하나하나를 클래스 이름으로 구분 (병렬 틱은 워커 스레드 타임라인에 표시)
+	if (Task.Component)
+	{
+		PROFILE_SCOPE(Task.Component->GetClass()->Name);
+		Task.Component->TickComponent(Task.DeltaTime);
+	}
+	else
+	{
+		PROFILE_SCOPE(Task.Actor->GetClass()->Name);
+		Task.Actor->Tick(Task.DeltaTime);
+	}
+}
+
+void FTickTaskManager::RunTickGroup(UWorld* World, int32 GroupIndex, float DeltaSeconds)
+{
+	const TArray<FTickTask>& Tasks = TickGroups[GroupIndex];
+	const bool bPie = World->bPie;
+
+	int32 WaveBegin = 0;
+	while (WaveBegin < Tasks.Num())
+	{
+		int32 WaveEnd = WaveBegin + 1;
+		while (WaveEnd < Tasks.Num() && Tasks[WaveEnd].Depth == Tasks[WaveBegin].Depth)
+		{
+			++WaveEnd;
+		}
+		++Stats.Waves;
+
+		// 1) 게임 스레드 틱을 순서대로 실행하고, 병렬 가능한 틱은 미뤄 둠
+		DeferredTasks.clear();
+		for (int32 Index = WaveBegin; Index < WaveEnd; ++Index)
+		{
+			FReadyTask Ready;
+			bool bParallel = false;
+			if (!PrepareTask(Tasks[Index], bPie, DeltaSeconds, Ready, bParallel))
+			{
+				continue;
+			}
+			if (bParallel && bParallelTickEnabled)
+			{
+				DeferredTasks.Add(Index);
+				continue;
+			}
+			if (ConsumeTaskDelta(Ready, DeltaSeconds))
+			{
+				ExecuteTask(Ready);
+			}
+		}
+
+		// 2) 미룬 틱은 게임 스레드 틱이 끝난 뒤 다시 확인 (그 사이 삭제/비활성화됐을 수 있음)
+		ParallelTasks.clear();
+		for (int32 Index : DeferredTasks)
+		{
+			FReadyTask Ready;
+			bool bParallel = false;
+			if (!PrepareTask(Tasks[Index], bPie, DeltaSeconds, Ready, bParallel) || !ConsumeTaskDelta(Ready, DeltaSeconds))
+			{
+				continue;
+			}
+			if (bParallel)
+			{
+				ParallelTasks.Add(Ready);
+			}
+			else
+			{
+				ExecuteTask(Ready);
+			}
+		}
+
+		// 3) 병렬 틱: 게임 스레드도 함께 작업을 가져가며, 모두 끝날 때까지 기다림
+		if (ParallelTasks.Num() == 1)
+		{
+			ExecuteTask(ParallelTasks[0]);
+		}
+		else if (ParallelTasks.Num() > 1)
+		{
+			if (!WorkerPool)
+			{
+				// 게임 스레드도 작업하므로 워커는 하드웨어 스레드 - 1
+				const int32 HardwareThreads = static_cast<int32>(std::max(1u, std::thread::hardware_concurrency()));
+				WorkerPool = std::make_unique<FTickWorkerPool>(std::max(1, HardwareThreads - 1));
+			}
+
+			GIsInParallelTick = true;
+			WorkerPool->ParallelFor(ParallelTasks.Num(), [this](int32 Index) { ExecuteTask(ParallelTasks[Index]); });
+			GIsInParallelTick = false;
+
+			Stats.ParallelTicks += static_cast<uint32>(ParallelTasks.Num());
+
+			// 4) 워커 틱이 미뤄 둔 작업(노티파이, 트랜스폼 변경 등)을 틱 순서대로 게임 스레드에서 처리
+			for (const FReadyTask& Task : ParallelTasks)
+			{
+				if (Task.Component)
+				{
+					Task.Component->OnParallelTickFinished();
+				}
+				else
+				{
+					Task.Actor->OnParallelTickFinished();
+				}
+			}
+		}
+
+		WaveBegin = WaveEnd;
+	}
+}
+
+void FTickTaskManager::Tick(UWorld* World, float DeltaSeconds)
+{
+	Stats.Reset();
+	if (!World)
+	{
+		return;
+	}
+
+	for (int32 GroupIndex = 0; GroupIndex < TickGroupCount; ++GroupIndex)
+	{
+		// 앞 그룹에서 액터/컴포넌트가 추가·삭제됐으면 여기서 다시 구성
+		if (bDirty)
+		{
+			Rebuild(World);
+		}
+
+		PROFILE_SCOPE(GetTickingGroupName(static_cast<ETickingGroup>(GroupIndex)));
+		const uint64 StartCycles = FPlatformTime::Cycles64();
+		RunTickGroup(World, GroupIndex, DeltaSeconds);
+		Stats.GroupMs[GroupIndex] = FPlatformTime::ToMilliseconds(FPlatformTime::Cycles64() - StartCycles);
+	}
+
+	Stats.RegisteredTicks = RegisteredTickCount;
+}
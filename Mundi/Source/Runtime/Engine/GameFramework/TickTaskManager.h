@@ -0,0 +1,136 @@
+﻿#pragma once
+#include <memory>
+#include "UEContainer.h"
+
+class UObject;
+class UWorld;
+class AActor;
+class UActorComponent;
+class FTickWorkerPool;
+
+// 틱 그룹: 그룹 순서대로 실행되며, 다음 그룹은 앞 그룹의 틱이 모두 끝난 뒤 시작
+// (물리 씬이 따로 없으므로 물리 그룹은 "이동 처리 중/후" 단계를 나누는 용도)
+enum class ETickingGroup : uint8
+{
+	PrePhysics,		// 기본값: 입력, 게임플레이, 이동 컴포넌트
+	DuringPhysics,	// 이동 결과와 무관한 작업 (애니메이션)
+	PostPhysics,	// 이동이 끝난 트랜스폼을 읽는 작업 (파티클)
+	PostUpdateWork,	// 프레임 마지막 (카메라, 이벤트 수집)
+	Max
+};
+
+const char* GetTickingGroupName(ETickingGroup Group);
+
+/**
+ * 액터/컴포넌트마다 하나씩 가지는 틱 설정 (AActor::PrimaryActorTick, UActorComponent::PrimaryComponentTick)
+ * 생성자에서는 직접 설정하고, 월드에 들어간 뒤에는 소유자의 Set~/AddTickPrerequisite로 바꿔야 틱 목록이 다시 만들어짐
+ */
+struct FTickFunction
+{
+	ETickingGroup TickGroup = ETickingGroup::PrePhysics;
+
+	// 틱 간격(초). 0이면 매 프레임, 그 외에는 누적 시간이 간격을 넘은 프레임에 누적 시간을 DeltaTime으로 한 번 틱
+	float TickInterval = 0.0f;
+
+	// 워커 스레드에서 틱해도 되는지 (자기 상태만 바꾸는 틱만 true)
+	// 실제 병렬 실행 여부는 매 프레임 CanTickOnAnyThread()로 다시 확인
+	bool bRunOnAnyThread = false;
+
+	// 이 틱보다 먼저 끝나야 하는 액터/컴포넌트 (런타임 전용, 복제 시 비워짐)
+	// 같은 그룹이면 실행 순서로, 뒤 그룹에 있으면 이 틱을 그 그룹으로 미룸
+	TArray<TWeakObjectPtr<UObject>> Prerequisites;
+
+	// 간격 틱용 누적 시간 (FTickTaskManager가 관리)
+	float AccumulatedTime = 0.0f;
+
+	void AddPrerequisite(UObject* Object);
+	void RemovePrerequisite(UObject* Object);
+
+	// 간격을 반영한 이번 프레임의 DeltaTime. 이번 프레임에 틱하지 않으면 false
+	bool ConsumeDeltaTime(float DeltaSeconds, float& OutDeltaTime);
+};
+
+// 프레임 틱 통계 (콘솔 "STAT TICK")
+struct FTickStats
+{
+	uint32 ActorTicks = 0;
+	uint32 ComponentTicks = 0;
+	uint32 ParallelTicks = 0;		// 워커 스레드에서 실행된 틱
+	uint32 IntervalSkips = 0;		// 간격 때문에 이번 프레임 건너뛴 틱
+	uint32 Waves = 0;				// 선행 관계로 나뉜 실행 단계 수 (모든 그룹 합)
+	uint32 RegisteredTicks = 0;		// 틱 목록에 있는 액터/컴포넌트 수
+	uint32 Rebuilds = 0;			// 이번 프레임 틱 목록 재구성 횟수
+	double GroupMs[static_cast<int32>(ETickingGroup::Max)] = {};
+
+	void Reset() { *this = FTickStats(); }
+};
+
+/**
+ * 월드의 액터/컴포넌트 틱 실행기
+ *
+ * 레벨 액터와 그 컴포넌트의 틱을 그룹별 배열로 모아 두고 (추가/삭제/설정 변경 시에만 재구성),
+ * 그룹 안에서는 선행 관계 깊이(Depth)별 단계로 나눠 실행합니다.
+ * - 순서: 레벨 액터 순서, 액터 안에서는 컴포넌트 UUID(생성) 순서. 컴포넌트는 소유 액터 틱 뒤에 실행
+ * - 한 단계에서 게임 스레드 틱을 먼저 순서대로 돌린 뒤, 병렬 가능한 틱을 워커 스레드에 나눠 실행하고 기다림
+ *   (워커는 처음 병렬 단계가 생길 때 한 번 만들어 매니저가 소유하고, 단계마다 깨워서 재사용)
+ * - 목록은 핸들(TWeakObjectPtr)로 저장하므로 틱 도중 삭제된 오브젝트는 건너뜀
+ */
+class FTickTaskManager
+{
+public:
+	FTickTaskManager();
+	~FTickTaskManager();
+
+	// 레벨 액터 추가/삭제, 컴포넌트 등록/해제, 틱 그룹/선행 관계 변경 시 호출 -> 다음 그룹 시작 전에 재구성
+	void MarkDirty() { bDirty = true; }
+
+	// 모든 그룹 실행 (UWorld::Tick에서 호출)
+	void Tick(UWorld* World, float DeltaSeconds);
+
+	const FTickStats& GetStats() const { return Stats; }
+
+	// 기본값은 꺼짐. 병렬 틱을 검증한 컴포넌트가 아직 적으므로 명령줄 -paralleltick 또는 콘솔 "TICK PARALLEL"로 켠다
+	static void SetParallelTickEnabled(bool bEnable) { bParallelTickEnabled = bEnable; }
+	static bool IsParallelTickEnabled() { return bParallelTickEnabled; }
+
+	// 현재 스레드가 병렬 틱 단계에서 틱을 실행 중인지 (워커와 함께 일하는 게임 스레드 포함)
+	// true면 공유 상태를 바꾸는 작업은 미뤄 두고 OnParallelTickFinished에서 처리해야 함
+	static bool IsInParallelTick();
+
+private:
+	struct FTickTask
+	{
+		TWeakObjectPtr<AActor> Actor;
+		TWeakObjectPtr<UActorComponent> Component;
+		bool bComponentTick = false;	// false면 액터 틱
+		int32 Depth = 0;
+	};
+
+	// 준비된 (이번 단계에 실제로 틱할) 작업
+	struct FReadyTask
+	{
+		AActor* Actor = nullptr;
+		UActorComponent* Component = nullptr;
+		float DeltaTime = 0.0f;
+	};
+
+	void Rebuild(UWorld* World);
+	void RunTickGroup(UWorld* World, int32 GroupIndex, float DeltaSeconds);
+
+	// 핸들을 풀고 틱 조건(활성/에디터 틱 등)을 확인. bOutParallel: 이번 프레임 워커에서 실행 가능한지
+	bool PrepareTask(const FTickTask& Task, bool bPie, float DeltaSeconds, FReadyTask& OutTask, bool& bOutParallel);
+	// 틱 간격을 반영해 DeltaTime을 채움. 이번 프레임에 틱하지 않으면 false
+	bool ConsumeTaskDelta(FReadyTask& InOutTask, float DeltaSeconds);
+	static void ExecuteTask(const FReadyTask& Task);
+
+private:
+	TArray<FTickTask> TickGroups[static_cast<int32>(ETickingGroup::Max)];	// 그룹별, Depth 순 정렬
+	TArray<int32> DeferredTasks;		// 현재 단계에서 병렬 후보로 미룬 작업 (TickGroups 인덱스)
+	TArray<FReadyTask> ParallelTasks;
+	std::unique_ptr<FTickWorkerPool> WorkerPool;	// 첫 병렬 단계에서 생성
+	uint32 RegisteredTickCount = 0;
+	bool bDirty = true;
+	FTickStats Stats;
+
+	static bool bParallelTickEnabled;
+};
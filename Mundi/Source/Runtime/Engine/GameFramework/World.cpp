@@ -31,9 +31,12 @@
 #include "ShapeComponent.h"
 #include "PlayerCameraManager.h"
 #include "Hash.h"
+#include "CookedLevel.h"
 
 IMPLEMENT_CLASS(UWorld)
 
+bool UWorld::bPIESnapshotDuplication = true;
+
 UWorld::UWorld() : Partition(nullptr)  // Will be created in Initialize() based on world type
 {
 	SelectionMgr = std::make_unique<USelectionManager>();
@@ -164,7 +167,13 @@ bool UWorld::LoadLevelFromFile(const FWideString& Path)
 	std::unique_ptr<ULevel> NewLevel = ULevelService::CreateDefaultLevel();
 	JSON LevelJsonData;
 
-	if (FJsonSerializer::LoadJsonFromFile(LevelJsonData, Path))
+	// 원본보다 최신인 쿡 파일(.cscene)이 있으면 JSON 파싱 없이 바로 로드
+	const FWideString CookedPath = FCookedLevel::GetCookedPath(Path);
+	if (FCookedLevel::IsCookedUpToDate(Path, CookedPath) && NewLevel->LoadCooked(CookedPath))
+	{
+		UE_LOG("UWorld: Loaded cooked level: %s", WideToUTF8(CookedPath).c_str());
+	}
+	else if (FJsonSerializer::LoadJsonFromFile(LevelJsonData, Path))
 	{
 		NewLevel->Serialize(true, LevelJsonData);
 	}
@@ -251,23 +260,9 @@ void UWorld::Tick(float DeltaSeconds)
 
 	if (Level)
 	{
-		// Tick 중에 새로운 actor가 추가될 수도 있어서 복사 후 호출
-		TArray<AActor*> LevelActors = Level->GetActors();
-		for (AActor* Actor : LevelActors)
-		{
-			if (Actor && Actor->IsActorActive())
-			{
-				if (Actor->CanEverTick())
-				{
-					// PIE: 항상 틱
-					// 에디터: 액터의 bTickInEditor가 true일 때만 틱
-					if (bPie || Actor->CanTickInEditor())
-					{
-						Actor->Tick(GetDeltaTime(EDeltaTime::Game) * Actor->GetCustomTimeDillation());
-					}
-				}
-			}
-		}
+		// 레벨 액터/컴포넌트 틱: 틱 그룹 순서대로, 그룹 안에서는 선행 관계 순서 (병렬 가능한 틱은 워커 스레드)
+		// PIE: 항상 틱, 에디터: bTickInEditor가 true인 것만 틱
+		TickManager.Tick(this, GetDeltaTime(EDeltaTime::Game));
     }
 
     for (AActor* EditorActor : EditorActors)
@@ -275,6 +270,7 @@ void UWorld::Tick(float DeltaSeconds)
 		if (EditorActor && !bPie)
 		{
 			EditorActor->Tick(GetDeltaTime(EDeltaTime::Unscaled));
+			EditorActor->TickOwnedComponents(GetDeltaTime(EDeltaTime::Unscaled));
 		}
     }
 
@@ -302,6 +298,15 @@ UWorld* UWorld::DuplicateWorldForPIE(UWorld* InEditorWorld)
 	
 	FWorldContext PIEWorldContext = FWorldContext(PIEWorld, EWorldType::Game);
 	GEngine.AddWorldContext(PIEWorldContext);
+
+	if (bPIESnapshotDuplication)
+	{
+		if (DuplicateLevelBySnapshot(InEditorWorld, PIEWorld))
+		{
+			return PIEWorld;
+		}
+		UE_LOG("[error] PIE snapshot failed, falling back to per-actor duplication");
+	}
 	
 	const TArray<AActor*>& SourceActors = InEditorWorld->GetLevel()->GetActors();
 	for (AActor* SourceActor : SourceActors)
@@ -335,6 +340,34 @@ UWorld* UWorld::DuplicateWorldForPIE(UWorld* InEditorWorld)
 	return PIEWorld;
 }
 
+bool UWorld::DuplicateLevelBySnapshot(UWorld* InEditorWorld, UWorld* PIEWorld)
+{
+	// 1) 에디터 레벨을 한 번만 직렬화 (단순 프로퍼티는 레코드, 나머지는 바이너리 JSON)
+	TArray<uint8> Snapshot;
+	{
+		FCookedLevelWriter Writer;
+		InEditorWorld->GetLevel()->WriteCookedActors(Writer);
+		Writer.SaveToBuffer(Snapshot);
+	}
+
+	FCookedLevelReader Reader;
+	if (!Reader.OpenMemory(Snapshot.GetData(), static_cast<uint32>(Snapshot.Num())))
+	{
+		return false;
+	}
+
+	// 2) 레코드 하나가 오브젝트 하나이므로 오브젝트 배열을 한 번에 확보하고 새 레벨로 생성
+	ObjectFactory::ReserveObjects(static_cast<int32>(Reader.GetRecordCount()));
+
+	std::unique_ptr<ULevel> NewLevel = ULevelService::CreateDefaultLevel();
+	NewLevel->ReadCookedActors(Reader);
+	Reader.Close();
+
+	// 3) SetLevel이 컴포넌트를 등록한 뒤 BVH를 한 번에 빌드하고 PlayerCameraManager도 찾아서 연결
+	PIEWorld->SetLevel(std::move(NewLevel));
+	return true;
+}
+
 float UWorld::GetDeltaTime(EDeltaTime type)
 {
 	switch (type)
@@ -399,6 +432,8 @@ bool UWorld::DestroyActor(AActor* Actor)
 
 	// 컴포넌트 정리 (등록 해제 → 파괴)
 	Actor->DestroyAllComponents();
+	TickManager.MarkDirty();
+	ObjectIndex.RemoveActor(Actor);
 
 	// 레벨에서 제거 시도
 	if (Level && Level->RemoveActor(Actor))
@@ -482,6 +517,8 @@ void UWorld::SetLevel(std::unique_ptr<ULevel> InLevel)
     if (SelectionMgr) SelectionMgr->ClearSelection();
 
 	PlayerCameraManager = nullptr;
+	TickManager.MarkDirty();
+	ObjectIndex.Clear();
 
     // Cleanup current
     if (Level)
@@ -503,19 +540,22 @@ void UWorld::SetLevel(std::unique_ptr<ULevel> InLevel)
     // Adopt actors: set world and register
     if (Level)
     {
-		// Bulk register only if partition exists
-		if (Partition)
-		{
-			Partition->BulkRegister(Level->GetActors());
-		}
         for (AActor* Actor : Level->GetActors())
         {
 			if (Actor)
 			{
 				Actor->SetWorld(this);
+				ObjectIndex.AddActor(Actor);
 				Actor->RegisterAllComponents(this);
 }
         }
+
+		// 등록 중 컴포넌트마다 예약된 dirty 갱신은 BulkRegister가 한 번의 빌드로 대체
+		// (트랜스폼/등록이 끝난 뒤 빌드해야 바운드가 정확하므로 등록 이후에 호출)
+		if (Partition)
+		{
+			Partition->BulkRegister(Level->GetActors());
+		}
     }
 
 	// 씬에서 PCM 검색
@@ -539,8 +579,10 @@ void UWorld::AddActorToLevel(AActor* Actor)
 	if (Level)
 	{
 		Level->AddActor(Actor);
+		TickManager.MarkDirty();
 
 		Actor->SetWorld(this);
+		ObjectIndex.AddActor(Actor);
 
 		Actor->RegisterAllComponents(this);
 	}
@@ -586,44 +628,14 @@ AActor* UWorld::SpawnActor(UClass* Class)
 
 AActor* UWorld::FindActorByName(const FName& ActorName)
 {
-	if (!Level)
-	{
-		return nullptr;
-	}
-
-	for (AActor* Actor : Level->GetActors())
-	{
-		if (Actor && !Actor->IsPendingDestroy() && Actor->ObjectName == ActorName)
-		{
-			return Actor; // 첫 번째 일치하는 액터 반환
-		}
-	}
-
-	return nullptr; // 찾지 못함
+	// 레벨에 추가된 순서대로 같은 이름 중 첫 번째 액터 (파괴 대기 중이면 건너뜀)
+	return ObjectIndex.FindActorByName(ActorName);
 }
 
 UActorComponent* UWorld::FindComponentByName(const FName& ComponentName)
 {
-	if (!Level)
-	{
-		return nullptr;
-	}
-
-	for (AActor* Actor : Level->GetActors())
-	{
-		if (Actor && !Actor->IsPendingDestroy())
-		{
-			for (UActorComponent* Component : Actor->GetOwnedComponents())
-			{
-				if (Component && !Component->IsPendingDestroy() && Component->ObjectName == ComponentName)
-				{
-					return Component; // 첫 번째 일치하는 컴포넌트 반환
-				}
-			}
-		}
-	}
-
-	return nullptr; // 찾지 못함
+	// 소유 액터가 파괴 대기 중인 컴포넌트는 건너뜀
+	return ObjectIndex.FindComponentByName(ComponentName);
 }
 
 AActor* UWorld::SpawnActor(UClass* Class, const FTransform& Transform)
@@ -741,9 +753,6 @@ bool UWorld::TryMarkOverlapPair(const AActor* Actor, const AActor* B)
 
 	uint64 Key = HashCombine(Key1, Key2);
 
-	if (FrameOverlapPairs.Contains(Key))
-		return false;
-
-	FrameOverlapPairs.Add(Key);
-	return true;
+	// 이미 있으면 insert가 false (한 번의 탐사)
+	return FrameOverlapPairs.insert(Key).second;
 }
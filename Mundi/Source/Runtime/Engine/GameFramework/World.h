@@ -5,6 +5,8 @@
 #include "Level.h"
 #include "Gizmo/GizmoActor.h"
 #include "LightManager.h"
+#include "TickTaskManager.h"
+#include "WorldObjectIndex.h"
 
 // Forward Declarations
 class UResourceManager;
@@ -75,10 +77,15 @@ public:
     T* FindComponent();
     template<typename T>
     TArray<T*> FindActors();
-    // ObjectName으로 '첫 번째' 액터를 찾아 반환합니다.
+    // ObjectName으로 '첫 번째' 액터를 찾아 반환합니다. (이름 색인 조회, O(1))
     AActor* FindActorByName(const FName& ActorName);
-    // 모든 액터의 모든 컴포넌트를 순회하여 ObjectName으로 '첫 번째' 컴포넌트를 찾아 반환합니다 (비용이 매우 크므로 매 프레임 호출을 권장하지 않습니다.)
+    // ObjectName으로 레벨 액터의 '첫 번째' 컴포넌트를 찾아 반환합니다. (이름 색인 조회, O(1))
     UActorComponent* FindComponentByName(const FName& ComponentName);
+    AActor* FindActorByUUID(uint32 UUID) const { return ObjectIndex.FindActorByUUID(UUID); }
+    UActorComponent* FindComponentByUUID(uint32 UUID) const { return ObjectIndex.FindComponentByUUID(UUID); }
+    // 레벨에 들어간 액터/컴포넌트의 이름이 바뀐 뒤 호출 (이름 색인 갱신, UObject::SetName이 호출함)
+    void NotifyObjectRenamed(UObject* Object) { ObjectIndex.Rename(Object); }
+    FWorldObjectIndex& GetObjectIndex() { return ObjectIndex; }
 
     AActor* SpawnActor(UClass* Class, const FTransform& Transform);
     AActor* SpawnActor(UClass* Class);
@@ -122,6 +129,7 @@ public:
 
     /** === 타임 / 틱 === */
     virtual void Tick(float DeltaSeconds);
+    FTickTaskManager& GetTickManager() { return TickManager; }
     // Overlap pair de-duplication (per-frame)
     bool TryMarkOverlapPair(const AActor* A, const AActor* B);
 
@@ -135,7 +143,11 @@ public:
     UWorldPartitionManager* GetPartitionManager() { return Partition.get(); }
 
     // PIE용 World 생성
+    // 스냅샷 모드: 에디터 레벨을 메모리 스냅샷(쿡 레벨 포맷)으로 한 번 직렬화한 뒤 새 레벨로 생성하고 BVH를 일괄 빌드
+    // 복제 모드: 액터마다 Duplicate()로 깊은 복사 후 컴포넌트 단위로 등록 (기존 방식)
     static UWorld* DuplicateWorldForPIE(UWorld* InEditorWorld);
+    static void SetPIESnapshotDuplication(bool bEnable) { bPIESnapshotDuplication = bEnable; }
+    static bool IsPIESnapshotDuplication() { return bPIESnapshotDuplication; }
 
     /** Timing Function */
     float GetDeltaTime(EDeltaTime type);
@@ -147,6 +159,11 @@ public:
 private:
     bool DestroyActor(AActor* Actor);   // 즉시 삭제
 
+    // 스냅샷으로 PIE 레벨 생성 (실패 시 false, PIEWorld는 그대로)
+    static bool DuplicateLevelBySnapshot(UWorld* InEditorWorld, UWorld* PIEWorld);
+
+    static bool bPIESnapshotDuplication;
+
 private:
     /** === 에디터 특수 액터 관리 === */
     TArray<AActor*> EditorActors;
@@ -165,6 +182,12 @@ private:
 
     /** === 루아 매니저 ===*/
     std::unique_ptr<FLuaManager> LuaManager;
+
+    /** === 틱 매니저 === */
+    FTickTaskManager TickManager;
+
+    /** === 이름/UUID 색인 (레벨 액터와 그 컴포넌트) === */
+    FWorldObjectIndex ObjectIndex;
     
     // Object naming system
     TMap<FString, int32> ObjectTypeCounts;
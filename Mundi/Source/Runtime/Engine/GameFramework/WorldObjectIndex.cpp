@@ -0,0 +1,210 @@
+﻿#include "pch.h"
+#include "WorldObjectIndex.h"
+
+namespace
+{
+	bool IsLiveObject(const AActor* Actor)
+	{
+		return Actor && !Actor->IsPendingDestroy();
+	}
+
+	bool IsLiveObject(const UActorComponent* Component)
+	{
+		return Component && !Component->IsPendingDestroy() && IsLiveObject(Component->GetOwner());
+	}
+}
+
+template<typename T>
+bool FWorldObjectIndex::TObjectTable<T>::Add(T* Object)
+{
+	if (!Object || ByUUID.Contains(Object->UUID))
+	{
+		return false;
+	}
+
+	ByUUID.Add(Object->UUID, FEntry{ Object, Object->ObjectName, NextAddOrder++ });
+	ByName[Object->ObjectName].Add(Object);
+	return true;
+}
+
+template<typename T>
+bool FWorldObjectIndex::TObjectTable<T>::Remove(T* Object)
+{
+	if (!Object)
+	{
+		return false;
+	}
+
+	FEntry* Entry = ByUUID.Find(Object->UUID);
+	if (!Entry || Entry->Object != Object)
+	{
+		return false;
+	}
+
+	if (TArray<T*>* Bucket = ByName.Find(Entry->IndexedName))
+	{
+		// 같은 이름 안에서는 추가 순서를 유지 ('첫 번째' 결과가 바뀌지 않도록)
+		Bucket->Remove(Object);
+		if (Bucket->IsEmpty())
+		{
+			ByName.Remove(Entry->IndexedName);
+		}
+	}
+	ByUUID.Remove(Object->UUID);
+	return true;
+}
+
+template<typename T>
+bool FWorldObjectIndex::TObjectTable<T>::Rename(T* Object)
+{
+	FEntry* Entry = ByUUID.Find(Object->UUID);
+	if (!Entry || Entry->Object != Object || Entry->IndexedName == Object->ObjectName)
+	{
+		return false;
+	}
+
+	if (TArray<T*>* OldBucket = ByName.Find(Entry->IndexedName))
+	{
+		OldBucket->Remove(Object);
+		if (OldBucket->IsEmpty())
+		{
+			ByName.Remove(Entry->IndexedName);
+		}
+	}
+	Entry->IndexedName = Object->ObjectName;
+
+	// 새 이름 목록에는 추가 순서 자리에 끼워 넣음
+	// (맨 뒤에 붙이면 이름을 바꿨다 되돌렸을 때 '첫 번째' 결과가 레벨 순서와 달라짐)
+	TArray<T*>& NewBucket = ByName[Entry->IndexedName];
+	int32 InsertIndex = NewBucket.Num();
+	while (InsertIndex > 0)
+	{
+		const FEntry* Previous = ByUUID.Find(NewBucket[InsertIndex - 1]->UUID);
+		if (Previous && Previous->AddOrder < Entry->AddOrder)
+		{
+			break;
+		}
+		--InsertIndex;
+	}
+	NewBucket.Insert(Object, InsertIndex);
+	return true;
+}
+
+template<typename T>
+T* FWorldObjectIndex::TObjectTable<T>::FindByName(const FName& Name) const
+{
+	const TArray<T*>* Bucket = ByName.Find(Name);
+	if (!Bucket)
+	{
+		return nullptr;
+	}
+
+	for (T* Object : *Bucket)
+	{
+		// 알림 없이 이름이 바뀐 오브젝트는 잘못된 결과가 되지 않도록 제외
+		if (IsLiveObject(Object) && Object->ObjectName == Name)
+		{
+			return Object;
+		}
+	}
+	return nullptr;
+}
+
+template<typename T>
+T* FWorldObjectIndex::TObjectTable<T>::FindByUUID(uint32 UUID) const
+{
+	const FEntry* Entry = ByUUID.Find(UUID);
+	return (Entry && IsLiveObject(Entry->Object)) ? Entry->Object : nullptr;
+}
+
+template<typename T>
+void FWorldObjectIndex::TObjectTable<T>::Clear()
+{
+	ByUUID.Empty();
+	ByName.Empty();
+	NextAddOrder = 0;
+}
+
+void FWorldObjectIndex::AddActor(AActor* Actor)
+{
+	if (!Actors.Add(Actor))
+	{
+		return;
+	}
+
+	// 월드에 들어오기 전에 이미 등록된 컴포넌트는 RegisterComponent로 다시 들어오지 않으므로 여기서 추가
+	for (UActorComponent* Component : Actor->GetOwnedComponents())
+	{
+		Components.Add(Component);
+	}
+}
+
+void FWorldObjectIndex::RemoveActor(AActor* Actor)
+{
+	if (!Actors.Remove(Actor))
+	{
+		return;
+	}
+
+	for (UActorComponent* Component : Actor->GetOwnedComponents())
+	{
+		Components.Remove(Component);
+	}
+}
+
+void FWorldObjectIndex::AddComponent(UActorComponent* Component)
+{
+	if (!Component)
+	{
+		return;
+	}
+
+	AActor* Owner = Component->GetOwner();
+	if (Owner && Actors.ByUUID.Contains(Owner->UUID))
+	{
+		Components.Add(Component);
+	}
+}
+
+void FWorldObjectIndex::RemoveComponent(UActorComponent* Component)
+{
+	Components.Remove(Component);
+}
+
+void FWorldObjectIndex::Rename(UObject* Object)
+{
+	if (AActor* Actor = Cast<AActor>(Object))
+	{
+		Actors.Rename(Actor);
+	}
+	else if (UActorComponent* Component = Cast<UActorComponent>(Object))
+	{
+		Components.Rename(Component);
+	}
+}
+
+void FWorldObjectIndex::Clear()
+{
+	Actors.Clear();
+	Components.Clear();
+}
+
+AActor* FWorldObjectIndex::FindActorByName(const FName& Name) const
+{
+	return Actors.FindByName(Name);
+}
+
+AActor* FWorldObjectIndex::FindActorByUUID(uint32 UUID) const
+{
+	return Actors.FindByUUID(UUID);
+}
+
+UActorComponent* FWorldObjectIndex::FindComponentByName(const FName& Name) const
+{
+	return Components.FindByName(Name);
+}
+
+UActorComponent* FWorldObjectIndex::FindComponentByUUID(uint32 UUID) const
+{
+	return Components.FindByUUID(UUID);
+}
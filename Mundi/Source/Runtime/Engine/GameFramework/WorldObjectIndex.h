@@ -0,0 +1,68 @@
+﻿#pragma once
+#include "UEContainer.h"
+#include "Name.h"
+
+class UObject;
+class AActor;
+class UActorComponent;
+
+/**
+ * 월드의 액터/컴포넌트 이름, UUID 색인 (UWorld::FindActorByName, FindComponentByName 등)
+ *
+ * 레벨에 들어온 액터와 그 액터가 소유한 컴포넌트만 색인합니다 (그리드/기즈모 같은 에디터 액터 제외).
+ * - UUID -> 오브젝트와 색인할 때의 이름
+ * - 이름 -> 그 이름을 가진 오브젝트 목록 (ObjectName은 고유하지 않으므로 추가 순서대로 보관, 이름을 바꿔도 유지)
+ * 스폰/등록/파괴 시 UWorld와 UActorComponent가 갱신하고, 이름 변경은 UObject::SetName이
+ * UWorld::NotifyObjectRenamed로 알려 이름 목록이 따라갑니다.
+ */
+class FWorldObjectIndex
+{
+public:
+	// 액터와 현재 소유한 컴포넌트를 함께 추가
+	void AddActor(AActor* Actor);
+	void RemoveActor(AActor* Actor);
+
+	// 소유 액터가 색인에 있을 때만 추가됨
+	void AddComponent(UActorComponent* Component);
+	void RemoveComponent(UActorComponent* Component);
+
+	// 색인된 오브젝트면 이름 목록을 현재 ObjectName 기준으로 옮김
+	void Rename(UObject* Object);
+
+	void Clear();
+
+	// 이름이 같으면 먼저 추가된 오브젝트 반환, 파괴 대기 중인 오브젝트는 건너뜀
+	AActor* FindActorByName(const FName& Name) const;
+	AActor* FindActorByUUID(uint32 UUID) const;
+	UActorComponent* FindComponentByName(const FName& Name) const;
+	UActorComponent* FindComponentByUUID(uint32 UUID) const;
+
+	int32 GetActorCount() const { return Actors.ByUUID.Num(); }
+	int32 GetComponentCount() const { return Components.ByUUID.Num(); }
+
+private:
+	template<typename T>
+	struct TObjectTable
+	{
+		struct FEntry
+		{
+			T* Object = nullptr;
+			FName IndexedName;		// 이름 목록에서 지울 때 사용 (ObjectName은 이미 바뀌었을 수 있음)
+			uint64 AddOrder = 0;	// 색인에 들어온 순서 (이름 목록 정렬 기준)
+		};
+
+		TMap<uint32, FEntry> ByUUID;
+		TMap<FName, TArray<T*>> ByName;	// 목록마다 AddOrder 오름차순
+		uint64 NextAddOrder = 0;
+
+		bool Add(T* Object);
+		bool Remove(T* Object);
+		bool Rename(T* Object);
+		T* FindByName(const FName& Name) const;
+		T* FindByUUID(uint32 UUID) const;
+		void Clear();
+	};
+
+	TObjectTable<AActor> Actors;
+	TObjectTable<UActorComponent> Components;
+};
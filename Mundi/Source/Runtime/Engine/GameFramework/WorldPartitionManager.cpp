@@ -9,9 +9,40 @@
 #include "StaticMeshComponent.h"
 #include "Frustum.h"
 #include "Gizmo/GizmoActor.h"
+#include <execution>
+#include <numeric>
 
 IMPLEMENT_CLASS(UWorldPartitionManager)
 
+namespace
+{
+	// 쿼리를 BVH 묶음 크기로 나눠 병렬 실행 (묶음이 하나뿐이면 호출 스레드에서 실행)
+	// PacketFunc(Begin, Num)
+	template<typename PacketFunc>
+	void ParallelForPackets(int32 Count, PacketFunc Func)
+	{
+		const int32 PacketSize = FBVHierarchy::MaxPacketSize;
+		const int32 PacketCount = (Count + PacketSize - 1) / PacketSize;
+		if (PacketCount <= 1)
+		{
+			if (Count > 0)
+			{
+				Func(0, Count);
+			}
+			return;
+		}
+
+		TArray<int32> Packets;
+		Packets.SetNum(PacketCount);
+		std::iota(Packets.begin(), Packets.end(), 0);
+		std::for_each(std::execution::par, Packets.begin(), Packets.end(), [&](int32 Packet)
+		{
+			const int32 Begin = Packet * PacketSize;
+			Func(Begin, std::min(PacketSize, Count - Begin));
+		});
+	}
+}
+
 UWorldPartitionManager::UWorldPartitionManager()
 {
 	//FBound WorldBounds(FVector(-50, -50, -50), FVector(50, 50, 50));
@@ -59,9 +90,9 @@ void UWorldPartitionManager::BulkRegister(const TArray<AActor*>& Actors)
 	TArray<UPrimitiveComponent*> StaticMeshComponents;
 	StaticMeshComponents.Reserve(Actors.size());
 
+	const TArray<AActor*>& EditorActors = GWorld->GetEditorActors();
 	for (AActor* Actor : Actors)
 	{
-		TArray<AActor*> EditorActors = GWorld->GetEditorActors();
 		auto it = std::find(EditorActors.begin(), EditorActors.end(), Actor);
 		if (it != EditorActors.end())
 			continue; // 에디터 액터는 포함하지 않는다.
@@ -176,9 +207,18 @@ void UWorldPartitionManager::RayQueryClosest(FRay InRay, OUT AActor*& OutActor,
     //{
     //    SceneOctree->QueryRayClosest(InRay, OutActor, OutBestT);
     //}
-	if (BVH)
+
+	// 피킹: 에디터에서 숨기지 않은 스태틱 메시 대상, 호출자가 넘긴 값(예: far plane)이 유효하면 최대 거리로 사용
+	FCollisionQueryParams Params;
+	Params.ComponentClass = UStaticMeshComponent::StaticClass();
+	Params.bIgnoreHiddenInEditor = true;
+	const float MaxDistance = (std::isfinite(OutBestT) && OutBestT > 0.0f) ? OutBestT : FLT_MAX;
+
+	FHitResult Hit;
+	if (RaycastClosest(InRay, MaxDistance, Hit, Params))
 	{
-		BVH->QueryRayClosest(InRay, OutActor, OutBestT);
+		OutActor = Hit.Actor;
+		OutBestT = Hit.Distance;
 	}
 }
 
@@ -190,6 +230,64 @@ void UWorldPartitionManager::FrustumQuery(FFrustum InFrustum)
 	}
 }
 
+bool UWorldPartitionManager::RaycastClosest(const FRay& Ray, float MaxDistance, OUT FHitResult& OutHit, const FCollisionQueryParams& Params) const
+{
+	OutHit = FHitResult();
+	return BVH && BVH->Raycast(Ray, MaxDistance, Params, false, OutHit);
+}
+
+bool UWorldPartitionManager::RaycastAny(const FRay& Ray, float MaxDistance, OUT FHitResult& OutHit, const FCollisionQueryParams& Params) const
+{
+	OutHit = FHitResult();
+	return BVH && BVH->Raycast(Ray, MaxDistance, Params, true, OutHit);
+}
+
+bool UWorldPartitionManager::SweepClosest(const FSweepRequest& Sweep, OUT FHitResult& OutHit, const FCollisionQueryParams& Params) const
+{
+	OutHit = FHitResult();
+	return BVH && BVH->Sweep(Sweep, Params, OutHit);
+}
+
+bool UWorldPartitionManager::Overlap(const FShape& Shape, const FTransform& Transform, OUT TArray<FOverlapInfo>& OutOverlaps, const FCollisionQueryParams& Params) const
+{
+	OutOverlaps.Empty();
+	if (BVH)
+	{
+		BVH->Overlap(Shape, Transform, Params, OutOverlaps);
+	}
+	return !OutOverlaps.IsEmpty();
+}
+
+void UWorldPartitionManager::BatchRaycast(const TArray<FRaycastRequest>& Requests, OUT TArray<FHitResult>& OutHits, const FCollisionQueryParams& Params, bool bAnyHit) const
+{
+	OutHits.SetNum(Requests.Num());
+	if (!BVH)
+	{
+		std::fill(OutHits.begin(), OutHits.end(), FHitResult());
+		return;
+	}
+
+	ParallelForPackets(Requests.Num(), [&](int32 Begin, int32 Num)
+	{
+		BVH->RaycastPacket(Requests.data() + Begin, Num, Params, bAnyHit, OutHits.data() + Begin);
+	});
+}
+
+void UWorldPartitionManager::BatchSweep(const TArray<FSweepRequest>& Requests, OUT TArray<FHitResult>& OutHits, const FCollisionQueryParams& Params) const
+{
+	OutHits.SetNum(Requests.Num());
+	if (!BVH)
+	{
+		std::fill(OutHits.begin(), OutHits.end(), FHitResult());
+		return;
+	}
+
+	ParallelForPackets(Requests.Num(), [&](int32 Begin, int32 Num)
+	{
+		BVH->SweepPacket(Requests.data() + Begin, Num, Params, OutHits.data() + Begin);
+	});
+}
+
 void UWorldPartitionManager::ClearSceneOctree()
 {
 	if (SceneOctree)
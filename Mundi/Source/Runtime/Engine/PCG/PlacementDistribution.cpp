@@ -5,13 +5,12 @@
 FPlacementDistribution::FPlacementDistribution()
     : Extent(100.0f, 100.0f, 100.0f)
     , Rng(12345)
-    , Dist01(0.0f, 1.0f)
 {
 }
 
 void FPlacementDistribution::SetSeed(int32 Seed)
 {
-    Rng.seed(Seed);
+    Rng.Initialize(static_cast<uint32>(Seed));
 }
 
 void FPlacementDistribution::SetBounds(const FVector& InExtent)
@@ -21,7 +20,7 @@ void FPlacementDistribution::SetBounds(const FVector& InExtent)
 
 float FPlacementDistribution::RandomFloat()
 {
-    return Dist01(Rng);
+    return Rng.GetFraction();
 }
 
 float FPlacementDistribution::RandomFloatInRange(float Min, float Max)
@@ -31,17 +30,16 @@ float FPlacementDistribution::RandomFloatInRange(float Min, float Max)
 
 int32 FPlacementDistribution::RandomInt(int32 Min, int32 Max)
 {
-    std::uniform_int_distribution<int32> Dist(Min, Max);
-    return Dist(Rng);
+    return Rng.RandRange(Min, Max);
 }
 
 FVector FPlacementDistribution::RandomPointInBounds()
 {
-    return FVector(
-        RandomFloatInRange(-Extent.X, Extent.X),
-        RandomFloatInRange(-Extent.Y, Extent.Y),
-        RandomFloatInRange(-Extent.Z, Extent.Z)
-    );
+    // 인자 평가 순서는 컴파일러마다 다르므로 축 순서대로 뽑음
+    const float X = RandomFloatInRange(-Extent.X, Extent.X);
+    const float Y = RandomFloatInRange(-Extent.Y, Extent.Y);
+    const float Z = RandomFloatInRange(-Extent.Z, Extent.Z);
+    return FVector(X, Y, Z);
 }
 
 TArray<FVector> FPlacementDistribution::GeneratePoints(EDistributionType Type, int32 Count, float MinDistance)
@@ -1,7 +1,7 @@
 #pragma once
 
 #include "Vector.h"
-#include <random>
+#include "RandomStream.h"
 
 enum class EDistributionType : uint8
 {
@@ -16,6 +16,7 @@ class FPlacementDistribution
 public:
     FPlacementDistribution();
 
+    // 같은 시드는 플랫폼/컴파일러와 무관하게 같은 배치를 만듭니다.
     void SetSeed(int32 Seed);
     void SetBounds(const FVector& InExtent);
 
@@ -34,6 +35,5 @@ public:
 
 private:
     FVector Extent;
-    std::mt19937 Rng;
-    std::uniform_real_distribution<float> Dist01;
+    FRandomStream Rng;
 };
@@ -9,7 +9,7 @@
 #include "ObjectFactory.h"
 #include "PathUtils.h"
 #include "Picking.h"
-#include "MeshBVH.h"
+#include "WorldPartitionManager.h"
 #include "VertexData.h"
 #include <random>
 #include <ctime>
@@ -97,14 +97,7 @@ void AProceduralPlacementVolume::Generate()
     FVector Extent = VolumeComponent->GetBoxExtent();
     Distribution.SetBounds(Extent);
 
-    // 표면 배치 모드면 BVH 캐시 먼저 빌드 (SpawnedActors로 이전 액터 제외 가능)
-    // ClearPlacement 전에 빌드해야 SpawnedActors.Contains() 체크가 작동함
-    if (bPlaceOnSurface)
-    {
-        BuildBVHCache();
-    }
-
-    // BVH 캐시 빌드 후 이전 액터들 삭제
+    // 이전 액터들 삭제 (파티션에서도 즉시 빠지므로 표면 레이캐스트에 걸리지 않음)
     ClearPlacement();
 
     TArray<FVector> Points = GeneratePoints();
@@ -165,9 +158,6 @@ void AProceduralPlacementVolume::Generate()
             SpawnMeshAtPoint(Point, SelectedEntry);
         }
     }
-
-    // BVH 캐시 정리
-    ClearBVHCache();
 }
 
 void AProceduralPlacementVolume::ClearPlacement()
@@ -249,11 +239,11 @@ FTransform AProceduralPlacementVolume::GenerateRandomTransform(const FVector& Po
         }
         else
         {
-            Transform.Scale3D = FVector(
-                Distribution.RandomFloatInRange(ScaleMin.X, ScaleMax.X),
-                Distribution.RandomFloatInRange(ScaleMin.Y, ScaleMax.Y),
-                Distribution.RandomFloatInRange(ScaleMin.Z, ScaleMax.Z)
-            );
+            // 인자 평가 순서는 컴파일러마다 다르므로 축 순서대로 뽑음 (같은 시드 = 같은 배치)
+            const float ScaleX = Distribution.RandomFloatInRange(ScaleMin.X, ScaleMax.X);
+            const float ScaleY = Distribution.RandomFloatInRange(ScaleMin.Y, ScaleMax.Y);
+            const float ScaleZ = Distribution.RandomFloatInRange(ScaleMin.Z, ScaleMax.Z);
+            Transform.Scale3D = FVector(ScaleX, ScaleY, ScaleZ);
         }
     }
     else
@@ -291,67 +281,29 @@ bool AProceduralPlacementVolume::RaycastToSurface(const FVector& Origin, const F
     if (!World)
         return false;
 
-    float ClosestDistance = FLT_MAX;
-    bool bHit = false;
+    UWorldPartitionManager* Partition = World->GetPartitionManager();
+    if (!Partition)
+        return false;
 
-    // 캐시된 BVH 사용
-    for (auto& Pair : BVHCache)
+    // 월드 파티션 BVH로 후보를 추리고, 메시는 리소스 매니저에 캐시된 메시 BVH로 검사
+    // 자기 자신과 이번 Generate에서 스폰한 액터는 표면으로 취급하지 않음
+    FCollisionQueryParams Params;
+    Params.ComponentClass = UStaticMeshComponent::StaticClass();
+    // 방어 코드: 노말이 레이와 같은 방향인 히트(뒷면)는 무효
+    Params.bIgnoreBackFaces = true;
+    Params.AddIgnoredActor(this);
+    for (AActor* SpawnedActor : SpawnedActors)
     {
-        FBVHCacheEntry* CacheEntry = Pair.second;
-        if (!CacheEntry || !CacheEntry->BVH || !CacheEntry->MeshAsset)
-            continue;
-
-        // 캐시된 행렬 사용
-        const FMatrix& WorldMatrix = CacheEntry->WorldMatrix;
-        const FMatrix& InvWorld = CacheEntry->InvWorldMatrix;
-
-        FVector4 RayOrigin4(Origin.X, Origin.Y, Origin.Z, 1.0f);
-        FVector4 RayDir4(Direction.X, Direction.Y, Direction.Z, 0.0f);
-        FVector4 LocalOrigin4 = RayOrigin4 * InvWorld;
-        FVector4 LocalDir4 = RayDir4 * InvWorld;
-
-        FRay LocalRay;
-        LocalRay.Origin = FVector(LocalOrigin4.X, LocalOrigin4.Y, LocalOrigin4.Z);
-        LocalRay.Direction = FVector(LocalDir4.X, LocalDir4.Y, LocalDir4.Z).GetNormalized();
-
-        // 캐시된 BVH로 레이캐스트
-        float HitDistance = 0.0f;
-        FVector HitNormal;
-
-        FStaticMesh* MeshAsset = CacheEntry->MeshAsset;
-        if (CacheEntry->BVH->IntersectRayWithNormal(LocalRay, MeshAsset->Vertices, MeshAsset->Indices, HitDistance, HitNormal))
-        {
-            // 로컬 → 월드 변환
-            FVector LocalHitPoint = LocalRay.Origin + LocalRay.Direction * HitDistance;
-            FVector4 LocalHitPoint4(LocalHitPoint.X, LocalHitPoint.Y, LocalHitPoint.Z, 1.0f);
-            FVector4 WorldHitPoint4 = LocalHitPoint4 * WorldMatrix;
-
-            float WorldDistance = (FVector(WorldHitPoint4.X, WorldHitPoint4.Y, WorldHitPoint4.Z) - Origin).Size();
-
-            if (WorldDistance < ClosestDistance)
-            {
-                // 노멀을 월드 공간으로 변환 (방향 벡터)
-                FVector4 LocalNormal4(HitNormal.X, HitNormal.Y, HitNormal.Z, 0.0f);
-                FMatrix NormalMatrix = InvWorld.Transpose();
-                FVector4 WorldNormal4 = LocalNormal4 * NormalMatrix;
-                FVector WorldNormal = FVector(WorldNormal4.X, WorldNormal4.Y, WorldNormal4.Z).GetNormalized();
-
-                // 방어 코드: 월드 공간에서 노말이 레이와 같은 방향이면 무효한 히트
-                // (정상적인 표면 히트라면 노말은 레이를 향해야 함 → 내적이 음수)
-                if (FVector::Dot(WorldNormal, Direction) > 0.0f)
-                {
-                    continue;  // 이 히트 무시, 다음 메시 검사
-                }
-
-                ClosestDistance = WorldDistance;
-                OutHitPoint = FVector(WorldHitPoint4.X, WorldHitPoint4.Y, WorldHitPoint4.Z);
-                OutHitNormal = WorldNormal;
-                bHit = true;
-            }
-        }
+        Params.AddIgnoredActor(SpawnedActor);
     }
 
-    return bHit;
+    FHitResult Hit;
+    if (!Partition->RaycastClosest(FRay{ Origin, Direction.GetNormalized() }, FLT_MAX, Hit, Params))
+        return false;
+
+    OutHitPoint = Hit.ImpactPoint;
+    OutHitNormal = Hit.ImpactNormal;
+    return true;
 }
 
 void AProceduralPlacementVolume::SpawnMeshAtSurfacePoint(const FVector& WorldPosition, const FVector& SurfaceNormal, UPlacementMeshEntry* Entry)
@@ -397,11 +349,11 @@ FTransform AProceduralPlacementVolume::GenerateRandomTransformWithNormal(const F
         }
         else
         {
-            Transform.Scale3D = FVector(
-                Distribution.RandomFloatInRange(ScaleMin.X, ScaleMax.X),
-                Distribution.RandomFloatInRange(ScaleMin.Y, ScaleMax.Y),
-                Distribution.RandomFloatInRange(ScaleMin.Z, ScaleMax.Z)
-            );
+            // 인자 평가 순서는 컴파일러마다 다르므로 축 순서대로 뽑음 (같은 시드 = 같은 배치)
+            const float ScaleX = Distribution.RandomFloatInRange(ScaleMin.X, ScaleMax.X);
+            const float ScaleY = Distribution.RandomFloatInRange(ScaleMin.Y, ScaleMax.Y);
+            const float ScaleZ = Distribution.RandomFloatInRange(ScaleMin.Z, ScaleMax.Z);
+            Transform.Scale3D = FVector(ScaleX, ScaleY, ScaleZ);
         }
     }
     else
@@ -440,59 +392,6 @@ FTransform AProceduralPlacementVolume::GenerateRandomTransformWithNormal(const F
     return Transform;
 }
 
-void AProceduralPlacementVolume::BuildBVHCache()
-{
-    ClearBVHCache();
-
-    if (!World)
-        return;
-
-    TArray<AActor*> Actors = World->GetActors();
-    for (AActor* Actor : Actors)
-    {
-        if (!Actor || Actor == this)
-            continue;
-
-        // 이미 스폰한 액터는 제외
-        if (SpawnedActors.Contains(Actor))
-            continue;
-
-        UStaticMeshComponent* MeshComp = Cast<UStaticMeshComponent>(Actor->GetComponent(UStaticMeshComponent::StaticClass()));
-        if (!MeshComp)
-            continue;
-
-        UStaticMesh* Mesh = MeshComp->GetStaticMesh();
-        if (!Mesh)
-            continue;
-
-        FStaticMesh* MeshAsset = Mesh->GetStaticMeshAsset();
-        if (!MeshAsset)
-            continue;
-
-        // BVH 캐시 엔트리 생성
-        FBVHCacheEntry* CacheEntry = new FBVHCacheEntry();
-        CacheEntry->WorldMatrix = Actor->GetActorTransform().ToMatrix();
-        CacheEntry->InvWorldMatrix = CacheEntry->WorldMatrix.InverseAffine();
-        CacheEntry->MeshAsset = MeshAsset;
-        CacheEntry->BVH = new FMeshBVH();
-        CacheEntry->BVH->Build(MeshAsset->Vertices, MeshAsset->Indices);
-
-        BVHCache.Add(MeshComp, CacheEntry);
-    }
-}
-
-void AProceduralPlacementVolume::ClearBVHCache()
-{
-    for (auto& Pair : BVHCache)
-    {
-        if (Pair.second)
-        {
-            delete Pair.second;
-        }
-    }
-    BVHCache.Empty();
-}
-
 UPlacementMeshEntry* AProceduralPlacementVolume::SelectMeshEntryByWeight()
 {
     if (PlacementMeshes.Num() == 0 || TotalWeight <= 0.0f)
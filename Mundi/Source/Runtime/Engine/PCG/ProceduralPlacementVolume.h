@@ -2,7 +2,6 @@
 
 #include "Actor.h"
 #include "PlacementDistribution.h"
-#include "MeshBVH.h"
 #include "PlacementMeshEntry.h"
 #include "AProceduralPlacementVolume.generated.h"
 
@@ -11,24 +10,6 @@ class UStaticMeshComponent;
 class UStaticMesh;
 class UBillboardComponent;
 
-// BVH 캐시 엔트리
-struct FBVHCacheEntry
-{
-    FMeshBVH* BVH = nullptr;
-    FStaticMesh* MeshAsset = nullptr;
-    FMatrix WorldMatrix;
-    FMatrix InvWorldMatrix;
-
-    ~FBVHCacheEntry()
-    {
-        if (BVH)
-        {
-            delete BVH;
-            BVH = nullptr;
-        }
-    }
-};
-
 UCLASS(DisplayName="Procedural Placement Volume", Description="Procedurally places meshes within the volume")
 class AProceduralPlacementVolume : public AActor
 {
@@ -59,10 +40,6 @@ protected:
     bool PassesDensityCheck(const FVector& Position);
     bool RaycastToSurface(const FVector& Origin, const FVector& Direction, FVector& OutHitPoint, FVector& OutHitNormal);
 
-    // BVH 캐시 관리
-    void BuildBVHCache();
-    void ClearBVHCache();
-
     // 가중치 기반 메시 엔트리 선택
     UPlacementMeshEntry* SelectMeshEntryByWeight();
 
@@ -76,9 +53,6 @@ protected:
     // 가중치 합계 (캐싱)
     float TotalWeight = 0.0f;
 
-    // BVH 캐시 (레이캐스트 성능 최적화)
-    TMap<UStaticMeshComponent*, FBVHCacheEntry*> BVHCache;
-
     // Density settings
     UPROPERTY(EditAnywhere, Category="Placement|Density", Tooltip="Target placement count")
     int32 TargetCount = 100;
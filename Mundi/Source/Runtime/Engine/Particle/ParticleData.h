@@ -65,11 +65,21 @@ struct FParticleContext
     // 파티클 인덱스 (이벤트 생성용)
     int32 ParticleIndex;
 
-    FParticleContext(FBaseParticle* InParticle, UParticleSystemComponent* InOwner, int32 InParticleIndex = -1)
+    // 에미터 인스턴스의 난수 스트림 (없으면 스레드 기본 스트림 사용)
+    FRandomStream* RandomStream;
+
+    FParticleContext(FBaseParticle* InParticle, UParticleSystemComponent* InOwner, int32 InParticleIndex = -1, FRandomStream* InRandomStream = nullptr)
         : Particle(InParticle)
         , Owner(InOwner)
         , ParticleIndex(InParticleIndex)
+        , RandomStream(InRandomStream)
     {}
+
+    // 모듈은 난수가 필요할 때 반드시 이 스트림을 사용해야 같은 시드로 같은 결과가 재현됩니다.
+    FRandomStream& GetRandomStream() const
+    {
+        return RandomStream ? *RandomStream : FRandomStream::GetThreadStream();
+    }
 };
 
 // FParticleDataContainer는 파티클 시스템의 런타임 메모리 블록을 관리합니다.
@@ -75,6 +75,8 @@ void FParticleEmitterInstance::CopyFrom(const FParticleEmitterInstance& Other)
     EmitterDuration = Other.EmitterDuration;
     Duration = Other.Duration;
     ActiveParticles = Other.ActiveParticles;
+    RibbonRingStart = Other.RibbonRingStart;
+    RandomStream = Other.RandomStream;
 
     // ParticleData 깊은 복사
     if (Other.ParticleData && MaxActiveParticles > 0 && ParticleStride > 0)
@@ -105,12 +107,17 @@ void FParticleEmitterInstance::Update(float DeltaTime)
     // 현재 LOD 인덱스 가져오기
     const int32 CurrentLOD = CurrentLODLevelIndex;
 
+    // Ribbon: 스폰 순서를 유지해야 하므로 루프 안에서 swap-and-pop 하지 않고,
+    // 모듈 갱신이 끝난 뒤 한 번의 선형 패스로 죽은 파티클을 압축합니다.
+    const bool bSpawnOrdered = IsSpawnOrdered();
+    bool bAnyDead = false;
+
     for (int32 Index = ActiveParticles - 1; Index >= 0; Index--)
     {
         DECLARE_PARTICLE_PTR(ParticleBase, ParticleData + ParticleStride * Index);
 
         // FParticleContext 생성
-        FParticleContext Context(ParticleBase, OwnerComponent);
+        FParticleContext Context(ParticleBase, OwnerComponent, -1, &RandomStream);
 
         // RequiredModule은 항상 실행 (LOD 체크 없음)
         if (RequiredModule)
@@ -129,7 +136,33 @@ void FParticleEmitterInstance::Update(float DeltaTime)
         }
 
         if (ParticleBase->RelativeTime >= ParticleBase->LifeTime)
-            KillParticle(Index);
+        {
+            if (bSpawnOrdered)
+                bAnyDead = true;
+            else
+                KillParticle(Index);
+        }
+    }
+
+    if (bAnyDead)
+    {
+        LinearizeRibbonRing();
+
+        // 살아남은 파티클을 순서대로 앞으로 당김 (안정 압축)
+        int32 WriteIndex = 0;
+        for (int32 ReadIndex = 0; ReadIndex < ActiveParticles; ++ReadIndex)
+        {
+            DECLARE_PARTICLE_PTR(ReadParticle, ParticleData + ParticleStride * ReadIndex);
+            if (ReadParticle->RelativeTime >= ReadParticle->LifeTime)
+                continue;
+
+            if (WriteIndex != ReadIndex)
+            {
+                memcpy(ParticleData + ParticleStride * WriteIndex, ReadParticle, ParticleStride);
+            }
+            ++WriteIndex;
+        }
+        ActiveParticles = WriteIndex;
     }
 
     float SpawnNumFraction = SpawnRate * DeltaTime + SpawnFraction;
@@ -163,8 +196,7 @@ void FParticleEmitterInstance::SpawnParticles
     const int32 CurrentLOD = CurrentLODLevelIndex;
 
     // Ribbon/Trail 에미터인지 확인 (파티클 재활용 필요)
-    bool bIsRibbonEmitter = TypeDataModule &&
-        (TypeDataModule->GetEmitterType() == EDynamicEmitterType::EDET_Ribbon);
+    bool bIsRibbonEmitter = IsSpawnOrdered();
 
     for (int32 Index = 0; Index < SpawnNum; Index++)
     {
@@ -174,26 +206,10 @@ void FParticleEmitterInstance::SpawnParticles
         {
             if (bIsRibbonEmitter && ActiveParticles > 0)
             {
-                // Ribbon: 가장 오래된 파티클을 찾아서 재활용
-                // SpawnTime이 가장 작은(오래된) 파티클 찾기
-                int32 OldestIndex = 0;
-                float OldestTime = FLT_MAX;
-
-                for (int32 i = 0; i < ActiveParticles; ++i)
-                {
-                    DECLARE_PARTICLE_PTR(CheckParticle, ParticleData + ParticleStride * i);
-                    FBaseParticle* BaseCheck = reinterpret_cast<FBaseParticle*>(CheckParticle);
-
-                    // RelativeTime이 가장 큰 파티클 = 가장 오래 살아있는 파티클
-                    if (BaseCheck->RelativeTime > OldestTime || OldestTime == FLT_MAX)
-                    {
-                        OldestTime = BaseCheck->RelativeTime;
-                        OldestIndex = i;
-                    }
-                }
-
-                // 가장 오래된 파티클 위치에 새 파티클 스폰
-                ParticleIndex = OldestIndex;
+                // Ribbon: 링 버퍼의 시작 슬롯이 가장 오래된 파티클이므로 그 자리에 새 파티클을 스폰하고
+                // 시작 슬롯을 한 칸 전진 (새 파티클이 링의 마지막 = 머리가 됨)
+                ParticleIndex = RibbonRingStart;
+                RibbonRingStart = (RibbonRingStart + 1 < ActiveParticles) ? RibbonRingStart + 1 : 0;
             }
             else
             {
@@ -228,7 +244,7 @@ void FParticleEmitterInstance::SpawnParticles
         ParticleBase.BaseVelocity = InitialVelocity; // BaseVelocity는 초기 속도 참조용
 
         // FParticleContext 생성
-        FParticleContext Context(&ParticleBase, OwnerComponent);
+        FParticleContext Context(&ParticleBase, OwnerComponent, -1, &RandomStream);
 
         // RequiredModule의 Spawn 호출 (필수, LOD 체크 없음)
         if (RequiredModule)
@@ -263,6 +279,25 @@ void FParticleEmitterInstance::KillParticle(int32 Index)
         return;
     }
 
+    // Ribbon: 스폰 순서를 유지하도록 뒤쪽 파티클을 한 칸씩 당김
+    if (IsSpawnOrdered())
+    {
+        // 순서 기준 인덱스로 바꾼 뒤 링을 펼쳐서 제거
+        const int32 Order = (Index >= RibbonRingStart) ? Index - RibbonRingStart : Index + ActiveParticles - RibbonRingStart;
+        LinearizeRibbonRing();
+
+        ActiveParticles--;
+        if (Order != ActiveParticles)
+        {
+            memmove(
+                ParticleData + ParticleStride * Order,
+                ParticleData + ParticleStride * (Order + 1),
+                static_cast<size_t>(ActiveParticles - Order) * ParticleStride
+            );
+        }
+        return;
+    }
+
     ActiveParticles--;
 
     // 마지막 요소가 아니면 swap-and-pop
@@ -278,12 +313,28 @@ void FParticleEmitterInstance::KillAllParticles()
 {
     // KillParticle()이 내부적으로 ActiveParticles--를 하므로
     // 역순으로 순회하면서 마지막 파티클만 계속 제거
+    // (전부 제거하므로 Ribbon 순서는 의미 없음 - 링 시작을 먼저 되돌려 memmove를 피함)
+    RibbonRingStart = 0;
     while (ActiveParticles > 0)
     {
         KillParticle(ActiveParticles - 1);
     }
 }
 
+void FParticleEmitterInstance::LinearizeRibbonRing()
+{
+    if (RibbonRingStart == 0)
+        return;
+
+    // 파티클 단위 회전은 바이트 단위 회전과 같음 (회전량이 Stride의 배수)
+    std::rotate(
+        ParticleData,
+        ParticleData + ParticleStride * RibbonRingStart,
+        ParticleData + ParticleStride * ActiveParticles
+    );
+    RibbonRingStart = 0;
+}
+
 float FParticleEmitterInstance::GetLifeTimeValue()
 {
     if (!SpriteTemplate)
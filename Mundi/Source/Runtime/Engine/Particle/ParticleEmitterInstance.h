@@ -24,6 +24,9 @@ private:
     // 복사 헬퍼 함수
     void CopyFrom(const FParticleEmitterInstance& Other);
 
+    // Ribbon 링 버퍼를 회전시켜 가장 오래된 파티클이 0번 슬롯에 오도록 정리 (RibbonRingStart = 0)
+    void LinearizeRibbonRing();
+
 public:
     
     // 템플릿 및 소유자 참조
@@ -59,6 +62,15 @@ public:
 
     int32 ActiveParticles{};        // 현재 시뮬레이션 루프에서 실제 활성화된 파티클의 수 (현재 카운트).
 
+    // Ribbon 전용: 파티클을 스폰 순서대로 보관하는 링 버퍼의 시작 슬롯 (가장 오래된 파티클)
+    // 버퍼가 가득 찬 상태에서만 0이 아닐 수 있으며, 스폰 순서 i번째 파티클은
+    // GetOrderedParticleIndex(i) 슬롯에 있습니다. 정렬 없이 꼬리(오래된 것)→머리(최신) 순회가 가능합니다.
+    int32 RibbonRingStart{};
+
+    // 이 에미터 전용 난수 스트림 (시스템 시드 + 에미터 인덱스로 초기화)
+    // 스폰 모듈과 버스트는 모두 이 스트림을 사용하므로 같은 시드는 같은 이펙트를 재현합니다.
+    FRandomStream RandomStream;
+
     // 파티클 갱신 함수 (Update 모듈 호출)
     void Update(float DeltaTime);
     
@@ -78,5 +90,15 @@ public:
 
     void KillAllParticles();
 
+    // 스폰 순서(0 = 가장 오래된 파티클)를 실제 슬롯 인덱스로 변환
+    // Ribbon이 아닌 에미터는 RibbonRingStart가 항상 0이므로 그대로 반환됩니다.
+    int32 GetOrderedParticleIndex(int32 Order) const
+    {
+        int32 Index = RibbonRingStart + Order;
+        return (Index >= ActiveParticles) ? Index - ActiveParticles : Index;
+    }
+
+    bool IsSpawnOrdered() const { return EmitterType == EDynamicEmitterType::EDET_Ribbon; }
+
     float GetLifeTimeValue();
 };
\ No newline at end of file
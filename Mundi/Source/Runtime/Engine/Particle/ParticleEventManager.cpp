@@ -5,6 +5,8 @@
 
 AParticleEventManager::AParticleEventManager()
 {
+    // 파티클 틱(PostPhysics)이 이번 프레임에 쌓은 충돌 이벤트를 처리하도록 마지막 그룹에서 틱
+    PrimaryActorTick.TickGroup = ETickingGroup::PostUpdateWork;
 }
 
 void AParticleEventManager::BeginPlay()
@@ -8,10 +8,12 @@ class UParticleSystemComponent;
 
 /**
  * Delegate types for particle events
+ * Inline-storage delegates: bind with a lambda, or TInlineDelegate::CreateWeakLambda / CreateUObject
+ * so the callback is skipped once the owning object has been destroyed
  */
-using FOnParticleCollision = std::function<void(const FParticleEventCollideData&)>;
-using FOnParticleDeath = std::function<void(const FParticleEventDeathData&)>;
-using FOnParticleSpawn = std::function<void(const FParticleEventSpawnData&)>;
+using FOnParticleCollision = TInlineDelegate<const FParticleEventCollideData&>;
+using FOnParticleDeath = TInlineDelegate<const FParticleEventDeathData&>;
+using FOnParticleSpawn = TInlineDelegate<const FParticleEventSpawnData&>;
 
 /**
  * Event receiver entry - defines how to handle received events
@@ -0,0 +1,133 @@
+#include "pch.h"
+#include "ParticleInstanceAllocator.h"
+
+// ============================================================================
+// FLinearInstanceAllocator
+// ============================================================================
+
+void FLinearInstanceAllocator::Reset(uint32 InCapacity)
+{
+    Capacity = InCapacity;
+    Cursor = 0;
+    RequestedCount = 0;
+}
+
+bool FLinearInstanceAllocator::Allocate(uint32 Count, uint32& OutOffset)
+{
+    RequestedCount += Count;
+
+    if (Count == 0 || Count > Capacity - Cursor)
+    {
+        return false;
+    }
+
+    OutOffset = Cursor;
+    Cursor += Count;
+    return true;
+}
+
+// ============================================================================
+// FFreeListInstanceAllocator
+// ============================================================================
+
+void FFreeListInstanceAllocator::Reset(uint32 InCapacity)
+{
+    Capacity = InCapacity;
+    UsedCount = 0;
+    AllocatedBlocks.Empty();
+    FreeBlocks.Empty();
+
+    if (Capacity > 0)
+    {
+        FreeBlocks.Add({ 0, Capacity });
+    }
+}
+
+bool FFreeListInstanceAllocator::Allocate(uint32 Count, uint32& OutOffset)
+{
+    if (Count == 0)
+    {
+        return false;
+    }
+
+    for (int32 i = 0; i < FreeBlocks.Num(); ++i)
+    {
+        FBlock& Block = FreeBlocks[i];
+        if (Block.Count < Count)
+        {
+            continue;
+        }
+
+        // 빈 블록의 앞부분을 떼어 준다
+        OutOffset = Block.Offset;
+        Block.Offset += Count;
+        Block.Count -= Count;
+        if (Block.Count == 0)
+        {
+            FreeBlocks.erase(FreeBlocks.begin() + i);
+        }
+
+        AllocatedBlocks.Add(OutOffset, Count);
+        UsedCount += Count;
+        return true;
+    }
+
+    return false;
+}
+
+bool FFreeListInstanceAllocator::Free(uint32 Offset)
+{
+    const uint32* FoundCount = AllocatedBlocks.Find(Offset);
+    if (!FoundCount)
+    {
+        return false;
+    }
+
+    const uint32 Count = *FoundCount;
+    AllocatedBlocks.Remove(Offset);
+    UsedCount -= Count;
+
+    // Offset 순서를 유지하는 삽입 위치
+    int32 InsertIndex = 0;
+    while (InsertIndex < FreeBlocks.Num() && FreeBlocks[InsertIndex].Offset < Offset)
+    {
+        ++InsertIndex;
+    }
+    FreeBlocks.insert(FreeBlocks.begin() + InsertIndex, FBlock{ Offset, Count });
+
+    // 뒤 블록과 병합
+    if (InsertIndex + 1 < FreeBlocks.Num())
+    {
+        FBlock& Current = FreeBlocks[InsertIndex];
+        const FBlock& Next = FreeBlocks[InsertIndex + 1];
+        if (Current.Offset + Current.Count == Next.Offset)
+        {
+            Current.Count += Next.Count;
+            FreeBlocks.erase(FreeBlocks.begin() + InsertIndex + 1);
+        }
+    }
+
+    // 앞 블록과 병합
+    if (InsertIndex > 0)
+    {
+        FBlock& Prev = FreeBlocks[InsertIndex - 1];
+        const FBlock& Current = FreeBlocks[InsertIndex];
+        if (Prev.Offset + Prev.Count == Current.Offset)
+        {
+            Prev.Count += Current.Count;
+            FreeBlocks.erase(FreeBlocks.begin() + InsertIndex);
+        }
+    }
+
+    return true;
+}
+
+uint32 FFreeListInstanceAllocator::GetLargestFreeBlock() const
+{
+    uint32 Largest = 0;
+    for (const FBlock& Block : FreeBlocks)
+    {
+        Largest = std::max(Largest, Block.Count);
+    }
+    return Largest;
+}
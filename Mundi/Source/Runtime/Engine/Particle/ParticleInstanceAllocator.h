@@ -0,0 +1,59 @@
+#pragma once
+
+#include "UEContainer.h"
+
+// 파티클 인스턴스 버퍼의 서브 할당 로직
+// GPU 리소스와 분리되어 있어 디바이스 없이도 동작을 검증할 수 있습니다.
+// 단위는 모두 "인스턴스 개수"입니다 (바이트 아님).
+
+// 프레임(패스) 단위 선형 할당기
+// 에미터마다 앞에서부터 연속 구간을 떼어 주고, Reset으로 한 번에 해제합니다.
+class FLinearInstanceAllocator
+{
+public:
+    // 용량을 지정하고 커서를 처음으로 되돌림
+    void Reset(uint32 InCapacity);
+    void Reset() { Reset(Capacity); }
+
+    // Count개의 연속 구간 할당. 용량을 넘으면 false
+    // 실패한 요청도 RequestedCount에 누적되어 다음 프레임의 버퍼 크기 결정에 사용됩니다.
+    bool Allocate(uint32 Count, uint32& OutOffset);
+
+    uint32 GetCapacity() const { return Capacity; }
+    uint32 GetUsedCount() const { return Cursor; }
+    uint32 GetRequestedCount() const { return RequestedCount; }
+
+private:
+    uint32 Capacity = 0;
+    uint32 Cursor = 0;
+    uint32 RequestedCount = 0;
+};
+
+// 프레임을 넘어 유지되는 블록 할당기 (First-Fit, 해제 시 인접 빈 블록 병합)
+// 데이터가 바뀌지 않은 에미터가 매 프레임 다시 업로드하지 않도록 영구 구간을 관리합니다.
+class FFreeListInstanceAllocator
+{
+public:
+    void Reset(uint32 InCapacity);
+
+    bool Allocate(uint32 Count, uint32& OutOffset);
+
+    // 할당된 블록의 시작 오프셋이 아니면 아무것도 하지 않고 false
+    bool Free(uint32 Offset);
+
+    uint32 GetCapacity() const { return Capacity; }
+    uint32 GetUsedCount() const { return UsedCount; }
+    uint32 GetLargestFreeBlock() const;
+
+private:
+    struct FBlock
+    {
+        uint32 Offset = 0;
+        uint32 Count = 0;
+    };
+
+    TArray<FBlock> FreeBlocks;              // Offset 오름차순 정렬 유지
+    TMap<uint32, uint32> AllocatedBlocks;   // Offset -> Count
+    uint32 Capacity = 0;
+    uint32 UsedCount = 0;
+};
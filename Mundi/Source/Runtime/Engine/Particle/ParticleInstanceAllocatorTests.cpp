@@ -0,0 +1,158 @@
+﻿#include "pch.h"
+#include "ParticleInstanceAllocatorTests.h"
+#include "ParticleInstanceAllocator.h"
+#include "TestContext.h"
+#include <random>
+
+namespace
+{
+    void TestLinearAllocator(FTestContext& Context)
+    {
+        FLinearInstanceAllocator Allocator;
+        Allocator.Reset(100);
+
+        uint32 Offset = ~0u;
+        TEST_CHECK(Context, Allocator.Allocate(40, Offset) && Offset == 0);
+        TEST_CHECK(Context, Allocator.Allocate(60, Offset) && Offset == 40);
+        TEST_CHECK(Context, !Allocator.Allocate(1, Offset));
+        TEST_CHECK(Context, !Allocator.Allocate(0, Offset));
+        TEST_CHECK(Context, Allocator.GetUsedCount() == 100);
+
+        // 실패한 요청도 다음 프레임 버퍼 크기 결정을 위해 누적된다
+        TEST_CHECK(Context, Allocator.GetRequestedCount() == 101);
+
+        // 용량은 유지한 채 처음부터 다시 할당
+        Allocator.Reset();
+        TEST_CHECK(Context, Allocator.GetCapacity() == 100);
+        TEST_CHECK(Context, Allocator.GetUsedCount() == 0 && Allocator.GetRequestedCount() == 0);
+        TEST_CHECK(Context, Allocator.Allocate(100, Offset) && Offset == 0);
+    }
+
+    void TestFreeListAllocator(FTestContext& Context)
+    {
+        FFreeListInstanceAllocator Allocator;
+        Allocator.Reset(100);
+
+        uint32 A = ~0u, B = ~0u, C = ~0u;
+        TEST_CHECK(Context, Allocator.Allocate(30, A) && A == 0);
+        TEST_CHECK(Context, Allocator.Allocate(30, B) && B == 30);
+        TEST_CHECK(Context, Allocator.Allocate(40, C) && C == 60);
+        TEST_CHECK(Context, Allocator.GetUsedCount() == 100);
+
+        uint32 Offset = ~0u;
+        TEST_CHECK(Context, !Allocator.Allocate(1, Offset));
+        TEST_CHECK(Context, !Allocator.Allocate(0, Offset));
+
+        // 가운데 블록 해제 후에는 그 크기까지만 들어간다
+        TEST_CHECK(Context, Allocator.Free(B));
+        TEST_CHECK(Context, Allocator.GetLargestFreeBlock() == 30);
+        TEST_CHECK(Context, !Allocator.Allocate(31, Offset));
+
+        // 앞 블록을 해제하면 인접한 빈 블록과 병합된다
+        TEST_CHECK(Context, Allocator.Free(A));
+        TEST_CHECK(Context, Allocator.GetLargestFreeBlock() == 60);
+        TEST_CHECK(Context, Allocator.Allocate(50, Offset) && Offset == 0);
+
+        // 할당 시작점이 아니거나 이미 해제된 오프셋은 무시
+        TEST_CHECK(Context, !Allocator.Free(99));
+        TEST_CHECK(Context, !Allocator.Free(B));
+        TEST_CHECK(Context, Allocator.Free(Offset));
+        TEST_CHECK(Context, Allocator.Free(C));
+        TEST_CHECK(Context, Allocator.GetUsedCount() == 0);
+        TEST_CHECK(Context, Allocator.GetLargestFreeBlock() == 100);
+    }
+
+    void TestFreeListRandomized(FTestContext& Context)
+    {
+        constexpr uint32 Capacity = 4096;
+        FFreeListInstanceAllocator Allocator;
+        Allocator.Reset(Capacity);
+
+        // 슬롯별 소유 블록 (-1 = 비어 있음)
+        TArray<int32> Owner;
+        Owner.SetNum(Capacity);
+        std::fill(Owner.begin(), Owner.end(), -1);
+
+        struct FLiveBlock
+        {
+            uint32 Offset;
+            uint32 Count;
+        };
+        TArray<FLiveBlock> Live;
+        uint32 ModelUsed = 0;
+
+        std::mt19937 Random(1234);
+        for (int32 Step = 0; Step < 20000; ++Step)
+        {
+            const bool bAllocate = Live.IsEmpty() || (Random() % 100) < 55;
+            if (bAllocate)
+            {
+                const uint32 Count = 1 + Random() % 96;
+                uint32 Offset = 0;
+                if (!Allocator.Allocate(Count, Offset))
+                {
+                    // 실패는 정말로 그만한 빈 블록이 없을 때만 허용
+                    if (!Context.Check(Allocator.GetLargestFreeBlock() < Count, "step %d: allocate %u failed with free block %u", Step, Count, Allocator.GetLargestFreeBlock()))
+                    {
+                        return;
+                    }
+                    continue;
+                }
+
+                if (!Context.Check(Offset + Count <= Capacity, "step %d: block [%u, %u) out of range", Step, Offset, Offset + Count))
+                {
+                    return;
+                }
+                for (uint32 Slot = Offset; Slot < Offset + Count; ++Slot)
+                {
+                    if (!Context.Check(Owner[Slot] < 0, "step %d: slot %u handed out twice", Step, Slot))
+                    {
+                        return;
+                    }
+                    Owner[Slot] = Step;
+                }
+                Live.Add({ Offset, Count });
+                ModelUsed += Count;
+            }
+            else
+            {
+                const int32 Index = static_cast<int32>(Random() % Live.Num());
+                const FLiveBlock Block = Live[Index];
+                Live.RemoveAtSwap(Index);
+
+                if (!Context.Check(Allocator.Free(Block.Offset), "step %d: free %u rejected", Step, Block.Offset))
+                {
+                    return;
+                }
+                for (uint32 Slot = Block.Offset; Slot < Block.Offset + Block.Count; ++Slot)
+                {
+                    Owner[Slot] = -1;
+                }
+                ModelUsed -= Block.Count;
+            }
+
+            if (!Context.Check(Allocator.GetUsedCount() == ModelUsed, "step %d: used %u, expected %u", Step, Allocator.GetUsedCount(), ModelUsed))
+            {
+                return;
+            }
+        }
+
+        // 전부 해제하면 하나의 블록으로 다시 합쳐져야 한다
+        for (const FLiveBlock& Block : Live)
+        {
+            Allocator.Free(Block.Offset);
+        }
+        TEST_CHECK(Context, Allocator.GetUsedCount() == 0);
+        TEST_CHECK(Context, Allocator.GetLargestFreeBlock() == Capacity);
+    }
+}
+
+namespace FParticleInstanceAllocatorTests
+{
+    void Run(FTestContext& Context)
+    {
+        TestLinearAllocator(Context);
+        TestFreeListAllocator(Context);
+        TestFreeListRandomized(Context);
+    }
+}
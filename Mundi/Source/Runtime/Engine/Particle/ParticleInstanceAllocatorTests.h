@@ -0,0 +1,11 @@
+﻿#pragma once
+
+struct FTestContext;
+
+// 콘솔 명령 "TEST PARTICLE"에서 사용
+namespace FParticleInstanceAllocatorTests
+{
+    // 선형 할당기(용량 초과, 요청량 누적)와 프리 리스트 할당기(First-Fit, 병합, 잘못된 해제)를 검사하고,
+    // 무작위 할당/해제를 비트맵 모델과 대조해 구간이 겹치지 않는지 확인합니다.
+    void Run(FTestContext& Context);
+}
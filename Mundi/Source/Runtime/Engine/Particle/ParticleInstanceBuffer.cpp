@@ -2,6 +2,19 @@
 #include "ParticleInstanceBuffer.h"
 #include "D3D11RHI.h"
 
+namespace
+{
+    uint32 RoundUpToPowerOfTwo(uint32 Value)
+    {
+        uint32 Result = 1;
+        while (Result < Value)
+        {
+            Result <<= 1;
+        }
+        return Result;
+    }
+}
+
 FParticleInstanceBufferManager& FParticleInstanceBufferManager::Get()
 {
     static FParticleInstanceBufferManager Instance;
@@ -13,16 +26,14 @@ FParticleInstanceBufferManager::~FParticleInstanceBufferManager()
     Release();
 }
 
-void FParticleInstanceBufferManager::Initialize(int32 InMaxParticleCount)
+void FParticleInstanceBufferManager::Initialize(uint32 InTransientCapacity, uint32 InPersistentCapacity)
 {
-    if (InstanceBuffer)
+    if (TransientBuffer)
     {
         // 이미 초기화됨
         return;
     }
 
-    MaxParticleCount = InMaxParticleCount;
-
     D3D11RHI* RHI = GEngine.GetRHIDevice();
     if (!RHI)
     {
@@ -30,79 +41,257 @@ void FParticleInstanceBufferManager::Initialize(int32 InMaxParticleCount)
         return;
     }
 
-    // StructuredBuffer 생성
+    if (!CreateTransientBuffer(RoundUpToPowerOfTwo(InTransientCapacity)))
+    {
+        return;
+    }
+
+    // 영구 버퍼: CPU가 바뀐 구간만 UpdateSubresource로 갱신하므로 DEFAULT 사용
+    D3D11_BUFFER_DESC BufferDesc = {};
+    BufferDesc.Usage = D3D11_USAGE_DEFAULT;
+    BufferDesc.ByteWidth = sizeof(FParticleInstanceData) * InPersistentCapacity;
+    BufferDesc.BindFlags = D3D11_BIND_SHADER_RESOURCE;
+    BufferDesc.MiscFlags = D3D11_RESOURCE_MISC_BUFFER_STRUCTURED;
+    BufferDesc.StructureByteStride = sizeof(FParticleInstanceData);
+
+    HRESULT hr = RHI->GetDevice()->CreateBuffer(&BufferDesc, nullptr, &PersistentBuffer);
+    if (FAILED(hr))
+    {
+        UE_LOG("[FParticleInstanceBufferManager::Initialize][Error] Failed to create persistent StructuredBuffer.");
+        return;
+    }
+
+    hr = RHI->CreateStructuredBufferSRV(PersistentBuffer, &PersistentSRV);
+    if (FAILED(hr))
+    {
+        UE_LOG("[FParticleInstanceBufferManager::Initialize][Error] Failed to create persistent SRV.");
+        PersistentBuffer->Release();
+        PersistentBuffer = nullptr;
+        return;
+    }
+
+    PersistentAllocator.Reset(InPersistentCapacity);
+    ++PersistentGeneration;
+}
+
+void FParticleInstanceBufferManager::Release()
+{
+    ReleaseTransientBuffer();
+    TransientAllocator.Reset(0);
+    TransientStaging.Empty();
+
+    if (PersistentSRV)
+    {
+        PersistentSRV->Release();
+        PersistentSRV = nullptr;
+    }
+
+    if (PersistentBuffer)
+    {
+        PersistentBuffer->Release();
+        PersistentBuffer = nullptr;
+    }
+
+    // 기존 영구 핸들은 모두 무효화
+    PersistentAllocator.Reset(0);
+    ++PersistentGeneration;
+}
+
+bool FParticleInstanceBufferManager::CreateTransientBuffer(uint32 Capacity)
+{
+    D3D11RHI* RHI = GEngine.GetRHIDevice();
+    if (!RHI)
+    {
+        return false;
+    }
+
+    // StructuredBuffer 생성 (Dynamic)
     HRESULT hr = RHI->CreateStructuredBuffer(
         sizeof(FParticleInstanceData),
-        MaxParticleCount,
+        Capacity,
         nullptr,
-        &InstanceBuffer
+        &TransientBuffer
     );
 
     if (FAILED(hr))
     {
-        UE_LOG("[FParticleInstanceBufferManager::Initialize][Error] Failed to create StructuredBuffer.");
-        return;
+        UE_LOG("[FParticleInstanceBufferManager::CreateTransientBuffer][Error] Failed to create StructuredBuffer.");
+        return false;
     }
 
     // SRV 생성
-    hr = RHI->CreateStructuredBufferSRV(InstanceBuffer, &InstanceSRV);
+    hr = RHI->CreateStructuredBufferSRV(TransientBuffer, &TransientSRV);
     if (FAILED(hr))
     {
-        UE_LOG("[FParticleInstanceBufferManager::Initialize][Error] Failed to create SRV.");
-        InstanceBuffer->Release();
-        InstanceBuffer = nullptr;
+        UE_LOG("[FParticleInstanceBufferManager::CreateTransientBuffer][Error] Failed to create SRV.");
+        TransientBuffer->Release();
+        TransientBuffer = nullptr;
+        return false;
+    }
+
+    TransientAllocator.Reset(Capacity);
+    TransientStaging.SetNum(static_cast<int32>(Capacity));
+    return true;
+}
+
+void FParticleInstanceBufferManager::ReleaseTransientBuffer()
+{
+    if (TransientSRV)
+    {
+        TransientSRV->Release();
+        TransientSRV = nullptr;
+    }
+
+    if (TransientBuffer)
+    {
+        TransientBuffer->Release();
+        TransientBuffer = nullptr;
+    }
+}
+
+void FParticleInstanceBufferManager::BeginFrame()
+{
+    if (!TransientBuffer)
+    {
         return;
     }
+
+    // 지난 패스 요청량이 용량을 넘었다면 버퍼를 키운다 (이전 SRV를 참조하는 배치는 이미 그려졌음)
+    const uint32 Requested = TransientAllocator.GetRequestedCount();
+    if (Requested > TransientAllocator.GetCapacity())
+    {
+        const uint32 NewCapacity = RoundUpToPowerOfTwo(Requested);
+        ReleaseTransientBuffer();
+        if (!CreateTransientBuffer(NewCapacity))
+        {
+            TransientAllocator.Reset(0);
+            return;
+        }
+        bOverflowWarned = false;
+    }
+
+    TransientAllocator.Reset();
+    bTransientDirty = false;
 }
 
-void FParticleInstanceBufferManager::Release()
+FParticleInstanceAllocation FParticleInstanceBufferManager::AllocateTransient(const TArray<FParticleInstanceData>& InstanceData)
 {
-    if (InstanceSRV)
+    FParticleInstanceAllocation Allocation;
+    if (!TransientSRV || InstanceData.empty())
     {
-        InstanceSRV->Release();
-        InstanceSRV = nullptr;
+        return Allocation;
     }
 
-    if (InstanceBuffer)
+    const uint32 Count = static_cast<uint32>(InstanceData.size());
+    uint32 Offset = 0;
+    if (!TransientAllocator.Allocate(Count, Offset))
     {
-        InstanceBuffer->Release();
-        InstanceBuffer = nullptr;
+        if (!bOverflowWarned)
+        {
+            UE_LOG("[FParticleInstanceBufferManager::AllocateTransient][Warning] Instance buffer full. Growing next frame.");
+            bOverflowWarned = true;
+        }
+        return Allocation;
     }
 
-    MaxParticleCount = 0;
+    memcpy(TransientStaging.data() + Offset, InstanceData.data(), Count * sizeof(FParticleInstanceData));
+    bTransientDirty = true;
+
+    Allocation.SRV = TransientSRV;
+    Allocation.FirstInstance = Offset;
+    Allocation.InstanceCount = Count;
+    return Allocation;
 }
 
-ID3D11ShaderResourceView* FParticleInstanceBufferManager::UpdateAndGetSRV(const TArray<FParticleInstanceData>& InstanceData)
+FParticleInstanceAllocation FParticleInstanceBufferManager::UploadPersistent(FParticlePersistentInstanceHandle& InOutHandle, const TArray<FParticleInstanceData>& InstanceData)
 {
-    if (!InstanceBuffer || !InstanceSRV)
+    FParticleInstanceAllocation Allocation;
+    if (!PersistentBuffer || InstanceData.empty())
     {
-        return nullptr;
+        return Allocation;
     }
 
-    if (InstanceData.empty())
+    const uint32 Count = static_cast<uint32>(InstanceData.size());
+    if (!IsPersistentValid(InOutHandle) || InOutHandle.InstanceCount != Count)
     {
-        return nullptr;
+        ReleasePersistent(InOutHandle);
+
+        uint32 Offset = 0;
+        if (!PersistentAllocator.Allocate(Count, Offset))
+        {
+            return Allocation;
+        }
+
+        InOutHandle.FirstInstance = Offset;
+        InOutHandle.InstanceCount = Count;
+        InOutHandle.Generation = PersistentGeneration;
+        InOutHandle.bAllocated = true;
     }
 
-    int32 DataCount = static_cast<int32>(InstanceData.size());
-    if (DataCount > MaxParticleCount)
+    D3D11RHI* RHI = GEngine.GetRHIDevice();
+    if (!RHI)
     {
-        UE_LOG("[FParticleInstanceBufferManager::UpdateAndGetSRV][Warning] Instance count exceeds max. Clamping.");
-        DataCount = MaxParticleCount;
+        return Allocation;
+    }
+
+    // 이 핸들의 구간만 갱신
+    D3D11_BOX Box = {};
+    Box.left = InOutHandle.FirstInstance * sizeof(FParticleInstanceData);
+    Box.right = (InOutHandle.FirstInstance + Count) * sizeof(FParticleInstanceData);
+    Box.top = 0;
+    Box.bottom = 1;
+    Box.front = 0;
+    Box.back = 1;
+    RHI->GetDeviceContext()->UpdateSubresource(PersistentBuffer, 0, &Box, InstanceData.data(), 0, 0);
+
+    return GetPersistent(InOutHandle);
+}
+
+FParticleInstanceAllocation FParticleInstanceBufferManager::GetPersistent(const FParticlePersistentInstanceHandle& InHandle) const
+{
+    FParticleInstanceAllocation Allocation;
+    if (IsPersistentValid(InHandle))
+    {
+        Allocation.SRV = PersistentSRV;
+        Allocation.FirstInstance = InHandle.FirstInstance;
+        Allocation.InstanceCount = InHandle.InstanceCount;
+    }
+    return Allocation;
+}
+
+bool FParticleInstanceBufferManager::IsPersistentValid(const FParticlePersistentInstanceHandle& InHandle) const
+{
+    return InHandle.bAllocated && InHandle.Generation == PersistentGeneration && PersistentSRV;
+}
+
+void FParticleInstanceBufferManager::ReleasePersistent(FParticlePersistentInstanceHandle& InOutHandle)
+{
+    if (IsPersistentValid(InOutHandle))
+    {
+        PersistentAllocator.Free(InOutHandle.FirstInstance);
+    }
+    InOutHandle = FParticlePersistentInstanceHandle();
+}
+
+void FParticleInstanceBufferManager::FlushUploads()
+{
+    if (!bTransientDirty || !TransientBuffer)
+    {
+        return;
     }
 
     D3D11RHI* RHI = GEngine.GetRHIDevice();
     if (!RHI)
     {
-        return nullptr;
+        return;
     }
 
-    // 버퍼 업데이트
+    // 사용한 구간만 한 번에 업로드 (Map Discard)
     RHI->UpdateStructuredBuffer(
-        InstanceBuffer,
-        InstanceData.data(),
-        DataCount * sizeof(FParticleInstanceData)
+        TransientBuffer,
+        TransientStaging.data(),
+        TransientAllocator.GetUsedCount() * sizeof(FParticleInstanceData)
     );
 
-    return InstanceSRV;
+    bTransientDirty = false;
 }
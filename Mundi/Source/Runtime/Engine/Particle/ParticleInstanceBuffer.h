@@ -1,28 +1,67 @@
 #pragma once
 
 #include "ParticleData.h"
+#include "ParticleInstanceAllocator.h"
 
 struct ID3D11Buffer;
 struct ID3D11ShaderResourceView;
 
+// 드로우 한 번이 참조하는 인스턴스 구간
+// 셰이더는 g_ParticleInstances[FirstInstance + SV_InstanceID]로 읽습니다.
+struct FParticleInstanceAllocation
+{
+    ID3D11ShaderResourceView* SRV = nullptr;
+    uint32 FirstInstance = 0;
+    uint32 InstanceCount = 0;
+
+    bool IsValid() const { return SRV != nullptr && InstanceCount > 0; }
+};
+
+// 영구 구간 핸들 (컴포넌트가 소유하고, 더 이상 쓰지 않으면 ReleasePersistent로 반납)
+struct FParticlePersistentInstanceHandle
+{
+    uint32 FirstInstance = 0;
+    uint32 InstanceCount = 0;
+    uint32 Generation = 0;      // 매니저가 초기화/해제되면 기존 핸들은 무효가 됨
+    bool bAllocated = false;
+};
+
 // 파티클 인스턴스 버퍼 관리자
-// 모든 파티클 컴포넌트가 공유하는 단일 StructuredBuffer를 관리합니다.
+// - Transient: 매 패스 모든 에미터가 하나의 큰 버퍼에서 선형으로 구간을 나눠 받고,
+//   드로우 직전 FlushUploads()에서 한 번의 Map으로 업로드합니다.
+//   용량을 넘는 요청은 다음 패스 시작 시 버퍼를 키워서 처리합니다.
+// - Persistent: 데이터가 바뀌지 않는 에미터는 영구 버퍼에 한 번만 올리고 재사용합니다.
 class FParticleInstanceBufferManager
 {
 public:
     static FParticleInstanceBufferManager& Get();
 
     // 버퍼 초기화 (엔진 시작 시 호출)
-    void Initialize(int32 MaxParticleCount = 10000);
+    void Initialize(uint32 InTransientCapacity = 16384, uint32 InPersistentCapacity = 16384);
 
     // 버퍼 해제 (엔진 종료 시 호출)
     void Release();
 
-    // 인스턴스 데이터 업데이트 및 SRV 반환
-    ID3D11ShaderResourceView* UpdateAndGetSRV(const TArray<FParticleInstanceData>& InstanceData);
+    // 파티클 수집 전에 호출. 트랜지언트 구간을 비우고, 지난 패스 요청량에 맞춰 버퍼를 키웁니다.
+    void BeginFrame();
 
-    // 최대 파티클 수 반환
-    int32 GetMaxParticleCount() const { return MaxParticleCount; }
+    // 이번 패스에서만 유효한 구간에 데이터를 복사합니다. 용량 초과 시 무효한 할당을 반환합니다.
+    FParticleInstanceAllocation AllocateTransient(const TArray<FParticleInstanceData>& InstanceData);
+
+    // 영구 구간에 데이터를 올립니다. 크기가 같으면 기존 구간을 덮어쓰고, 다르면 다시 할당합니다.
+    FParticleInstanceAllocation UploadPersistent(FParticlePersistentInstanceHandle& InOutHandle, const TArray<FParticleInstanceData>& InstanceData);
+
+    // 이미 올라가 있는 영구 구간을 그대로 사용합니다. 핸들이 무효하면 무효한 할당을 반환합니다.
+    FParticleInstanceAllocation GetPersistent(const FParticlePersistentInstanceHandle& InHandle) const;
+    bool IsPersistentValid(const FParticlePersistentInstanceHandle& InHandle) const;
+
+    void ReleasePersistent(FParticlePersistentInstanceHandle& InOutHandle);
+
+    // 드로우 직전에 호출. 이번 패스의 트랜지언트 데이터를 GPU로 업로드합니다.
+    void FlushUploads();
+
+    uint32 GetTransientCapacity() const { return TransientAllocator.GetCapacity(); }
+    uint32 GetTransientUsedCount() const { return TransientAllocator.GetUsedCount(); }
 
 private:
     FParticleInstanceBufferManager() = default;
@@ -32,7 +71,20 @@ private:
     FParticleInstanceBufferManager(const FParticleInstanceBufferManager&) = delete;
     FParticleInstanceBufferManager& operator=(const FParticleInstanceBufferManager&) = delete;
 
-    ID3D11Buffer* InstanceBuffer = nullptr;
-    ID3D11ShaderResourceView* InstanceSRV = nullptr;
-    int32 MaxParticleCount = 10;
+    bool CreateTransientBuffer(uint32 Capacity);
+    void ReleaseTransientBuffer();
+
+    // Transient (Dynamic, Map Discard)
+    ID3D11Buffer* TransientBuffer = nullptr;
+    ID3D11ShaderResourceView* TransientSRV = nullptr;
+    FLinearInstanceAllocator TransientAllocator;
+    TArray<FParticleInstanceData> TransientStaging;    // CPU 측 스테이징 (용량만큼 유지)
+    bool bTransientDirty = false;
+    bool bOverflowWarned = false;
+
+    // Persistent (Default, UpdateSubresource)
+    ID3D11Buffer* PersistentBuffer = nullptr;
+    ID3D11ShaderResourceView* PersistentSRV = nullptr;
+    FFreeListInstanceAllocator PersistentAllocator;
+    uint32 PersistentGeneration = 1;
 };
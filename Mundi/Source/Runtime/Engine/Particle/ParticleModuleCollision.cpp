@@ -5,9 +5,7 @@
 #include "World.h"
 #include "Actor.h"
 #include "ShapeComponent.h"
-#include "Collision.h"
-#include "OBB.h"
-#include "AABB.h"
+#include "WorldPartitionManager.h"
 
 UParticleModuleCollision::UParticleModuleCollision()
     : UParticleModule(0) // No payload needed for basic collision
@@ -124,218 +122,26 @@ bool UParticleModuleCollision::CheckCollisionWithWorld(
     if (!World)
         return false;
 
-    // ========================================
-    // 1. 파티클 이동 경로를 감싸는 AABB 생성
-    // ========================================
-    FAABB ParticleAABB;
-    ParticleAABB.Min = FVector(
-        FMath::Min(OldLocation.X, NewLocation.X) - Radius,
-        FMath::Min(OldLocation.Y, NewLocation.Y) - Radius,
-        FMath::Min(OldLocation.Z, NewLocation.Z) - Radius
-    );
-    ParticleAABB.Max = FVector(
-        FMath::Max(OldLocation.X, NewLocation.X) + Radius,
-        FMath::Max(OldLocation.Y, NewLocation.Y) + Radius,
-        FMath::Max(OldLocation.Z, NewLocation.Z) + Radius
-    );
-
-    // 파티클 Shape 생성 (Sphere)
-    FShape ParticleSphere;
-    ParticleSphere.Kind = EShapeKind::Sphere;
-    ParticleSphere.Sphere.SphereRadius = Radius;
-
-    // 샘플링 설정 (이동 거리에 따라 적응형)
-    float MoveDistance = (NewLocation - OldLocation).Size();
-    int NumSamples = FMath::Max(4, static_cast<int>(MoveDistance / FMath::Max(Radius, 1.0f)) + 1);
-    NumSamples = FMath::Min(NumSamples, 16);
-
-    // Track closest hit
-    float ClosestHitT = FLT_MAX;
-    bool bFoundHit = false;
-
-    const TArray<AActor*>& AllActors = World->GetActors();
-
-    for (AActor* Actor : AllActors)
-    {
-        if (!Actor || Actor == OwnerActor)
-            continue;
+    UWorldPartitionManager* Partition = World->GetPartitionManager();
+    if (!Partition)
+        return false;
 
-        const TArray<USceneComponent*>& SceneComponents = Actor->GetSceneComponents();
-        for (USceneComponent* Comp : SceneComponents)
-        {
-            UShapeComponent* ShapeComp = Cast<UShapeComponent>(Comp);
-            if (!ShapeComp || !ShapeComp->GetGenerateOverlapEvents())
-                continue;
-
-            // ========================================
-            // 2. Broad Phase: Shape의 실제 AABB 계산 및 교차 검사
-            // ========================================
-            FShape OtherShape;
-            ShapeComp->GetShape(OtherShape);
-            FTransform OtherTransform = ShapeComp->GetWorldTransform();
-
-            // Shape의 실제 월드 AABB 계산
-            FAABB ShapeAABB;
-            FVector ShapeCenter = OtherTransform.Translation;
-
-            if (OtherShape.Kind == EShapeKind::Sphere)
-            {
-                float WorldRadius = OtherShape.Sphere.SphereRadius *
-                    FMath::Max(FMath::Abs(OtherTransform.Scale3D.X),
-                    FMath::Max(FMath::Abs(OtherTransform.Scale3D.Y),
-                               FMath::Abs(OtherTransform.Scale3D.Z)));
-                ShapeAABB.Min = ShapeCenter - FVector(WorldRadius, WorldRadius, WorldRadius);
-                ShapeAABB.Max = ShapeCenter + FVector(WorldRadius, WorldRadius, WorldRadius);
-            }
-            else if (OtherShape.Kind == EShapeKind::Box)
-            {
-                // Box의 경우 회전을 고려한 AABB 계산
-                FVector HalfExtent = OtherShape.Box.BoxExtent;
-                HalfExtent.X *= FMath::Abs(OtherTransform.Scale3D.X);
-                HalfExtent.Y *= FMath::Abs(OtherTransform.Scale3D.Y);
-                HalfExtent.Z *= FMath::Abs(OtherTransform.Scale3D.Z);
-
-                // 회전을 고려한 최대 extent 계산
-                FMatrix RotMat = OtherTransform.Rotation.ToMatrix();
-                FVector WorldExtent(
-                    FMath::Abs(RotMat.M[0][0]) * HalfExtent.X + FMath::Abs(RotMat.M[1][0]) * HalfExtent.Y + FMath::Abs(RotMat.M[2][0]) * HalfExtent.Z,
-                    FMath::Abs(RotMat.M[0][1]) * HalfExtent.X + FMath::Abs(RotMat.M[1][1]) * HalfExtent.Y + FMath::Abs(RotMat.M[2][1]) * HalfExtent.Z,
-                    FMath::Abs(RotMat.M[0][2]) * HalfExtent.X + FMath::Abs(RotMat.M[1][2]) * HalfExtent.Y + FMath::Abs(RotMat.M[2][2]) * HalfExtent.Z
-                );
-                ShapeAABB.Min = ShapeCenter - WorldExtent;
-                ShapeAABB.Max = ShapeCenter + WorldExtent;
-            }
-            else if (OtherShape.Kind == EShapeKind::Capsule)
-            {
-                float WorldRadius = OtherShape.Capsule.CapsuleRadius *
-                    FMath::Max(FMath::Abs(OtherTransform.Scale3D.X), FMath::Abs(OtherTransform.Scale3D.Y));
-                float WorldHalfHeight = OtherShape.Capsule.CapsuleHalfHeight * FMath::Abs(OtherTransform.Scale3D.Z);
-
-                // 캡슐의 축 방향 계산
-                FVector CapsuleUp = OtherTransform.Rotation.RotateVector(FVector(0, 0, 1));
-                FVector AbsUp(FMath::Abs(CapsuleUp.X), FMath::Abs(CapsuleUp.Y), FMath::Abs(CapsuleUp.Z));
-
-                FVector HalfExtent = AbsUp * WorldHalfHeight + FVector(WorldRadius, WorldRadius, WorldRadius);
-                ShapeAABB.Min = ShapeCenter - HalfExtent;
-                ShapeAABB.Max = ShapeCenter + HalfExtent;
-            }
-
-            if (!ParticleAABB.Intersects(ShapeAABB))
-                continue;  // AABB가 안 겹치면 스킵
-
-            // ========================================
-            // 3. Narrow Phase: 기존 OverlapLUT 사용 (샘플링)
-            // ========================================
-            for (int i = 0; i <= NumSamples; ++i)
-            {
-                float t = static_cast<float>(i) / static_cast<float>(NumSamples);
-                FVector SamplePos = OldLocation + (NewLocation - OldLocation) * t;
-                FTransform SampleTransform(SamplePos, FQuat(0, 0, 0, 1), FVector::One());
-
-                // 기존 OverlapLUT 사용! (Sphere = 1)
-                bool bOverlap = Collision::OverlapLUT[1][static_cast<int>(OtherShape.Kind)](
-                    ParticleSphere, SampleTransform, OtherShape, OtherTransform);
-
-                if (bOverlap && t < ClosestHitT)
-                {
-                    ClosestHitT = t;
-                    bFoundHit = true;
-
-                    // ========================================
-                    // 4. Hit Normal 계산
-                    // ========================================
-                    FVector HitLocation = SamplePos;
-
-                    if (OtherShape.Kind == EShapeKind::Sphere)
-                    {
-                        FVector SphereCenter = OtherTransform.Translation;
-                        float SphereRadius = OtherShape.Sphere.SphereRadius * OtherTransform.Scale3D.X;
-                        FVector ToHit = HitLocation - SphereCenter;
-                        float Dist = ToHit.Size();
-                        OutHitNormal = (Dist > 0.001f) ? ToHit / Dist : FVector(0, 0, 1);
-                        OutHitLocation = SphereCenter + OutHitNormal * SphereRadius;
-                    }
-                    else if (OtherShape.Kind == EShapeKind::Box)
-                    {
-                        FOBB BoxOBB;
-                        Collision::BuildOBB(OtherShape, OtherTransform, BoxOBB);
-
-                        FVector LocalPos = HitLocation - BoxOBB.Center;
-                        FVector LocalPosInBox(
-                            FVector::Dot(LocalPos, BoxOBB.Axes[0]),
-                            FVector::Dot(LocalPos, BoxOBB.Axes[1]),
-                            FVector::Dot(LocalPos, BoxOBB.Axes[2])
-                        );
-
-                        float HalfExt[3] = { BoxOBB.HalfExtent.X, BoxOBB.HalfExtent.Y, BoxOBB.HalfExtent.Z };
-                        float MinPen = FLT_MAX;
-                        int BestAxis = 0, BestSign = 1;
-
-                        for (int j = 0; j < 3; ++j)
-                        {
-                            float PenPos = HalfExt[j] - LocalPosInBox[j];
-                            float PenNeg = HalfExt[j] + LocalPosInBox[j];
-                            if (PenPos < MinPen) { MinPen = PenPos; BestAxis = j; BestSign = 1; }
-                            if (PenNeg < MinPen) { MinPen = PenNeg; BestAxis = j; BestSign = -1; }
-                        }
-
-                        OutHitNormal = BoxOBB.Axes[BestAxis] * static_cast<float>(BestSign);
-                        FVector Clamped = LocalPosInBox;
-                        Clamped[BestAxis] = HalfExt[BestAxis] * static_cast<float>(BestSign);
-                        OutHitLocation = BoxOBB.Center + BoxOBB.Axes[0] * Clamped.X + BoxOBB.Axes[1] * Clamped.Y + BoxOBB.Axes[2] * Clamped.Z;
-                    }
-                    else if (OtherShape.Kind == EShapeKind::Capsule)
-                    {
-                        FVector CapsuleUp = OtherTransform.Rotation.RotateVector(FVector(0, 0, 1));
-                        float ScaledHalfHeight = OtherShape.Capsule.CapsuleHalfHeight * FMath::Abs(OtherTransform.Scale3D.Z);
-                        float CapRadius = OtherShape.Capsule.CapsuleRadius * FMath::Max(FMath::Abs(OtherTransform.Scale3D.X), FMath::Abs(OtherTransform.Scale3D.Y));
-
-                        // 캡슐의 내부 실린더 영역 = HalfHeight - Radius (반구를 제외한 부분)
-                        float CylinderHalfHeight = FMath::Max(0.0f, ScaledHalfHeight - CapRadius);
-
-                        FVector CapsuleCenter = OtherTransform.Translation;
-                        FVector ToHit = HitLocation - CapsuleCenter;
-                        float AxisProj = FVector::Dot(ToHit, CapsuleUp);
-
-                        // 캡슐의 축 위 가장 가까운 점 계산 (실린더 영역 + 반구 중심)
-                        float ClampedAxisProj = FMath::Clamp(AxisProj, -CylinderHalfHeight, CylinderHalfHeight);
-                        FVector ClosestOnAxis = CapsuleCenter + CapsuleUp * ClampedAxisProj;
-
-                        FVector ToHitFromAxis = HitLocation - ClosestOnAxis;
-                        float DistFromAxis = ToHitFromAxis.Size();
-
-                        if (DistFromAxis > 0.001f)
-                        {
-                            // 일반적인 경우: 축에서 파티클 방향으로 Normal 설정
-                            OutHitNormal = ToHitFromAxis / DistFromAxis;
-                        }
-                        else
-                        {
-                            // 파티클이 캡슐 축 위에 있는 경우:
-                            // Sphere처럼 가장 가까운 끝(위/아래 반구) 방향으로 밀어냄
-                            // AxisProj > 0 이면 위쪽 반구에 가까움, < 0 이면 아래쪽 반구에 가까움
-                            if (AxisProj >= 0.0f)
-                            {
-                                OutHitNormal = CapsuleUp;  // 위쪽으로 밀어냄
-                            }
-                            else
-                            {
-                                OutHitNormal = -CapsuleUp;  // 아래쪽으로 밀어냄
-                            }
-                        }
-
-                        OutHitLocation = ClosestOnAxis + OutHitNormal * CapRadius;
-                    }
-
-                    OutHitActor = Actor;
-                    OutHitComponent = ShapeComp;
-                    break;  // 이 Shape에서 첫 충돌 발견
-                }
-            }
-        }
-    }
+    // 파티클 이동 경로를 구로 스윕 (BVH 브로드 페이즈 + OverlapLUT 샘플링)
+    // 오버랩 이벤트를 켠 Shape 컴포넌트만 충돌 대상으로 삼습니다.
+    FCollisionQueryParams Params;
+    Params.ComponentClass = UShapeComponent::StaticClass();
+    Params.bRequireOverlapEvents = true;
+    Params.AddIgnoredActor(OwnerActor);
+
+    FHitResult Hit;
+    if (!Partition->SweepClosest(FSweepRequest::MakeSphere(OldLocation, NewLocation, Radius), Hit, Params))
+        return false;
 
-    return bFoundHit;
+    OutHitLocation = Hit.ImpactPoint;
+    OutHitNormal = Hit.ImpactNormal;
+    OutHitActor = Hit.Actor;
+    OutHitComponent = Hit.Component;
+    return true;
 }
 
 void UParticleModuleCollision::ApplyCollisionResponse(
@@ -105,7 +105,7 @@ void UParticleModuleColor::Spawn(FParticleContext& Context, float EmitterTime)
     // - 일반: 0.0 ~ 1.0
     // - HDR: 1.0 초과 가능 (발광 효과 등)
     // ------------------------------------------------------------------------
-    FVector ColorVec = StartColor.GetValue(EmitterTime);
+    FVector ColorVec = StartColor.GetValue(EmitterTime, Context.GetRandomStream());
 
     // ------------------------------------------------------------------------
     // Step 2: Distribution에서 알파 가져오기
@@ -117,7 +117,7 @@ void UParticleModuleColor::Spawn(FParticleContext& Context, float EmitterTime)
     // - 알파만 시간에 따라 변화시키는 경우가 많음
     // - 클램핑 로직이 필요한 경우가 많음
     // ------------------------------------------------------------------------
-    float Alpha = StartAlpha.GetValue(EmitterTime);
+    float Alpha = StartAlpha.GetValue(EmitterTime, Context.GetRandomStream());
 
     // ------------------------------------------------------------------------
     // Step 3: 알파 클램핑
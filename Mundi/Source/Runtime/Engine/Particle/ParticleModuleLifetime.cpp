@@ -95,7 +95,7 @@ void UParticleModuleLifetime::Spawn(FParticleContext& Context, float EmitterTime
     // - 이미터 후반에 스폰된 파티클은 짧은 수명
     // 같은 설정도 가능
     // ------------------------------------------------------------------------
-    float MaxLifetime = Lifetime.GetValue(EmitterTime);
+    float MaxLifetime = Lifetime.GetValue(EmitterTime, Context.GetRandomStream());
 
     // 수명은 0보다 커야 함
     MaxLifetime = FMath::Max(0.0001f, MaxLifetime);
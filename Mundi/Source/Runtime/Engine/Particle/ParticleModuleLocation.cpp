@@ -53,18 +53,19 @@ void UParticleModuleLocation::Spawn(FParticleContext& Context, float EmitterTime
 
     // 최종 위치 오프셋을 저장
     FVector FinalOffset;
+    FRandomStream& RandomStream = Context.GetRandomStream();
 
     // DistributeOverNPoints가 0이나 1이 아닐 경우에만 균일 분산 로직을 활성화
     if (DistributeOverNPoints > 1.0f)
     {
         // EmitterTime의 소수부를 곱하여 난수의 무작위성을 높인다.
-        float RandomNum = FMath::GetRandZeroOneRange();// * FMath::GetFractional(EmitterTime);
+        float RandomNum = RandomStream.GetFraction();// * FMath::GetFractional(EmitterTime);
 
         // 어느 분산을 사용할지 결정
         // 일반 분산 사용
         if (RandomNum > DistributionThreshold)
         {
-            FinalOffset = Distribution.GetValue(EmitterTime);
+            FinalOffset = Distribution.GetValue(EmitterTime, RandomStream);
         }
         // 균일 분산 사용
         else
@@ -75,25 +76,25 @@ void UParticleModuleLocation::Spawn(FParticleContext& Context, float EmitterTime
             float IndexRange = floorf(DistributeOverNPoints) - 1.0f;
 
             // 각 축에 독립적인 균일 분산 적용
-            auto GetUniformValue = [IndexRange](float Min, float Max) -> float
+            auto GetUniformValue = [IndexRange, &RandomStream](float Min, float Max) -> float
                 {
-                    float RandomIndexFloat = FMath::GetRandZeroOneRange() * IndexRange;
+                    float RandomIndexFloat = RandomStream.GetFraction() * IndexRange;
                     int SelectedIndex = FMath::FloorToInt(RandomIndexFloat + 0.5f);
                     float LerpRatio = (float)SelectedIndex / IndexRange;
                     return FMath::Lerp(Min, Max, LerpRatio);
                 };
 
-            FinalOffset = FVector(
-                GetUniformValue(Distribution.Min.X, Distribution.Max.X),
-                GetUniformValue(Distribution.Min.Y, Distribution.Max.Y),
-                GetUniformValue(Distribution.Min.Z, Distribution.Max.Z)
-            );
+            // 인자 평가 순서가 컴파일러마다 다르므로 축 순서대로 뽑음
+            const float OffsetX = GetUniformValue(Distribution.Min.X, Distribution.Max.X);
+            const float OffsetY = GetUniformValue(Distribution.Min.Y, Distribution.Max.Y);
+            const float OffsetZ = GetUniformValue(Distribution.Min.Z, Distribution.Max.Z);
+            FinalOffset = FVector(OffsetX, OffsetY, OffsetZ);
         }
     }
     else
     {
         // 2. 균일 분산을 사용하지 않는 경우 - GetValue로 모드에 따라 처리
-        FinalOffset = Distribution.GetValue(EmitterTime);
+        FinalOffset = Distribution.GetValue(EmitterTime, RandomStream);
     }
 
     FinalOffset = FinalOffset * Context.Owner->GetWorldTransform().ToRotationScaleMatrix();
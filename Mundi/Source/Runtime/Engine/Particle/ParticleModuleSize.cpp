@@ -101,7 +101,7 @@ void UParticleModuleSize::Spawn(FParticleContext& Context, float EmitterTime)
     // - Y = 세로 크기
     // - Z = 깊이 (3D 파티클용)
     // ------------------------------------------------------------------------
-    FVector SizeVec = StartSize.GetValue(EmitterTime);
+    FVector SizeVec = StartSize.GetValue(EmitterTime, Context.GetRandomStream());
 
     // ------------------------------------------------------------------------
     // Step 2: Size와 BaseSize에 누적
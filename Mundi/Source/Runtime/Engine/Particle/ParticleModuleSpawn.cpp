@@ -162,7 +162,7 @@ float UParticleModuleSpawn::GetSpawnAmount(float EmitterTime, float OldLeftover,
 // - EmitterDuration이 0이면 버스트 시간 계산 불가
 // ============================================================================
 int32 UParticleModuleSpawn::GetBurstCount(float EmitterTime, float EmitterDuration,
-                                          TArray<bool>& BurstFired)
+                                          TArray<bool>& BurstFired, FRandomStream& RandomStream)
 {
     // ------------------------------------------------------------------------
     // Step 0: 버스트 목록이 비어있으면 0 반환
@@ -219,9 +219,7 @@ int32 UParticleModuleSpawn::GetBurstCount(float EmitterTime, float EmitterDurati
             if (Burst->CountLow >= 0)
             {
                 // CountLow ~ Count 범위에서 랜덤 선택
-                BurstCount = Burst->CountLow +
-                    FMath::FloorToInt(FMath::GetRandZeroOneRange() * (Burst->Count - Burst->CountLow + 1));
-                BurstCount = FMath::Clamp(BurstCount, Burst->CountLow, Burst->Count);
+                BurstCount = RandomStream.RandRange(Burst->CountLow, Burst->Count);
             }
 
             TotalBurst += BurstCount;
@@ -67,10 +67,11 @@ public:
     // - EmitterTime: 현재 이미터 시간
     // - EmitterDuration: 이미터 전체 지속 시간
     // - BurstFired: [입출력] 각 버스트의 발사 여부
+    // - RandomStream: CountLow~Count 범위 선택에 사용할 에미터 난수 스트림
     //
     // 반환: 버스트로 생성할 파티클 총 개수
     // ------------------------------------------------------------------------
-    int32 GetBurstCount(float EmitterTime, float EmitterDuration, TArray<bool>& BurstFired);
+    int32 GetBurstCount(float EmitterTime, float EmitterDuration, TArray<bool>& BurstFired, FRandomStream& RandomStream);
 
     // ========================================================================
     // Getters
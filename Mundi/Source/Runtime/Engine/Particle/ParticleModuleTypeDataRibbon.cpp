@@ -4,7 +4,6 @@
 #include "ParticleModuleRibbonColorOverLength.h"  // FRibbonColorParams
 #include "ParticleData.h"
 #include "ParticleEmitterInstance.h"
-#include <algorithm>
 
 UParticleModuleTypeDataRibbon::UParticleModuleTypeDataRibbon()
     : UParticleModuleTypeDataBase()
@@ -18,8 +17,7 @@ void UParticleModuleTypeDataRibbon::Spawn(FParticleContext& Context, float Emitt
     FRibbonPayload* Payload = GetPayload(Context.Particle);
     if (Payload)
     {
-        // Store spawn time for sorting during rendering
-        // SourceIndex will be determined after sorting by SpawnTime
+        // 파티클 순서는 에미터 인스턴스의 링 버퍼가 보장하므로 SpawnTime은 참고용으로만 기록
         // Note: Particle->Location is already in world coordinates
         Payload->Initialize(EmitterTime, -1, RibbonWidth);
     }
@@ -49,77 +47,42 @@ void UParticleModuleTypeDataRibbon::BuildRibbonFromParticles(
     if (!EmitterInstance || EmitterInstance->ActiveParticles <= 0)
         return;
 
-    // Collect all active particles with their data
-    TArray<FRibbonParticleData> ParticleDataArray;
-    ParticleDataArray.Reserve(EmitterInstance->ActiveParticles);
+    // 파티클은 스폰 순서 링 버퍼에 저장되어 있으므로 정렬이 필요 없음
+    // (순서 0 = 가장 오래된 파티클 = tail, 마지막 = 최신 파티클 = head)
+    const int32 ActiveCount = EmitterInstance->ActiveParticles;
+    const int32 ParticleStride = EmitterInstance->ParticleStride;
+    const uint8* ParticleData = EmitterInstance->ParticleData;
 
-    int32 ParticleStride = EmitterInstance->ParticleStride;
-    uint8* ParticleData = EmitterInstance->ParticleData;
-
-    for (int32 i = 0; i < EmitterInstance->ActiveParticles; ++i)
-    {
-        // Get particle from memory using stride
-        FBaseParticle* Particle = reinterpret_cast<FBaseParticle*>(
-            ParticleData + ParticleStride * i
-        );
-
-        if (!Particle)
-            continue;
-
-        // Get payload
-        FRibbonPayload* Payload = GetPayload(Particle);
-        if (!Payload)
-            continue;
-
-        // Collect particle data for sorting
-        // Particle->Location is already in world coordinates
-        FRibbonParticleData Data;
-        Data.Location = Particle->Location;
-        Data.Color = Particle->Color;
-        Data.Width = Payload->Width > 0.0f ? Payload->Width : RibbonWidth;
-        Data.SpawnTime = Payload->SpawnTime;
-        Data.OriginalIndex = i;
-
-        ParticleDataArray.Add(Data);
-    }
-
-    // Sort particles by spawn time (oldest first = tail, newest = head)
-    std::sort(ParticleDataArray.begin(), ParticleDataArray.end(),
-        [](const FRibbonParticleData& A, const FRibbonParticleData& B)
-        {
-            return A.SpawnTime < B.SpawnTime;
-        }
-    );
-
-    // Limit to max particles per ribbon
-    int32 NumParticles = ParticleDataArray.Num();
-    if (NumParticles > MaxParticlesPerRibbon)
-    {
-        // Remove oldest particles (keep newest)
-        int32 ToRemove = NumParticles - MaxParticlesPerRibbon;
-        ParticleDataArray.erase(ParticleDataArray.begin(), ParticleDataArray.begin() + ToRemove);
-        NumParticles = MaxParticlesPerRibbon;
-    }
+    // Limit to max particles per ribbon (가장 오래된 파티클부터 건너뜀)
+    const int32 NumParticles = FMath::Min(ActiveCount, MaxParticlesPerRibbon);
+    const int32 FirstOrder = ActiveCount - NumParticles;
 
     if (NumParticles < 2)
         return; // Need at least 2 points to form a ribbon
 
-    // Reserve output arrays
-    OutPoints.Reserve(NumParticles);
-    OutWidths.Reserve(NumParticles);
-    OutColors.Reserve(NumParticles);
+    OutPoints.SetNum(NumParticles);
+    OutWidths.SetNum(NumParticles);
+    OutColors.SetNum(NumParticles);
+
+    const float InvSegmentCount = 1.0f / static_cast<float>(NumParticles - 1);
 
     // Build output arrays with taper applied
     for (int32 i = 0; i < NumParticles; ++i)
     {
-        const FRibbonParticleData& Data = ParticleDataArray[i];
+        const int32 ParticleIndex = EmitterInstance->GetOrderedParticleIndex(FirstOrder + i);
+        const FBaseParticle* Particle = reinterpret_cast<const FBaseParticle*>(
+            ParticleData + ParticleStride * ParticleIndex
+        );
+        const FRibbonPayload* Payload = GetPayload(const_cast<FBaseParticle*>(Particle));
+
+        // Particle->Location is already in world coordinates
+        const float BaseWidth = Payload->Width > 0.0f ? Payload->Width : RibbonWidth;
 
         // Calculate t (0 = tail/oldest, 1 = head/newest)
-        float T = (NumParticles > 1) ?
-            static_cast<float>(i) / static_cast<float>(NumParticles - 1) : 1.0f;
+        const float T = static_cast<float>(i) * InvSegmentCount;
 
         // Calculate width with taper
-        float Width = Data.Width;
+        float Width = BaseWidth;
         if (WidthParams && WidthParams->bEnabled)
         {
             // RibbonWidth 모듈이 있으면 스케일 팩터로 적용
@@ -129,11 +92,11 @@ void UParticleModuleTypeDataRibbon::BuildRibbonFromParticles(
         else if (bTaperRibbon)
         {
             // 모듈 없으면 기존 TypeData의 테이퍼 설정 사용
-            Width = Data.Width * (TaperFactor + (1.0f - TaperFactor) * T);
+            Width = BaseWidth * (TaperFactor + (1.0f - TaperFactor) * T);
         }
 
         // Apply ribbon color
-        FLinearColor FinalColor = Data.Color;
+        FLinearColor FinalColor = Particle->Color;
 
         if (ColorParams && ColorParams->bEnabled)
         {
@@ -157,9 +120,9 @@ void UParticleModuleTypeDataRibbon::BuildRibbonFromParticles(
             FinalColor.A *= FMath::Max(T, MinAlpha);
         }
 
-        OutPoints.Add(Data.Location);
-        OutWidths.Add(Width);
-        OutColors.Add(FinalColor);
+        OutPoints[i] = Particle->Location;
+        OutWidths[i] = Width;
+        OutColors[i] = FinalColor;
     }
 }
 
@@ -24,11 +24,12 @@ enum class ERibbonFacingMode : uint8
 
 /**
  * Payload structure for ribbon particles
- * Each particle stores its spawn time for sorting and linking
+ * Trail order comes from the emitter instance's spawn-ordered ring buffer,
+ * so no per-frame sorting is needed
  */
 struct FRibbonPayload
 {
-    // Spawn time for sorting particles in correct order
+    // Spawn time (informational; ordering is implicit in the ring buffer)
     float SpawnTime;
 
     // Previous particle index in the chain (-1 if head)
@@ -45,18 +46,6 @@ struct FRibbonPayload
     }
 };
 
-/**
- * Helper structure for sorted ribbon particle data
- */
-struct FRibbonParticleData
-{
-    FVector Location;
-    FLinearColor Color;
-    float Width;
-    float SpawnTime;
-    int32 OriginalIndex;
-};
-
 /**
  * TypeData module for Ribbon/Trail emitters
  * Uses multi-particle approach where each particle is a point in the ribbon
@@ -106,7 +95,7 @@ public:
      *
      * @param EmitterInstance - The emitter instance containing particles
      * @param EmitterLocation - World location of the emitter
-     * @param OutPoints - Output array of ribbon points (sorted by spawn time)
+     * @param OutPoints - Output array of ribbon points (tail/oldest to head/newest)
      * @param OutWidths - Output array of widths at each point
      * @param OutColors - Output array of colors at each point
      * @param WidthParams - Optional width parameters from RibbonWidth module
@@ -157,7 +146,7 @@ private:
     UPROPERTY(EditAnywhere, Category="Ribbon|Texture")
     UTexture* RibbonTexture = nullptr;
 
-    // Maximum particles per ribbon (for sorting performance)
+    // Maximum particles per ribbon (newest N particles are used)
     UPROPERTY(EditAnywhere, Category="Ribbon|Performance")
     int32 MaxParticlesPerRibbon = 100;
 };
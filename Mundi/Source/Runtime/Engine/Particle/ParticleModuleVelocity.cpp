@@ -81,7 +81,7 @@ void UParticleModuleVelocity::Spawn(FParticleContext& Context, float EmitterTime
     // 초기 속도가 변할 수 있도록 함
     // 예: 분수 이펙트에서 시간이 지남에 따라 물줄기 세기가 약해짐
     // ------------------------------------------------------------------------
-    FVector Vel = StartVelocity.GetValue(EmitterTime);
+    FVector Vel = StartVelocity.GetValue(EmitterTime, Context.GetRandomStream());
 
     // ------------------------------------------------------------------------
     // Step 2: 방사형 방향 계산
@@ -171,7 +171,7 @@ void UParticleModuleVelocity::Spawn(FParticleContext& Context, float EmitterTime
     // - 양수: 바깥으로 퍼지는 폭발 효과
     // - 음수: 안쪽으로 모이는 블랙홀 효과
     // ------------------------------------------------------------------------
-    float RadialSpeed = StartVelocityRadial.GetValue(EmitterTime);
+    float RadialSpeed = StartVelocityRadial.GetValue(EmitterTime, Context.GetRandomStream());
     Vel += FromOrigin * RadialSpeed * OwnerScale;
 
     // ------------------------------------------------------------------------
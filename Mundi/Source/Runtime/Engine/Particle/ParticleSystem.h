@@ -70,6 +70,11 @@ public:
     UPROPERTY(EditAnywhere, Category = "Basic")
     float Duration = 0;
 
+    // 난수 시드 (0이면 재생할 때마다 새 시드 사용)
+    // 0이 아니면 스레드 수나 프레임 분할과 무관하게 항상 같은 이펙트가 재현됩니다.
+    UPROPERTY(EditAnywhere, Category = "Random")
+    int32 RandomSeed = 0;
+
     // // 이 시스템의 경계 상자 (Bounding Box) 크기. 컬링(Culling) 최적화에 사용됩니다.
     // UPROPERTY(EditAnywhere, Category="Basic");
     // FAABB FixedBounds;
@@ -11,6 +11,7 @@
 #include "ParticleModuleTypeDataBeam.h"
 #include "ParticleModuleTypeDataRibbon.h"
 #include "ParticleModuleBeamTarget.h"
+#include "ParticleModuleCollision.h"
 #include "ParticleModuleBeamNoise.h"
 #include "ParticleModuleBeamWidth.h"
 #include "ParticleModuleBeamColorOverLength.h"
@@ -38,6 +39,11 @@ UParticleSystemComponent::UParticleSystemComponent()
     // (어떤 액터에 붙어있든 에디터 뷰포트에서 실시간 미리보기 제공)
     bTickInEditor = true;
 
+    // 이동이 끝난 위치를 기준으로 스폰/보간하도록 이동 뒤 그룹에서 틱
+    // 시뮬레이션은 자기 이미터 인스턴스만 바꾸므로 워커 스레드에서 병렬 틱 (예외는 CanTickOnAnyThread)
+    PrimaryComponentTick.TickGroup = ETickingGroup::PostPhysics;
+    PrimaryComponentTick.bRunOnAnyThread = true;
+
     // BeamBuffers, RibbonBuffers는 TMap으로 자동 초기화됨
 }
 
@@ -58,6 +64,10 @@ UParticleSystemComponent::~UParticleSystemComponent()
         delete Pair.second;
     }
     RibbonBuffers.clear();
+
+    // 공유 인스턴스 버퍼의 영구 구간 반납
+    FParticleInstanceBufferManager::Get().ReleasePersistent(SpritePersistentInstances);
+    FParticleInstanceBufferManager::Get().ReleasePersistent(MeshPersistentInstances);
 }
 
 // ============================================================================
@@ -125,6 +135,11 @@ void UParticleSystemComponent::DuplicateSubObjects()
     // 얕은 복사로 원본의 포인터가 복사되었으므로, 클리어하여 원본과 분리
     // (delete 하지 않음 - 원본의 데이터이므로)
     DynamicEmitterData.clear();
+
+    // 영구 인스턴스 구간도 원본 소유이므로 핸들만 비움 (반납하지 않음)
+    SpritePersistentInstances = FParticlePersistentInstanceHandle();
+    MeshPersistentInstances = FParticlePersistentInstanceHandle();
+    CollectedDataRevision = ~0ull;
 }
 
 // ----------------------------------------------------------------------------
@@ -331,6 +346,7 @@ void UParticleSystemComponent::SetCurrentLODLevel(const int32 InCurrentLODLevel)
         Instance->SpawnFraction = 0.0f;
         Instance->SpawnNum = 0;
         Instance->ActiveParticles = 0;
+        Instance->RibbonRingStart = 0;
     }
 
     // -------------------------------------------
@@ -501,8 +517,25 @@ void UParticleSystemComponent::Activate(bool bReset)
     }
     EmitterInstances.Empty();
 
+    // 난수 시드 결정 (에미터마다 같은 시드의 서로 다른 스트림을 사용)
+    if (bOverrideRandomSeed)
+    {
+        ActiveRandomSeed = RandomSeedOverride;
+    }
+    else if (Template->RandomSeed != 0)
+    {
+        ActiveRandomSeed = static_cast<uint32>(Template->RandomSeed);
+    }
+    else
+    {
+        ActiveRandomSeed = static_cast<uint32>(FRandomStream::GenerateSeed());
+    }
+
+    int32 EmitterIndex = -1;
     for (UParticleEmitter* Emitter : Template->GetEmitters())
     {
+        // 비활성 에미터도 인덱스를 소비해서, 다른 에미터를 켜고 꺼도 스트림이 바뀌지 않도록 함
+        ++EmitterIndex;
         if (Emitter->GetActive() == false)
         {
             continue;
@@ -516,6 +549,7 @@ void UParticleSystemComponent::Activate(bool bReset)
         // 템플릿 및 소유자 참조
         Instance->SpriteTemplate = Emitter;
         Instance->OwnerComponent = this;
+        Instance->RandomStream.Initialize(ActiveRandomSeed, static_cast<uint64>(EmitterIndex));
 
         // LOD 및 모듈 참조
         Instance->CurrentLODLevelIndex = CurrentLODLevel;
@@ -606,6 +640,7 @@ void UParticleSystemComponent::CreateDynamicData()
 {
     // 기존 Dynamic Data 해제
     ReleaseDynamicData();
+    ++DynamicDataRevision;
 
     // 각 EmitterInstance에 대해 Dynamic Data 생성
     for (int32 i = 0; i < EmitterInstances.Num(); ++i)
@@ -668,6 +703,43 @@ void UParticleSystemComponent::ReleaseDynamicData()
 }
 
 // [Tick Phase] 매 프레임 호출되어 DeltaTime만큼 시뮬레이션을 전진시킵니다. (가장 중요)
+bool UParticleSystemComponent::CanTickOnAnyThread() const
+{
+    if (!Super::CanTickOnAnyThread())
+    {
+        return false;
+    }
+
+    // 다른 액터 위치를 읽는 빔, 월드 충돌 질의를 하는 모듈이 있으면 게임 스레드에서 틱
+    if (BeamTargetActor || BeamSourceActor)
+    {
+        return false;
+    }
+    for (FParticleEmitterInstance* Instance : EmitterInstances)
+    {
+        UParticleLODLevel* LODLevel = Instance ? Instance->CurrentLODLevel : nullptr;
+        if (!LODLevel)
+        {
+            continue;
+        }
+        for (UParticleModule* Module : LODLevel->GetUpdateModule())
+        {
+            if (Cast<UParticleModuleCollision>(Module) || Cast<UParticleModuleBeamTarget>(Module))
+            {
+                return false;
+            }
+        }
+        for (UParticleModule* Module : LODLevel->GetSpawnModule())
+        {
+            if (Cast<UParticleModuleCollision>(Module) || Cast<UParticleModuleBeamTarget>(Module))
+            {
+                return false;
+            }
+        }
+    }
+    return true;
+}
+
 void UParticleSystemComponent::TickComponent(float DeltaTime)
 {
 
@@ -766,7 +838,8 @@ void UParticleSystemComponent::TickComponent(float DeltaTime)
                 int32 BurstCount = SpawnModule->GetBurstCount(
                     Instance->EmitterTime,
                     Instance->EmitterDuration,
-                    Instance->BurstFired
+                    Instance->BurstFired,
+                    Instance->RandomStream
                 );
 
                 Instance->SpawnNum += BurstCount;
@@ -865,7 +938,7 @@ void UParticleSystemComponent::CollectMeshBatches(TArray<FMeshBatchElement>& Out
             continue;
         }
 
-        FShaderVariant* ShaderVariant = ShaderToUse->GetOrCompileShaderVariant(ParticleMaterial->GetShaderMacros());
+        FShaderVariant* ShaderVariant = ShaderToUse->GetOrCompileShaderVariant(ParticleMaterial->GetShaderPermutationId());
         if (!ShaderVariant)
         {
             continue;
@@ -1334,9 +1407,17 @@ void UParticleSystemComponent::CollectMeshBatches(TArray<FMeshBatchElement>& Out
         return;
     }
 
+    // 시뮬레이션 결과와 정렬 기준(카메라 위치)이 지난 수집 때와 같으면 정렬/인스턴스 데이터 생성을 생략한다.
+    const bool bInstanceDataUnchanged = View &&
+        CollectedDataRevision == DynamicDataRevision &&
+        CollectedViewLocation == View->ViewLocation;
+
     // 타입별로 데이터 수집 (Sprite / Mesh 분리)
-    TArray<FParticleInstanceData> SpriteInstanceData;
-    TArray<FParticleInstanceData> MeshInstanceData;
+    if (!bInstanceDataUnchanged)
+    {
+        SpriteInstanceData.Empty();
+        MeshInstanceData.Empty();
+    }
     UMaterialInterface* SpriteMaterial = nullptr;
     UMaterialInterface* MeshMaterial = nullptr;
     UStaticMesh* MeshToRender = nullptr;
@@ -1359,7 +1440,7 @@ void UParticleSystemComponent::CollectMeshBatches(TArray<FMeshBatchElement>& Out
         }
 
         // 카메라 기준 파티클 정렬 (Back-to-Front for transparency)
-        if (View)
+        if (View && !bInstanceDataUnchanged)
         {
             FDynamicSpriteEmitterDataBase* SpriteDataBase = dynamic_cast<FDynamicSpriteEmitterDataBase*>(DynamicData);
             if (SpriteDataBase)
@@ -1395,7 +1476,7 @@ void UParticleSystemComponent::CollectMeshBatches(TArray<FMeshBatchElement>& Out
             const uint8* ParticleData = Source.DataContainer.ParticleData;
             const int32 ParticleStride = Source.ParticleStride;
 
-            for (int32 i = 0; i < Source.ActiveParticleCount; ++i)
+            for (int32 i = 0; i < Source.ActiveParticleCount && !bInstanceDataUnchanged; ++i)
             {
                 int32 ParticleIndex = ParticleIndices ? ParticleIndices[i] : i;
                 DECLARE_PARTICLE_PTR(Particle, ParticleData + ParticleStride * ParticleIndex);
@@ -1443,7 +1524,7 @@ void UParticleSystemComponent::CollectMeshBatches(TArray<FMeshBatchElement>& Out
             const uint8* ParticleData = Source.DataContainer.ParticleData;
             const int32 ParticleStride = Source.ParticleStride;
 
-            for (int32 i = 0; i < Source.ActiveParticleCount; ++i)
+            for (int32 i = 0; i < Source.ActiveParticleCount && !bInstanceDataUnchanged; ++i)
             {
                 int32 ParticleIndex = ParticleIndices ? ParticleIndices[i] : i;
                 DECLARE_PARTICLE_PTR(Particle, ParticleData + ParticleStride * ParticleIndex);
@@ -1488,48 +1569,109 @@ void UParticleSystemComponent::CollectMeshBatches(TArray<FMeshBatchElement>& Out
         }
     }
 
+    if (View)
+    {
+        CollectedDataRevision = DynamicDataRevision;
+        CollectedViewLocation = View->ViewLocation;
+    }
+
     // 3. 스프라이트 에미터 렌더링
     if (!SpriteInstanceData.empty() && SpriteMaterial)
     {
-        RenderSpriteParticles(SpriteInstanceData, SpriteMaterial, OutMeshBatchElements);
+        const FParticleInstanceAllocation Instances = UploadInstanceData(SpriteInstanceData, SpritePersistentInstances, bInstanceDataUnchanged);
+        RenderSpriteParticles(Instances, SpriteMaterial, OutMeshBatchElements);
     }
 
     // 4. 메시 에미터 렌더링
     if (!MeshInstanceData.empty() && MeshMaterial && MeshToRender)
     {
-        RenderMeshParticles(MeshInstanceData, MeshMaterial, MeshToRender, OutMeshBatchElements);
+        const FParticleInstanceAllocation Instances = UploadInstanceData(MeshInstanceData, MeshPersistentInstances, bInstanceDataUnchanged);
+        RenderMeshParticles(Instances, MeshMaterial, MeshToRender, OutMeshBatchElements);
     }
 }
 
+namespace
+{
+    // 인스턴싱 파티클이 공유하는 UberLit 셰이더와 Permutation ID
+    // 매 프레임 경로 정규화/매크로 배열 생성을 하지 않도록 최초 1회만 조회한다.
+    struct FParticleShaderCache
+    {
+        UShader* UberLitShader = nullptr;
+        FShaderPermutationId SpritePermutation = INVALID_SHADER_PERMUTATION;
+        FShaderPermutationId MeshPermutation = INVALID_SHADER_PERMUTATION;
+    };
+
+    const FParticleShaderCache& GetParticleShaderCache()
+    {
+        static FParticleShaderCache Cache;
+        if (!Cache.UberLitShader)
+        {
+            Cache.UberLitShader = UResourceManager::GetInstance().Load<UShader>("Shaders/Materials/UberLit.hlsl");
+
+            // 스프라이트: PARTICLE_SPRITE + Phong / 메시: PARTICLE_MESH + Phong
+            FShaderPermutationDomain& PermutationDomain = FShaderPermutationDomain::GetInstance();
+            Cache.SpritePermutation = PermutationDomain.Encode({ { "PARTICLE_SPRITE", "1" }, { "LIGHTING_MODEL_PHONG", "1" } });
+            Cache.MeshPermutation = PermutationDomain.Encode({ { "PARTICLE_MESH", "1" }, { "LIGHTING_MODEL_PHONG", "1" } });
+        }
+        return Cache;
+    }
+}
+
+// 인스턴스 데이터를 공유 버퍼에 올린다
+// 데이터가 두 번 연속 같으면 영구 구간에 한 번만 올리고 이후에는 그대로 참조하며,
+// 데이터가 바뀌면 영구 구간을 반납하고 이번 패스의 트랜지언트 구간을 사용한다.
+FParticleInstanceAllocation UParticleSystemComponent::UploadInstanceData(
+    const TArray<FParticleInstanceData>& InstanceData,
+    FParticlePersistentInstanceHandle& PersistentHandle,
+    bool bInstanceDataUnchanged)
+{
+    FParticleInstanceBufferManager& BufferManager = FParticleInstanceBufferManager::Get();
+
+    if (bInstanceDataUnchanged)
+    {
+        if (BufferManager.IsPersistentValid(PersistentHandle))
+        {
+            return BufferManager.GetPersistent(PersistentHandle);
+        }
+
+        FParticleInstanceAllocation Persistent = BufferManager.UploadPersistent(PersistentHandle, InstanceData);
+        if (Persistent.IsValid())
+        {
+            return Persistent;
+        }
+    }
+    else
+    {
+        BufferManager.ReleasePersistent(PersistentHandle);
+    }
+
+    return BufferManager.AllocateTransient(InstanceData);
+}
+
 // 스프라이트 파티클 렌더링 (GPU 인스턴싱)
 void UParticleSystemComponent::RenderSpriteParticles(
-    const TArray<FParticleInstanceData>& InstanceData,
+    const FParticleInstanceAllocation& Instances,
     UMaterialInterface* Material,
     TArray<FMeshBatchElement>& OutMeshBatchElements)
 {
-    // 1. 공유 버퍼 매니저에 데이터 업로드
-    FParticleInstanceBufferManager& BufferManager = FParticleInstanceBufferManager::Get();
-    ID3D11ShaderResourceView* InstanceSRV = BufferManager.UpdateAndGetSRV(InstanceData);
-    if (!InstanceSRV)
+    // 1. 공유 버퍼에서 받은 구간 확인
+    if (!Instances.IsValid())
     {
-        UE_LOG("[RenderSpriteParticles][Warning] Failed to update instance buffer.");
+        UE_LOG("[RenderSpriteParticles][Warning] Failed to allocate instance buffer.");
         return;
     }
 
     // 2. 렌더링 리소스 준비
-    UShader* ShaderToUse = UResourceManager::GetInstance().Load<UShader>("Shaders/Materials/UberLit.hlsl");
+    const FParticleShaderCache& ShaderCache = GetParticleShaderCache();
+    UShader* ShaderToUse = ShaderCache.UberLitShader;
     UQuad* ParticleQuad = UResourceManager::GetInstance().Get<UQuad>("BillboardQuad");
     if (!ShaderToUse || !ParticleQuad || ParticleQuad->GetIndexCount() == 0)
     {
         return;
     }
 
-    // 3. 셰이더 매크로 설정 (PARTICLE_SPRITE 활성화)
-    TArray<FShaderMacro> ShaderMacros;
-    ShaderMacros.push_back({"PARTICLE_SPRITE", "1"});
-    ShaderMacros.push_back({"LIGHTING_MODEL_PHONG", "1"});
-
-    FShaderVariant* ShaderVariant = ShaderToUse->GetOrCompileShaderVariant(ShaderMacros);
+    // 3. 셰이더 Variant (PARTICLE_SPRITE 활성화)
+    FShaderVariant* ShaderVariant = ShaderToUse->GetOrCompileShaderVariant(ShaderCache.SpritePermutation);
     if (!ShaderVariant)
     {
         return;
@@ -1551,8 +1693,9 @@ void UParticleSystemComponent::RenderSpriteParticles(
     BatchElement.BaseVertexIndex = 0;
     BatchElement.PrimitiveTopology = D3D11_PRIMITIVE_TOPOLOGY_TRIANGLELIST;
 
-    BatchElement.InstanceCount = static_cast<uint32>(InstanceData.size());
-    BatchElement.ParticleInstanceSRV = InstanceSRV;
+    BatchElement.InstanceCount = Instances.InstanceCount;
+    BatchElement.ParticleInstanceSRV = Instances.SRV;
+    BatchElement.FirstInstance = Instances.FirstInstance;
 
     BatchElement.WorldMatrix = FMatrix::Identity();
     BatchElement.InstanceColor = FLinearColor(1.0f, 1.0f, 1.0f, 1.0f);
@@ -1570,34 +1713,29 @@ void UParticleSystemComponent::RenderSpriteParticles(
 
 // 메시 파티클 렌더링 (GPU 인스턴싱)
 void UParticleSystemComponent::RenderMeshParticles(
-    const TArray<FParticleInstanceData>& InstanceData,
+    const FParticleInstanceAllocation& Instances,
     UMaterialInterface* Material,
     UStaticMesh* Mesh,
     TArray<FMeshBatchElement>& OutMeshBatchElements)
 {
-    // 1. 공유 버퍼 매니저에 데이터 업로드
-    FParticleInstanceBufferManager& BufferManager = FParticleInstanceBufferManager::Get();
-    ID3D11ShaderResourceView* InstanceSRV = BufferManager.UpdateAndGetSRV(InstanceData);
-    if (!InstanceSRV)
+    // 1. 공유 버퍼에서 받은 구간 확인
+    if (!Instances.IsValid())
     {
-        UE_LOG("[RenderMeshParticles][Warning] Failed to update instance buffer.");
+        UE_LOG("[RenderMeshParticles][Warning] Failed to allocate instance buffer.");
         return;
     }
 
     // 2. 셰이더 로드 (Material 무시, 항상 UberLit.hlsl 사용)
-    UShader* MeshShader = UResourceManager::GetInstance().Load<UShader>("Shaders/Materials/UberLit.hlsl");
+    const FParticleShaderCache& ShaderCache = GetParticleShaderCache();
+    UShader* MeshShader = ShaderCache.UberLitShader;
     if (!MeshShader)
     {
         UE_LOG("[RenderMeshParticles] ERROR: Failed to load UberLit.hlsl shader!");
         return;
     }
 
-    // 3. 셰이더 매크로 (Particle Mesh + Phong Shading)
-    TArray<FShaderMacro> MeshMacros;
-    MeshMacros.push_back({"PARTICLE_MESH", "1"});
-    MeshMacros.push_back({"LIGHTING_MODEL_PHONG", "1"});
-
-    FShaderVariant* MeshVariant = MeshShader->GetOrCompileShaderVariant(MeshMacros);
+    // 3. 셰이더 Variant (Particle Mesh + Phong Shading)
+    FShaderVariant* MeshVariant = MeshShader->GetOrCompileShaderVariant(ShaderCache.MeshPermutation);
     if (!MeshVariant)
     {
         return;
@@ -1619,8 +1757,9 @@ void UParticleSystemComponent::RenderMeshParticles(
     MeshBatch.BaseVertexIndex = 0;
     MeshBatch.PrimitiveTopology = D3D11_PRIMITIVE_TOPOLOGY_TRIANGLELIST;
 
-    MeshBatch.InstanceCount = static_cast<uint32>(InstanceData.size());
-    MeshBatch.ParticleInstanceSRV = InstanceSRV;
+    MeshBatch.InstanceCount = Instances.InstanceCount;
+    MeshBatch.ParticleInstanceSRV = Instances.SRV;
+    MeshBatch.FirstInstance = Instances.FirstInstance;
 
     MeshBatch.WorldMatrix = FMatrix::Identity();
     MeshBatch.InstanceColor = FLinearColor(1.0f, 1.0f, 1.0f, 1.0f);
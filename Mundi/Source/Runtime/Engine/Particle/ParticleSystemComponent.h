@@ -2,6 +2,7 @@
 #include "PrimitiveComponent.h"
 #include "ParticleEventTypes.h"
 #include "DynamicMeshBuffer.h"
+#include "ParticleInstanceBuffer.h"
 #include "UParticleSystemComponent.generated.h"
 
 // 전방 선언: 실제 파티클 데이터를 담는 런타임 인스턴스 구조체
@@ -110,8 +111,11 @@ public:
 
 private:
     // 타입별 렌더링 헬퍼 함수
-    void RenderSpriteParticles(const TArray<struct FParticleInstanceData>& InstanceData, class UMaterialInterface* Material, TArray<struct FMeshBatchElement>& OutMeshBatchElements);
-    void RenderMeshParticles(const TArray<struct FParticleInstanceData>& InstanceData, class UMaterialInterface* Material, class UStaticMesh* Mesh, TArray<struct FMeshBatchElement>& OutMeshBatchElements);
+    void RenderSpriteParticles(const FParticleInstanceAllocation& Instances, class UMaterialInterface* Material, TArray<struct FMeshBatchElement>& OutMeshBatchElements);
+    void RenderMeshParticles(const FParticleInstanceAllocation& Instances, class UMaterialInterface* Material, class UStaticMesh* Mesh, TArray<struct FMeshBatchElement>& OutMeshBatchElements);
+
+    // 인스턴스 데이터를 공유 버퍼에 올린다. 데이터가 지난 수집 때와 같으면 영구 구간을 재사용한다.
+    FParticleInstanceAllocation UploadInstanceData(const TArray<FParticleInstanceData>& InstanceData, FParticlePersistentInstanceHandle& PersistentHandle, bool bInstanceDataUnchanged);
 
 public:
 
@@ -121,8 +125,19 @@ public:
     // 시뮬레이션 종료 명령 (새 파티클 생성을 중단하고 기존 파티클이 수명을 다하도록 둠)
     void Deactivate();
 
+    // 난수 시드 지정 (다음 Activate부터 적용)
+    // 서버/클라이언트, 리플레이에서 같은 이펙트를 재현해야 할 때 같은 시드를 넘깁니다.
+    void SetRandomSeed(uint32 InSeed) { RandomSeedOverride = InSeed; bOverrideRandomSeed = true; }
+    void ClearRandomSeed() { bOverrideRandomSeed = false; }
+
+    // 현재 재생 중인 시뮬레이션이 사용한 시드
+    uint32 GetActiveRandomSeed() const { return ActiveRandomSeed; }
+
     // [Tick Phase] 매 프레임 호출되어 DeltaTime만큼 시뮬레이션을 전진시킵니다. (가장 중요)
     void TickComponent(float DeltaTime) override;
+
+    // 빔 타깃/소스 액터, 충돌 모듈을 쓰면 false (다른 오브젝트를 읽거나 월드에 질의하므로)
+    bool CanTickOnAnyThread() const override;
     
     // // 모든 파티클을 즉시 중지하고 메모리를 정리합니다. (강제 종료)
     // void KillParticlesAndCleanUp();
@@ -161,6 +176,11 @@ private:
     // true이면 자동 LOD 전환을 무시하고 SetCurrentLODLevel()로 설정된 LOD 유지
     bool bOverrideLOD = false;
 
+    // 난수 시드 (우선순위: SetRandomSeed > 템플릿 RandomSeed > Activate마다 새 시드)
+    uint32 RandomSeedOverride = 0;
+    bool bOverrideRandomSeed = false;
+    uint32 ActiveRandomSeed = 0;
+
     // 템플릿을 기반으로 실제 수많은 파티클의 데이터와 상태를 관리하는 내부 런타임 인스턴스
     TArray<FParticleEmitterInstance*> EmitterInstances{};
 
@@ -168,6 +188,18 @@ private:
     // 다형성: FDynamicSpriteEmitterData 또는 FDynamicMeshEmitterData 등이 들어감
     TArray<FDynamicEmitterRenderData*> DynamicEmitterData{};
 
+    // GPU 인스턴싱 데이터 (매 수집마다 재사용하는 스크래치 배열)
+    TArray<FParticleInstanceData> SpriteInstanceData{};
+    TArray<FParticleInstanceData> MeshInstanceData{};
+
+    // 시뮬레이션이 멈춰 데이터가 그대로일 때 재업로드를 생략하기 위한 상태
+    // DynamicDataRevision은 CreateDynamicData마다 증가하고, 정렬 기준인 카메라 위치와 함께 비교한다.
+    uint64 DynamicDataRevision = 0;
+    uint64 CollectedDataRevision = ~0ull;
+    FVector CollectedViewLocation = FVector::Zero();
+    FParticlePersistentInstanceHandle SpritePersistentInstances{};
+    FParticlePersistentInstanceHandle MeshPersistentInstances{};
+
     // 이번 틱에서 발생한 이벤트들
     TArray<FParticleEventCollideData> CollisionEvents{};
     TArray<FParticleEventDeathData> DeathEvents{};
@@ -95,13 +95,14 @@ void LuaComponentProxy::NewIndex(LuaComponentProxy& Self, const char* Key, sol::
         }
         break;
     case EPropertyType::FName:
+        // ObjectName이면 SetName을 거쳐 월드 이름 색인까지 갱신
         if (Obj.is<FName>())
         {
-            *Property->GetValuePtr<FName>(Self.Instance) = Obj.as<FName>();
+            static_cast<UObject*>(Self.Instance)->SetNamePropertyValue(*Property, Obj.as<FName>());
         }
         else if (Obj.get_type() == sol::type::string)
         {
-            *Property->GetValuePtr<FName>(Self.Instance) = FName(Obj.as<FString>());
+            static_cast<UObject*>(Self.Instance)->SetNamePropertyValue(*Property, FName(Obj.as<FString>()));
         }
         break;
     default:
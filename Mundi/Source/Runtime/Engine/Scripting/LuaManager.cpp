@@ -2,7 +2,6 @@
 #include "LuaManager.h"
 #include "LuaComponentProxy.h"
 #include "GameObject.h"
-#include "ObjectIterator.h"
 #include "CameraActor.h"
 #include "CameraComponent.h"
 #include "SkeletalMeshComponent.h"
@@ -204,15 +203,14 @@ FLuaManager::FLuaManager()
     SharedLib.set_function("DeleteObject", sol::overload(
         [](const FGameObject& GameObject)
         {
-            for (TObjectIterator<AActor> It; It; ++It)
+            if (!GWorld)
             {
-                AActor* Actor = *It;
+                return;
+            }
 
-                if (Actor->UUID == GameObject.UUID)
-                {
-                    Actor->Destroy();   // 지연 삭제 요청 (즉시 삭제하면 터짐)
-                    break;
-                }
+            if (AActor* Actor = GWorld->FindActorByUUID(GameObject.UUID))
+            {
+                Actor->Destroy();   // 지연 삭제 요청 (즉시 삭제하면 터짐)
             }
         }
     ));
@@ -1,5 +1,6 @@
 ﻿#include "pch.h"
 #include <algorithm>
+#include <bit>
 #include <cfloat>
 #include <cmath>
 #include <functional>
@@ -11,6 +12,7 @@
 #include "OBB.h"
 #include "Frustum.h"
 #include "Picking.h" // FRay
+#include "SceneQuery.h"
 
 #include "StaticMeshComponent.h"
 
@@ -41,6 +43,8 @@ namespace {
                 if (tmin > tmax) return false;
             }
         }
+        // 박스가 레이 시작점 뒤쪽에 있음
+        if (tmax < 0.0f) return false;
         outTMin = tmin < 0.0f ? 0.0f : tmin;
         outTMax = tmax;
         return true;
@@ -143,6 +147,11 @@ void FBVHierarchy::QueryFrustum(const FFrustum& InFrustum)
     TArray<int32> IdxStack;
     IdxStack.push_back({ 0 });
 
+    // 리프의 박스는 모아서 한 번에 검사 (FMathBatch SIMD 경로)
+    TArray<UPrimitiveComponent*> LeafComponents;
+    TArray<FAABB> LeafBounds;
+    TArray<uint8> LeafVisible;
+
     while (!IdxStack.empty())
     {
         int32 Idx = IdxStack.back();
@@ -150,19 +159,29 @@ void FBVHierarchy::QueryFrustum(const FFrustum& InFrustum)
         const FLBVHNode& node = Nodes[Idx];
         if (node.IsLeaf())
         {
+            LeafComponents.clear();
+            LeafBounds.clear();
             for (int32 i = 0; i < node.Count; ++i)
             {
                 UPrimitiveComponent* Component = StaticMeshComponentArray[node.First + i];
-                if (!Component || StaticMeshComponentBounds.find(Component) == StaticMeshComponentBounds.end())
+                if (!Component)
                     continue;
                 const FAABB* Cached = StaticMeshComponentBounds.Find(Component);
-                const FAABB Box = Cached ? *Cached : Component->GetWorldAABB();
-                if (IsAABBVisible(InFrustum, Box))
+                if (!Cached)
+                    continue;
+                LeafComponents.Add(Component);
+                LeafBounds.Add(*Cached);
+            }
+
+            LeafVisible.SetNum(LeafBounds.Num());
+            AreAABBsVisible(InFrustum, LeafBounds.data(), LeafBounds.Num(), LeafVisible.data());
+            for (int32 i = 0; i < LeafComponents.Num(); ++i)
+            {
+                if (!LeafVisible[i])
+                    continue;
+                if (AActor* Owner = LeafComponents[i]->GetOwner())
                 {
-                    if (AActor* Owner = Component->GetOwner())
-                    {
-                        Owner->SetCulled(false);
-                    }
+                    Owner->SetCulled(false);
                 }
             }
             continue;
@@ -238,7 +257,7 @@ void FBVHierarchy::DebugDump() const
     UE_LOG("===== BVHierachy (LBVH) DUMP BEGIN =====\r\n");
     char buf[256];
     std::snprintf(buf, sizeof(buf), "nodes=%zu, components=%zu\r\n", Nodes.size(), StaticMeshComponentArray.size());
-    UE_LOG(buf);
+    UE_LOG("%s", buf);
     for (size_t i = 0; i < Nodes.size(); ++i)
     {
         const auto& n = Nodes[i];
@@ -247,7 +266,7 @@ void FBVHierarchy::DebugDump() const
             i, n.Left, n.Right, n.First, n.Count,
             n.Bounds.Min.X, n.Bounds.Min.Y, n.Bounds.Min.Z,
             n.Bounds.Max.X, n.Bounds.Max.Y, n.Bounds.Max.Z);
-        UE_LOG(buf);
+        UE_LOG("%s", buf);
     }
     UE_LOG("===== BVHierachy (LBVH) DUMP END =====\r\n");
 }
@@ -401,19 +420,13 @@ int FBVHierarchy::BuildRange(int s, int e)
     return nodeIdx;
 }
 
-void FBVHierarchy::QueryRayClosest(const FRay& Ray, AActor*& OutActor, OUT float& OutBestT) const
+bool FBVHierarchy::Raycast(const FRay& Ray, float MaxDistance, const FCollisionQueryParams& Params, bool bAnyHit, FHitResult& OutHit) const
 {
-    OutActor = nullptr;
-    // Respect caller-provided initial cap (e.g., far plane) if valid
-    if (!(std::isfinite(OutBestT) && OutBestT > 0.0f))
-    {
-        OutBestT = std::numeric_limits<float>::infinity();
-    }
-
-    if (Nodes.empty()) return;
+    OutHit = FHitResult();
+    if (Nodes.empty()) return false;
 
     float tminRoot, tmaxRoot;
-    if (!RayAABB_IntersectT(Ray, Nodes[0].Bounds, tminRoot, tmaxRoot)) return;
+    if (!RayAABB_IntersectT(Ray, Nodes[0].Bounds, tminRoot, tmaxRoot) || tminRoot > MaxDistance) return false;
 
     struct HeapItem
     {
@@ -425,14 +438,15 @@ void FBVHierarchy::QueryRayClosest(const FRay& Ray, AActor*& OutActor, OUT float
     std::priority_queue<HeapItem> heap;
     heap.push({ 0, tminRoot });
 
-    const float Epsilon = 1e-3f;
-    bool isPick = false;
+    // 히트를 찾을 때마다 탐색 범위를 히트 거리로 줄임
+    float BestT = MaxDistance;
     while (!heap.empty())
     {
         HeapItem entry = heap.top();
         heap.pop();
 
-        if (OutActor && entry.TMin > OutBestT + Epsilon)
+        // 남은 노드가 모두 현재 히트보다 멀면 종료
+        if (entry.TMin > BestT)
             break;
 
         const FLBVHNode& node = Nodes[entry.Idx];
@@ -441,59 +455,230 @@ void FBVHierarchy::QueryRayClosest(const FRay& Ray, AActor*& OutActor, OUT float
             for (int i = 0; i < node.Count; ++i)
             {
                 UPrimitiveComponent* Component = StaticMeshComponentArray[node.First + i];
-                if (!Component) continue;
-                AActor* Owner = Component->GetOwner();
-                if (!Owner) continue;
-                if (Owner->GetActorHiddenInEditor()) continue;
-
+                // 바운드가 없으면 리빌드 전에 제거된 컴포넌트
                 const FAABB* Cached = StaticMeshComponentBounds.Find(Component);
-                const FAABB Box = Cached ? *Cached : Component->GetWorldAABB();
+                if (!Cached) continue;
+                if (!SceneQuery::PassesFilter(Component, Params)) continue;
 
                 float tmin, tmax;
-                if (!RayAABB_IntersectT(Ray, Box, tmin, tmax))
-                    continue;
-                if (OutActor && tmin > OutBestT + Epsilon)
+                if (!RayAABB_IntersectT(Ray, *Cached, tmin, tmax) || tmin > BestT)
                     continue;
 
-                float hitDistance;
-                if (CPickingSystem::CheckActorPicking(Owner, Ray, hitDistance))
+                FHitResult Hit;
+                if (SceneQuery::RaycastComponent(Component, Ray, BestT, Params, Hit))
                 {
-                    if (hitDistance < OutBestT)
+                    OutHit = Hit;
+                    BestT = Hit.Distance;
+                    if (bAnyHit)
                     {
-                        OutBestT = hitDistance;
-                        OutActor = Owner;
-                        isPick = true;
+                        // 남은 노드는 볼 필요 없음
+                        heap = std::priority_queue<HeapItem>();
+                        break;
                     }
                 }
             }
             continue;
         }
-        if (isPick == true)
+
+        // Internal node: push children if intersected and promising
+        for (const int32 Child : { node.Left, node.Right })
         {
-            break;
+            float tminChild, tmaxChild;
+            if (Child >= 0 && RayAABB_IntersectT(Ray, Nodes[Child].Bounds, tminChild, tmaxChild) && tminChild <= BestT)
+            {
+                heap.push({ Child, tminChild });
+            }
         }
-        // Internal node: push children if intersected and promising
-        if (node.Left >= 0)
+    }
+
+    if (OutHit.bBlockingHit)
+    {
+        OutHit.Time = (MaxDistance > 0.0f && MaxDistance < FLT_MAX) ? OutHit.Distance / MaxDistance : 0.0f;
+    }
+    return OutHit.bBlockingHit;
+}
+
+template<typename NodeTestFunc, typename LeafFunc>
+void FBVHierarchy::TraversePacket(int32 Count, NodeTestFunc NodeTest, LeafFunc VisitLeaf) const
+{
+    if (Nodes.empty() || Count <= 0) return;
+
+    const auto TestNode = [&](int32 Idx, uint32 ParentMask)
+        {
+            uint32 Mask = 0;
+            for (uint32 Bits = ParentMask; Bits != 0; Bits &= Bits - 1)
+            {
+                const int32 Query = std::countr_zero(Bits);
+                if (NodeTest(Query, Nodes[Idx].Bounds))
+                {
+                    Mask |= 1u << Query;
+                }
+            }
+            return Mask;
+        };
+
+    const uint32 AllQueries = (Count >= 32) ? 0xFFFFFFFFu : ((1u << Count) - 1u);
+    const uint32 RootMask = TestNode(0, AllQueries);
+    if (RootMask == 0) return;
+
+    TArray<std::pair<int32, uint32>> IdxStack;
+    IdxStack.push_back({ 0, RootMask });
+
+    while (!IdxStack.empty())
+    {
+        const auto [Idx, ParentMask] = IdxStack.back();
+        IdxStack.pop_back();
+
+        // 다른 노드에서 히트를 찾아 범위가 줄었을 수 있으므로 꺼낼 때 다시 검사
+        const uint32 Mask = TestNode(Idx, ParentMask);
+        if (Mask == 0) continue;
+
+        const FLBVHNode& Node = Nodes[Idx];
+        if (Node.IsLeaf())
         {
-            float tminL, tmaxL;
-            if (RayAABB_IntersectT(Ray, Nodes[node.Left].Bounds, tminL, tmaxL))
+            for (int32 i = 0; i < Node.Count; ++i)
             {
-                if (!OutActor || tminL <= OutBestT + Epsilon)
-                    heap.push({ node.Left, tminL });
+                UPrimitiveComponent* Component = StaticMeshComponentArray[Node.First + i];
+                const FAABB* Cached = StaticMeshComponentBounds.Find(Component);
+                if (!Cached) continue;
+                VisitLeaf(Mask, Component, *Cached);
             }
+            continue;
         }
-        if (node.Right >= 0)
+
+        if (Node.Right >= 0) IdxStack.push_back({ Node.Right, Mask });
+        if (Node.Left >= 0) IdxStack.push_back({ Node.Left, Mask });
+    }
+}
+
+void FBVHierarchy::RaycastPacket(const FRaycastRequest* Requests, int32 Count, const FCollisionQueryParams& Params, bool bAnyHit, FHitResult* OutHits) const
+{
+    for (int32 Begin = 0; Begin < Count; Begin += MaxPacketSize)
+    {
+        const int32 Num = std::min(MaxPacketSize, Count - Begin);
+        FRay Rays[MaxPacketSize];
+        float BestT[MaxPacketSize];
+        uint32 DoneMask = 0;    // bAnyHit: 이미 히트를 찾은 쿼리
+
+        for (int32 q = 0; q < Num; ++q)
+        {
+            Rays[q].Origin = Requests[Begin + q].Start;
+            Rays[q].Direction = Requests[Begin + q].Direction;
+            BestT[q] = Requests[Begin + q].MaxDistance;
+            OutHits[Begin + q] = FHitResult();
+        }
+
+        TraversePacket(Num,
+            [&](int32 q, const FAABB& Box)
+            {
+                float tmin, tmax;
+                return (DoneMask & (1u << q)) == 0 && RayAABB_IntersectT(Rays[q], Box, tmin, tmax) && tmin <= BestT[q];
+            },
+            [&](uint32 Mask, UPrimitiveComponent* Component, const FAABB& Box)
+            {
+                // 필터는 컴포넌트당 한 번만 검사하고 묶음 안의 레이들이 공유
+                if (!SceneQuery::PassesFilter(Component, Params)) return;
+
+                for (uint32 Bits = Mask & ~DoneMask; Bits != 0; Bits &= Bits - 1)
+                {
+                    const int32 q = std::countr_zero(Bits);
+                    float tmin, tmax;
+                    if (!RayAABB_IntersectT(Rays[q], Box, tmin, tmax) || tmin > BestT[q])
+                        continue;
+
+                    FHitResult Hit;
+                    if (SceneQuery::RaycastComponent(Component, Rays[q], BestT[q], Params, Hit))
+                    {
+                        OutHits[Begin + q] = Hit;
+                        BestT[q] = Hit.Distance;
+                        if (bAnyHit)
+                        {
+                            DoneMask |= 1u << q;
+                        }
+                    }
+                }
+            });
+
+        for (int32 q = 0; q < Num; ++q)
         {
-            float tminR, tmaxR;
-            if (RayAABB_IntersectT(Ray, Nodes[node.Right].Bounds, tminR, tmaxR))
+            FHitResult& Hit = OutHits[Begin + q];
+            const float MaxDistance = Requests[Begin + q].MaxDistance;
+            if (Hit.bBlockingHit)
             {
-                if (!OutActor || tminR <= OutBestT + Epsilon)
-                    heap.push({ node.Right, tminR });
+                Hit.Time = (MaxDistance > 0.0f && MaxDistance < FLT_MAX) ? Hit.Distance / MaxDistance : 0.0f;
             }
         }
     }
 }
 
+bool FBVHierarchy::Sweep(const FSweepRequest& Request, const FCollisionQueryParams& Params, FHitResult& OutHit) const
+{
+    SweepPacket(&Request, 1, Params, &OutHit);
+    return OutHit.bBlockingHit;
+}
+
+void FBVHierarchy::SweepPacket(const FSweepRequest* Requests, int32 Count, const FCollisionQueryParams& Params, FHitResult* OutHits) const
+{
+    for (int32 Begin = 0; Begin < Count; Begin += MaxPacketSize)
+    {
+        const int32 Num = std::min(MaxPacketSize, Count - Begin);
+        FAABB SweepBounds[MaxPacketSize];
+        for (int32 q = 0; q < Num; ++q)
+        {
+            SweepBounds[q] = SceneQuery::ComputeSweepBounds(Requests[Begin + q]);
+            OutHits[Begin + q] = FHitResult();
+        }
+
+        TraversePacket(Num,
+            [&](int32 q, const FAABB& Box)
+            {
+                return SweepBounds[q].Intersects(Box);
+            },
+            [&](uint32 Mask, UPrimitiveComponent* Component, const FAABB& Box)
+            {
+                if (!SceneQuery::PassesFilter(Component, Params)) return;
+
+                for (uint32 Bits = Mask; Bits != 0; Bits &= Bits - 1)
+                {
+                    const int32 q = std::countr_zero(Bits);
+                    if (!SweepBounds[q].Intersects(Box))
+                        continue;
+
+                    FHitResult& Best = OutHits[Begin + q];
+                    FHitResult Hit;
+                    if (SceneQuery::SweepComponent(Component, Box, Requests[Begin + q], Hit) && (!Best.bBlockingHit || Hit.Time < Best.Time))
+                    {
+                        Best = Hit;
+                    }
+                }
+            });
+    }
+}
+
+void FBVHierarchy::Overlap(const FShape& Shape, const FTransform& Transform, const FCollisionQueryParams& Params, TArray<FOverlapInfo>& OutOverlaps) const
+{
+    const FAABB ShapeBounds = Collision::ComputeShapeAABB(Shape, Transform);
+
+    TraversePacket(1,
+        [&](int32, const FAABB& Box)
+        {
+            return ShapeBounds.Intersects(Box);
+        },
+        [&](uint32, UPrimitiveComponent* Component, const FAABB& Box)
+        {
+            if (!ShapeBounds.Intersects(Box)) return;
+            if (!SceneQuery::PassesFilter(Component, Params)) return;
+
+            if (SceneQuery::OverlapComponent(Component, Box, Shape, Transform))
+            {
+                FOverlapInfo Info;
+                Info.OtherActor = Component->GetOwner();
+                Info.Other = Component;
+                OutOverlaps.Add(Info);
+            }
+        });
+}
+
 void FBVHierarchy::FlushRebuild()
 {
     if (bPendingRebuild)
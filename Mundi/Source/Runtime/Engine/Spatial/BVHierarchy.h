@@ -6,6 +6,12 @@ class UPrimitiveComponent;
 class AActor;
 struct FOBB;
 struct FBoundingSphere;
+struct FShape;
+struct FOverlapInfo;
+struct FHitResult;
+struct FCollisionQueryParams;
+struct FRaycastRequest;
+struct FSweepRequest;
 
 /**
  * @brief Broad phase BVH based on UPrimitiveComponent
@@ -32,12 +38,28 @@ public:
 
     void FlushRebuild();
 
-    void QueryRayClosest(const FRay& Ray, AActor*& OutActor, OUT float& OutBestT) const;
     void QueryFrustum(const FFrustum& InFrustum);
     TArray<UPrimitiveComponent*> QueryIntersectedComponents(const FAABB& InBound) const;
     TArray<UPrimitiveComponent*> QueryIntersectedComponents(const FOBB& InBound) const;
     TArray<UPrimitiveComponent*> QueryIntersectedComponents(const FBoundingSphere& InBound) const;
 
+    // ───── 씬 쿼리 (SceneQuery.h) ─────
+    // 한 번의 묶음 순회에서 함께 처리하는 최대 쿼리 수 (방문 마스크 비트 수)
+    static constexpr int32 MaxPacketSize = 32;
+
+    // 가까운 노드부터 방문하는 레이캐스트. bAnyHit이면 처음 찾은 히트에서 종료합니다.
+    bool Raycast(const FRay& Ray, float MaxDistance, const FCollisionQueryParams& Params, bool bAnyHit, FHitResult& OutHit) const;
+
+    // Count개의 레이를 MaxPacketSize개씩 묶어 노드 방문과 필터 검사를 공유합니다.
+    // OutHits[i].bBlockingHit가 false면 Requests[i]는 히트 없음
+    void RaycastPacket(const FRaycastRequest* Requests, int32 Count, const FCollisionQueryParams& Params, bool bAnyHit, FHitResult* OutHits) const;
+
+    // 경로상 가장 먼저 닿는 컴포넌트
+    bool Sweep(const FSweepRequest& Request, const FCollisionQueryParams& Params, FHitResult& OutHit) const;
+    void SweepPacket(const FSweepRequest* Requests, int32 Count, const FCollisionQueryParams& Params, FHitResult* OutHits) const;
+
+    void Overlap(const FShape& Shape, const FTransform& Transform, const FCollisionQueryParams& Params, TArray<FOverlapInfo>& OutOverlaps) const;
+
     void DebugDraw(URenderer* Renderer) const;
 
     // Debug/Stats
@@ -69,6 +91,12 @@ private:
         , NodeIntersectFunc NodeIntersects
         , ComponentIntersectFunc ComponentIntersects) const;
 
+    // 쿼리 묶음을 한 번에 순회. 노드마다 아직 통과 중인 쿼리를 비트마스크로 들고 내려갑니다.
+    // NodeTest(QueryIndex, NodeBounds) -> bool
+    // VisitLeaf(QueryMask, Component, CachedBounds)
+    template<typename NodeTestFunc, typename LeafFunc>
+    void TraversePacket(int32 Count, NodeTestFunc NodeTest, LeafFunc VisitLeaf) const;
+
     int BuildRange(int s, int e);
 
     int Depth;
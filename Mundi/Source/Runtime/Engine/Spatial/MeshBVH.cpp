@@ -1,482 +1,556 @@
 ﻿#include "pch.h"
 #include "MeshBVH.h"
+#include <immintrin.h>
 
-void FMeshBVH::Build(const TArray<FNormalVertex>& Vertices, const TArray<uint32>& Indices)
+namespace
 {
-	TriIndices.Empty();
-	Nodes.Empty();
-	uint32 TriCount = Indices.Num() / 3;
-	if (TriCount == 0) return;
+	constexpr uint32 LeafSize = 4;			// 이 이하면 분할하지 않음
+	constexpr uint32 MaxLeafSize = 16;		// SAH가 리프를 원해도 이보다 많으면 강제로 분할
+	constexpr int32 BinCount = 16;
+	constexpr int32 MaxDepth = 64;			// 이진 트리 깊이 제한 (순회 스택 크기 보장)
+	constexpr float TraversalCost = 1.0f;	// SAH 비용: 노드 하나 방문
+	constexpr float IntersectCost = 1.0f;	// SAH 비용: 삼각형 하나 검사
 
-	TriIndices.Reserve(TriCount);
-	for (uint32 t = 0; t < TriCount; ++t)
-		TriIndices.Add(t);
+	// 이진 깊이 64 이하 -> BVH4 깊이도 64 이하, 노드마다 최대 3개가 스택에 남으므로 3 * 64 + 4 < 256
+	constexpr int32 TraversalStackSize = 256;
 
-	BuildRecursive(0, TriCount, Vertices, Indices);
-}
+	FAABB MakeEmptyBounds()
+	{
+		return FAABB(FVector(FLT_MAX, FLT_MAX, FLT_MAX), FVector(-FLT_MAX, -FLT_MAX, -FLT_MAX));
+	}
 
-// 삼각형과 맞을 경우 , BVH를 따라 내려가면서 교차 가능성 있는 노드만 검사한다.
-// Möller–Trumbore로 교차 체크 !
-bool FMeshBVH::IntersectRay(const FRay& InLocalRay,
-	const TArray<FNormalVertex>& InVertices,
-	const TArray<uint32>& InIndices,
-	float& OutHitDistance)
-{
-	if (Nodes.Num() == 0)
+	void GrowBounds(FAABB& Bounds, const FVector& Point)
 	{
-		return false;
+		Bounds.Min = FVector(std::min(Bounds.Min.X, Point.X), std::min(Bounds.Min.Y, Point.Y), std::min(Bounds.Min.Z, Point.Z));
+		Bounds.Max = FVector(std::max(Bounds.Max.X, Point.X), std::max(Bounds.Max.Y, Point.Y), std::max(Bounds.Max.Z, Point.Z));
 	}
 
-	float RootEntry, RootExit;
-	if (!Nodes[0].Bounds.IntersectsRay(InLocalRay, RootEntry, RootExit))
+	void GrowBounds(FAABB& Bounds, const FAABB& Other)
 	{
-		return false;
+		GrowBounds(Bounds, Other.Min);
+		GrowBounds(Bounds, Other.Max);
 	}
 
-	struct FHeapItem
+	float SurfaceArea(const FAABB& Bounds)
 	{
-		int NodeIndex;
-		float EntryDistance;
+		const FVector Extent = Bounds.Max - Bounds.Min;
+		return 2.0f * (Extent.X * Extent.Y + Extent.Y * Extent.Z + Extent.Z * Extent.X);
+	}
 
-		bool operator>(const FHeapItem& Other) const
+	// 빈 분할(binned) SAH 빌더
+	// 삼각형 바운드와 중심은 빌드 시작 때 한 번만 계산해 두고 TriIndices만 재배치
+	struct FBinnedSAHBuilder
+	{
+		const TArray<FAABB>& TriBounds;
+		const TArray<FVector>& Centroids;
+		TArray<uint32>& TriIndices;
+		TArray<FMeshBVHNode>& Nodes;
+
+		FAABB ComputeRangeBounds(uint32 First, uint32 Count) const
 		{
-			return EntryDistance > Other.EntryDistance; // 최소 힙
+			FAABB Bounds = MakeEmptyBounds();
+			for (uint32 i = First; i < First + Count; ++i)
+			{
+				GrowBounds(Bounds, TriBounds[TriIndices[i]]);
+			}
+			return Bounds;
 		}
-	};
-
-	std::priority_queue<FHeapItem, TArray<FHeapItem>, std::greater<FHeapItem>> Heap;
-	Heap.push({ 0, RootEntry });
-
-	// 가장 가까운 히트를 추적
-	bool bHasHit = false;
-	float ClosestHitDistance = std::numeric_limits<float>::max();
 
-	while (!Heap.empty())
-	{
-		FHeapItem Current = Heap.top();
-		Heap.pop();
-
-		// 이미 더 가까운 히트가 있으면 이 노드는 스킵
-		if (Current.EntryDistance > ClosestHitDistance)
+		int32 ComputeBin(const FVector& Centroid, int32 Axis, float AxisMin, float Scale) const
 		{
-			continue;
+			const int32 Bin = static_cast<int32>((Centroid[Axis] - AxisMin) * Scale);
+			return std::clamp(Bin, 0, BinCount - 1);
 		}
 
-		const FMeshBVHNode& Node = Nodes[Current.NodeIndex];
-		if (Node.IsLeaf())
+		void Subdivide(uint32 NodeIndex, int32 Depth)
 		{
-			for (uint32 TriOffset = 0; TriOffset < Node.Count; ++TriOffset)
+			// Nodes가 자라면서 참조가 무효화되므로 값으로 복사
+			const FMeshBVHNode Node = Nodes[NodeIndex];
+			const uint32 First = Node.LeftOrFirst;
+			const uint32 Count = Node.Count;
+			if (Count <= LeafSize || Depth >= MaxDepth)
+			{
+				return;
+			}
+
+			FAABB CentroidBounds = MakeEmptyBounds();
+			for (uint32 i = First; i < First + Count; ++i)
 			{
-				const uint32 TriangleID = TriIndices[Node.Start + TriOffset];
-				const uint32 V0 = InIndices[3 * TriangleID + 0];
-				const uint32 V1 = InIndices[3 * TriangleID + 1];
-				const uint32 V2 = InIndices[3 * TriangleID + 2];
+				GrowBounds(CentroidBounds, Centroids[TriIndices[i]]);
+			}
 
-				const FVector& A = InVertices[V0].pos;
-				const FVector& B = InVertices[V1].pos;
-				const FVector& C = InVertices[V2].pos;
+			// -------------------------------
+			// 축마다 BinCount개 구간으로 나눠 모든 경계의 SAH 비용 계산
+			// -------------------------------
+			int32 BestAxis = -1;
+			int32 BestSplit = 0;	// 이 빈부터 오른쪽
+			float BestCost = FLT_MAX;
+			FAABB BestLeftBounds;
+			FAABB BestRightBounds;
 
-				float HitT = 0.0f;
-				if (IntersectRayTriangleMT(InLocalRay, A, B, C, HitT))
+			for (int32 Axis = 0; Axis < 3; ++Axis)
+			{
+				const float AxisMin = CentroidBounds.Min[Axis];
+				const float AxisExtent = CentroidBounds.Max[Axis] - AxisMin;
+				if (AxisExtent <= 0.0f)
 				{
-					// 가장 가까운 히트인 경우에만 업데이트
-					if (HitT < ClosestHitDistance)
+					continue;
+				}
+				const float Scale = BinCount / AxisExtent;
+
+				uint32 BinCounts[BinCount] = {};
+				FAABB BinBounds[BinCount];
+				for (FAABB& Bounds : BinBounds)
+				{
+					Bounds = MakeEmptyBounds();
+				}
+
+				for (uint32 i = First; i < First + Count; ++i)
+				{
+					const uint32 TriangleID = TriIndices[i];
+					const int32 Bin = ComputeBin(Centroids[TriangleID], Axis, AxisMin, Scale);
+					++BinCounts[Bin];
+					GrowBounds(BinBounds[Bin], TriBounds[TriangleID]);
+				}
+
+				// 왼쪽에서 누적한 개수/바운드
+				uint32 LeftCounts[BinCount - 1];
+				FAABB LeftBounds[BinCount - 1];
+				FAABB Accumulated = MakeEmptyBounds();
+				uint32 LeftCount = 0;
+				for (int32 Bin = 0; Bin < BinCount - 1; ++Bin)
+				{
+					LeftCount += BinCounts[Bin];
+					if (BinCounts[Bin] > 0)
 					{
-						ClosestHitDistance = HitT;
-						bHasHit = true;
+						GrowBounds(Accumulated, BinBounds[Bin]);
 					}
+					LeftCounts[Bin] = LeftCount;
+					LeftBounds[Bin] = Accumulated;
 				}
-			}
-		}
-		else
-		{
-			if (Node.Left >= 0)
-			{
-				float ChildEntry, ChildExit;
-				if (Nodes[Node.Left].Bounds.IntersectsRay(InLocalRay, ChildEntry, ChildExit))
+
+				// 오른쪽에서 누적하면서 경계마다 비용 비교
+				FAABB RightBounds = MakeEmptyBounds();
+				uint32 RightCount = 0;
+				for (int32 Split = BinCount - 1; Split > 0; --Split)
 				{
-					// 이미 더 가까운 히트가 있으면 자식 노드 추가하지 않음
-					if (ChildEntry < ClosestHitDistance)
+					RightCount += BinCounts[Split];
+					if (BinCounts[Split] > 0)
+					{
+						GrowBounds(RightBounds, BinBounds[Split]);
+					}
+
+					if (LeftCounts[Split - 1] == 0 || RightCount == 0)
+					{
+						continue;
+					}
+
+					const float Cost = LeftCounts[Split - 1] * SurfaceArea(LeftBounds[Split - 1]) + RightCount * SurfaceArea(RightBounds);
+					if (Cost < BestCost)
 					{
-						Heap.push({ Node.Left, ChildEntry });
+						BestCost = Cost;
+						BestAxis = Axis;
+						BestSplit = Split;
+						BestLeftBounds = LeftBounds[Split - 1];
+						BestRightBounds = RightBounds;
 					}
 				}
 			}
-			if (Node.Right >= 0)
+
+			const float ParentArea = SurfaceArea(Node.Bounds);
+			const float SplitCost = (BestAxis >= 0 && ParentArea > 0.0f)
+				? TraversalCost + IntersectCost * BestCost / ParentArea
+				: FLT_MAX;
+			const float LeafCost = IntersectCost * Count;
+
+			uint32 Mid = First;
+			bool bUseBinBounds = false;
+			if (BestAxis >= 0 && (SplitCost < LeafCost || Count > MaxLeafSize))
 			{
-				float ChildEntry, ChildExit;
-				if (Nodes[Node.Right].Bounds.IntersectsRay(InLocalRay, ChildEntry, ChildExit))
-				{
-					if (ChildEntry < ClosestHitDistance)
+				const float AxisMin = CentroidBounds.Min[BestAxis];
+				const float Scale = BinCount / (CentroidBounds.Max[BestAxis] - AxisMin);
+				Mid = static_cast<uint32>(std::partition(
+					TriIndices.begin() + First,
+					TriIndices.begin() + First + Count,
+					[&](uint32 TriangleID)
 					{
-						Heap.push({ Node.Right, ChildEntry });
-					}
+						return ComputeBin(Centroids[TriangleID], BestAxis, AxisMin, Scale) < BestSplit;
+					}) - TriIndices.begin());
+				bUseBinBounds = true;
+			}
+			else if (Count > MaxLeafSize)
+			{
+				// 중심이 모두 한 점에 모여 나눌 축이 없음: 리프 크기 제한을 위해 절반으로 나눔
+				Mid = First + Count / 2;
+			}
+			else
+			{
+				return;
+			}
+
+			if (Mid == First || Mid == First + Count)
+			{
+				Mid = First + Count / 2;
+				bUseBinBounds = false;
+			}
+
+			// -------------------------------
+			// 내부 노드로 전환 & 자식 생성 (두 자식은 항상 연속으로 배치)
+			// -------------------------------
+			const uint32 LeftIndex = static_cast<uint32>(Nodes.Num());
+
+			FMeshBVHNode LeftChild;
+			LeftChild.LeftOrFirst = First;
+			LeftChild.Count = Mid - First;
+			LeftChild.Bounds = bUseBinBounds ? BestLeftBounds : ComputeRangeBounds(LeftChild.LeftOrFirst, LeftChild.Count);
+
+			FMeshBVHNode RightChild;
+			RightChild.LeftOrFirst = Mid;
+			RightChild.Count = First + Count - Mid;
+			RightChild.Bounds = bUseBinBounds ? BestRightBounds : ComputeRangeBounds(RightChild.LeftOrFirst, RightChild.Count);
+
+			Nodes.Add(LeftChild);
+			Nodes.Add(RightChild);
+
+			Nodes[NodeIndex].LeftOrFirst = LeftIndex;
+			Nodes[NodeIndex].Count = 0;
+
+			Subdivide(LeftIndex, Depth + 1);
+			Subdivide(LeftIndex + 1, Depth + 1);
+		}
+	};
+
+	// Möller–Trumbore (Picking의 IntersectRayTriangleMT와 같은 허용 오차), 미리 계산한 에지 사용
+	// 뒷면 판정: 노멀(Edge1 x Edge2)이 레이와 같은 방향이면 Determinant < 0
+	inline bool IntersectTriangle(const FRay& InRay, const FMeshBVHTriangle& Triangle, bool bCullBackFaces, float& OutT)
+	{
+		const float Epsilon = KINDA_SMALL_NUMBER;
+
+		const FVector Perpendicular = FVector::Cross(InRay.Direction, Triangle.Edge2);
+		const float Determinant = FVector::Dot(Triangle.Edge1, Perpendicular);
+		if (bCullBackFaces ? Determinant < Epsilon : (Determinant > -Epsilon && Determinant < Epsilon))
+			return false;
+
+		const float InvDeterminant = 1.0f / Determinant;
+		const FVector OriginToA = InRay.Origin - Triangle.V0;
+		const float U = InvDeterminant * FVector::Dot(OriginToA, Perpendicular);
+		if (U < -Epsilon || U > 1.0f + Epsilon)
+			return false;
+
+		const FVector CrossQ = FVector::Cross(OriginToA, Triangle.Edge1);
+		const float V = InvDeterminant * FVector::Dot(InRay.Direction, CrossQ);
+		if (V < -Epsilon || (U + V) > 1.0f + Epsilon)
+			return false;
+
+		const float Distance = InvDeterminant * FVector::Dot(Triangle.Edge2, CrossQ);
+		if (Distance > Epsilon)
+		{
+			OutT = Distance;
+			return true;
+		}
+		return false;
+	}
+}
+
+void FMeshBVH::Build(const TArray<FNormalVertex>& Vertices, const TArray<uint32>& Indices)
+{
+	Nodes.Empty();
+	Triangles.Empty();
+	const uint32 TriCount = Indices.Num() / 3;
+	if (TriCount == 0) return;
+
+	// 삼각형별 바운드/중심을 한 번만 계산 (분할 비교 중에 다시 계산하지 않음)
+	TArray<FAABB> TriBounds;
+	TArray<FVector> Centroids;
+	TArray<uint32> TriIndices;
+	TriBounds.SetNum(TriCount);
+	Centroids.SetNum(TriCount);
+	TriIndices.SetNum(TriCount);
+
+	for (uint32 t = 0; t < TriCount; ++t)
+	{
+		const FVector& A = Vertices[Indices[3 * t + 0]].pos;
+		const FVector& B = Vertices[Indices[3 * t + 1]].pos;
+		const FVector& C = Vertices[Indices[3 * t + 2]].pos;
+
+		FAABB Bounds = MakeEmptyBounds();
+		GrowBounds(Bounds, A);
+		GrowBounds(Bounds, B);
+		GrowBounds(Bounds, C);
+		TriBounds[t] = Bounds;
+		Centroids[t] = (A + B + C) / 3.0f;
+		TriIndices[t] = t;
+	}
+
+	TArray<FMeshBVHNode> BinaryNodes;
+	BinaryNodes.Reserve(2 * TriCount / LeafSize + 1);
+
+	FBinnedSAHBuilder Builder{ TriBounds, Centroids, TriIndices, BinaryNodes };
+
+	FMeshBVHNode Root;
+	Root.LeftOrFirst = 0;
+	Root.Count = TriCount;
+	Root.Bounds = Builder.ComputeRangeBounds(0, TriCount);
+	BinaryNodes.Add(Root);
+	Builder.Subdivide(0, 0);
+
+	// 리프 순서대로 레이 검사용 삼각형 데이터 미리 계산
+	Triangles.SetNum(TriCount);
+	for (uint32 i = 0; i < TriCount; ++i)
+	{
+		const uint32 TriangleID = TriIndices[i];
+		const FVector& A = Vertices[Indices[3 * TriangleID + 0]].pos;
+		const FVector& B = Vertices[Indices[3 * TriangleID + 1]].pos;
+		const FVector& C = Vertices[Indices[3 * TriangleID + 2]].pos;
+
+		FMeshBVHTriangle& Triangle = Triangles[i];
+		Triangle.V0 = A;
+		Triangle.Edge1 = B - A;
+		Triangle.Edge2 = C - A;
+		Triangle.TriangleID = TriangleID;
+	}
+
+	Nodes.Reserve(BinaryNodes.Num() / 2 + 1);
+	CollapseToBVH4(BinaryNodes, 0);
+}
+
+int32 FMeshBVH::CollapseToBVH4(const TArray<FMeshBVHNode>& BinaryNodes, uint32 BinaryIndex)
+{
+	// 두 자식에서 시작해, 표면적이 가장 큰 내부 노드를 그 자식 둘로 펼치기를 4개가 될 때까지 반복
+	uint32 Slots[4];
+	int32 SlotCount = 0;
+
+	const FMeshBVHNode& Source = BinaryNodes[BinaryIndex];
+	if (Source.IsLeaf())
+	{
+		// 루트 자체가 리프인 작은 메시
+		Slots[SlotCount++] = BinaryIndex;
+	}
+	else
+	{
+		Slots[SlotCount++] = Source.LeftOrFirst;
+		Slots[SlotCount++] = Source.LeftOrFirst + 1;
+
+		while (SlotCount < 4)
+		{
+			int32 ExpandSlot = -1;
+			float LargestArea = -1.0f;
+			for (int32 s = 0; s < SlotCount; ++s)
+			{
+				const FMeshBVHNode& Candidate = BinaryNodes[Slots[s]];
+				const float Area = SurfaceArea(Candidate.Bounds);
+				if (!Candidate.IsLeaf() && Area > LargestArea)
+				{
+					LargestArea = Area;
+					ExpandSlot = s;
 				}
 			}
+			if (ExpandSlot < 0)
+			{
+				break;
+			}
+
+			const uint32 FirstChild = BinaryNodes[Slots[ExpandSlot]].LeftOrFirst;
+			Slots[ExpandSlot] = FirstChild;
+			Slots[SlotCount++] = FirstChild + 1;
 		}
 	}
 
-	if (bHasHit)
+	const int32 NodeIndex = Nodes.Num();
+	Nodes.Add(FMeshBVH4Node());
+
+	for (int32 s = 0; s < 4; ++s)
 	{
-		OutHitDistance = ClosestHitDistance;
-		return true;
+		if (s >= SlotCount)
+		{
+			// 빈 슬롯: 뒤집힌 박스
+			for (int32 Axis = 0; Axis < 3; ++Axis)
+			{
+				Nodes[NodeIndex].Bounds[Axis][s] = FLT_MAX;
+				Nodes[NodeIndex].Bounds[Axis + 3][s] = -FLT_MAX;
+			}
+			Nodes[NodeIndex].Children[s] = -1;
+			Nodes[NodeIndex].Counts[s] = 0;
+			continue;
+		}
+
+		const FMeshBVHNode& Child = BinaryNodes[Slots[s]];
+
+		// 재귀 호출로 Nodes가 재할당될 수 있으므로 인덱스를 먼저 구하고 나서 기록
+		const int32 ChildIndex = Child.IsLeaf()
+			? static_cast<int32>(Child.LeftOrFirst)
+			: CollapseToBVH4(BinaryNodes, Slots[s]);
+
+		FMeshBVH4Node& Node = Nodes[NodeIndex];
+		for (int32 Axis = 0; Axis < 3; ++Axis)
+		{
+			Node.Bounds[Axis][s] = Child.Bounds.Min[Axis];
+			Node.Bounds[Axis + 3][s] = Child.Bounds.Max[Axis];
+		}
+		Node.Children[s] = ChildIndex;
+		Node.Counts[s] = Child.Count;
 	}
 
-	return false;
+	return NodeIndex;
 }
 
-bool FMeshBVH::IntersectRayWithNormal(const FRay& InLocalRay,
-	const TArray<FNormalVertex>& InVertices,
-	const TArray<uint32>& InIndices,
-	float& OutHitDistance,
-	FVector& OutHitNormal)
+// 명시적 스택으로 BVH4를 순회합니다.
+// 노드마다 자식 4개의 슬랩 검사를 SSE로 한 번에 하고, 맞은 자식을 가까운 순서로 꺼내도록 먼 것부터 쌓습니다.
+// (SSE2는 x64 기본이므로 FMathBatch처럼 런타임 분기는 두지 않음)
+template<bool bAnyHit>
+bool FMeshBVH::Traverse(const FRay& InLocalRay, float MaxDistance, bool bCullBackFaces, float& OutHitDistance, uint32& OutTriangleIndex) const
 {
 	if (Nodes.Num() == 0)
 	{
 		return false;
 	}
 
-	float RootEntry, RootExit;
-	if (!Nodes[0].Bounds.IntersectsRay(InLocalRay, RootEntry, RootExit))
+	// 방향 성분이 0이어도 0 * inf = NaN이 나오지 않도록 아주 작은 값으로 보정
+	// 방향 부호에 따라 가까운 평면(Min/Max)을 골라 두면 뒤집힌 빈 슬롯도 자연스럽게 실패
+	int32 NearRow[3];
+	int32 FarRow[3];
+	__m128 Origin[3];
+	__m128 InvDirection[3];
+	for (int32 Axis = 0; Axis < 3; ++Axis)
 	{
-		return false;
+		float Direction = InLocalRay.Direction[Axis];
+		if (std::abs(Direction) < 1e-20f)
+		{
+			Direction = Direction < 0.0f ? -1e-20f : 1e-20f;
+		}
+		const float Inv = 1.0f / Direction;
+		NearRow[Axis] = Inv >= 0.0f ? Axis : Axis + 3;
+		FarRow[Axis] = Inv >= 0.0f ? Axis + 3 : Axis;
+		Origin[Axis] = _mm_set1_ps(InLocalRay.Origin[Axis]);
+		InvDirection[Axis] = _mm_set1_ps(Inv);
 	}
 
-	struct FHeapItem
+	struct FTraversalEntry
 	{
-		int NodeIndex;
+		int32 Child;
+		uint32 Count;	// > 0이면 리프
 		float EntryDistance;
-
-		bool operator>(const FHeapItem& Other) const
-		{
-			return EntryDistance > Other.EntryDistance;
-		}
 	};
+	FTraversalEntry Stack[TraversalStackSize];
+	int32 StackTop = 0;
+	Stack[StackTop++] = { 0, 0, 0.0f };
 
-	std::priority_queue<FHeapItem, TArray<FHeapItem>, std::greater<FHeapItem>> Heap;
-	Heap.push({ 0, RootEntry });
-
-	// 가장 가까운 히트를 추적
 	bool bHasHit = false;
-	float ClosestHitDistance = std::numeric_limits<float>::max();
-	FVector ClosestHitNormal;
+	float ClosestHitDistance = MaxDistance;
+	uint32 ClosestTriangle = 0;
 
-	while (!Heap.empty())
+	while (StackTop > 0)
 	{
-		FHeapItem Current = Heap.top();
-		Heap.pop();
+		const FTraversalEntry Current = Stack[--StackTop];
 
-		// 이미 더 가까운 히트가 있으면 이 노드는 스킵
+		// 쌓은 뒤 더 가까운 히트를 찾았으면 스킵
 		if (Current.EntryDistance > ClosestHitDistance)
 		{
 			continue;
 		}
 
-		const FMeshBVHNode& Node = Nodes[Current.NodeIndex];
-		if (Node.IsLeaf())
+		if (Current.Count > 0)
 		{
-			for (uint32 TriOffset = 0; TriOffset < Node.Count; ++TriOffset)
+			const uint32 FirstTriangle = static_cast<uint32>(Current.Child);
+			for (uint32 i = FirstTriangle; i < FirstTriangle + Current.Count; ++i)
 			{
-				const uint32 TriangleID = TriIndices[Node.Start + TriOffset];
-				const uint32 V0 = InIndices[3 * TriangleID + 0];
-				const uint32 V1 = InIndices[3 * TriangleID + 1];
-				const uint32 V2 = InIndices[3 * TriangleID + 2];
-
-				const FVector& A = InVertices[V0].pos;
-				const FVector& B = InVertices[V1].pos;
-				const FVector& C = InVertices[V2].pos;
-
-				// 삼각형 노멀 계산 (backface culling용)
-				FVector Edge1 = B - A;
-				FVector Edge2 = C - A;
-				FVector TriNormal = FVector::Cross(Edge1, Edge2).GetNormalized();
-
-				// Backface culling: 레이 방향과 노멀이 같은 방향이면 스킵
-				if (FVector::Dot(TriNormal, InLocalRay.Direction) > 0.0f)
-					continue;
-
 				float HitT = 0.0f;
-				if (IntersectRayTriangleMT(InLocalRay, A, B, C, HitT))
+				if (IntersectTriangle(InLocalRay, Triangles[i], bCullBackFaces, HitT) && HitT < ClosestHitDistance)
 				{
-					// 가장 가까운 히트인 경우에만 업데이트
-					if (HitT < ClosestHitDistance)
+					ClosestHitDistance = HitT;
+					ClosestTriangle = i;
+					bHasHit = true;
+
+					if constexpr (bAnyHit)
 					{
-						ClosestHitDistance = HitT;
-						ClosestHitNormal = TriNormal;
-						bHasHit = true;
+						OutHitDistance = ClosestHitDistance;
+						OutTriangleIndex = ClosestTriangle;
+						return true;
 					}
 				}
 			}
+			continue;
 		}
-		else
+
+		const FMeshBVH4Node& Node = Nodes[Current.Child];
+
+		// 자식 4개 슬랩 검사: Entry = max(축별 near, 0), Exit = min(축별 far, 현재 최근접)
+		__m128 Entry = _mm_setzero_ps();
+		__m128 Exit = _mm_set1_ps(ClosestHitDistance);
+		for (int32 Axis = 0; Axis < 3; ++Axis)
+		{
+			const __m128 Near = _mm_mul_ps(_mm_sub_ps(_mm_load_ps(Node.Bounds[NearRow[Axis]]), Origin[Axis]), InvDirection[Axis]);
+			const __m128 Far = _mm_mul_ps(_mm_sub_ps(_mm_load_ps(Node.Bounds[FarRow[Axis]]), Origin[Axis]), InvDirection[Axis]);
+			Entry = _mm_max_ps(Entry, Near);
+			Exit = _mm_min_ps(Exit, Far);
+		}
+
+		const int32 HitMask = _mm_movemask_ps(_mm_cmple_ps(Entry, Exit));
+		if (HitMask == 0)
+		{
+			continue;
+		}
+
+		alignas(16) float EntryDistances[4];
+		_mm_store_ps(EntryDistances, Entry);
+
+		// 맞은 자식을 먼 것부터 정렬 (최대 4개라 삽입 정렬)
+		int32 Order[4];
+		int32 HitCount = 0;
+		for (int32 s = 0; s < 4; ++s)
 		{
-			if (Node.Left >= 0)
+			if ((HitMask & (1 << s)) == 0)
 			{
-				float ChildEntry, ChildExit;
-				if (Nodes[Node.Left].Bounds.IntersectsRay(InLocalRay, ChildEntry, ChildExit))
-				{
-					// 이미 더 가까운 히트가 있으면 자식 노드 추가하지 않음
-					if (ChildEntry < ClosestHitDistance)
-					{
-						Heap.push({ Node.Left, ChildEntry });
-					}
-				}
+				continue;
 			}
-			if (Node.Right >= 0)
+			int32 Insert = HitCount++;
+			while (Insert > 0 && EntryDistances[Order[Insert - 1]] < EntryDistances[s])
 			{
-				float ChildEntry, ChildExit;
-				if (Nodes[Node.Right].Bounds.IntersectsRay(InLocalRay, ChildEntry, ChildExit))
-				{
-					if (ChildEntry < ClosestHitDistance)
-					{
-						Heap.push({ Node.Right, ChildEntry });
-					}
-				}
+				Order[Insert] = Order[Insert - 1];
+				--Insert;
 			}
+			Order[Insert] = s;
+		}
+
+		for (int32 k = 0; k < HitCount; ++k)
+		{
+			const int32 s = Order[k];
+			Stack[StackTop++] = { Node.Children[s], Node.Counts[s], EntryDistances[s] };
 		}
 	}
 
 	if (bHasHit)
 	{
 		OutHitDistance = ClosestHitDistance;
-		OutHitNormal = ClosestHitNormal;
-		return true;
+		OutTriangleIndex = ClosestTriangle;
 	}
-
-	return false;
+	return bHasHit;
 }
 
-//bool FMeshBVH::IntersectRay(const FRay& InLocalRay, const TArray<FNormalVertex>& InVertices, const TArray<uint32>& InIndices, float& OutHitDistance)
-//{
-//	if (Nodes.Num() == 0)
-//	{
-//		return false;
-//	}
-//
-//	TArray<FStackItem> NodeStack;
-//
-//	float RootEntryDistance, RootExitDistance;
-//	// 루트 노드가 안맞으면 바로 리턴 
-//	if (!Nodes[0].Bounds.RayAABB_IntersectT(InLocalRay, RootEntryDistance, RootExitDistance))
-//	{
-//		return false;
-//	}
-//	// 가장 늦게 나간 RootEntryDistance
-//	// 삼각형 리스트 인덱스 , 디스턴스 값 저장 
-//	NodeStack.Add({ 0, RootEntryDistance });
-//	bool bHasHit = false;
-//	float ClosestHitDistance = std::numeric_limits<float>::infinity();
-//
-//	// 깊이 우선 탐색 (DFS). 
-//	// 이미 더 가까운 교차가 있으면 멀리 있는 노드는 스킵.
-//	while (!NodeStack.IsEmpty())
-//	{
-//		const FStackItem CurrentItem = NodeStack.Pop();
-//		// 이미 가까운 교차가 있으면 무시 
-//		if (CurrentItem.EntryDistance > ClosestHitDistance)
-//		{
-//			continue;
-//		}
-//
-//		const FMeshBVHNode& CurrentNode = Nodes[CurrentItem.NodeIndex];
-//		if (CurrentNode.IsLeaf())
-//		{
-//			// 총 삼각형의 개수 만큼 돈다. 
-//			for (uint32 TriangleOffset = 0; TriangleOffset < CurrentNode.Count; ++TriangleOffset)
-//			{
-//				// 삼각형 배열에서 시작 위치 Start, TriangleOffset 삼각형의 총 개수만큼 돈다. 
-//				// 그쪽 영역의 삼각형이기 때문이다
-//				const uint32 TriangleID = TriIndices[CurrentNode.Start + TriangleOffset];
-//
-//				const uint32 VertexIndex0 = InIndices[3 * TriangleID + 0];
-//				const uint32 VertexIndex1 = InIndices[3 * TriangleID + 1];
-//				const uint32 VertexIndex2 = InIndices[3 * TriangleID + 2];
-//
-//				const FVector& VertexA = InVertices[VertexIndex0].pos;
-//				const FVector& VertexB = InVertices[VertexIndex1].pos;
-//				const FVector& VertexC = InVertices[VertexIndex2].pos;
-//
-//				float HitDistance = 0.0f;
-//				if (IntersectRayTriangleMT(InLocalRay, VertexA, VertexB, VertexC, HitDistance))
-//				{
-//					if (HitDistance < ClosestHitDistance)
-//					{
-//						ClosestHitDistance = HitDistance;
-//						bHasHit = true;
-//					}
-//				}
-//			}
-//			continue;
-//		}
-//
-//		// 내부 노드 → 자식 검사
-//		// 삼각형에 맞으면, 검사 영역에 넣어주고 맞지 않으면 넣어주지 않는다. 
-//		if (CurrentNode.Left >= 0)
-//		{
-//			float ChildEntry, ChildExit;
-//			if (Nodes[CurrentNode.Left].Bounds.RayAABB_IntersectT(InLocalRay, ChildEntry, ChildExit))
-//			{
-//				NodeStack.Add({ CurrentNode.Left, ChildEntry });
-//			}
-//		}
-//		if (CurrentNode.Right >= 0)
-//		{
-//			float ChildEntry, ChildExit;
-//			if (Nodes[CurrentNode.Right].Bounds.RayAABB_IntersectT(InLocalRay, ChildEntry, ChildExit))
-//			{
-//				NodeStack.Add({ CurrentNode.Right, ChildEntry });
-//			}
-//		}
-//	}
-//
-//	if (bHasHit)
-//	{
-//		OutHitDistance = ClosestHitDistance;
-//		return true;
-//	}
-//	return false;
-//}
-
-FAABB FMeshBVH::ComputeTriBounds(uint32 TriangleID, const TArray<FNormalVertex>& Vertices, const TArray<uint32>& Indices) const
-{
-	// TriangleID : 몇 번째 삼각형인지 (0번, 1번 , 2번)
-	uint32 VertexIndex0, VertexIndex1, VertexIndex2;
-
-	// 순차적으로 꺼내온다. 
-	VertexIndex0 = Indices[3 * TriangleID + 0];
-	VertexIndex1 = Indices[3 * TriangleID + 1];
-	VertexIndex2 = Indices[3 * TriangleID + 2];
-
-
-	// 실제 정점 좌표들을 가져온다. 
-	const FVector& VertexA = Vertices[VertexIndex0].pos;
-	const FVector& VertexB = Vertices[VertexIndex1].pos;
-	const FVector& VertexC = Vertices[VertexIndex2].pos;
-
-	// AABB 최소/최대 좌표 계산
-	FVector MinCorner(
-		std::min({ VertexA.X, VertexB.X, VertexC.X }),
-		std::min({ VertexA.Y, VertexB.Y, VertexC.Y }),
-		std::min({ VertexA.Z, VertexB.Z, VertexC.Z })
-	);
-
-	FVector MaxCorner(
-		std::max({ VertexA.X, VertexB.X, VertexC.X }),
-		std::max({ VertexA.Y, VertexB.Y, VertexC.Y }),
-		std::max({ VertexA.Z, VertexB.Z, VertexC.Z })
-	);
-
-	// 삼각형의 바운딩 박스 반환
-	return FAABB(MinCorner, MaxCorner);
-}
-
-FVector FMeshBVH::ComputeTriCenter(uint32 TriangleID, const TArray<FNormalVertex>& Vertices, const TArray<uint32>& Indices) const
+// 삼각형과 맞을 경우 , BVH를 따라 내려가면서 교차 가능성 있는 노드만 검사한다.
+// Möller–Trumbore로 교차 체크 !
+bool FMeshBVH::IntersectRay(const FRay& InLocalRay, float& OutHitDistance) const
 {
-	// 삼각형을 구성하는 세 개의 정점 인덱스
-	const uint32 VertexIndex0 = Indices[TriangleID * 3 + 0];
-	const uint32 VertexIndex1 = Indices[TriangleID * 3 + 1];
-	const uint32 VertexIndex2 = Indices[TriangleID * 3 + 2];
-
-	// 실제 좌표
-	const FVector& Position0 = Vertices[VertexIndex0].pos;
-	const FVector& Position1 = Vertices[VertexIndex1].pos;
-	const FVector& Position2 = Vertices[VertexIndex2].pos;
-
-	// 중심점(무게중심) 계산
-
-	const FVector TriangleCenter = (Position0 + Position1 + Position2) / 3.0f;
-
-	return TriangleCenter;
+	uint32 TriangleIndex = 0;
+	return Traverse<false>(InLocalRay, FLT_MAX, false, OutHitDistance, TriangleIndex);
 }
 
-// 여러 삼각형을 한 번에 감싸는 AABB를 계산 
-FAABB FMeshBVH::ComputeBounds(uint32 Start, uint32 Count, const TArray<FNormalVertex>& Vertices, const TArray<uint32>& Indices) const
+bool FMeshBVH::IntersectRayWithNormal(const FRay& InLocalRay, float& OutHitDistance, FVector& OutHitNormal, bool bCullBackFaces) const
 {
-	// 첫 번째 삼각형 ID로 AABB 초기화 
-	FAABB Bounds = ComputeTriBounds(TriIndices[Start], Vertices, Indices);
-	// Start+1 ~ Start+Count-1 까지 모든 삼각형에 대해 반복 
-	// 가장 큰 MIN , MAX 찾아낸다. 
-	for (uint32 i = 1; i < Count; i++)
+	uint32 TriangleIndex = 0;
+	if (!Traverse<false>(InLocalRay, FLT_MAX, bCullBackFaces, OutHitDistance, TriangleIndex))
 	{
-		FAABB TB = ComputeTriBounds(TriIndices[Start + i], Vertices, Indices);
-		Bounds.Min = Bounds.Min.ComponentMin(TB.Min);
-		Bounds.Max = Bounds.Max.ComponentMax(TB.Max);
+		return false;
 	}
-	return Bounds;
+
+	const FMeshBVHTriangle& Triangle = Triangles[TriangleIndex];
+	OutHitNormal = FVector::Cross(Triangle.Edge1, Triangle.Edge2).GetNormalized();
+	return true;
 }
 
-// BVH 트리 -> 재귀 구축 
-int FMeshBVH::BuildRecursive(uint32 Start, uint32 Count, const TArray<FNormalVertex>& Vertices, const TArray<uint32>& Indices)
+bool FMeshBVH::IntersectRayAny(const FRay& InLocalRay, float MaxDistance, bool bCullBackFaces) const
 {
-	FMeshBVHNode Node;
-	Node.Start = Start;
-	Node.Count = Count;
-
-	// 이 노드가 감싸는 AABB 계산
-	Node.Bounds = ComputeBounds(Start, Count, Vertices, Indices);
-
-	// 현재 노드 인덱스 확보 & 추가 -> 자식으로 쪼갤 때 사용 
-	int NodeIndex = Nodes.Num();
-	Nodes.Add(Node);
-
-	// 리프 조건: 삼각형 개수가 LeafSize 이하
-	if (Count <= LeafSize)
-	{
-		return NodeIndex;
-	}
-
-	// -------------------------------
-	// 분할 축 선택 (가장 긴 축)
-	// -------------------------------
-	FVector Extent = Node.Bounds.GetHalfExtent();
-	EAxis Axis = EAxis::X;
-
-	if (Extent.Y > Extent.X && Extent.Y >= Extent.Z)
-		Axis = EAxis::Y;
-	else if (Extent.Z > Extent.X && Extent.Z >= Extent.Y)
-		Axis = EAxis::Z;
-
-	// 중간 지점 -> 반으로 쪼갤 준비하기 
-	uint32 Mid = Start + Count / 2;
-
-	// -------------------------------
-	// 삼각형 중심 좌표 기준으로 분할
-	// -------------------------------
-	// 오른쪽 왼쪽으로 나누기 좋은 
-	// nth_element 가이드 
-	// nth_element(first, nth, last, comp)
-	// nth 위치에 "정렬했을 때 올 원소"를 제자리에 넣음
-	// 왼쪽 구간 [first, nth) 에는 그 원소보다 "작은 것들"만
-	// 오른쪽 구간 [nth+1, last) 에는 "큰 것들"만 놓음
-
-	// 선택된 Axis를 방향으로 왼쪽과 오른쪽으로 나눈다. 
-	// 전체를 정렬하지 않고, n번째 작은 원소를 찾아서 놓는다. 
-	std::nth_element(
-		TriIndices.begin() + Start, // 분할할 구간 시작
-		TriIndices.begin() + Mid, // 중간 값의 위치 
-		TriIndices.begin() + Start + Count, // 분할할 구간의 끝 
-		[&](uint32 A, uint32 B)			// 비교함수 
-		{
-			FVector CenterA = ComputeTriCenter(A, Vertices, Indices);
-			FVector CenterB = ComputeTriCenter(B, Vertices, Indices);
-
-			switch (Axis)
-			{
-			case EAxis::X: return CenterA.X < CenterB.X;
-			case EAxis::Y: return CenterA.Y < CenterB.Y;
-			case EAxis::Z: return CenterA.Z < CenterB.Z;
-			default:       return CenterA.X < CenterB.X;
-			}
-		});
-
-	// -------------------------------
-	// 내부 노드로 전환 & 자식 생성
-	// -------------------------------
-	// 자식 생성으로 본인 Count 초기화.
-	// Left, Right에 자식 달기 
-	Nodes[NodeIndex].Count = 0;
-	Nodes[NodeIndex].Left = BuildRecursive(Start, Mid - Start, Vertices, Indices);
-	Nodes[NodeIndex].Right = BuildRecursive(Mid, Start + Count - Mid, Vertices, Indices);
-
-	return NodeIndex;
+	float HitDistance = 0.0f;
+	uint32 TriangleIndex = 0;
+	return Traverse<true>(InLocalRay, MaxDistance, bCullBackFaces, HitDistance, TriangleIndex);
 }
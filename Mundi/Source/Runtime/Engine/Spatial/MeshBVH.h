@@ -1,50 +1,72 @@
 ﻿#pragma once
 #include "AABB.h"
 
+// SAH 빌드 결과 이진 노드 (32바이트)
+// 내부 노드: LeftOrFirst = 왼쪽 자식 인덱스 (오른쪽 자식은 항상 LeftOrFirst + 1), Count = 0
+// 리프 노드: LeftOrFirst = Triangles 시작 위치, Count = 삼각형 개수
 struct FMeshBVHNode
 {
-	FAABB Bounds;     // 이 노드가 감싸는 AABB
-	int Left = -1;     // 왼쪽 자식 인덱스
-	int Right = -1;    // 오른쪽 자식 인덱스
-	uint32 Start = 0;  // TriIndices 배열에서 시작 위치
-	uint32 Count = 0;  // 리프 노드라면 포함된 삼각형 개수 
+	FAABB Bounds;
+	uint32 LeftOrFirst = 0;
+	uint32 Count = 0;
 
 	bool IsLeaf() const { return Count > 0; }
 };
+static_assert(sizeof(FMeshBVHNode) == 32, "FMeshBVHNode must stay 32 bytes");
 
-struct FStackItem
+// 순회용 4-wide 노드: 자식 4개의 AABB를 SoA로 저장해 SSE 한 번으로 슬랩 검사
+// 자식 하나당 32바이트 (바운드 24 + 인덱스/개수 8)
+// Counts[i] == 0 : Children[i]는 내부 노드 인덱스
+// Counts[i] >  0 : Children[i]부터 Counts[i]개의 Triangles를 가진 리프
+// 빈 슬롯은 Min > Max로 뒤집힌 박스라 슬랩 검사에서 항상 실패
+struct alignas(16) FMeshBVH4Node
 {
-	int32 NodeIndex;
-	float EntryDistance;
+	float Bounds[6][4];	// MinX, MinY, MinZ, MaxX, MaxY, MaxZ
+	int32 Children[4];
+	uint32 Counts[4];
 };
+static_assert(sizeof(FMeshBVH4Node) == 128, "FMeshBVH4Node must stay 128 bytes");
+
+// 레이 검사에 필요한 값만 미리 계산해 리프 순서대로 저장한 삼각형
+// (인덱스 버퍼/정점 버퍼를 다시 읽지 않음)
+struct FMeshBVHTriangle
+{
+	FVector V0;
+	FVector Edge1;	// V1 - V0
+	FVector Edge2;	// V2 - V0
+	uint32 TriangleID;	// 원래 인덱스 버퍼에서의 삼각형 번호
+};
+
 class FMeshBVH
 {
 public:
 
+	// 빈 분할 SAH로 이진 트리를 만든 뒤 BVH4로 접어서 저장
 	void Build(const TArray<FNormalVertex>& Vertices, const TArray<uint32>& Indices);
 
-	bool IntersectRay(const FRay& InLocalRay, const TArray<FNormalVertex>& InVertices, const TArray<uint32>& InIndices, float& OutHitDistance);
+	// 가장 가까운 히트 (양면 검사)
+	bool IntersectRay(const FRay& InLocalRay, float& OutHitDistance) const;
 
 	// 히트 노멀도 함께 반환하는 버전
-	bool IntersectRayWithNormal(const FRay& InLocalRay, const TArray<FNormalVertex>& InVertices, const TArray<uint32>& InIndices, float& OutHitDistance, FVector& OutHitNormal);
+	// bCullBackFaces가 false면 양면 검사 (노멀은 삼각형 감김 방향 그대로 반환)
+	bool IntersectRayWithNormal(const FRay& InLocalRay, float& OutHitDistance, FVector& OutHitNormal, bool bCullBackFaces = true) const;
 
+	// MaxDistance 안에 아무 삼각형이나 맞으면 바로 true (그림자/가시성 검사용)
+	bool IntersectRayAny(const FRay& InLocalRay, float MaxDistance, bool bCullBackFaces = false) const;
 
-private:
-	// Helper 함수들
-	FAABB ComputeTriBounds(uint32 TriangleID, const TArray<FNormalVertex>& Vertices, const TArray<uint32>& Indices) const;
-
-	FVector ComputeTriCenter(uint32 TriangleID, const TArray<FNormalVertex>& Vertices, const TArray<uint32>& Indices) const;
+	int32 GetTriangleCount() const { return Triangles.Num(); }
+	int32 GetNodeCount() const { return Nodes.Num(); }
 
-	FAABB ComputeBounds(uint32 Start, uint32 Count, const TArray<FNormalVertex>& Vertices, const TArray<uint32>& Indices) const;
+private:
+	// AnyHit이면 첫 히트에서 종료, 아니면 가장 가까운 히트를 찾음
+	template<bool bAnyHit>
+	bool Traverse(const FRay& InLocalRay, float MaxDistance, bool bCullBackFaces, float& OutHitDistance, uint32& OutTriangleIndex) const;
 
-	int BuildRecursive(uint32 Start, uint32 Count, const TArray<FNormalVertex>& Vertices, const TArray<uint32>& Indices);
+	// BinaryNodes[BinaryIndex]의 자식들을 최대 4개까지 모아 BVH4 노드를 만들고 인덱스 반환
+	int32 CollapseToBVH4(const TArray<FMeshBVHNode>& BinaryNodes, uint32 BinaryIndex);
 
 private:
 
-	TArray<FMeshBVHNode> Nodes;
-	//삼각형 ID(번호) 목록 , 삼각형의 인덱스를 의미한다. 
-	//삼각형 순서만 재배치  , 정점 좌표와 인덱스 버퍼를 직접적으로 건들면 안되기 때문이다.
-	TArray<uint32> TriIndices;
-	const uint32 LeafSize = 4;
+	TArray<FMeshBVH4Node> Nodes;
+	TArray<FMeshBVHTriangle> Triangles;
 };
-
@@ -0,0 +1,180 @@
+﻿#include "pch.h"
+#include "MeshBVHBenchmark.h"
+#include "MeshBVH.h"
+#include "ResourceManager.h"
+#include "StaticMesh.h"
+#include "PlatformTime.h"
+
+namespace
+{
+    // 브루트 포스는 레이마다 모든 삼각형을 검사하므로 이 개수만큼만 측정/검증
+    constexpr int32 BruteForceRayCount = 256;
+
+    double ToSeconds(uint64 Cycles)
+    {
+        return FPlatformTime::ToMilliseconds(Cycles) / 1000.0;
+    }
+
+    FVector MakeRandomUnitVector(FRandomStream& Stream)
+    {
+        // 단위 구 안에서 뽑아 정규화 (각 방향이 고르게 나오도록)
+        while (true)
+        {
+            const float X = Stream.FRandRange(-1.0f, 1.0f);
+            const float Y = Stream.FRandRange(-1.0f, 1.0f);
+            const float Z = Stream.FRandRange(-1.0f, 1.0f);
+            const FVector Candidate(X, Y, Z);
+            const float SizeSquared = FVector::Dot(Candidate, Candidate);
+            if (SizeSquared > 1e-4f && SizeSquared <= 1.0f)
+            {
+                return Candidate.GetNormalized();
+            }
+        }
+    }
+
+    // 메시 바운드를 감싸는 구 위에서 바운드 안쪽 임의의 점을 향하는 레이
+    // 매 실행 같은 레이로 비교하도록 고정 시드 사용
+    TArray<FRay> BuildRays(const FStaticMesh& Mesh, int32 RayCount)
+    {
+        FVector Min(FLT_MAX, FLT_MAX, FLT_MAX);
+        FVector Max(-FLT_MAX, -FLT_MAX, -FLT_MAX);
+        for (const FNormalVertex& Vertex : Mesh.Vertices)
+        {
+            Min = FVector(std::min(Min.X, Vertex.pos.X), std::min(Min.Y, Vertex.pos.Y), std::min(Min.Z, Vertex.pos.Z));
+            Max = FVector(std::max(Max.X, Vertex.pos.X), std::max(Max.Y, Vertex.pos.Y), std::max(Max.Z, Vertex.pos.Z));
+        }
+        const FVector Center = (Min + Max) * 0.5f;
+        const FVector HalfExtent = (Max - Min) * 0.5f;
+        const float Radius = std::max(HalfExtent.Size() * 2.0f, 1e-3f);
+
+        FRandomStream Stream(0x4D657368ull);
+        TArray<FRay> Rays;
+        Rays.SetNum(RayCount);
+        for (FRay& Ray : Rays)
+        {
+            Ray.Origin = Center + MakeRandomUnitVector(Stream) * Radius;
+
+            const float X = Stream.FRandRange(-1.0f, 1.0f);
+            const float Y = Stream.FRandRange(-1.0f, 1.0f);
+            const float Z = Stream.FRandRange(-1.0f, 1.0f);
+            const FVector Target = Center + FVector(HalfExtent.X * X, HalfExtent.Y * Y, HalfExtent.Z * Z);
+            Ray.Direction = (Target - Ray.Origin).GetNormalized();
+        }
+        return Rays;
+    }
+
+    // 기준: 모든 삼각형을 IntersectRayTriangleMT로 검사
+    bool RaycastBruteForce(const FStaticMesh& Mesh, const FRay& Ray, float& OutHitDistance)
+    {
+        bool bHasHit = false;
+        OutHitDistance = FLT_MAX;
+        for (int32 i = 0; i + 2 < Mesh.Indices.Num(); i += 3)
+        {
+            float HitT = 0.0f;
+            if (IntersectRayTriangleMT(Ray, Mesh.Vertices[Mesh.Indices[i]].pos, Mesh.Vertices[Mesh.Indices[i + 1]].pos, Mesh.Vertices[Mesh.Indices[i + 2]].pos, HitT)
+                && HitT < OutHitDistance)
+            {
+                OutHitDistance = HitT;
+                bHasHit = true;
+            }
+        }
+        return bHasHit;
+    }
+
+    FMeshBVHBenchmarkResult RunMesh(const FString& Name, const FStaticMesh& Mesh, int32 RayCount, int32 BuildIterations)
+    {
+        FMeshBVHBenchmarkResult Result;
+        Result.Name = Name;
+        Result.TriangleCount = Mesh.Indices.Num() / 3;
+
+        FMeshBVH BVH;
+        const uint64 BuildStart = FPlatformTime::Cycles64();
+        for (int32 Iteration = 0; Iteration < BuildIterations; ++Iteration)
+        {
+            BVH.Build(Mesh.Vertices, Mesh.Indices);
+        }
+        Result.BuildMilliseconds = FPlatformTime::ToMilliseconds(FPlatformTime::Cycles64() - BuildStart) / BuildIterations;
+        Result.NodeCount = BVH.GetNodeCount();
+
+        const TArray<FRay> Rays = BuildRays(Mesh, RayCount);
+        const int32 BruteCount = std::min(RayCount, BruteForceRayCount);
+
+        // 브루트 포스 (기준 결과)
+        TArray<float> Expected;
+        Expected.SetNum(BruteCount);
+        const uint64 BruteStart = FPlatformTime::Cycles64();
+        for (int32 i = 0; i < BruteCount; ++i)
+        {
+            float HitT = 0.0f;
+            Expected[i] = RaycastBruteForce(Mesh, Rays[i], HitT) ? HitT : -1.0f;
+        }
+        Result.BruteForceRaysPerSecond = BruteCount / std::max(ToSeconds(FPlatformTime::Cycles64() - BruteStart), 1e-9);
+
+        // 최근접 히트
+        TArray<float> Closest;
+        Closest.SetNum(RayCount);
+        const uint64 ClosestStart = FPlatformTime::Cycles64();
+        for (int32 i = 0; i < RayCount; ++i)
+        {
+            float HitT = 0.0f;
+            Closest[i] = BVH.IntersectRay(Rays[i], HitT) ? HitT : -1.0f;
+        }
+        Result.ClosestRaysPerSecond = RayCount / std::max(ToSeconds(FPlatformTime::Cycles64() - ClosestStart), 1e-9);
+
+        // 아무 히트 (양면, 거리 제한 없음 -> 히트 여부는 최근접과 같아야 함)
+        TArray<uint8> AnyHit;
+        AnyHit.SetNum(RayCount);
+        const uint64 AnyStart = FPlatformTime::Cycles64();
+        for (int32 i = 0; i < RayCount; ++i)
+        {
+            AnyHit[i] = BVH.IntersectRayAny(Rays[i], FLT_MAX) ? 1 : 0;
+        }
+        Result.AnyHitRaysPerSecond = RayCount / std::max(ToSeconds(FPlatformTime::Cycles64() - AnyStart), 1e-9);
+
+        for (int32 i = 0; i < BruteCount; ++i)
+        {
+            const bool bExpectedHit = Expected[i] >= 0.0f;
+            const bool bClosestMatches = bExpectedHit
+                ? (Closest[i] >= 0.0f && std::abs(Closest[i] - Expected[i]) <= 1e-4f * std::max(1.0f, Expected[i]))
+                : Closest[i] < 0.0f;
+            const bool bAnyMatches = (AnyHit[i] != 0) == bExpectedHit;
+            Result.Mismatches += (bClosestMatches && bAnyMatches) ? 0 : 1;
+        }
+        return Result;
+    }
+}
+
+namespace FMeshBVHBenchmark
+{
+    TArray<FMeshBVHBenchmarkResult> Run(int32 RayCount, int32 BuildIterations)
+    {
+        TArray<FMeshBVHBenchmarkResult> Results;
+        if (RayCount <= 0 || BuildIterations <= 0)
+        {
+            return Results;
+        }
+
+        for (UStaticMesh* StaticMesh : UResourceManager::GetInstance().GetAll<UStaticMesh>())
+        {
+            const FStaticMesh* Mesh = StaticMesh ? StaticMesh->GetStaticMeshAsset() : nullptr;
+            if (!Mesh || Mesh->Indices.Num() < 3 || Mesh->Vertices.IsEmpty())
+            {
+                continue;
+            }
+
+            Results.Add(RunMesh(StaticMesh->GetAssetPathFileName(), *Mesh, RayCount, BuildIterations));
+        }
+        return Results;
+    }
+
+    FString FormatResult(const FMeshBVHBenchmarkResult& Result)
+    {
+        char Buffer[320];
+        snprintf(Buffer, sizeof(Buffer),
+            "%-40s %7d tris | build %8.2fms | brute %7.3f | closest %7.3f | any %7.3f Mrays/s | mismatch %d",
+            Result.Name.c_str(), Result.TriangleCount, Result.BuildMilliseconds,
+            Result.BruteForceRaysPerSecond / 1e6, Result.ClosestRaysPerSecond / 1e6, Result.AnyHitRaysPerSecond / 1e6,
+            Result.Mismatches);
+        return FString(Buffer);
+    }
+}
@@ -0,0 +1,26 @@
+﻿#pragma once
+
+// 메시 BVH 빌드 시간과 레이 처리량 측정 결과 (메시 하나당 한 줄)
+struct FMeshBVHBenchmarkResult
+{
+    FString Name;                       // 메시 경로
+    int32 TriangleCount = 0;
+    int32 NodeCount = 0;                // BVH4 노드 수
+    double BuildMilliseconds = 0.0;     // Build 1회 평균
+    double BruteForceRaysPerSecond = 0.0;   // 모든 삼각형 검사 (기준)
+    double ClosestRaysPerSecond = 0.0;      // IntersectRay
+    double AnyHitRaysPerSecond = 0.0;       // IntersectRayAny
+    int32 Mismatches = 0;               // 브루트 포스 대비 히트 여부/거리 불일치 개수
+};
+
+// 콘솔 명령 "BENCH MESHBVH"에서 사용
+namespace FMeshBVHBenchmark
+{
+    // 리소스 매니저에 로드된 스태틱 메시(Data/ 아래 OBJ/FBX)마다 BVH를 빌드하고,
+    // 메시 바깥에서 안쪽을 향하는 RayCount개 레이로 처리량을 측정합니다.
+    // 브루트 포스는 느리므로 앞쪽 일부 레이로만 측정/검증합니다.
+    TArray<FMeshBVHBenchmarkResult> Run(int32 RayCount = 16384, int32 BuildIterations = 3);
+
+    // 결과 한 줄 포맷: "Name  12345 tris | build 3.21ms | brute 0.01 | closest 2.10 | any 2.50 Mrays/s | mismatch 0"
+    FString FormatResult(const FMeshBVHBenchmarkResult& Result);
+}
@@ -376,7 +376,7 @@ void FOctree::DebugDump() const
             N->Actors.size(),
             N->Bounds.Min.X, N->Bounds.Min.Y, N->Bounds.Min.Z,
             N->Bounds.Max.X, N->Bounds.Max.Y, N->Bounds.Max.Z , length);
-        UE_LOG(buf);
+        UE_LOG("%s", buf);
 
 
 
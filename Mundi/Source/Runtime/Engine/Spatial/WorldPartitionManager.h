@@ -1,6 +1,7 @@
 ﻿#pragma once
 #include "Object.h"
 #include "Vector.h"
+#include "SceneQuery.h"
 
 class UPrimitiveComponent;
 class AStaticMeshActor;
@@ -39,6 +40,19 @@ public:
     void RayQueryClosest(FRay InRay, OUT AActor*& OutActor, OUT float& OutBestT);
 	void FrustumQuery(FFrustum InFrustum);
 
+	// ───── 씬 쿼리 (SceneQuery.h) ─────
+	// Ray.Direction은 정규화되어 있어야 합니다.
+	bool RaycastClosest(const FRay& Ray, float MaxDistance, OUT FHitResult& OutHit, const FCollisionQueryParams& Params = FCollisionQueryParams()) const;
+	// 가장 가까운 히트가 아니라 아무 히트나 찾으면 바로 반환 (가림/지면 확인용)
+	bool RaycastAny(const FRay& Ray, float MaxDistance, OUT FHitResult& OutHit, const FCollisionQueryParams& Params = FCollisionQueryParams()) const;
+	bool SweepClosest(const FSweepRequest& Sweep, OUT FHitResult& OutHit, const FCollisionQueryParams& Params = FCollisionQueryParams()) const;
+	bool Overlap(const FShape& Shape, const FTransform& Transform, OUT TArray<FOverlapInfo>& OutOverlaps, const FCollisionQueryParams& Params = FCollisionQueryParams()) const;
+
+	// 일괄 쿼리: FBVHierarchy::MaxPacketSize개씩 묶어 BVH 순회를 공유하고, 묶음들은 병렬로 처리합니다.
+	// OutHits[i]가 Requests[i]의 결과입니다 (bBlockingHit == false면 히트 없음).
+	void BatchRaycast(const TArray<FRaycastRequest>& Requests, OUT TArray<FHitResult>& OutHits, const FCollisionQueryParams& Params = FCollisionQueryParams(), bool bAnyHit = false) const;
+	void BatchSweep(const TArray<FSweepRequest>& Requests, OUT TArray<FHitResult>& OutHits, const FCollisionQueryParams& Params = FCollisionQueryParams()) const;
+
 	/** 옥트리 게터 */
 	FOctree* GetSceneOctree() const { return SceneOctree; }
 	/** BVH 게터 */
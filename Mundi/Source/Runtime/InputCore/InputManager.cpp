@@ -152,7 +152,7 @@ void UInputManager::ProcessMessage(HWND hWnd, UINT message, WPARAM wParam, LPARA
             char debugMsg[128];
             sprintf_s(debugMsg, "ImGui State - WantMouse: %d, WantKeyboard: %d\n", 
                       IsUIHover, IsKeyBoardCapture);
-            UE_LOG(debugMsg);
+            UE_LOG("%s", debugMsg);
         }
     }
     else
@@ -276,7 +276,7 @@ void UInputManager::ProcessMessage(HWND hWnd, UINT message, WPARAM wParam, LPARA
             {
                 char debugMsg[64];
                 sprintf_s(debugMsg, "InputManager: Mouse Wheel - Delta: %.2f\n", MouseWheelDelta);
-                UE_LOG(debugMsg);
+                UE_LOG("%s", debugMsg);
             }
         }
         break;
@@ -294,7 +294,7 @@ void UInputManager::ProcessMessage(HWND hWnd, UINT message, WPARAM wParam, LPARA
             {
                 char debugMsg[64];
                 sprintf_s(debugMsg, "InputManager: Key Down - %d\n", KeyCode);
-                UE_LOG(debugMsg);
+                UE_LOG("%s", debugMsg);
             }
         }
         break;
@@ -312,7 +312,7 @@ void UInputManager::ProcessMessage(HWND hWnd, UINT message, WPARAM wParam, LPARA
             {
                 char debugMsg[64];
                 sprintf_s(debugMsg, "InputManager: Key UP - %d\n", KeyCode);
-                UE_LOG(debugMsg);
+                UE_LOG("%s", debugMsg);
             }
         }
         break;
@@ -340,7 +340,7 @@ bool UInputManager::IsMouseButtonPressed(EMouseButton Button) const
         char debugMsg[128];
         sprintf_s(debugMsg, "IsPressed: Current=%d, Previous=%d, Result=%d\n", 
                   currentState, previousState, isPressed);
-        UE_LOG(debugMsg);
+        UE_LOG("%s", debugMsg);
     }
     
     return isPressed;
@@ -17,10 +17,12 @@ struct ViewProjBufferType // b1 고유번호 고정
     FMatrix InvProj;
 };
 
+// 타일 데칼 패스 설정 (b6), 데칼별 행렬/불투명도는 FTileDecalCuller의 Structured Buffer로 전달
 struct DecalBufferType
 {
-    FMatrix DecalMatrix;
-    float Opacity;
+    uint32 DecalCount;
+    uint32 MaxDecalsPerTile;
+    FVector2D Padding;
 };
 
 // Fireball material parameters (b6 in PS)
@@ -167,6 +169,18 @@ struct ColorBufferType // b3
         : Color(InColor), UUID(InUUID), Padding(FVector(UVStart, UVEnd, UseTexture)) {}
 };
 
+// b9: 파티클 인스턴스 버퍼에서 이번 드로우가 읽기 시작할 위치
+// (SV_InstanceID에는 StartInstanceLocation이 더해지지 않으므로 상수 버퍼로 전달)
+struct FParticleInstanceBufferType
+{
+    uint32 FirstInstance;
+    uint32 Padding[3];
+
+    FParticleInstanceBufferType() = default;
+    explicit FParticleInstanceBufferType(uint32 InFirstInstance)
+        : FirstInstance(InFirstInstance), Padding{ 0, 0, 0 } {}
+};
+
 struct FLightBufferType
 {
     FAmbientLightInfo AmbientLight;
@@ -208,7 +222,12 @@ struct FTileCullingBufferType
     uint32 bUseTileCulling;   // 타일 컬링 활성화 여부 (0=비활성화, 1=활성화)
     uint32 ViewportStartX;    // 뷰포트 시작 X 좌표
     uint32 ViewportStartY;    // 뷰포트 시작 Y 좌표
-    uint32 Padding[2];
+    uint32 ClusterSliceCount; // 깊이 슬라이스 개수
+    uint32 Padding0;
+    float ClusterDepthScale;  // Slice = floor(log2(ViewDepth) * Scale + Bias)
+    float ClusterDepthBias;
+    float Padding1[2];
+    FVector4 ViewDepthPlane;  // 뷰 공간 깊이 = dot(WorldPos, xyz) + w
 };
 
 struct FPointLightShadowBufferType
@@ -239,6 +258,7 @@ MACRO(FXAABufferType)               \
 MACRO(FPixelConstBufferType)        \
 MACRO(ViewProjBufferType)           \
 MACRO(ColorBufferType)              \
+MACRO(FParticleInstanceBufferType)  \
 MACRO(CameraBufferType)             \
 MACRO(FLightBufferType)             \
 MACRO(FViewportConstants)           \
@@ -266,6 +286,7 @@ CONSTANT_BUFFER_INFO(DecalBufferType, 6, true, true)
 CONSTANT_BUFFER_INFO(FireballBufferType, 6, false, true)
 CONSTANT_BUFFER_INFO(CameraBufferType, 7, true, true)  // b7, VS+PS (UberLit.hlsl과 일치)
 CONSTANT_BUFFER_INFO(FLightBufferType, 8, true, true)
+CONSTANT_BUFFER_INFO(FParticleInstanceBufferType, 9, true, false)  // b9, VS only (UberLit.hlsl 파티클 경로)
 CONSTANT_BUFFER_INFO(FViewportConstants, 10, true, true)   // 뷰 포트 크기에 따라 전체 화면 복사를 보정하기 위해 설정 (10번 고유번호로 사용)
 CONSTANT_BUFFER_INFO(FTileCullingBufferType, 11, false, true)  // b11, PS only (UberLit.hlsl과 일치)
 CONSTANT_BUFFER_INFO(FPointLightShadowBufferType, 12, true, true)  // b11, VS only
@@ -63,6 +63,7 @@ void D3D11RHI::Release()
     if (DepthStencilStateAlwaysNoWrite) { DepthStencilStateAlwaysNoWrite->Release(); DepthStencilStateAlwaysNoWrite = nullptr; }
     if (DepthStencilStateDisable) { DepthStencilStateDisable->Release(); DepthStencilStateDisable = nullptr; }
     if (DepthStencilStateGreaterEqualWrite) { DepthStencilStateGreaterEqualWrite->Release(); DepthStencilStateGreaterEqualWrite = nullptr; }
+    if (DepthStencilStateAlwaysWrite) { DepthStencilStateAlwaysWrite->Release(); DepthStencilStateAlwaysWrite = nullptr; }
     if (DepthStencilStateOverlayWriteStencil) { DepthStencilStateOverlayWriteStencil->Release(); DepthStencilStateOverlayWriteStencil = nullptr; }
     if (DepthStencilStateStencilRejectOverlay) { DepthStencilStateStencilRejectOverlay->Release(); DepthStencilStateStencilRejectOverlay = nullptr; }
 
@@ -183,6 +184,10 @@ void D3D11RHI::CreateDepthStencilState()
     desc.DepthFunc = D3D11_COMPARISON_GREATER_EQUAL;
     Device->CreateDepthStencilState(&desc, &DepthStencilStateGreaterEqualWrite);
 
+    // 5-1) AlwaysWrite: Always + Write ALL (섀도우 아틀라스 부분 클리어용)
+    desc.DepthFunc = D3D11_COMPARISON_ALWAYS;
+    Device->CreateDepthStencilState(&desc, &DepthStencilStateAlwaysWrite);
+
     // 6) OverlayWriteStencil: Always + NoWriteDepth + Stencil=REPLACE 1
     ZeroMemory(&desc, sizeof(desc));
     desc.DepthEnable = TRUE;
@@ -957,6 +962,9 @@ void D3D11RHI::OMSetDepthStencilState(EComparisonFunc Func)
     case EComparisonFunc::LessEqualReadOnly:
         DeviceContext->OMSetDepthStencilState(DepthStencilStateLessEqualReadOnly, 0);
         break;
+    case EComparisonFunc::AlwaysWrite:
+        DeviceContext->OMSetDepthStencilState(DepthStencilStateAlwaysWrite, 0);
+        break;
     }
 }
 
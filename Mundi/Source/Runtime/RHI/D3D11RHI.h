@@ -39,6 +39,7 @@ enum class EComparisonFunc
 	GreaterEqual,
 	Disable,
 	LessEqualReadOnly,
+	AlwaysWrite,        // 깊이를 무조건 덮어씀 (섀도우 아틀라스 영역 클리어용)
 	// 필요시 추가 후 OMSetDepthStencilState 함수 수정
 };
 
@@ -242,6 +243,7 @@ private:
 	ID3D11DepthStencilState* DepthStencilStateAlwaysNoWrite = nullptr;       // 기즈모/오버레이
 	ID3D11DepthStencilState* DepthStencilStateDisable = nullptr;              // 깊이 테스트/쓰기 모두 끔
 	ID3D11DepthStencilState* DepthStencilStateGreaterEqualWrite = nullptr;   // 선택사항
+	ID3D11DepthStencilState* DepthStencilStateAlwaysWrite = nullptr;         // 영역 클리어
 	// Stencil-based overlay control
 	ID3D11DepthStencilState* DepthStencilStateOverlayWriteStencil = nullptr;   // overlay writes stencil=1
 	ID3D11DepthStencilState* DepthStencilStateStencilRejectOverlay = nullptr;  // draw only where stencil==0
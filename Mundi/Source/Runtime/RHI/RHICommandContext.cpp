@@ -0,0 +1,49 @@
+﻿#include "pch.h"
+#include "RHICommandContext.h"
+
+void FD3D11CommandContext::SetShadersImpl(ID3D11InputLayout* InputLayout, ID3D11VertexShader* VertexShader, ID3D11PixelShader* PixelShader)
+{
+	ID3D11DeviceContext* DeviceContext = RHI->GetDeviceContext();
+	DeviceContext->IASetInputLayout(InputLayout);
+	DeviceContext->VSSetShader(VertexShader, nullptr, 0);
+	DeviceContext->PSSetShader(PixelShader, nullptr, 0);
+}
+
+void FD3D11CommandContext::PSSetShaderResourcesImpl(UINT StartSlot, UINT NumViews, ID3D11ShaderResourceView* const* SRVs)
+{
+	RHI->GetDeviceContext()->PSSetShaderResources(StartSlot, NumViews, SRVs);
+}
+
+void FD3D11CommandContext::VSSetShaderResourcesImpl(UINT StartSlot, UINT NumViews, ID3D11ShaderResourceView* const* SRVs)
+{
+	RHI->GetDeviceContext()->VSSetShaderResources(StartSlot, NumViews, SRVs);
+}
+
+void FD3D11CommandContext::PSSetSamplersImpl(UINT StartSlot, UINT NumSamplers, ID3D11SamplerState* const* Samplers)
+{
+	RHI->GetDeviceContext()->PSSetSamplers(StartSlot, NumSamplers, Samplers);
+}
+
+void FD3D11CommandContext::SetGeometryImpl(ID3D11Buffer* VertexBuffer, UINT Stride, ID3D11Buffer* IndexBuffer, D3D11_PRIMITIVE_TOPOLOGY Topology)
+{
+	ID3D11DeviceContext* DeviceContext = RHI->GetDeviceContext();
+	UINT Offset = 0;
+	DeviceContext->IASetVertexBuffers(0, 1, &VertexBuffer, &Stride, &Offset);
+	DeviceContext->IASetIndexBuffer(IndexBuffer, DXGI_FORMAT_R32_UINT, 0);
+	DeviceContext->IASetPrimitiveTopology(Topology);
+}
+
+void FD3D11CommandContext::OMSetDepthStencilStateImpl(EComparisonFunc Func)
+{
+	RHI->OMSetDepthStencilState(Func);
+}
+
+void FD3D11CommandContext::DrawIndexedImpl(UINT IndexCount, UINT StartIndex, INT BaseVertex)
+{
+	RHI->GetDeviceContext()->DrawIndexed(IndexCount, StartIndex, BaseVertex);
+}
+
+void FD3D11CommandContext::DrawIndexedInstancedImpl(UINT IndexCount, UINT InstanceCount, UINT StartIndex, INT BaseVertex, UINT StartInstance)
+{
+	RHI->GetDeviceContext()->DrawIndexedInstanced(IndexCount, InstanceCount, StartIndex, BaseVertex, StartInstance);
+}
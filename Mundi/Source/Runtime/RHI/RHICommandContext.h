@@ -0,0 +1,189 @@
+﻿#pragma once
+#include "D3D11RHI.h"
+
+// 드로우 제출 경로에서 발생한 명령 통계
+struct FRHICommandStats
+{
+	uint32 DrawCalls = 0;
+	uint32 InstancedDrawCalls = 0;
+	uint64 IndexCount = 0;				// 제출한 인덱스 수 (인스턴스 수 포함)
+
+	// 상태 변경
+	uint32 ShaderBinds = 0;				// VS/PS/InputLayout 바인딩
+	uint32 ShaderResourceBinds = 0;		// SRV 바인딩 호출 수
+	uint32 SamplerBinds = 0;
+	uint32 InputAssemblerBinds = 0;		// VB/IB/토폴로지
+	uint32 DepthStencilStateChanges = 0;
+
+	// 업로드
+	uint32 ConstantBufferUpdates = 0;
+	uint64 UploadBytes = 0;
+
+	void Reset() { *this = FRHICommandStats(); }
+
+	uint32 GetStateChangeCount() const
+	{
+		return ShaderBinds + ShaderResourceBinds + SamplerBinds + InputAssemblerBinds + DepthStencilStateChanges;
+	}
+
+	FRHICommandStats& operator+=(const FRHICommandStats& Other)
+	{
+		DrawCalls += Other.DrawCalls;
+		InstancedDrawCalls += Other.InstancedDrawCalls;
+		IndexCount += Other.IndexCount;
+		ShaderBinds += Other.ShaderBinds;
+		ShaderResourceBinds += Other.ShaderResourceBinds;
+		SamplerBinds += Other.SamplerBinds;
+		InputAssemblerBinds += Other.InputAssemblerBinds;
+		DepthStencilStateChanges += Other.DepthStencilStateChanges;
+		ConstantBufferUpdates += Other.ConstantBufferUpdates;
+		UploadBytes += Other.UploadBytes;
+		return *this;
+	}
+};
+
+#define DECLARE_RHI_CONSTANT_BUFFER_IMPL_FUNC(TYPE) \
+	virtual void SetAndUpdateConstantBufferImpl(const TYPE& Data) = 0;
+
+#define DECLARE_D3D11_CONSTANT_BUFFER_IMPL_FUNC(TYPE) \
+	void SetAndUpdateConstantBufferImpl(const TYPE& Data) override \
+	{\
+		RHI->SetAndUpdateConstantBuffer(Data);\
+	}
+
+#define DECLARE_NULL_CONSTANT_BUFFER_IMPL_FUNC(TYPE) \
+	void SetAndUpdateConstantBufferImpl(const TYPE& Data) override {}
+
+/**
+ * 드로우 제출 명령 인터페이스 (DrawMeshBatches 등 메시 배치 제출 경로용)
+ *
+ * 공개 함수는 통계를 기록한 뒤 백엔드 구현(~Impl)으로 전달합니다.
+ * - FD3D11CommandContext: D3D11RHI / ID3D11DeviceContext로 그대로 전달
+ * - FNullRHICommandContext: GPU 없이 통계만 기록 (CPU 제출 비용 측정용)
+ *
+ * 리소스 핸들은 아직 D3D11 포인터 타입을 그대로 쓰지만, Null 구현은 역참조하지 않습니다.
+ */
+class IRHICommandContext
+{
+public:
+	virtual ~IRHICommandContext() = default;
+
+	// false면 GPU가 없는 컨텍스트 (GPU 쿼리 등 디바이스가 필요한 작업을 건너뜀)
+	virtual bool HasDevice() const = 0;
+
+	void SetShaders(ID3D11InputLayout* InputLayout, ID3D11VertexShader* VertexShader, ID3D11PixelShader* PixelShader)
+	{
+		Stats.ShaderBinds += 3;
+		SetShadersImpl(InputLayout, VertexShader, PixelShader);
+	}
+
+	void PSSetShaderResources(UINT StartSlot, UINT NumViews, ID3D11ShaderResourceView* const* SRVs)
+	{
+		++Stats.ShaderResourceBinds;
+		PSSetShaderResourcesImpl(StartSlot, NumViews, SRVs);
+	}
+
+	void VSSetShaderResources(UINT StartSlot, UINT NumViews, ID3D11ShaderResourceView* const* SRVs)
+	{
+		++Stats.ShaderResourceBinds;
+		VSSetShaderResourcesImpl(StartSlot, NumViews, SRVs);
+	}
+
+	void PSSetSamplers(UINT StartSlot, UINT NumSamplers, ID3D11SamplerState* const* Samplers)
+	{
+		++Stats.SamplerBinds;
+		PSSetSamplersImpl(StartSlot, NumSamplers, Samplers);
+	}
+
+	void SetGeometry(ID3D11Buffer* VertexBuffer, UINT Stride, ID3D11Buffer* IndexBuffer, D3D11_PRIMITIVE_TOPOLOGY Topology)
+	{
+		Stats.InputAssemblerBinds += 3;
+		SetGeometryImpl(VertexBuffer, Stride, IndexBuffer, Topology);
+	}
+
+	void OMSetDepthStencilState(EComparisonFunc Func)
+	{
+		++Stats.DepthStencilStateChanges;
+		OMSetDepthStencilStateImpl(Func);
+	}
+
+	template<typename TBufferType>
+	void SetAndUpdateConstantBuffer(const TBufferType& Data)
+	{
+		++Stats.ConstantBufferUpdates;
+		Stats.UploadBytes += sizeof(TBufferType);
+		SetAndUpdateConstantBufferImpl(Data);
+	}
+
+	void DrawIndexed(UINT IndexCount, UINT StartIndex, INT BaseVertex)
+	{
+		++Stats.DrawCalls;
+		Stats.IndexCount += IndexCount;
+		DrawIndexedImpl(IndexCount, StartIndex, BaseVertex);
+	}
+
+	void DrawIndexedInstanced(UINT IndexCount, UINT InstanceCount, UINT StartIndex, INT BaseVertex, UINT StartInstance)
+	{
+		++Stats.DrawCalls;
+		++Stats.InstancedDrawCalls;
+		Stats.IndexCount += static_cast<uint64>(IndexCount) * InstanceCount;
+		DrawIndexedInstancedImpl(IndexCount, InstanceCount, StartIndex, BaseVertex, StartInstance);
+	}
+
+	const FRHICommandStats& GetStats() const { return Stats; }
+	void ResetStats() { Stats.Reset(); }
+
+protected:
+	virtual void SetShadersImpl(ID3D11InputLayout* InputLayout, ID3D11VertexShader* VertexShader, ID3D11PixelShader* PixelShader) = 0;
+	virtual void PSSetShaderResourcesImpl(UINT StartSlot, UINT NumViews, ID3D11ShaderResourceView* const* SRVs) = 0;
+	virtual void VSSetShaderResourcesImpl(UINT StartSlot, UINT NumViews, ID3D11ShaderResourceView* const* SRVs) = 0;
+	virtual void PSSetSamplersImpl(UINT StartSlot, UINT NumSamplers, ID3D11SamplerState* const* Samplers) = 0;
+	virtual void SetGeometryImpl(ID3D11Buffer* VertexBuffer, UINT Stride, ID3D11Buffer* IndexBuffer, D3D11_PRIMITIVE_TOPOLOGY Topology) = 0;
+	virtual void OMSetDepthStencilStateImpl(EComparisonFunc Func) = 0;
+	CONSTANT_BUFFER_LIST(DECLARE_RHI_CONSTANT_BUFFER_IMPL_FUNC)
+	virtual void DrawIndexedImpl(UINT IndexCount, UINT StartIndex, INT BaseVertex) = 0;
+	virtual void DrawIndexedInstancedImpl(UINT IndexCount, UINT InstanceCount, UINT StartIndex, INT BaseVertex, UINT StartInstance) = 0;
+
+	FRHICommandStats Stats;
+};
+
+// D3D11 백엔드: 명령을 그대로 디바이스 컨텍스트로 전달
+class FD3D11CommandContext : public IRHICommandContext
+{
+public:
+	explicit FD3D11CommandContext(D3D11RHI* InRHI) : RHI(InRHI) {}
+
+	bool HasDevice() const override { return true; }
+
+protected:
+	void SetShadersImpl(ID3D11InputLayout* InputLayout, ID3D11VertexShader* VertexShader, ID3D11PixelShader* PixelShader) override;
+	void PSSetShaderResourcesImpl(UINT StartSlot, UINT NumViews, ID3D11ShaderResourceView* const* SRVs) override;
+	void VSSetShaderResourcesImpl(UINT StartSlot, UINT NumViews, ID3D11ShaderResourceView* const* SRVs) override;
+	void PSSetSamplersImpl(UINT StartSlot, UINT NumSamplers, ID3D11SamplerState* const* Samplers) override;
+	void SetGeometryImpl(ID3D11Buffer* VertexBuffer, UINT Stride, ID3D11Buffer* IndexBuffer, D3D11_PRIMITIVE_TOPOLOGY Topology) override;
+	void OMSetDepthStencilStateImpl(EComparisonFunc Func) override;
+	CONSTANT_BUFFER_LIST(DECLARE_D3D11_CONSTANT_BUFFER_IMPL_FUNC)
+	void DrawIndexedImpl(UINT IndexCount, UINT StartIndex, INT BaseVertex) override;
+	void DrawIndexedInstancedImpl(UINT IndexCount, UINT InstanceCount, UINT StartIndex, INT BaseVertex, UINT StartInstance) override;
+
+private:
+	D3D11RHI* RHI;
+};
+
+// Null 백엔드: GPU 호출 없이 통계만 남김
+class FNullRHICommandContext : public IRHICommandContext
+{
+public:
+	bool HasDevice() const override { return false; }
+
+protected:
+	void SetShadersImpl(ID3D11InputLayout*, ID3D11VertexShader*, ID3D11PixelShader*) override {}
+	void PSSetShaderResourcesImpl(UINT, UINT, ID3D11ShaderResourceView* const*) override {}
+	void VSSetShaderResourcesImpl(UINT, UINT, ID3D11ShaderResourceView* const*) override {}
+	void PSSetSamplersImpl(UINT, UINT, ID3D11SamplerState* const*) override {}
+	void SetGeometryImpl(ID3D11Buffer*, UINT, ID3D11Buffer*, D3D11_PRIMITIVE_TOPOLOGY) override {}
+	void OMSetDepthStencilStateImpl(EComparisonFunc) override {}
+	CONSTANT_BUFFER_LIST(DECLARE_NULL_CONSTANT_BUFFER_IMPL_FUNC)
+	void DrawIndexedImpl(UINT, UINT, INT) override {}
+	void DrawIndexedInstancedImpl(UINT, UINT, UINT, INT, UINT) override {}
+};
@@ -0,0 +1,485 @@
+﻿#include "pch.h"
+#include "ClusteredLightCuller.h"
+#include "PlatformTime.h"
+#include <algorithm>
+#include <bit>
+#include <execution>
+#include <numeric>
+#include <immintrin.h>
+
+namespace
+{
+	// CPU 컬링과 셰이더(FillClusterParams)가 같은 깊이 범위를 쓰도록 한 곳에서 보정
+	void ClampDepthRange(float& InOutNear, float& InOutFar)
+	{
+		InOutNear = std::max(InOutNear, 0.01f);
+		InOutFar = std::max(InOutFar, InOutNear * 1.01f);
+	}
+
+	// 구간 [Min, Max]까지의 거리 (안쪽이면 0)
+	inline float DistanceToRange(float Value, float Min, float Max)
+	{
+		return std::max(0.0f, std::max(Min - Value, Value - Max));
+	}
+
+	// 슬라이스 외부 레인 제거용: [First, Last] 안에 드는 Base~Base+3 레인 마스크
+	inline int32 GetLaneMask(uint32 Base, uint32 First, uint32 Last)
+	{
+		int32 Mask = 0xF;
+		if (Base < First)
+		{
+			Mask &= (0xF << (First - Base)) & 0xF;
+		}
+		if (Last - Base < 3)
+		{
+			Mask &= (1 << (Last - Base + 1)) - 1;
+		}
+		return Mask;
+	}
+}
+
+FClusteredLightCuller::FClusteredLightCuller()
+	: RHI(nullptr)
+	, TileSize(16)
+	, TileCountX(0)
+	, TileCountY(0)
+	, ViewportWidth(0.0f)
+	, ViewportHeight(0.0f)
+	, NearPlane(0.1f)
+	, FarPlane(1000.0f)
+	, LogDepthRatio(1.0f)
+	, ProjScaleX(1.0f), ProjScaleY(1.0f)
+	, ProjZScaleX(0.0f), ProjZScaleY(0.0f)
+	, ProjBiasX(0.0f), ProjBiasY(0.0f)
+	, ProjWScale(1.0f), ProjWBias(0.0f)
+	, LightIndexBuffer(nullptr)
+	, LightIndexBufferSRV(nullptr)
+	, LightIndexBufferCapacity(0)
+{
+}
+
+FClusteredLightCuller::~FClusteredLightCuller()
+{
+	Release();
+}
+
+void FClusteredLightCuller::Initialize(D3D11RHI* InRHI, UINT InTileSize)
+{
+	RHI = InRHI;
+	TileSize = std::max(InTileSize, 1u);
+}
+
+void FClusteredLightCuller::CullLights(
+	const TArray<FPointLightInfo>& PointLights,
+	const TArray<FSpotLightInfo>& SpotLights,
+	const FMatrix& ViewMatrix,
+	const FMatrix& ProjMatrix,
+	float InNearPlane,
+	float InFarPlane,
+	UINT InViewportWidth,
+	UINT InViewportHeight)
+{
+	const uint64 StartCycles = FPlatformTime::Cycles64();
+
+	TileCountX = (InViewportWidth + TileSize - 1) / TileSize;
+	TileCountY = (InViewportHeight + TileSize - 1) / TileSize;
+	ViewportWidth = static_cast<float>(InViewportWidth);
+	ViewportHeight = static_cast<float>(InViewportHeight);
+	const uint32 TileCount = TileCountX * TileCountY;
+	const uint32 ClusterCount = TileCount * DepthSliceCount;
+
+	NearPlane = InNearPlane;
+	FarPlane = InFarPlane;
+	ClampDepthRange(NearPlane, FarPlane);
+	LogDepthRatio = std::log(FarPlane / NearPlane);
+
+	// 원근(PerspectiveFovLH)과 직교(OrthoLH) 모두 행 벡터 기준으로 x, z만 clip.x에, z만 clip.w에 기여
+	ProjScaleX = ProjMatrix.M[0][0];
+	ProjScaleY = ProjMatrix.M[1][1];
+	ProjZScaleX = ProjMatrix.M[2][0];
+	ProjZScaleY = ProjMatrix.M[2][1];
+	ProjBiasX = ProjMatrix.M[3][0];
+	ProjBiasY = ProjMatrix.M[3][1];
+	ProjWScale = ProjMatrix.M[2][3];
+	ProjWBias = ProjMatrix.M[3][3];
+
+	Stats.Reset();
+	Stats.TileCountX = TileCountX;
+	Stats.TileCountY = TileCountY;
+	Stats.TotalTileCount = TileCount;
+	Stats.DepthSliceCount = DepthSliceCount;
+	Stats.TotalClusterCount = ClusterCount;
+	Stats.TotalPointLights = PointLights.Num();
+	Stats.TotalSpotLights = SpotLights.Num();
+	Stats.TotalLights = PointLights.Num() + SpotLights.Num();
+
+	if (TileCount == 0)
+	{
+		return;
+	}
+
+	GatherLightBounds(PointLights, SpotLights, ViewMatrix);
+
+	// 1) 슬라이스별로 (클러스터, 라이트) 쌍 수집
+	SliceResults.SetNum(DepthSliceCount);
+	TArray<uint32> Slices;
+	Slices.SetNum(DepthSliceCount);
+	std::iota(Slices.begin(), Slices.end(), 0u);
+	std::for_each(std::execution::par, Slices.begin(), Slices.end(), [this](uint32 Slice)
+	{
+		CullSlice(Slice, SliceResults[Slice]);
+	});
+
+	// 2) 클러스터 헤더 (시작 오프셋, 개수)와 타일 요약을 채우고 전체 크기 결정
+	const uint32 HeaderSize = ClusterCount * 2 + TileCount;
+	uint32 PairCount = 0;
+	for (const FSliceResult& Result : SliceResults)
+	{
+		PairCount += static_cast<uint32>(Result.LightOfPair.Num());
+		Stats.TotalLightTests += Result.TestCount;
+	}
+
+	ClusterLightData.SetNum(HeaderSize + PairCount);
+	uint32* Data = ClusterLightData.GetData();
+	uint32* TileSummary = Data + ClusterCount * 2;
+	memset(TileSummary, 0, TileCount * sizeof(uint32));
+
+	Stats.MinLightsPerTile = UINT_MAX;
+	Stats.MaxLightsPerTile = 0;
+
+	uint32 Offset = HeaderSize;
+	for (uint32 Slice = 0; Slice < DepthSliceCount; ++Slice)
+	{
+		const TArray<uint32>& Counts = SliceResults[Slice].Counts;
+		for (uint32 Tile = 0; Tile < TileCount; ++Tile)
+		{
+			const uint32 Cluster = Slice * TileCount + Tile;
+			const uint32 Count = Counts[Tile];
+			Data[Cluster * 2] = Offset;
+			Data[Cluster * 2 + 1] = Count;
+			Offset += Count;
+
+			TileSummary[Tile] = std::max(TileSummary[Tile], Count);
+			Stats.MinLightsPerTile = std::min(Stats.MinLightsPerTile, Count);
+			Stats.MaxLightsPerTile = std::max(Stats.MaxLightsPerTile, Count);
+		}
+	}
+	Stats.TotalLightsPassed = PairCount;
+
+	// 3) 쌍을 클러스터 목록으로 분산 (슬라이스마다 쓰는 구간이 겹치지 않으므로 병렬, 추가 순서 유지)
+	std::for_each(std::execution::par, Slices.begin(), Slices.end(), [this, Data, TileCount](uint32 Slice)
+	{
+		const FSliceResult& Result = SliceResults[Slice];
+		TArray<uint32> Cursor;
+		Cursor.SetNum(TileCount);
+		for (uint32 Tile = 0; Tile < TileCount; ++Tile)
+		{
+			Cursor[Tile] = Data[(Slice * TileCount + Tile) * 2];
+		}
+
+		for (int32 Pair = 0; Pair < Result.LightOfPair.Num(); ++Pair)
+		{
+			Data[Cursor[Result.ClusterOfPair[Pair]]++] = LightBounds[Result.LightOfPair[Pair]].PackedIndex;
+		}
+	});
+
+	Stats.CalculateStats();
+	Stats.CullingTimeMS = static_cast<float>(FPlatformTime::ToMilliseconds(FPlatformTime::Cycles64() - StartCycles));
+
+	UploadLightIndexBuffer(static_cast<UINT>(ClusterLightData.Num()));
+	Stats.LightIndexBufferSizeBytes = ClusterLightData.Num() * sizeof(uint32);
+}
+
+void FClusteredLightCuller::GatherLightBounds(const TArray<FPointLightInfo>& PointLights, const TArray<FSpotLightInfo>& SpotLights, const FMatrix& ViewMatrix)
+{
+	LightBounds.Empty();
+	LightBounds.Reserve(PointLights.Num() + SpotLights.Num());
+
+	const auto AddLight = [this, &ViewMatrix](const FVector& WorldCenter, float Radius, uint32 PackedIndex)
+	{
+		if (Radius <= 0.0f)
+		{
+			return;
+		}
+
+		const FVector4 ViewCenter = FVector4(WorldCenter.X, WorldCenter.Y, WorldCenter.Z, 1.0f) * ViewMatrix;
+		const float MinDepth = ViewCenter.Z - Radius;
+		const float MaxDepth = ViewCenter.Z + Radius;
+		if (MaxDepth < NearPlane || MinDepth > FarPlane)
+		{
+			return;
+		}
+
+		FLightBounds Bounds;
+		Bounds.Center = FVector(ViewCenter.X, ViewCenter.Y, ViewCenter.Z);
+		Bounds.Radius = Radius;
+		Bounds.PackedIndex = PackedIndex;
+		Bounds.MinSlice = GetSliceForDepth(MinDepth);
+		Bounds.MaxSlice = GetSliceForDepth(MaxDepth);
+		LightBounds.Add(Bounds);
+	};
+
+	// 라이트 인덱스 (상위 16비트: 타입(0=Point, 1=Spot), 하위 16비트: 인덱스)
+	for (int32 i = 0; i < PointLights.Num(); ++i)
+	{
+		AddLight(PointLights[i].Position, PointLights[i].AttenuationRadius, static_cast<uint32>(i));
+	}
+
+	for (int32 i = 0; i < SpotLights.Num(); ++i)
+	{
+		const FSpotLightInfo& Light = SpotLights[i];
+		const float Range = Light.AttenuationRadius;
+		const uint32 PackedIndex = (1u << 16) | static_cast<uint32>(i);
+
+		// 원뿔(구면 섹터)을 감싸는 최소 구. 반각이 90도 이상이거나 방향이 없으면 전체 구
+		const float HalfAngle = DegreesToRadians(std::clamp(Light.OuterConeAngle, 0.0f, 180.0f));
+		const float CosHalf = std::cos(HalfAngle);
+		if (CosHalf <= 0.0f || Light.Direction.SizeSquared() < KINDA_SMALL_NUMBER)
+		{
+			AddLight(Light.Position, Range, PackedIndex);
+			continue;
+		}
+
+		const FVector Direction = Light.Direction.GetSafeNormal();
+		if (CosHalf >= 0.70710678f)
+		{
+			// 45도 이하: 꼭지점과 밑면 테두리를 지나는 구
+			const float Radius = Range / (2.0f * CosHalf);
+			AddLight(Light.Position + Direction * Radius, Radius, PackedIndex);
+		}
+		else
+		{
+			// 45도 초과: 밑면 테두리 원에 외접하는 구 (꼭지점과 구면 캡도 포함됨)
+			AddLight(Light.Position + Direction * (Range * CosHalf), Range * std::sin(HalfAngle), PackedIndex);
+		}
+	}
+}
+
+void FClusteredLightCuller::CullSlice(uint32 Slice, FSliceResult& OutResult) const
+{
+	const uint32 TileCount = TileCountX * TileCountY;
+	OutResult.ClusterOfPair.clear();
+	OutResult.LightOfPair.clear();
+	OutResult.Counts.assign(TileCount, 0u);
+	OutResult.TestCount = 0;
+
+	const float SliceNear = NearPlane * std::exp(LogDepthRatio * Slice / DepthSliceCount);
+	const float SliceFar = NearPlane * std::exp(LogDepthRatio * (Slice + 1) / DepthSliceCount);
+
+	const auto NDCToViewX = [this](float NDC, float Depth)
+	{
+		return (NDC * (Depth * ProjWScale + ProjWBias) - Depth * ProjZScaleX - ProjBiasX) / ProjScaleX;
+	};
+	const auto NDCToViewY = [this](float NDC, float Depth)
+	{
+		return (NDC * (Depth * ProjWScale + ProjWBias) - Depth * ProjZScaleY - ProjBiasY) / ProjScaleY;
+	};
+
+	// 타일 열/행마다 이 슬라이스 클러스터의 뷰 공간 AABB x/y 범위
+	// x는 SSE로 4개씩 읽으므로 4의 배수로 채우고, 남는 칸은 어떤 구와도 겹치지 않는 값으로 둠
+	const uint32 PaddedCountX = (TileCountX + 3) & ~3u;
+	TArray<float> ClusterMinX(PaddedCountX, FLT_MAX);
+	TArray<float> ClusterMaxX(PaddedCountX, -FLT_MAX);
+	for (uint32 TileX = 0; TileX < TileCountX; ++TileX)
+	{
+		const float NDCMin = static_cast<float>(TileX * TileSize) / ViewportWidth * 2.0f - 1.0f;
+		const float NDCMax = std::min(static_cast<float>((TileX + 1) * TileSize) / ViewportWidth, 1.0f) * 2.0f - 1.0f;
+		const float Candidates[4] = {
+			NDCToViewX(NDCMin, SliceNear), NDCToViewX(NDCMin, SliceFar),
+			NDCToViewX(NDCMax, SliceNear), NDCToViewX(NDCMax, SliceFar) };
+		ClusterMinX[TileX] = *std::min_element(Candidates, Candidates + 4);
+		ClusterMaxX[TileX] = *std::max_element(Candidates, Candidates + 4);
+	}
+
+	TArray<float> ClusterMinY(TileCountY);
+	TArray<float> ClusterMaxY(TileCountY);
+	for (uint32 TileY = 0; TileY < TileCountY; ++TileY)
+	{
+		// 화면 Y는 아래로 증가하므로 NDC로 바꿀 때 반전
+		const float NDCTop = 1.0f - static_cast<float>(TileY * TileSize) / ViewportHeight * 2.0f;
+		const float NDCBottom = 1.0f - std::min(static_cast<float>((TileY + 1) * TileSize) / ViewportHeight, 1.0f) * 2.0f;
+		const float Candidates[4] = {
+			NDCToViewY(NDCTop, SliceNear), NDCToViewY(NDCTop, SliceFar),
+			NDCToViewY(NDCBottom, SliceNear), NDCToViewY(NDCBottom, SliceFar) };
+		ClusterMinY[TileY] = *std::min_element(Candidates, Candidates + 4);
+		ClusterMaxY[TileY] = *std::max_element(Candidates, Candidates + 4);
+	}
+
+	const auto ToTile = [this](float Pixel, UINT Count)
+	{
+		const int32 Tile = static_cast<int32>(std::floor(Pixel / static_cast<float>(TileSize)));
+		return static_cast<uint32>(std::clamp(Tile, 0, static_cast<int32>(Count) - 1));
+	};
+
+	const __m128 Zero = _mm_setzero_ps();
+
+	for (int32 LightIndex = 0; LightIndex < LightBounds.Num(); ++LightIndex)
+	{
+		const FLightBounds& Light = LightBounds[LightIndex];
+		if (Slice < Light.MinSlice || Slice > Light.MaxSlice)
+		{
+			continue;
+		}
+
+		const FVector& Center = Light.Center;
+		const float RadiusSq = Light.Radius * Light.Radius;
+
+		// 슬라이스 안에서 구가 차지하는 깊이 구간과, 그 구간의 가장 큰 단면 반지름
+		const float DepthMin = std::max(SliceNear, Center.Z - Light.Radius);
+		const float DepthMax = std::min(SliceFar, Center.Z + Light.Radius);
+		const float DepthDistance = DistanceToRange(Center.Z, SliceNear, SliceFar);
+		const float RemainZ = RadiusSq - DepthDistance * DepthDistance;
+		if (DepthMin > DepthMax || RemainZ < 0.0f)
+		{
+			continue;
+		}
+		const float SectionRadius = std::sqrt(RemainZ);
+
+		// 단면을 감싸는 상자 [x, y] x [DepthMin, DepthMax]의 투영 사각형 (NDC는 x, y에 단조, 깊이에 단조이므로 모서리로 충분)
+		float NDCMinX = FLT_MAX, NDCMaxX = -FLT_MAX;
+		float NDCMinY = FLT_MAX, NDCMaxY = -FLT_MAX;
+		for (int32 Corner = 0; Corner < 4; ++Corner)
+		{
+			const float Depth = (Corner & 1) ? DepthMax : DepthMin;
+			const float Offset = (Corner & 2) ? SectionRadius : -SectionRadius;
+			const float InvW = 1.0f / (Depth * ProjWScale + ProjWBias);
+			const float NDCX = ((Center.X + Offset) * ProjScaleX + Depth * ProjZScaleX + ProjBiasX) * InvW;
+			const float NDCY = ((Center.Y + Offset) * ProjScaleY + Depth * ProjZScaleY + ProjBiasY) * InvW;
+			NDCMinX = std::min(NDCMinX, NDCX);
+			NDCMaxX = std::max(NDCMaxX, NDCX);
+			NDCMinY = std::min(NDCMinY, NDCY);
+			NDCMaxY = std::max(NDCMaxY, NDCY);
+		}
+
+		if (NDCMaxX < -1.0f || NDCMinX > 1.0f || NDCMaxY < -1.0f || NDCMinY > 1.0f)
+		{
+			continue;
+		}
+
+		const uint32 TileMinX = ToTile((NDCMinX * 0.5f + 0.5f) * ViewportWidth, TileCountX);
+		const uint32 TileMaxX = ToTile((NDCMaxX * 0.5f + 0.5f) * ViewportWidth, TileCountX);
+		const uint32 TileMinY = ToTile((0.5f - NDCMaxY * 0.5f) * ViewportHeight, TileCountY);
+		const uint32 TileMaxY = ToTile((0.5f - NDCMinY * 0.5f) * ViewportHeight, TileCountY);
+
+		const __m128 CenterX = _mm_set1_ps(Center.X);
+		for (uint32 TileY = TileMinY; TileY <= TileMaxY; ++TileY)
+		{
+			const float DistanceY = DistanceToRange(Center.Y, ClusterMinY[TileY], ClusterMaxY[TileY]);
+			const float Remain = RemainZ - DistanceY * DistanceY;
+			OutResult.TestCount += TileMaxX - TileMinX + 1;
+			if (Remain < 0.0f)
+			{
+				continue;
+			}
+
+			// 구 중심과 클러스터 AABB의 거리 제곱 <= 반지름 제곱 (x 거리만 4개씩)
+			const __m128 RemainV = _mm_set1_ps(Remain);
+			const uint32 RowBase = TileY * TileCountX;
+			for (uint32 TileX = TileMinX & ~3u; TileX <= TileMaxX; TileX += 4)
+			{
+				__m128 DistanceX = _mm_max_ps(
+					_mm_sub_ps(_mm_loadu_ps(ClusterMinX.GetData() + TileX), CenterX),
+					_mm_sub_ps(CenterX, _mm_loadu_ps(ClusterMaxX.GetData() + TileX)));
+				DistanceX = _mm_max_ps(DistanceX, Zero);
+
+				int32 Mask = _mm_movemask_ps(_mm_cmple_ps(_mm_mul_ps(DistanceX, DistanceX), RemainV));
+				Mask &= GetLaneMask(TileX, TileMinX, TileMaxX);
+				while (Mask)
+				{
+					const uint32 Lane = static_cast<uint32>(std::countr_zero(static_cast<uint32>(Mask)));
+					Mask &= Mask - 1;
+
+					const uint32 Cluster = RowBase + TileX + Lane;
+					OutResult.ClusterOfPair.Add(Cluster);
+					OutResult.LightOfPair.Add(static_cast<uint32>(LightIndex));
+					++OutResult.Counts[Cluster];
+				}
+			}
+		}
+	}
+}
+
+uint32 FClusteredLightCuller::GetSliceForDepth(float ViewDepth) const
+{
+	if (ViewDepth <= NearPlane)
+	{
+		return 0;
+	}
+
+	const int32 Slice = static_cast<int32>(std::floor(std::log(ViewDepth / NearPlane) / LogDepthRatio * DepthSliceCount));
+	return static_cast<uint32>(std::clamp(Slice, 0, static_cast<int32>(DepthSliceCount) - 1));
+}
+
+void FClusteredLightCuller::FillClusterParams(FTileCullingBufferType& OutBuffer, const FMatrix& ViewMatrix, float InNearPlane, float InFarPlane)
+{
+	float Near = InNearPlane;
+	float Far = InFarPlane;
+	ClampDepthRange(Near, Far);
+
+	// Slice = floor(log2(ViewDepth) * Scale + Bias) = floor(log(ViewDepth / Near) / log(Far / Near) * DepthSliceCount)
+	const float LogRatio = std::log2(Far / Near);
+	OutBuffer.ClusterSliceCount = DepthSliceCount;
+	OutBuffer.ClusterDepthScale = DepthSliceCount / LogRatio;
+	OutBuffer.ClusterDepthBias = -static_cast<float>(DepthSliceCount) * std::log2(Near) / LogRatio;
+
+	// 행 벡터 기준 뷰 공간 z = dot(WorldPos, 3번째 열) + M[3][2]
+	OutBuffer.ViewDepthPlane = FVector4(ViewMatrix.M[0][2], ViewMatrix.M[1][2], ViewMatrix.M[2][2], ViewMatrix.M[3][2]);
+}
+
+void FClusteredLightCuller::UploadLightIndexBuffer(UINT ElementCount)
+{
+	if (!RHI || ElementCount == 0)
+	{
+		return;
+	}
+
+	if (!LightIndexBuffer || LightIndexBufferCapacity < ElementCount)
+	{
+		if (LightIndexBufferSRV)
+		{
+			LightIndexBufferSRV->Release();
+			LightIndexBufferSRV = nullptr;
+		}
+		if (LightIndexBuffer)
+		{
+			LightIndexBuffer->Release();
+			LightIndexBuffer = nullptr;
+		}
+
+		// 라이트가 조금씩 늘어날 때마다 다시 만들지 않도록 여유 있게 확보
+		LightIndexBufferCapacity = std::max(ElementCount + ElementCount / 2, LightIndexBufferCapacity * 2);
+		if (FAILED(RHI->CreateStructuredBuffer(sizeof(uint32), LightIndexBufferCapacity, nullptr, &LightIndexBuffer)))
+		{
+			LightIndexBufferCapacity = 0;
+			return;
+		}
+		RHI->CreateStructuredBufferSRV(LightIndexBuffer, &LightIndexBufferSRV);
+	}
+
+	RHI->UpdateStructuredBuffer(LightIndexBuffer, ClusterLightData.GetData(), ElementCount * sizeof(uint32));
+}
+
+ID3D11ShaderResourceView* FClusteredLightCuller::GetLightIndexBufferSRV()
+{
+	return LightIndexBufferSRV;
+}
+
+void FClusteredLightCuller::Release()
+{
+	if (LightIndexBufferSRV)
+	{
+		LightIndexBufferSRV->Release();
+		LightIndexBufferSRV = nullptr;
+	}
+
+	if (LightIndexBuffer)
+	{
+		LightIndexBuffer->Release();
+		LightIndexBuffer = nullptr;
+	}
+	LightIndexBufferCapacity = 0;
+
+	ClusterLightData.Empty();
+	SliceResults.Empty();
+	LightBounds.Empty();
+}
@@ -0,0 +1,111 @@
+﻿#pragma once
+#include "LightManager.h"
+#include "TileCullingStats.h"
+#include "D3D11RHI.h"
+
+/**
+ * 클러스터(프록셀) 기반 라이트 컬링 (CPU)
+ *
+ * 화면 타일(TileSize 픽셀) x 지수 깊이 슬라이스로 뷰 프러스텀을 나누고,
+ * 라이트마다 경계 구를 자신이 겹치는 슬라이스/타일 범위에만 래스터화합니다 (타일마다 모든 라이트를 검사하지 않음).
+ * - 슬라이스 s의 깊이 범위: Near * (Far / Near)^(s / DepthSliceCount)
+ * - 슬라이스마다 구의 단면으로 타일 사각형을 구하고, 행 단위로 클러스터 AABB와의 거리를 SSE로 4개씩 검사
+ * - 슬라이스끼리는 독립이므로 병렬로 처리
+ *
+ * 결과(t2, StructuredBuffer<uint>) 레이아웃:
+ *   [ClusterIndex * 2]     = 라이트 목록 시작 오프셋 (버퍼 내 절대 위치)
+ *   [ClusterIndex * 2 + 1] = 라이트 개수
+ *   [ClusterCount * 2 + TileIndex] = 타일의 슬라이스 중 최대 라이트 개수 (디버그 히트맵용)
+ *   이후: 클러스터별 라이트 인덱스 (상위 16비트: 타입 0=Point 1=Spot, 하위 16비트: LightManager 목록 인덱스)
+ * ClusterIndex = (Slice * TileCountY + TileY) * TileCountX + TileX
+ */
+class FClusteredLightCuller
+{
+public:
+	// 깊이 슬라이스 수 (LightingCommon.hlsl은 상수 버퍼의 ClusterSliceCount를 사용)
+	static constexpr uint32 DepthSliceCount = 16;
+
+	FClusteredLightCuller();
+	~FClusteredLightCuller();
+
+	void Initialize(D3D11RHI* InRHI, UINT InTileSize = 16);
+
+	// 클러스터 컬링 수행 후 라이트 인덱스 버퍼 업로드 (매 프레임 호출)
+	void CullLights(
+		const TArray<FPointLightInfo>& PointLights,
+		const TArray<FSpotLightInfo>& SpotLights,
+		const FMatrix& ViewMatrix,
+		const FMatrix& ProjMatrix,
+		float NearPlane,
+		float FarPlane,
+		UINT ViewportWidth,
+		UINT ViewportHeight
+	);
+
+	ID3D11ShaderResourceView* GetLightIndexBufferSRV();
+
+	const FTileCullingStats& GetStats() const { return Stats; }
+
+	// 셰이더가 픽셀의 클러스터를 찾는 데 필요한 값 (깊이 -> 슬라이스 변환, 월드 -> 뷰 깊이 평면)
+	static void FillClusterParams(FTileCullingBufferType& OutBuffer, const FMatrix& ViewMatrix, float NearPlane, float FarPlane);
+
+	void Release();
+
+private:
+	// 뷰 공간 경계 구와 겹치는 슬라이스 범위
+	struct FLightBounds
+	{
+		FVector Center;
+		float Radius;
+		uint32 PackedIndex;
+		uint32 MinSlice;
+		uint32 MaxSlice;
+	};
+
+	// 슬라이스 하나의 결과 (워커 스레드별로 채움)
+	struct FSliceResult
+	{
+		TArray<uint32> ClusterOfPair;	// 슬라이스 내 클러스터 인덱스
+		TArray<uint32> LightOfPair;		// 라이트 인덱스 (추가 순서 = 라이트 순서)
+		TArray<uint32> Counts;			// 슬라이스 내 클러스터별 라이트 개수
+		uint32 TestCount = 0;
+	};
+
+	void GatherLightBounds(const TArray<FPointLightInfo>& PointLights, const TArray<FSpotLightInfo>& SpotLights, const FMatrix& ViewMatrix);
+	void CullSlice(uint32 Slice, FSliceResult& OutResult) const;
+	uint32 GetSliceForDepth(float ViewDepth) const;
+	void UploadLightIndexBuffer(UINT ElementCount);
+
+private:
+	D3D11RHI* RHI;
+
+	// 클러스터 그리드
+	UINT TileSize;
+	UINT TileCountX;
+	UINT TileCountY;
+	float ViewportWidth;
+	float ViewportHeight;
+
+	// 깊이 슬라이스
+	float NearPlane;
+	float FarPlane;
+	float LogDepthRatio;		// log(Far / Near)
+
+	// 투영 계수 (원근/직교 공용: NDC = (View * Scale + ViewZ * ZScale + Bias) / (ViewZ * WScale + WBias))
+	float ProjScaleX, ProjScaleY;
+	float ProjZScaleX, ProjZScaleY;
+	float ProjBiasX, ProjBiasY;
+	float ProjWScale, ProjWBias;
+
+	TArray<FLightBounds> LightBounds;
+	TArray<FSliceResult> SliceResults;
+
+	// 헤더 + 타일 요약 + 라이트 인덱스
+	TArray<uint32> ClusterLightData;
+
+	ID3D11Buffer* LightIndexBuffer;
+	ID3D11ShaderResourceView* LightIndexBufferSRV;
+	UINT LightIndexBufferCapacity;
+
+	FTileCullingStats Stats;
+};
@@ -30,6 +30,13 @@ void FLightManager::Initialize(D3D11RHI* RHIDevice, uint32 InShadowAtlasSize2D,
 	AtlasSizeCube = InAtlasSizeCube;
 	CubeArrayCount = InCubeArrayCount;
 
+	// 섀도우 캐시 초기화 (아틀라스 크기가 바뀌면 기존 할당은 의미가 없음)
+	ShadowAtlasAllocator2D.Initialize(ShadowAtlasSize2D);
+	ShadowViewCache2D.clear();
+	ShadowViewCacheCube.clear();
+	PersistentCubeSlices.clear();
+	bShadowAtlasNeedsFullClear = true;
+
 	// --- 1. Structured Buffers (t17, t18) ---
 	if (!PointLightBuffer)
 	{
@@ -478,6 +485,9 @@ void FLightManager::ClearAllDepthStencilView(D3D11RHI* RHIDevice)
 	
 	// 비워진 리소스를 다시 할당 시키려고
 	bHaveToUpdate = true;
+
+	// 아틀라스 내용이 사라졌으므로 캐시된 섀도우 뷰도 모두 무효
+	InvalidateShadowCache();
 }
 
 bool FLightManager::GetCachedShadowData(ULightComponent* Light, int32 SubViewIndex, FShadowMapData& OutData) const
@@ -531,47 +541,147 @@ bool FLightManager::GetCachedShadowCubeSliceIndex(ULightComponent* Light, int32&
 	return true;
 }
 
-// 단순한 아틀라스 로직
+// 프레임 간 안정적인 2D 아틀라스 할당
+// 지난 프레임과 같은 크기를 요청한 뷰는 기존 영역을 그대로 쓰고, 새로 요청되었거나 크기가 바뀐 뷰만 빈 블록을 할당받는다.
 void FLightManager::AllocateAtlasRegions2D(TArray<FShadowRenderRequest>& InOutRequests2D)
 {
-	// 요청 정렬 (가장 큰 것부터)
-	InOutRequests2D.Sort(std::greater<FShadowRenderRequest>());
-
-	// 동적 패킹(Shelf Algorithm)
-	uint32 CurrentAtlasX = 0;
-	uint32 CurrentAtlasY = 0;
-	uint32 CurrentShelfMaxHeight = 0;
+	for (auto& Pair : ShadowViewCache2D)
+	{
+		for (FShadowViewCacheEntry& Entry : Pair.second)
+		{
+			Entry.bTouched = false;
+		}
+	}
 
+	// 1. 기존 할당 유지, 크기가 바뀐 뷰는 영역 반납
+	TArray<FShadowRenderRequest*> PendingRequests;
 	for (FShadowRenderRequest& Request : InOutRequests2D)
 	{
-		if (CurrentAtlasX + Request.Size > ShadowAtlasSize2D)
+		TArray<FShadowViewCacheEntry>& Entries = ShadowViewCache2D[Request.LightOwner];
+		if (Entries.Num() <= Request.SubViewIndex)
+		{
+			Entries.SetNum(Request.SubViewIndex + 1);
+		}
+
+		FShadowViewCacheEntry& Entry = Entries[Request.SubViewIndex];
+		Entry.bTouched = true;
+
+		if (Entry.AtlasRegion.IsValid() && Entry.RequestedSize == Request.Size)
 		{
-			CurrentAtlasY += CurrentShelfMaxHeight;
-			CurrentAtlasX = 0;
-			CurrentShelfMaxHeight = 0;
+			continue;
 		}
-		if (CurrentAtlasY + Request.Size > ShadowAtlasSize2D)
+
+		ShadowAtlasAllocator2D.Free(Entry.AtlasRegion);
+		Entry.AtlasRegion = FShadowAtlasRegion();
+		Entry.RequestedSize = 0;
+		Entry.bContentValid = false;
+
+		if (Request.Size > 0)
 		{
-			Request.Size = 0; // 꽉 참 (렌더링 실패)
+			PendingRequests.Add(&Request);
+		}
+	}
+
+	// 2. 이번 프레임에 요청되지 않은 뷰(삭제된 라이트, 줄어든 캐스케이드)의 영역 회수
+	for (auto It = ShadowViewCache2D.begin(); It != ShadowViewCache2D.end();)
+	{
+		bool bAnyTouched = false;
+		for (FShadowViewCacheEntry& Entry : It->second)
+		{
+			if (!Entry.bTouched)
+			{
+				ShadowAtlasAllocator2D.Free(Entry.AtlasRegion);
+				Entry = FShadowViewCacheEntry();
+			}
+			bAnyTouched |= Entry.bTouched;
+		}
+		It = bAnyTouched ? std::next(It) : ShadowViewCache2D.erase(It);
+	}
+
+	// 3. 새 요청 할당 (큰 것부터)
+	PendingRequests.Sort([](const FShadowRenderRequest* A, const FShadowRenderRequest* B) { return A->Size > B->Size; });
+
+	bool bAllocationFailed = false;
+	for (FShadowRenderRequest* Request : PendingRequests)
+	{
+		FShadowViewCacheEntry& Entry = ShadowViewCache2D[Request->LightOwner][Request->SubViewIndex];
+		if (ShadowAtlasAllocator2D.Allocate(Request->Size, Entry.AtlasRegion))
+		{
+			Entry.RequestedSize = Request->Size;
+		}
+		else
+		{
+			bAllocationFailed = true;
+		}
+	}
+
+	// 4. 단편화로 실패했다면 전체를 처음부터 다시 배치 (이번 프레임은 모든 뷰를 다시 그림)
+	//    요청 총 면적이 아틀라스보다 크면 재배치해도 소용없으므로 매 프레임 캐시를 날리지 않도록 건너뜀
+	if (bAllocationFailed)
+	{
+		uint64 TotalArea = 0;
+		for (const FShadowRenderRequest& Request : InOutRequests2D)
+		{
+			TotalArea += static_cast<uint64>(Request.Size) * Request.Size;
+		}
+		bAllocationFailed = TotalArea <= static_cast<uint64>(ShadowAtlasSize2D) * ShadowAtlasSize2D;
+	}
+
+	if (bAllocationFailed)
+	{
+		ShadowAtlasAllocator2D.Reset();
+		InvalidateShadowCache();
+
+		TArray<FShadowRenderRequest*> AllRequests;
+		for (FShadowRenderRequest& Request : InOutRequests2D)
+		{
+			FShadowViewCacheEntry& Entry = ShadowViewCache2D[Request.LightOwner][Request.SubViewIndex];
+			Entry.AtlasRegion = FShadowAtlasRegion();
+			Entry.RequestedSize = 0;
+			if (Request.Size > 0)
+			{
+				AllRequests.Add(&Request);
+			}
+		}
+
+		AllRequests.Sort([](const FShadowRenderRequest* A, const FShadowRenderRequest* B) { return A->Size > B->Size; });
+		for (FShadowRenderRequest* Request : AllRequests)
+		{
+			FShadowViewCacheEntry& Entry = ShadowViewCache2D[Request->LightOwner][Request->SubViewIndex];
+			if (ShadowAtlasAllocator2D.Allocate(Request->Size, Entry.AtlasRegion))
+			{
+				Entry.RequestedSize = Request->Size;
+			}
 			// UE_LOG("그림자 맵 아틀라스가 가득차서 더 이상 그림자를 추가할 수 없습니다.");
+		}
+	}
+
+	// 5. 할당 결과를 요청에 기록
+	for (FShadowRenderRequest& Request : InOutRequests2D)
+	{
+		const FShadowViewCacheEntry& Entry = ShadowViewCache2D[Request.LightOwner][Request.SubViewIndex];
+		if (!Entry.AtlasRegion.IsValid())
+		{
+			Request.Size = 0; // 꽉 참 (렌더링 실패)
 			continue;
 		}
 
-		Request.AtlasViewportOffset = FVector2D((float)CurrentAtlasX, (float)CurrentAtlasY);
+		const uint32 AtlasX = Entry.AtlasRegion.X;
+		const uint32 AtlasY = Entry.AtlasRegion.Y;
+		Request.AtlasViewportOffset = FVector2D((float)AtlasX, (float)AtlasY);
 
 		// Pass 2 데이터 (UV) 저장
 		Request.AtlasScaleOffset = FVector4(
 			Request.Size / (float)ShadowAtlasSize2D,    // ScaleX
 			Request.Size / (float)ShadowAtlasSize2D,    // ScaleY
-			CurrentAtlasX / (float)ShadowAtlasSize2D,   // OffsetX
-			CurrentAtlasY / (float)ShadowAtlasSize2D    // OffsetY
+			AtlasX / (float)ShadowAtlasSize2D,          // OffsetX
+			AtlasY / (float)ShadowAtlasSize2D           // OffsetY
 		);
-
-		CurrentAtlasX += Request.Size;
-		CurrentShelfMaxHeight = FMath::Max(CurrentShelfMaxHeight, Request.Size);
 	}
 }
 
+// 프레임 간 안정적인 큐브 슬라이스 할당
+// 라이트는 요청이 끊기기 전까지 같은 슬라이스를 유지하므로 캐시된 큐브 섀도우를 재사용할 수 있다.
 void FLightManager::AllocateAtlasCubeSlices(TArray<FShadowRenderRequest>& InOutRequestsCube)
 {
 	// 슬라이스 개수가 유효하지 않으면 모든 요청 실패 처리
@@ -585,13 +695,38 @@ void FLightManager::AllocateAtlasCubeSlices(TArray<FShadowRenderRequest>& InOutR
 		return;
 	}
 
-	int AllocatorCube_CurrentSliceIndex = 0;
+	// 1. 이번 프레임에 요청된 라이트 수집
+	TSet<ULightComponent*> RequestedLights;
+	for (const FShadowRenderRequest& Request : InOutRequestsCube)
+	{
+		if (Request.Size > 0)
+		{
+			RequestedLights.Add(Request.LightOwner);
+		}
+	}
+
+	// 2. 더 이상 요청하지 않는 라이트의 슬라이스 회수
+	for (auto It = PersistentCubeSlices.begin(); It != PersistentCubeSlices.end();)
+	{
+		if (!RequestedLights.Contains(It->first))
+		{
+			ShadowViewCacheCube.Remove(It->first);
+			It = PersistentCubeSlices.erase(It);
+		}
+		else
+		{
+			++It;
+		}
+	}
 
-	ULightComponent* CurrentLightOwner = nullptr; // 현재 처리 중인 라이트 추적용
-	bool bCurrentLightFailed = false; // 현재 라이트가 슬라이스 할당에 실패했는지 여부
-	// 로컬 변수 대신 FLightManager의 멤버 변수 AllocatorCube_CurrentSliceIndex 사용
+	TArray<bool> SliceInUse;
+	SliceInUse.SetNum(CubeArrayCount, false);
+	for (const auto& Pair : PersistentCubeSlices)
+	{
+		SliceInUse[Pair.second] = true;
+	}
 
-	// 요청 리스트 순회 (각 라이트당 6개의 요청이 들어옴)
+	// 3. 요청 리스트 순회 (각 라이트당 6개의 요청이 들어옴)
 	for (FShadowRenderRequest& Request : InOutRequestsCube)
 	{
 		// 유효하지 않은 요청은 건너뜀 (예: Size가 0인 경우)
@@ -601,42 +736,121 @@ void FLightManager::AllocateAtlasCubeSlices(TArray<FShadowRenderRequest>& InOutR
 			continue;
 		}
 
-		// 라이트가 변경되었는지 확인
-		if (Request.LightOwner != CurrentLightOwner)
+		int32* FoundSlice = PersistentCubeSlices.Find(Request.LightOwner);
+		if (!FoundSlice)
 		{
-			// 첫 라이트가 아니면서 이전 라이트가 성공적으로 할당되었을 경우, 다음 슬라이스로 이동
-			if (CurrentLightOwner != nullptr && !bCurrentLightFailed)
+			const int32 FreeSlice = SliceInUse.Find(false);
+			if (FreeSlice < 0)
 			{
-				AllocatorCube_CurrentSliceIndex++; // 다음 슬라이스 인덱스로 증가 (멤버 변수 사용)
+				Request.Size = 0; // 할당 실패 처리
+				Request.AssignedSliceIndex = -1;
+				continue;
 			}
 
-			CurrentLightOwner = Request.LightOwner; // 현재 라이트 갱신
-
-			// 새 라이트가 슬라이스 개수 제한을 초과하는지 확인
-			if (AllocatorCube_CurrentSliceIndex >= CubeArrayCount)
-			{
-				bCurrentLightFailed = true; // 이 라이트는 할당 불가
-			}
-			else
-			{
-				bCurrentLightFailed = false; // 이 라이트는 할당 가능
-			}
+			SliceInUse[FreeSlice] = true;
+			PersistentCubeSlices.Add(Request.LightOwner, FreeSlice);
+			ShadowViewCacheCube.Remove(Request.LightOwner); // 새 슬라이스이므로 이전 캐시는 무효
+			FoundSlice = PersistentCubeSlices.Find(Request.LightOwner);
 		}
 
-		// 현재 라이트가 할당 실패 상태인지 확인
-		if (bCurrentLightFailed)
+		Request.AssignedSliceIndex = *FoundSlice;
+	}
+}
+
+FShadowViewCacheEntry* FLightManager::FindShadowViewCacheEntry(ULightComponent* Light, int32 SubViewIndex, bool bIsCubeView)
+{
+	if (!Light || SubViewIndex < 0)
+	{
+		return nullptr;
+	}
+
+	TArray<FShadowViewCacheEntry>& Entries = bIsCubeView ? ShadowViewCacheCube[Light] : ShadowViewCache2D[Light];
+	if (Entries.Num() <= SubViewIndex)
+	{
+		Entries.SetNum(SubViewIndex + 1);
+	}
+	return &Entries[SubViewIndex];
+}
+
+bool FLightManager::UpdateShadowViewCache(const FShadowRenderRequest& Request, bool bIsCubeView, uint64 CasterHash, bool bHasDynamicCasters)
+{
+	FShadowViewCacheEntry* Entry = FindShadowViewCacheEntry(Request.LightOwner, Request.SubViewIndex, bIsCubeView);
+	if (!Entry)
+	{
+		return true;
+	}
+
+	const bool bCacheHit =
+		Entry->bContentValid &&
+		!bHasDynamicCasters &&
+		Entry->CasterHash == CasterHash &&
+		Entry->ViewMatrix == Request.ViewMatrix &&
+		Entry->ProjectionMatrix == Request.ProjectionMatrix &&
+		Entry->Radius == Request.Radius &&
+		(!bIsCubeView || Entry->SliceIndex == Request.AssignedSliceIndex);
+
+	if (bCacheHit)
+	{
+		return false;
+	}
+
+	// 호출자가 이번 프레임에 다시 그리므로 새 상태로 갱신
+	Entry->ViewMatrix = Request.ViewMatrix;
+	Entry->ProjectionMatrix = Request.ProjectionMatrix;
+	Entry->Radius = Request.Radius;
+	Entry->CasterHash = CasterHash;
+	Entry->SliceIndex = Request.AssignedSliceIndex;
+	Entry->bContentValid = true;
+	return true;
+}
+
+void FLightManager::InvalidateShadowCache()
+{
+	for (auto& Pair : ShadowViewCache2D)
+	{
+		for (FShadowViewCacheEntry& Entry : Pair.second)
 		{
-			Request.Size = 0; // 할당 실패 처리
-			Request.AssignedSliceIndex = -1; // 할당 인덱스를 -1로 설정
+			Entry.bContentValid = false;
 		}
-		else
+	}
+	for (auto& Pair : ShadowViewCacheCube)
+	{
+		for (FShadowViewCacheEntry& Entry : Pair.second)
+		{
+			Entry.bContentValid = false;
+		}
+	}
+	bShadowAtlasNeedsFullClear = true;
+}
+
+void FLightManager::SetShadowAATechnique(EShadowAATechnique InTechnique)
+{
+	if (CachedShadowAATechnique != InTechnique)
+	{
+		CachedShadowAATechnique = InTechnique;
+		InvalidateShadowCache();
+	}
+}
+
+bool FLightManager::ConsumeShadowAtlasFullClear()
+{
+	const bool bResult = bShadowAtlasNeedsFullClear;
+	bShadowAtlasNeedsFullClear = false;
+	return bResult;
+}
+
+void FLightManager::ReleaseShadowViewCache(ULightComponent* Light)
+{
+	if (TArray<FShadowViewCacheEntry>* Entries = ShadowViewCache2D.Find(Light))
+	{
+		for (const FShadowViewCacheEntry& Entry : *Entries)
 		{
-			// --- [핵심 수정] ---
-			// 성공: 현재 슬라이스 인덱스를 'AssignedSliceIndex' 멤버에 기록
-			Request.AssignedSliceIndex = AllocatorCube_CurrentSliceIndex;
-			// OriginalSubViewIndex는 건드리지 않음
+			ShadowAtlasAllocator2D.Free(Entry.AtlasRegion);
 		}
+		ShadowViewCache2D.Remove(Light);
 	}
+	ShadowViewCacheCube.Remove(Light);
+	PersistentCubeSlices.Remove(Light);
 }
 
 void FLightManager::ClearAllLightList()
@@ -657,6 +871,12 @@ void FLightManager::ClearAllLightList()
 
 	ShadowDataCache2D.clear();
 	ShadowDataCacheCube.clear();
+
+	ShadowViewCache2D.clear();
+	ShadowViewCacheCube.clear();
+	PersistentCubeSlices.clear();
+	ShadowAtlasAllocator2D.Reset();
+	bShadowAtlasNeedsFullClear = true;
 }
 
 template<typename T>
@@ -741,6 +961,7 @@ void FLightManager::DeRegisterLight<UDirectionalLightComponent>(UDirectionalLigh
 	bHaveToUpdate = true;
 
 	ShadowDataCache2D.Remove(LightComponent);
+	ReleaseShadowViewCache(LightComponent);
 }
 template<>
 void FLightManager::DeRegisterLight<UPointLightComponent>(UPointLightComponent* LightComponent)
@@ -757,6 +978,7 @@ void FLightManager::DeRegisterLight<UPointLightComponent>(UPointLightComponent*
 	bHaveToUpdate = true;
 
 	ShadowDataCacheCube.Remove(LightComponent);
+	ReleaseShadowViewCache(LightComponent);
 }
 template<>
 void FLightManager::DeRegisterLight<USpotLightComponent>(USpotLightComponent* LightComponent)
@@ -772,6 +994,7 @@ void FLightManager::DeRegisterLight<USpotLightComponent>(USpotLightComponent* Li
 	bHaveToUpdate = true;
 
 	ShadowDataCache2D.Remove(LightComponent);
+	ReleaseShadowViewCache(LightComponent);
 }
 
 
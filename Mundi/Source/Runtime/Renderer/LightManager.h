@@ -1,4 +1,5 @@
 ﻿#pragma once
+#include "ShadowAtlasAllocator.h"
 #define CASCADED_MAX 8
 
 class UAmbientLightComponent;
@@ -52,6 +53,23 @@ struct FShadowRenderRequest
     }
 };
 
+// 섀도우 뷰(라이트 + SubViewIndex) 단위 캐시 항목
+// 라이트 행렬과 교차하는 캐스터가 지난 프레임과 같으면 아틀라스 영역을 그대로 재사용하고 렌더링을 건너뜁니다.
+struct FShadowViewCacheEntry
+{
+    FMatrix ViewMatrix;
+    FMatrix ProjectionMatrix;
+    float Radius = 0.0f;            // VSM 정규화 깊이에 사용되는 라이트 반경
+    uint64 CasterHash = 0;          // 라이트 절두체와 교차하는 캐스터 목록/변환의 해시
+    uint32 RequestedSize = 0;
+
+    FShadowAtlasRegion AtlasRegion; // 2D 아틀라스 영역 (Spot/Directional)
+    int32 SliceIndex = -1;          // 큐브 아틀라스 슬라이스 (Point)
+
+    bool bContentValid = false;     // 아틀라스에 이 뷰의 뎁스가 온전히 남아 있는지
+    bool bTouched = false;          // 이번 할당 호출에서 요청되었는지 (미사용 항목 회수용)
+};
+
 // -----------------------------------------------------------------------------
 // 2. Pass 2 (GPU) 셰이더용 구조체
 // -----------------------------------------------------------------------------
@@ -158,6 +176,16 @@ public:
     void AllocateAtlasRegions2D(TArray<FShadowRenderRequest>& InOutRequests2D);
     void AllocateAtlasCubeSlices(TArray<FShadowRenderRequest>& InOutRequestsCube);
 
+    // --- 섀도우 캐시 ---
+    // 이번 프레임에 이 뷰를 다시 그려야 하면 true를 반환하고 캐시를 새 상태로 갱신합니다.
+    bool UpdateShadowViewCache(const FShadowRenderRequest& Request, bool bIsCubeView, uint64 CasterHash, bool bHasDynamicCasters);
+    // 모든 캐시된 섀도우 뷰를 무효화합니다. (아틀라스 전체 클리어, 섀도우 기법 변경 등)
+    void InvalidateShadowCache();
+    // 섀도우 AA 기법이 바뀌면 아틀라스 내용(뎁스/VSM 모멘트)이 달라지므로 캐시를 무효화합니다.
+    void SetShadowAATechnique(EShadowAATechnique InTechnique);
+    // 2D 아틀라스 전체 클리어가 필요한지 (최초 프레임, 무효화 직후). 호출 시 플래그가 해제됩니다.
+    bool ConsumeShadowAtlasFullClear();
+
     TArray<UAmbientLightComponent*> GetAmbientLightList() { return AmbientLightList; }
     TArray<UDirectionalLightComponent*> GetDirectionalLightList() { return DIrectionalLightList; }
     TArray<UPointLightComponent*> GetPointLightList() { return PointLightList; }
@@ -209,6 +237,19 @@ private:
     // Key: 라이트, Value: 할당된 큐브맵 슬라이스 인덱스
     TMap<ULightComponent*, int32> ShadowDataCacheCube;
 
+    // --- 섀도우 뷰 캐시 (프레임 간 유지) ---
+    // Key: 라이트, Value: SubViewIndex별 캐시 항목 (CSM/큐브 면이면 여러 개)
+    TMap<ULightComponent*, TArray<FShadowViewCacheEntry>> ShadowViewCache2D;
+    TMap<ULightComponent*, TArray<FShadowViewCacheEntry>> ShadowViewCacheCube;
+    // Key: 라이트, Value: 프레임 간 고정된 큐브 슬라이스
+    TMap<ULightComponent*, int32> PersistentCubeSlices;
+    FShadowAtlasAllocator ShadowAtlasAllocator2D;
+    EShadowAATechnique CachedShadowAATechnique = EShadowAATechnique::PCF;
+    bool bShadowAtlasNeedsFullClear = true;
+
+    FShadowViewCacheEntry* FindShadowViewCacheEntry(ULightComponent* Light, int32 SubViewIndex, bool bIsCubeView);
+    void ReleaseShadowViewCache(ULightComponent* Light);
+
 
     //structured buffer
     ID3D11Buffer* PointLightBuffer = nullptr;
@@ -80,6 +80,7 @@ void UMaterial::SetShaderMacros(const TArray<FShaderMacro>& InShaderMacro)
 	}
 
 	ShaderMacros = InShaderMacro;
+	ShaderPermutationId = FShaderPermutationDomain::GetInstance().Encode(ShaderMacros);
 }
 
 UTexture* UMaterial::GetTexture(EMaterialTextureSlot Slot) const
@@ -450,6 +451,11 @@ const FMaterialInfo& UMaterialInstanceDynamic::GetMaterialInfo() const
 	return CachedMaterialInfo;
 }
 
+FShaderPermutationId UMaterialInstanceDynamic::GetShaderPermutationId() const
+{
+	return ParentMaterial ? ParentMaterial->GetShaderPermutationId() : 0;
+}
+
 const TArray<FShaderMacro> UMaterialInstanceDynamic::GetShaderMacros() const
 {
 	if (ParentMaterial)
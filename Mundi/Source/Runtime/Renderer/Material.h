@@ -26,6 +26,7 @@ public:
 	virtual bool HasTexture(EMaterialTextureSlot Slot) const = 0;
 	virtual const FMaterialInfo& GetMaterialInfo() const = 0;
 	virtual const TArray<FShaderMacro> GetShaderMacros() const = 0;
+	virtual FShaderPermutationId GetShaderPermutationId() const = 0;	// GetShaderMacros()를 미리 ID로 변환해 둔 값 (드로우 경로용)
 };
 
 
@@ -59,11 +60,13 @@ public:
 
 	const TArray<FShaderMacro> GetShaderMacros() const override;
 	void SetShaderMacros(const TArray<FShaderMacro>& InShaderMacro);
+	FShaderPermutationId GetShaderPermutationId() const override { return ShaderPermutationId; }
 
 protected:
 	// 이 머티리얼이 사용할 셰이더 프로그램 (예: UberLit.hlsl)
 	UShader* Shader = nullptr;
 	TArray<FShaderMacro> ShaderMacros;
+	FShaderPermutationId ShaderPermutationId = 0;	// ShaderMacros가 바뀔 때만 갱신
 
 	FMaterialInfo MaterialInfo;
 	// MaterialInfo 이름 기반으로 찾은 (Textures[0] = Diffuse, Textures[1] = Normal)
@@ -91,6 +94,7 @@ public:
 	const FMaterialInfo& GetMaterialInfo() const override;
 	UMaterialInterface* GetParentMaterial() const { return ParentMaterial; }
 	
+	FShaderPermutationId GetShaderPermutationId() const override;
 	const TArray<FShaderMacro> GetShaderMacros() const override;	// 이 인스턴스에 덮어쓴 매크로가 없다면 부모의 매크로를, 있다면 덮어쓴 매크로를 반환합니다.
 
 	const TMap<EMaterialTextureSlot, UTexture*>& GetOverriddenTextures() const { return OverriddenTextures; }	// 덮어쓴 텍스처 맵 반환 (저장 시 사용)
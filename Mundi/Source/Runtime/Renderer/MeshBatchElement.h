@@ -87,6 +87,9 @@ struct FMeshBatchElement
 	// 파티클 인스턴스 데이터를 담은 StructuredBuffer의 SRV입니다.
 	ID3D11ShaderResourceView* ParticleInstanceSRV = nullptr;
 
+	// 공유 인스턴스 버퍼 안에서 이 드로우가 사용하는 구간의 시작 위치입니다.
+	uint32 FirstInstance = 0;
+
 	// --- 기본 생성자 ---
 	FMeshBatchElement() = default;
 
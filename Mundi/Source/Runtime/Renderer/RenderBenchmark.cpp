@@ -0,0 +1,113 @@
+﻿#include "pch.h"
+#include "RenderBenchmark.h"
+#include "PlatformTime.h"
+
+namespace
+{
+    int32 PendingFrames = 0;
+
+    FRHICommandStats DivideStats(const FRHICommandStats& Total, int32 Frames)
+    {
+        FRHICommandStats Result;
+        Result.DrawCalls = Total.DrawCalls / Frames;
+        Result.InstancedDrawCalls = Total.InstancedDrawCalls / Frames;
+        Result.IndexCount = Total.IndexCount / Frames;
+        Result.ShaderBinds = Total.ShaderBinds / Frames;
+        Result.ShaderResourceBinds = Total.ShaderResourceBinds / Frames;
+        Result.SamplerBinds = Total.SamplerBinds / Frames;
+        Result.InputAssemblerBinds = Total.InputAssemblerBinds / Frames;
+        Result.DepthStencilStateChanges = Total.DepthStencilStateChanges / Frames;
+        Result.ConstantBufferUpdates = Total.ConstantBufferUpdates / Frames;
+        Result.UploadBytes = Total.UploadBytes / Frames;
+        return Result;
+    }
+}
+
+namespace FRenderBenchmark
+{
+    void Request(int32 Frames)
+    {
+        PendingFrames = Frames;
+    }
+
+    bool ConsumeRequest(int32& OutFrames)
+    {
+        if (PendingFrames <= 0)
+        {
+            return false;
+        }
+        OutFrames = PendingFrames;
+        PendingFrames = 0;
+        return true;
+    }
+
+    FRenderBenchmarkResult Run(UWorld* World, FSceneView* View, URenderer* Renderer, int32 Frames)
+    {
+        FRenderBenchmarkResult Result;
+        if (!World || !View || !Renderer || Frames <= 0)
+        {
+            return Result;
+        }
+
+        FNullRHICommandContext NullContext;
+        FSceneRenderCPUTimings TotalTimings;
+        double TotalFrameMilliseconds = 0.0;
+        Result.MinFrameMilliseconds = DBL_MAX;
+
+        for (int32 Frame = 0; Frame < Frames; ++Frame)
+        {
+            // 실제 렌더링과 같이 프레임마다 새 씬 렌더러 사용 (수집 목록이 누적되지 않도록)
+            const uint64 StartCycles = FPlatformTime::Cycles64();
+            {
+                FSceneRenderer SceneRenderer(World, View, Renderer);
+                SceneRenderer.RenderCPUOnly(NullContext, TotalTimings);
+            }
+            const double FrameMilliseconds = FPlatformTime::ToMilliseconds(FPlatformTime::Cycles64() - StartCycles);
+
+            TotalFrameMilliseconds += FrameMilliseconds;
+            Result.MinFrameMilliseconds = std::min(Result.MinFrameMilliseconds, FrameMilliseconds);
+            Result.MaxFrameMilliseconds = std::max(Result.MaxFrameMilliseconds, FrameMilliseconds);
+        }
+
+        const double InvFrames = 1.0 / Frames;
+        Result.Frames = Frames;
+        Result.AverageFrameMilliseconds = TotalFrameMilliseconds * InvFrames;
+        Result.AverageTimings.GatherMs = TotalTimings.GatherMs * InvFrames;
+        Result.AverageTimings.CollectMs = TotalTimings.CollectMs * InvFrames;
+        Result.AverageTimings.SortMs = TotalTimings.SortMs * InvFrames;
+        Result.AverageTimings.SubmitMs = TotalTimings.SubmitMs * InvFrames;
+        Result.AverageTimings.VisibleMeshCount = TotalTimings.VisibleMeshCount / Frames;
+        Result.AverageTimings.MeshBatchCount = TotalTimings.MeshBatchCount / Frames;
+        Result.AverageCommands = DivideStats(NullContext.GetStats(), Frames);
+        return Result;
+    }
+
+    TArray<FString> FormatResult(const FRenderBenchmarkResult& Result)
+    {
+        TArray<FString> Lines;
+        char Buffer[256];
+
+        const FSceneRenderCPUTimings& Timings = Result.AverageTimings;
+        snprintf(Buffer, sizeof(Buffer), "Frame %.3fms (min %.3f, max %.3f) over %d frames | %d meshes, %d batches",
+            Result.AverageFrameMilliseconds, Result.MinFrameMilliseconds, Result.MaxFrameMilliseconds,
+            Result.Frames, Timings.VisibleMeshCount, Timings.MeshBatchCount);
+        Lines.Add(Buffer);
+
+        snprintf(Buffer, sizeof(Buffer), "Gather %.3fms | Collect %.3fms | Sort %.3fms | Submit %.3fms",
+            Timings.GatherMs, Timings.CollectMs, Timings.SortMs, Timings.SubmitMs);
+        Lines.Add(Buffer);
+
+        const FRHICommandStats& Commands = Result.AverageCommands;
+        snprintf(Buffer, sizeof(Buffer), "Draws %u (instanced %u, %llu indices) | State changes %u (shader %u, srv %u, sampler %u, ia %u, depth %u)",
+            Commands.DrawCalls, Commands.InstancedDrawCalls, static_cast<unsigned long long>(Commands.IndexCount),
+            Commands.GetStateChangeCount(), Commands.ShaderBinds, Commands.ShaderResourceBinds,
+            Commands.SamplerBinds, Commands.InputAssemblerBinds, Commands.DepthStencilStateChanges);
+        Lines.Add(Buffer);
+
+        snprintf(Buffer, sizeof(Buffer), "Constant buffer updates %u | Upload %.1f KB",
+            Commands.ConstantBufferUpdates, Commands.UploadBytes / 1024.0);
+        Lines.Add(Buffer);
+
+        return Lines;
+    }
+}
@@ -0,0 +1,34 @@
+﻿#pragma once
+#include "SceneRenderer.h"
+
+class UWorld;
+class FSceneView;
+class URenderer;
+
+// 렌더 CPU 벤치마크 결과 (모든 값은 프레임 평균)
+struct FRenderBenchmarkResult
+{
+    int32 Frames = 0;
+    FSceneRenderCPUTimings AverageTimings;
+    double AverageFrameMilliseconds = 0.0;
+    double MinFrameMilliseconds = 0.0;
+    double MaxFrameMilliseconds = 0.0;
+    FRHICommandStats AverageCommands;
+};
+
+// 콘솔 명령 "BENCH RENDER"에서 사용
+namespace FRenderBenchmark
+{
+    // 다음으로 그려지는 뷰에서 Frames 프레임을 측정하도록 요청 (뷰/월드는 렌더 시점에만 유효하므로 예약 방식)
+    void Request(int32 Frames = 100);
+
+    // 예약된 요청이 있으면 꺼내서 true 반환
+    bool ConsumeRequest(int32& OutFrames);
+
+    // Null RHI로 Frames 프레임 동안 수집/정렬/제출을 반복해 단계별 CPU 시간과 명령 통계를 측정합니다.
+    // GPU 명령은 하나도 제출되지 않으므로 화면 출력에는 영향이 없습니다.
+    FRenderBenchmarkResult Run(UWorld* World, FSceneView* View, URenderer* Renderer, int32 Frames);
+
+    // 결과를 여러 줄로 포맷 (단계별 시간, 명령 통계)
+    TArray<FString> FormatResult(const FRenderBenchmarkResult& Result);
+}
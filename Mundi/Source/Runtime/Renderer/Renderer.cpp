@@ -28,6 +28,7 @@
 #include "RenderSettings.h"
 #include "EditorEngine.h"
 #include "DecalComponent.h"
+#include "RenderBenchmark.h"
 #include "StatManagement/DecalStatManager.h"
 #include "StatManagement/SkinningStatManager.h"
 #include "SceneRenderer.h"
@@ -70,6 +71,17 @@ void URenderer::EndFrame()
 
 void URenderer::RenderSceneForView(UWorld* World, FSceneView* View, FViewport* Viewport)
 {
+	// 콘솔 "BENCH RENDER" 요청이 있으면 이 뷰로 CPU 벤치마크 실행 (Null RHI라 화면에는 영향 없음)
+	int32 BenchmarkFrames = 0;
+	if (FRenderBenchmark::ConsumeRequest(BenchmarkFrames))
+	{
+		const FRenderBenchmarkResult Result = FRenderBenchmark::Run(World, View, this, BenchmarkFrames);
+		for (const FString& Line : FRenderBenchmark::FormatResult(Result))
+		{
+			UE_LOG("[BENCH RENDER] %s", Line.c_str());
+		}
+	}
+
 	// 씬을 그리는 FSceneRenderer 를 생성합니다.
 	FSceneRenderer SceneRenderer(World, View, this);
 
@@ -109,7 +121,7 @@ UPrimitiveComponent* URenderer::GetPrimitiveCollided(int MouseX, int MouseY) con
 		DeviceContext->Unmap(RHIDevice->GetIdStagingBuffer(), 0);
 	}
 
-	if (PickedId == 0)
+	if (PickedId == 0 || PickedId >= static_cast<uint32>(GUObjectArray.Num()))
 		return nullptr;
 	return Cast<UPrimitiveComponent>(GUObjectArray[PickedId]);
 }
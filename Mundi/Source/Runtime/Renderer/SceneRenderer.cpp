@@ -24,6 +24,7 @@
 #include "BillboardComponent.h"
 #include "TextRenderComponent.h"
 #include "../Engine/Particle/ParticleSystemComponent.h"
+#include "../Engine/Particle/ParticleInstanceBuffer.h"
 #include "OBB.h"
 #include "BoundingSphere.h"
 #include "HeightFogComponent.h"
@@ -41,11 +42,14 @@
 #include "ResourceManager.h"
 #include "../RHI/ConstantBufferType.h"
 #include <chrono>
-#include "TileLightCuller.h"
+#include "ClusteredLightCuller.h"
+#include "TileDecalCuller.h"
 #include "LineComponent.h"
 #include "LightStats.h"
 #include "ShadowStats.h"
+#include "Hash.h"
 #include "PlatformTime.h"
+#include "Profiler.h"
 #include "PostProcessing/VignettePass.h"
 #include "FbxLoader.h"
 #include "SkinnedMeshComponent.h"
@@ -57,13 +61,17 @@ FSceneRenderer::FSceneRenderer(UWorld* InWorld, FSceneView* InView, URenderer* I
 	, View(InView) // 전달받은 FSceneView 저장
 	, OwnerRenderer(InOwnerRenderer)
 	, RHIDevice(InOwnerRenderer->GetRHIDevice())
+	, D3D11CommandContext(InOwnerRenderer->GetRHIDevice())
 {
 	//OcclusionCPU = std::make_unique<FOcclusionCullingManagerCPU>();
 
-	// 타일 라이트 컬러 초기화
-	TileLightCuller = std::make_unique<FTileLightCuller>();
+	// 클러스터 라이트 컬러 초기화
+	ClusteredLightCuller = std::make_unique<FClusteredLightCuller>();
 	uint32 TileSize = World->GetRenderSettings().GetTileSize();
-	TileLightCuller->Initialize(RHIDevice, TileSize);
+	ClusteredLightCuller->Initialize(RHIDevice, TileSize);
+
+	TileDecalCuller = std::make_unique<FTileDecalCuller>();
+	TileDecalCuller->Initialize(RHIDevice, TileSize);
 
 	// 라인 수집 시작
 	OwnerRenderer->BeginLineBatch();
@@ -80,6 +88,8 @@ void FSceneRenderer::Render()
 {
     if (!IsValid()) return;
 
+    PROFILE_SCOPE("SceneRender");
+
 	/*static bool Loaded = false;
 	if (!Loaded)
 	{
@@ -153,6 +163,7 @@ void FSceneRenderer::Render()
 
 void FSceneRenderer::RenderLitPath()
 {
+    PROFILE_SCOPE("LitPath");
     RHIDevice->OMSetRenderTargets(ERTVMode::SceneColorTargetWithId);
 
 	// 이 뷰의 rect 영역에 대해 Scene Color를 클리어하여 불투명한 배경을 제공함
@@ -243,18 +254,106 @@ void FSceneRenderer::RenderSceneDepthPath()
 // 그림자맵 구현
 //====================================================================================
 
+namespace
+{
+	// 섀도우 캐시 판정용 배치 해시 (깊이 결과에 영향을 주는 값만 사용)
+	uint64 HashShadowBatch(const FMeshBatchElement& Batch)
+	{
+		uint64 Hash = reinterpret_cast<uint64>(Batch.VertexBuffer);
+		Hash = HashCombine(Hash, reinterpret_cast<uint64>(Batch.IndexBuffer));
+		Hash = HashCombine(Hash, (static_cast<uint64>(Batch.IndexCount) << 32) | Batch.StartIndex);
+		Hash = HashCombine(Hash, static_cast<uint64>(Batch.BaseVertexIndex));
+		Hash = HashCombine(Hash, static_cast<uint64>(Batch.InstanceCount));
+
+		const uint32* MatrixBits = reinterpret_cast<const uint32*>(&Batch.WorldMatrix);
+		for (int32 Index = 0; Index < 16; ++Index)
+		{
+			Hash = HashCombine(Hash, MatrixBits[Index]);
+		}
+		return Hash;
+	}
+}
+
+void FSceneRenderer::GatherShadowViewBatches(const FShadowRenderRequest& Request, const TArray<FShadowCasterInfo>& InCasters, const TArray<FMeshBatchElement>& InAllBatches,
+	TArray<FMeshBatchElement>& OutViewBatches, uint64& OutCasterHash, bool& bOutHasDynamicCasters) const
+{
+	OutViewBatches.Empty();
+	OutCasterHash = 0;
+	bOutHasDynamicCasters = false;
+
+	const FFrustum ShadowFrustum = CreateFrustumFromViewProjection(Request.ViewMatrix * Request.ProjectionMatrix);
+	for (const FShadowCasterInfo& Caster : InCasters)
+	{
+		// 바운드가 없는 컴포넌트(기본 GetWorldAABB)는 컬링하지 않음
+		const bool bHasBounds = !(Caster.Bounds.Min == Caster.Bounds.Max);
+		if (bHasBounds && !IsAABBVisible(ShadowFrustum, Caster.Bounds))
+		{
+			continue;
+		}
+
+		for (int32 BatchIndex = Caster.FirstBatch; BatchIndex < Caster.FirstBatch + Caster.NumBatches; ++BatchIndex)
+		{
+			OutViewBatches.Add(InAllBatches[BatchIndex]);
+		}
+		OutCasterHash = HashCombine(OutCasterHash, Caster.Hash);
+		bOutHasDynamicCasters |= Caster.bDynamic;
+	}
+}
+
+void FSceneRenderer::ClearShadowViewport(bool bClearVSMMoments)
+{
+	// 현재 뷰포트 영역만 깊이 1.0(그리고 VSM 모멘트 (1, 1))로 덮어씀
+	UShader* ClearShader = UResourceManager::GetInstance().Load<UShader>("Shaders/Shadows/ShadowRegionClear.hlsl");
+	if (!ClearShader) return;
+
+	FShaderVariant* ShaderVariant = ClearShader->GetOrCompileShaderVariant();
+	if (!ShaderVariant || !ShaderVariant->VertexShader) return;
+
+	ID3D11DeviceContext* DeviceContext = RHIDevice->GetDeviceContext();
+	RHIDevice->RSSetState(ERasterizerMode::Solid_NoCull); // 섀도우 래스터라이저의 Depth Bias가 적용되지 않도록
+	RHIDevice->OMSetDepthStencilState(EComparisonFunc::AlwaysWrite);
+
+	DeviceContext->IASetInputLayout(nullptr);
+	DeviceContext->IASetPrimitiveTopology(D3D11_PRIMITIVE_TOPOLOGY_TRIANGLELIST);
+	DeviceContext->VSSetShader(ShaderVariant->VertexShader, nullptr, 0);
+	DeviceContext->PSSetShader(bClearVSMMoments ? ShaderVariant->PixelShader : nullptr, nullptr, 0);
+	DeviceContext->Draw(6, 0);
+
+	RHIDevice->RSSetState(ERasterizerMode::Shadows);
+	RHIDevice->OMSetDepthStencilState(EComparisonFunc::LessEqual);
+}
+
 void FSceneRenderer::RenderShadowMaps()
 {
     FLightManager* LightManager = World->GetLightManager();
 	if (!LightManager) return;
 
 	// 2. 그림자 캐스터(Caster) 메시 수집
+	// 뷰별 컬링과 캐시 판정을 위해 캐스터 단위로 배치 범위, 바운드, 해시를 함께 기록
 	TArray<FMeshBatchElement> ShadowMeshBatches;
+	TArray<FShadowCasterInfo> ShadowCasters;
 	for (UMeshComponent* MeshComponent : Proxies.Meshes)
 	{
 		if (MeshComponent && MeshComponent->IsCastShadows() && MeshComponent->IsVisible())
 		{
+			FShadowCasterInfo Caster;
+			Caster.Bounds = MeshComponent->GetWorldAABB();
+			Caster.FirstBatch = ShadowMeshBatches.Num();
 			MeshComponent->CollectMeshBatches(ShadowMeshBatches, View);
+			Caster.NumBatches = ShadowMeshBatches.Num() - Caster.FirstBatch;
+			if (Caster.NumBatches == 0)
+			{
+				continue;
+			}
+
+			Caster.Hash = reinterpret_cast<uint64>(MeshComponent);
+			for (int32 BatchIndex = Caster.FirstBatch; BatchIndex < ShadowMeshBatches.Num(); ++BatchIndex)
+			{
+				const FMeshBatchElement& Batch = ShadowMeshBatches[BatchIndex];
+				Caster.Hash = HashCombine(Caster.Hash, HashShadowBatch(Batch));
+				Caster.bDynamic |= Batch.bIsSkeletalMesh; // GPU 스키닝 결과는 매 프레임 바뀔 수 있음
+			}
+			ShadowCasters.Add(Caster);
 		}
 	}
 
@@ -333,6 +432,10 @@ void FSceneRenderer::RenderShadowMaps()
 		return;
 	}
 
+	// 섀도우 기법이 바뀌면 아틀라스 포맷/내용이 달라지므로 캐시 무효화
+	const EShadowAATechnique ShadowAAType = World->GetRenderSettings().GetShadowAATechnique();
+	LightManager->SetShadowAATechnique(ShadowAAType);
+
 	// 2D 아틀라스 할당
 	LightManager->AllocateAtlasRegions2D(Requests2D);
 	// 2.2. 큐브맵 슬라이스 할당 (Allocate only)
@@ -349,48 +452,57 @@ void FSceneRenderer::RenderShadowMaps()
 			ID3D11ShaderResourceView* NullSRV[2] = { nullptr, nullptr };
 			RHIDevice->GetDeviceContext()->PSSetShaderResources(9, 2, NullSRV);
 			
-			float ClearColor[] = {1.0f, 1.0f, 0.0f, 0.0f};
-			EShadowAATechnique ShadowAAType = World->GetRenderSettings().GetShadowAATechnique();
-			switch (ShadowAAType)
+			const bool bUseVSM = (ShadowAAType == EShadowAATechnique::VSM);
+			if (bUseVSM)
+			{
+				RHIDevice->OMSetCustomRenderTargets(1, &VSMAtlasRTV2D, AtlasDSV2D);
+			}
+			else
 			{
-			case EShadowAATechnique::PCF:
 				RHIDevice->OMSetCustomRenderTargets(0, nullptr, AtlasDSV2D);
-				break;
-			case EShadowAATechnique::VSM:
+			}
+
+			// 아틀라스 전체 클리어는 캐시가 무효화된 경우에만 수행 (그 외에는 다시 그릴 영역만 클리어)
+			if (LightManager->ConsumeShadowAtlasFullClear())
+			{
+				if (bUseVSM)
 				{
-					RHIDevice->OMSetCustomRenderTargets(1, &VSMAtlasRTV2D, AtlasDSV2D);
+					float ClearColor[] = {1.0f, 1.0f, 0.0f, 0.0f};
 					RHIDevice->GetDeviceContext()->ClearRenderTargetView(VSMAtlasRTV2D, ClearColor);
-					break;
-				}				
-			default:
-				RHIDevice->OMSetCustomRenderTargets(0, nullptr, AtlasDSV2D);
-				break;
+				}
+				RHIDevice->GetDeviceContext()->ClearDepthStencilView(AtlasDSV2D, D3D11_CLEAR_DEPTH | D3D11_CLEAR_STENCIL, 1, 0);
 			}
 
-			RHIDevice->GetDeviceContext()->ClearDepthStencilView(AtlasDSV2D, D3D11_CLEAR_DEPTH | D3D11_CLEAR_STENCIL, 1, 0);
-
 			RHIDevice->RSSetState(ERasterizerMode::Shadows);
 			RHIDevice->OMSetDepthStencilState(EComparisonFunc::LessEqual);
 
+			TArray<FMeshBatchElement> ViewBatches;
 			for (FShadowRenderRequest& Request : Requests2D)
 			{
-				// 뷰포트 설정
-				D3D11_VIEWPORT ShadowVP = { Request.AtlasViewportOffset.X, Request.AtlasViewportOffset.Y, static_cast<FLOAT>(Request.Size), static_cast<FLOAT>(Request.Size), 0.0f, 1.0f };
-				RHIDevice->GetDeviceContext()->RSSetViewports(1, &ShadowVP);
-
-				// 뎁스 패스 렌더링
-				RenderShadowDepthPass(Request, ShadowMeshBatches);
-
 				FShadowMapData Data;
-				if (Request.Size > 0) // 렌더링 성공
+				if (Request.Size > 0) // 할당 성공
 				{
+					// 뷰포트 설정
+					D3D11_VIEWPORT ShadowVP = { Request.AtlasViewportOffset.X, Request.AtlasViewportOffset.Y, static_cast<FLOAT>(Request.Size), static_cast<FLOAT>(Request.Size), 0.0f, 1.0f };
+					RHIDevice->GetDeviceContext()->RSSetViewports(1, &ShadowVP);
+
+					// 라이트/캐스터가 변하지 않았다면 지난 프레임의 결과를 그대로 사용
+					uint64 CasterHash = 0;
+					bool bHasDynamicCasters = false;
+					GatherShadowViewBatches(Request, ShadowCasters, ShadowMeshBatches, ViewBatches, CasterHash, bHasDynamicCasters);
+					if (LightManager->UpdateShadowViewCache(Request, false, CasterHash, bHasDynamicCasters))
+					{
+						ClearShadowViewport(bUseVSM);
+						RenderShadowDepthPass(Request, ViewBatches);
+					}
+
 					Data.ShadowViewProjMatrix = Request.ViewMatrix * Request.ProjectionMatrix * BiasMatrix;
 					Data.AtlasScaleOffset = Request.AtlasScaleOffset;
 					Data.ShadowBias = Request.LightOwner->GetShadowBias();
 					Data.ShadowSlopeBias = Request.LightOwner->GetShadowSlopeBias();
 					Data.ShadowSharpen = Request.LightOwner->GetShadowSharpen();
 				}
-				// 렌더링 실패 시(Size==0) 빈 데이터(기본값) 전달
+				// 할당 실패 시(Size==0) 빈 데이터(기본값) 전달
 				LightManager->SetShadowMapData(Request.LightOwner, Request.SubViewIndex, Data);
 				// vsm srv unbind
 			}
@@ -413,6 +525,8 @@ void FSceneRenderer::RenderShadowMaps()
 			D3D11_VIEWPORT ShadowVP = { 0.0f, 0.0f, (float)AtlasSizeCube, (float)AtlasSizeCube, 0.0f, 1.0f };
 			RHIDevice->GetDeviceContext()->RSSetViewports(1, &ShadowVP);
 
+			TArray<FMeshBatchElement> CubeViewBatches;
+
 			// 이제 RequestsCube 배열을 직접 순회
 			for (FShadowRenderRequest& Request : RequestsCube) // 레퍼런스 유지
 			{
@@ -437,9 +551,18 @@ void FSceneRenderer::RenderShadowMaps()
 				ID3D11DepthStencilView* FaceDSV = LightManager->GetShadowCubeFaceDSV(SliceIndex, FaceIndex);
 				if (FaceDSV)
 				{
+					// 면 단위 캐시: 라이트와 면에 걸친 캐스터가 그대로면 다시 그리지 않음
+					uint64 CasterHash = 0;
+					bool bHasDynamicCasters = false;
+					GatherShadowViewBatches(Request, ShadowCasters, ShadowMeshBatches, CubeViewBatches, CasterHash, bHasDynamicCasters);
+					if (!LightManager->UpdateShadowViewCache(Request, true, CasterHash, bHasDynamicCasters))
+					{
+						continue;
+					}
+
 					RHIDevice->OMSetCustomRenderTargets(0, nullptr, FaceDSV);
 					RHIDevice->GetDeviceContext()->ClearDepthStencilView(FaceDSV, D3D11_CLEAR_DEPTH | D3D11_CLEAR_STENCIL, 1.0f, 0);
-					RenderShadowDepthPass(Request, ShadowMeshBatches);
+					RenderShadowDepthPass(Request, CubeViewBatches);
 				}
 			}
 		}
@@ -474,9 +597,8 @@ void FSceneRenderer::RenderShadowDepthPass(FShadowRenderRequest& ShadowRequest,
 	if (!ShaderVariant) return;
 
 	// 스켈레탈 메시용 셰이더 (GPU 스키닝)
-	TArray<FShaderMacro> SkinningMacros;
-	SkinningMacros.Add({ "ENABLE_GPU_SKINNING", "1" });
-	FShaderVariant* SkinnedShaderVariant = DepthVS->GetOrCompileShaderVariant(SkinningMacros);
+	static const FShaderPermutationId SkinningPermutation = FShaderPermutationDomain::GetInstance().Encode("ENABLE_GPU_SKINNING", "1");
+	FShaderVariant* SkinnedShaderVariant = DepthVS->GetOrCompileShaderVariant(SkinningPermutation);
 	if (!SkinnedShaderVariant) return;
 
 	// vsm용 픽셀 셰이더
@@ -686,6 +808,7 @@ void FSceneRenderer::PrepareView()
 
 void FSceneRenderer::GatherVisibleProxies()
 {
+	PROFILE_SCOPE("GatherVisibleProxies");
 	// NOTE: 일단 컴포넌트 단위와 데칼 관련 이슈 해결까지 컬링 무시
 	//// 절두체 컬링 수행 -> 결과가 멤버 변수 PotentiallyVisibleActors에 저장됨
 	//PerformFrustumCulling();
@@ -880,7 +1003,8 @@ void FSceneRenderer::GatherVisibleProxies()
 
 void FSceneRenderer::PerformTileLightCulling()
 {
-	if (!TileLightCuller)
+	PROFILE_SCOPE("ClusteredLightCulling");
+	if (!ClusteredLightCuller)
 		return;
 
 	// ShowFlag 확인
@@ -898,8 +1022,8 @@ void FSceneRenderer::PerformTileLightCulling()
 		TArray<FPointLightInfo>& PointLights = World->GetLightManager()->GetPointLightInfoList();
 		TArray<FSpotLightInfo>& SpotLights = World->GetLightManager()->GetSpotLightInfoList();
 
-		// 타일 컬링 수행
-		TileLightCuller->CullLights(
+		// 클러스터 컬링 수행
+		ClusteredLightCuller->CullLights(
 			PointLights,
 			SpotLights,
 			View->ViewMatrix,
@@ -911,25 +1035,17 @@ void FSceneRenderer::PerformTileLightCulling()
 		);
 
 		// 통계를 전역 매니저에 업데이트
-		FTileCullingStatManager::GetInstance().UpdateStats(TileLightCuller->GetStats());
+		FTileCullingStatManager::GetInstance().UpdateStats(ClusteredLightCuller->GetStats());
 	}
 
 	// 타일 컬링 상수 버퍼 업데이트
-	uint32 TileSize = RenderSettings.GetTileSize();
-	FTileCullingBufferType TileCullingBuffer;
-	TileCullingBuffer.TileSize = TileSize;
-	TileCullingBuffer.TileCountX = (ViewportWidth + TileSize - 1) / TileSize;
-	TileCullingBuffer.TileCountY = (ViewportHeight + TileSize - 1) / TileSize;
-	TileCullingBuffer.bUseTileCulling = bTileCullingEnabled ? 1 : 0;  // ShowFlag에 따라 설정
-	TileCullingBuffer.ViewportStartX = View->ViewRect.MinX;  // ShowFlag에 따라 설정
-	TileCullingBuffer.ViewportStartY = View->ViewRect.MinY;  // ShowFlag에 따라 설정
-
-	RHIDevice->SetAndUpdateConstantBuffer(TileCullingBuffer);
+	bTileLightCullingEnabled = bTileCullingEnabled;
+	UpdateTileCullingConstantBuffer(bTileCullingEnabled);
 
 	// Structured Buffer SRV를 t2 슬롯에 바인딩 (타일 컬링 활성화 시에만)
 	if (bTileCullingEnabled)
 	{
-		ID3D11ShaderResourceView* TileLightIndexSRV = TileLightCuller->GetLightIndexBufferSRV();
+		ID3D11ShaderResourceView* TileLightIndexSRV = ClusteredLightCuller->GetLightIndexBufferSRV();
 		if (TileLightIndexSRV)
 		{
 			RHIDevice->GetDeviceContext()->PSSetShaderResources(2, 1, &TileLightIndexSRV);
@@ -937,6 +1053,24 @@ void FSceneRenderer::PerformTileLightCulling()
 	}
 }
 
+void FSceneRenderer::UpdateTileCullingConstantBuffer(bool bUseTileLightCulling)
+{
+	UINT ViewportWidth = static_cast<UINT>(View->ViewRect.Width());
+	UINT ViewportHeight = static_cast<UINT>(View->ViewRect.Height());
+
+	uint32 TileSize = World->GetRenderSettings().GetTileSize();
+	FTileCullingBufferType TileCullingBuffer;
+	TileCullingBuffer.TileSize = TileSize;
+	TileCullingBuffer.TileCountX = (ViewportWidth + TileSize - 1) / TileSize;
+	TileCullingBuffer.TileCountY = (ViewportHeight + TileSize - 1) / TileSize;
+	TileCullingBuffer.bUseTileCulling = bUseTileLightCulling ? 1 : 0;  // ShowFlag에 따라 설정
+	TileCullingBuffer.ViewportStartX = View->ViewRect.MinX;
+	TileCullingBuffer.ViewportStartY = View->ViewRect.MinY;
+	FClusteredLightCuller::FillClusterParams(TileCullingBuffer, View->ViewMatrix, View->NearClip, View->FarClip);
+
+	RHIDevice->SetAndUpdateConstantBuffer(TileCullingBuffer);
+}
+
 void FSceneRenderer::PerformFrustumCulling()
 {
 	PotentiallyVisibleComponents.clear();	// 할 필요 없는데 명목적으로 초기화
@@ -957,9 +1091,46 @@ void FSceneRenderer::PerformFrustumCulling()
 	//}
 }
 
+void FSceneRenderer::RenderCPUOnly(IRHICommandContext& CommandContext, FSceneRenderCPUTimings& OutTimings)
+{
+	if (!IsValid()) return;
+
+	const uint64 StartCycles = FPlatformTime::Cycles64();
+	GatherVisibleProxies();
+	const uint64 GatherEndCycles = FPlatformTime::Cycles64();
+
+	CollectOpaqueMeshBatches();
+	const uint64 CollectEndCycles = FPlatformTime::Cycles64();
+
+	MeshBatchElements.Sort();
+	const uint64 SortEndCycles = FPlatformTime::Cycles64();
+
+	OutTimings.VisibleMeshCount += Proxies.Meshes.Num();
+	OutTimings.MeshBatchCount += MeshBatchElements.Num();
+
+	DrawMeshBatches(CommandContext, MeshBatchElements, true);
+	const uint64 SubmitEndCycles = FPlatformTime::Cycles64();
+
+	OutTimings.GatherMs += FPlatformTime::ToMilliseconds(GatherEndCycles - StartCycles);
+	OutTimings.CollectMs += FPlatformTime::ToMilliseconds(CollectEndCycles - GatherEndCycles);
+	OutTimings.SortMs += FPlatformTime::ToMilliseconds(SortEndCycles - CollectEndCycles);
+	OutTimings.SubmitMs += FPlatformTime::ToMilliseconds(SubmitEndCycles - SortEndCycles);
+}
+
 void FSceneRenderer::RenderOpaquePass(EViewMode InRenderViewMode)
 {
 	// --- 1. 수집 (Collect) - 불투명 객체만 ---
+	CollectOpaqueMeshBatches();
+
+	// --- 2. 정렬 (Sort) ---
+	MeshBatchElements.Sort();
+
+	// --- 3. 그리기 (Draw) ---
+	DrawMeshBatches(MeshBatchElements, true);
+}
+
+void FSceneRenderer::CollectOpaqueMeshBatches()
+{
 	MeshBatchElements.Empty();
 	for (UMeshComponent* MeshComponent : Proxies.Meshes)
 	{
@@ -982,12 +1153,6 @@ void FSceneRenderer::RenderOpaquePass(EViewMode InRenderViewMode)
 		// TODO: UTextRenderComponent도 CollectMeshBatches를 통해 FMeshBatchElement를 생성하도록 구현
 		//TextRenderComponent->CollectMeshBatches(MeshBatchElements, View);
 	}
-
-	// --- 2. 정렬 (Sort) ---
-	MeshBatchElements.Sort();
-
-	// --- 3. 그리기 (Draw) ---
-	DrawMeshBatches(MeshBatchElements, true);
 }
 
 void FSceneRenderer::RenderTransparentPass(EViewMode InRenderViewMode)
@@ -1002,6 +1167,10 @@ void FSceneRenderer::RenderTransparentPass(EViewMode InRenderViewMode)
 	uint64 StartCycles = FPlatformTime::Cycles64();
 
 	// --- 1. 수집 (Collect) - 파티클 등 투명 객체 ---
+	// 모든 에미터가 공유 인스턴스 버퍼에서 구간을 나눠 받고, 수집이 끝나면 한 번에 업로드한다.
+	FParticleInstanceBufferManager& InstanceBufferManager = FParticleInstanceBufferManager::Get();
+	InstanceBufferManager.BeginFrame();
+
 	MeshBatchElements.Empty();
 	for (UParticleSystemComponent* ParticleSystemComponent : Proxies.Particles)
 	{
@@ -1010,6 +1179,8 @@ void FSceneRenderer::RenderTransparentPass(EViewMode InRenderViewMode)
 		ParticleSystemComponent->CollectMeshBatches(MeshBatchElements, View);
 	}
 
+	InstanceBufferManager.FlushUploads();
+
 	if (MeshBatchElements.empty())
 	{
 		// 파티클이 없어도 시간 측정 완료
@@ -1065,7 +1236,7 @@ void FSceneRenderer::RenderDecalPass()
 
 	// ViewMode에 따른 Decal 셰이더 로드
 	UShader* DecalShader = UResourceManager::GetInstance().Load<UShader>(ShaderPath, View->ViewShaderMacros);
-	FShaderVariant* ShaderVariant = DecalShader->GetOrCompileShaderVariant(View->ViewShaderMacros);
+	FShaderVariant* ShaderVariant = DecalShader ? DecalShader->GetOrCompileShaderVariant(View->ViewPermutationId) : nullptr;
 	if (!DecalShader || !ShaderVariant)
 	{
 		UE_LOG("RenderDecalPass: Failed to load Decal shader with ViewMode macros!");
@@ -1077,6 +1248,18 @@ void FSceneRenderer::RenderDecalPass()
 	RHIDevice->OMSetDepthStencilState(EComparisonFunc::LessEqualReadOnly); // 깊이 쓰기 OFF
 	RHIDevice->OMSetBlendState(true);
 
+	// 데칼 타일 인덱스는 라이트 타일 컬링과 같은 그리드(b11)를 사용 (Unlit 모드에서는 여기서 처음 설정됨)
+	UpdateTileCullingConstantBuffer(bTileLightCullingEnabled);
+
+	// --- 데칼 렌더 시간 측정 시작 ---
+	auto CpuTimeStart = std::chrono::high_resolution_clock::now();
+
+	// 서로 다른 텍스처가 MaxDecalTextures개를 넘지 않는 묶음으로 나눠서 그림
+	// 보통(총알 자국, 핏자국 등 텍스처 몇 종류)은 묶음 하나라 리시버 메시를 한 번만 그림
+	TArray<UDecalComponent*> BatchDecals;
+	TArray<uint32> BatchTextureSlots;
+	TArray<ID3D11ShaderResourceView*> BatchTextures;
+
 	for (UDecalComponent* Decal : Proxies.Decals)
 	{
 		if (!Decal || !Decal->GetDecalTexture())
@@ -1084,68 +1267,143 @@ void FSceneRenderer::RenderDecalPass()
 			continue;
 		}
 
-		// Decal이 그려질 Primitives
-		TArray<UPrimitiveComponent*> TargetPrimitives;
+		ID3D11ShaderResourceView* DecalTextureSRV = Decal->GetDecalTexture()->GetShaderResourceView();
+		if (!DecalTextureSRV)
+		{
+			continue;
+		}
+
+		int32 TextureSlot = BatchTextures.Find(DecalTextureSRV);
+		if (TextureSlot == -1)
+		{
+			if (BatchTextures.Num() == static_cast<int32>(FTileDecalCuller::MaxDecalTextures))
+			{
+				RenderDecalBatch(BatchDecals, BatchTextureSlots, BatchTextures, ShaderVariant);
+				BatchDecals.Empty();
+				BatchTextureSlots.Empty();
+				BatchTextures.Empty();
+			}
+			TextureSlot = BatchTextures.Add(DecalTextureSRV);
+		}
+
+		BatchDecals.Add(Decal);
+		BatchTextureSlots.Add(static_cast<uint32>(TextureSlot));
+	}
+	RenderDecalBatch(BatchDecals, BatchTextureSlots, BatchTextures, ShaderVariant);
+
+	// --- 데칼 렌더 시간 측정 종료 및 결과 저장 ---
+	auto CpuTimeEnd = std::chrono::high_resolution_clock::now();
+	std::chrono::duration<double, std::milli> CpuTimeMs = CpuTimeEnd - CpuTimeStart;
+	FDecalStatManager::GetInstance().GetDecalPassTimeSlot() += CpuTimeMs.count(); // CPU 소요 시간 저장
+
+	// 상태 복구
+	RHIDevice->RSSetState(ERasterizerMode::Solid);
+	RHIDevice->OMSetDepthStencilState(EComparisonFunc::LessEqual);
+	RHIDevice->OMSetBlendState(false);
+}
+
+void FSceneRenderer::RenderDecalBatch(const TArray<UDecalComponent*>& Decals, const TArray<uint32>& TextureSlots,
+	const TArray<ID3D11ShaderResourceView*>& Textures, const FShaderVariant* ShaderVariant)
+{
+	if (Decals.IsEmpty())
+		return;
+
+	const FBVHierarchy* BVH = World->GetPartitionManager()->GetBVH();
+
+	// 1. 데칼 데이터 수집 + 리시버 합집합 (리시버는 데칼을 몇 개 받든 한 번만 그림)
+	TArray<FDecalInfo> DecalInfos;
+	TArray<FOBB> DecalVolumes;
+	DecalInfos.Reserve(Decals.Num());
+	DecalVolumes.Reserve(Decals.Num());
+
+	TSet<UPrimitiveComponent*> VisitedReceivers;
+	TArray<UPrimitiveComponent*> Receivers;
+
+	for (int32 i = 0; i < Decals.Num(); ++i)
+	{
+		UDecalComponent* Decal = Decals[i];
+
+		FDecalInfo& Info = DecalInfos.emplace_back();
+		Info.DecalMatrix = Decal->GetDecalProjectionMatrix();
+		Info.Opacity = Decal->GetOpacity();
+		Info.TextureSlot = TextureSlots[i];
 
-		// 1. Decal의 World AABB와 충돌한 모든 StaticMeshComponent 쿼리
 		const FOBB DecalOBB = Decal->GetWorldOBB();
-		TArray<UPrimitiveComponent*> IntersectedStaticMeshComponents = BVH->QueryIntersectedComponents(DecalOBB);
+		DecalVolumes.Add(DecalOBB);
 
-		// 2. 충돌한 모든 visible Actor의 PrimitiveComponent를 TargetPrimitives에 추가
+		// Decal의 World OBB와 충돌한 모든 PrimitiveComponent 쿼리
 		// Actor에 기본으로 붙어있는 TextRenderComponent, BoundingBoxComponent는 decal 적용 안되게 하기 위해,
 		// 임시로 PrimitiveComponent가 아닌 UStaticMeshComponent를 받도록 함
-		for (UPrimitiveComponent* SMC : IntersectedStaticMeshComponents)
+		for (UPrimitiveComponent* SMC : BVH->QueryIntersectedComponents(DecalOBB))
 		{
 			// 기즈모에 데칼 입히면 안되므로 에디팅이 안되는 Component는 데칼 그리지 않음
 			if (!SMC || !SMC->IsEditable())
 				continue;
-			
+
 			AActor* Owner = SMC->GetOwner();
 			if (!Owner || !Owner->IsActorVisible())
 				continue;
 
-			FDecalStatManager::GetInstance().IncrementAffectedMeshCount();
-			TargetPrimitives.push_back(SMC);
+			if (VisitedReceivers.Contains(SMC))
+				continue;
+
+			VisitedReceivers.Add(SMC);
+			Receivers.Add(SMC);
 		}
+	}
 
-		// --- 데칼 렌더 시간 측정 시작 ---
-		auto CpuTimeStart = std::chrono::high_resolution_clock::now();
+	if (Receivers.IsEmpty())
+		return;
 
-		// 데칼 전용 상수 버퍼 설정
-		const FMatrix DecalMatrix = Decal->GetDecalProjectionMatrix();
-		RHIDevice->SetAndUpdateConstantBuffer(DecalBufferType(DecalMatrix, Decal->GetOpacity()));
+	// 2. 데칼을 화면 타일에 분류하고 GPU 버퍼 업로드
+	TileDecalCuller->CullDecals(
+		DecalInfos,
+		DecalVolumes,
+		View->ViewMatrix,
+		View->ProjectionMatrix,
+		static_cast<UINT>(View->ViewRect.Width()),
+		static_cast<UINT>(View->ViewRect.Height())
+	);
 
-		// 3. TargetPrimitive 순회하며 수집 후 렌더링
-		MeshBatchElements.Empty();
-		for (UPrimitiveComponent* Target : TargetPrimitives)
-		{
-			Target->CollectMeshBatches(MeshBatchElements, View);
-		}
-		for (FMeshBatchElement& BatchElement : MeshBatchElements)
-		{
-			BatchElement.InstanceShaderResourceView = Decal->GetDecalTexture()->GetShaderResourceView();
-			BatchElement.Material = Decal->GetMaterial(0);
-			BatchElement.InputLayout = ShaderVariant->InputLayout;
-			BatchElement.VertexShader = ShaderVariant->VertexShader;
-			BatchElement.PixelShader = ShaderVariant->PixelShader;
-			BatchElement.VertexStride = sizeof(FVertexDynamic);
-		}
-		DrawMeshBatches(MeshBatchElements, true);
+	RHIDevice->SetAndUpdateConstantBuffer(DecalBufferType{ static_cast<uint32>(DecalInfos.Num()), FTileDecalCuller::MaxDecalsPerTile });
+
+	ID3D11DeviceContext* DeviceContext = RHIDevice->GetDeviceContext();
+	ID3D11ShaderResourceView* DecalListSRVs[2] = { TileDecalCuller->GetTileDecalIndexSRV(), TileDecalCuller->GetDecalInfoSRV() };
+	DeviceContext->PSSetShaderResources(12, 2, DecalListSRVs);
 
-		// --- 데칼 렌더 시간 측정 종료 및 결과 저장 ---
-		auto CpuTimeEnd = std::chrono::high_resolution_clock::now();
-		std::chrono::duration<double, std::milli> CpuTimeMs = CpuTimeEnd - CpuTimeStart;
-		FDecalStatManager::GetInstance().GetDecalPassTimeSlot() += CpuTimeMs.count(); // CPU 소요 시간 저장
+	ID3D11ShaderResourceView* DecalTextureSRVs[FTileDecalCuller::MaxDecalTextures] = {};
+	for (int32 i = 0; i < Textures.Num(); ++i)
+	{
+		DecalTextureSRVs[i] = Textures[i];
 	}
+	DeviceContext->PSSetShaderResources(14, FTileDecalCuller::MaxDecalTextures, DecalTextureSRVs);
 
-	// 상태 복구
-	RHIDevice->RSSetState(ERasterizerMode::Solid);
-	RHIDevice->OMSetDepthStencilState(EComparisonFunc::LessEqual);
-	RHIDevice->OMSetBlendState(false);
+	// 3. 리시버마다 한 번씩 수집 후 렌더링
+	MeshBatchElements.Empty();
+	for (UPrimitiveComponent* Target : Receivers)
+	{
+		FDecalStatManager::GetInstance().IncrementAffectedMeshCount();
+		Target->CollectMeshBatches(MeshBatchElements, View);
+	}
+	for (FMeshBatchElement& BatchElement : MeshBatchElements)
+	{
+		BatchElement.InstanceShaderResourceView = nullptr;
+		BatchElement.Material = Decals[0]->GetMaterial(0);
+		BatchElement.InputLayout = ShaderVariant->InputLayout;
+		BatchElement.VertexShader = ShaderVariant->VertexShader;
+		BatchElement.PixelShader = ShaderVariant->PixelShader;
+		BatchElement.VertexStride = sizeof(FVertexDynamic);
+	}
+	DrawMeshBatches(MeshBatchElements, true);
+
+	// 다음 묶음/패스에 이전 데칼 리소스가 남지 않도록 해제
+	ID3D11ShaderResourceView* NullSRVs[2 + FTileDecalCuller::MaxDecalTextures] = {};
+	DeviceContext->PSSetShaderResources(12, 2 + FTileDecalCuller::MaxDecalTextures, NullSRVs);
 }
 
 void FSceneRenderer::RenderPostProcessingPasses()
 {
+	PROFILE_SCOPE("PostProcessing");
 	// Ensure first post-process pass samples from the current scene output
  	TArray<FPostProcessModifier> PostProcessModifiers = View->Modifiers;
 
@@ -1414,19 +1672,24 @@ void FSceneRenderer::RenderFinalOverlayLines()
 
 // 수집한 Batch 그리기
 void FSceneRenderer::DrawMeshBatches(TArray<FMeshBatchElement>& InMeshBatches, bool bClearListAfterDraw)
+{
+	DrawMeshBatches(D3D11CommandContext, InMeshBatches, bClearListAfterDraw);
+}
+
+void FSceneRenderer::DrawMeshBatches(IRHICommandContext& CommandContext, TArray<FMeshBatchElement>& InMeshBatches, bool bClearListAfterDraw)
 {
 	if (InMeshBatches.IsEmpty()) return;
 
 	// RHI 상태 초기 설정 (Opaque Pass 기본값)
-	RHIDevice->OMSetDepthStencilState(EComparisonFunc::LessEqual); // 깊이 쓰기 ON
+	CommandContext.OMSetDepthStencilState(EComparisonFunc::LessEqual); // 깊이 쓰기 ON
 
 	// PS 리소스 초기화
 	ID3D11ShaderResourceView* nullSRVs[2] = { nullptr, nullptr };
-	RHIDevice->GetDeviceContext()->PSSetShaderResources(0, 2, nullSRVs);
+	CommandContext.PSSetShaderResources(0, 2, nullSRVs);
 	ID3D11SamplerState* nullSamplers[2] = { nullptr, nullptr };
-	RHIDevice->GetDeviceContext()->PSSetSamplers(0, 2, nullSamplers);
+	CommandContext.PSSetSamplers(0, 2, nullSamplers);
 	FPixelConstBufferType DefaultPixelConst{};
-	RHIDevice->SetAndUpdateConstantBuffer(DefaultPixelConst);
+	CommandContext.SetAndUpdateConstantBuffer(DefaultPixelConst);
 
 	// 현재 GPU 상태 캐싱용 변수 (UStaticMesh* 대신 실제 GPU 리소스로 변경)
 	ID3D11VertexShader* CurrentVertexShader = nullptr;
@@ -1469,10 +1732,7 @@ void FSceneRenderer::DrawMeshBatches(TArray<FMeshBatchElement>& InMeshBatches, b
 		bool bForceShaderBind = (Batch.InstanceCount > 1);
 		if (bForceShaderBind || Batch.VertexShader != CurrentVertexShader || Batch.PixelShader != CurrentPixelShader)
 		{
-			RHIDevice->GetDeviceContext()->IASetInputLayout(Batch.InputLayout);
-			RHIDevice->GetDeviceContext()->VSSetShader(Batch.VertexShader, nullptr, 0);
-
-			RHIDevice->GetDeviceContext()->PSSetShader(Batch.PixelShader, nullptr, 0);
+			CommandContext.SetShaders(Batch.InputLayout, Batch.VertexShader, Batch.PixelShader);
 
 			CurrentVertexShader = Batch.VertexShader;
 			CurrentPixelShader = Batch.PixelShader;
@@ -1534,16 +1794,16 @@ void FSceneRenderer::DrawMeshBatches(TArray<FMeshBatchElement>& InMeshBatches, b
 			// --- RHI 상태 업데이트 ---
 			// 1. 텍스처(SRV) 바인딩
 			ID3D11ShaderResourceView* Srvs[2] = { DiffuseTextureSRV, NormalTextureSRV };
-			RHIDevice->GetDeviceContext()->PSSetShaderResources(0, 2, Srvs);
+			CommandContext.PSSetShaderResources(0, 2, Srvs);
 
 			// 2. 샘플러 바인딩 (SamplerType에 따라 다른 샘플러 사용)
 			// SamplerType: 0 = Default (WRAP), 1 = LinearClamp (Beam/Ribbon용)
 			ID3D11SamplerState* PrimarySampler = (Batch.SamplerType == 1) ? LinearClampSampler : DefaultSampler;
 			ID3D11SamplerState* Samplers[4] = { PrimarySampler, PrimarySampler, ShadowSampler, VSMSampler };
-			RHIDevice->GetDeviceContext()->PSSetSamplers(0, 4, Samplers);
+			CommandContext.PSSetSamplers(0, 4, Samplers);
 
 			// 3. 재질 CBuffer 바인딩
-			RHIDevice->SetAndUpdateConstantBuffer(PixelConst);
+			CommandContext.SetAndUpdateConstantBuffer(PixelConst);
 
 			// --- 캐시 업데이트 ---
 			CurrentMaterial = Batch.Material;
@@ -1557,15 +1817,8 @@ void FSceneRenderer::DrawMeshBatches(TArray<FMeshBatchElement>& InMeshBatches, b
 			Batch.VertexStride != CurrentVertexStride ||
 			Batch.PrimitiveTopology != CurrentTopology)
 		{
-			UINT Stride = Batch.VertexStride;
-			UINT Offset = 0;
-
-			// Vertex/Index 버퍼 바인딩
-			RHIDevice->GetDeviceContext()->IASetVertexBuffers(0, 1, &Batch.VertexBuffer, &Stride, &Offset);
-			RHIDevice->GetDeviceContext()->IASetIndexBuffer(Batch.IndexBuffer, DXGI_FORMAT_R32_UINT, 0);
-
-			// 토폴로지 설정 (이전 코드의 5번에서 이동하여 최적화)
-			RHIDevice->GetDeviceContext()->IASetPrimitiveTopology(Batch.PrimitiveTopology);
+			// Vertex/Index 버퍼 + 토폴로지 바인딩 (토폴로지는 이전 코드의 5번에서 이동하여 최적화)
+			CommandContext.SetGeometry(Batch.VertexBuffer, Batch.VertexStride, Batch.IndexBuffer, Batch.PrimitiveTopology);
 
 			// 현재 IA 상태 캐싱
 			CurrentVertexBuffer = Batch.VertexBuffer;
@@ -1575,8 +1828,8 @@ void FSceneRenderer::DrawMeshBatches(TArray<FMeshBatchElement>& InMeshBatches, b
 		}
 
 		// 스켈레탈 메시 GPU 타이밍: 타입 전환 감지
-		// (CPU/GPU 모드 모두 Batch.bIsSkeletalMesh == true)
-		bool bIsSkeletalMesh = Batch.bIsSkeletalMesh;
+		// (CPU/GPU 모드 모두 Batch.bIsSkeletalMesh == true, GPU 쿼리라 Null RHI에서는 생략)
+		bool bIsSkeletalMesh = Batch.bIsSkeletalMesh && CommandContext.HasDevice();
 
 		// 스켈레탈 → 논스켈레탈 전환 시 RecordEnd
 		if (!bIsSkeletalMesh && bGPUQueryStarted)
@@ -1597,26 +1850,27 @@ void FSceneRenderer::DrawMeshBatches(TArray<FMeshBatchElement>& InMeshBatches, b
 			Batch.BoneNormalMatrixSRV != CurrentVSBoneNormalSRV)
 		{
 			ID3D11ShaderResourceView* BoneSrvs[2] = { Batch.BoneMatrixSRV, Batch.BoneNormalMatrixSRV };
-			RHIDevice->GetDeviceContext()->VSSetShaderResources(12, 2, BoneSrvs);
+			CommandContext.VSSetShaderResources(12, 2, BoneSrvs);
 			CurrentVSBoneMatrixSRV = Batch.BoneMatrixSRV;
 			CurrentVSBoneNormalSRV = Batch.BoneNormalMatrixSRV;
 		}
 
-		// 4.5. 파티클 인스턴스 버퍼 바인딩 (VS t12)
+		// 4.5. 파티클 인스턴스 버퍼 바인딩 (VS t12) + 구간 시작 위치 (VS b9)
 		if (Batch.ParticleInstanceSRV)
 		{
-			RHIDevice->GetDeviceContext()->VSSetShaderResources(12, 1, &Batch.ParticleInstanceSRV);
+			CommandContext.VSSetShaderResources(12, 1, &Batch.ParticleInstanceSRV);
+			CommandContext.SetAndUpdateConstantBuffer(FParticleInstanceBufferType(Batch.FirstInstance));
 		}
 
 		// 5. 오브젝트별 상수 버퍼 설정 (매번 변경)
-		RHIDevice->SetAndUpdateConstantBuffer(ModelBufferType(Batch.WorldMatrix, Batch.WorldMatrix.InverseAffine().Transpose()));
-		RHIDevice->SetAndUpdateConstantBuffer(ColorBufferType(Batch.InstanceColor, Batch.ObjectID, Batch.UVStart, Batch.UVEnd, Batch.UseTexture));
+		CommandContext.SetAndUpdateConstantBuffer(ModelBufferType(Batch.WorldMatrix, Batch.WorldMatrix.InverseAffine().Transpose()));
+		CommandContext.SetAndUpdateConstantBuffer(ColorBufferType(Batch.InstanceColor, Batch.ObjectID, Batch.UVStart, Batch.UVEnd, Batch.UseTexture));
 
 		// 6. 드로우 콜 실행
 		if (Batch.InstanceCount > 1)
 		{
 			// 인스턴싱 (파티클 등)
-			RHIDevice->GetDeviceContext()->DrawIndexedInstanced(
+			CommandContext.DrawIndexedInstanced(
 				Batch.IndexCount,
 				Batch.InstanceCount,
 				Batch.StartIndex,
@@ -1627,14 +1881,14 @@ void FSceneRenderer::DrawMeshBatches(TArray<FMeshBatchElement>& InMeshBatches, b
 		else
 		{
 			// 일반 드로우
-			RHIDevice->GetDeviceContext()->DrawIndexed(Batch.IndexCount, Batch.StartIndex, Batch.BaseVertexIndex);
+			CommandContext.DrawIndexed(Batch.IndexCount, Batch.StartIndex, Batch.BaseVertexIndex);
 		}
 
 		// 파티클 SRV 바인딩 해제
 		if (Batch.ParticleInstanceSRV)
 		{
 			ID3D11ShaderResourceView* NullSRV = nullptr;
-			RHIDevice->GetDeviceContext()->VSSetShaderResources(12, 1, &NullSRV);
+			CommandContext.VSSetShaderResources(12, 1, &NullSRV);
 		}
 	}
 
@@ -1653,7 +1907,7 @@ void FSceneRenderer::DrawMeshBatches(TArray<FMeshBatchElement>& InMeshBatches, b
 	if (CurrentVSBoneMatrixSRV || CurrentVSBoneNormalSRV)
 	{
 		ID3D11ShaderResourceView* NullBoneSrvs[2] = { nullptr, nullptr };
-		RHIDevice->GetDeviceContext()->VSSetShaderResources(12, 2, NullBoneSrvs);
+		CommandContext.VSSetShaderResources(12, 2, NullBoneSrvs);
 	}
 }
 
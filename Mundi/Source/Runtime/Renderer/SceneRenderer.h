@@ -1,11 +1,13 @@
 ﻿#pragma once
 #include "Frustum.h"
+#include "AABB.h"
 
 // TODO : Post Processing 떼어내기, 전방선언으로라든지...
 #include "PostProcessing/FadeInOutPass.h"
 #include "PostProcessing/VignettePass.h"
 #include "PostProcessing/HeightFogPass.h"
 #include "PostProcessing/GammaPass.h"
+#include "RHICommandContext.h"
 
 // 전방 선언 (헤더 파일 의존성 최소화)
 class UWorld;
@@ -26,11 +28,13 @@ class UBillboardComponent;
 class UTextRenderComponent;
 class UGizmoArrowComponent;
 class FSceneView;
-class FTileLightCuller;
+class FClusteredLightCuller;
+class FTileDecalCuller;
 class ULineComponent;
 class UParticleSystemComponent;
 
 struct FCandidateDrawable;
+struct FShaderVariant;
 
 // 렌더링할 대상들의 집합을 담는 구조체
 struct FVisibleRenderProxySet
@@ -65,6 +69,27 @@ struct FSceneGlobals
 	TArray<UHeightFogComponent*> Fogs;	// 첫 번째로 찾은 Fog를 사용함
 };
 
+// 섀도우 캐스터 하나의 정보 (뷰별 컬링 / 섀도우 캐시 판정용)
+struct FShadowCasterInfo
+{
+	FAABB Bounds;
+	int32 FirstBatch = 0;	// ShadowMeshBatches 내 시작 인덱스
+	int32 NumBatches = 0;
+	uint64 Hash = 0;		// 컴포넌트 + 배치(버퍼, 월드 행렬) 해시
+	bool bDynamic = false;	// 스키닝 등 해시로 변화를 감지할 수 없는 캐스터
+};
+
+// GPU 없이 측정한 프레임 CPU 비용 (RenderCPUOnly 호출마다 누적, ms)
+struct FSceneRenderCPUTimings
+{
+	double GatherMs = 0.0;		// 액터 순회 + 가시성 판정
+	double CollectMs = 0.0;		// CollectMeshBatches
+	double SortMs = 0.0;		// FMeshBatchElement 정렬
+	double SubmitMs = 0.0;		// DrawMeshBatches (상태 캐싱 + 명령 제출)
+	int32 VisibleMeshCount = 0;
+	int32 MeshBatchCount = 0;
+};
+
 /**
  * @class FSceneRenderer
  * @brief 한 프레임의 특정 뷰(View)에 대한 씬 렌더링을 총괄하는 임시(transient) 클래스.
@@ -78,6 +103,12 @@ public:
 	/** @brief 이 씬 렌더러의 모든 렌더링 파이프라인을 실행합니다. */
 	void Render();
 
+	/**
+	 * @brief 불투명 패스의 수집/정렬/제출만 실행하고 단계별 CPU 시간을 OutTimings에 더합니다.
+	 * 드로우 명령은 CommandContext로 제출되므로 FNullRHICommandContext를 넘기면 GPU 작업 없이 측정할 수 있습니다.
+	 */
+	void RenderCPUOnly(IRHICommandContext& CommandContext, FSceneRenderCPUTimings& OutTimings);
+
 private:
 	// Render Path
 	void RenderLitPath();
@@ -87,6 +118,12 @@ private:
 	void RenderShadowMaps();
 	void RenderShadowDepthPass(FShadowRenderRequest& ShadowRequest, const TArray<FMeshBatchElement>& InShadowBatches);
 
+	/** @brief 섀도우 뷰 절두체에 걸치는 캐스터의 배치만 모으고, 캐시 판정용 해시를 계산합니다. */
+	void GatherShadowViewBatches(const FShadowRenderRequest& Request, const TArray<FShadowCasterInfo>& InCasters, const TArray<FMeshBatchElement>& InAllBatches,
+		TArray<FMeshBatchElement>& OutViewBatches, uint64& OutCasterHash, bool& bOutHasDynamicCasters) const;
+	/** @brief 현재 뷰포트 영역의 섀도우 깊이(및 VSM 모멘트)만 클리어합니다. */
+	void ClearShadowViewport(bool bClearVSMMoments);
+
 	/** @brief 렌더링에 필요한 포인터들이 유효한지 확인합니다. */
 	bool IsValid() const;
 
@@ -102,17 +139,28 @@ private:
 	/** @brief 타일 기반 라이트 컬링을 수행하고 Structured Buffer를 업데이트합니다. */
 	void PerformTileLightCulling();
 
+	/** @brief 타일 컬링 상수 버퍼(b11)를 현재 뷰 기준으로 갱신합니다. 라이트/데칼 타일 목록이 같은 그리드를 사용합니다. */
+	void UpdateTileCullingConstantBuffer(bool bUseTileLightCulling);
+
 	/** @brief 불투명(Opaque) 객체들을 렌더링하는 패스입니다. */
 	void RenderOpaquePass(EViewMode InRenderViewMode);
 
 	/** @brief 투명(Transparent) 객체들을 렌더링하는 패스입니다 (파티클 등). */
 	void RenderTransparentPass(EViewMode InRenderViewMode);
 
+	/** @brief Proxies의 불투명 메시/빌보드에서 MeshBatchElements를 수집합니다. */
+	void CollectOpaqueMeshBatches();
+
 	void DrawMeshBatches(TArray<FMeshBatchElement>& InMeshBatches, bool bClearListAfterDraw);
+	void DrawMeshBatches(IRHICommandContext& CommandContext, TArray<FMeshBatchElement>& InMeshBatches, bool bClearListAfterDraw);
 
-	/** @brief 데칼(Decal)을 렌더링하는 패스입니다. */
+	/** @brief 데칼(Decal)을 렌더링하는 패스입니다. 데칼을 화면 타일에 분류하고 리시버 메시는 한 번만 그립니다. */
 	void RenderDecalPass();
 
+	/** @brief 텍스처가 MaxDecalTextures개 이하인 데칼 묶음 하나를 그립니다. */
+	void RenderDecalBatch(const TArray<UDecalComponent*>& Decals, const TArray<uint32>& TextureSlots,
+		const TArray<ID3D11ShaderResourceView*>& Textures, const FShaderVariant* ShaderVariant);
+
 	void RenderPostProcessingPasses();
 	void RenderSceneDepthPostProcess();
 	void RenderTileCullingDebug();
@@ -152,8 +200,17 @@ private:
 	// 각 패스에서 수집된 드로우 콜 정보 리스트
 	TArray<FMeshBatchElement> MeshBatchElements;
 
-	// 타일 기반 라이트 컬링 시스템 (매 프레임 생성되고 소멸되어서 스마트 포인터로 설정)
-	std::unique_ptr<FTileLightCuller> TileLightCuller;
+	// 클러스터 기반 라이트 컬링 시스템 (매 프레임 생성되고 소멸되어서 스마트 포인터로 설정)
+	std::unique_ptr<FClusteredLightCuller> ClusteredLightCuller;
+
+	// 타일 기반 데칼 분류 시스템 (ClusteredLightCuller와 같은 타일 그리드 사용)
+	std::unique_ptr<FTileDecalCuller> TileDecalCuller;
+
+	// 이번 프레임에 라이트 클러스터 목록(t2)이 유효한지 (PerformTileLightCulling에서 설정)
+	bool bTileLightCullingEnabled = false;
+
+	// DrawMeshBatches 기본 제출 대상 (RHIDevice로 그대로 전달)
+	FD3D11CommandContext D3D11CommandContext;
 
 	// TODO : 자동으로 등록되게 바꾸기!, bloom 빼고 다 stateless해서 걔네는 static(etc..) 등 하이브리도 구조로 바꾸기
 	// PostProcessing 
@@ -41,6 +41,7 @@ FSceneView::FSceneView(FMinimalViewInfo* InMinimalViewInfo, URenderSettings* InR
 	);
 
 	ViewShaderMacros = CreateViewShaderMacros();
+	ViewPermutationId = FShaderPermutationDomain::GetInstance().Encode(ViewShaderMacros);
 }
 
 FSceneView::FSceneView(UCameraComponent* InCamera, FViewport* InViewport, URenderSettings* InRenderSettings)
@@ -78,6 +79,7 @@ FSceneView::FSceneView(UCameraComponent* InCamera, FViewport* InViewport, URende
 	ProjectionMode = InCamera->GetProjectionMode();
 
 	ViewShaderMacros = CreateViewShaderMacros();
+	ViewPermutationId = FShaderPermutationDomain::GetInstance().Encode(ViewShaderMacros);
 }
 
 TArray<FShaderMacro> FSceneView::CreateViewShaderMacros()
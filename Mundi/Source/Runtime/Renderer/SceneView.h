@@ -68,6 +68,7 @@ public:
     // 렌더링 설정
     ECameraProjectionMode ProjectionMode = ECameraProjectionMode::Perspective;
     TArray<FShaderMacro> ViewShaderMacros;
+    FShaderPermutationId ViewPermutationId = 0; // ViewShaderMacros를 미리 변환해 둔 ID
     float NearClip = 0.0f;
     float FarClip = 0.0f;
     float FieldOfView = 0.0f;
@@ -1,6 +1,5 @@
 ﻿#include "pch.h"
 #include "Shader.h"
-#include "Hash.h"
 
 IMPLEMENT_CLASS(UShader)
 
@@ -52,37 +51,173 @@ UShader::~UShader()
 	ReleaseResources();
 }
 
-uint64 UShader::GenerateShaderKey(const TArray<FShaderMacro>& InMacros)
+// ──────────────────────────────
+// FShaderPermutationDomain
+// ──────────────────────────────
+
+namespace
 {
-	// 1. TMap을 사용해 중복 제거
-	TMap<FName, FName> UniqueMacroMap;
-	for (const FShaderMacro& Macro : InMacros)
+	// 자동 선언되는 차원이 담을 수 있는 값 개수 (3비트)
+	constexpr uint32 DefaultReservedPermutationValues = 7;
+
+	// 값 N개 + '미정의' 상태를 담을 수 있는 최소 비트 수
+	uint32 GetPermutationBitCount(uint32 NumValues)
+	{
+		uint32 BitCount = 1;
+		while ((1ull << BitCount) <= NumValues)
+		{
+			++BitCount;
+		}
+		return BitCount;
+	}
+}
+
+FShaderPermutationDomain& FShaderPermutationDomain::GetInstance()
+{
+	static FShaderPermutationDomain Instance;
+	return Instance;
+}
+
+FShaderPermutationDomain::FShaderPermutationDomain()
+{
+	// 엔진 셰이더가 사용하는 매크로는 실제 값 개수에 맞춰 미리 선언해 ID를 작게 유지한다.
+	// (ID가 작을수록 UShader의 직접 조회 테이블에 들어간다)
+	DeclareDimension("LIGHTING_MODEL_PHONG", { "1" });
+	DeclareDimension("LIGHTING_MODEL_GOURAUD", { "1" });
+	DeclareDimension("LIGHTING_MODEL_LAMBERT", { "1" });
+	DeclareDimension("VIEWMODE_WORLD_NORMAL", { "1" });
+	DeclareDimension("SHADOW_AA_TECHNIQUE", { "0", "1", "2" });
+	DeclareDimension("ENABLE_GPU_SKINNING", { "1" });
+	DeclareDimension("PARTICLE_SPRITE", { "1" });
+	DeclareDimension("PARTICLE_MESH", { "1" });
+}
+
+void FShaderPermutationDomain::DeclareDimension(const FName& MacroName, const TArray<FName>& Values)
+{
+	const int32 DimensionIndex = FindOrDeclareDimension(MacroName, static_cast<uint32>(Values.Num()));
+	if (DimensionIndex < 0)
+	{
+		return;
+	}
+
+	FShaderPermutationId Unused = 0;
+	for (const FName& Value : Values)
+	{
+		EncodeInto(Unused, MacroName, Value);
+	}
+}
+
+int32 FShaderPermutationDomain::FindOrDeclareDimension(const FName& MacroName, uint32 NumReservedValues)
+{
+	if (const int32* Found = DimensionIndexByName.Find(MacroName))
+	{
+		return *Found;
+	}
+
+	const uint32 BitCount = GetPermutationBitCount(NumReservedValues);
+	if (UsedBits + BitCount > 64)
+	{
+		UE_LOG("[error] ShaderPermutation: Out of permutation bits while declaring '%s'", MacroName.ToString().c_str());
+		return -1;
+	}
+
+	FDimension NewDimension;
+	NewDimension.MacroName = MacroName;
+	NewDimension.BitOffset = UsedBits;
+	NewDimension.BitCount = BitCount;
+	UsedBits += BitCount;
+
+	const int32 DimensionIndex = Dimensions.Add(NewDimension);
+	DimensionIndexByName.Add(MacroName, DimensionIndex);
+	return DimensionIndex;
+}
+
+bool FShaderPermutationDomain::EncodeInto(FShaderPermutationId& InOutId, const FName& MacroName, const FName& Value)
+{
+	const int32 DimensionIndex = FindOrDeclareDimension(MacroName, DefaultReservedPermutationValues);
+	if (DimensionIndex < 0)
 	{
-		UniqueMacroMap.Add(Macro.Name, Macro.Definition);
+		return false;
 	}
 
-	// 2. 안정적인(Stable) 해시를 위해 키를 정렬
-	TArray<FName> SortedNames;
-	SortedNames = UniqueMacroMap.GetKeys();
-	SortedNames.Sort([](const FName& A, const FName& B)
+	FDimension& Dimension = Dimensions[DimensionIndex];
+	int32 ValueIndex = Dimension.Values.Find(Value);
+	if (ValueIndex < 0)
+	{
+		// 비트 구간은 선언 시점에 고정되므로, 예약된 개수를 넘는 값은 표현할 수 없다.
+		if ((1ull << Dimension.BitCount) <= static_cast<uint64>(Dimension.Values.Num()) + 1)
 		{
-			return A.ComparisonIndex < B.ComparisonIndex;
-		});
+			UE_LOG("[error] ShaderPermutation: Too many values for '%s' (value '%s')", MacroName.ToString().c_str(), Value.ToString().c_str());
+			return false;
+		}
+		ValueIndex = Dimension.Values.Add(Value);
+	}
+
+	const uint64 FieldMask = ((1ull << Dimension.BitCount) - 1) << Dimension.BitOffset;
+	InOutId = (InOutId & ~FieldMask) | (static_cast<uint64>(ValueIndex + 1) << Dimension.BitOffset);
+	return true;
+}
+
+FShaderPermutationId FShaderPermutationDomain::Encode(const TArray<FShaderMacro>& InMacros)
+{
+	FShaderPermutationId PermutationId = 0;
+	for (const FShaderMacro& Macro : InMacros)
+	{
+		if (!EncodeInto(PermutationId, Macro.Name, Macro.Definition))
+		{
+			return INVALID_SHADER_PERMUTATION;
+		}
+	}
+	return PermutationId;
+}
+
+FShaderPermutationId FShaderPermutationDomain::Encode(const FName& MacroName, const FName& Value)
+{
+	FShaderPermutationId PermutationId = 0;
+	return EncodeInto(PermutationId, MacroName, Value) ? PermutationId : INVALID_SHADER_PERMUTATION;
+}
+
+TArray<FShaderMacro> FShaderPermutationDomain::Decode(FShaderPermutationId PermutationId) const
+{
+	TArray<FShaderMacro> Macros;
+	if (PermutationId == INVALID_SHADER_PERMUTATION)
+	{
+		return Macros;
+	}
 
-	// 3. FName의 해시를 조합하여 최종 키 해시 생성
-	// (FName의 GetTypeHash()는 내부적으로 정수 인덱스를 사용하므로 매우 빠릅니다.)
-	uint64 KeyHash = 0;
-	for (const FName& Name : SortedNames)
+	for (const FDimension& Dimension : Dimensions)
 	{
-		const FName& Definition = UniqueMacroMap[Name];
+		const uint64 ValueIndex = (PermutationId >> Dimension.BitOffset) & ((1ull << Dimension.BitCount) - 1);
+		if (ValueIndex != 0 && ValueIndex <= static_cast<uint64>(Dimension.Values.Num()))
+		{
+			Macros.Add(FShaderMacro{ Dimension.MacroName, Dimension.Values[static_cast<int32>(ValueIndex - 1)] });
+		}
+	}
+	return Macros;
+}
 
-		KeyHash = HashCombine(KeyHash, GetTypeHash(Name));
-		KeyHash = HashCombine(KeyHash, GetTypeHash(Definition));
+FShaderPermutationId FShaderPermutationDomain::Combine(FShaderPermutationId Base, FShaderPermutationId Override) const
+{
+	if (Base == INVALID_SHADER_PERMUTATION || Override == INVALID_SHADER_PERMUTATION)
+	{
+		return INVALID_SHADER_PERMUTATION;
 	}
 
-	return KeyHash;
+	for (const FDimension& Dimension : Dimensions)
+	{
+		const uint64 FieldMask = ((1ull << Dimension.BitCount) - 1) << Dimension.BitOffset;
+		if (Override & FieldMask)
+		{
+			Base &= ~FieldMask;
+		}
+	}
+	return Base | Override;
 }
 
+// ──────────────────────────────
+// UShader
+// ──────────────────────────────
+
 FString UShader::GenerateMacrosToString(const TArray<FShaderMacro>& InMacros)
 {
 	// 매크로 순서가 달라도 동일한 키를 생성하기 위해 정렬합니다.
@@ -138,17 +273,52 @@ void UShader::Load(const FString& InShaderPath, ID3D11Device* InDevice, const TA
 
 /**
  * @brief 외부(예: UMaterial)에서 특정 매크로 조합의 Variant를 요청할 때 사용합니다.
- * 1. 이 셰이더 객체(ActualFilePath)에 대해 해당 매크로 Variant가 이미 컴파일되었는지 확인합니다.
- * 2. 컴파일되지 않았다면, 즉시 컴파일하고 맵에 추가합니다.
- * 3. FShaderVariant*를 반환합니다. (컴파일 실패 시 nullptr)
+ * 매크로 배열을 Permutation ID로 변환한 뒤 ID 버전에 위임합니다.
+ * 매 프레임 호출되는 경로라면 ID를 미리 계산해 두고 ID 버전을 직접 호출하세요.
  *
- * @param InDevice D3D 디바이스
  * @param InMacros 컴파일(또는 검색)할 매크로 배열
  * @return FShaderVariant 포인터 (성공 시) 또는 nullptr (실패 시)
  */
 FShaderVariant* UShader::GetOrCompileShaderVariant(const TArray<FShaderMacro>& InMacros)
 {
-	ID3D11Device* InDevice = GEngine.GetRHIDevice()->GetDevice();
+	if (InMacros.IsEmpty())
+	{
+		return GetOrCompileShaderVariant(static_cast<FShaderPermutationId>(0));
+	}
+	return GetOrCompileShaderVariant(FShaderPermutationDomain::GetInstance().Encode(InMacros));
+}
+
+/**
+ * @brief Permutation ID에 해당하는 Variant를 반환합니다.
+ * 1. 작은 ID는 VariantTable 배열 인덱스로, 큰 ID는 맵으로 이미 컴파일된 Variant를 찾습니다.
+ * 2. 없다면 ID를 매크로 배열로 복원해 즉시 컴파일하고 추가합니다.
+ *
+ * @param PermutationId FShaderPermutationDomain이 만든 ID
+ * @return FShaderVariant 포인터 (성공 시) 또는 nullptr (실패 시)
+ */
+FShaderVariant* UShader::GetOrCompileShaderVariant(FShaderPermutationId PermutationId)
+{
+	// 1. 이미 컴파일된 Variant 조회 (드로우 경로)
+	if (PermutationId < static_cast<FShaderPermutationId>(VariantTable.Num()))
+	{
+		if (FShaderVariant* Found = VariantTable[static_cast<int32>(PermutationId)])
+		{
+			return Found;
+		}
+	}
+	else if (PermutationId >= MaxDirectPermutationId)
+	{
+		if (FShaderVariant* Found = ShaderVariantMap.Find(PermutationId))
+		{
+			return Found;
+		}
+	}
+
+	if (PermutationId == INVALID_SHADER_PERMUTATION)
+	{
+		UE_LOG("[error] GetOrCompileShaderVariant: Invalid permutation for '%s'", GetFilePath().c_str());
+		return nullptr;
+	}
 
 	// 이 UShader 객체가 어떤 파일인지 알아야 컴파일 가능
 	if (FilePath.empty())
@@ -157,34 +327,32 @@ FShaderVariant* UShader::GetOrCompileShaderVariant(const TArray<FShaderMacro>& I
 		return nullptr;
 	}
 
-	// 1. 매크로 배열을 기반으로 고유 키 생성
-	uint64 Key = GenerateShaderKey(InMacros);
-
-	// 2. 맵에 이미 컴파일된 Variant가 있는지 확인
-	if (FShaderVariant* Found = ShaderVariantMap.Find(Key))
-	{
-		return Found; // 찾았으면 즉시 반환
-	}
+	// 2. 없음 -> ID를 정규화된 매크로 배열로 복원해 새로 컴파일
+	ID3D11Device* InDevice = GEngine.GetRHIDevice()->GetDevice();
+	const TArray<FShaderMacro> Macros = FShaderPermutationDomain::GetInstance().Decode(PermutationId);
 
-	// 3. 맵에 없음 -> 새로 컴파일
 	FShaderVariant NewShaderVariant;
-	bool bSuccess = CompileVariantInternal(InDevice, FilePath, InMacros, NewShaderVariant);
+	bool bSuccess = CompileVariantInternal(InDevice, FilePath, Macros, NewShaderVariant);
 
 	if (bSuccess)
 	{
-		// 4. 맵에 추가하고, 새로 추가된 항목의 포인터(주소)를 반환
-		// TMap::Add()는 추가된 FShaderVariant의 레퍼런스를 포함하는 TPair를 반환합니다.
-		// .Value의 주소를 가져옵니다.
-		ShaderVariantMap.Add(Key, NewShaderVariant);
-		return &ShaderVariantMap[Key];
+		// 3. 맵에 추가하고, 작은 ID는 직접 조회 테이블에도 등록
+		ShaderVariantMap.Add(PermutationId, NewShaderVariant);
+		FShaderVariant* NewVariant = &ShaderVariantMap[PermutationId];
+		if (PermutationId < MaxDirectPermutationId)
+		{
+			const int32 TableIndex = static_cast<int32>(PermutationId);
+			if (VariantTable.Num() <= TableIndex)
+			{
+				VariantTable.SetNum(TableIndex + 1, nullptr);
+			}
+			VariantTable[TableIndex] = NewVariant;
+		}
+		return NewVariant;
 	}
 
-	// 5. 컴파일 실패
-	UE_LOG("[error] GetOrCompileShaderVariant: Failed to compile '%s' variant for key '%s'", GetFilePath().c_str(), GenerateMacrosToString(InMacros).c_str());
-
-	// 컴파일에 실패했더라도, 향후 동일한 요청이 왔을 때
-	// 다시 컴파일을 시도하지 않도록 '비어있는' Variant를 맵에 추가할 수 있습니다.
-	// ShaderVariantMap.Add(Key, NewShaderVariant); // (선택적)
+	// 4. 컴파일 실패
+	UE_LOG("[error] GetOrCompileShaderVariant: Failed to compile '%s' variant for key '%s'", GetFilePath().c_str(), GenerateMacrosToString(Macros).c_str());
 
 	return nullptr;
 }
@@ -285,12 +453,6 @@ bool UShader::CompileVariantInternal(ID3D11Device* InDevice, const FString& InSh
 	return bVsCompiled || bPsCompiled;
 }
 
-//FShaderVariant* UShader::GetShaderVariant(const TArray<FShaderMacro>& InMacros)
-//{
-//	FString Key = GenerateShaderKey(InMacros);
-//	return ShaderVariantMap.Find(Key);
-//}
-
 ID3D11InputLayout* UShader::GetInputLayout(const TArray<FShaderMacro>& InMacros)
 {
 	FShaderVariant* Variant = GetOrCompileShaderVariant(InMacros);
@@ -376,6 +538,25 @@ void UShader::ReleaseResources()
 		Pair.second.Release(); // FShaderVariant::Release() 호출
 	}
 	ShaderVariantMap.Empty();
+	VariantTable.Empty();
+}
+
+// ShaderVariantMap의 내용으로 직접 조회 테이블을 다시 채웁니다. (맵이 통째로 교체된 뒤 호출)
+void UShader::RebuildVariantTable()
+{
+	VariantTable.Empty();
+	for (auto& Pair : ShaderVariantMap)
+	{
+		if (Pair.first < MaxDirectPermutationId)
+		{
+			const int32 TableIndex = static_cast<int32>(Pair.first);
+			if (VariantTable.Num() <= TableIndex)
+			{
+				VariantTable.SetNum(TableIndex + 1, nullptr);
+			}
+			VariantTable[TableIndex] = &Pair.second;
+		}
+	}
 }
 
 bool UShader::IsOutdated() const
@@ -453,14 +634,17 @@ bool UShader::Reload(ID3D11Device* InDevice)
 
 	// 2. [백업] 현재 맵을 Old 맵으로 이동시킵니다.
 	// (ShaderVariantMap은 이제 비어있습니다)
-	TMap<uint64, FShaderVariant> OldShaderVariantMap = std::move(ShaderVariantMap);
+	// 직접 조회 테이블은 Old 맵을 가리키므로 함께 비워야 새로 컴파일됩니다.
+	TMap<FShaderPermutationId, FShaderVariant> OldShaderVariantMap = std::move(ShaderVariantMap);
+	ShaderVariantMap.Empty();
+	VariantTable.Empty();
 
 	bool bAllReloadsSuccessful = true;
 
 	// 3. [재시도] Old 맵에 있던 모든 Variant에 대해 Load를 다시 호출합니다.
 	for (auto& Pair : OldShaderVariantMap)
 	{
-		const uint64 Key = Pair.first;
+		const FShaderPermutationId Key = Pair.first;
 		const TArray<FShaderMacro>& MacrosToReload = Pair.second.SourceMacros;
 
 		// Load() 함수는 (이제 비어있는) ShaderVariantMap에
@@ -504,6 +688,7 @@ bool UShader::Reload(ID3D11Device* InDevice)
 			Pair.second.Release();
 		}
 		OldShaderVariantMap.Empty();
+		RebuildVariantTable();
 
 		// 갱신된 타임스탬프를 설정합니다.
 		try
@@ -527,6 +712,7 @@ bool UShader::Reload(ID3D11Device* InDevice)
 
 		// Old 맵(정상 작동하던)을 현재 맵으로 복원합니다.
 		ShaderVariantMap = std::move(OldShaderVariantMap);
+		RebuildVariantTable();
 
 		return false;
 	}
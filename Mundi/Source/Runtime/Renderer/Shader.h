@@ -14,6 +14,55 @@ struct FShaderMacro
 	}
 };
 
+// 셰이더 Permutation ID
+// 매크로 하나가 하나의 차원이 되고, 각 차원은 ID 안의 고정된 비트 구간에 '값 인덱스'를 저장한다. (0 = 매크로 미정의)
+// 매크로 배열 → ID 변환은 캐시를 만들 때 한 번만 하고, 드로우 경로에서는 ID로 바로 Variant를 찾는다.
+using FShaderPermutationId = uint64;
+constexpr FShaderPermutationId INVALID_SHADER_PERMUTATION = ~0ull;
+
+/**
+ * @class FShaderPermutationDomain
+ * @brief 엔진 전역 Permutation 차원 목록. 차원(비트 구간)은 모든 셰이더가 공유하므로
+ * View/머티리얼/스키닝처럼 서로 다른 곳에서 만든 ID를 Combine으로 합칠 수 있다.
+ */
+class FShaderPermutationDomain
+{
+public:
+	static FShaderPermutationDomain& GetInstance();
+
+	// 매크로가 가질 수 있는 값을 미리 선언한다. 값 개수에 맞춰 비트 폭이 정해진다.
+	void DeclareDimension(const FName& MacroName, const TArray<FName>& Values);
+
+	// 매크로 배열 → ID. 선언되지 않은 매크로는 기본 비트 폭으로 자동 선언된다.
+	// 같은 매크로가 여러 번 나오면 뒤의 값이 우선한다. 표현할 수 없으면 INVALID_SHADER_PERMUTATION.
+	FShaderPermutationId Encode(const TArray<FShaderMacro>& InMacros);
+	FShaderPermutationId Encode(const FName& MacroName, const FName& Value);
+
+	// ID → 매크로 배열 (차원 선언 순서의 정규형)
+	TArray<FShaderMacro> Decode(FShaderPermutationId PermutationId) const;
+
+	// Base 위에 Override를 덮어쓴 ID. Override에서 정의된 차원은 Base의 값을 대체한다.
+	FShaderPermutationId Combine(FShaderPermutationId Base, FShaderPermutationId Override) const;
+
+private:
+	FShaderPermutationDomain();
+
+	struct FDimension
+	{
+		FName MacroName;
+		TArray<FName> Values;	// Values[i]의 값 인덱스는 i + 1
+		uint32 BitOffset = 0;
+		uint32 BitCount = 0;
+	};
+
+	int32 FindOrDeclareDimension(const FName& MacroName, uint32 NumReservedValues);
+	bool EncodeInto(FShaderPermutationId& InOutId, const FName& MacroName, const FName& Value);
+
+	TArray<FDimension> Dimensions;
+	TMap<FName, int32> DimensionIndexByName;
+	uint32 UsedBits = 0;
+};
+
 // 단일 셰이더 파일의 여러 변형 중 하나
 struct FShaderVariant
 {
@@ -42,12 +91,13 @@ class UShader : public UResourceBase
 public:
 	DECLARE_CLASS(UShader, UResourceBase)
 
-	static uint64 GenerateShaderKey(const TArray<FShaderMacro>& InMacros);
 	static FString GenerateMacrosToString(const TArray<FShaderMacro>& InMacros);	// UI 출력 or 디버깅용
 
 	void Load(const FString& ShaderPath, ID3D11Device* InDevice, const TArray<FShaderMacro>& InMacros = TArray<FShaderMacro>());
 
 	FShaderVariant* GetOrCompileShaderVariant(const TArray<FShaderMacro>& InMacros = TArray<FShaderMacro>());
+	// 드로우 경로용. 미리 계산해 둔 Permutation ID로 Variant를 조회한다.
+	FShaderVariant* GetOrCompileShaderVariant(FShaderPermutationId PermutationId);
 	bool CompileVariantInternal(ID3D11Device* InDevice, const FString& InShaderPath, const TArray<FShaderMacro>& InMacros, FShaderVariant& OutVariant);
 	//FShaderVariant* GetShaderVariant(const TArray<FShaderMacro>& InMacros = TArray<FShaderMacro>());
 	ID3D11InputLayout* GetInputLayout(const TArray<FShaderMacro>& InMacros = TArray<FShaderMacro>());
@@ -63,7 +113,11 @@ protected:
 	virtual ~UShader();
 
 private:
-	TMap<uint64, FShaderVariant> ShaderVariantMap;
+	// 이 값보다 작은 ID는 VariantTable 배열 인덱스로 바로 조회하고, 큰 ID만 맵을 탄다.
+	static constexpr FShaderPermutationId MaxDirectPermutationId = 4096;
+
+	TMap<FShaderPermutationId, FShaderVariant> ShaderVariantMap;
+	TArray<FShaderVariant*> VariantTable;	// ShaderVariantMap 원소를 가리킨다 (TMap 원소는 청크 저장소에 있어 주소가 고정)
 
 	// Store included files (e.g., "Shaders/Common/LightingCommon.hlsl")
 	// Used for hot reload - if any included file changes, reload this shader
@@ -72,6 +126,7 @@ private:
 
 	void CreateInputLayout(ID3D11Device* Device, const FString& InShaderPath, FShaderVariant& InOutVariant, const TArray<FShaderMacro>& InMacros);
 	void ReleaseResources();
+	void RebuildVariantTable();
 
 	// Include 파일 파싱 및 추적
 	void ParseIncludeFiles(const FString& ShaderPath);
@@ -0,0 +1,159 @@
+﻿#include "pch.h"
+#include "ShadowAtlasAllocator.h"
+
+void FShadowAtlasAllocator::Initialize(uint32 InAtlasSize, uint32 InMinBlockSize)
+{
+	AtlasSize = InAtlasSize;
+
+	// 최소 블록 크기까지 몇 번 4분할 할 수 있는지 계산
+	MaxLevel = 0;
+	uint32 BlockSize = AtlasSize;
+	while (BlockSize > InMinBlockSize && BlockSize % 2 == 0)
+	{
+		BlockSize >>= 1;
+		++MaxLevel;
+	}
+
+	Reset();
+}
+
+void FShadowAtlasAllocator::Reset()
+{
+	FreeBlocks.Empty();
+	FreeBlocks.SetNum(MaxLevel + 1);
+	if (AtlasSize > 0)
+	{
+		FreeBlocks[0].Add(PackKey(0, 0));
+	}
+}
+
+bool FShadowAtlasAllocator::PopFreeBlock(int32 Level, uint64& OutKey)
+{
+	TArray<uint64>& Blocks = FreeBlocks[Level];
+	if (Blocks.IsEmpty())
+	{
+		return false;
+	}
+
+	int32 BestIndex = 0;
+	for (int32 i = 1; i < Blocks.Num(); ++i)
+	{
+		const uint32 BestX = static_cast<uint32>(Blocks[BestIndex] >> 32), BestY = static_cast<uint32>(Blocks[BestIndex]);
+		const uint32 X = static_cast<uint32>(Blocks[i] >> 32), Y = static_cast<uint32>(Blocks[i]);
+		if (Y < BestY || (Y == BestY && X < BestX))
+		{
+			BestIndex = i;
+		}
+	}
+
+	OutKey = Blocks[BestIndex];
+	Blocks.RemoveAtSwap(BestIndex);
+	return true;
+}
+
+bool FShadowAtlasAllocator::Allocate(uint32 InSize, FShadowAtlasRegion& OutRegion)
+{
+	OutRegion = FShadowAtlasRegion();
+	if (InSize == 0 || InSize > AtlasSize)
+	{
+		return false;
+	}
+
+	// 1. 요청을 담을 수 있는 가장 깊은(작은) 레벨 찾기
+	int32 TargetLevel = 0;
+	while (TargetLevel < MaxLevel && GetBlockSize(TargetLevel + 1) >= InSize)
+	{
+		++TargetLevel;
+	}
+
+	// 2. 목표 레벨부터 위로 올라가며 빈 블록 탐색
+	int32 FoundLevel = TargetLevel;
+	uint64 Key = 0;
+	while (FoundLevel >= 0 && !PopFreeBlock(FoundLevel, Key))
+	{
+		--FoundLevel;
+	}
+	if (FoundLevel < 0)
+	{
+		return false; // 아틀라스가 가득 참
+	}
+
+	// 3. 목표 레벨까지 블록을 4분할. 첫 번째 자식을 계속 내려가며 쓰고 나머지 셋은 빈 목록에 반납
+	while (FoundLevel < TargetLevel)
+	{
+		const uint32 X = static_cast<uint32>(Key >> 32);
+		const uint32 Y = static_cast<uint32>(Key);
+		const uint32 Half = GetBlockSize(FoundLevel + 1);
+
+		FreeBlocks[FoundLevel + 1].Add(PackKey(X + Half, Y));
+		FreeBlocks[FoundLevel + 1].Add(PackKey(X, Y + Half));
+		FreeBlocks[FoundLevel + 1].Add(PackKey(X + Half, Y + Half));
+
+		++FoundLevel;
+	}
+
+	OutRegion.X = static_cast<uint32>(Key >> 32);
+	OutRegion.Y = static_cast<uint32>(Key);
+	OutRegion.BlockSize = GetBlockSize(TargetLevel);
+	OutRegion.Level = TargetLevel;
+	return true;
+}
+
+void FShadowAtlasAllocator::Free(const FShadowAtlasRegion& InRegion)
+{
+	if (!InRegion.IsValid() || InRegion.Level > MaxLevel)
+	{
+		return;
+	}
+
+	uint32 X = InRegion.X;
+	uint32 Y = InRegion.Y;
+	int32 Level = InRegion.Level;
+
+	// 형제 블록 4개가 모두 비어 있으면 부모로 병합 (레벨 0까지 반복)
+	while (Level > 0)
+	{
+		const uint32 ParentSize = GetBlockSize(Level - 1);
+		const uint32 Half = GetBlockSize(Level);
+		const uint32 ParentX = X - (X % ParentSize);
+		const uint32 ParentY = Y - (Y % ParentSize);
+
+		const uint64 Siblings[4] = {
+			PackKey(ParentX, ParentY),
+			PackKey(ParentX + Half, ParentY),
+			PackKey(ParentX, ParentY + Half),
+			PackKey(ParentX + Half, ParentY + Half)
+		};
+
+		TArray<uint64>& Blocks = FreeBlocks[Level];
+		const uint64 Self = PackKey(X, Y);
+		bool bAllSiblingsFree = true;
+		for (uint64 Sibling : Siblings)
+		{
+			if (Sibling != Self && !Blocks.Contains(Sibling))
+			{
+				bAllSiblingsFree = false;
+				break;
+			}
+		}
+
+		if (!bAllSiblingsFree)
+		{
+			break;
+		}
+
+		for (uint64 Sibling : Siblings)
+		{
+			if (Sibling != Self)
+			{
+				Blocks.RemoveAtSwap(Blocks.Find(Sibling));
+			}
+		}
+
+		X = ParentX;
+		Y = ParentY;
+		--Level;
+	}
+
+	FreeBlocks[Level].Add(PackKey(X, Y));
+}
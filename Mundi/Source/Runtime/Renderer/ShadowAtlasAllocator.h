@@ -0,0 +1,48 @@
+﻿#pragma once
+#include "UEContainer.h"
+
+// 2D 섀도우 아틀라스 안에서 하나의 섀도우 뷰가 차지하는 영역
+struct FShadowAtlasRegion
+{
+	uint32 X = 0;
+	uint32 Y = 0;
+	uint32 BlockSize = 0;	// 실제로 예약된 블록 크기 (2의 거듭제곱)
+	int32 Level = -1;		// 쿼드트리 레벨 (0 = 아틀라스 전체)
+
+	bool IsValid() const { return Level >= 0; }
+};
+
+/**
+ * @class FShadowAtlasAllocator
+ * @brief 쿼드트리(버디) 방식의 2D 섀도우 아틀라스 할당기.
+ *
+ * 매 프레임 Shelf 패킹을 처음부터 다시 하는 대신 할당을 프레임 간에 유지합니다.
+ * 해제된 블록은 형제 4개가 모두 비면 부모 블록으로 병합되므로,
+ * 한 라이트의 해상도가 바뀌어도 다른 라이트의 영역은 움직이지 않습니다.
+ */
+class FShadowAtlasAllocator
+{
+public:
+	void Initialize(uint32 InAtlasSize, uint32 InMinBlockSize = 128);
+	void Reset();
+
+	// 요청 크기를 담을 수 있는 가장 작은 블록을 할당합니다. 실패 시 false.
+	bool Allocate(uint32 InSize, FShadowAtlasRegion& OutRegion);
+	void Free(const FShadowAtlasRegion& InRegion);
+
+	uint32 GetAtlasSize() const { return AtlasSize; }
+
+private:
+	static uint64 PackKey(uint32 X, uint32 Y) { return (static_cast<uint64>(X) << 32) | Y; }
+	uint32 GetBlockSize(int32 Level) const { return AtlasSize >> Level; }
+
+	// 레벨 Level의 빈 블록 중 (Y, X)가 가장 작은 블록을 꺼냅니다. (아틀라스 좌상단부터 채움)
+	bool PopFreeBlock(int32 Level, uint64& OutKey);
+
+private:
+	uint32 AtlasSize = 0;
+	int32 MaxLevel = 0;
+
+	// 레벨별 빈 블록 목록 (Key = X << 32 | Y)
+	TArray<TArray<uint64>> FreeBlocks;
+};
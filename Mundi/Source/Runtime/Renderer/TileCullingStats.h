@@ -1,7 +1,7 @@
 ﻿#pragma once
 #include "UEContainer.h"
 
-// 타일 기반 라이트 컬링 통계
+// 타일/클러스터 기반 라이트 컬링 통계
 // 성능 메트릭과 컬링 효율성을 추적
 struct FTileCullingStats
 {
@@ -9,24 +9,27 @@ struct FTileCullingStats
 	uint32 TileCountX = 0;
 	uint32 TileCountY = 0;
 	uint32 TotalTileCount = 0;
+	uint32 DepthSliceCount = 0;
+	uint32 TotalClusterCount = 0;	// 타일 수 x 깊이 슬라이스 수
 
 	// 라이트 개수
 	uint32 TotalPointLights = 0;
 	uint32 TotalSpotLights = 0;
 	uint32 TotalLights = 0;
 
-	// 타일당 라이트 통계
+	// 클러스터당 라이트 통계 (깊이 슬라이스가 없으면 타일당)
 	uint32 MinLightsPerTile = 0;
 	uint32 MaxLightsPerTile = 0;
 	float AvgLightsPerTile = 0.0f;
 
 	// 컬링 효율성 메트릭
-	float CullingEfficiency = 0.0f; // 컬링된 라이트 비율 (%)
-	uint32 TotalLightTests = 0;     // 전체 라이트-타일 테스트 수
-	uint32 TotalLightsPassed = 0;   // 컬링을 통과한 라이트 수
+	float CullingEfficiency = 0.0f; // 모든 클러스터 x 모든 라이트 조합 중 컬링된 비율 (%)
+	uint32 TotalLightTests = 0;     // 실제로 수행한 라이트-클러스터 테스트 수
+	uint32 TotalLightsPassed = 0;   // 컬링을 통과한 라이트-클러스터 쌍 수
 
 	// 성능 메트릭
 	float ComputeShaderTimeMS = 0.0f;
+	float CullingTimeMS = 0.0f;		// CPU 컬링 + 목록 구성 시간
 	uint32 LightIndexBufferSizeBytes = 0;
 
 	// 시각화 모드
@@ -47,6 +50,8 @@ struct FTileCullingStats
 		TileCountX = 0;
 		TileCountY = 0;
 		TotalTileCount = 0;
+		DepthSliceCount = 0;
+		TotalClusterCount = 0;
 		TotalPointLights = 0;
 		TotalSpotLights = 0;
 		TotalLights = 0;
@@ -57,6 +62,7 @@ struct FTileCullingStats
 		TotalLightTests = 0;
 		TotalLightsPassed = 0;
 		ComputeShaderTimeMS = 0.0f;
+		CullingTimeMS = 0.0f;
 		LightIndexBufferSizeBytes = 0;
 	}
 
@@ -66,15 +72,19 @@ struct FTileCullingStats
 		TotalLights = TotalPointLights + TotalSpotLights;
 		TotalTileCount = TileCountX * TileCountY;
 
-		if (TotalTileCount > 0)
+		const uint32 CellCount = TotalClusterCount > 0 ? TotalClusterCount : TotalTileCount;
+
+		if (CellCount > 0)
 		{
-			AvgLightsPerTile = static_cast<float>(TotalLightsPassed) / static_cast<float>(TotalTileCount);
+			AvgLightsPerTile = static_cast<float>(TotalLightsPassed) / static_cast<float>(CellCount);
 		}
 
-		if (TotalLightTests > 0)
+		// 클러스터 컬링은 겹치는 범위만 테스트하므로, 테스트 수가 아닌 전체 조합 기준으로 비율 계산
+		const uint64 AllPairs = static_cast<uint64>(CellCount) * TotalLights;
+		if (AllPairs > 0)
 		{
-			uint32 LightsCulled = TotalLightTests - TotalLightsPassed;
-			CullingEfficiency = (static_cast<float>(LightsCulled) / static_cast<float>(TotalLightTests)) * 100.0f;
+			const uint64 PairsCulled = AllPairs - TotalLightsPassed;
+			CullingEfficiency = (static_cast<float>(PairsCulled) / static_cast<float>(AllPairs)) * 100.0f;
 		}
 	}
 };
@@ -0,0 +1,225 @@
+﻿#include "pch.h"
+#include "TileDecalCuller.h"
+#include <algorithm>
+
+FTileDecalCuller::FTileDecalCuller()
+	: RHI(nullptr)
+	, TileSize(16)
+	, TileCountX(0)
+	, TileCountY(0)
+	, OverflowCount(0)
+	, TileDecalIndexBuffer(nullptr)
+	, TileDecalIndexSRV(nullptr)
+	, TileDecalIndexCapacity(0)
+	, DecalInfoBuffer(nullptr)
+	, DecalInfoSRV(nullptr)
+	, DecalInfoCapacity(0)
+{
+}
+
+FTileDecalCuller::~FTileDecalCuller()
+{
+	Release();
+}
+
+void FTileDecalCuller::Initialize(D3D11RHI* InRHI, UINT InTileSize)
+{
+	RHI = InRHI;
+	TileSize = InTileSize;
+}
+
+void FTileDecalCuller::CullDecals(
+	const TArray<FDecalInfo>& Decals,
+	const TArray<FOBB>& DecalVolumes,
+	const FMatrix& ViewMatrix,
+	const FMatrix& ProjMatrix,
+	UINT ViewportWidth,
+	UINT ViewportHeight)
+{
+	// 타일 그리드 계산 (FClusteredLightCuller와 같은 그리드)
+	TileCountX = (ViewportWidth + TileSize - 1) / TileSize;
+	TileCountY = (ViewportHeight + TileSize - 1) / TileSize;
+	const UINT TotalTileCount = TileCountX * TileCountY;
+	OverflowCount = 0;
+
+	const UINT RequiredSize = TotalTileCount * MaxDecalsPerTile;
+	if (TileDecalIndices.Num() != static_cast<int32>(RequiredSize))
+	{
+		TileDecalIndices.SetNum(RequiredSize);
+	}
+	memset(TileDecalIndices.GetData(), 0, RequiredSize * sizeof(uint32));
+
+	const FMatrix ViewProj = ViewMatrix * ProjMatrix;
+
+	// 데칼마다 덮는 타일에만 인덱스 추가 (비용 = 데칼 수 x 덮는 타일 수)
+	// 데칼 순서대로 추가되므로 타일 목록도 데칼 순서를 유지하고, 셰이더의 알파 합성 순서가 기존 패스와 같다
+	for (int32 DecalIndex = 0; DecalIndex < Decals.Num(); ++DecalIndex)
+	{
+		UINT MinX, MinY, MaxX, MaxY;
+		if (!ComputeTileRect(DecalVolumes[DecalIndex], ViewProj, MinX, MinY, MaxX, MaxY))
+		{
+			continue;
+		}
+
+		for (UINT TileY = MinY; TileY <= MaxY; ++TileY)
+		{
+			for (UINT TileX = MinX; TileX <= MaxX; ++TileX)
+			{
+				uint32* Tile = TileDecalIndices.GetData() + (TileY * TileCountX + TileX) * MaxDecalsPerTile;
+				if (Tile[0] >= MaxDecalsPerTile - 1)
+				{
+					++OverflowCount;
+					continue;
+				}
+				Tile[1 + Tile[0]] = static_cast<uint32>(DecalIndex);
+				++Tile[0];
+			}
+		}
+	}
+
+	UploadStructuredBuffer(TileDecalIndexBuffer, TileDecalIndexSRV, TileDecalIndexCapacity,
+		sizeof(uint32), RequiredSize, TileDecalIndices.GetData());
+
+	if (Decals.Num() > 0)
+	{
+		UploadStructuredBuffer(DecalInfoBuffer, DecalInfoSRV, DecalInfoCapacity,
+			sizeof(FDecalInfo), static_cast<UINT>(Decals.Num()), Decals.GetData());
+	}
+}
+
+bool FTileDecalCuller::ComputeTileRect(const FOBB& Volume, const FMatrix& ViewProj, UINT& OutMinX, UINT& OutMinY, UINT& OutMaxX, UINT& OutMaxY) const
+{
+	if (TileCountX == 0 || TileCountY == 0)
+	{
+		return false;
+	}
+
+	const FVector AxisX = Volume.Axes[0] * Volume.HalfExtent.X;
+	const FVector AxisY = Volume.Axes[1] * Volume.HalfExtent.Y;
+	const FVector AxisZ = Volume.Axes[2] * Volume.HalfExtent.Z;
+
+	float NDCMinX = FLT_MAX, NDCMinY = FLT_MAX;
+	float NDCMaxX = -FLT_MAX, NDCMaxY = -FLT_MAX;
+	bool bCrossesNearPlane = false;
+
+	for (int32 Corner = 0; Corner < 8; ++Corner)
+	{
+		const FVector Point = Volume.Center
+			+ ((Corner & 1) ? AxisX : -AxisX)
+			+ ((Corner & 2) ? AxisY : -AxisY)
+			+ ((Corner & 4) ? AxisZ : -AxisZ);
+
+		const FVector4 Clip = FVector4(Point.X, Point.Y, Point.Z, 1.0f) * ViewProj;
+
+		// 카메라 뒤쪽 코너가 있으면 투영 사각형을 믿을 수 없으므로 화면 전체로 보수적으로 처리
+		if (Clip.W <= KINDA_SMALL_NUMBER)
+		{
+			bCrossesNearPlane = true;
+			break;
+		}
+
+		const float InvW = 1.0f / Clip.W;
+		NDCMinX = std::min(NDCMinX, Clip.X * InvW);
+		NDCMaxX = std::max(NDCMaxX, Clip.X * InvW);
+		NDCMinY = std::min(NDCMinY, Clip.Y * InvW);
+		NDCMaxY = std::max(NDCMaxY, Clip.Y * InvW);
+	}
+
+	if (bCrossesNearPlane)
+	{
+		OutMinX = 0;
+		OutMinY = 0;
+		OutMaxX = TileCountX - 1;
+		OutMaxY = TileCountY - 1;
+		return true;
+	}
+
+	// 화면 밖
+	if (NDCMaxX < -1.0f || NDCMinX > 1.0f || NDCMaxY < -1.0f || NDCMinY > 1.0f)
+	{
+		return false;
+	}
+
+	// NDC -> 픽셀 -> 타일 (DirectX는 화면 Y축이 아래로 증가하므로 Y 반전)
+	const float ViewportWidth = static_cast<float>(TileCountX * TileSize);
+	const float ViewportHeight = static_cast<float>(TileCountY * TileSize);
+
+	const auto ToTile = [this](float Pixel, UINT TileCount)
+	{
+		const int32 Tile = static_cast<int32>(Pixel) / static_cast<int32>(TileSize);
+		return static_cast<UINT>(std::clamp(Tile, 0, static_cast<int32>(TileCount) - 1));
+	};
+
+	const float PixelMinX = (std::max(NDCMinX, -1.0f) * 0.5f + 0.5f) * ViewportWidth;
+	const float PixelMaxX = (std::min(NDCMaxX, 1.0f) * 0.5f + 0.5f) * ViewportWidth;
+	const float PixelMinY = (0.5f - std::min(NDCMaxY, 1.0f) * 0.5f) * ViewportHeight;
+	const float PixelMaxY = (0.5f - std::max(NDCMinY, -1.0f) * 0.5f) * ViewportHeight;
+
+	OutMinX = ToTile(PixelMinX, TileCountX);
+	OutMaxX = ToTile(PixelMaxX, TileCountX);
+	OutMinY = ToTile(PixelMinY, TileCountY);
+	OutMaxY = ToTile(PixelMaxY, TileCountY);
+	return true;
+}
+
+void FTileDecalCuller::UploadStructuredBuffer(ID3D11Buffer*& Buffer, ID3D11ShaderResourceView*& SRV, UINT& Capacity,
+	UINT ElementSize, UINT ElementCount, const void* Data)
+{
+	if (!RHI || ElementCount == 0)
+	{
+		return;
+	}
+
+	if (!Buffer || Capacity < ElementCount)
+	{
+		if (SRV)
+		{
+			SRV->Release();
+			SRV = nullptr;
+		}
+		if (Buffer)
+		{
+			Buffer->Release();
+			Buffer = nullptr;
+		}
+
+		// 데칼 개수가 조금씩 늘어날 때마다 다시 만들지 않도록 여유 있게 확보
+		Capacity = std::max(ElementCount, Capacity * 2);
+		if (FAILED(RHI->CreateStructuredBuffer(ElementSize, Capacity, nullptr, &Buffer)))
+		{
+			Capacity = 0;
+			return;
+		}
+		RHI->CreateStructuredBufferSRV(Buffer, &SRV);
+	}
+
+	RHI->UpdateStructuredBuffer(Buffer, Data, ElementSize * ElementCount);
+}
+
+void FTileDecalCuller::Release()
+{
+	if (TileDecalIndexSRV)
+	{
+		TileDecalIndexSRV->Release();
+		TileDecalIndexSRV = nullptr;
+	}
+	if (TileDecalIndexBuffer)
+	{
+		TileDecalIndexBuffer->Release();
+		TileDecalIndexBuffer = nullptr;
+	}
+	if (DecalInfoSRV)
+	{
+		DecalInfoSRV->Release();
+		DecalInfoSRV = nullptr;
+	}
+	if (DecalInfoBuffer)
+	{
+		DecalInfoBuffer->Release();
+		DecalInfoBuffer = nullptr;
+	}
+
+	TileDecalIndexCapacity = 0;
+	DecalInfoCapacity = 0;
+	TileDecalIndices.Empty();
+}
@@ -0,0 +1,81 @@
+﻿#pragma once
+#include "D3D11RHI.h"
+#include "OBB.h"
+
+// 데칼 하나의 GPU 데이터 (Decal.hlsl의 FDecalInfo와 레이아웃 일치)
+struct FDecalInfo
+{
+	FMatrix DecalMatrix;	// 월드 -> 데칼 투영 공간
+	float Opacity;
+	uint32 TextureSlot;		// 이번 패스에 바인딩된 데칼 텍스처 배열(t14~) 인덱스
+	FVector2D Padding;
+};
+static_assert(sizeof(FDecalInfo) == 80, "FDecalInfo must match Decal.hlsl layout");
+
+// 데칼을 화면 타일에 분류(binning)하는 클래스
+// FClusteredLightCuller와 같은 타일 그리드(깊이 슬라이스 없이 타일당 고정 크기 목록)를 사용하지만,
+// 타일마다 모든 데칼을 검사하지 않고 데칼 OBB를 화면에 투영한 사각형이 덮는 타일에만 추가한다.
+// 셰이더는 픽셀이 속한 타일의 데칼 목록만 순회하므로 리시버 메시는 한 번만 그리면 된다.
+class FTileDecalCuller
+{
+public:
+	// 타일당 최대 데칼 개수 (첫 원소는 개수, 나머지는 데칼 인덱스)
+	static constexpr UINT MaxDecalsPerTile = 64;
+
+	// 한 번의 패스에서 바인딩할 수 있는 서로 다른 데칼 텍스처 개수 (Decal.hlsl의 MAX_DECAL_TEXTURES와 일치)
+	static constexpr UINT MaxDecalTextures = 8;
+
+	FTileDecalCuller();
+	~FTileDecalCuller();
+
+	void Initialize(D3D11RHI* InRHI, UINT InTileSize = 16);
+
+	// Decals[i]의 투영 볼륨이 DecalVolumes[i]
+	// 결과는 타일 인덱스 버퍼와 데칼 정보 버퍼에 업로드된다
+	void CullDecals(
+		const TArray<FDecalInfo>& Decals,
+		const TArray<FOBB>& DecalVolumes,
+		const FMatrix& ViewMatrix,
+		const FMatrix& ProjMatrix,
+		UINT ViewportWidth,
+		UINT ViewportHeight
+	);
+
+	ID3D11ShaderResourceView* GetTileDecalIndexSRV() const { return TileDecalIndexSRV; }
+	ID3D11ShaderResourceView* GetDecalInfoSRV() const { return DecalInfoSRV; }
+
+	// 마지막 CullDecals에서 타일 용량 초과로 빠진 (데칼, 타일) 쌍 개수
+	uint32 GetOverflowCount() const { return OverflowCount; }
+
+	void Release();
+
+private:
+	// OBB의 화면 타일 범위 계산 (화면 밖이면 false)
+	bool ComputeTileRect(const FOBB& Volume, const FMatrix& ViewProj, UINT& OutMinX, UINT& OutMinY, UINT& OutMaxX, UINT& OutMaxY) const;
+
+	// 필요한 크기보다 작으면 버퍼를 다시 만들고 데이터 업로드
+	void UploadStructuredBuffer(ID3D11Buffer*& Buffer, ID3D11ShaderResourceView*& SRV, UINT& Capacity,
+		UINT ElementSize, UINT ElementCount, const void* Data);
+
+private:
+	D3D11RHI* RHI;
+
+	UINT TileSize;
+	UINT TileCountX;
+	UINT TileCountY;
+
+	// [TileIndex * MaxDecalsPerTile] = 데칼 개수
+	// [TileIndex * MaxDecalsPerTile + 1 ~ ...] = 데칼 인덱스
+	TArray<uint32> TileDecalIndices;
+
+	uint32 OverflowCount;
+
+	// GPU 리소스
+	ID3D11Buffer* TileDecalIndexBuffer;
+	ID3D11ShaderResourceView* TileDecalIndexSRV;
+	UINT TileDecalIndexCapacity;
+
+	ID3D11Buffer* DecalInfoBuffer;
+	ID3D11ShaderResourceView* DecalInfoSRV;
+	UINT DecalInfoCapacity;
+};
@@ -5,14 +5,86 @@ IMPLEMENT_CLASS(UGlobalConsole)
 
 UConsoleWidget* UGlobalConsole::ConsoleWidget = nullptr;
 
+namespace
+{
+    // 로그 스레드에서 받은 줄을 메인 스레드가 가져갈 때까지 보관하는 싱크
+    class FConsoleWidgetLogSink : public ILogSink
+    {
+    public:
+        FConsoleWidgetLogSink()
+        {
+            PendingLines.SetNum(MaxPendingLines);
+        }
+
+        void Write(const FLogLine& Line) override
+        {
+            FString Text = Line.Text;
+            // 콘솔 위젯의 색상 구분을 위해 태그가 없는 경고/에러에 태그를 붙임
+            if (Line.Verbosity <= ELogVerbosity::Error && Text.find("[error]") == FString::npos)
+            {
+                Text = "[error] " + Text;
+            }
+            else if (Line.Verbosity == ELogVerbosity::Warning && Text.find("[warning]") == FString::npos)
+            {
+                Text = "[warning] " + Text;
+            }
+
+            std::lock_guard<std::mutex> Lock(PendingMutex);
+            PendingLines[(PendingHead + PendingCount) % MaxPendingLines] = std::move(Text);
+            if (PendingCount == MaxPendingLines)
+            {
+                // 위젯이 없는 동안 무한히 쌓이지 않도록 가장 오래된 줄을 덮어씀
+                PendingHead = (PendingHead + 1) % MaxPendingLines;
+            }
+            else
+            {
+                ++PendingCount;
+            }
+        }
+
+        void TakePendingLines(TArray<FString>& OutLines)
+        {
+            std::lock_guard<std::mutex> Lock(PendingMutex);
+            OutLines.Empty();
+            OutLines.Reserve(PendingCount);
+            for (int32 Index = 0; Index < PendingCount; ++Index)
+            {
+                OutLines.Add(std::move(PendingLines[(PendingHead + Index) % MaxPendingLines]));
+            }
+            PendingHead = 0;
+            PendingCount = 0;
+        }
+
+    private:
+        static constexpr int32 MaxPendingLines = 4096;
+
+        std::mutex PendingMutex;
+        TArray<FString> PendingLines;   // 고정 크기 링 (PendingHead부터 PendingCount개)
+        int32 PendingHead = 0;
+        int32 PendingCount = 0;
+    };
+
+    FConsoleWidgetLogSink* ConsoleSink = nullptr;
+}
+
 void UGlobalConsole::Initialize()
 {
-    // Nothing special to initialize
+    if (!ConsoleSink)
+    {
+        ConsoleSink = new FConsoleWidgetLogSink();
+        FAsyncLog::Get().AddSink(ConsoleSink); // FAsyncLog가 소유
+    }
 }
 
 void UGlobalConsole::Shutdown()
 {
     ConsoleWidget = nullptr;
+
+    // 남은 로그를 모두 출력하고 로그 스레드 종료
+    if (FAsyncLog::IsInitialized())
+    {
+        FAsyncLog::Get().Shutdown();
+    }
 }
 
 void UGlobalConsole::SetConsoleWidget(UConsoleWidget* InConsoleWidget)
@@ -33,6 +105,21 @@ UConsoleWidget* UGlobalConsole::GetConsoleWidget()
     return ConsoleWidget;
 }
 
+void UGlobalConsole::FlushPendingLogs()
+{
+    if (!ConsoleSink || !ConsoleWidget)
+    {
+        return;
+    }
+
+    TArray<FString> Lines;
+    ConsoleSink->TakePendingLines(Lines);
+    for (const FString& Line : Lines)
+    {
+        ConsoleWidget->AddLog("%s", Line.c_str());
+    }
+}
+
 void UGlobalConsole::Log(const char* fmt, ...)
 {
 #ifdef _EDITOR
@@ -46,19 +133,9 @@ void UGlobalConsole::Log(const char* fmt, ...)
 void UGlobalConsole::LogV(const char* fmt, va_list args)
 {
 #ifdef _EDITOR
-    if (ConsoleWidget)
-    {
-        ConsoleWidget->VAddLog(fmt, args);
-    }
-    else
-    {
-        // Fallback to OutputDebugString if console widget not available
-        char tmp[8192];  // Increased buffer size for long Lua error messages
-        vsnprintf_s(tmp, _countof(tmp), _TRUNCATE, fmt, args);
-        OutputDebugStringA("[No Console] ");
-        OutputDebugStringA(tmp);
-        OutputDebugStringA("\n");
-    }
+    char tmp[8192];  // Increased buffer size for long Lua error messages
+    vsnprintf_s(tmp, _countof(tmp), _TRUNCATE, fmt, args);
+    FAsyncLog::Get().LogText(FLogCategoryLogTemp::Name, ELogVerbosity::Log, tmp);
 #endif
 }
 
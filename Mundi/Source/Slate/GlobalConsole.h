@@ -2,6 +2,7 @@
 #include <cstdarg>
 #include <iostream>
 #include "Object.h"
+#include "AsyncLog.h"
 
 class UConsoleWidget;
 
@@ -22,9 +23,13 @@ public:
     static UConsoleWidget* GetConsoleWidget();
     
     // Global logging functions (replaces ImGuiConsole functions)
+    // NOTE: 포맷 문자열의 수명을 보장할 수 없는 경로이므로 호출 스레드에서 포맷팅한 뒤 비동기 로거로 넘긴다.
     static void Log(const char* fmt, ...);
     static void LogV(const char* fmt, va_list args);
 
+    // 로그 스레드가 포맷팅한 줄을 콘솔 위젯으로 옮긴다. (ImGui 위젯이므로 메인 스레드에서 매 프레임 호출)
+    static void FlushPendingLogs();
+
 private:
     static UConsoleWidget* ConsoleWidget;
 };
@@ -34,4 +39,5 @@ extern "C" void ConsoleLog(const char* fmt, ...);
 extern "C" void ConsoleLogV(const char* fmt, va_list args);
 
 // UE_LOG macro replacement
-#define UE_LOG(fmt, ...) UGlobalConsole::Log(fmt, ##__VA_ARGS__)
+// 포맷 문자열 포인터와 인자만 기록하고 포맷팅은 로그 스레드에서 수행한다. (포맷 문자열은 리터럴만 허용)
+#define UE_LOG(fmt, ...) UE_LOG_CATEGORY(LogTemp, Log, fmt, ##__VA_ARGS__)
@@ -236,10 +236,10 @@ void UStatsOverlayD2D::Draw()
 
 	if (bShowMemory)
 	{
-		double Mb = static_cast<double>(FMemoryManager::TotalAllocationBytes) / (1024.0 * 1024.0);
+		double Mb = static_cast<double>(FMemoryManager::GetTotalAllocationBytes()) / (1024.0 * 1024.0);
 
 		wchar_t Buf[128];
-		swprintf_s(Buf, L"Memory: %.1f MB\nAllocs: %u", Mb, FMemoryManager::TotalAllocationCount);
+		swprintf_s(Buf, L"Memory: %.1f MB\nAllocs: %llu", Mb, FMemoryManager::GetTotalAllocationCount());
 
 		D2D1_RECT_F Rc = D2D1::RectF(Margin, NextY, Margin + PanelWidth, NextY + PanelHeight);
 		DrawTextBlock(
@@ -289,10 +289,11 @@ void UStatsOverlayD2D::Draw()
 
 		// 2. 출력할 문자열 버퍼를 만듭니다.
 		wchar_t Buf[512];
-		swprintf_s(Buf, L"[Tile Culling Stats]\nTiles: %u x %u (%u)\nLights: %u (P:%u S:%u)\nMin/Avg/Max: %u / %.1f / %u\nCulling Eff: %.1f%%\nBuffer: %u KB",
+		swprintf_s(Buf, L"[Light Culling Stats]\nClusters: %u x %u x %u (%u)\nLights: %u (P:%u S:%u)\nMin/Avg/Max: %u / %.1f / %u\nCulling Eff: %.1f%% (%u tests)\nCPU: %.3f ms  Buffer: %u KB",
 			TileStats.TileCountX,
 			TileStats.TileCountY,
-			TileStats.TotalTileCount,
+			TileStats.DepthSliceCount,
+			TileStats.TotalClusterCount,
 			TileStats.TotalLights,
 			TileStats.TotalPointLights,
 			TileStats.TotalSpotLights,
@@ -300,6 +301,8 @@ void UStatsOverlayD2D::Draw()
 			TileStats.AvgLightsPerTile,
 			TileStats.MaxLightsPerTile,
 			TileStats.CullingEfficiency,
+			TileStats.TotalLightTests,
+			TileStats.CullingTimeMS,
 			TileStats.LightIndexBufferSizeBytes / 1024);
 
 		// 3. 텍스트를 여러 줄 표시해야 하므로 패널 높이를 늘립니다.
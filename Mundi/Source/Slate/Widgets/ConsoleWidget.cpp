@@ -6,6 +6,17 @@
 #include "USlateManager.h"
 #include "Source/Runtime/Core/ErrorHandle/ErrorHandle.h"
 #include "SkinnedMeshComponent.h"
+#include "MathBatchBenchmark.h"
+#include "MeshBVHBenchmark.h"
+#include "RenderBenchmark.h"
+#include "MemoryBenchmark.h"
+#include "MemoryManager.h"
+#include "LevelLoadBenchmark.h"
+#include "ObjectLookupBenchmark.h"
+#include "ContainerBenchmark.h"
+#include "CookedLevel.h"
+#include "Profiler.h"
+#include "TestRunner.h"
 
 #include <windows.h>
 #include <cstdarg>
@@ -61,6 +72,29 @@ void UConsoleWidget::Initialize()
 	HelpCommandList.Add("STAT SKINNING");
 	HelpCommandList.Add("GPU SKINNING");
 	HelpCommandList.Add("CPU SKINNING");
+	HelpCommandList.Add("BENCH MATH");
+	HelpCommandList.Add("BENCH MESHBVH");
+	HelpCommandList.Add("BENCH RENDER");
+	HelpCommandList.Add("BENCH MEMORY");
+	HelpCommandList.Add("STAT POOLS");
+	HelpCommandList.Add("BENCH LEVEL");
+	HelpCommandList.Add("BENCH LOOKUP");
+	HelpCommandList.Add("BENCH HASH");
+	HelpCommandList.Add("COOK LEVEL");
+	HelpCommandList.Add("PIE SNAPSHOT");
+	HelpCommandList.Add("PIE DUPLICATE");
+	HelpCommandList.Add("STAT TICK");
+	HelpCommandList.Add("PROFILE START");
+	HelpCommandList.Add("PROFILE STOP");
+	HelpCommandList.Add("PROFILE FRAMES");
+	HelpCommandList.Add("STREAMING STATS");
+	HelpCommandList.Add("TICK PARALLEL");
+	HelpCommandList.Add("TICK SERIAL");
+	HelpCommandList.Add("TEST ALL");
+	for (const FTestSuite& Suite : FTestRunner::GetSuites())
+	{
+		HelpCommandList.Add(FString("TEST ") + Suite.Name);
+	}
 
 	// Add welcome messages
 	AddLog("=== Console Widget Initialized ===");
@@ -375,6 +409,197 @@ void UConsoleWidget::ExecCommand(const char* command_line)
 		USkinnedMeshComponent::SetGlobalGpuSkinningEnabled(false);
 		AddLog("CPU SKINNING CHANGED");
 	}
+	else if (Stricmp(command_line, "PIE SNAPSHOT") == 0)
+	{
+		UWorld::SetPIESnapshotDuplication(true);
+		AddLog("PIE DUPLICATION: snapshot (time-to-PIE is logged on PIE start)");
+	}
+	else if (Stricmp(command_line, "PIE DUPLICATE") == 0)
+	{
+		UWorld::SetPIESnapshotDuplication(false);
+		AddLog("PIE DUPLICATION: per-actor duplicate (time-to-PIE is logged on PIE start)");
+	}
+	else if (Stricmp(command_line, "STAT TICK") == 0)
+	{
+		if (!GWorld)
+		{
+			AddLog("[error] No world");
+		}
+		else
+		{
+			// 마지막으로 실행된 프레임의 틱 통계
+			const FTickStats& Stats = GWorld->GetTickManager().GetStats();
+			AddLog("STAT TICK: %u registered, %u actor / %u component ticks, %u parallel, %u interval skips, %u waves (%s)",
+				Stats.RegisteredTicks, Stats.ActorTicks, Stats.ComponentTicks, Stats.ParallelTicks, Stats.IntervalSkips, Stats.Waves,
+				FTickTaskManager::IsParallelTickEnabled() ? "parallel" : "serial");
+			for (int32 Group = 0; Group < static_cast<int32>(ETickingGroup::Max); ++Group)
+			{
+				AddLog("  %-15s %.3f ms", GetTickingGroupName(static_cast<ETickingGroup>(Group)), Stats.GroupMs[Group]);
+			}
+		}
+	}
+	else if (Stricmp(command_line, "TICK PARALLEL") == 0)
+	{
+		FTickTaskManager::SetParallelTickEnabled(true);
+		AddLog("TICK: parallel ticking on (worker-thread safe components run across threads)");
+	}
+	else if (Stricmp(command_line, "TICK SERIAL") == 0)
+	{
+		FTickTaskManager::SetParallelTickEnabled(false);
+		AddLog("TICK: parallel ticking off (all ticks on the game thread)");
+	}
+	else if (Stricmp(command_line, "BENCH MATH") == 0)
+	{
+		AddLog("BENCH MATH: 4096 elements, 200 iterations (SIMD level: %s)", FMathBatch::GetSimdLevelName(FMathBatch::GetSimdLevel()));
+		for (const FMathBatchBenchmarkResult& Result : FMathBatchBenchmark::Run())
+		{
+			AddLog("%s", FMathBatchBenchmark::FormatResult(Result).c_str());
+		}
+	}
+	else if (Stricmp(command_line, "BENCH MESHBVH") == 0)
+	{
+		AddLog("BENCH MESHBVH: 16384 rays per mesh, 3 builds (brute force: first 256 rays)");
+		for (const FMeshBVHBenchmarkResult& Result : FMeshBVHBenchmark::Run())
+		{
+			AddLog("%s", FMeshBVHBenchmark::FormatResult(Result).c_str());
+		}
+	}
+	else if (Stricmp(command_line, "BENCH MEMORY") == 0)
+	{
+		AddLog("BENCH MEMORY: 16384 objects, 10 iterations (pooled slab allocator vs _aligned_malloc)");
+		for (const FMemoryBenchmarkResult& Result : FMemoryBenchmark::Run())
+		{
+			AddLog("%s", FMemoryBenchmark::FormatResult(Result).c_str());
+		}
+	}
+	else if (Stricmp(command_line, "STAT POOLS") == 0)
+	{
+		TArray<FMemoryPoolStats> PoolStats;
+		FMemoryManager::GetPoolStats(PoolStats);
+		AddLog("STAT POOLS: %s, %.1f MB in %llu allocations", FMemoryManager::IsPoolingEnabled() ? "pooling on" : "pooling off",
+			static_cast<double>(FMemoryManager::GetTotalAllocationBytes()) / (1024.0 * 1024.0), FMemoryManager::GetTotalAllocationCount());
+		for (const FMemoryPoolStats& Stats : PoolStats)
+		{
+			if (Stats.SlabCount > 0)
+			{
+				AddLog("  <= %4u bytes: %lld live, %u slabs", Stats.BlockSize, Stats.LiveBlocks, Stats.SlabCount);
+			}
+		}
+	}
+	else if (Stricmp(command_line, "BENCH LOOKUP") == 0)
+	{
+		AddLog("BENCH LOOKUP: 100000 lookups per world size (linear scan: first 200), one component per actor");
+		for (const FObjectLookupBenchmarkResult& Result : FObjectLookupBenchmark::Run())
+		{
+			AddLog("%s", FObjectLookupBenchmark::FormatResult(Result).c_str());
+		}
+	}
+	else if (Stricmp(command_line, "BENCH HASH") == 0)
+	{
+		AddLog("BENCH HASH: 50000 elements, 5 iterations (TMap/TSet open addressing vs std::unordered_map/set)");
+		for (const FContainerBenchmarkResult& Result : FContainerBenchmark::Run())
+		{
+			AddLog("%s", FContainerBenchmark::FormatResult(Result).c_str());
+		}
+	}
+	else if (Stricmp(command_line, "PROFILE START") == 0)
+	{
+		FProfiler::StartCapture();
+		AddLog("PROFILE: capture started (PROFILE STOP to export)");
+	}
+	else if (Stricmp(command_line, "PROFILE STOP") == 0)
+	{
+		const FString OutputPath = "Saved/Profiling/Trace.json";
+		FProfiler::StopCapture();
+		if (FProfiler::ExportChromeTrace(OutputPath))
+		{
+			AddLog("PROFILE: %u frames, %llu events (%llu dropped) -> %s", FProfiler::GetCapturedFrameCount(),
+				FProfiler::GetCapturedEventCount(), FProfiler::GetDroppedEventCount(), OutputPath.c_str());
+		}
+		else
+		{
+			AddLog("[error] PROFILE: failed to write %s", OutputPath.c_str());
+		}
+
+		// 자기 시간 상위 스코프 요약
+		TArray<FProfileScopeStats> Stats;
+		FProfiler::GetScopeStats(Stats);
+		const int32 NumToShow = std::min<int32>(static_cast<int32>(Stats.size()), 15);
+		for (int32 Index = 0; Index < NumToShow; ++Index)
+		{
+			const FProfileScopeStats& Entry = Stats[Index];
+			AddLog("  %-28s calls %6u  incl %8.3f ms  excl %8.3f ms  alloc %8llu B / %llu",
+				Entry.Name.c_str(), Entry.CallCount, Entry.InclusiveMs, Entry.ExclusiveMs,
+				Entry.AllocatedBytes, Entry.AllocationCount);
+		}
+	}
+	else if (Strnicmp(command_line, "PROFILE FRAMES", 14) == 0)
+	{
+		int32 FrameCount = atoi(command_line + 14);
+		if (FrameCount <= 0)
+		{
+			FrameCount = 60;
+		}
+		FProfiler::CaptureFrames(FrameCount, "Saved/Profiling/Trace.json");
+		AddLog("PROFILE: capturing %d frames -> Saved/Profiling/Trace.json", FrameCount);
+	}
+	else if (Stricmp(command_line, "STREAMING STATS") == 0)
+	{
+		const FAssetStreamingStats Stats = UResourceManager::GetInstance().GetAsyncLoadStats();
+		AddLog("STREAMING: %u pending, %u loading, %u ready to finalize",
+			Stats.NumPending, Stats.NumLoading, Stats.NumReadyToFinalize);
+		AddLog("STREAMING: %llu requested, %llu deduplicated, %llu completed, %llu canceled, %llu failed, %llu sync fallbacks",
+			Stats.NumRequested, Stats.NumDeduplicated, Stats.NumCompleted, Stats.NumCanceled, Stats.NumFailed, Stats.NumSyncFallbacks);
+		AddLog("STREAMING: worker %.2f ms, finalize %.2f ms, game thread wait %.2f ms",
+			Stats.TotalWorkerMs, Stats.TotalFinalizeMs, Stats.TotalWaitMs);
+	}
+	else if (Strnicmp(command_line, "TEST ", 5) == 0)
+	{
+		const char* TestName = command_line + 5;
+		const FTestRunSummary Summary = FTestRunner::Run(TestName, [this](bool bError, const char* Line)
+		{
+			AddLog(bError ? "[error] %s" : "%s", Line);
+		});
+		if (Summary.RunCount == 0)
+		{
+			AddLog("[error] TEST: unknown test '%s' (see HELP)", TestName);
+		}
+	}
+	else if (Stricmp(command_line, "BENCH RENDER") == 0)
+	{
+		// 뷰는 렌더 중에만 유효하므로 다음 프레임의 첫 뷰에서 측정
+		FRenderBenchmark::Request(100);
+		AddLog("BENCH RENDER: 100 frames of gather/collect/sort/submit on the Null RHI (results on next frame)");
+	}
+	else if (Stricmp(command_line, "BENCH LEVEL") == 0 || Stricmp(command_line, "COOK LEVEL") == 0)
+	{
+		// 마지막으로 열거나 저장한 씬 파일(.scene) 기준
+		if (!EditorINI.Contains("LastUsedLevel"))
+		{
+			AddLog("[error] No scene has been loaded or saved yet");
+		}
+		else
+		{
+			const FWideString ScenePath = UTF8ToWide(EditorINI["LastUsedLevel"]);
+			if (Stricmp(command_line, "COOK LEVEL") == 0)
+			{
+				int32 ActorCount = 0;
+				if (FCookedLevel::CookScene(ScenePath, &ActorCount))
+				{
+					AddLog("COOK LEVEL: %d actors -> %s", ActorCount, WideToUTF8(FCookedLevel::GetCookedPath(ScenePath)).c_str());
+				}
+				else
+				{
+					AddLog("[error] COOK LEVEL failed: %s", EditorINI["LastUsedLevel"].c_str());
+				}
+			}
+			else
+			{
+				AddLog("BENCH LEVEL: %s, 5 loads per format", EditorINI["LastUsedLevel"].c_str());
+				AddLog("%s", FLevelLoadBenchmark::FormatResult(FLevelLoadBenchmark::Run(ScenePath)).c_str());
+			}
+		}
+	}
 	else if (Stricmp(command_line, "STAT ALL") == 0)
 	{
 		UStatsOverlayD2D::Get().SetShowFPS(true);
@@ -816,7 +816,7 @@ void UMainToolbarWidget::ProcessPendingCommands()
                     {
                         // 고유 이름 생성
                         FString ActorName = GWorld->GenerateUniqueActorName(PendingActorClass->DisplayName);
-                        NewActor->ObjectName = FName(ActorName);
+                        NewActor->SetName(FName(ActorName));
 
                         // 랜덤 위치 설정
                         FVector randomPos = GetRandomPositionInRange();
@@ -838,7 +838,7 @@ void UMainToolbarWidget::ProcessPendingCommands()
                 {
                     // 고유 이름 생성
                     FString ActorName = GWorld->GenerateUniqueActorName(PendingActorClass->DisplayName);
-                    NewActor->ObjectName = FName(ActorName);
+                    NewActor->SetName(FName(ActorName));
 
                     // 카메라 앞쪽에 배치
                     ACameraActor* Camera = GWorld->GetEditorCameraActor();
@@ -77,6 +77,9 @@ static const int ERibbonTaperMethodCount = 5;
 static const char* EBeamMethodNames[] = { "Distance", "Target", "Source" };
 static const int EBeamMethodCount = 3;
 
+static const char* ECollisionChannelNames[] = { "WorldStatic", "WorldDynamic", "Pawn", "PhysicsBody" };
+static const int ECollisionChannelCount = 4;
+
 // Enum 타입별 정보를 담는 구조체
 struct FEnumInfo
 {
@@ -93,6 +96,7 @@ static FEnumInfo RegisteredEnums[] = {
 	{ "EBeamNoiseAlgorithm", EBeamNoiseAlgorithmNames, EBeamNoiseAlgorithmCount },
 	{ "ERibbonTaperMethod", ERibbonTaperMethodNames, ERibbonTaperMethodCount },
 	{ "EBeamMethod", EBeamMethodNames, EBeamMethodCount },
+	{ "ECollisionChannel", ECollisionChannelNames, ECollisionChannelCount },
 	// 여기에 새 Enum 추가 가능
 };
 static const int RegisteredEnumCount = sizeof(RegisteredEnums) / sizeof(RegisteredEnums[0]);
@@ -878,7 +882,8 @@ bool UPropertyRenderer::RenderNameProperty(const FProperty& Prop, void* Instance
 
 		if (BufferText != ValuePtr->ToString())
 		{
-			*ValuePtr = FName(BufferText);
+			// ObjectName이면 SetName을 거쳐 월드 이름 색인까지 갱신
+			static_cast<UObject*>(Instance)->SetNamePropertyValue(Prop, FName(BufferText));
 			bValueWasChanged = true;
 		}
 	}
@@ -1264,7 +1269,7 @@ bool UPropertyRenderer::RenderScriptFileProperty(const FProperty& Property, void
 			// 4. 생성할 파일이 이미 존재하는지 중복 체크
 			else if (fs::exists(UTF8ToWide(RelativePath)))
 			{
-				UE_LOG(("[error] '" + NewFileName + Extension + "' 파일이 이미 존재합니다.").c_str());
+				UE_LOG("%s", ("[error] '" + NewFileName + Extension + "' 파일이 이미 존재합니다.").c_str());
 			}
 			else
 			{
@@ -1284,7 +1289,7 @@ bool UPropertyRenderer::RenderScriptFileProperty(const FProperty& Property, void
 				}
 				catch (const fs::filesystem_error& E)
 				{
-					UE_LOG(("[error] 파일 복사에 실패했습니다. " + FString(E.what())).c_str());
+					UE_LOG("%s", ("[error] 파일 복사에 실패했습니다. " + FString(E.what())).c_str());
 				}
 			}
 
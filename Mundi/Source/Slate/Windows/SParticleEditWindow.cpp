@@ -887,6 +887,12 @@ void SParticleEditWindow::OnRender()
                                 }
                             }
 
+                            // 드래그/삭제/정렬 결과를 룩업 테이블에 반영 (추가는 AddPoint에서 처리)
+                            if (bChanged || ImGui::IsMouseReleased(0))
+                            {
+                                Value->Curve.Bake();
+                            }
+
                             // 더블클릭으로 키프레임 추가
                             if (is_hovered && ImGui::IsMouseDoubleClicked(0) && !panning)
                             {
@@ -1228,6 +1234,12 @@ void SParticleEditWindow::OnRender()
                                         }
                                     }
 
+                                    // 드래그/삭제/정렬 결과를 룩업 테이블에 반영 (추가는 AddPoint에서 처리)
+                                    if (bChanged || ImGui::IsMouseReleased(0))
+                                    {
+                                        Value->Curve.Bake();
+                                    }
+
                                     if (is_hovered && ImGui::IsMouseDoubleClicked(0))
                                     {
                                         ImVec2 mouse_pos = ImGui::GetMousePos();
@@ -1885,7 +1885,7 @@ void SViewportWindow::RenderShowFlagDropdownMenu()
 				if (tempTileSize >= 4 && tempTileSize <= 64)
 				{
 					RenderSettings.SetTileSize(tempTileSize);
-					// TileLightCuller는 매 프레임 생성되므로 다음 프레임에 자동 적용됨
+					// ClusteredLightCuller는 매 프레임 생성되므로 다음 프레임에 자동 적용됨
 				}
 			}
 			if (ImGui::IsItemHovered())
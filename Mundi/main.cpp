@@ -1,5 +1,7 @@
 ﻿#include "pch.h"
 #include "EditorEngine.h"
+#include "TickTaskManager.h"
+#include "TestRunner.h"
 #include "Source/Runtime/Core/ErrorHandle/ErrorHandle.h"
 
 #if defined(_MSC_VER) && defined(_DEBUG)
@@ -8,6 +10,76 @@
 #   include <crtdbg.h>
 #endif
 
+namespace
+{
+    // 명령줄에서 "-Name" 또는 "-Name=Value" 스위치를 찾는다 (대소문자 무시). 값이 있으면 OutValue에 담는다
+    bool ParseSwitch(const char* CommandLine, const char* Name, FString* OutValue = nullptr)
+    {
+        const size_t NameLength = strlen(Name);
+        const char* Cursor = CommandLine ? CommandLine : "";
+        while (*Cursor)
+        {
+            while (*Cursor == ' ' || *Cursor == '\t')
+            {
+                ++Cursor;
+            }
+            const char* TokenBegin = Cursor;
+            while (*Cursor && *Cursor != ' ' && *Cursor != '\t')
+            {
+                ++Cursor;
+            }
+
+            if (TokenBegin[0] != '-' || _strnicmp(TokenBegin + 1, Name, NameLength) != 0)
+            {
+                continue;
+            }
+            const char* NameEnd = TokenBegin + 1 + NameLength;
+            if (NameEnd == Cursor)
+            {
+                return true;
+            }
+            if (*NameEnd == '=')
+            {
+                if (OutValue)
+                {
+                    *OutValue = FString(NameEnd + 1, Cursor);
+                }
+                return true;
+            }
+        }
+        return false;
+    }
+
+    // -test=<이름|ALL>: 에디터와 D3D 디바이스를 만들기 전에 헤드리스 검사만 실행하고 종료 코드로 결과를 알린다
+    // (실패나 알 수 없는 이름이면 1). 결과는 표준 출력으로, 리다이렉트되지 않았으면 부모 콘솔에 붙어서 쓴다
+    int RunHeadlessTests(const FString& TestName)
+    {
+        const HANDLE StdOut = GetStdHandle(STD_OUTPUT_HANDLE);
+        if ((StdOut == nullptr || StdOut == INVALID_HANDLE_VALUE) && AttachConsole(ATTACH_PARENT_PROCESS))
+        {
+            FILE* Stream = nullptr;
+            freopen_s(&Stream, "CONOUT$", "w", stdout);
+        }
+
+        const FTestRunSummary Summary = FTestRunner::Run(TestName.c_str(), [](bool bError, const char* Line)
+        {
+            printf("%s%s\n", bError ? "[error] " : "", Line);
+        });
+        if (Summary.RunCount == 0)
+        {
+            printf("[error] TEST: unknown test '%s' (expected ALL", TestName.c_str());
+            for (const FTestSuite& Suite : FTestRunner::GetSuites())
+            {
+                printf(", %s", Suite.Name);
+            }
+            printf(")\n");
+        }
+        fflush(stdout);
+
+        return (Summary.RunCount == 0 || Summary.FailedCount > 0) ? 1 : 0;
+    }
+}
+
 int WINAPI WinMain(HINSTANCE hInstance, HINSTANCE hPrevInstance, LPSTR lpCmdLine, int nShowCmd)
 {
 #if defined(_MSC_VER) && defined(_DEBUG)
@@ -19,6 +91,21 @@ int WINAPI WinMain(HINSTANCE hInstance, HINSTANCE hPrevInstance, LPSTR lpCmdLine
 #endif
     // 전역 예외 필터 등록: 프로그램에서 잡히지 않은 예외가 발생하면 호출된다.
     SetUnhandledExceptionFilter(ErrorHandle::UnhandledExceptionFilter);
+
+    // static 초기화에서 모든 클래스 등록이 끝났으므로 클래스 트리 번호를 한 번에 매김
+    UClass::EnsureClassTree();
+
+    FString TestName;
+    if (ParseSwitch(lpCmdLine, "test", &TestName))
+    {
+        return RunHeadlessTests(TestName);
+    }
+
+    // 워커 스레드 틱은 기본으로 꺼져 있음 (검증된 컴포넌트만 병렬로 돌리므로 켜는 것은 선택)
+    if (ParseSwitch(lpCmdLine, "paralleltick"))
+    {
+        FTickTaskManager::SetParallelTickEnabled(true);
+    }
     
     if (!GEngine.Startup(hInstance))
         return -1;